@@ -40,6 +40,10 @@
 # If you wish to require the presence of CEREAL, you may define SEQAN3_CEREAL.
 # If you wish to require the presence of LEMON, you may define SEQAN3_LEMON.
 #
+# If you define SEQAN3_PRECOMPILED_LIB, a static library with explicit instantiations of common
+# templates (see seqan3/precompiled.hpp) is built; link the additional target seqan3::precompiled
+# to skip re-instantiating them in your own translation units.
+#
 # Once the search has been performed, the following variables will be set.
 #
 #   SEQAN3_FOUND            -- Indicate whether SeqAn was found and requirements met.
@@ -466,6 +470,29 @@ else ()
     seqan3_config_print ("Optional dependency:        BZip2 not found.")
 endif ()
 
+# ----------------------------------------------------------------------------
+# Zstandard dependency
+# ----------------------------------------------------------------------------
+
+if (NOT SEQAN3_NO_ZSTD)
+    # no module shipped with CMake, so search for header and library directly
+    find_path (ZSTD_INCLUDE_DIR NAMES zstd.h)
+    find_library (ZSTD_LIBRARY NAMES zstd)
+
+    if (ZSTD_INCLUDE_DIR AND ZSTD_LIBRARY)
+        set (ZSTD_FOUND TRUE)
+    endif ()
+endif ()
+
+if (ZSTD_FOUND)
+    set (SEQAN3_LIBRARIES         ${SEQAN3_LIBRARIES}         ${ZSTD_LIBRARY})
+    set (SEQAN3_DEPENDENCY_INCLUDE_DIRS      ${SEQAN3_DEPENDENCY_INCLUDE_DIRS}      ${ZSTD_INCLUDE_DIR})
+    set (SEQAN3_DEFINITIONS       ${SEQAN3_DEFINITIONS}       "-DSEQAN3_HAS_ZSTD=1")
+    seqan3_config_print ("Optional dependency:        Zstandard found.")
+else ()
+    seqan3_config_print ("Optional dependency:        Zstandard not found.")
+endif ()
+
 # ----------------------------------------------------------------------------
 # System dependencies
 # ----------------------------------------------------------------------------
@@ -588,6 +615,30 @@ add_library (seqan3::seqan3 ALIAS seqan3_seqan3)
 # propagate SEQAN3_INCLUDE_DIR into SEQAN3_INCLUDE_DIRS
 set (SEQAN3_INCLUDE_DIRS ${SEQAN3_INCLUDE_DIR} ${SEQAN3_DEPENDENCY_INCLUDE_DIRS})
 
+# ----------------------------------------------------------------------------
+# Optional pre-instantiation library
+# ----------------------------------------------------------------------------
+
+# SeqAn3 is header-only; tools that use the same common template combinations (e.g. fm_index over
+# std::vector<dna4>) re-instantiate them in every translation unit. This optional static library compiles
+# the instantiations listed in seqan3/precompiled.hpp once; linking seqan3::precompiled defines
+# SEQAN3_PRECOMPILED on the consumer, turning the list into extern-template declarations.
+option (SEQAN3_PRECOMPILED_LIB "Build a static library with explicit instantiations of common SeqAn3 templates." OFF)
+
+if (SEQAN3_PRECOMPILED_LIB)
+    find_path (SEQAN3_SRC_DIR NAMES precompiled.cpp HINTS "${SEQAN3_INCLUDE_DIR}/../src")
+
+    if (SEQAN3_SRC_DIR)
+        add_library (seqan3_precompiled STATIC "${SEQAN3_SRC_DIR}/precompiled.cpp")
+        target_compile_definitions (seqan3_precompiled PUBLIC "-DSEQAN3_PRECOMPILED=1")
+        target_link_libraries (seqan3_precompiled PUBLIC seqan3::seqan3)
+        add_library (seqan3::precompiled ALIAS seqan3_precompiled)
+        seqan3_config_print ("Pre-instantiation library:  enabled; additionally link seqan3::precompiled.")
+    else ()
+        seqan3_config_error ("SEQAN3_PRECOMPILED_LIB was set, but src/precompiled.cpp was not found.")
+    endif ()
+endif ()
+
 if (SEQAN3_FIND_DEBUG)
   message ("Result for ${CMAKE_CURRENT_SOURCE_DIR}/CMakeLists.txt")
   message ("")
@@ -599,6 +650,7 @@ if (SEQAN3_FIND_DEBUG)
   message ("  ${FIND_NAME}_FOUND                ${${FIND_NAME}_FOUND}")
   message ("  SEQAN3_HAS_ZLIB             ${ZLIB_FOUND}")
   message ("  SEQAN3_HAS_BZIP2            ${BZIP2_FOUND}")
+  message ("  SEQAN3_HAS_ZSTD             ${ZSTD_FOUND}")
   message ("")
   message ("  SEQAN3_INCLUDE_DIRS         ${SEQAN3_INCLUDE_DIRS}")
   message ("  SEQAN3_LIBRARIES            ${SEQAN3_LIBRARIES}")
@@ -260,6 +260,34 @@ inline typename aligned_seq_t::iterator insert_gap(aligned_seq_t & aligned_seq,
     return aligned_seq.insert(pos_it, size, value_type_t<aligned_seq_t>{gap{}});
 }
 
+/*!\brief An implementation of seqan3::aligned_sequence_concept::insert_gaps for sequence containers.
+ * \tparam        aligned_seq_t   Type of the container to modify; must model seqan3::sequence_container_concept;
+ *                                The value type must be a seqan3::gapped alphabet.
+ * \tparam        gap_runs_t      Type of the gap run description; must model std::ranges::ForwardRange over a
+ *                                tuple-like type holding (position, length) pairs.
+ * \param[in,out] aligned_seq     The aligned container to modify.
+ * \param[in]     gap_runs        The gap runs to insert; positions refer to the *final* aligned sequence (i.e. they
+ *                                include all preceding runs of the description) and must be ascending.
+ *
+ * \details
+ *
+ * This function delegates to seqan3::insert_gap once per run. Types that can build their internal gap
+ * representation in a single pass (e.g. the gap decorators) provide an `insert_gaps` member function that this
+ * interface dispatches to instead.
+ */
+template <sequence_container_concept aligned_seq_t, std::ranges::ForwardRange gap_runs_t>
+//!\cond
+    requires detail::is_gapped_alphabet<value_type_t<aligned_seq_t>> &&
+             tuple_like_concept<value_type_t<remove_cvref_t<gap_runs_t>>>
+//!\endcond
+inline void insert_gaps(aligned_seq_t & aligned_seq, gap_runs_t && gap_runs)
+{
+    for (auto && run : gap_runs)
+        insert_gap(aligned_seq,
+                   std::next(std::ranges::begin(aligned_seq), std::get<0>(run)),
+                   std::get<1>(run));
+}
+
 /*!\brief An implementation of seqan3::aligned_sequence_concept::erase_gap for sequence containers.
  * \tparam        aligned_seq_t   Type of the container to modify; must model seqan3::sequence_container_concept;
  *                                The value type must be a seqan3::gapped alphabet.
@@ -387,6 +415,30 @@ typename range_type::iterator insert_gap(range_type & rng,
     return rng.insert_gap(it, size);
 }
 
+/*!\brief An implementation of seqan3::aligned_sequence_concept::insert_gaps for ranges with the corresponding
+ *        member function insert_gaps(gap_runs).
+ * \ingroup seqan3::aligned_sequence_concept
+ * \tparam range_type    Type of the range to modify; must have an insert_gaps(gap_runs) member function.
+ * \tparam gap_runs_t    Type of the gap run description; must model std::ranges::ForwardRange over a tuple-like
+ *                       type holding (position, length) pairs.
+ * \param[in,out] rng      The range to modify.
+ * \param[in]     gap_runs The gap runs to insert; positions refer to the *final* aligned sequence (i.e. they
+ *                         include all preceding runs of the description) and must be ascending.
+ *
+ * \details
+ *
+ * This function delegates to the member function `insert_gaps(gap_runs)` of the range, which can build the
+ * internal gap representation in a single pass instead of once per run.
+ */
+template <typename range_type, std::ranges::ForwardRange gap_runs_t>
+//!\cond
+    requires requires (range_type v, gap_runs_t r) { v.insert_gaps(r); }
+//!\endcond
+void insert_gaps(range_type & rng, gap_runs_t && gap_runs)
+{
+    rng.insert_gaps(std::forward<gap_runs_t>(gap_runs));
+}
+
 /*!\brief An implementation of seqan3::aligned_sequence_concept::erase_gap for ranges with the corresponding
  *        member function erase_gap(it).
  * \ingroup seqan3::aligned_sequence_concept
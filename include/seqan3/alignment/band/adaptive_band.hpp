@@ -0,0 +1,73 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::adaptive_band.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <seqan3/alignment/band/static_band.hpp>
+#include <seqan3/std/concepts>
+
+namespace seqan3
+{
+
+/*!\brief Data structure for an adaptive band.
+ * \ingroup alignment_band
+ *
+ * \details
+ *
+ * In contrast to seqan3::static_band the boundaries only describe the initial band. If the optimum of the computed
+ * alignment lies on one of the band boundaries, the band might have clipped the true optimum and the alignment is
+ * recomputed with a doubled band until the optimum lies strictly inside of the band or the band spans the entire
+ * alignment matrix. Accordingly, typical sequence pairs only pay the cost of the narrow initial band, while hard
+ * cases with many insertions or deletions remain correct at the cost of \f$ O(\log n) \f$ restarts.
+ */
+class adaptive_band
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr adaptive_band()                                  noexcept = default; //!< Defaulted
+    constexpr adaptive_band(adaptive_band const &)             noexcept = default; //!< Defaulted
+    constexpr adaptive_band(adaptive_band &&)                  noexcept = default; //!< Defaulted
+    constexpr adaptive_band & operator=(adaptive_band const &) noexcept = default; //!< Defaulted
+    constexpr adaptive_band & operator=(adaptive_band &&)      noexcept = default; //!< Defaulted
+    ~adaptive_band()                                           noexcept = default; //!< Defaulted
+
+    /*!\brief Construction from seqan3::lower_bound and seqan3::upper_bound.
+     * \tparam input_value_t The input type of the lower and upper band boundaries.
+     * \param lower The initial lower boundary of the band; must model std::Integral.
+     * \param upper The initial upper boundary of the band; must model std::Integral.
+     *
+     * \throws std::invalid_argument if upper < lower.
+     *
+     * \details
+     * The boundaries denote the initial maximum allowed inbalance of insertions and deletions in the alignment.
+     * For a symmetric band, choose lower = -upper. The upper boundary must not be smaller than the lower boundary.
+     */
+    template <std::Integral input_value_t>
+    constexpr adaptive_band(lower_bound<input_value_t> const lower, upper_bound<input_value_t> const upper)
+        : lower_bound{lower.get()}, upper_bound{upper.get()}
+    {
+        if (lower.get() > upper.get())
+        {
+            throw std::invalid_argument("The upper boundary must not be smaller than the lower boundary.");
+        }
+    }
+    //!}
+
+    //!\brief The data member storing the initial lower boundary of the band.
+    int64_t lower_bound{-1};
+    //!\brief The data member storing the initial upper boundary of the band.
+    int64_t upper_bound{1};
+};
+
+} // namespace seqan3
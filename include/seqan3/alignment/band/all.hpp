@@ -19,4 +19,5 @@
  * \todo Write detailed landing page.
  */
 
+#include <seqan3/alignment/band/adaptive_band.hpp>
 #include <seqan3/alignment/band/static_band.hpp>
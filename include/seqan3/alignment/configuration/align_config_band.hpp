@@ -14,6 +14,7 @@
 #pragma once
 
 #include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/alignment/band/adaptive_band.hpp>
 #include <seqan3/alignment/band/static_band.hpp>
 #include <seqan3/core/algorithm/pipeable_config_element.hpp>
 
@@ -27,8 +28,8 @@ namespace seqan3::align_cfg
  *
  * \details
  *
- * Configures the banded alignment algorithm. Currently only seqan3::static_band is allowed as argument.
- * If no band is configured for the alignment algorithm the full alignment matrix will be computed.
+ * Configures the banded alignment algorithm. Currently seqan3::static_band and seqan3::adaptive_band are allowed
+ * as argument. If no band is configured for the alignment algorithm the full alignment matrix will be computed.
  * Before executing the algorithm the band is tested for valid settings, e.g. that the upper bound is not smaller than
  * the lower bound, or the band is not shifted out of the alignment matrix. If an invalid setting is detected, a
  * seqan3::invalid_alignment_configuration exception will be thrown.
@@ -39,7 +40,7 @@ namespace seqan3::align_cfg
  */
 template <typename band_t>
 //!\cond
-    requires std::Same<band_t, static_band>
+    requires std::Same<band_t, static_band> || std::Same<band_t, adaptive_band>
 //!\endcond
 struct band : public pipeable_config_element<band<band_t>, band_t>
 {
@@ -0,0 +1,47 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::chunk_size configuration.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+
+/*!\brief Sets the number of sequence pairs processed per chunk of the alignment execution.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * When computing a range of sequence pairs, the executor pulls the pairs from the underlying resource in chunks
+ * and computes one chunk before handing the results to the consumer. The chunk size is the number of pairs per
+ * chunk and thereby the granularity at which alignments are submitted to the execution handler, e.g. the number
+ * of tasks available to the threads of a parallel execution. Small chunks reduce the memory held for buffered
+ * results and the latency until the first result is available, large chunks amortise the submission overhead
+ * over more pairs.
+ *
+ * The stored value is the number of pairs per chunk. If this configuration element is not set, the chunk size is
+ * derived from the dimensions of the first sequence pair, such that short pairs are processed in large chunks
+ * and long pairs, whose single alignment already constitutes enough work, in small ones. Note that one pair per
+ * chunk is always used if `0` is given.
+ */
+struct chunk_size : public pipeable_config_element<chunk_size, uint32_t>
+{
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::align_config_id id{detail::align_config_id::chunk_size};
+};
+
+} // namespace seqan3::align_cfg
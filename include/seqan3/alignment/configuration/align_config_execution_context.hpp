@@ -0,0 +1,48 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::execution_context configuration.
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+#include <seqan3/core/parallel/thread_pool.hpp>
+
+namespace seqan3::align_cfg
+{
+
+/*!\brief Runs the pairwise alignments on a shared seqan3::thread_pool.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * Like seqan3::align_cfg::parallel this configuration element enables the concurrent computation of the
+ * alignments, but instead of spawning a dedicated set of worker threads per call, the jobs are submitted to
+ * an externally owned seqan3::thread_pool. This is the right choice when several parallel subsystems (or
+ * several alignment calls) run at the same time: they all compete for the workers of one pool instead of
+ * oversubscribing the machine with a pool per call. The results are still emitted in the order of the input
+ * pairs when iterating over the returned seqan3::alignment_range.
+ *
+ * The stored value is a pointer to the pool to use; `nullptr` (the default) selects the process-wide
+ * seqan3::thread_pool::shared(). The pool must outlive the alignment computation. This element cannot be
+ * combined with seqan3::align_cfg::parallel — the user picks one execution mode per call.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_execution_context_example.cpp
+ */
+struct execution_context : public pipeable_config_element<execution_context, thread_pool *>
+{
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::align_config_id id{detail::align_config_id::execution_context};
+};
+
+} // namespace seqan3::align_cfg
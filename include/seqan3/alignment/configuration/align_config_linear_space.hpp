@@ -0,0 +1,52 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::linear_space configuration.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+
+namespace seqan3::detail
+{
+
+//!\brief An empty value type used by seqan3::align_cfg::linear_space.
+//!\ingroup alignment_configuration
+struct linear_space_tag
+{};
+
+} // namespace seqan3::detail
+
+namespace seqan3::align_cfg
+{
+
+/*!\brief Enables the linear-space alignment computation.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * If this configuration element is set, the global alignment is computed with the divide-and-conquer
+ * algorithm of Hirschberg instead of materialising the full trace matrix. This reduces the memory
+ * consumption of the traceback from quadratic to linear in the sequence lengths at the cost of roughly
+ * doubling the number of computed cells, which makes the alignment computation
+ * (seqan3::align_cfg::result with seqan3::with_alignment) feasible for long sequences.
+ *
+ * Currently, the linear-space alignment only supports global alignments with linear gap costs, i.e. a
+ * seqan3::gap_scheme without a gap open score.
+ */
+struct linear_space : public pipeable_config_element<linear_space, detail::linear_space_tag>
+{
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::align_config_id id{detail::align_config_id::linear_space};
+};
+
+} // namespace seqan3::align_cfg
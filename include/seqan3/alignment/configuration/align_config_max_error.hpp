@@ -17,17 +17,21 @@
 
 namespace seqan3::align_cfg
 {
-/*!\brief Sets the maximal errors allowed during an edit distance computation.
+/*!\brief Sets the maximal errors allowed during the alignment computation.
  * \ingroup alignment_configuration
  *
  * \details
  *
- * This configuration can only be used for computing the \ref seqan3::align_cfg::edit "edit distance".
  * It restricts the number of substitutions, insertions, and deletions within the alignment to the given value and
- * can thereby speed up the edit distance computation.
+ * can thereby speed up the computation.
+ * For the \ref seqan3::align_cfg::edit "edit distance" the band of computed rows is bounded with the Ukkonen trick.
+ * For the general global alignment the matrix is pruned to the corridor of diagonals reachable within the error
+ * budget; this is supported for the score and the back coordinate computation without free end gaps and without
+ * the band, tile and x-drop configurations, any other combination rejects this configuration with a
+ * seqan3::invalid_alignment_configuration exception. The reported score is exact whenever the optimal alignment
+ * stays within the budget.
  * A typical use case is to verify a candidate region during read mapping where the number of maximal errors is given
- * beforehand. If this configuration is used for an alignment algorithm that does not compute the edit distance, a
- * seqan3::invalid_alignment_configuration exception will be thrown.
+ * beforehand.
  *
  * ### Example
  *
@@ -0,0 +1,41 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::parallel configuration.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+
+/*!\brief Enables the parallel execution of the pairwise alignments.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * If this configuration element is set, the alignments of the passed sequence pairs are computed
+ * concurrently by the given number of threads. The results are still emitted in the order of the
+ * input pairs when iterating over the returned seqan3::alignment_range.
+ *
+ * The stored value is the number of threads to use. Note that one thread is always used if `0` is given.
+ */
+struct parallel : public pipeable_config_element<parallel, uint32_t>
+{
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::align_config_id id{detail::align_config_id::parallel};
+};
+
+} // namespace seqan3::align_cfg
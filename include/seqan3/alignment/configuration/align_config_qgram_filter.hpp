@@ -0,0 +1,111 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::qgram_filter configuration.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <stdexcept>
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/detail/strong_type.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+
+namespace seqan3
+{
+
+/*!\brief Type for the q-gram length of the q-gram pre-filter.
+ * \ingroup alignment_configuration
+ */
+struct qgram_size : detail::strong_type<uint8_t, qgram_size>
+{
+    //!\brief Inheriting constructors from base class.
+    using detail::strong_type<uint8_t, qgram_size>::strong_type;
+};
+
+/*!\brief Type for the minimum number of shared q-grams of the q-gram pre-filter.
+ * \ingroup alignment_configuration
+ */
+struct qgram_threshold : detail::strong_type<uint32_t, qgram_threshold>
+{
+    //!\brief Inheriting constructors from base class.
+    using detail::strong_type<uint32_t, qgram_threshold>::strong_type;
+};
+
+/*!\brief Data structure for the q-gram pre-filter parameters.
+ * \ingroup alignment_configuration
+ */
+class qgram_filter_scheme
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr qgram_filter_scheme()                                        noexcept = default; //!< Defaulted
+    constexpr qgram_filter_scheme(qgram_filter_scheme const &)             noexcept = default; //!< Defaulted
+    constexpr qgram_filter_scheme(qgram_filter_scheme &&)                  noexcept = default; //!< Defaulted
+    constexpr qgram_filter_scheme & operator=(qgram_filter_scheme const &) noexcept = default; //!< Defaulted
+    constexpr qgram_filter_scheme & operator=(qgram_filter_scheme &&)      noexcept = default; //!< Defaulted
+    ~qgram_filter_scheme()                                                 noexcept = default; //!< Defaulted
+
+    /*!\brief Construction from seqan3::qgram_size and seqan3::qgram_threshold.
+     * \param size      The length of the counted q-grams; must not be `0`.
+     * \param threshold The minimum number of shared q-grams below which a sequence pair is filtered out.
+     *
+     * \throws std::invalid_argument if the q-gram size is `0`.
+     */
+    constexpr qgram_filter_scheme(qgram_size const size, qgram_threshold const threshold)
+        : size{size.get()}, threshold{threshold.get()}
+    {
+        if (size.get() == 0u)
+        {
+            throw std::invalid_argument("The q-gram size must not be 0.");
+        }
+    }
+    //!\}
+
+    //!\brief The data member storing the length of the counted q-grams.
+    uint8_t size{4};
+    //!\brief The data member storing the minimum number of shared q-grams.
+    uint32_t threshold{1};
+};
+
+} // namespace seqan3
+
+namespace seqan3::align_cfg
+{
+
+/*!\brief Filters out sequence pairs that share too few q-grams before the alignment is computed.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * Before the dynamic programming matrix of a sequence pair is computed, the number of shared q-grams of the
+ * two sequences is counted, i.e. the size of the multiset intersection of their q-gram contents. If this count
+ * is below the configured threshold, the computation of this sequence pair is skipped entirely and the returned
+ * seqan3::alignment_result is flagged as filtered (see seqan3::alignment_result::is_filtered) without reporting
+ * a meaningful score. By the q-gram lemma two sequences of length \f$ n \f$ within edit distance \f$ k \f$ share
+ * at least \f$ n + 1 - q \cdot (k + 1) \f$ q-grams, which gives a lossless threshold for bounded error rates.
+ *
+ * The filter counts the q-grams in linear time in the sequence lengths, such that in all-vs-all workloads, where
+ * the vast majority of the sequence pairs do not share a significant alignment, the quadratic dynamic programming
+ * computation is only spent on the promising candidates.
+ *
+ * This configuration applies to all scalar alignment kernels but cannot be combined with
+ * seqan3::align_cfg::vectorise.
+ */
+struct qgram_filter : public pipeable_config_element<qgram_filter, qgram_filter_scheme>
+{
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::align_config_id id{detail::align_config_id::qgram_filter};
+};
+
+} // namespace seqan3::align_cfg
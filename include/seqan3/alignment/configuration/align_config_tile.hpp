@@ -0,0 +1,44 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::tile configuration.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+/*!\brief Computes the dynamic programming matrix in blocks of the given number of rows.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * The standard computation iterates over the matrix in a column wise manner, such that the working set of one
+ * column grows linearly with the length of the second sequence. For long sequences the column no longer fits
+ * into the processor cache and every cell update is served from main memory. With this configuration the matrix
+ * is instead processed in blocks of the given number of rows: within one block all columns are swept while only
+ * the corresponding segment of the column buffer is touched, and the cell states of the block's last row are
+ * carried over to the next block in a boundary vector with one entry per column. Choose the value such that the
+ * block of the column buffer fits into the L1 or L2 cache, e.g. a few thousand rows.
+ *
+ * This configuration is only supported by the standard dynamic programming alignment computing the score or the
+ * back coordinate and cannot be combined with seqan3::align_cfg::band, seqan3::align_cfg::max_error,
+ * seqan3::align_cfg::linear_space, seqan3::align_cfg::vectorise, or seqan3::align_cfg::x_drop.
+ */
+struct tile : public pipeable_config_element<tile, uint32_t>
+{
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::align_config_id id{detail::align_config_id::tile};
+};
+
+} // namespace seqan3::align_cfg
@@ -0,0 +1,53 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::vectorise configuration.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+
+namespace seqan3::detail
+{
+
+//!\brief An empty value type used by seqan3::align_cfg::vectorise.
+//!\ingroup alignment_configuration
+struct vectorise_tag
+{};
+
+} // namespace seqan3::detail
+
+namespace seqan3::align_cfg
+{
+
+/*!\brief Enables the vectorised alignment computation.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * If this configuration element is set, the alignment algorithm packs one cell of multiple independent
+ * sequence pairs into each lane of a seqan3::simd::simd_type vector and computes the dynamic programming
+ * recursion over all lanes in parallel (inter-sequence vectorisation). Accordingly, the input to
+ * seqan3::align_pairwise must be a range over sequence pairs; the pairs are internally processed in
+ * batches of seqan3::simd::simd_traits::length many alignments.
+ *
+ * Currently, the vectorised alignment only supports the score computation
+ * (seqan3::align_cfg::result with seqan3::with_score) and simple scoring schemes that assign one score
+ * for a match and one score for a mismatch.
+ */
+struct vectorise : public pipeable_config_element<vectorise, detail::vectorise_tag>
+{
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::align_config_id id{detail::align_config_id::vectorise};
+};
+
+} // namespace seqan3::align_cfg
@@ -0,0 +1,43 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::x_drop configuration.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+/*!\brief Terminates the alignment computation early if the score drops too far below the best score seen so far.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * After every computed column the optimum of that column is compared with the running optimum of the entire
+ * matrix. If the column optimum falls more than the given value below the running optimum, the remaining columns
+ * cannot recover and the computation of this sequence pair is aborted. The returned seqan3::alignment_result is
+ * then flagged as filtered (see seqan3::alignment_result::is_filtered) and reports the running optimum that was
+ * observed until the computation was aborted. A typical use case is an all-vs-all overlap computation where the
+ * vast majority of the sequence pairs do not share a significant alignment and can be dropped cheaply.
+ *
+ * This configuration is only supported by the standard dynamic programming alignment and cannot be combined with
+ * seqan3::align_cfg::band, seqan3::align_cfg::max_error, seqan3::align_cfg::linear_space, or
+ * seqan3::align_cfg::vectorise.
+ */
+struct x_drop : public pipeable_config_element<x_drop, int32_t>
+{
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::align_config_id id{detail::align_config_id::x_drop};
+};
+
+} // namespace seqan3::align_cfg
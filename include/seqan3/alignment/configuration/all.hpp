@@ -14,12 +14,20 @@
 
 #include <seqan3/alignment/configuration/align_config_aligned_ends.hpp>
 #include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/configuration/align_config_chunk_size.hpp>
+#include <seqan3/alignment/configuration/align_config_execution_context.hpp>
 #include <seqan3/alignment/configuration/align_config_edit.hpp>
 #include <seqan3/alignment/configuration/align_config_gap.hpp>
+#include <seqan3/alignment/configuration/align_config_linear_space.hpp>
 #include <seqan3/alignment/configuration/align_config_max_error.hpp>
 #include <seqan3/alignment/configuration/align_config_mode.hpp>
+#include <seqan3/alignment/configuration/align_config_parallel.hpp>
+#include <seqan3/alignment/configuration/align_config_qgram_filter.hpp>
 #include <seqan3/alignment/configuration/align_config_result.hpp>
 #include <seqan3/alignment/configuration/align_config_scoring.hpp>
+#include <seqan3/alignment/configuration/align_config_tile.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorise.hpp>
+#include <seqan3/alignment/configuration/align_config_x_drop.hpp>
 #include <seqan3/alignment/configuration/detail.hpp>
 
 /*!\namespace seqan3::align_cfg
@@ -24,11 +24,19 @@ enum struct align_config_id : uint8_t
 {
     aligned_ends, //!< ID for the \ref seqan3::align_cfg::aligned_ends "aligned_ends" option.
     band, //!< ID for the \ref seqan3::align_cfg::band "band" option.
+    chunk_size, //!< ID for the \ref seqan3::align_cfg::chunk_size "chunk_size" option.
+    execution_context, //!< ID for the \ref seqan3::align_cfg::execution_context "execution_context" option.
     gap, //!< ID for the \ref seqan3::align_cfg::gap "gap" option.
     global, //!< ID for the \ref seqan3::global_alignment "global alignment" option.
+    linear_space, //!< ID for the \ref seqan3::align_cfg::linear_space "linear_space" option.
     max_error, //!< ID for the \ref seqan3::align_cfg::max_error "max_error" option.
+    parallel, //!< ID for the \ref seqan3::align_cfg::parallel "parallel" option.
+    qgram_filter, //!< ID for the \ref seqan3::align_cfg::qgram_filter "qgram_filter" option.
     result, //!< ID for the \ref seqan3::align_cfg::result "result" option.
     scoring, //!< ID for the \ref seqan3::align_cfg::scoring "scoring" option.
+    tile, //!< ID for the \ref seqan3::align_cfg::tile "tile" option.
+    vectorise, //!< ID for the \ref seqan3::align_cfg::vectorise "vectorise" option.
+    x_drop, //!< ID for the \ref seqan3::align_cfg::x_drop "x_drop" option.
     SIZE //!< Represents the number of configuration elements.
 };
 
@@ -45,14 +53,22 @@ template <>
 inline constexpr std::array<std::array<bool, static_cast<uint8_t>(align_config_id::SIZE)>,
                             static_cast<uint8_t>(align_config_id::SIZE)> compatibility_table<align_config_id>
 {
-    {   //0  1  2  3  4  5  6
-        { 0, 1, 1, 1, 1, 1, 1}, // 0: aligned_ends
-        { 1, 0, 1, 1, 1, 1, 1}, // 1: band
-        { 1, 1, 0, 1, 1, 1, 1}, // 2: gap
-        { 1, 1, 1, 0, 1, 1, 1}, // 3: global
-        { 1, 1, 1, 1, 0, 1, 1}, // 4: max_error
-        { 1, 1, 1, 1, 1, 0, 1}, // 5: result
-        { 1, 1, 1, 1, 1, 1, 0}  // 6: scoring
+    {   //0  1  2  3  4  5  6  7  8  9 10 11 12 13 14
+        { 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // 0: aligned_ends
+        { 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0}, // 1: band
+        { 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // 2: chunk_size
+        { 1, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1}, // 3: execution_context
+        { 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // 4: gap
+        { 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // 5: global
+        { 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 1, 0}, // 6: linear_space
+        { 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 1, 0}, // 7: max_error
+        { 1, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1}, // 8: parallel
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 0, 1}, // 9: qgram_filter
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1}, // 10: result
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1}, // 11: scoring
+        { 1, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 0, 0, 0}, // 12: tile
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 0, 0}, // 13: vectorise
+        { 1, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 0, 0, 0}  // 14: x_drop
     }
 };
 
@@ -12,7 +12,7 @@
 
 #pragma once
 
-#include <deque>
+#include <algorithm>
 #include <vector>
 
 #include <seqan3/alignment/matrix/alignment_coordinate.hpp>
@@ -29,6 +29,12 @@ namespace seqan3::detail
  * \param[in] matrix          The trace matrix.
  * \param[in] back_coordinate Where the trace in the matrix ends.
  * \returns Returns the front coordinate.
+ *
+ * \details
+ *
+ * Any matrix modelling seqan3::detail::matrix_concept with seqan3::detail::trace_directions entries
+ * can be walked, e.g. the byte-wide seqan3::detail::alignment_trace_matrix as well as the bit-packed
+ * seqan3::detail::packed_trace_matrix.
  */
  template <typename trace_matrix_t>
  //!\cond
@@ -76,36 +82,43 @@ inline alignment_coordinate alignment_front_coordinate(trace_matrix_t && matrix,
     return {column_index_type{std::max<size_t>(col, 1) - 1}, row_index_type{std::max<size_t>(row, 1) - 1}};
 }
 
-/*!\brief Compute the trace from a trace matrix.
+/*!\brief Compute the trace from a trace matrix and emit both gapped sequences into the passed buffers.
  * \ingroup alignment_matrix
  * \tparam    database_t                 The type of the database sequence.
  * \tparam    query_t                    The type of the query sequence.
  * \tparam    trace_matrix_t             The type of the trace matrix.
- * \cond DEV
  * \tparam    gapped_database_alphabet_t The alphabet type of the gapped database sequence.
  * \tparam    gapped_query_alphabet_t    The alphabet type of the gapped query sequence.
- * \endcond
- * \param[in] database                   The database sequence.
- * \param[in] query                      The query sequence.
- * \param[in] matrix                     The trace matrix.
- * \param[in] back_coordinate            Where the trace in the matrix ends.
- * \returns Returns a seqan3::aligned_sequence.
+ * \param[in]     database        The database sequence.
+ * \param[in]     query           The query sequence.
+ * \param[in]     matrix          The trace matrix.
+ * \param[in]     back_coordinate Where the trace in the matrix ends.
+ * \param[in,out] gapped_database The buffer receiving the gapped database sequence.
+ * \param[in,out] gapped_query    The buffer receiving the gapped query sequence.
+ *
+ * \details
+ *
+ * Walks the trace once and appends the alignment columns directly to the passed buffers (in reverse order,
+ * followed by one std::reverse), so no intermediate trace range and no per-gap insertion into the middle of
+ * the sequences is needed. The buffers are cleared but keep their capacity, hence a caller that materialises
+ * many alignments can recycle them and stays free of allocations once the buffers have grown.
  */
 template <
     typename database_t,
     typename query_t,
     typename trace_matrix_t,
-    typename gapped_database_alphabet_t = gapped<value_type_t<database_t>>,
-    typename gapped_query_alphabet_t = gapped<value_type_t<query_t>>>
+    typename gapped_database_alphabet_t,
+    typename gapped_query_alphabet_t>
 //!\cond
     requires matrix_concept<remove_cvref_t<trace_matrix_t>> &&
              std::Same<typename remove_cvref_t<trace_matrix_t>::entry_type, trace_directions>
 //!\endcond
-inline std::pair<std::vector<gapped_database_alphabet_t>, std::vector<gapped_query_alphabet_t>>
-alignment_trace(database_t && database,
-                query_t && query,
-                trace_matrix_t && matrix,
-                alignment_coordinate const back_coordinate)
+inline void alignment_trace_into(database_t && database,
+                                 query_t && query,
+                                 trace_matrix_t && matrix,
+                                 alignment_coordinate const back_coordinate,
+                                 std::vector<gapped_database_alphabet_t> & gapped_database,
+                                 std::vector<gapped_query_alphabet_t> & gapped_query)
 {
     constexpr auto N = trace_directions::none;
     constexpr auto D = trace_directions::diagonal;
@@ -119,8 +132,11 @@ alignment_trace(database_t && database,
     assert(row < matrix.rows());
     assert(col < matrix.cols());
 
-    std::deque<gapped_database_alphabet_t> gapped_database{};
-    std::deque<gapped_query_alphabet_t> gapped_query{};
+    gapped_database.clear();
+    gapped_query.clear();
+    // The alignment cannot be longer than the two traced back sequence prefixes together.
+    gapped_database.reserve(row + col);
+    gapped_query.reserve(row + col);
 
     if (matrix.at(0, 0) != N)
         throw std::logic_error{"End trace must be NONE"};
@@ -131,21 +147,21 @@ alignment_trace(database_t && database,
         if ((dir & L) == L)
         {
             col = std::max<size_t>(col, 1) - 1;
-            gapped_database.push_front(database[col]);
-            gapped_query.push_front(gap{});
+            gapped_database.push_back(database[col]);
+            gapped_query.push_back(gap{});
         }
         else if ((dir & U) == U)
         {
             row = std::max<size_t>(row, 1) - 1;
-            gapped_database.push_front(gap{});
-            gapped_query.push_front(query[row]);
+            gapped_database.push_back(gap{});
+            gapped_query.push_back(query[row]);
         }
         else if ((dir & D) == D)
         {
             row = std::max<size_t>(row, 1) - 1;
             col = std::max<size_t>(col, 1) - 1;
-            gapped_database.push_front(database[col]);
-            gapped_query.push_front(query[row]);
+            gapped_database.push_back(database[col]);
+            gapped_query.push_back(query[row]);
         }
         else
         {
@@ -157,11 +173,52 @@ alignment_trace(database_t && database,
         }
     }
 
-    return
-    {
-        {std::begin(gapped_database), std::end(gapped_database)},
-        {std::begin(gapped_query), std::end(gapped_query)}
-    };
+    std::reverse(std::begin(gapped_database), std::end(gapped_database));
+    std::reverse(std::begin(gapped_query), std::end(gapped_query));
+}
+
+/*!\brief Compute the trace from a trace matrix.
+ * \ingroup alignment_matrix
+ * \tparam    database_t                 The type of the database sequence.
+ * \tparam    query_t                    The type of the query sequence.
+ * \tparam    trace_matrix_t             The type of the trace matrix.
+ * \cond DEV
+ * \tparam    gapped_database_alphabet_t The alphabet type of the gapped database sequence.
+ * \tparam    gapped_query_alphabet_t    The alphabet type of the gapped query sequence.
+ * \endcond
+ * \param[in] database                   The database sequence.
+ * \param[in] query                      The query sequence.
+ * \param[in] matrix                     The trace matrix.
+ * \param[in] back_coordinate            Where the trace in the matrix ends.
+ * \returns Returns a seqan3::aligned_sequence.
+ *
+ * \details
+ *
+ * Delegates to seqan3::detail::alignment_trace_into with freshly allocated buffers; callers that
+ * materialise many alignments should use the buffer-reusing overload directly.
+ */
+template <
+    typename database_t,
+    typename query_t,
+    typename trace_matrix_t,
+    typename gapped_database_alphabet_t = gapped<value_type_t<database_t>>,
+    typename gapped_query_alphabet_t = gapped<value_type_t<query_t>>>
+//!\cond
+    requires matrix_concept<remove_cvref_t<trace_matrix_t>> &&
+             std::Same<typename remove_cvref_t<trace_matrix_t>::entry_type, trace_directions>
+//!\endcond
+inline std::pair<std::vector<gapped_database_alphabet_t>, std::vector<gapped_query_alphabet_t>>
+alignment_trace(database_t && database,
+                query_t && query,
+                trace_matrix_t && matrix,
+                alignment_coordinate const back_coordinate)
+{
+    std::vector<gapped_database_alphabet_t> gapped_database{};
+    std::vector<gapped_query_alphabet_t> gapped_query{};
+
+    alignment_trace_into(database, query, matrix, back_coordinate, gapped_database, gapped_query);
+
+    return {std::move(gapped_database), std::move(gapped_query)};
 }
 
 } // namespace seqan3::detail
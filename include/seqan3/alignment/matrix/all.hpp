@@ -24,5 +24,7 @@
 #include <seqan3/alignment/matrix/alignment_optimum.hpp>
 #include <seqan3/alignment/matrix/alignment_score_matrix.hpp>
 #include <seqan3/alignment/matrix/alignment_trace_matrix.hpp>
+#include <seqan3/alignment/matrix/banded_trace_matrix.hpp>
 #include <seqan3/alignment/matrix/matrix_concept.hpp>
+#include <seqan3/alignment/matrix/packed_trace_matrix.hpp>
 #include <seqan3/alignment/matrix/row_wise_matrix.hpp>
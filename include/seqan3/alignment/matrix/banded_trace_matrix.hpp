@@ -0,0 +1,183 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Contains seqan3::detail::banded_trace_matrix.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include <seqan3/alignment/matrix/matrix_concept.hpp>
+#include <seqan3/alignment/matrix/trace_directions.hpp>
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A trace matrix for banded alignments that only stores the cells inside of the band.
+ * \ingroup alignment_matrix
+ * \implements seqan3::detail::matrix_concept
+ *
+ * \details
+ *
+ * A banded alignment only ever writes trace information to the cells whose diagonal
+ * (`column index - row index`) lies between the lower and the upper diagonal of the band.
+ * Storing the full matrix nonetheless makes the trace allocation scale with
+ * `rows * cols` even though only `band_size * cols` cells carry information, which for
+ * long sequences with a narrow band wastes almost the entire allocation.
+ *
+ * This matrix stores the band diagonally sheared in band-local coordinates: column `col`
+ * occupies the slots `[col * band_size, (col + 1) * band_size)` and the cell
+ * (*row*, *col*) lives in slot `row - col + upper_diagonal` of its column, i.e. each
+ * diagonal of the matrix becomes a row of the sheared band. This is the same layout that
+ * seqan3::detail::banded_score_trace_dp_matrix_policy uses for its trace storage.
+ *
+ * The translation from matrix coordinates to band-local coordinates happens inside of
+ * at; cells outside of the band read as seqan3::detail::trace_directions::none. The
+ * trace walks in seqan3::detail::alignment_front_coordinate and
+ * seqan3::detail::alignment_trace therefore work on this matrix unchanged, as long as
+ * the traced path does not leave the band (which it cannot, since a banded alignment
+ * never points outside of the band).
+ */
+class banded_trace_matrix
+{
+public:
+    //!\copydoc seqan3::detail::matrix_concept::entry_type
+    using entry_type = trace_directions;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    banded_trace_matrix() = default;                                       //!< Defaulted
+    banded_trace_matrix(banded_trace_matrix const &) = default;            //!< Defaulted
+    banded_trace_matrix(banded_trace_matrix &&) = default;                 //!< Defaulted
+    banded_trace_matrix & operator=(banded_trace_matrix const &) = default;//!< Defaulted
+    banded_trace_matrix & operator=(banded_trace_matrix &&) = default;     //!< Defaulted
+    ~banded_trace_matrix() = default;                                      //!< Defaulted
+
+    /*!\brief Construct an empty matrix with the given dimensions and band; fill it with set.
+     * \param rows           The number of rows of the represented full matrix.
+     * \param cols           The number of columns of the represented full matrix.
+     * \param lower_diagonal The lower diagonal of the band (`<= 0` crosses the origin).
+     * \param upper_diagonal The upper diagonal of the band (`>= lower_diagonal`).
+     *
+     * \details
+     *
+     * Only `(upper_diagonal - lower_diagonal + 1) * cols` cells are allocated; all cells
+     * initially read as seqan3::detail::trace_directions::none.
+     */
+    banded_trace_matrix(size_t const rows, size_t const cols,
+                        std::int32_t const lower_diagonal, std::int32_t const upper_diagonal)
+        : _rows{rows}, _cols{cols}, _lower_diagonal{lower_diagonal}, _upper_diagonal{upper_diagonal},
+          _band_size{static_cast<size_t>(static_cast<std::int64_t>(upper_diagonal) - lower_diagonal) + 1},
+          _entries(_band_size * cols, entry_type::none)
+    {
+        assert(lower_diagonal <= upper_diagonal);
+    }
+
+    /*!\brief Construct the matrix out of a full matrix given as flat *entries*, keeping only the band.
+     * \param entries        The entry values of the full matrix (each row stored continuously).
+     * \param rows           The number of rows.
+     * \param cols           The number of columns.
+     * \param lower_diagonal The lower diagonal of the band.
+     * \param upper_diagonal The upper diagonal of the band.
+     */
+    banded_trace_matrix(std::vector<trace_directions> const & entries, size_t const rows, size_t const cols,
+                        std::int32_t const lower_diagonal, std::int32_t const upper_diagonal)
+        : banded_trace_matrix{rows, cols, lower_diagonal, upper_diagonal}
+    {
+        assert(entries.size() == rows * cols);
+
+        for (size_t row = 0u; row < rows; ++row)
+            for (size_t col = 0u; col < cols; ++col)
+                if (inside_band(row, col))
+                    set(row, col, entries[row * cols + col]);
+    }
+    //!\}
+
+    //!\copydoc seqan3::detail::matrix_concept::rows
+    size_t rows() const noexcept
+    {
+        return _rows;
+    }
+
+    //!\copydoc seqan3::detail::matrix_concept::cols
+    size_t cols() const noexcept
+    {
+        return _cols;
+    }
+
+    //!\brief The number of diagonals covered by the band.
+    size_t band_size() const noexcept
+    {
+        return _band_size;
+    }
+
+    //!\brief Whether the cell (*row*, *col*) lies inside of the band.
+    bool inside_band(size_t const row, size_t const col) const noexcept
+    {
+        std::int64_t const diagonal = static_cast<std::int64_t>(col) - static_cast<std::int64_t>(row);
+        return _lower_diagonal <= diagonal && diagonal <= _upper_diagonal;
+    }
+
+    /*!\copydoc seqan3::detail::matrix_concept::at
+     *
+     * \details
+     *
+     * Cells outside of the band read as seqan3::detail::trace_directions::none.
+     */
+    entry_type at(size_t const row, size_t const col) const noexcept
+    {
+        assert(row < rows() && col < cols());
+
+        if (!inside_band(row, col))
+            return entry_type::none;
+
+        return _entries[band_position(row, col)];
+    }
+
+    /*!\brief Sets the trace directions of the cell (*row*, *col*), which must lie inside of the band.
+     * \param row The row of the cell.
+     * \param col The column of the cell.
+     * \param dir The trace directions to store.
+     */
+    void set(size_t const row, size_t const col, entry_type const dir) noexcept
+    {
+        assert(row < rows() && col < cols());
+        assert(inside_band(row, col));
+
+        _entries[band_position(row, col)] = dir;
+    }
+
+private:
+    //!\brief Translates the matrix coordinate (*row*, *col*) into its band-local position.
+    size_t band_position(size_t const row, size_t const col) const noexcept
+    {
+        // Shearing the band diagonally turns the cell's diagonal into its row within the column.
+        return col * _band_size + static_cast<size_t>(static_cast<std::int64_t>(row) - col + _upper_diagonal);
+    }
+
+    //!\copydoc seqan3::detail::matrix_concept::rows
+    size_t _rows{};
+    //!\copydoc seqan3::detail::matrix_concept::cols
+    size_t _cols{};
+    //!\brief The lower diagonal of the band.
+    std::int32_t _lower_diagonal{};
+    //!\brief The upper diagonal of the band.
+    std::int32_t _upper_diagonal{};
+    //!\copydoc seqan3::detail::banded_trace_matrix::band_size
+    size_t _band_size{1u};
+    //!\brief The sheared band (each column is continuously stored).
+    std::vector<entry_type> _entries{};
+};
+
+} // namespace seqan3::detail
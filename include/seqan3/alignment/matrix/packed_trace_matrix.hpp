@@ -0,0 +1,171 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Contains seqan3::detail::packed_trace_matrix.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <cassert>
+#include <vector>
+
+#include <seqan3/alignment/matrix/matrix_concept.hpp>
+#include <seqan3/alignment/matrix/trace_directions.hpp>
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A trace matrix storing the trace directions bit-packed with four bits per cell.
+ * \ingroup alignment_matrix
+ * \implements seqan3::detail::matrix_concept
+ *
+ * \details
+ *
+ * Storing one byte per cell quadruples the memory traffic of the traceback phase compared to the
+ * information that is actually needed to recover an optimal alignment. This matrix packs 16 cells
+ * into one 64 bit word, cutting the memory footprint and bandwidth of the trace matrix by a factor
+ * of two. The cells are stored row-wise like in seqan3::detail::row_wise_matrix.
+ *
+ * The packed representation keeps the seqan3::detail::trace_directions::diagonal,
+ * seqan3::detail::trace_directions::up and seqan3::detail::trace_directions::left bits and folds
+ * the gap-open variants onto their extension counterparts
+ * (seqan3::detail::trace_directions::up_open becomes seqan3::detail::trace_directions::up and
+ * seqan3::detail::trace_directions::left_open becomes seqan3::detail::trace_directions::left).
+ * This is sufficient for the trace walks implemented in
+ * seqan3::detail::alignment_front_coordinate and seqan3::detail::alignment_trace, which follow
+ * one direction per cell and do not inspect the gap-open markers. Affine tracebacks that need to
+ * distinguish opening from extending a gap must keep the byte-wide representation.
+ *
+ * Cells are appended word-wise through push_back: the directions are accumulated in a register
+ * and only written to memory once a word is complete (or the matrix is full), so filling the
+ * matrix issues one store per 16 cells instead of one store per cell.
+ */
+class packed_trace_matrix
+{
+public:
+    //!\copydoc seqan3::detail::matrix_concept::entry_type
+    using entry_type = trace_directions;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    packed_trace_matrix() = default;                                        //!< Defaulted
+    packed_trace_matrix(packed_trace_matrix const &) = default;             //!< Defaulted
+    packed_trace_matrix(packed_trace_matrix &&) = default;                  //!< Defaulted
+    packed_trace_matrix & operator=(packed_trace_matrix const &) = default; //!< Defaulted
+    packed_trace_matrix & operator=(packed_trace_matrix &&) = default;      //!< Defaulted
+    ~packed_trace_matrix() = default;                                       //!< Defaulted
+
+    /*!\brief Construct an empty matrix with the given dimensions; fill it with push_back.
+     * \param rows The number of rows.
+     * \param cols The number of columns.
+     */
+    packed_trace_matrix(size_t const rows, size_t const cols)
+        : _entries((rows * cols + entries_per_word - 1) / entries_per_word, 0u), _rows{rows}, _cols{cols}
+    {}
+
+    /*!\brief Construct the matrix by packing the *entries* word-wise.
+     * \param entries The entry values as a flat std::vector of seqan3::detail::trace_directions.
+     * \param rows    The number of rows.
+     * \param cols    The number of columns.
+     */
+    packed_trace_matrix(std::vector<trace_directions> const & entries, size_t const rows, size_t const cols)
+        : packed_trace_matrix{rows, cols}
+    {
+        assert(entries.size() == rows * cols);
+
+        for (trace_directions const dir : entries)
+            push_back(dir);
+    }
+    //!\}
+
+    //!\copydoc seqan3::detail::matrix_concept::rows
+    size_t rows() const noexcept
+    {
+        return _rows;
+    }
+
+    //!\copydoc seqan3::detail::matrix_concept::cols
+    size_t cols() const noexcept
+    {
+        return _cols;
+    }
+
+    //!\copydoc seqan3::detail::matrix_concept::at
+    entry_type at(size_t const row, size_t const col) const noexcept
+    {
+        assert(row < rows() && col < cols());
+
+        size_t const position = row * cols() + col;
+        word_type const word = _entries[position / entries_per_word];
+        return static_cast<entry_type>((word >> ((position % entries_per_word) * bits_per_entry)) & entry_mask);
+    }
+
+    /*!\brief Appends the next cell in row-wise order.
+     * \param dir The trace directions of the appended cell.
+     *
+     * \details
+     *
+     * The direction bits are accumulated in a cached word which is only stored to memory once it
+     * holds 16 cells or the matrix is complete. Cells of incomplete words other than the last one
+     * must not be read through at before the word was flushed.
+     */
+    void push_back(entry_type const dir) noexcept
+    {
+        assert(_write_position < rows() * cols());
+
+        size_t const offset = _write_position % entries_per_word;
+        _cached_word |= pack(dir) << (offset * bits_per_entry);
+        ++_write_position;
+
+        if (offset == entries_per_word - 1 || _write_position == rows() * cols())
+        {
+            _entries[(_write_position - 1) / entries_per_word] = _cached_word;
+            _cached_word = 0u;
+        }
+    }
+
+private:
+    //!\brief The word type used to store the packed cells.
+    using word_type = uint64_t;
+
+    //!\brief The number of bits per cell (the fourth bit is unused padding to keep the cells word-aligned).
+    static constexpr size_t bits_per_entry = 4;
+    //!\brief The number of cells stored in one word.
+    static constexpr size_t entries_per_word = (sizeof(word_type) * 8) / bits_per_entry;
+    //!\brief Masks the bits of a single cell.
+    static constexpr word_type entry_mask = (word_type{1} << bits_per_entry) - 1;
+    //!\brief Masks the direction bits actually stored (diagonal, up and left).
+    static constexpr word_type direction_mask = static_cast<word_type>(entry_type::diagonal) |
+                                                static_cast<word_type>(entry_type::up) |
+                                                static_cast<word_type>(entry_type::left);
+
+    //!\brief Converts the directions to their packed representation, folding the gap-open variants.
+    static constexpr word_type pack(entry_type const dir) noexcept
+    {
+        word_type bits = static_cast<word_type>(dir);
+        bits |= (bits >> 2) & static_cast<word_type>(entry_type::up);    // up_open   -> up
+        bits |= (bits >> 2) & static_cast<word_type>(entry_type::left);  // left_open -> left
+        return bits & direction_mask;
+    }
+
+    //!\brief The packed matrix (each row is continuously stored).
+    std::vector<word_type> _entries{};
+    //!\copydoc seqan3::detail::matrix_concept::rows
+    size_t _rows{};
+    //!\copydoc seqan3::detail::matrix_concept::cols
+    size_t _cols{};
+    //!\brief The word accumulating the cells until it is stored to the matrix.
+    word_type _cached_word{};
+    //!\brief The position of the next cell appended by push_back.
+    size_t _write_position{};
+};
+
+} // namespace seqan3::detail
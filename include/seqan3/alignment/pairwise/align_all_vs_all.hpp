@@ -0,0 +1,223 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_all_vs_all and seqan3::triangular_score_matrix.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alignment/pairwise/alignment_configurator.hpp>
+#include <seqan3/core/metafunction/basic.hpp>
+#include <seqan3/core/metafunction/pre.hpp>
+#include <seqan3/range/view/pairwise_combine.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3
+{
+
+/*!\brief A packed score matrix over all unordered pairs of a sequence set.
+ * \ingroup pairwise_alignment
+ * \tparam score_t The type of the stored scores.
+ *
+ * \details
+ *
+ * Stores one score per unordered pair `(i, j)` with `i != j` of a set of `dimension()` sequences, i.e. the
+ * strict upper triangle of the symmetric all-vs-all matrix, packed row-wise into one contiguous allocation of
+ * `dimension() * (dimension() - 1) / 2` elements. The accessor is symmetric: `at(i, j)` and `at(j, i)` refer
+ * to the same element; the diagonal is not stored.
+ */
+template <typename score_t>
+class triangular_score_matrix
+{
+public:
+    //!\brief The type of the stored scores.
+    using value_type = score_t;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    triangular_score_matrix()                                            = default; //!< Defaulted
+    triangular_score_matrix(triangular_score_matrix const &)             = default; //!< Defaulted
+    triangular_score_matrix(triangular_score_matrix &&)                  = default; //!< Defaulted
+    triangular_score_matrix & operator=(triangular_score_matrix const &) = default; //!< Defaulted
+    triangular_score_matrix & operator=(triangular_score_matrix &&)      = default; //!< Defaulted
+    ~triangular_score_matrix()                                           = default; //!< Defaulted
+
+    /*!\brief Constructs a value-initialised matrix over the given number of sequences.
+     * \param[in] dimension The number of sequences, i.e. the extent of both matrix dimensions.
+     */
+    explicit triangular_score_matrix(size_t const dimension) :
+        dim{dimension},
+        scores(dimension < 2u ? 0u : dimension * (dimension - 1u) / 2u)
+    {}
+    //!\}
+
+    //!\brief Returns the number of sequences the matrix spans.
+    size_t dimension() const noexcept
+    {
+        return dim;
+    }
+
+    //!\brief Returns the number of stored scores, i.e. `dimension() * (dimension() - 1) / 2`.
+    size_t size() const noexcept
+    {
+        return scores.size();
+    }
+
+    /*!\brief Returns a reference to the score of the given pair.
+     * \param[in] first  The index of one sequence of the pair; must be smaller than dimension().
+     * \param[in] second The index of the other sequence of the pair; must be smaller than dimension() and
+     *                   must differ from `first`.
+     */
+    score_t & at(size_t first, size_t second) noexcept
+    {
+        assert(first != second);
+        assert(first < dim && second < dim);
+
+        if (second < first)
+            std::swap(first, second);
+
+        return scores[first * (2u * dim - first - 1u) / 2u + second - first - 1u];
+    }
+
+    //!\copydoc at()
+    score_t const & at(size_t first, size_t second) const noexcept
+    {
+        assert(first != second);
+        assert(first < dim && second < dim);
+
+        if (second < first)
+            std::swap(first, second);
+
+        return scores[first * (2u * dim - first - 1u) / 2u + second - first - 1u];
+    }
+
+private:
+    //!\brief The number of sequences.
+    size_t dim{};
+    //!\brief The packed upper triangle in row-wise order.
+    std::vector<score_t> scores{};
+};
+
+/*!\brief Computes the all-vs-all pairwise alignment scores of a sequence set into a packed triangular matrix.
+ * \ingroup pairwise_alignment
+ * \tparam    database_t   The type of the sequence set; must model std::ranges::RandomAccessRange and
+ *                         std::ranges::SizedRange.
+ * \tparam    config_t     The alignment configuration type; must be a specialisation of seqan3::configuration.
+ * \param[in] database     The sequences to align all-vs-all.
+ * \param[in] config       The configuration, as accepted by seqan3::align_pairwise.
+ * \param[in] thread_count The number of worker threads; defaults to all hardware threads.
+ * \returns A seqan3::triangular_score_matrix with the score of every unordered sequence pair.
+ *
+ * \details
+ *
+ * Piping seqan3::view::pairwise_combine into seqan3::align_pairwise produces one result object per pair, which
+ * dominates the runtime for short sequences. This engine fuses the three stages instead: the triangular pair
+ * space is decomposed into square tiles (the tiled access of seqan3::view::pairwise_combine), the tiles are
+ * scheduled dynamically over the worker threads, and every worker streams the pairs of its tiles through its
+ * own alignment kernel — whose DP buffers are thereby reused across all pairs — writing each score directly
+ * into the packed result matrix.
+ *
+ * Only the score is extracted from the configured algorithm, so requesting more than
+ * `align_cfg::result{seqan3::with_score}` merely wastes work.
+ *
+ * ### Complexity
+ *
+ * The product of the number of pairs and the complexity of the configured algorithm, distributed over the
+ * given number of threads.
+ *
+ * ### Exceptions
+ *
+ * Strong exception guarantee. Throws std::bad_alloc or whatever the configured algorithm throws.
+ *
+ * ### Thread-safety
+ *
+ * The database and the configuration are only read; every score is written by exactly one worker.
+ */
+template <std::ranges::RandomAccessRange database_t, typename config_t>
+//!\cond
+    requires std::ranges::SizedRange<database_t> &&
+             detail::is_type_specialisation_of_v<config_t, configuration>
+//!\endcond
+auto align_all_vs_all(database_t && database,
+                      config_t const & config,
+                      size_t const thread_count = std::thread::hardware_concurrency())
+{
+    using sequence_t = value_type_t<std::remove_reference_t<database_t>>;
+    using alignment_input_t = std::vector<std::tuple<sequence_t, sequence_t>>;
+
+    auto kernel = detail::alignment_configurator::configure<alignment_input_t>(config);
+    using kernel_t = decltype(kernel);
+    using result_t = std::invoke_result_t<kernel_t &, sequence_t &, sequence_t &>;
+    using score_t = remove_cvref_t<decltype(std::declval<result_t>().score())>;
+
+    size_t const sequence_count = std::ranges::size(database);
+    triangular_score_matrix<score_t> matrix{sequence_count};
+
+    if (sequence_count < 2u)
+        return matrix;
+
+    // The unit of scheduling (and of cache reuse) is one square tile of the triangular pair space.
+    detail::pairwise_combine_view combinations{std::ranges::view::all(database)};
+    constexpr size_t tile_extent = 64u;
+    size_t const tiles = combinations.tile_count(tile_extent);
+
+    std::atomic<size_t> next_tile{0u};
+
+    auto work = [&] (kernel_t & worker_kernel)
+    {
+        auto data_it = std::ranges::begin(database);
+
+        for (size_t tile_index = next_tile.fetch_add(1u, std::memory_order_relaxed);
+             tile_index < tiles;
+             tile_index = next_tile.fetch_add(1u, std::memory_order_relaxed))
+        {
+            combinations.tile(tile_index, tile_extent).for_each([&] (size_t const first, size_t const second)
+            {
+                matrix.at(first, second) = worker_kernel(data_it[first], data_it[second]).score();
+            });
+        }
+    };
+
+    size_t const workers = std::max<size_t>(std::min(thread_count, tiles), 1u);
+
+    if (workers == 1u)
+    {
+        work(kernel);
+    }
+    else
+    {
+        std::vector<std::thread> threads{};
+        threads.reserve(workers);
+
+        for (size_t i = 0; i < workers; ++i)
+        {
+            threads.emplace_back([&] ()
+            {
+                // One kernel per worker: the kernels keep their DP buffers as members, so each worker reuses
+                // its own buffers across all pairs of its tiles instead of allocating per pair.
+                kernel_t worker_kernel = detail::alignment_configurator::configure<alignment_input_t>(config);
+                work(worker_kernel);
+            });
+        }
+
+        for (std::thread & thread : threads)
+            thread.join();
+    }
+
+    return matrix;
+}
+
+} // namespace seqan3
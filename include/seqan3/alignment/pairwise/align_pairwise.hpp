@@ -12,16 +12,25 @@
 
 #pragma once
 
+#include <algorithm>
+#include <condition_variable>
+#include <execution>
 #include <functional>
 #include <iostream>
+#include <iterator>
+#include <mutex>
+#include <thread>
 #include <tuple>
 #include <type_traits>
+#include <vector>
 
 #include <meta/meta.hpp>
 
 #include <seqan3/alignment/configuration/all.hpp>
 #include <seqan3/alignment/pairwise/alignment_result.hpp>
 #include <seqan3/alignment/pairwise/alignment_configurator.hpp>
+#include <seqan3/alignment/pairwise/antidiagonal_alignment_algorithm.hpp>
+#include <seqan3/alignment/pairwise/simd_alignment_algorithm.hpp>
 #include <seqan3/alignment/pairwise/execution/all.hpp>
 
 #include <seqan3/alphabet/gap/gapped.hpp>
@@ -134,7 +143,27 @@ constexpr auto align_pairwise(sequence_t && seq, alignment_config_t const & conf
                   std::ranges::ViewableRange<std::tuple_element_t<1, std::remove_reference_t<sequence_t>>>,
                   "Alignment configuration error: The tuple elements must model std::ranges::ViewableRange.");
 
-    return align_pairwise(std::view::single(std::forward<sequence_t>(seq)), config);
+    using config_t = remove_cvref_t<alignment_config_t>;
+
+    if constexpr (config_t::template exists<align_cfg::vectorise>())
+    {
+        // A single sequence pair cannot be vectorised over multiple independent alignments. Instead, the
+        // cells of one anti-diagonal of the single alignment matrix are computed with simd instructions.
+        if constexpr (!config_t::template exists<align_cfg::result>())
+        {
+            return align_pairwise(std::forward<sequence_t>(seq), config | align_cfg::result{with_score});
+        }
+        else
+        {
+            using std::get;
+            detail::antidiagonal_alignment_algorithm<config_t> algorithm{config};
+            return std::vector{algorithm(get<0>(seq), get<1>(seq))};
+        }
+    }
+    else
+    {
+        return align_pairwise(std::view::single(std::forward<sequence_t>(seq)), config);
+    }
 }
 
 //!\cond
@@ -143,15 +172,321 @@ template <typename sequence_t, typename alignment_config_t>
              detail::is_type_specialisation_of_v<alignment_config_t, configuration>
 constexpr auto align_pairwise(sequence_t && seq, alignment_config_t const & config)
 {
-    // Pipe with view::persist to allow rvalue non-view ranges.
-    auto seq_view = std::forward<sequence_t>(seq) | view::persist;
-    // Configure the alignment algorithm.
-    auto kernel = detail::alignment_configurator::configure<decltype(seq_view)>(config);
-    // Create a two-way executor for the alignment.
-    detail::alignment_executor_two_way exec{std::move(seq_view), kernel};
-    // Return the range over the alignments.
-    return alignment_range{std::move(exec)};
+    using config_t = remove_cvref_t<alignment_config_t>;
+
+    if constexpr (config_t::template exists<align_cfg::vectorise>())
+    {
+        // The vectorised alignment packs one cell of multiple sequence pairs into each simd lane and therefore
+        // computes the results eagerly in batches of simd length many alignments.
+        if constexpr (!config_t::template exists<align_cfg::result>())
+        {
+            return align_pairwise(std::forward<sequence_t>(seq), config | align_cfg::result{with_score});
+        }
+        else
+        {
+            auto seq_view = std::forward<sequence_t>(seq) | view::persist;
+
+            constexpr bool uses_shared_pool = config_t::template exists<align_cfg::execution_context>();
+            if constexpr (config_t::template exists<align_cfg::parallel>() || uses_shared_pool)
+            {
+                // Slice the input into contiguous runs of sequence pairs and compute the slices concurrently.
+                // Every slice numbers its results with the offset of its first pair, such that concatenating the
+                // slice results in order restores the ids of the sequential computation.
+                auto resolve_pool = [&] () -> thread_pool &
+                {
+                    if constexpr (uses_shared_pool)
+                    {
+                        thread_pool * pool = get<align_cfg::execution_context>(config).value;
+                        return (pool != nullptr) ? *pool : thread_pool::shared();
+                    }
+                    else
+                    {
+                        return thread_pool::shared(); // never taken; keeps the lambda well-formed
+                    }
+                };
+
+                size_t const total = static_cast<size_t>(std::ranges::distance(seq_view));
+                size_t thread_count{};
+                if constexpr (uses_shared_pool)
+                    thread_count = resolve_pool().thread_count();
+                else
+                    thread_count = std::max<uint32_t>(1u, get<align_cfg::parallel>(config).value);
+                size_t const slice_size = (total + thread_count - 1) / thread_count;
+
+                using slice_t = std::ranges::subrange<std::ranges::iterator_t<decltype(seq_view)>>;
+                std::vector<slice_t> slices{};
+
+                auto slice_begin = std::ranges::begin(seq_view);
+                auto const seq_sentinel = std::ranges::end(seq_view);
+                while (slice_begin != seq_sentinel)
+                {
+                    auto slice_end = std::ranges::next(slice_begin, slice_size, seq_sentinel);
+                    slices.emplace_back(slice_begin, slice_end);
+                    slice_begin = slice_end;
+                }
+
+                using result_vector_t = decltype(detail::simd_alignment_algorithm<config_t>{config}(slices[0]));
+                std::vector<result_vector_t> slice_results(slices.size());
+
+                if constexpr (uses_shared_pool)
+                {
+                    // Submit one task per slice to the shared pool and wait until all of them have finished.
+                    thread_pool & pool = resolve_pool();
+                    std::mutex mutex{};
+                    std::condition_variable slices_done{};
+                    size_t remaining{slices.size()};
+
+                    uint32_t first_id = 0;
+                    for (size_t index = 0; index < slices.size(); ++index)
+                    {
+                        pool.submit([&, index, first_id] ()
+                        {
+                            detail::simd_alignment_algorithm<config_t> algorithm{config};
+                            slice_results[index] = algorithm(slices[index], first_id);
+
+                            std::unique_lock<std::mutex> lock{mutex};
+                            if (--remaining == 0)
+                                slices_done.notify_all();
+                        });
+                        first_id += static_cast<uint32_t>(std::ranges::distance(slices[index]));
+                    }
+
+                    std::unique_lock<std::mutex> lock{mutex};
+                    slices_done.wait(lock, [&] { return remaining == 0; });
+                }
+                else
+                {
+                    std::vector<std::thread> threads{};
+                    threads.reserve(slices.size());
+
+                    uint32_t first_id = 0;
+                    for (size_t index = 0; index < slices.size(); ++index)
+                    {
+                        threads.emplace_back([&, index, first_id] ()
+                        {
+                            detail::simd_alignment_algorithm<config_t> algorithm{config};
+                            slice_results[index] = algorithm(slices[index], first_id);
+                        });
+                        first_id += static_cast<uint32_t>(std::ranges::distance(slices[index]));
+                    }
+
+                    for (std::thread & thread : threads)
+                        thread.join();
+                }
+
+                result_vector_t results{};
+                results.reserve(total);
+                for (result_vector_t & slice_result : slice_results)
+                    std::move(slice_result.begin(), slice_result.end(), std::back_inserter(results));
+
+                return results;
+            }
+            else
+            {
+                detail::simd_alignment_algorithm<config_t> algorithm{config};
+                return algorithm(seq_view);
+            }
+        }
+    }
+    else
+    {
+        // Pipe with view::persist to allow rvalue non-view ranges.
+        auto seq_view = std::forward<sequence_t>(seq) | view::persist;
+        // Configure the alignment algorithm.
+        auto kernel = detail::alignment_configurator::configure<decltype(seq_view)>(config);
+
+        // The number of pairs computed per chunk of the executor; `0` selects the automatic sizing.
+        size_t const chunk_size = config.template value_or<align_cfg::chunk_size>(uint32_t{0});
+
+        if constexpr (config_t::template exists<align_cfg::execution_context>())
+        {
+            // Compute the alignments concurrently on the shared pool instead of spawning a dedicated set of
+            // worker threads for this call (see seqan3::align_cfg::execution_context).
+            thread_pool * pool = get<align_cfg::execution_context>(config).value;
+            using executor_t = detail::alignment_executor_two_way<decltype(seq_view),
+                                                                  decltype(kernel),
+                                                                  detail::execution_handler_shared_pool>;
+            executor_t exec{std::move(seq_view),
+                            kernel,
+                            detail::execution_handler_shared_pool{(pool != nullptr) ? *pool : thread_pool::shared()},
+                            chunk_size};
+            // Return the range over the alignments.
+            return alignment_range{std::move(exec)};
+        }
+        else if constexpr (config_t::template exists<align_cfg::parallel>())
+        {
+            // Create a two-way executor that computes the alignments concurrently with the given thread count.
+            // The work-stealing handler keeps all threads busy for batches mixing short and long sequence pairs.
+            using executor_t = detail::alignment_executor_two_way<decltype(seq_view),
+                                                                  decltype(kernel),
+                                                                  detail::execution_handler_work_stealing>;
+            executor_t exec{std::move(seq_view),
+                            kernel,
+                            detail::execution_handler_work_stealing{get<align_cfg::parallel>(config).value},
+                            chunk_size};
+            // Return the range over the alignments.
+            return alignment_range{std::move(exec)};
+        }
+        else
+        {
+            // Create a two-way executor for the alignment.
+            detail::alignment_executor_two_way exec{std::move(seq_view),
+                                                    kernel,
+                                                    detail::execution_handler_sequential{},
+                                                    chunk_size};
+            // Return the range over the alignments.
+            return alignment_range{std::move(exec)};
+        }
+    }
 }
 //!\endcond
 
+/*!\brief Computes pairwise alignments over a range of sequence pairs and reports every result through a callback.
+ * \ingroup pairwise_alignment
+ *
+ * \tparam sequence_t         The type of the range over the sequence pairs; the value type must model
+ *                            seqan3::detail::AlignPairwiseValue.
+ * \tparam alignment_config_t The type of the alignment configuration; must be a seqan3::configuration.
+ * \tparam callback_t         The type of the result callback; must be invocable with a seqan3::alignment_result.
+ * \param[in] seq             An input range over sequence pairs.
+ * \param[in] config          The object storing the alignment configuration.
+ * \param[in] callback        The callable invoked with every seqan3::alignment_result.
+ *
+ * \details
+ *
+ * In contrast to the range interface the results are not funnelled through the single-consumer
+ * seqan3::alignment_range but reported through the callback as soon as they have been computed. If the
+ * seqan3::align_cfg::parallel or seqan3::align_cfg::execution_context configuration is set, the callback is
+ * invoked directly from the worker threads and
+ * the results are reported unordered, i.e. in the order in which the alignments finish. The callback must
+ * therefore be safe to invoke concurrently. Without the parallel configuration the callback is invoked from the
+ * calling thread in the order of the input range.
+ *
+ * This function blocks until all alignments have been computed and reported.
+ *
+ * ### Exception
+ *
+ * Basic exception guarantee.
+ *
+ * Might throw std::bad_alloc if it fails to allocate the alignment matrix or
+ * seqan3::invalid_alignment_configuration if the configuration is invalid.
+ */
+template <typename sequence_t, typename alignment_config_t, typename callback_t>
+//!\cond
+    requires detail::AlignPairwiseRangeInputConcept<sequence_t> &&
+             detail::is_type_specialisation_of_v<alignment_config_t, configuration>
+//!\endcond
+void align_pairwise(sequence_t && seq, alignment_config_t const & config, callback_t callback)
+{
+    using config_t = remove_cvref_t<alignment_config_t>;
+
+    if constexpr (config_t::template exists<align_cfg::vectorise>())
+    {
+        // The vectorised alignment computes its results eagerly in batches; report them from the calling thread.
+        for (auto && result : align_pairwise(std::forward<sequence_t>(seq), config))
+            callback(std::move(result));
+    }
+    else
+    {
+        // Pipe with view::persist to allow rvalue non-view ranges.
+        auto seq_view = std::forward<sequence_t>(seq) | view::persist;
+        // Configure the alignment algorithm.
+        auto kernel = detail::alignment_configurator::configure<decltype(seq_view)>(config);
+
+        // Submit all alignment instances to the handler; the delegate reports the results directly to the
+        // callback without the result buffer of the two-way executor.
+        auto submit_all = [&](auto && exec_handler)
+        {
+            for (auto && [first_seq, second_seq] : seq_view)
+                exec_handler.execute(kernel, first_seq, second_seq, callback);
+
+            exec_handler.wait();
+        };
+
+        if constexpr (config_t::template exists<align_cfg::execution_context>())
+        {
+            thread_pool * pool = get<align_cfg::execution_context>(config).value;
+            submit_all(detail::execution_handler_shared_pool{(pool != nullptr) ? *pool : thread_pool::shared()});
+        }
+        else if constexpr (config_t::template exists<align_cfg::parallel>())
+        {
+            submit_all(detail::execution_handler_work_stealing{get<align_cfg::parallel>(config).value});
+        }
+        else
+        {
+            submit_all(detail::execution_handler_sequential{});
+        }
+    }
+}
+
+/*!\brief Computes pairwise alignments with the execution mapped from a standard execution policy.
+ * \ingroup pairwise_alignment
+ *
+ * \tparam execution_policy_t The type of the execution policy; must satisfy std::is_execution_policy.
+ * \tparam sequence_t         The type of the sequence pairs (see the config-only overloads).
+ * \tparam alignment_config_t The type of the alignment configuration; must be a seqan3::configuration.
+ * \param[in] seq             A tuple with two sequences or an input range over such tuples.
+ * \param[in] config          The object storing the alignment configuration.
+ * \return A seqan3::alignment_range or an eagerly computed std::vector of results (see the config-only overloads).
+ *
+ * \details
+ *
+ * This overload translates the passed execution policy into the respective configuration elements and delegates
+ * to the config-only interface:
+ *
+ * * std::execution::seq computes the alignments sequentially in the calling thread.
+ * * std::execution::par augments the configuration with seqan3::align_cfg::parallel using
+ *   std::thread::hardware_concurrency many threads.
+ * * std::execution::par_unseq additionally augments the configuration with seqan3::align_cfg::vectorise, i.e. the
+ *   alignments are computed concurrently and every thread processes its share with simd instructions.
+ *
+ * If the configuration already contains a seqan3::align_cfg::parallel element its thread count takes precedence
+ * over the policy mapping. Combining std::execution::seq with seqan3::align_cfg::parallel is a configuration error.
+ */
+template <typename execution_policy_t, typename sequence_t, typename alignment_config_t>
+//!\cond
+    requires std::is_execution_policy_v<remove_cvref_t<execution_policy_t>> &&
+             detail::is_type_specialisation_of_v<alignment_config_t, configuration>
+//!\endcond
+constexpr auto align_pairwise(execution_policy_t const &, sequence_t && seq, alignment_config_t const & config)
+{
+    using policy_t = remove_cvref_t<execution_policy_t>;
+    using config_t = remove_cvref_t<alignment_config_t>;
+
+    static_assert(std::Same<policy_t, std::execution::sequenced_policy> ||
+                  std::Same<policy_t, std::execution::parallel_policy> ||
+                  std::Same<policy_t, std::execution::parallel_unsequenced_policy>,
+                  "Alignment configuration error: The given execution policy is not supported.");
+
+    if constexpr (std::Same<policy_t, std::execution::sequenced_policy>)
+    {
+        static_assert(!config_t::template exists<align_cfg::parallel>(),
+                      "Alignment configuration error: The sequenced execution policy contradicts the "
+                      "seqan3::align_cfg::parallel configuration element.");
+        return align_pairwise(std::forward<sequence_t>(seq), config);
+    }
+    else
+    {
+        // Keep an explicitly configured thread count; otherwise use all available threads.
+        auto with_parallel = [] (auto const & cfg)
+        {
+            using cfg_t = remove_cvref_t<decltype(cfg)>;
+            if constexpr (cfg_t::template exists<align_cfg::parallel>())
+                return cfg;
+            else
+                return cfg | align_cfg::parallel{std::thread::hardware_concurrency()};
+        };
+
+        if constexpr (std::Same<policy_t, std::execution::parallel_unsequenced_policy> &&
+                      !config_t::template exists<align_cfg::vectorise>())
+        {
+            return align_pairwise(std::forward<sequence_t>(seq), with_parallel(config | align_cfg::vectorise{}));
+        }
+        else
+        {
+            return align_pairwise(std::forward<sequence_t>(seq), with_parallel(config));
+        }
+    }
+}
+
 } // namespace seqan3
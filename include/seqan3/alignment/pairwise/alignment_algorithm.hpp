@@ -22,10 +22,13 @@
 #include <seqan3/alignment/pairwise/policy/affine_gap_policy.hpp>
 #include <seqan3/alignment/pairwise/policy/unbanded_score_dp_matrix_policy.hpp>
 #include <seqan3/alignment/pairwise/align_result_selector.hpp>
+#include <seqan3/alignment/pairwise/alignment_parameter_block.hpp>
 #include <seqan3/alignment/scoring/gap_scheme.hpp>
 #include <seqan3/alignment/scoring/scoring_scheme_base.hpp>
 
+#include <seqan3/core/metafunction/basic.hpp>
 #include <seqan3/core/metafunction/deferred_crtp_base.hpp>
+#include <seqan3/core/tracing.hpp>
 #include <seqan3/io/stream/debug_stream.hpp>
 #include <seqan3/range/view/get.hpp>
 #include <seqan3/range/view/take_exactly.hpp>
@@ -94,9 +97,11 @@ public:
      *
      * \details
      *
-     * Maintains a copy of the configuration object on the heap using a std::shared_ptr.
+     * Resolves all configuration values the kernel reads once into a flattened
+     * seqan3::detail::alignment_parameter_block stored by value, such that the per-pair computation
+     * never traverses the configuration tuple.
      */
-    explicit constexpr alignment_algorithm(config_t const & cfg) : cfg_ptr{new config_t(cfg)}
+    explicit constexpr alignment_algorithm(config_t const & cfg) : params{make_alignment_parameter_block(cfg)}
     {}
     //!\}
 
@@ -130,7 +135,14 @@ public:
     auto operator()(first_range_t && first_range, second_range_t && second_range)
         requires !is_banded
     {
-        assert(cfg_ptr != nullptr);
+        SEQAN3_TRACE_SCOPE("align::dp_kernel");
+
+        // Reset the state of the x-drop termination for the next invocation.
+        if constexpr (config_t::template exists<align_cfg::x_drop>())
+        {
+            running_optimum = {};
+            is_filtered = false;
+        }
 
         // ----------------------------------------------------------------------------
         // Initialise dp algorithm.
@@ -140,16 +152,46 @@ public:
         this->allocate_matrix(first_range, second_range);
 
         // Initialise cache variables to keep frequently used variables close to the CPU registers.
-        auto cache = this->make_cache(cfg_ptr->template value_or<align_cfg::gap>(gap_scheme{gap_score{-1},
-                                                                                            gap_open_score{-10}}));
-
-        initialise_matrix(cache);
+        auto cache = this->make_cache(params.gap);
 
         // ----------------------------------------------------------------------------
         // Compute the unbanded alignment.
         // ----------------------------------------------------------------------------
 
-        compute_matrix(first_range, second_range, cache);
+        if constexpr (config_t::template exists<align_cfg::tile>())
+        {  // Process the matrix in cache-sized row blocks including the initialisation.
+            compute_matrix_blocked(first_range, second_range, cache);
+        }
+        else
+        {
+            // For one-vs-many batches the initialisation column only depends on the number of rows and the gap
+            // scheme, hence it is cached by the matrix policy and restored for subsequent pairs instead of being
+            // recomputed. Configurations computing the traceback also fill the first column of the trace matrix
+            // during the initialisation and are therefore excluded from the reuse.
+            if constexpr (!config_t::template exists<align_cfg::result<with_alignment_type>>() &&
+                          !config_t::template exists<align_cfg::result<with_front_coordinate_type>>())
+            {
+                if (this->init_column_is_cached())
+                {
+                    restore_initialisation_column(cache);
+                }
+                else
+                {
+                    initialise_matrix(cache);
+                    this->snapshot_init_column();
+                    this->init_column_state = get<0>(cache);
+                }
+            }
+            else
+            {
+                initialise_matrix(cache);
+            }
+
+            if constexpr (config_t::template exists<align_cfg::max_error>())
+                compute_matrix_pruned(first_range, second_range, cache);
+            else
+                compute_matrix(first_range, second_range, cache);
+        }
 
         // ----------------------------------------------------------------------------
         // Cleanup and prepare the alignment result.
@@ -182,9 +224,13 @@ public:
         {
             res.score = get<3>(cache).score;
             res.back_coordinate = get<3>(cache).coordinate;
-            std::tie(res.front_coordinate, res.alignment) = compute_traceback(first_range,
-                                                                              second_range,
-                                                                              get<3>(cache).coordinate);
+            // Defer the traceback until the alignment is accessed for the first time
+            // (see seqan3::alignment_result::alignment).
+            res.lazy_traceback = make_lazy_traceback(first_range, second_range, get<3>(cache).coordinate);
+        }
+        if constexpr (config_t::template exists<align_cfg::x_drop>())
+        {
+            res.filtered = is_filtered;
         }
         return alignment_result{res};
     }
@@ -198,7 +244,9 @@ public:
      * \details
      *
      * Computes the k-banded alignment. This function is only available if the alignment configuration was configured
-     * with seqan3::align_cfg::band. The algorithm always computes a pairwise alignment of two sequences over either a
+     * with seqan3::align_cfg::band. If seqan3::adaptive_band was configured, the alignment is recomputed with a
+     * doubled band as long as the optimum lies on one of the band boundaries (see seqan3::adaptive_band).
+     * The algorithm always computes a pairwise alignment of two sequences over either a
      * regular alphabet or packed alphabets in a SIMD vector. In the latter case an inter-vectorisation layout
      * is used to compute l many pairwise alignments in parallel using special extended register instructions.
      *
@@ -220,13 +268,73 @@ public:
     auto operator()(first_range_t && first_range, second_range_t && second_range)
         requires is_banded
     {
-        assert(cfg_ptr != nullptr);
+        SEQAN3_TRACE_SCOPE("align::dp_kernel_banded");
 
         using std::get;
 
         static_assert(config_t::template exists<align_cfg::band>(),
                       "The band configuration is required for the banded alignment algorithm.");
-        auto const & band = get<align_cfg::band>(*cfg_ptr).value;
+        auto const & band = params.band;
+
+        if constexpr (std::Same<remove_cvref_t<decltype(band)>, adaptive_band>)
+        {
+            using diff_type = typename std::iterator_traits<std::ranges::iterator_t<first_range_t>>::difference_type;
+
+            diff_type const dimension_first =
+                std::ranges::distance(std::ranges::begin(first_range), std::ranges::end(first_range));
+            diff_type const dimension_second =
+                std::ranges::distance(std::ranges::begin(second_range), std::ranges::end(second_range));
+
+            // The widest band that is accepted by the banded alignment.
+            int64_t const max_upper = std::min<int64_t>(dimension_first, dimension_second);
+            int64_t const min_lower = -max_upper;
+
+            static_band current_band{seqan3::lower_bound{std::max(band.lower_bound, min_lower)},
+                                     seqan3::upper_bound{std::min(band.upper_bound, max_upper)}};
+            while (true)
+            {
+                auto res = compute_banded_alignment(first_range, second_range, current_band);
+
+                // If the optimum lies strictly inside of the band, a wider band cannot improve it anymore.
+                if (!optimum_on_band_boundary ||
+                    (current_band.lower_bound == min_lower && current_band.upper_bound == max_upper))
+                {
+                    return res;
+                }
+
+                // The band might have clipped the true optimum; double the band width and recompute.
+                int64_t const growth = std::max<int64_t>((current_band.upper_bound - current_band.lower_bound + 1) / 2,
+                                                         1);
+                current_band.lower_bound = std::max(current_band.lower_bound - growth, min_lower);
+                current_band.upper_bound = std::min(current_band.upper_bound + growth, max_upper);
+            }
+        }
+        else
+        {
+            return compute_banded_alignment(first_range, second_range, band);
+        }
+    }
+
+private:
+
+    /*!\brief Computes the banded alignment for the given band.
+     * \tparam    first_range_t  The type of the first sequence (or packed sequences); must model std::ForwardRange.
+     * \tparam    second_range_t The type of the second sequence (or packed sequences); must model std::ForwardRange.
+     * \tparam    band_t         The type of the band.
+     * \param[in] first_range    The first sequence (or packed sequences).
+     * \param[in] second_range   The second sequence (or packed sequences).
+     * \param[in] band           The band restricting the alignment matrix.
+     *
+     * \details
+     *
+     * Computes one invocation of the k-banded alignment for the passed band. If seqan3::adaptive_band was
+     * configured, it additionally records whether the optimum lies on one of the band boundaries, such that the
+     * caller can recompute the alignment with a wider band.
+     */
+    template <std::ranges::ForwardRange first_range_t, std::ranges::ForwardRange second_range_t, typename band_t>
+    auto compute_banded_alignment(first_range_t && first_range, second_range_t && second_range, band_t const & band)
+    {
+        using std::get;
 
         // ----------------------------------------------------------------------------
         // Check valid band settings.
@@ -263,8 +371,7 @@ public:
 
         this->allocate_matrix(trimmed_first_range, trimmed_second_range, band);
 
-        // Use default gap if not set from outside.
-        auto const & gap = cfg_ptr->template value_or<align_cfg::gap>(gap_scheme{gap_score{-1}, gap_open_score{-10}});
+        auto const & gap = params.gap;
 
         // Initialise cache variables to keep frequently used variables close to the CPU registers.
         auto cache = this->make_cache(gap);
@@ -277,6 +384,10 @@ public:
 
         compute_banded_matrix(trimmed_first_range, trimmed_second_range, cache);
 
+        // Record whether the optimum touches the band boundary to decide if the band needs to be widened.
+        if constexpr (std::Same<remove_cvref_t<decltype(params.band)>, adaptive_band>)
+            optimum_on_band_boundary = this->optimum_touches_band_boundary(get<3>(cache).coordinate);
+
         // ----------------------------------------------------------------------------
         // Cleanup and optionally compute the traceback.
         // ----------------------------------------------------------------------------
@@ -324,7 +435,6 @@ public:
         }
         return alignment_result{res};
     }
-private:
 
     /*!\brief Initialises the first column of the dynamic programming matrix.
      * \tparam         cache_t The cache type.
@@ -343,17 +453,39 @@ private:
             this->init_column_cell(std::forward<decltype(cell)>(cell), cache);
         });
 
-        auto [cell, coordinate, trace] = *std::ranges::prev(std::ranges::end(col));
-        (void) trace;
-        if constexpr (is_banded)
+        if constexpr (alignment_algorithm::find_optimum_in_last_row)
         {
-            alignment_optimum current{get<0>(get<0>(std::move(cell))), static_cast<alignment_coordinate>(coordinate)};
-            this->check_score_last_row(current, get<3>(cache));
+            auto [cell, coordinate, trace] = *std::ranges::prev(std::ranges::end(col));
+            (void) trace;
+            if constexpr (is_banded)
+                this->check_score_last_row(get<0>(get<0>(std::move(cell))), coordinate, get<3>(cache));
+            else
+                this->check_score_last_row(get<0>(std::move(cell)), coordinate, get<3>(cache));
         }
-        else
+    }
+
+    /*!\brief Restores the cached initialisation column and replays its bookkeeping on the given cache.
+     * \tparam        cache_t The cache type.
+     * \param[in,out] cache   The cache holding hot variables.
+     *
+     * \details
+     *
+     * Restores the cell values of the first matrix column and the vertical state of the affine gap cache from
+     * the snapshot taken for the previous sequence pair and re-applies the optimum tracking of the column's
+     * last cell (see initialise_matrix).
+     */
+    template <typename cache_t>
+    void restore_initialisation_column(cache_t & cache)
+    {
+        this->restore_init_column();
+        get<0>(cache) = this->init_column_state;
+
+        if constexpr (alignment_algorithm::find_optimum_in_last_row)
         {
-            alignment_optimum current{get<0>(std::move(cell)), static_cast<alignment_coordinate>(coordinate)};
-            this->check_score_last_row(current, get<3>(cache));
+            auto col = this->current_column();
+            auto [cell, coordinate, trace] = *std::ranges::prev(std::ranges::end(col));
+            (void) trace;
+            this->check_score_last_row(get<0>(std::move(cell)), coordinate, get<3>(cache));
         }
     }
 
@@ -373,9 +505,13 @@ private:
                         cache_t & cache)
     {
         using std::get;
-        auto const & score_scheme = get<align_cfg::scoring>(*cfg_ptr).value;
-        ranges::for_each(first_range, [&, this](auto seq1_value)
+        auto const & score_scheme = params.scoring;
+        this->initialise_scoring_scheme(score_scheme);
+        // Use an explicit loop instead of ranges::for_each to be able to abort the computation early.
+        for (auto first_range_it = std::ranges::begin(first_range);
+             first_range_it != std::ranges::end(first_range); ++first_range_it)
         {
+            auto seq1_value = *first_range_it;
             // Move internal matrix to next column.
             this->go_next_column();
 
@@ -385,16 +521,23 @@ private:
             auto second_range_it = std::ranges::begin(second_range);
             ranges::for_each(col | ranges::view::drop_exactly(1), [&, this] (auto && cell)
             {
-                this->compute_cell(cell, cache, score_scheme.score(seq1_value, *second_range_it));
+                this->compute_cell(cell, cache, this->score(score_scheme, seq1_value, *second_range_it));
                 ++second_range_it;
             });
 
-            // Prepare last cell for tracking the optimum.
-            auto [cell, coordinate, trace] = *std::ranges::prev(std::ranges::end(col));
-            (void) trace;
-            alignment_optimum current{get<0>(std::move(cell)), static_cast<alignment_coordinate>(coordinate)};
-            this->check_score_last_row(current, get<3>(cache));
-        });
+            // Prepare last cell for tracking the optimum; elided at compile time for the disabled variants.
+            if constexpr (alignment_algorithm::find_optimum_in_last_row)
+            {
+                auto [cell, coordinate, trace] = *std::ranges::prev(std::ranges::end(col));
+                (void) trace;
+                this->check_score_last_row(get<0>(std::move(cell)), coordinate, get<3>(cache));
+            }
+
+            // Abort the computation if the column optimum dropped too far below the running optimum.
+            if constexpr (config_t::template exists<align_cfg::x_drop>())
+                if (abort_by_x_drop(cache))
+                    return;
+        }
 
         // Prepare the last column for tracking the optimum: Only get the current score cell and the coordinate.
         auto last_column_view = this->current_column() | std::view::transform([](auto && entry)
@@ -406,6 +549,266 @@ private:
         this->check_score_last_column(last_column_view, get<3>(cache));
     }
 
+    /*!\brief Computes the alignment restricted to the corridor of diagonals implied by the error budget.
+     * \tparam        first_range_t  The type of the first sequence.
+     * \tparam        second_range_t The type of the second sequence.
+     * \tparam        cache_t        The type of the cache.
+     * \param[in]     first_range    The first sequence.
+     * \param[in]     second_range   The second sequence.
+     * \param[in,out] cache          The cache holding hot variables.
+     *
+     * \details
+     *
+     * Every indel moves the alignment path one diagonal aside, hence a global alignment with at most
+     * seqan3::align_cfg::max_error many errors never leaves a corridor of diagonals around the main diagonal
+     * (see the derivation at the corridor computation below). Cells outside of the corridor provably cannot
+     * lie on an alignment within the budget and are skipped, which reduces the computed area from the full
+     * matrix to a corridor whose width is bounded by the error budget.
+     *
+     * Skipping must not let values of older columns leak into the recursion: the diagonal score of the first
+     * corridor row is seeded from the cell above the corridor, which the previous column computed as its first
+     * corridor row, the vertical path into the corridor is blocked, and the stored horizontal score of a row
+     * that newly enters the corridor at the bottom is invalidated before the row is computed. The reported
+     * score is exact whenever the optimal alignment stays within the budget and otherwise the best score of
+     * any alignment inside of the corridor.
+     */
+    template <typename first_range_t,
+              typename second_range_t,
+              typename cache_t>
+    void compute_matrix_pruned(first_range_t & first_range,
+                               second_range_t & second_range,
+                               cache_t & cache)
+        requires !is_banded
+    {
+        using std::get;
+        using score_t = std::tuple_element_t<0, std::tuple_element_t<0, cache_t>>;
+
+        // Cells outside of the corridor act as minus infinity; halved such that adding gap costs cannot underflow.
+        constexpr score_t pruned_score = std::numeric_limits<score_t>::lowest() / 2;
+
+        auto const & score_scheme = params.scoring;
+        this->initialise_scoring_scheme(score_scheme);
+
+        int64_t const budget = static_cast<int64_t>(params.max_error);
+        int64_t const last_row = static_cast<int64_t>(this->dimension_second_range) - 1;
+        int64_t const last_column = static_cast<int64_t>(this->dimension_first_range) - 1;
+        int64_t const length_difference = last_row - last_column;
+
+        // A cell on diagonal d = row - column needs at least |d| indels in front of it and at least
+        // |length_difference - d| indels behind it, hence only the diagonals with
+        // |d| + |length_difference - d| <= budget can carry an alignment within the budget. If the length
+        // difference alone exceeds the budget no alignment satisfies it; then the corridor is widened to
+        // connect the origin with the last cell and the best score inside of it is reported.
+        auto ceil_half  = [] (int64_t const value) { return (value > 0) ? (value + 1) / 2 : value / 2; };
+        auto floor_half = [] (int64_t const value) { return (value < 0) ? (value - 1) / 2 : value / 2; };
+        int64_t const lower_diagonal = std::min(ceil_half(length_difference - budget),
+                                                std::min<int64_t>(0, length_difference));
+        int64_t const upper_diagonal = std::max(floor_half(length_difference + budget),
+                                                std::max<int64_t>(0, length_difference));
+
+        int64_t previous_window_end = last_row; // The initialisation column computes every row.
+
+        int64_t column_index = 0;
+        for (auto first_range_it = std::ranges::begin(first_range);
+             first_range_it != std::ranges::end(first_range); ++first_range_it)
+        {
+            ++column_index;
+            auto seq1_value = *first_range_it;
+            // Move internal matrix to next column.
+            this->go_next_column();
+
+            auto col = this->current_column();
+            this->init_row_cell(*std::ranges::begin(col), cache);
+
+            int64_t const window_begin = std::max<int64_t>(1, column_index + lower_diagonal);
+            int64_t const window_end = std::min(last_row, column_index + upper_diagonal);
+            assert(window_begin <= window_end + 1);
+
+            auto cell_it = std::ranges::next(std::ranges::begin(col), window_begin);
+
+            if (window_begin > 1)
+            {   // Skip the rows above the corridor: seed the diagonal score from the cell above the corridor,
+                // which the previous column computed as its own first corridor row, and block the vertical path
+                // into the corridor.
+                auto && above_entry = *std::ranges::prev(cell_it);
+                get<0>(get<0>(cache)) = get<0>(get<0>(above_entry));
+                get<1>(get<0>(cache)) = pruned_score;
+            }
+            else
+            {   // The vertical score cached by init_row_cell still contains the state below the previous
+                // column's corridor; replace it with a fresh gap opened below the first row.
+                get<1>(get<0>(cache)) = get<0>(get<0>(*std::ranges::begin(col))) + get<1>(cache);
+            }
+
+            auto second_range_it = std::ranges::begin(second_range);
+            std::ranges::advance(second_range_it, window_begin - 1);
+
+            for (int64_t row = window_begin; row <= window_end; ++row, ++cell_it, ++second_range_it)
+            {
+                // A row entering the corridor at the bottom still stores the horizontal score of the column it
+                // was computed in last; invalidate it such that no value of an older column leaks in.
+                if (row > previous_window_end) // TODO [[unlikely]]
+                    get<1>(get<0>(*cell_it)) = pruned_score;
+
+                this->compute_cell(*cell_it, cache, this->score(score_scheme, seq1_value, *second_range_it));
+            }
+
+            previous_window_end = window_end;
+        }
+
+        // The corridor always contains the last cell, which holds the score of the global alignment.
+        auto last_column_view = this->current_column() | std::view::transform([](auto && entry)
+            {
+            using std::get;
+            return std::tuple{get<0>(std::forward<decltype(entry)>(entry)),
+                              get<1>(std::forward<decltype(entry)>(entry))};
+        });
+        this->check_score_last_column(last_column_view, get<3>(cache));
+    }
+
+    /*!\brief Compute the alignment by iterating over the dynamic programming matrix in cache-sized row blocks.
+     * \tparam        first_range_t  The type of the first sequence (or packed sequences).
+     * \tparam        second_range_t The type of the second sequence (or packed sequences).
+     * \tparam        cache_t        The type of the cache.
+     * \param[in]     first_range    The first sequence.
+     * \param[in]     second_range   The second sequence.
+     * \param[in,out] cache          The cache holding hot variables.
+     *
+     * \details
+     *
+     * Processes the matrix in blocks of seqan3::align_cfg::tile rows. Within one block all columns are swept
+     * while only the corresponding segment of the column buffer is accessed, such that the working set fits
+     * into the cache even if the second sequence is much longer than one column buffer worth of cache. The cell
+     * state of a block's last row, i.e. the main score needed for the diagonal computation and the vertical
+     * score and trace needed to resume the column, is carried over to the next block in a boundary vector with
+     * one entry per column.
+     */
+    template <typename first_range_t,
+              typename second_range_t,
+              typename cache_t>
+    void compute_matrix_blocked(first_range_t & first_range,
+                                second_range_t & second_range,
+                                cache_t & cache)
+    {
+        using std::get;
+        // The type of one carried boundary cell; identical to the cached previous cell.
+        using boundary_t = std::tuple_element_t<0, cache_t>;
+
+        auto const & score_scheme = params.scoring;
+        this->initialise_scoring_scheme(score_scheme);
+
+        size_t const block_height = std::max<size_t>(params.tile, 1u);
+
+        // One entry per column carrying the cell state of the block's last row over to the next block.
+        std::vector<boundary_t> boundary{};
+        boundary.resize(this->dimension_first_range);
+
+        for (size_t row_begin = 0; row_begin < this->dimension_second_range; row_begin += block_height)
+        {
+            size_t const row_end = std::min(this->dimension_second_range, row_begin + block_height);
+            bool const is_last_block = row_end == this->dimension_second_range;
+
+            this->current_column_index = 0;  // Restart the column sweep for this block.
+
+            // ----------------------------------------------------------------------------
+            // Initialise the column segment of this block.
+            // ----------------------------------------------------------------------------
+
+            // The diagonal score for the first cell of the next column segment; stems from the previous block.
+            auto diagonal = get<0>(boundary[0]);
+
+            auto init_block = this->current_block(row_begin, row_end);
+            if (row_begin == 0)
+            {
+                this->init_origin_cell(*std::ranges::begin(init_block), cache);
+                ranges::for_each(init_block | ranges::view::drop_exactly(1), [&cache, this](auto && cell)
+                {
+                    this->init_column_cell(std::forward<decltype(cell)>(cell), cache);
+                });
+            }
+            else
+            {  // Restore the vertical state of the initialisation column from the previous block.
+                get<0>(cache) = boundary[0];
+                ranges::for_each(init_block, [&cache, this](auto && cell)
+                {
+                    this->init_column_cell(std::forward<decltype(cell)>(cell), cache);
+                });
+            }
+
+            {  // Carry over the state of the block's last initialisation cell.
+                auto [cell, coordinate, trace] = *std::ranges::prev(std::ranges::end(init_block));
+                (void) trace;
+                boundary[0] = boundary_t{get<0>(cell), get<1>(get<0>(cache)), get<2>(get<0>(cache))};
+
+                if constexpr (alignment_algorithm::find_optimum_in_last_row)
+                    if (is_last_block)
+                        this->check_score_last_row(get<0>(std::move(cell)), coordinate, get<3>(cache));
+            }
+
+            // ----------------------------------------------------------------------------
+            // Compute the column segments of this block.
+            // ----------------------------------------------------------------------------
+
+            for (auto first_range_it = std::ranges::begin(first_range);
+                 first_range_it != std::ranges::end(first_range); ++first_range_it)
+            {
+                auto seq1_value = *first_range_it;
+                // Move internal matrix to next column.
+                this->go_next_column();
+
+                auto col = this->current_block(row_begin, row_end);
+                auto & column_boundary = boundary[this->current_column_index];
+                auto next_diagonal = get<0>(column_boundary);
+
+                if (row_begin == 0)
+                {
+                    this->init_row_cell(*std::ranges::begin(col), cache);
+
+                    auto second_range_it = std::ranges::begin(second_range);
+                    ranges::for_each(col | ranges::view::drop_exactly(1), [&, this] (auto && cell)
+                    {
+                        this->compute_cell(cell, cache, this->score(score_scheme, seq1_value, *second_range_it));
+                        ++second_range_it;
+                    });
+                }
+                else
+                {  // Resume the column: the diagonal score stems from the previous column of the previous block,
+                   // the vertical state from this column's segment in the previous block.
+                    get<0>(cache) = boundary_t{diagonal, get<1>(column_boundary), get<2>(column_boundary)};
+
+                    auto second_range_it = std::ranges::begin(second_range);
+                    std::ranges::advance(second_range_it, row_begin - 1);
+                    ranges::for_each(col, [&, this] (auto && cell)
+                    {
+                        this->compute_cell(cell, cache, this->score(score_scheme, seq1_value, *second_range_it));
+                        ++second_range_it;
+                    });
+                }
+
+                // Carry over the state of the block's last cell for the next block.
+                auto [cell, coordinate, trace] = *std::ranges::prev(std::ranges::end(col));
+                (void) trace;
+                column_boundary = boundary_t{get<0>(cell), get<1>(get<0>(cache)), get<2>(get<0>(cache))};
+                diagonal = next_diagonal;
+
+                // Prepare last cell for tracking the optimum; elided at compile time for the disabled variants.
+                if constexpr (alignment_algorithm::find_optimum_in_last_row)
+                    if (is_last_block)
+                        this->check_score_last_row(get<0>(std::move(cell)), coordinate, get<3>(cache));
+            }
+        }
+
+        // Every block leaves the values of the last matrix column in its rows of the column buffer, hence the
+        // buffer now holds the complete last column.
+        auto last_column_view = this->current_column() | std::view::transform([](auto && entry)
+            {
+            using std::get;
+            return std::tuple{get<0>(std::forward<decltype(entry)>(entry)),
+                              get<1>(std::forward<decltype(entry)>(entry))};
+        });
+        this->check_score_last_column(last_column_view, get<3>(cache));
+    }
+
     /*!\brief Compute the alignment by iterating over the banded dynamic programming matrix in a column wise manner.
      * \tparam        first_range_t  The type of the first sequence (or packed sequences).
      * \tparam        second_range_t The type of the second sequence (or packed sequences).
@@ -421,7 +824,8 @@ private:
                                second_range_t & second_range,
                                cache_t & cache)
     {
-        auto const & score_scheme = get<align_cfg::scoring>(*cfg_ptr).value;
+        auto const & score_scheme = params.scoring;
+        this->initialise_scoring_scheme(score_scheme);
         // ----------------------------------------------------------------------------
         // 1st phase: Iterate as long as the band intersects with the first row.
         // ----------------------------------------------------------------------------
@@ -437,17 +841,19 @@ private:
             {
                 this->compute_cell(std::forward<decltype(cell)>(cell),
                                    cache,
-                                   score_scheme.score(first_range_value, *second_range_it));
+                                   this->score(score_scheme, first_range_value, *second_range_it));
                 ++second_range_it;
             });
 
-            if (this->band_touches_last_row())  // TODO [[unlikely]]
+            // The band test is elided at compile time if the last row is not part of the search space.
+            if constexpr (alignment_algorithm::find_optimum_in_last_row)
             {
-                auto [cell, coordinate, trace] = *std::ranges::prev(std::ranges::end(col));
-                (void) trace;
-                alignment_optimum current{get<0>(get<0>(std::move(cell))),
-                                          static_cast<alignment_coordinate>(coordinate)};
-                this->check_score_last_row(current, get<3>(cache));
+                if (this->band_touches_last_row())  // TODO [[unlikely]]
+                {
+                    auto [cell, coordinate, trace] = *std::ranges::prev(std::ranges::end(col));
+                    (void) trace;
+                    this->check_score_last_row(get<0>(get<0>(std::move(cell))), coordinate, get<3>(cache));
+                }
             }
         });
 
@@ -469,7 +875,7 @@ private:
             // Initialise the first cell of the current band.
             this->compute_first_band_cell(*std::ranges::begin(col),
                                           cache,
-                                          score_scheme.score(first_range_value, *second_range_it));
+                                          this->score(score_scheme, first_range_value, *second_range_it));
 
             // Process rest of current column band.
             ++second_range_it;
@@ -477,17 +883,19 @@ private:
             {
                 this->compute_cell(std::forward<decltype(cell)>(cell),
                                    cache,
-                                   score_scheme.score(first_range_value, *second_range_it));
+                                   this->score(score_scheme, first_range_value, *second_range_it));
                 ++second_range_it;
             });
 
-            if (this->band_touches_last_row()) // TODO [[unlikely]]
+            // The band test is elided at compile time if the last row is not part of the search space.
+            if constexpr (alignment_algorithm::find_optimum_in_last_row)
             {
-                auto [cell, coordinate, trace] = *std::ranges::prev(std::ranges::end(col));
-                (void) trace;
-                alignment_optimum current{get<0>(get<0>(std::move(cell))),
-                                          static_cast<alignment_coordinate>(coordinate)};
-                this->check_score_last_row(current, get<3>(cache));
+                if (this->band_touches_last_row()) // TODO [[unlikely]]
+                {
+                    auto [cell, coordinate, trace] = *std::ranges::prev(std::ranges::end(col));
+                    (void) trace;
+                    this->check_score_last_row(get<0>(get<0>(std::move(cell))), coordinate, get<3>(cache));
+                }
             }
         });
         // Prepare the last column for tracking the optimum: Only get the current score cell and the coordinate.
@@ -515,64 +923,186 @@ private:
     auto compute_traceback(first_range_t & first_range,
                            second_range_t & second_range,
                            alignment_coordinate back_coordinate)
+    {
+        // Parse the traceback
+        auto [front_coordinate, first_gap_segments, second_gap_segments] = this->parse_traceback(back_coordinate);
+
+        // In banded case we need to refine the back coordinate to map to the correct position within the
+        // second range.
+        if constexpr (is_banded)
+            back_coordinate = this->map_banded_coordinate_to_range_position(back_coordinate);
+
+        return build_aligned_sequences(first_range, second_range, front_coordinate, back_coordinate,
+                                       first_gap_segments, second_gap_segments);
+    }
+
+    /*!\brief Creates a callable that computes the traceback on the first access of the alignment.
+     * \tparam    first_range_t   The type of the first sequence (or packed sequences).
+     * \tparam    second_range_t  The type of the second sequence (or packed sequences).
+     * \param[in] first_range     The first sequence.
+     * \param[in] second_range    The second sequence.
+     * \param[in] back_coordinate The back coordinate within the matrix where the traceback starts.
+     *
+     * \details
+     *
+     * The kernel and its trace matrix buffer are reused for the next sequence pair. Therefore the deferred
+     * traceback takes ownership of the trace matrix and copies of the sequences instead of referring to the
+     * kernel. This way pipelines that inspect the alignment only for a fraction of the computed pairs pay
+     * the traceback cost only for the accessed results (see seqan3::alignment_result::alignment).
+     */
+    template <typename first_range_t, typename second_range_t>
+    auto make_lazy_traceback(first_range_t & first_range,
+                             second_range_t & second_range,
+                             alignment_coordinate const & back_coordinate)
+        requires !is_banded
     {
         using first_seq_value_type = value_type_t<first_range_t>;
         using second_seq_value_type = value_type_t<second_range_t>;
 
-        // Parse the traceback
-        auto [front_coordinate, first_gap_segments, second_gap_segments] = this->parse_traceback(back_coordinate);
+        return [trace_matrix = this->extract_trace_matrix(),
+                dimension_second_range = this->dimension_second_range,
+                first_seq = std::vector<first_seq_value_type>(std::ranges::begin(first_range),
+                                                              std::ranges::end(first_range)),
+                second_seq = std::vector<second_seq_value_type>(std::ranges::begin(second_range),
+                                                                std::ranges::end(second_range)),
+                back_coordinate] ()
+        {
+            auto [front_coordinate, first_gap_segments, second_gap_segments] =
+                parse_trace_matrix(trace_matrix, dimension_second_range, back_coordinate);
+
+            return build_aligned_sequences(first_seq, second_seq, front_coordinate, back_coordinate,
+                                           first_gap_segments, second_gap_segments);
+        };
+    }
 
-        auto fill_aligned_sequence = [](auto & aligned_sequence, auto & gap_segments, size_t const normalise)
+    /*!\brief Builds the aligned sequences from the parsed traceback.
+     * \tparam    first_range_t       The type of the first sequence (or packed sequences).
+     * \tparam    second_range_t      The type of the second sequence (or packed sequences).
+     * \tparam    gap_segments_t      The type of the container holding the seqan3::detail::gap_segment s.
+     * \param[in] first_range         The first sequence.
+     * \param[in] second_range        The second sequence.
+     * \param[in] front_coordinate    The coordinate where the alignment starts.
+     * \param[in] back_coordinate     The coordinate where the alignment ends.
+     * \param[in] first_gap_segments  The gap segments to insert into the first sequence.
+     * \param[in] second_gap_segments The gap segments to insert into the second sequence.
+     *
+     * \details
+     *
+     * Emits each gapped sequence in one pass: the infix between the front and back coordinate is interleaved
+     * with the gap segments directly into a buffer reserved for the final alignment length. The previous
+     * implementation first copied the infix and then inserted every gap segment into the middle of the copy,
+     * which shifted the tail once per gap — for short banded alignments that materialisation cost as much as
+     * the matrix computation itself.
+     */
+    template <typename first_range_t, typename second_range_t, typename gap_segments_t>
+    static auto build_aligned_sequences(first_range_t & first_range,
+                                        second_range_t & second_range,
+                                        alignment_coordinate const & front_coordinate,
+                                        alignment_coordinate const & back_coordinate,
+                                        gap_segments_t const & first_gap_segments,
+                                        gap_segments_t const & second_gap_segments)
+    {
+        using first_seq_value_type = value_type_t<first_range_t>;
+        using second_seq_value_type = value_type_t<second_range_t>;
+
+        auto fill_aligned_sequence = [](auto & aligned_sequence,
+                                        auto seq_it,
+                                        size_t const seq_length,
+                                        auto const & gap_segments,
+                                        size_t const normalise)
         {
-            assert(normalise <= gap_segments[0].position);
+            size_t total_gap_size = 0;
+            for (auto const & gap_elem : gap_segments)
+                total_gap_size += gap_elem.size;
 
-            size_t offset = 0;
+            aligned_sequence.reserve(seq_length + total_gap_size);
+
+            size_t copied = 0;
             for (auto const & gap_elem : gap_segments)
             {
-                // insert_gap(aligned_sequence, gap.position + offset, gap.size);
-                auto it = std::ranges::begin(aligned_sequence);
-                std::ranges::advance(it, (gap_elem.position - normalise) + offset);
-                aligned_sequence.insert(it, gap_elem.size, gap{});
-                offset += gap_elem.size;
+                assert(normalise <= gap_elem.position);
+
+                for (size_t const until = gap_elem.position - normalise; copied < until; ++copied, ++seq_it)
+                    aligned_sequence.emplace_back(*seq_it);
+                aligned_sequence.insert(std::ranges::end(aligned_sequence), gap_elem.size, gap{});
             }
-        };
 
-        // In banded case we need to refine the back coordinate to map to the correct position within the
-        // second range.
-        if constexpr (is_banded)
-            back_coordinate = this->map_banded_coordinate_to_range_position(back_coordinate);
+            for (; copied < seq_length; ++copied, ++seq_it)
+                aligned_sequence.emplace_back(*seq_it);
+        };
 
-        // Get the subrange over the first sequence according to the front and back coordinate.
+        // Emit the aligned_sequence for the first sequence.
         auto it_first_seq_begin = std::ranges::begin(first_range);
         std::ranges::advance(it_first_seq_begin, front_coordinate.first);
-        auto it_first_seq_end = std::ranges::begin(first_range);
-        std::ranges::advance(it_first_seq_end, back_coordinate.first);
-
-        using first_subrange_type = std::ranges::subrange<decltype(it_first_seq_begin), decltype(it_first_seq_end)>;
-        auto first_subrange = first_subrange_type{it_first_seq_begin, it_first_seq_end};
 
-        // Create and fill the aligned_sequence for the first sequence.
-        std::vector<gapped<first_seq_value_type>> first_aligned_seq{first_subrange};
-        fill_aligned_sequence(first_aligned_seq, first_gap_segments, front_coordinate.first);
+        std::vector<gapped<first_seq_value_type>> first_aligned_seq{};
+        fill_aligned_sequence(first_aligned_seq, it_first_seq_begin,
+                              back_coordinate.first - front_coordinate.first,
+                              first_gap_segments, front_coordinate.first);
 
-        // Get the subrange over the second sequence according to the front and back coordinate.
+        // Emit the aligned_sequence for the second sequence.
         auto it_second_seq_begin = std::ranges::begin(second_range);
         std::ranges::advance(it_second_seq_begin, front_coordinate.second);
-        auto it_second_seq_end = std::ranges::begin(second_range);
-        std::ranges::advance(it_second_seq_end, back_coordinate.second);
 
-        using second_subrange_type = std::ranges::subrange<decltype(it_second_seq_begin), decltype(it_second_seq_end)>;
-        auto second_subrange = second_subrange_type{it_second_seq_begin, it_second_seq_end};
-
-        // Create and fill the aligned_sequence for the second sequence.
-        std::vector<gapped<second_seq_value_type>> second_aligned_seq{second_subrange};
-        fill_aligned_sequence(second_aligned_seq, second_gap_segments, front_coordinate.second);
+        std::vector<gapped<second_seq_value_type>> second_aligned_seq{};
+        fill_aligned_sequence(second_aligned_seq, it_second_seq_begin,
+                              back_coordinate.second - front_coordinate.second,
+                              second_gap_segments, front_coordinate.second);
 
         return std::tuple{front_coordinate, std::tuple{first_aligned_seq, second_aligned_seq}};
     }
 
-    //!\brief The alignment configuration stored on the heap.
-    std::shared_ptr<config_t> cfg_ptr{};
+    /*!\brief Checks whether the computation can be aborted according to the x-drop criterion.
+     * \tparam cache_t The cache type.
+     * \param[in,out] cache The cache holding hot variables.
+     * \returns `true` if the remaining columns cannot recover the running optimum, `false` otherwise.
+     *
+     * \details
+     *
+     * Compares the optimum of the current column with the running optimum over all previously computed
+     * columns. If the column optimum falls more than the configured seqan3::align_cfg::x_drop value below the
+     * running optimum, the running optimum is reported as the result of this filtered sequence pair.
+     */
+    template <typename cache_t>
+    bool abort_by_x_drop(cache_t & cache)
+    {
+        using std::get;
+
+        // Only get the current score cell and the coordinate of the current column.
+        auto column_view = this->current_column() | std::view::transform([](auto && entry)
+        {
+            using std::get;
+            return std::tuple{get<0>(std::forward<decltype(entry)>(entry)),
+                              get<1>(std::forward<decltype(entry)>(entry))};
+        });
+
+        alignment_optimum<int32_t> column_optimum{};
+        this->check_score_column(column_view, column_optimum);
+        running_optimum = std::max(column_optimum, running_optimum, alignment_optimum_compare_less{});
+
+        if (column_optimum.score + params.x_drop < running_optimum.score)
+        {
+            get<3>(cache) = running_optimum;
+            is_filtered = true;
+            return true;
+        }
+        return false;
+    }
+
+    //!\brief The configuration values resolved once into a flattened block stored by value.
+    alignment_parameter_block_t<config_t> params{};
+
+    /*!\name Only used if seqan3::align_cfg::x_drop is configured
+     * \{
+     */
+    //!\brief The running optimum over all computed columns.
+    alignment_optimum<int32_t> running_optimum{};
+    //!\brief Whether the computation was aborted by the x-drop criterion.
+    bool is_filtered{false};
+
+    //!\brief Whether the optimum lies on the band boundary; only used if seqan3::adaptive_band is configured.
+    bool optimum_on_band_boundary{false};
+    //!\}
 };
 
 } // namespace seqan3::detail
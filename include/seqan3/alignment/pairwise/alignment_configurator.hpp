@@ -22,7 +22,11 @@
 #include <seqan3/alignment/pairwise/alignment_algorithm.hpp>
 #include <seqan3/alignment/pairwise/align_result_selector.hpp>
 #include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_banded.hpp>
 #include <seqan3/alignment/pairwise/edit_distance_unbanded.hpp>
+#include <seqan3/alignment/pairwise/hirschberg_alignment_algorithm.hpp>
+#include <seqan3/alignment/pairwise/qgram_filter_wrapper.hpp>
+#include <seqan3/alignment/pairwise/score_only_alignment_algorithm.hpp>
 #include <seqan3/alphabet/gap/gapped.hpp>
 #include <seqan3/core/concept/tuple.hpp>
 #include <seqan3/core/metafunction/deferred_crtp_base.hpp>
@@ -309,8 +313,50 @@ public:
             auto const & scoring_scheme = get<align_cfg::scoring>(cfg).value;
             auto align_ends_cfg = cfg.template value_or<align_cfg::aligned_ends>(free_ends_none);
 
+            // Use the linear-space alignment if requested.
+            if constexpr (config_t::template exists<align_cfg::linear_space>())
+            {
+                if constexpr (config_t::template exists<align_cfg::band>())
+                {
+                    throw invalid_alignment_configuration{"The linear-space alignment does not support the "
+                                                          "align_cfg::band configuration."};
+                }
+                else if constexpr (config_t::template exists<align_cfg::max_error>())
+                {
+                    throw invalid_alignment_configuration{"The linear-space alignment does not support the "
+                                                          "align_cfg::max_error configuration."};
+                }
+                else
+                {
+                    if (gaps.get_gap_open_score() != 0)
+                        throw invalid_alignment_configuration{"The linear-space alignment only supports linear "
+                                                              "gap costs."};
+
+                    if (align_ends_cfg[0] || align_ends_cfg[1] || align_ends_cfg[2] || align_ends_cfg[3])
+                        throw invalid_alignment_configuration{"The linear-space alignment does not support free "
+                                                              "end gaps."};
+
+                    return with_qgram_filter(cfg,
+                                             function_wrapper_t{
+                                                 hirschberg_alignment_algorithm<remove_cvref_t<config_t>>{cfg}});
+                }
+            }
+
+            // The adaptive band is only supported by the standard dynamic programming alignment.
+            constexpr bool band_is_adaptive = [] () constexpr
+            {
+                if constexpr (config_t::template exists<align_cfg::band>())
+                    return std::Same<remove_cvref_t<decltype(get<align_cfg::band>(std::declval<config_t>()).value)>,
+                                     adaptive_band>;
+                else
+                    return false;
+            }();
+
             // Only use edit distance if ...
-            if (gaps.get_gap_open_score() == 0 &&  // gap open score is not set,
+            if (!band_is_adaptive && // the band is not adaptive,
+                !config_t::template exists<align_cfg::x_drop>() && // the x-drop termination is not requested,
+                !config_t::template exists<align_cfg::tile>() && // the blocked computation is not requested,
+                gaps.get_gap_open_score() == 0 &&  // gap open score is not set,
                 !(align_ends_cfg[2] || align_ends_cfg[3]) && // none of the free end gaps are set for second seq,
                 align_ends_cfg[0] == align_ends_cfg[1]) // free ends for leading and trailing gaps are equal in first seq.
             {
@@ -321,7 +367,7 @@ public:
                 {
                     if ((scoring_scheme.score('A'_dna15, 'A'_dna15) == 0) &&
                         (scoring_scheme.score('A'_dna15, 'C'_dna15)) == -1)
-                        return configure_edit_distance<function_wrapper_t>(cfg);
+                        return with_qgram_filter(cfg, configure_edit_distance<function_wrapper_t>(cfg));
                 }
             }
 
@@ -329,17 +375,89 @@ public:
             // Check if invalid configuration was used.
             // ----------------------------------------------------------------------------
 
-            // Do not allow max error configuration for alignments not computing the edit distance.
-            if (config_t::template exists<align_cfg::max_error>())
-                throw invalid_alignment_configuration{"The align_cfg::max_error configuration is only allowed for "
-                                                      "the specific edit distance computation."};
-            // Configure the alignment algorithm.
-            return configure_free_ends_initialisation<function_wrapper_t>(cfg);
+            // Besides the edit distance the max error configuration is honoured by the general alignment, which
+            // prunes the matrix to the corridor of diagonals reachable within the error budget (see
+            // seqan3::detail::alignment_algorithm::compute_matrix_pruned). The corridor argument requires that
+            // the whole alignment path counts towards the budget and that no trace is recorded for the skipped
+            // cells, hence the remaining combinations are rejected.
+            if constexpr (config_t::template exists<align_cfg::max_error>())
+            {
+                if constexpr (config_t::template exists<align_cfg::band>() ||
+                              config_t::template exists<align_cfg::x_drop>() ||
+                              config_t::template exists<align_cfg::tile>() ||
+                              config_t::template exists<align_cfg::result<with_alignment_type>>() ||
+                              config_t::template exists<align_cfg::result<with_front_coordinate_type>>())
+                {
+                    throw invalid_alignment_configuration{"The align_cfg::max_error configuration is only allowed "
+                                                          "for the edit distance and the score or back coordinate "
+                                                          "computation without the band, tile and x-drop "
+                                                          "configurations."};
+                }
+                else if (align_ends_cfg[0] || align_ends_cfg[1] || align_ends_cfg[2] || align_ends_cfg[3])
+                {
+                    throw invalid_alignment_configuration{"The align_cfg::max_error configuration does not support "
+                                                          "free end gaps outside of the edit distance computation."};
+                }
+            }
+
+            // The blocked computation sweeps the columns once per block and therefore cannot record the trace
+            // matrix, which is filled in column order.
+            if constexpr (config_t::template exists<align_cfg::tile>() &&
+                          (config_t::template exists<align_cfg::result<with_alignment_type>>() ||
+                           config_t::template exists<align_cfg::result<with_front_coordinate_type>>()))
+            {
+                throw invalid_alignment_configuration{"The blocked alignment computation (align_cfg::tile) only "
+                                                      "supports the score and the back coordinate computation."};
+            }
+            else
+            {
+                // When only the score is requested and no end gaps are free, the optimum is known to lie in the
+                // last cell of the matrix and no coordinate is ever reported. This most common configuration is
+                // served by a stripped kernel holding nothing but two rolling score vectors instead of the
+                // policy-based algorithm with its coordinate and optimum bookkeeping.
+                if constexpr (config_t::template exists<align_cfg::result<with_score_type>>() &&
+                              !config_t::template exists<align_cfg::band>() &&
+                              !config_t::template exists<align_cfg::x_drop>() &&
+                              !config_t::template exists<align_cfg::tile>() &&
+                              !config_t::template exists<align_cfg::max_error>())
+                {
+                    if (!(align_ends_cfg[0] || align_ends_cfg[1] || align_ends_cfg[2] || align_ends_cfg[3]))
+                    {
+                        return with_qgram_filter(cfg, function_wrapper_t{
+                                   score_only_alignment_algorithm<remove_cvref_t<config_t>>{cfg}});
+                    }
+                }
+
+                // Configure the alignment algorithm.
+                return with_qgram_filter(cfg, configure_free_ends_initialisation<function_wrapper_t>(cfg));
+            }
         }
     }
 
 private:
 
+    /*!\brief Wraps the configured algorithm with the q-gram pre-filter if requested.
+     * \tparam function_wrapper_t The invocable alignment function type-erased via std::function.
+     * \tparam config_t           The alignment configuration type.
+     * \param[in] cfg             The passed configuration object.
+     * \param[in] algorithm       The configured alignment algorithm.
+     * \returns The algorithm wrapped with seqan3::detail::qgram_filter_wrapper if the
+     *          seqan3::align_cfg::qgram_filter element is set, otherwise the algorithm unchanged.
+     */
+    template <typename function_wrapper_t, typename config_t>
+    static constexpr function_wrapper_t with_qgram_filter(config_t const & cfg, function_wrapper_t algorithm)
+    {
+        if constexpr (remove_cvref_t<config_t>::template exists<align_cfg::qgram_filter>())
+        {
+            return function_wrapper_t{qgram_filter_wrapper<remove_cvref_t<config_t>, function_wrapper_t>{
+                cfg, std::move(algorithm)}};
+        }
+        else
+        {
+            return algorithm;
+        }
+    }
+
     /*!\brief Configures the edit distance algorithm.
      * \tparam function_wrapper_t The invocable alignment function type-erased via std::function.
      * \tparam config_t           The alignment configuration type.
@@ -349,11 +467,34 @@ private:
     static constexpr function_wrapper_t configure_edit_distance(config_t const & cfg)
     {
         // ----------------------------------------------------------------------------
-        // Unsupported configurations
+        // Configure banded edit distance
         // ----------------------------------------------------------------------------
 
         if constexpr (config_t::template exists<align_cfg::band>())
-            throw invalid_alignment_configuration{"Banded alignments are yet not supported."};
+        {
+            using result_value_t = remove_cvref_t<decltype(get<align_cfg::result>(cfg).value)>;
+
+            // The banded edit distance computes global alignments only and does not use the Ukkonen trick.
+            if constexpr (config_t::template exists<align_cfg::max_error>())
+            {
+                throw invalid_alignment_configuration{"The align_cfg::max_error configuration is not supported for "
+                                                      "the banded edit distance computation."};
+            }
+            else if constexpr (std::Same<result_value_t, with_front_coordinate_type> ||
+                               std::Same<result_value_t, with_alignment_type>)
+            {
+                throw invalid_alignment_configuration{"The banded edit distance supports the score and the back "
+                                                      "coordinate computation only."};
+            }
+            else
+            {
+                auto band_ends_cfg = cfg.template value_or<align_cfg::aligned_ends>(free_ends_none);
+                if (band_ends_cfg[0] || band_ends_cfg[1] || band_ends_cfg[2] || band_ends_cfg[3])
+                    throw invalid_alignment_configuration{"The banded edit distance does not support free end gaps."};
+
+                return function_wrapper_t{edit_distance_banded_wrapper<remove_cvref_t<config_t>>{cfg}};
+            }
+        }
 
         // ----------------------------------------------------------------------------
         // Configure semi-global alignment
@@ -417,6 +558,9 @@ private:
      *
      * The matrix initialisation depends on the settings for the leading gaps for the first and the second sequence
      * within the seqan3::align_cfg::aligned_ends configuration element.
+     * Specifiers that were given as std::integral_constant are resolved at compile time; only specifiers holding a
+     * runtime `bool` are dispatched via a runtime branch, which happens once during the configuration and selects
+     * a kernel that is fixed for the entire alignment computation.
      */
     template <typename function_wrapper_t, typename config_t>
     static constexpr function_wrapper_t configure_free_ends_initialisation(config_t const & cfg);
@@ -432,10 +576,26 @@ private:
      *
      * This option is configured in the seqan3::align_cfg::aligned_ends configuration element according to
      * the settings for the trailing gaps of the first and the second sequence.
+     * As for the initialisation, statically known specifiers select the respective search space at compile time,
+     * such that the optimum search inside of seqan3::detail::find_optimum_policy never branches per cell.
      */
     template <typename function_wrapper_t, typename ...policies_t, typename config_t>
     static constexpr function_wrapper_t configure_free_ends_optimum_search(config_t const & cfg);
 
+    /*!\brief Configures how the substitution scores are computed in the alignment algorithm.
+     * \tparam function_wrapper_t The invocable alignment function type-erased via std::function.
+     * \tparam policies_t         A template parameter pack for the already configured policy types.
+     * \tparam config_t           The alignment configuration type.
+     * \param[in] cfg             The passed configuration object.
+     *
+     * \details
+     *
+     * If the configured scheme is a plain match/mismatch scheme, the matrix lookup in the innermost loop is
+     * replaced by a branchless equality test (see seqan3::detail::scoring_scheme_policy).
+     */
+    template <typename function_wrapper_t, typename ...policies_t, typename config_t>
+    static constexpr function_wrapper_t configure_scoring_scheme(config_t const & cfg);
+
     /*!\brief Determines the trace type.
      * \tparam config_t The configuration type.
      */
@@ -562,7 +722,7 @@ constexpr function_wrapper_t alignment_configurator::configure_free_ends_optimum
         };
 
         using find_optimum_t = deferred_crtp_base<find_optimum_policy, policy_trait_type>;
-        return function_wrapper_t{alignment_algorithm<config_t, policies_t..., find_optimum_t>{cfg}};
+        return configure_scoring_scheme<function_wrapper_t, policies_t..., find_optimum_t>(cfg);
     };
 
     // This lambda determines the lookup configuration for the second sequence given
@@ -600,4 +760,38 @@ constexpr function_wrapper_t alignment_configurator::configure_free_ends_optimum
     }
 }
 //!\endcond
+
+//!\cond
+// This function returns a std::function object which can capture runtime dependent alignment algorithm types through
+// a fixed invocation interface which is already defined by the caller of this function.
+template <typename function_wrapper_t, typename ...policies_t, typename config_t>
+constexpr function_wrapper_t alignment_configurator::configure_scoring_scheme(config_t const & cfg)
+{
+    auto const & scoring_scheme = get<align_cfg::scoring>(cfg).value;
+
+    // This lambda augments the scoring scheme policy of the alignment algorithm
+    // with the simple scheme property determined before.
+    auto make_algorithm = [&](auto use_simple_scheme) constexpr
+    {
+        struct scheme_trait_type
+        {
+            using use_simple_scheme_type [[maybe_unused]] = decltype(use_simple_scheme);
+        };
+
+        using scoring_scheme_t = deferred_crtp_base<scoring_scheme_policy, scheme_trait_type>;
+        return function_wrapper_t{alignment_algorithm<config_t, policies_t..., scoring_scheme_t>{cfg}};
+    };
+
+    // Plain match/mismatch schemes are scored with a branchless equality test instead of the matrix lookup.
+    // TODO: Instead of relying on nucleotide scoring schemes we need to be able to determine the simple scheme
+    //       option via the scheme.
+    if constexpr (is_type_specialisation_of_v<remove_cvref_t<decltype(scoring_scheme)>, nucleotide_scoring_scheme>)
+    {
+        if (is_simple_scoring_scheme(scoring_scheme))
+            return make_algorithm(std::true_type{});
+    }
+
+    return make_algorithm(std::false_type{});
+}
+//!\endcond
 } // namespace seqan3::detail
@@ -0,0 +1,130 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::alignment_parameter_block.
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/scoring/gap_scheme.hpp>
+#include <seqan3/core/metafunction/basic.hpp>
+
+namespace seqan3::detail
+{
+
+//!\brief Placeholder member type for parameters that are absent from the alignment configuration.
+//!\ingroup pairwise_alignment
+struct unset_parameter
+{};
+
+/*!\brief A flattened block of the configuration values an alignment kernel reads.
+ * \ingroup pairwise_alignment
+ * \tparam gap_t       The type of the resolved gap scheme.
+ * \tparam scoring_t   The type of the resolved scoring scheme.
+ * \tparam band_t      The type of the configured band, or seqan3::detail::unset_parameter.
+ * \tparam max_error_t The type of the configured error maximum, or seqan3::detail::unset_parameter.
+ * \tparam tile_t      The type of the configured tile height, or seqan3::detail::unset_parameter.
+ * \tparam x_drop_t    The type of the configured x-drop value, or seqan3::detail::unset_parameter.
+ *
+ * \details
+ *
+ * A seqan3::configuration stores its elements in a tuple, so every `get<>` on it traverses the element
+ * list and every copy drags the full tuple along. The kernels configured by
+ * seqan3::detail::alignment_configurator read only a handful of plain values out of it, but did so per
+ * sequence pair through a std::shared_ptr — for sub-microsecond alignments the configuration plumbing
+ * showed up in the profile. This block is the result of resolving all those `get<>` calls exactly once
+ * (see seqan3::detail::make_alignment_parameter_block): a flat aggregate of the values themselves that
+ * the kernels store by value and read like ordinary members. Parameters the configuration does not
+ * contain collapse to the empty seqan3::detail::unset_parameter; the kernels guard their use with
+ * `if constexpr` on the configuration type as before.
+ */
+template <typename gap_t,
+          typename scoring_t,
+          typename band_t      = unset_parameter,
+          typename max_error_t = unset_parameter,
+          typename tile_t      = unset_parameter,
+          typename x_drop_t    = unset_parameter>
+struct alignment_parameter_block
+{
+    //!\brief The gap scheme (the configured one or the kernel's default).
+    gap_t gap{};
+    //!\brief The scoring scheme.
+    scoring_t scoring{};
+    //!\brief The band restricting the matrix; unset if seqan3::align_cfg::band is not configured.
+    band_t band{};
+    //!\brief The error maximum; unset if seqan3::align_cfg::max_error is not configured.
+    max_error_t max_error{};
+    //!\brief The tile height of the blocked computation; unset if seqan3::align_cfg::tile is not configured.
+    tile_t tile{};
+    //!\brief The x-drop value; unset if seqan3::align_cfg::x_drop is not configured.
+    x_drop_t x_drop{};
+};
+
+/*!\brief Resolves the alignment configuration into a seqan3::detail::alignment_parameter_block.
+ * \ingroup pairwise_alignment
+ * \tparam config_t The configuration type; must be of type seqan3::configuration.
+ * \param[in] cfg         The configuration to resolve.
+ * \param[in] default_gap The gap scheme to use if seqan3::align_cfg::gap is not configured.
+ * \returns The filled parameter block.
+ */
+template <typename config_t>
+constexpr auto make_alignment_parameter_block(config_t const & cfg,
+                                              gap_scheme<int8_t> const default_gap =
+                                                  gap_scheme{gap_score{-1}, gap_open_score{-10}})
+{
+    using cfg_t = remove_cvref_t<config_t>;
+
+    auto gap     = cfg.template value_or<align_cfg::gap>(default_gap);
+    auto scoring = get<align_cfg::scoring>(cfg).value;
+
+    auto band = [&] ()
+    {
+        if constexpr (cfg_t::template exists<align_cfg::band>())
+            return get<align_cfg::band>(cfg).value;
+        else
+            return unset_parameter{};
+    }();
+
+    auto max_error = [&] ()
+    {
+        if constexpr (cfg_t::template exists<align_cfg::max_error>())
+            return get<align_cfg::max_error>(cfg).value;
+        else
+            return unset_parameter{};
+    }();
+
+    auto tile = [&] ()
+    {
+        if constexpr (cfg_t::template exists<align_cfg::tile>())
+            return get<align_cfg::tile>(cfg).value;
+        else
+            return unset_parameter{};
+    }();
+
+    auto x_drop = [&] ()
+    {
+        if constexpr (cfg_t::template exists<align_cfg::x_drop>())
+            return get<align_cfg::x_drop>(cfg).value;
+        else
+            return unset_parameter{};
+    }();
+
+    return alignment_parameter_block<decltype(gap), decltype(scoring), decltype(band),
+                                     decltype(max_error), decltype(tile), decltype(x_drop)>
+        {std::move(gap), std::move(scoring), std::move(band), std::move(max_error),
+         std::move(tile), std::move(x_drop)};
+}
+
+//!\brief The seqan3::detail::alignment_parameter_block type resolved from `config_t`.
+//!\ingroup pairwise_alignment
+template <typename config_t>
+using alignment_parameter_block_t =
+    decltype(make_alignment_parameter_block(std::declval<remove_cvref_t<config_t> const &>()));
+
+} // namespace seqan3::detail
@@ -13,6 +13,9 @@
 
 #pragma once
 
+#include <functional>
+#include <tuple>
+
 #include <seqan3/core/metafunction/template_inspection.hpp>
 
 namespace seqan3::detail
@@ -42,6 +45,13 @@ struct alignment_result_value_type
     front_coord_t front_coordinate{};
     //! \brief The alignment, i.e. the actual base pair matching.
     alignment_t alignment{};
+    //! \brief Whether the computation was aborted early or skipped (see seqan3::align_cfg::x_drop and
+    //!        seqan3::align_cfg::qgram_filter).
+    bool filtered{false};
+    /*!\brief Callable that computes the front coordinate and the alignment on first access; empty if the
+     *        traceback was computed eagerly.
+     */
+    std::function<std::tuple<front_coord_t, alignment_t> ()> lazy_traceback{};
 };
 
 /*!\name Type deduction guides
@@ -98,7 +108,8 @@ class alignment_result
 {
 private:
     //! \brief Traits object that contains the actual alignment result data.
-    alignment_result_traits data;
+    //! \details Mutable such that a deferred traceback can be computed on first access via the const accessors.
+    mutable alignment_result_traits data;
 
     /*!\name Member types
      * \brief Local definition of the types contained in the `data` object.
@@ -175,15 +186,17 @@ public:
 
     /*!\brief Returns the front coordinate of the alignment.
      * \return  A pair of positions in the respective sequences, where the calculated alignment starts.
-     * \details Guaranteed to be smaller than or equal to `back_coordinate()`.
+     * \details Guaranteed to be smaller than or equal to `back_coordinate()`. If the traceback was deferred,
+     * the first access triggers its computation (see seqan3::alignment_result::alignment).
      * \attention This function will fail the compilation, if the front coordinate was not requested in the alignment
      * configuration.
      */
-    constexpr front_coord_t const & front_coordinate() const noexcept
+    front_coord_t const & front_coordinate() const
     {
         static_assert(!std::is_same_v<front_coord_t, std::nullopt_t *>,
                       "Trying to access the front coordinate, although it was not requested in the alignment "
                       "configuration.");
+        force_traceback();
         return data.front_coordinate;
     }
 
@@ -191,14 +204,51 @@ public:
      * \return At least two gapped sequences, which represent the alignment.
      * \attention This function with fail the compilation, if the alignment was not requested in the alignment
      * configuration.
+     *
+     * \details
+     *
+     * The traceback might have been deferred by the alignment algorithm. In this case the first access parses the
+     * stored trace matrix and builds the aligned sequences; subsequent accesses return the cached alignment. Hence
+     * pipelines that inspect the alignment only for a fraction of the computed pairs pay the traceback cost only
+     * for the accessed results. Concurrent first accesses to the same result object are not thread-safe.
      */
-    constexpr alignment_t const & alignment() const noexcept
+    alignment_t const & alignment() const
     {
         static_assert(!std::is_same_v<alignment_t, std::nullopt_t *>,
                       "Trying to access the alignment, although it was not requested in the alignment configuration.");
+        force_traceback();
         return data.alignment;
     }
+
+    /*!\brief Returns whether the computation of this alignment was aborted early.
+     * \return `true` if the alignment was dropped by the seqan3::align_cfg::x_drop termination or skipped by the
+     *         seqan3::align_cfg::qgram_filter pre-filter, `false` otherwise.
+     *
+     * \details
+     *
+     * For alignments dropped by the x-drop termination the score reports the running optimum that was observed
+     * until the computation was aborted; for alignments skipped by the q-gram pre-filter no score was computed
+     * at all.
+     */
+    constexpr bool is_filtered() const noexcept
+    {
+        return data.filtered;
+    }
     //!\}
+
+private:
+    //!\brief Invokes the deferred traceback on the first access and caches the result.
+    void force_traceback() const
+    {
+        if constexpr (!std::is_same_v<alignment_t, std::nullopt_t *>)
+        {
+            if (data.lazy_traceback)
+            {
+                std::tie(data.front_coordinate, data.alignment) = data.lazy_traceback();
+                data.lazy_traceback = nullptr;
+            }
+        }
+    }
 };
 
 } // namespace seqan3
@@ -12,12 +12,19 @@
 
 #pragma once
 
+#include <seqan3/alignment/pairwise/align_all_vs_all.hpp>
 #include <seqan3/alignment/pairwise/align_pairwise.hpp>
 #include <seqan3/alignment/pairwise/alignment_result.hpp>
 #include <seqan3/alignment/pairwise/alignment_algorithm.hpp>
 #include <seqan3/alignment/pairwise/align_result_selector.hpp>
 #include <seqan3/alignment/pairwise/alignment_configurator.hpp>
+#include <seqan3/alignment/pairwise/antidiagonal_alignment_algorithm.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_banded.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_pattern.hpp>
 #include <seqan3/alignment/pairwise/edit_distance_unbanded.hpp>
+#include <seqan3/alignment/pairwise/hirschberg_alignment_algorithm.hpp>
+#include <seqan3/alignment/pairwise/score_only_alignment_algorithm.hpp>
+#include <seqan3/alignment/pairwise/simd_alignment_algorithm.hpp>
 #include <seqan3/alignment/pairwise/execution/all.hpp>
 #include <seqan3/alignment/pairwise/policy/all.hpp>
 
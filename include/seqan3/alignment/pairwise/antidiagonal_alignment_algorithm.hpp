@@ -0,0 +1,292 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::antidiagonal_alignment_algorithm.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_result_selector.hpp>
+#include <seqan3/alignment/pairwise/alignment_parameter_block.hpp>
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/scoring/gap_scheme.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/metafunction/range.hpp>
+#include <seqan3/core/simd/simd.hpp>
+#include <seqan3/core/simd/simd_algorithm.hpp>
+#include <seqan3/core/simd/simd_traits.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief The alignment algorithm to compute a single pairwise alignment using an intra-sequence SIMD
+ *        vectorisation over the anti-diagonals of the dynamic programming matrix.
+ * \ingroup pairwise_alignment
+ * \tparam config_t The configuration type; must be of type seqan3::configuration.
+ *
+ * \details
+ *
+ * In contrast to the inter-sequence vectorisation of seqan3::detail::simd_alignment_algorithm, which
+ * requires many independent sequence pairs to fill the simd lanes, this algorithm vectorises the
+ * computation of one single alignment. All cells on one anti-diagonal of the dynamic programming matrix
+ * are independent of each other and can therefore be computed in parallel with simd instructions. This
+ * pays off for long sequences (tens of kilobases and more), where a single alignment should saturate the
+ * vector units of one core.
+ *
+ * The three recursion states (optimal, horizontal gap and vertical gap) are kept in linear buffers indexed
+ * by the position in the first sequence, such that consecutive cells of one anti-diagonal occupy
+ * consecutive memory and can be processed with unaligned vector loads and stores.
+ *
+ * Like the inter-sequence vectorisation, this algorithm is currently restricted to the score computation
+ * and simple match/mismatch scoring schemes.
+ */
+template <typename config_t>
+class antidiagonal_alignment_algorithm
+{
+private:
+    //!\brief The scalar score type used in the dynamic programming recursion.
+    using score_t = int32_t;
+    //!\brief The simd vector type over the score type.
+    using simd_score_t = simd_type_t<score_t>;
+
+    //!\brief The number of cells of one anti-diagonal computed per simd instruction.
+    static constexpr size_t simd_length = simd_traits<simd_score_t>::length;
+    //!\brief A value close to the smallest score that cannot underflow when a gap score is added.
+    static constexpr score_t infinity = std::numeric_limits<score_t>::lowest() / 2;
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr antidiagonal_alignment_algorithm()                                                    = default; //!< Defaulted
+    constexpr antidiagonal_alignment_algorithm(antidiagonal_alignment_algorithm const &)            = default; //!< Defaulted
+    constexpr antidiagonal_alignment_algorithm(antidiagonal_alignment_algorithm &&)                 = default; //!< Defaulted
+    constexpr antidiagonal_alignment_algorithm & operator=(antidiagonal_alignment_algorithm const &) = default; //!< Defaulted
+    constexpr antidiagonal_alignment_algorithm & operator=(antidiagonal_alignment_algorithm &&)      = default; //!< Defaulted
+    ~antidiagonal_alignment_algorithm()                                                             = default; //!< Defaulted
+
+    /*!\brief Constructs the algorithm with the passed configuration.
+     * \param cfg The configuration to be passed to the algorithm.
+     */
+    explicit constexpr antidiagonal_alignment_algorithm(config_t const & cfg) :
+        params{make_alignment_parameter_block(cfg)}
+    {}
+    //!\}
+
+    /*!\brief Computes the pairwise alignment of the two passed sequences.
+     * \tparam    first_range_t  The type of the first sequence; must model std::ranges::ForwardRange.
+     * \tparam    second_range_t The type of the second sequence; must model std::ranges::ForwardRange.
+     * \param[in] first_range    The first sequence.
+     * \param[in] second_range   The second sequence.
+     * \returns A seqan3::alignment_result with the score of the global alignment.
+     */
+    template <std::ranges::ForwardRange first_range_t, std::ranges::ForwardRange second_range_t>
+    auto operator()(first_range_t && first_range, second_range_t && second_range)
+    {
+        using alphabet1_t = value_type_t<remove_cvref_t<first_range_t>>;
+        using alphabet2_t = value_type_t<remove_cvref_t<second_range_t>>;
+        using result_value_t = typename align_result_selector<remove_cvref_t<first_range_t>,
+                                                              remove_cvref_t<second_range_t>,
+                                                              config_t>::type;
+
+        static_assert(!config_t::template exists<align_cfg::band>(),
+                      "The anti-diagonal alignment does not support the banded alignment yet.");
+        static_assert(!config_t::template exists<align_cfg::result<with_back_coordinate_type>>() &&
+                      !config_t::template exists<align_cfg::result<with_front_coordinate_type>>() &&
+                      !config_t::template exists<align_cfg::result<with_alignment_type>>(),
+                      "The anti-diagonal alignment supports only the score computation yet.");
+
+        using std::get;
+        auto const & scheme = params.scoring;
+        auto const & gaps = params.gap;
+
+        // Probe the simple scoring scheme for the match and mismatch score.
+        score_t const match_score =
+            scheme.score(assign_rank(alphabet1_t{}, 0), assign_rank(alphabet2_t{}, 0));
+        score_t const mismatch_score =
+            scheme.score(assign_rank(alphabet1_t{}, 0), assign_rank(alphabet2_t{}, 1));
+
+        score_t const gap_extend = gaps.get_gap_score();
+        score_t const gap_open = gaps.get_gap_open_score() + gap_extend;
+
+        // Convert both sequences into their rank representation; the second one in reverse order, such that
+        // the substitution scores along one anti-diagonal can be read with ascending memory accesses.
+        std::vector<score_t> first_ranks{};
+        for (auto const & symbol : first_range)
+            first_ranks.push_back(static_cast<score_t>(to_rank(symbol)));
+
+        std::vector<score_t> second_ranks_reversed{};
+        for (auto const & symbol : second_range)
+            second_ranks_reversed.push_back(static_cast<score_t>(to_rank(symbol)));
+        std::reverse(second_ranks_reversed.begin(), second_ranks_reversed.end());
+
+        result_value_t res{};
+        res.score = compute(first_ranks, second_ranks_reversed, match_score, mismatch_score, gap_open, gap_extend);
+        return alignment_result{res};
+    }
+
+private:
+    /*!\brief Computes the global alignment score over the anti-diagonals of the alignment matrix.
+     * \param[in] first_ranks           The rank representation of the first sequence.
+     * \param[in] second_ranks_reversed The reversed rank representation of the second sequence.
+     * \param[in] match_score           The score of two matching symbols.
+     * \param[in] mismatch_score        The score of two mismatching symbols.
+     * \param[in] gap_open              The score of the first gap symbol (open + extension).
+     * \param[in] gap_extend            The score of every further gap symbol.
+     * \returns The score of the global alignment.
+     *
+     * \details
+     *
+     * The buffers hold one entry per position `i` in the first sequence; the corresponding position in the
+     * second sequence follows implicitly from the index of the current anti-diagonal as `j = diagonal - i`.
+     * Three buffers rotate over the anti-diagonals `diagonal - 2`, `diagonal - 1` and `diagonal`.
+     */
+    score_t compute(std::vector<score_t> const & first_ranks,
+                    std::vector<score_t> const & second_ranks_reversed,
+                    score_t const match_score,
+                    score_t const mismatch_score,
+                    score_t const gap_open,
+                    score_t const gap_extend) const
+    {
+        size_t const dimension_first = first_ranks.size();    // m
+        size_t const dimension_second = second_ranks_reversed.size();  // n
+
+        if (dimension_first == 0)
+            return (dimension_second == 0) ? 0 : gap_open + static_cast<score_t>(dimension_second - 1) * gap_extend;
+        if (dimension_second == 0)
+            return gap_open + static_cast<score_t>(dimension_first - 1) * gap_extend;
+
+        // One entry per position in the first sequence plus the origin column.
+        std::vector<std::vector<score_t>> optimal(3, std::vector<score_t>(dimension_first + 1, infinity));
+        std::vector<std::vector<score_t>> horizontal(3, std::vector<score_t>(dimension_first + 1, infinity));
+        std::vector<std::vector<score_t>> vertical(3, std::vector<score_t>(dimension_first + 1, infinity));
+
+        optimal[0][0] = 0;  // The origin cell on anti-diagonal 0.
+
+        simd_score_t const gap_open_simd = fill<simd_score_t>(gap_open);
+        simd_score_t const gap_extend_simd = fill<simd_score_t>(gap_extend);
+        simd_score_t const match_simd = fill<simd_score_t>(match_score);
+        simd_score_t const mismatch_simd = fill<simd_score_t>(mismatch_score);
+
+        for (size_t diagonal = 1; diagonal <= dimension_first + dimension_second; ++diagonal)
+        {
+            auto & current_optimal = optimal[diagonal % 3];
+            auto & current_horizontal = horizontal[diagonal % 3];
+            auto & current_vertical = vertical[diagonal % 3];
+            auto const & previous_optimal = optimal[(diagonal + 2) % 3];
+            auto const & previous_horizontal = horizontal[(diagonal + 2) % 3];
+            auto const & previous_vertical = vertical[(diagonal + 2) % 3];
+            auto const & diagonal_optimal = optimal[(diagonal + 1) % 3];
+
+            // The valid cell range on this anti-diagonal: i in [low, high] with j = diagonal - i.
+            size_t const low = (diagonal > dimension_second) ? diagonal - dimension_second : 0;
+            size_t const high = std::min(diagonal, dimension_first);
+
+            size_t interior_low = low;
+
+            // Cells on the matrix border are initialised with the gap costs.
+            if (low == 0)  // Cell (0, diagonal) in the first row.
+            {
+                current_optimal[0] = gap_open + static_cast<score_t>(diagonal - 1) * gap_extend;
+                current_horizontal[0] = current_optimal[0];
+                current_vertical[0] = infinity;
+                interior_low = 1;
+            }
+
+            size_t interior_high = high;
+            if (high == diagonal)  // Cell (diagonal, 0) in the first column.
+            {
+                current_optimal[high] = gap_open + static_cast<score_t>(diagonal - 1) * gap_extend;
+                current_vertical[high] = current_optimal[high];
+                current_horizontal[high] = infinity;
+                interior_high = high - 1;
+            }
+
+            // Compute the interior cells in simd chunks; the scalar epilogue handles the remainder.
+            size_t index = interior_low;
+            // The substitution score of cell (i, j) compares first_ranks[i - 1] with the reversed second
+            // sequence at position (dimension_second - diagonal) + i.
+            auto const rank_offset = static_cast<std::ptrdiff_t>(dimension_second) -
+                                     static_cast<std::ptrdiff_t>(diagonal);
+
+            for (; index + simd_length <= interior_high + 1; index += simd_length)
+            {
+                simd_score_t const diag_score = load(diagonal_optimal.data() + index - 1);
+                simd_score_t const above_optimal = load(previous_optimal.data() + index);
+                simd_score_t const above_horizontal = load(previous_horizontal.data() + index);
+                simd_score_t const left_optimal = load(previous_optimal.data() + index - 1);
+                simd_score_t const left_vertical = load(previous_vertical.data() + index - 1);
+
+                simd_score_t const ranks1 = load(first_ranks.data() + index - 1);
+                simd_score_t const ranks2 = load(second_ranks_reversed.data() + rank_offset + index);
+
+                auto const is_match = (ranks1 == ranks2);
+                simd_score_t const substitution =
+                    (match_simd & reinterpret_cast<simd_score_t const &>(is_match)) |
+                    (mismatch_simd & ~reinterpret_cast<simd_score_t const &>(is_match));
+
+                simd_score_t const horizontal_score = max(above_optimal + gap_open_simd,
+                                                          above_horizontal + gap_extend_simd);
+                simd_score_t const vertical_score = max(left_optimal + gap_open_simd,
+                                                        left_vertical + gap_extend_simd);
+                simd_score_t const best = max(diag_score + substitution,
+                                              max(horizontal_score, vertical_score));
+
+                store(current_optimal.data() + index, best);
+                store(current_horizontal.data() + index, horizontal_score);
+                store(current_vertical.data() + index, vertical_score);
+            }
+
+            for (; index <= interior_high; ++index)
+            {
+                score_t const substitution = (first_ranks[index - 1] ==
+                                              second_ranks_reversed[rank_offset + index]) ? match_score
+                                                                                          : mismatch_score;
+                score_t const horizontal_score = std::max(previous_optimal[index] + gap_open,
+                                                          previous_horizontal[index] + gap_extend);
+                score_t const vertical_score = std::max(previous_optimal[index - 1] + gap_open,
+                                                        previous_vertical[index - 1] + gap_extend);
+                current_optimal[index] = std::max(diagonal_optimal[index - 1] + substitution,
+                                                  std::max(horizontal_score, vertical_score));
+                current_horizontal[index] = horizontal_score;
+                current_vertical[index] = vertical_score;
+            }
+        }
+
+        return optimal[(dimension_first + dimension_second) % 3][dimension_first];
+    }
+
+    //!\brief Loads a simd vector from a possibly unaligned memory position.
+    static simd_score_t load(score_t const * const position)
+    {
+        simd_score_t result;
+        std::memcpy(&result, position, sizeof(simd_score_t));
+        return result;
+    }
+
+    //!\brief Stores a simd vector to a possibly unaligned memory position.
+    static void store(score_t * const position, simd_score_t const & value)
+    {
+        std::memcpy(position, &value, sizeof(simd_score_t));
+    }
+
+    //!\brief The configuration values resolved once into a flattened block stored by value.
+    alignment_parameter_block_t<config_t> params{};
+};
+
+} // namespace seqan3::detail
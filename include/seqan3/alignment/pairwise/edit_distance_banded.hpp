@@ -0,0 +1,386 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Contains a pairwise alignment algorithm for edit distance with a band.
+ * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/matrix/alignment_coordinate.hpp>
+#include <seqan3/alignment/pairwise/align_result_selector.hpp>
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_unbanded.hpp>
+#include <seqan3/core/algorithm/configuration.hpp>
+#include <seqan3/range/shortcuts.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief This calculates a global alignment using the edit distance and a band.
+ * \ingroup pairwise_alignment
+ * \tparam database_t     \copydoc pairwise_alignment_edit_distance_banded::database_type
+ * \tparam query_t        \copydoc pairwise_alignment_edit_distance_banded::query_type
+ * \tparam align_config_t The type of the alignment config.
+ *
+ * \details
+ *
+ * The algorithm mirrors seqan3::detail::pairwise_alignment_edit_distance_unbanded but restricts the
+ * computation per column to the machine words that overlap the configured seqan3::static_band. The words
+ * below the band only enter the computation once the lower band boundary reaches them; until then they hold
+ * the initial vertical delta `+1` for each of their cells, i.e. the cells below the band are treated as if
+ * they were only reachable with vertical gaps from the band boundary above. The words above the band are
+ * frozen once the upper band boundary has passed them; the carry injected at the first computed word then
+ * mimics the top matrix row, i.e. the cells above the band are treated as if they were only reachable with
+ * horizontal gaps from the band boundary below. Hence the band is effectively expanded to the enclosing
+ * machine word boundaries, as usual for banded bit-parallel implementations.
+ *
+ * The band must cover the origin and the sink of the alignment matrix; otherwise no global alignment exists
+ * within the band and a seqan3::invalid_alignment_configuration is thrown.
+ */
+template <std::ranges::ViewableRange database_t,
+          std::ranges::ViewableRange query_t,
+          typename align_config_t,
+          edit_distance_trait_concept traits_t = default_edit_distance_trait_type>
+class pairwise_alignment_edit_distance_banded
+{
+    //!\brief The horizontal/database sequence.
+    database_t database;
+    //!\brief The vertical/query sequence.
+    query_t query;
+    //!\brief The configuration.
+    align_config_t config;
+
+public:
+    //!\brief The type of one machine word.
+    using word_type = typename std::remove_reference_t<traits_t>::word_type;
+    //!\brief The type of the score.
+    using score_type = int;
+    //!\brief The type of the database sequence.
+    using database_type = std::remove_reference_t<database_t>;
+    //!\brief The type of the query sequence.
+    using query_type = std::remove_reference_t<query_t>;
+
+    //!\brief The size of one machine word.
+    static constexpr uint8_t word_size = sizeof(word_type) * 8;
+
+private:
+    //!\brief The alphabet type of the query sequence.
+    using query_alphabet_type = std::remove_reference_t<reference_t<query_type>>;
+
+    //!\brief How to pre-initialize hp.
+    static constexpr word_type hp0 = 1; // Only global alignments are supported within a band.
+
+    static_assert(8 * sizeof(word_type) <= 64, "we assume at most uint64_t as word_type");
+
+    //!\brief The score of the currently tracked cell.
+    score_type _score{};
+    //!\brief The mask with a bit set at the position of the currently tracked cell.
+    word_type score_mask{0};
+    //!\brief The mask with a bit set at the position of the last row.
+    word_type last_score_mask{0};
+    //!\brief The machine words which stores the positive vertical differences.
+    std::vector<word_type> vp{};
+    //!\brief The machine words which stores the negative vertical differences.
+    std::vector<word_type> vn{};
+    //!\brief The machine words which translate a letter of the query into a bit mask.
+    //!\details Each bit position which is true (= 1) corresponds to a match of a letter in the query at this position.
+    std::vector<word_type> bit_masks{};
+    //!\brief The lower diagonal of the band; diagonals are counted as `column - row`.
+    int64_t band_lower{};
+    //!\brief The upper diagonal of the band; diagonals are counted as `column - row`.
+    int64_t band_upper{};
+    //!\brief The index of the deepest word computed in the current column.
+    size_t computed_block{0};
+
+    //!\brief One compute step in one column.
+    template <bool with_overflow_check>
+    void compute_step(word_type b, word_type & hp, word_type & hn, word_type & vp, word_type & vn, word_type & carry_d0, word_type & carry_hp, word_type & carry_hn)
+    {
+        word_type x, d0, t;
+
+        x = b | vn;
+        t = vp + (x & vp) + (with_overflow_check ? carry_d0 : 0);
+
+        d0 = (t ^ vp) | x;
+        hn = vp & d0;
+        hp = vn | ~(vp | d0);
+
+        if constexpr(with_overflow_check)
+            carry_d0 = (carry_d0 != (word_type)0) ? t <= vp : t < vp;
+
+        x = (hp << 1) | (with_overflow_check ? carry_hp : hp0);
+        vn = x & d0;
+        vp = (hn << 1) | ~(x | d0) | (with_overflow_check ? carry_hn : 0);
+
+        if constexpr(with_overflow_check)
+        {
+            carry_hp = hp >> (word_size - 1);
+            carry_hn = hn >> (word_size - 1);
+        }
+    }
+
+    //!\brief Increase or decrease the score.
+    void advance_score(word_type P, word_type N, word_type mask)
+    {
+        if ((P & mask) != (word_type)0)
+            _score++;
+        else if ((N & mask) != (word_type)0)
+            _score--;
+    }
+
+    //!\brief Returns the index of the deepest word overlapping the band in the given column.
+    size_t target_block(size_t const column) const noexcept
+    {
+        // The lowest cell inside the band of the DP column `column + 1` lies in the row `column + 1 - band_lower`,
+        // which corresponds to the query position `column - band_lower` (band_lower is never positive here).
+        size_t const lowest_query_position = static_cast<size_t>(static_cast<int64_t>(column) - band_lower);
+        return std::min<size_t>(vp.size() - 1, lowest_query_position / word_size);
+    }
+
+    //!\brief Returns the index of the first word overlapping the band in the given column.
+    size_t first_block(size_t const column) const noexcept
+    {
+        // The highest cell inside the band of the DP column `column + 1` lies in the row `column + 1 - band_upper`,
+        // which corresponds to the query position `column - band_upper`; the words above it are frozen.
+        int64_t const highest_query_position = static_cast<int64_t>(column) - band_upper;
+        if (highest_query_position <= 0)
+            return 0u;
+        return std::min<size_t>(vp.size() - 1, static_cast<size_t>(highest_query_position) / word_size);
+    }
+
+    //!\brief Returns the row of the cell tracked by the score mask when the given word is the deepest one.
+    score_type tracked_row(size_t const block) const noexcept
+    {
+        return std::min<score_type>(query.size(), (block + 1) * word_size);
+    }
+
+    //!\brief Moves the tracked cell down to the last row of the deepest word overlapping the band.
+    void grow_to(size_t const block)
+    {
+        // The newly entering words still hold the initial vertical deltas `+1`, hence the score of the new
+        // tracked cell is the score of the old one plus the number of rows in between.
+        _score += tracked_row(block) - tracked_row(computed_block);
+        computed_block = block;
+        score_mask = (computed_block == vp.size() - 1) ? last_score_mask : (word_type)1 << (word_size - 1);
+    }
+
+    //!\brief Compute the alignment.
+    void _compute()
+    {
+        size_t column = 0;
+        for (auto database_it = ranges::begin(database); database_it != ranges::end(database); ++database_it, ++column)
+        {
+            if (size_t const block = target_block(column); block > computed_block)
+                grow_to(block);
+
+            word_type hp{}, hn{};
+            // The carries injected at the first computed word emulate the top matrix row respectively the
+            // frozen band boundary above it; both increase by one with every column.
+            word_type carry_d0{0}, carry_hp{hp0}, carry_hn{0};
+            size_t block_offset = vp.size() * to_rank((query_alphabet_type) *database_it);
+
+            // computing the words overlapping the band, carries between words following one another are stored
+            for (size_t current_block = first_block(column); current_block <= computed_block; current_block++)
+            {
+                word_type b = bit_masks[block_offset + current_block];
+                compute_step<true>(b, hp, hn, vp[current_block], vn[current_block], carry_d0, carry_hp, carry_hn);
+            }
+            advance_score(hp, hn, score_mask);
+        }
+    }
+
+public:
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    //!\brief The class template parameter may resolve to an lvalue reference which prohibits default constructibility.
+    pairwise_alignment_edit_distance_banded() = delete;
+    //!\brief Defaulted
+    pairwise_alignment_edit_distance_banded(pairwise_alignment_edit_distance_banded const &) = default;
+    pairwise_alignment_edit_distance_banded(pairwise_alignment_edit_distance_banded &&) = default; //!< Defaulted
+    //!\brief Defaulted
+    pairwise_alignment_edit_distance_banded & operator=(pairwise_alignment_edit_distance_banded const &) = default;
+    //!\brief Defaulted
+    pairwise_alignment_edit_distance_banded & operator=(pairwise_alignment_edit_distance_banded &&) = default;
+    ~pairwise_alignment_edit_distance_banded() = default;                                          //!< Defaulted
+
+    /*!\brief Constructor
+     * \param[in] _database \copydoc database
+     * \param[in] _query    \copydoc query
+     * \param[in] _config   \copydoc config
+     * \param[in] _traits   The traits object. Only the type information will be used.
+     *
+     * \throws seqan3::invalid_alignment_configuration if the band does not cover the origin or the sink of
+     *         the alignment matrix.
+     */
+    pairwise_alignment_edit_distance_banded(database_t && _database,
+                                            query_t && _query,
+                                            align_config_t _config,
+                                            traits_t const & SEQAN3_DOXYGEN_ONLY(_traits) = traits_t{}) :
+        database{std::forward<database_t>(_database)},
+        query{std::forward<query_t>(_query)},
+        config{std::forward<align_config_t>(_config)}
+    {
+        static constexpr size_t alphabet_size = alphabet_size_v<query_alphabet_type>;
+
+        static_band const & band = get<align_cfg::band>(config).value;
+        int64_t const sink_diagonal = static_cast<int64_t>(database.size()) - static_cast<int64_t>(query.size());
+
+        if (band.lower_bound > 0 || band.upper_bound < 0)
+            throw invalid_alignment_configuration{"The band does not cover the origin of the alignment matrix."};
+
+        if (band.lower_bound > sink_diagonal || band.upper_bound < sink_diagonal)
+            throw invalid_alignment_configuration{"The band does not cover the sink of the alignment matrix."};
+
+        band_lower = band.lower_bound;
+        band_upper = band.upper_bound;
+
+        size_t block_count = (query.size() - 1 + word_size) / word_size;
+        last_score_mask = (word_type)1 << ((query.size() - 1 + word_size) % word_size);
+
+        vp.resize(block_count, static_cast<word_type>(~0));
+        vn.resize(block_count, 0);
+        bit_masks.resize((alphabet_size + 1) * block_count, 0);
+
+        // encoding the letters as bit-vectors
+        for (size_t j = 0; j < query.size(); j++)
+        {
+            size_t i = block_count * to_rank(query[j]) + j / word_size;
+            bit_masks[i] |= (word_type)1 << (j % word_size);
+        }
+
+        // Initially only the words overlapping the band in the first column are tracked.
+        computed_block = target_block(0u);
+        score_mask = (computed_block == block_count - 1) ? last_score_mask : (word_type)1 << (word_size - 1);
+        _score = tracked_row(computed_block);
+    }
+    //!\}
+
+    /*!\brief Generic invocable interface.
+     * \param[in,out] res The alignment result to fill.
+     * \returns A reference to the filled alignment result.
+     */
+    template <typename result_value_type>
+    alignment_result<result_value_type> & operator()(alignment_result<result_value_type> & res)
+    {
+        _compute();
+        result_value_type res_vt{};
+        if constexpr (!std::is_same_v<decltype(res_vt.score), std::nullopt_t *>)
+        {
+            res_vt.score = score();
+        }
+
+        if constexpr (!std::is_same_v<decltype(res_vt.back_coordinate), std::nullopt_t *>)
+        {
+            res_vt.back_coordinate = back_coordinate();
+        }
+
+        static_assert(std::is_same_v<decltype(res_vt.front_coordinate), std::nullopt_t *> &&
+                      std::is_same_v<decltype(res_vt.alignment), std::nullopt_t *>,
+                      "The banded edit distance does not support the begin position or trace computation.");
+
+        res = alignment_result<result_value_type>{res_vt};
+        return res;
+    }
+
+    //!\brief Return the score of the alignment.
+    score_type score() const noexcept
+    {
+        return -_score;
+    }
+
+    //!\brief Return the end position of the alignment
+    alignment_coordinate back_coordinate() const noexcept
+    {
+        return {column_index_type{database.size() - 1}, row_index_type{query.size() - 1}};
+    }
+};
+
+/*!\name Type deduction guides
+ * \relates seqan3::detail::pairwise_alignment_edit_distance_banded
+ * \{
+ */
+template<typename database_t, typename query_t, typename config_t>
+pairwise_alignment_edit_distance_banded(database_t && database, query_t && query, config_t config)
+    -> pairwise_alignment_edit_distance_banded<database_t, query_t, config_t>;
+
+template<typename database_t, typename query_t, typename config_t, typename traits_t>
+pairwise_alignment_edit_distance_banded(database_t && database, query_t && query, config_t config, traits_t)
+    -> pairwise_alignment_edit_distance_banded<database_t, query_t, config_t, traits_t>;
+//!\}
+
+// ----------------------------------------------------------------------------
+// edit_distance_banded_wrapper
+// ----------------------------------------------------------------------------
+
+/*!\brief This type wraps the call to the seqan3::detail::pairwise_alignment_edit_distance_banded algorithm.
+ * \implements std::Invocable
+ * \tparam config_t The configuration type.
+ *
+ * \details
+ *
+ * This wrapper class is used to decouple the sequence types from the algorithm class type, analogous to
+ * seqan3::detail::edit_distance_wrapper for the unbanded edit distance.
+ */
+template <typename config_t, typename traits_t = default_edit_distance_trait_type>
+class edit_distance_banded_wrapper
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr edit_distance_banded_wrapper() = default;                                                 //!< Defaulted
+    constexpr edit_distance_banded_wrapper(edit_distance_banded_wrapper const &) = default;             //!< Defaulted
+    constexpr edit_distance_banded_wrapper(edit_distance_banded_wrapper &&) = default;                  //!< Defaulted
+    constexpr edit_distance_banded_wrapper & operator=(edit_distance_banded_wrapper const &) = default; //!< Defaulted
+    constexpr edit_distance_banded_wrapper & operator=(edit_distance_banded_wrapper &&) = default;      //!< Defaulted
+    ~edit_distance_banded_wrapper() = default;                                                          //!< Defaulted
+
+    /*!\brief Constructs the wrapper with the passed configuration.
+     * \param cfg The configuration to be passed to the algorithm.
+     *
+     * \details
+     *
+     * The configuration is copied once to the heap during construction and maintained by a std::shared_ptr.
+     */
+    constexpr edit_distance_banded_wrapper(config_t const & cfg) : cfg_ptr{new config_t(cfg)}
+    {}
+    //!}
+
+    /*!\brief Invokes the actual alignment computation given two sequences.
+     * \tparam    first_range_t  The type of the first sequence (or packed sequences); must model std::ForwardRange.
+     * \tparam    second_range_t The type of the second sequence (or packed sequences); must model std::ForwardRange.
+     * \param[in] first_range    The first sequence (or packed sequences).
+     * \param[in] second_range   The second sequence (or packed sequences).
+     */
+    template <std::ranges::ForwardRange first_range_t, std::ranges::ForwardRange second_range_t>
+    constexpr auto operator()(first_range_t && first_range, second_range_t && second_range)
+    {
+        using result_t = typename detail::align_result_selector<remove_cvref_t<first_range_t>,
+                                                                remove_cvref_t<second_range_t>,
+                                                                remove_cvref_t<config_t>>::type;
+
+        pairwise_alignment_edit_distance_banded algo{first_range, second_range, *cfg_ptr, traits_t{}};
+        alignment_result<result_t> res{};
+        return algo(res);
+    }
+
+private:
+    //!\brief The alignment configuration stored on the heap.
+    std::shared_ptr<remove_cvref_t<config_t>> cfg_ptr{};
+};
+
+} // namespace seqan3::detail
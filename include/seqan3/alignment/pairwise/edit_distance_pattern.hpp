@@ -0,0 +1,417 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Contains pattern-preprocessed edit distance computation over many texts.
+ * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <stdexcept>
+#include <vector>
+
+#include <seqan3/alignment/pairwise/edit_distance_unbanded.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/metafunction/range.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief A query preprocessed for repeated edit distance computation against many texts.
+ * \ingroup pairwise_alignment
+ * \tparam alphabet_t The alphabet of the query; must model seqan3::Semialphabet.
+ * \tparam traits_t   The traits type, see seqan3::detail::default_edit_distance_trait_type.
+ *
+ * \details
+ *
+ * seqan3::detail::pairwise_alignment_edit_distance_unbanded derives the Myers bit masks of the query
+ * anew for every pair of sequences. When one read is verified against dozens of candidate regions,
+ * the masks of the read are identical each time and rebuilding them dominates the cost for short
+ * texts. This class builds the bit masks once during construction; afterwards any number of texts
+ * can be streamed through score(), which only allocates the per-column state.
+ *
+ * The traits type controls whether the distance is computed globally (the default) or semi-globally
+ * (free end gaps in the text, i.e. the best occurrence of the query in the text).
+ */
+template <Semialphabet alphabet_t, edit_distance_trait_concept traits_t = default_edit_distance_trait_type>
+class edit_distance_pattern
+{
+public:
+    //!\brief The type of one machine word.
+    using word_type = typename std::remove_reference_t<traits_t>::word_type;
+    //!\brief The type of the score.
+    using score_type = int;
+
+    //!\brief The size of one machine word.
+    static constexpr uint8_t word_size = sizeof(word_type) * 8;
+
+private:
+    //!\brief Whether the distance is computed semi-globally or not.
+    static constexpr bool is_semi_global = traits_t::is_semi_global_type::value;
+    //!\brief Whether the distance is computed globally or not.
+    static constexpr bool is_global = !is_semi_global;
+    //!\brief How to pre-initialize the horizontal carry.
+    static constexpr word_type hp0 = is_global ? 1 : 0;
+
+    static_assert(8 * sizeof(word_type) <= 64, "we assume at most uint64_t as word_type");
+
+    //!\brief The length of the query.
+    size_t query_size{};
+    //!\brief The number of machine words needed per column.
+    size_t block_count{};
+    //!\brief A mask with a bit set on the position of the last row.
+    word_type last_score_mask{};
+    //!\copydoc pairwise_alignment_edit_distance_unbanded::bit_masks
+    std::vector<word_type> bit_masks{};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    edit_distance_pattern() = default;                                          //!< Defaulted
+    edit_distance_pattern(edit_distance_pattern const &) = default;             //!< Defaulted
+    edit_distance_pattern(edit_distance_pattern &&) = default;                  //!< Defaulted
+    edit_distance_pattern & operator=(edit_distance_pattern const &) = default; //!< Defaulted
+    edit_distance_pattern & operator=(edit_distance_pattern &&) = default;      //!< Defaulted
+    ~edit_distance_pattern() = default;                                         //!< Defaulted
+
+    /*!\brief Construct the pattern from a query, building the bit masks once.
+     * \tparam    query_t The type of the query; must model std::ranges::ForwardRange over #alphabet_t.
+     * \param[in] query   The query sequence; it is not stored, only its bit masks are.
+     * \throws std::invalid_argument If the query is empty.
+     */
+    template <std::ranges::ForwardRange query_t>
+    //!\cond
+        requires std::ConvertibleTo<value_type_t<remove_cvref_t<query_t>>, alphabet_t>
+    //!\endcond
+    explicit edit_distance_pattern(query_t && query)
+        : query_size{static_cast<size_t>(std::ranges::distance(query))}
+    {
+        static constexpr size_t alphabet_size = alphabet_size_v<alphabet_t>;
+
+        if (query_size == 0u)
+            throw std::invalid_argument{"The query of an edit_distance_pattern must not be empty."};
+
+        block_count = (query_size - 1 + word_size) / word_size;
+        last_score_mask = (word_type)1 << ((query_size - 1) % word_size);
+
+        bit_masks.resize((alphabet_size + 1) * block_count, 0);
+
+        // encoding the letters as bit-vectors
+        size_t j = 0;
+        for (auto && letter : query)
+        {
+            size_t i = block_count * to_rank(static_cast<alphabet_t>(letter)) + j / word_size;
+            bit_masks[i] |= (word_type)1 << (j % word_size);
+            ++j;
+        }
+    }
+    //!\}
+
+    //!\brief The length of the query.
+    size_t size() const noexcept
+    {
+        return query_size;
+    }
+
+    /*!\brief Compute the score of the query against a text.
+     * \tparam    database_t The type of the text; must model std::ranges::ForwardRange.
+     * \param[in] database   The text to stream through the pattern.
+     * \returns The score of the alignment, i.e. the negative edit distance (for semi-global traits
+     *          the negative distance of the best occurrence of the query in the text).
+     *
+     * \details
+     *
+     * Can be called any number of times; the pattern is not modified. Only the per-column state
+     * (two machine words per block) is allocated per call.
+     */
+    template <std::ranges::ForwardRange database_t>
+    score_type score(database_t && database) const
+    {
+        std::vector<word_type> vp(block_count, static_cast<word_type>(~0));
+        std::vector<word_type> vn(block_count, 0);
+
+        score_type _score = query_size;
+        score_type _best_score = _score;
+
+        for (auto && letter : database)
+        {
+            word_type hn{}, hp{};
+            word_type carry_d0{0}, carry_hp{hp0}, carry_hn{0};
+            size_t const block_offset = block_count * to_rank(static_cast<alphabet_t>(letter));
+
+            // computing all blocks, carries between blocks following one another are stored
+            for (size_t current_block = 0; current_block < block_count; current_block++)
+            {
+                word_type b = bit_masks[block_offset + current_block];
+                compute_step(b, hp, hn, vp[current_block], vn[current_block], carry_d0, carry_hp, carry_hn);
+            }
+
+            if ((hp & last_score_mask) != (word_type)0)
+                _score++;
+            else if ((hn & last_score_mask) != (word_type)0)
+                _score--;
+
+            if constexpr(is_semi_global)
+                _best_score = std::min(_best_score, _score);
+        }
+
+        if constexpr(is_global)
+            _best_score = _score;
+
+        return -_best_score;
+    }
+
+private:
+    //!\copydoc pairwise_alignment_edit_distance_unbanded::compute_step
+    static void compute_step(word_type b, word_type & hp, word_type & hn, word_type & vp, word_type & vn,
+                             word_type & carry_d0, word_type & carry_hp, word_type & carry_hn)
+    {
+        word_type x, d0, t;
+
+        x = b | vn;
+        t = vp + (x & vp) + carry_d0;
+
+        d0 = (t ^ vp) | x;
+        hn = vp & d0;
+        hp = vn | ~(vp | d0);
+
+        carry_d0 = (carry_d0 != (word_type)0) ? t <= vp : t < vp;
+
+        x = (hp << 1) | carry_hp;
+        vn = x & d0;
+        vp = (hn << 1) | ~(x | d0) | carry_hn;
+
+        carry_hp = hp >> (word_size - 1);
+        carry_hn = hn >> (word_size - 1);
+    }
+};
+
+/*!\name Type deduction guides
+ * \relates seqan3::detail::edit_distance_pattern
+ * \{
+ */
+template <std::ranges::ForwardRange query_t>
+edit_distance_pattern(query_t &&) -> edit_distance_pattern<value_type_t<remove_cvref_t<query_t>>>;
+
+template <std::ranges::ForwardRange query_t, typename traits_t>
+edit_distance_pattern(query_t &&, traits_t) -> edit_distance_pattern<value_type_t<remove_cvref_t<query_t>>, traits_t>;
+//!\}
+
+/*!\brief A batch of equally long queries packed into machine words for word-parallel edit distance.
+ * \ingroup pairwise_alignment
+ * \tparam alphabet_t The alphabet of the queries; must model seqan3::Semialphabet.
+ * \tparam traits_t   The traits type, see seqan3::detail::default_edit_distance_trait_type.
+ *
+ * \details
+ *
+ * Short queries waste almost a full machine word per column in the plain Myers algorithm. This class
+ * packs several queries of equal length `m` into one word: each query occupies a field of `m + 1`
+ * bits, where the extra bit is a guard bit that confines the carry of the addition in the Myers
+ * update to its field. A word thus verifies `word size / (m + 1)` queries in parallel, e.g. eight
+ * 7-mers per 64 bit word; longer batches simply span multiple independent words.
+ *
+ * The guard bit of each field is kept at zero in the vertical difference words and in the match
+ * masks, so the addition can carry into the guard bit but never beyond it; all other operations are
+ * bitwise and cannot cross fields either. The per-field recurrence is therefore exactly the scalar
+ * Myers recurrence of the corresponding query.
+ *
+ * Only global distances are supported, which is the verification use case for read batches.
+ */
+template <Semialphabet alphabet_t, edit_distance_trait_concept traits_t = default_edit_distance_trait_type>
+class edit_distance_multi_pattern
+{
+public:
+    //!\brief The type of one machine word.
+    using word_type = typename std::remove_reference_t<traits_t>::word_type;
+    //!\brief The type of the score.
+    using score_type = int;
+
+    //!\brief The size of one machine word.
+    static constexpr uint8_t word_size = sizeof(word_type) * 8;
+
+private:
+    static_assert(!traits_t::is_semi_global_type::value,
+                  "edit_distance_multi_pattern only supports global distances.");
+    static_assert(8 * sizeof(word_type) <= 64, "we assume at most uint64_t as word_type");
+
+    //!\brief The length of each query.
+    size_t pattern_size{};
+    //!\brief The number of packed queries.
+    size_t pattern_count{};
+    //!\brief The width of one field (the length of a query plus its guard bit).
+    size_t field_width{};
+    //!\brief The number of queries packed into one word.
+    size_t patterns_per_word{};
+    //!\brief The number of machine words needed for all queries.
+    size_t word_count{};
+    //!\brief A mask with the query bits of every field set (all bits except the guard bits).
+    word_type field_mask{};
+    //!\brief A mask with the first bit of every field set (the horizontal carry-in of each query).
+    word_type hp0_mask{};
+    //!\brief A mask with the last-row bit of every field set.
+    word_type last_row_mask{};
+    //!\brief The match masks (#word_count words per alphabet rank, guard bits zero).
+    std::vector<word_type> bit_masks{};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    edit_distance_multi_pattern() = default;                                                //!< Defaulted
+    edit_distance_multi_pattern(edit_distance_multi_pattern const &) = default;             //!< Defaulted
+    edit_distance_multi_pattern(edit_distance_multi_pattern &&) = default;                  //!< Defaulted
+    edit_distance_multi_pattern & operator=(edit_distance_multi_pattern const &) = default; //!< Defaulted
+    edit_distance_multi_pattern & operator=(edit_distance_multi_pattern &&) = default;      //!< Defaulted
+    ~edit_distance_multi_pattern() = default;                                               //!< Defaulted
+
+    /*!\brief Construct the packed patterns from a batch of equally long queries.
+     * \tparam    queries_t The type of the batch; must model std::ranges::ForwardRange over
+     *                      std::ranges::ForwardRange over #alphabet_t.
+     * \param[in] queries   The query sequences; they are not stored, only their packed bit masks are.
+     * \throws std::invalid_argument If the batch is empty, a query is empty, the queries differ in
+     *         length, or a query does not fit into one machine word (length at most `word size - 1`).
+     */
+    template <std::ranges::ForwardRange queries_t>
+    //!\cond
+        requires std::ranges::ForwardRange<value_type_t<remove_cvref_t<queries_t>>> &&
+                 std::ConvertibleTo<value_type_t<value_type_t<remove_cvref_t<queries_t>>>, alphabet_t>
+    //!\endcond
+    explicit edit_distance_multi_pattern(queries_t && queries)
+    {
+        static constexpr size_t alphabet_size = alphabet_size_v<alphabet_t>;
+
+        pattern_count = static_cast<size_t>(std::ranges::distance(queries));
+        if (pattern_count == 0u)
+            throw std::invalid_argument{"The batch of an edit_distance_multi_pattern must not be empty."};
+
+        pattern_size = static_cast<size_t>(std::ranges::distance(*std::ranges::begin(queries)));
+        if (pattern_size == 0u)
+            throw std::invalid_argument{"The queries of an edit_distance_multi_pattern must not be empty."};
+
+        field_width = pattern_size + 1; // one guard bit per field
+        if (field_width > word_size)
+            throw std::invalid_argument{"The queries of an edit_distance_multi_pattern must be shorter than "
+                                        "one machine word."};
+
+        patterns_per_word = word_size / field_width;
+        word_count = (pattern_count + patterns_per_word - 1) / patterns_per_word;
+
+        word_type const single_field = (((word_type)1 << pattern_size) - 1);
+        for (size_t field = 0; field < patterns_per_word; ++field)
+        {
+            size_t const base = field * field_width;
+            field_mask |= single_field << base;
+            hp0_mask |= (word_type)1 << base;
+            last_row_mask |= (word_type)1 << (base + pattern_size - 1);
+        }
+
+        bit_masks.resize(alphabet_size * word_count, 0);
+
+        // encoding the letters of every query as bit-vectors within its field
+        size_t pattern = 0;
+        for (auto && query : queries)
+        {
+            if (static_cast<size_t>(std::ranges::distance(query)) != pattern_size)
+                throw std::invalid_argument{"The queries of an edit_distance_multi_pattern must all have the "
+                                            "same length."};
+
+            size_t const word = pattern / patterns_per_word;
+            size_t const base = (pattern % patterns_per_word) * field_width;
+
+            size_t j = 0;
+            for (auto && letter : query)
+            {
+                size_t i = word_count * to_rank(static_cast<alphabet_t>(letter)) + word;
+                bit_masks[i] |= (word_type)1 << (base + j);
+                ++j;
+            }
+            ++pattern;
+        }
+    }
+    //!\}
+
+    //!\brief The number of packed queries.
+    size_t size() const noexcept
+    {
+        return pattern_count;
+    }
+
+    /*!\brief Compute the score of every query against a text.
+     * \tparam    database_t The type of the text; must model std::ranges::ForwardRange.
+     * \param[in] database   The text to stream through the packed patterns.
+     * \returns The scores of the alignments, i.e. the negative edit distances, one per query in the
+     *          order the queries were given.
+     */
+    template <std::ranges::ForwardRange database_t>
+    std::vector<score_type> score(database_t && database) const
+    {
+        std::vector<score_type> scores(pattern_count, static_cast<score_type>(pattern_size));
+        std::vector<word_type> vp(word_count, field_mask); // every query bit one, guard bits zero
+        std::vector<word_type> vn(word_count, 0);
+
+        for (auto && letter : database)
+        {
+            size_t const offset = word_count * to_rank(static_cast<alphabet_t>(letter));
+
+            for (size_t word = 0; word < word_count; ++word)
+            {
+                word_type const b = bit_masks[offset + word];
+
+                // the Myers recurrence; the addition carries at most into the guard bit of its field,
+                // all other operations are bitwise, so the fields never interact
+                word_type x = b | vn[word];
+                word_type const t = vp[word] + (x & vp[word]);
+                word_type const d0 = ((t ^ vp[word]) | x) & field_mask;
+                word_type const hn = vp[word] & d0;
+                word_type const hp = (vn[word] | ~(vp[word] | d0)) & field_mask;
+
+                x = (hp << 1) | hp0_mask;
+                vn[word] = x & d0;
+                vp[word] = ((hn << 1) | ~(x | d0)) & field_mask;
+
+                // update the scores of the queries packed into this word
+                word_type const hp_last = hp & last_row_mask;
+                word_type const hn_last = hn & last_row_mask;
+
+                if ((hp_last | hn_last) != (word_type)0)
+                {
+                    size_t const first_pattern = word * patterns_per_word;
+                    size_t const last_pattern = std::min(first_pattern + patterns_per_word, pattern_count);
+
+                    for (size_t pattern = first_pattern; pattern < last_pattern; ++pattern)
+                    {
+                        word_type const bit = (word_type)1
+                                            << ((pattern - first_pattern) * field_width + pattern_size - 1);
+                        if ((hp_last & bit) != (word_type)0)
+                            scores[pattern]++;
+                        else if ((hn_last & bit) != (word_type)0)
+                            scores[pattern]--;
+                    }
+                }
+            }
+        }
+
+        for (score_type & s : scores)
+            s = -s;
+
+        return scores;
+    }
+};
+
+/*!\name Type deduction guides
+ * \relates seqan3::detail::edit_distance_multi_pattern
+ * \{
+ */
+template <std::ranges::ForwardRange queries_t>
+edit_distance_multi_pattern(queries_t &&)
+    -> edit_distance_multi_pattern<value_type_t<value_type_t<remove_cvref_t<queries_t>>>>;
+//!\}
+
+} // namespace seqan3::detail
@@ -307,6 +307,12 @@ private:
 
         if constexpr(is_semi_global)
         {
+            // If the Ukkonen trick moved the last active cell above the last row, the score does not refer to a
+            // cell of the last row and must not be tracked as the best score over the last row.
+            if constexpr(use_max_errors)
+                if (!((score_mask == last_score_mask) && (last_block == vp.size() - 1)))
+                    return;
+
             _best_score_col = (_score <= _best_score) ? database_it : _best_score_col;
             _best_score     = (_score <= _best_score) ? _score : _best_score;
         }
@@ -492,12 +498,15 @@ bool pairwise_alignment_edit_distance_unbanded<database_t, query_t, align_config
         advance_score(hp, hn, score_mask);
 
         if constexpr(use_max_errors)
-            if (_score <= max_errors && on_hit())
+        {
+            // updating the last active cell
+            if (update_last_active_cell())
             {
                 add_state();
                 ++database_it;
                 return true;
             }
+        }
 
         add_state();
         ++database_it;
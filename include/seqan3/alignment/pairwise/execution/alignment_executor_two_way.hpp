@@ -12,12 +12,17 @@
 
 #pragma once
 
+#include <algorithm>
 #include <functional>
-#include <optional>
+#include <future>
+#include <memory>
+#include <thread>
 #include <type_traits>
 
 #include <seqan3/alignment/pairwise/execution/alignment_range.hpp>
+#include <seqan3/alignment/pairwise/execution/execution_handler_parallel.hpp>
 #include <seqan3/alignment/pairwise/execution/execution_handler_sequential.hpp>
+#include <seqan3/alignment/pairwise/execution/result_arena.hpp>
 #include <seqan3/core/metafunction/range.hpp>
 #include <seqan3/range/shortcuts.hpp>
 #include <seqan3/range/view/single_pass_input.hpp>
@@ -26,22 +31,42 @@
 namespace seqan3::detail
 {
 
+/*!\brief Selects the buffering mode of the seqan3::detail::alignment_executor_two_way.
+ * \ingroup execution
+ */
+enum struct executor_buffering : uint8_t
+{
+    //!\brief The next chunk of results is computed synchronously on the consumer's thread.
+    single,
+    //!\brief The next chunk of results is prefetched in the background while the consumer processes the current one.
+    double_buffered
+};
+
 /*!\brief A two way executor for pairwise alignments.
  * \ingroup execution
  * \tparam resource_t            The underlying range of sequence pairs to be computed; must model
  *                               std::ranges::ViewableRange and std::ranges::InputRange.
  * \tparam alignment_algorithm_t The alignment algorithm to be invoked on each sequence pair.
  * \tparam execution_handler_t   The execution handler managing the execution of the alignments.
+ * \tparam buffering_mode        The buffering mode used to fill the result buffer; defaults to
+ *                               seqan3::detail::executor_buffering::single.
  *
  * \details
  *
  * This alignment executor provides an additional buffer over the computed alignments to allow
  * a two-way execution flow. The alignment results can then be accessed in an order-preserving manner using the
  * alignment_executor_two_way::bump() member function.
+ *
+ * If seqan3::detail::executor_buffering::double_buffered is selected, the executor maintains a second buffer which
+ * is filled asynchronously while the consumer processes the results of the first one. This overlaps the alignment
+ * computation with the downstream processing even if the sequential execution handler is used. While a prefetch is
+ * pending, the executor must neither be moved nor may the underlying resource be accessed;
+ * alignment_executor_two_way::bump() synchronises with the prefetch internally.
  */
 template <std::ranges::ViewableRange resource_t,
           typename alignment_algorithm_t,
-          typename execution_handler_t = execution_handler_sequential>
+          typename execution_handler_t = execution_handler_sequential,
+          executor_buffering buffering_mode = executor_buffering::single>
 //!\cond
     requires std::ranges::InputRange<resource_t> &&
              std::CopyConstructible<alignment_algorithm_t>
@@ -63,10 +88,10 @@ private:
      */
     //!\brief The result of invoking the alignment instance.
     using buffer_value_type = typename alignment_algorithm_t::result_type;
-    //!\brief The internal buffer.
-    using buffer_type       = std::vector<buffer_value_type>;
+    //!\brief The internal buffer; an arena whose slots are recycled across batches.
+    using buffer_type       = result_arena<buffer_value_type>;
     //!\brief The pointer type of the buffer.
-    using buffer_pointer    = std::ranges::iterator_t<buffer_type>;
+    using buffer_pointer    = typename buffer_type::iterator;
     //!\}
 
 public:
@@ -94,11 +119,21 @@ public:
     alignment_executor_two_way & operator=(alignment_executor_two_way && ) = default;    //!< Defaulted
     ~alignment_executor_two_way() = default;                                             //!< Defaulted
 
-    //!\brief Constructs this executor with the passed range of alignment instances.
+    /*!\brief Constructs this executor with the passed range of alignment instances.
+     * \param[in] resrc      The range of sequence pairs to compute.
+     * \param[in] fn         The alignment algorithm to invoke on each sequence pair.
+     * \param[in] handler    The execution handler managing the execution of the alignments.
+     * \param[in] chunk_size The number of pairs computed per underflow; `0` selects the automatic sizing based
+     *                       on the dimensions of the first sequence pair (see seqan3::align_cfg::chunk_size).
+     */
     alignment_executor_two_way(resource_t && resrc,
-                               alignment_algorithm_t fn) :
+                               alignment_algorithm_t fn,
+                               execution_handler_t handler = execution_handler_t{},
+                               size_t const chunk_size = 0) :
+        exec_handler{std::move(handler)},
         resource{std::forward<resource_t &&>(resrc)},
-        kernel{std::move(fn)}
+        kernel{std::move(fn)},
+        configured_chunk_size{chunk_size}
     {
         init_buffer();
     }
@@ -107,29 +142,34 @@ public:
     /*!\name Get area
      * \{
      */
-    /*!\brief Returns the current alignment result in the buffer and advances the buffer to the next position.
-     * \returns A std::optional that either contains a reference to the underlying value or is empty iff the
-     *          underlying resource has been completely consumed.
+    /*!\brief Returns a pointer to the current alignment result in the buffer and advances the buffer to the
+     *        next position.
+     * \returns A pointer to the result inside the recycled result arena, or `nullptr` iff the underlying
+     *          resource has been completely consumed.
      *
      * \details
      *
      * If there is no available input in the result buffer anymore, this function triggers an underflow to fill
      * the buffer with the next alignments.
      *
+     * The returned pointer refers into the seqan3::detail::result_arena owned by this executor. It remains
+     * valid until the batch is released, i.e. until bump() is called after the current batch has been
+     * consumed completely; a caller who needs the result beyond that point must move it out of the slot.
+     *
      * ### Exception
      *
      * Throws std::bad_function_call if the algorithm was not set.
      */
-    std::optional<value_type> bump()
+    value_type * bump()
     {
         if (gptr == buffer_pointer{} || in_avail() == 0)
         {
             if (underflow() == eof)
             {
-                return {std::nullopt};
+                return nullptr;
             }
         }
-        return {std::move(*gptr++)};
+        return std::addressof(*gptr++);
     }
 
     //!\brief Returns the remaining number of elements in the buffer, that are not read yet.
@@ -168,26 +208,82 @@ private:
         if (gptr < egptr)  // Case: buffer not completely consumed
             return in_avail();
 
-        if (is_eof())  // Case: reached end of resource.
-            return eof;
+        if constexpr (buffering_mode == executor_buffering::double_buffered)
+        {
+            // Wait for the chunk prefetched in the background; on the first underflow no prefetch was scheduled
+            // yet, so the buffer is filled synchronously.
+            size_t count = 0;
+            if (prefetch_future.valid())
+            {
+                count = collect_prefetched();
+            }
+            else
+            {
+                ensure_buffer_size();
+                count = fill_buffer(buffer);
+            }
+
+            if (count == 0)  // Case: reached end of resource.
+                return eof;
 
-        // Reset the get pointer.
-        setg(std::ranges::begin(buffer), std::ranges::end(buffer));
+            setg(std::ranges::begin(buffer), std::ranges::begin(buffer) + count);
 
-        // Apply the alignment execution.
-        // TODO: Adapt for async behavior for parallel execution handler.
+            // Compute the next chunk in the background while the consumer processes the current one.
+            if (!is_eof())
+                prefetch_future = std::async(std::launch::async, [this] () { return fill_buffer(prefetch_buffer); });
+
+            return in_avail();
+        }
+        else
+        {
+            if (is_eof())  // Case: reached end of resource.
+                return eof;
+
+            ensure_buffer_size();
+            size_t count = fill_buffer(buffer);
+
+            // Update the available get position if the buffer was consumed completely.
+            setg(std::ranges::begin(buffer), std::ranges::begin(buffer) + count);
+
+            return in_avail();
+        }
+    }
+
+    /*!\brief Fills the given buffer with new alignment results and returns the number of computed alignments.
+     * \param[in,out] buf The buffer to fill.
+     *
+     * \details
+     *
+     * Applies the alignment execution. An asynchronous execution handler does not process the jobs in
+     * order, hence every job writes its result to the buffer slot reserved for its invocation. Blocks until
+     * all submitted jobs have been processed.
+     */
+    size_t fill_buffer(buffer_type & buf)
+    {
+        size_t const capacity = buf.size();
         size_t count = 0;
         for (auto resource_iter = std::ranges::begin(resource);
-             count < in_avail() && !is_eof(); ++count, ++resource_iter, ++gptr)
+             count < capacity && !is_eof(); ++count, ++resource_iter)
         {
             auto && [first_seq, second_seq] = *resource_iter;
-            exec_handler.execute(kernel, first_seq, second_seq, [this](auto && res){ *gptr = std::move(res); });
+            buffer_pointer write_to = std::ranges::begin(buf) + count;
+            exec_handler.execute(kernel, first_seq, second_seq, [write_to](auto && res){ *write_to = std::move(res); });
         }
 
-        // Update the available get position if the buffer was consumed completely.
-        setg(std::ranges::begin(buffer), std::ranges::begin(buffer) + count);
+        // Wait until all submitted jobs have been processed.
+        exec_handler.wait();
+
+        return count;
+    }
+
+    //!\brief Waits for the pending prefetch and swaps the prefetched chunk into the get area.
+    size_t collect_prefetched()
+    {
+        assert(prefetch_future.valid());
 
-        return in_avail();
+        size_t count = prefetch_future.get();
+        std::swap(buffer, prefetch_buffer);
+        return count;
     }
     //!\}
 
@@ -198,14 +294,56 @@ private:
     //!\brief Initialises the underlying buffer.
     void init_buffer()
     {
-        buffer.resize(1);
+        if (configured_chunk_size > 0)
+        {   // An explicitly configured chunk size overrules the automatic sizing.
+            buffer.resize(configured_chunk_size);
+        }
+        else if constexpr (!execution_handler_t::is_parallel && buffering_mode == executor_buffering::single)
+        {   // The synchronous execution gains nothing from buffering more than one alignment.
+            buffer.resize(1);
+        }
+        // Otherwise the buffer is sized on the first underflow, when the dimensions of the first sequence pair
+        // are known (see ensure_buffer_size).
+
+        if constexpr (buffering_mode == executor_buffering::double_buffered)
+            prefetch_buffer.resize(buffer.size());
+
         setg(std::ranges::end(buffer), std::ranges::end(buffer));
     }
+
+    /*!\brief Sizes the buffer based on the dimensions of the first sequence pair if it was not sized yet.
+     *
+     * \details
+     *
+     * The automatic mode aims for a fixed number of matrix cells per chunk, such that many short pairs are
+     * gathered into one chunk to amortise the submission overhead, while a long pair, whose single alignment
+     * already constitutes enough work, is computed in a small one. A concurrently filled buffer never provides
+     * fewer alignments than twice the hardware concurrency, so that all threads are kept busy.
+     */
+    void ensure_buffer_size()
+    {
+        if (!buffer.empty() || is_eof())
+            return;
+
+        auto && [first_seq, second_seq] = *std::ranges::begin(resource);
+        size_t const cells = (std::ranges::distance(first_seq) + 1) * (std::ranges::distance(second_seq) + 1);
+        size_t chunk_size = std::clamp<size_t>(auto_chunk_cell_count / cells, 1u, 1u << 16);
+
+        if constexpr (execution_handler_t::is_parallel || buffering_mode == executor_buffering::double_buffered)
+            chunk_size = std::max<size_t>(chunk_size, std::max<size_t>(2, std::thread::hardware_concurrency()) * 2);
+
+        buffer.resize(chunk_size);
+        if constexpr (buffering_mode == executor_buffering::double_buffered)
+            prefetch_buffer.resize(chunk_size);
+    }
     //!\}
 
     //!\brief Indicates the end-of-stream.
     static constexpr size_t eof{std::numeric_limits<size_t>::max()};
 
+    //!\brief The number of matrix cells one chunk aims to cover when the chunk size is derived automatically.
+    static constexpr size_t auto_chunk_cell_count{1u << 25};
+
     //!\brief The execution policy.
     execution_handler_t exec_handler{};
 
@@ -213,6 +351,8 @@ private:
     resource_type resource{};
     //!\brief Selects the correct alignment to execute.
     alignment_algorithm_t kernel{};
+    //!\brief The configured number of pairs per chunk; `0` selects the automatic sizing.
+    size_t configured_chunk_size{0};
 
     //!\brief The buffer storing the alignment results.
     buffer_type buffer{};
@@ -220,6 +360,15 @@ private:
     buffer_pointer gptr{};
     //!\brief The end get pointer in the buffer.
     buffer_pointer egptr{};
+
+    /*!\name Only used if seqan3::detail::executor_buffering::double_buffered is selected
+     * \{
+     */
+    //!\brief The buffer that is filled in the background.
+    buffer_type prefetch_buffer{};
+    //!\brief The pending prefetch; declared last such that it is joined before the buffers are destructed.
+    std::future<size_t> prefetch_future{};
+    //!\}
 };
 
 /*!\name Type deduction guides
@@ -230,5 +379,9 @@ template <typename resource_rng_t, typename func_t>
 alignment_executor_two_way(resource_rng_t &&, func_t) ->
     alignment_executor_two_way<resource_rng_t, func_t, execution_handler_sequential>;
 
+template <typename resource_rng_t, typename func_t, typename exec_handler_t>
+alignment_executor_two_way(resource_rng_t &&, func_t, exec_handler_t, size_t) ->
+    alignment_executor_two_way<resource_rng_t, func_t, exec_handler_t>;
+
 //!\}
 } // namespace seqan3::detail
@@ -27,6 +27,10 @@ namespace seqan3
  *
  * Provides a stream-like range interface over the alignments instances that are computed in a
  * seqan3::detail::alignment_executor_two_way executor.
+ *
+ * Dereferencing the iterator yields a reference into the result arena owned by the executor instead of a
+ * copy of the result. The reference is invalidated by the increment that releases the batch the result
+ * belongs to; a result needed beyond that point must be moved or copied out before incrementing.
  */
 template <typename alignment_executor_type>
 //TODO requires alignment_executor_concept<alignment_executor_type>
@@ -70,7 +74,7 @@ class alignment_range
          */
         reference operator*() const noexcept
         {
-            return range_ptr->cache;
+            return *range_ptr->cache;
         }
         //!\}
 
@@ -199,8 +203,8 @@ protected:
         if (!alignment_executor)
             throw std::runtime_error{"No alignment execution buffer available."};
 
-        if (auto opt = alignment_executor->bump(); opt.has_value())
-            cache = std::move(*opt);
+        if (auto * result = alignment_executor->bump(); result != nullptr)
+            cache = result;
         else
             eof_flag = true;
     }
@@ -214,8 +218,8 @@ protected:
 private:
     //!\brief The underlying executor buffer.
     std::unique_ptr<alignment_executor_type> alignment_executor{};
-    //!\brief Stores last read element.
-    value_type cache{};
+    //!\brief Points to the last read element inside the executor's result arena.
+    value_type * cache{nullptr};
     //!\brief Indicates whether the stream has reached its end.
     bool eof_flag{true};
 };
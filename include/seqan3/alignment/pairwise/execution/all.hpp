@@ -14,7 +14,11 @@
 
 #include <seqan3/alignment/pairwise/execution/alignment_executor_two_way.hpp>
 #include <seqan3/alignment/pairwise/execution/alignment_range.hpp>
+#include <seqan3/alignment/pairwise/execution/execution_handler_parallel.hpp>
 #include <seqan3/alignment/pairwise/execution/execution_handler_sequential.hpp>
+#include <seqan3/alignment/pairwise/execution/execution_handler_shared_pool.hpp>
+#include <seqan3/alignment/pairwise/execution/execution_handler_work_stealing.hpp>
+#include <seqan3/alignment/pairwise/execution/result_arena.hpp>
 
 /*!\defgroup execution Execution
  * \ingroup pairwise_alignment
@@ -0,0 +1,195 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::execution_handler_parallel.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <seqan3/contrib/parallel/buffer_queue.hpp>
+#include <seqan3/core/platform.hpp>
+#include <seqan3/std/concepts>
+
+namespace seqan3::detail
+{
+
+/*!\brief Handles the parallel execution of alignments with a simple thread pool.
+ * \ingroup execution
+ *
+ * \details
+ *
+ * In contrast to seqan3::detail::execution_handler_sequential the invocation of an alignment instance does
+ * not block the caller. Instead the job is enqueued into a bounded seqan3::contrib::buffer_queue which is
+ * processed by a pool of worker threads; if the workers fall behind by more than a few jobs per thread, the
+ * submission blocks until a slot frees up, so the submitted (copied) ranges never pile up unboundedly. The
+ * results are reported through the delegate, which writes every result to the buffer slot reserved for the
+ * respective invocation, such that the order of the results is preserved independent of the order in which
+ * the jobs finish. A call to seqan3::detail::execution_handler_parallel::wait blocks until all previously
+ * submitted jobs have been processed.
+ *
+ * Note that the passed ranges are copied into the submitted job, because the executor might invalidate the
+ * iterators of the underlying resource before the job is processed.
+ */
+class execution_handler_parallel
+{
+private:
+    //!\brief The internal type eraser over the submitted jobs.
+    using task_type = std::function<void()>;
+
+public:
+    //!\brief Flag to indicate that submitted jobs are executed asynchronously.
+    static constexpr bool is_parallel = true;
+
+    /*!\name Constructors, destructor and assignment
+     * \brief The class is move-only due to the internally managed threads.
+     * \{
+     */
+    //!\brief Constructs the execution handler spawning `std::thread::hardware_concurrency()` many threads.
+    execution_handler_parallel() : execution_handler_parallel{std::thread::hardware_concurrency()}
+    {}
+
+    //!\brief Constructs the execution handler spawning `thread_count` many threads.
+    explicit execution_handler_parallel(size_t const thread_count) :
+        state_ptr{new internal_state{std::max<size_t>(1, thread_count) * tasks_per_thread}}
+    {
+        auto * state = state_ptr.get();
+        for (size_t i = 0; i < std::max<size_t>(1, thread_count); ++i)
+        {
+            state->threads.emplace_back([state] ()
+            {
+                for (;;)
+                {
+                    task_type task{};
+                    if (state->tasks.wait_pop(task) == contrib::queue_op_status::closed)
+                        return; // Only happens if the handler is destructed.
+
+                    task();
+
+                    {
+                        std::unique_lock<std::mutex> lock{state->mutex};
+                        if (--state->pending == 0)
+                            state->wake_caller.notify_all();
+                    }
+                }
+            });
+        }
+    }
+
+    execution_handler_parallel(execution_handler_parallel const &) = delete;             //!< This is a move-only type.
+    execution_handler_parallel(execution_handler_parallel &&) = default;                 //!< Defaulted
+    execution_handler_parallel & operator=(execution_handler_parallel const &) = delete; //!< This is a move-only type.
+    execution_handler_parallel & operator=(execution_handler_parallel &&) = default;     //!< Defaulted
+
+    //!\brief Waits for all submitted jobs and joins the worker threads.
+    ~execution_handler_parallel()
+    {
+        if (state_ptr == nullptr)  // Might have been moved from.
+            return;
+
+        state_ptr->tasks.close(); // the workers drain the queue and then terminate
+
+        for (auto & thread : state_ptr->threads)
+            if (thread.joinable())
+                thread.join();
+    }
+    //!\}
+
+    /*!\name Execution
+     * \{
+     */
+    /*!\brief Enqueues the passed alignment instance for asynchronous invocation.
+     * \tparam fn_type           The callable that needs to be invoked; must model std::Invocable with
+     *                           first_range_type and second_range_type.
+     * \tparam first_range_type  The type of the first range.
+     * \tparam second_range_type The type of the second range.
+     * \tparam delegate_type     The type of the callable invoked on the std::invoke_result of `fn_type`; must model
+     *                           std::Invocable.
+     *
+     * \param[in] func         The callable invoking the alignment algorithm.
+     * \param[in] first_range  The first range.
+     * \param[in] second_range The second range.
+     * \param[in] delegate     The callable invoked with the result of the alignment.
+     */
+    template <typename fn_type, typename first_range_type, typename second_range_type, typename delegate_type>
+    //!\cond
+        requires std::Invocable<fn_type, first_range_type &, second_range_type &> &&
+                 std::Invocable<delegate_type, std::invoke_result_t<fn_type, first_range_type &, second_range_type &>>
+    //!\endcond
+    void execute(fn_type && func,
+                 first_range_type first_range,
+                 second_range_type second_range,
+                 delegate_type && delegate)
+    {
+        assert(state_ptr != nullptr);
+
+        task_type task{[func,
+                        first_range = std::move(first_range),
+                        second_range = std::move(second_range),
+                        delegate] () mutable
+        {
+            delegate(func(first_range, second_range));
+        }};
+
+        {
+            std::unique_lock<std::mutex> lock{state_ptr->mutex};
+            ++state_ptr->pending;
+        }
+
+        // Blocks when the queue is full, i.e. when the workers are more than capacity() jobs behind.
+        [[maybe_unused]] contrib::queue_op_status const status = state_ptr->tasks.wait_push(std::move(task));
+        assert(status == contrib::queue_op_status::success); // the queue is only closed on destruction
+    }
+
+    //!\brief Blocks until all submitted jobs have been processed.
+    void wait()
+    {
+        assert(state_ptr != nullptr);
+
+        std::unique_lock<std::mutex> lock{state_ptr->mutex};
+        state_ptr->wake_caller.wait(lock, [this] { return state_ptr->pending == 0; });
+    }
+    //!\}
+
+private:
+    //!\brief The queue capacity granted per worker thread before submissions block.
+    static constexpr size_t tasks_per_thread = 4;
+
+    //!\brief The shared state between the caller and the worker threads.
+    struct internal_state
+    {
+        //!\brief Constructs the state with the given task queue capacity.
+        explicit internal_state(size_t const queue_capacity) : tasks{queue_capacity}
+        {}
+
+        //!\brief The worker threads processing the task queue.
+        std::vector<std::thread> threads{};
+        //!\brief The queue of submitted jobs; closed on destruction to terminate the worker threads.
+        contrib::buffer_queue<task_type> tasks;
+        //!\brief The mutex protecting #pending.
+        std::mutex mutex{};
+        //!\brief Signalled whenever all submitted tasks have been processed.
+        std::condition_variable wake_caller{};
+        //!\brief The number of submitted but not yet finished tasks.
+        size_t pending{0};
+    };
+
+    //!\brief The internal state; stored on the heap to keep the handler movable.
+    std::unique_ptr<internal_state> state_ptr{};
+};
+
+} // namespace seqan3::detail
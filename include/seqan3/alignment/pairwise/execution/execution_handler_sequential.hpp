@@ -27,6 +27,9 @@ struct execution_handler_sequential
 {
 public:
 
+    //!\brief Flag to indicate that submitted jobs are executed synchronously.
+    static constexpr bool is_parallel = false;
+
     /*!\name Execution
      * \{
      */
@@ -55,6 +58,10 @@ public:
     {
         delegate(func(std::forward<first_range_type>(first_range), std::forward<second_range_type>(second_range)));
     }
+
+    //!\brief Returns immediately; all jobs are already processed when the execute call returns.
+    void wait() noexcept
+    {}
     //!\}
 };
 
@@ -0,0 +1,157 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::execution_handler_shared_pool.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include <seqan3/core/parallel/thread_pool.hpp>
+#include <seqan3/core/platform.hpp>
+#include <seqan3/std/concepts>
+
+namespace seqan3::detail
+{
+
+/*!\brief Handles the parallel execution of alignments on a shared seqan3::thread_pool.
+ * \ingroup execution
+ *
+ * \details
+ *
+ * Offers the same interface as seqan3::detail::execution_handler_parallel, but submits the jobs to an
+ * externally owned seqan3::thread_pool instead of spawning worker threads of its own. This way multiple
+ * subsystems (and multiple concurrently running alignment calls) share one set of worker threads instead
+ * of oversubscribing the machine with a pool per call. The handler only tracks its own outstanding jobs:
+ * every submitted task decrements the handler's pending counter on completion, such that wait() blocks
+ * until all jobs of *this* handler are done, independent of what else runs on the pool.
+ *
+ * Note that the passed ranges are copied into the submitted job, because the executor might invalidate the
+ * iterators of the underlying resource before the job is processed. The destructor waits for all submitted
+ * jobs, because they reference the handler's internal state.
+ */
+class execution_handler_shared_pool
+{
+public:
+    //!\brief Flag to indicate that submitted jobs are executed asynchronously.
+    static constexpr bool is_parallel = true;
+
+    /*!\name Constructors, destructor and assignment
+     * \brief The class is move-only due to the internally managed state.
+     * \{
+     */
+    //!\brief Constructs the execution handler drawing from the process-wide shared pool.
+    execution_handler_shared_pool() : execution_handler_shared_pool{thread_pool::shared()}
+    {}
+
+    //!\brief Constructs the execution handler drawing from the given pool.
+    explicit execution_handler_shared_pool(thread_pool & pool) : pool{&pool}, state_ptr{new internal_state{}}
+    {}
+
+    //!\brief This is a move-only type.
+    execution_handler_shared_pool(execution_handler_shared_pool const &) = delete;
+    //!\brief Defaulted
+    execution_handler_shared_pool(execution_handler_shared_pool &&) = default;
+    //!\brief This is a move-only type.
+    execution_handler_shared_pool & operator=(execution_handler_shared_pool const &) = delete;
+    //!\brief Defaulted
+    execution_handler_shared_pool & operator=(execution_handler_shared_pool &&) = default;
+
+    //!\brief Waits for all submitted jobs; the pool itself is not owned and keeps running.
+    ~execution_handler_shared_pool()
+    {
+        if (state_ptr != nullptr) // Might have been moved from.
+            wait();
+    }
+    //!\}
+
+    /*!\name Execution
+     * \{
+     */
+    /*!\brief Enqueues the passed alignment instance for asynchronous invocation on the pool.
+     * \tparam fn_type           The callable that needs to be invoked; must model std::Invocable with
+     *                           first_range_type and second_range_type.
+     * \tparam first_range_type  The type of the first range.
+     * \tparam second_range_type The type of the second range.
+     * \tparam delegate_type     The type of the callable invoked on the std::invoke_result of `fn_type`; must model
+     *                           std::Invocable.
+     *
+     * \param[in] func         The callable invoking the alignment algorithm.
+     * \param[in] first_range  The first range.
+     * \param[in] second_range The second range.
+     * \param[in] delegate     The callable invoked with the result of the alignment.
+     */
+    template <typename fn_type, typename first_range_type, typename second_range_type, typename delegate_type>
+    //!\cond
+        requires std::Invocable<fn_type, first_range_type &, second_range_type &> &&
+                 std::Invocable<delegate_type, std::invoke_result_t<fn_type, first_range_type &, second_range_type &>>
+    //!\endcond
+    void execute(fn_type && func,
+                 first_range_type first_range,
+                 second_range_type second_range,
+                 delegate_type && delegate)
+    {
+        assert(state_ptr != nullptr);
+
+        {
+            std::unique_lock<std::mutex> lock{state_ptr->mutex};
+            ++state_ptr->pending;
+        }
+
+        // Blocks when the pool queue is full, i.e. when the workers are far behind (see thread_pool::submit).
+        pool->submit([state = state_ptr.get(),
+                      func,
+                      first_range = std::move(first_range),
+                      second_range = std::move(second_range),
+                      delegate] () mutable
+        {
+            delegate(func(first_range, second_range));
+
+            {
+                std::unique_lock<std::mutex> lock{state->mutex};
+                if (--state->pending == 0)
+                    state->wake_caller.notify_all();
+            }
+        });
+    }
+
+    //!\brief Blocks until all jobs submitted through this handler have been processed.
+    void wait()
+    {
+        assert(state_ptr != nullptr);
+
+        std::unique_lock<std::mutex> lock{state_ptr->mutex};
+        state_ptr->wake_caller.wait(lock, [this] { return state_ptr->pending == 0; });
+    }
+    //!\}
+
+private:
+    //!\brief The state shared between the handler and its submitted jobs.
+    struct internal_state
+    {
+        //!\brief The mutex protecting #pending.
+        std::mutex mutex{};
+        //!\brief Signalled whenever all jobs of this handler have been processed.
+        std::condition_variable wake_caller{};
+        //!\brief The number of submitted but not yet finished jobs of this handler.
+        size_t pending{0};
+    };
+
+    //!\brief The pool the jobs are submitted to; externally owned.
+    thread_pool * pool{nullptr};
+    //!\brief The internal state; stored on the heap to keep the handler movable.
+    std::unique_ptr<internal_state> state_ptr{};
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,385 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::execution_handler_work_stealing.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cctype>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#endif
+
+#include <seqan3/core/platform.hpp>
+#include <seqan3/std/concepts>
+
+namespace seqan3::detail
+{
+
+/*!\brief Handles the parallel execution of alignments with a work-stealing scheduler.
+ * \ingroup execution
+ *
+ * \details
+ *
+ * This execution handler offers the same interface as seqan3::detail::execution_handler_parallel but
+ * distributes the submitted jobs over one task queue per worker thread. A worker preferably processes the
+ * jobs of its own queue and steals a job from the queue of another worker when its own queue runs empty.
+ * This keeps all threads busy for heterogeneous batches, e.g. when a few long sequence pairs are mixed
+ * with many short ones and a static partitioning would leave most threads idle at the tail of the batch.
+ *
+ * On construction the handler detects the NUMA topology of the machine (on Linux via
+ * `/sys/devices/system/node`; otherwise a single node spanning all cpus is assumed) and pins every worker
+ * thread to the cpus of one node. Since the submitted task copies the alignment function object, the dynamic
+ * programming matrices are allocated by the executing worker and end up in node-local memory by the
+ * first-touch policy of the operating system. Idle workers steal preferably from workers pinned to the same
+ * node and only fall back to remote queues when the whole node runs out of work, which keeps the cross-node
+ * traffic to the unavoidable load-balancing steals.
+ *
+ * Like in the simple parallel handler the results are reported through the per-invocation delegate and a
+ * call to wait() blocks until all previously submitted jobs have been processed.
+ */
+class execution_handler_work_stealing
+{
+private:
+    //!\brief The internal type eraser over the submitted jobs.
+    using task_type = std::function<void()>;
+
+public:
+    //!\brief Flag to indicate that submitted jobs are executed asynchronously.
+    static constexpr bool is_parallel = true;
+
+    /*!\name Constructors, destructor and assignment
+     * \brief The class is move-only due to the internally managed threads.
+     * \{
+     */
+    //!\brief Constructs the execution handler spawning `std::thread::hardware_concurrency()` many threads.
+    execution_handler_work_stealing() : execution_handler_work_stealing{std::thread::hardware_concurrency()}
+    {}
+
+    //!\brief Constructs the execution handler spawning `thread_count` many threads.
+    explicit execution_handler_work_stealing(size_t const thread_count) : state_ptr{new internal_state{}}
+    {
+        auto * state = state_ptr.get();
+        size_t const worker_count = std::max<size_t>(1, thread_count);
+
+        // Distribute the workers round-robin over the numa nodes of the machine.
+        std::vector<std::vector<unsigned>> const topology = detect_numa_topology();
+        for (size_t i = 0; i < worker_count; ++i)
+        {
+            state->queues.emplace_back(new worker_queue{});
+            state->worker_node.push_back(i % topology.size());
+        }
+
+        for (size_t i = 0; i < worker_count; ++i)
+        {
+            state->threads.emplace_back([state, i] ()
+            {
+                for (;;)
+                {
+                    task_type task{};
+
+                    if (try_acquire_task(*state, i, task))
+                    {
+                        task();
+
+                        std::unique_lock<std::mutex> lock{state->sleep_mutex};
+                        if (--state->pending == 0)
+                            state->wake_caller.notify_all();
+                        continue;
+                    }
+
+                    std::unique_lock<std::mutex> lock{state->sleep_mutex};
+                    state->wake_worker.wait(lock, [state] { return state->available > 0 || state->stop; });
+
+                    if (state->stop && state->available == 0)
+                        return;
+                }
+            });
+
+            pin_to_cpus(state->threads.back(), topology[state->worker_node[i]]);
+        }
+    }
+
+    //!\brief This is a move-only type.
+    execution_handler_work_stealing(execution_handler_work_stealing const &) = delete;
+    //!\brief Defaulted
+    execution_handler_work_stealing(execution_handler_work_stealing &&) = default;
+    //!\brief This is a move-only type.
+    execution_handler_work_stealing & operator=(execution_handler_work_stealing const &) = delete;
+    //!\brief Defaulted
+    execution_handler_work_stealing & operator=(execution_handler_work_stealing &&) = default;
+
+    //!\brief Waits for all submitted jobs and joins the worker threads.
+    ~execution_handler_work_stealing()
+    {
+        if (state_ptr == nullptr)  // Might have been moved from.
+            return;
+
+        {
+            std::unique_lock<std::mutex> lock{state_ptr->sleep_mutex};
+            state_ptr->stop = true;
+        }
+        state_ptr->wake_worker.notify_all();
+
+        for (auto & thread : state_ptr->threads)
+            if (thread.joinable())
+                thread.join();
+    }
+    //!\}
+
+    /*!\name Execution
+     * \{
+     */
+    /*!\brief Enqueues the passed alignment instance for asynchronous invocation.
+     * \tparam fn_type           The callable that needs to be invoked; must model std::Invocable with
+     *                           first_range_type and second_range_type.
+     * \tparam first_range_type  The type of the first range.
+     * \tparam second_range_type The type of the second range.
+     * \tparam delegate_type     The type of the callable invoked on the std::invoke_result of `fn_type`; must model
+     *                           std::Invocable.
+     *
+     * \param[in] func         The callable invoking the alignment algorithm.
+     * \param[in] first_range  The first range.
+     * \param[in] second_range The second range.
+     * \param[in] delegate     The callable invoked with the result of the alignment.
+     *
+     * \details
+     *
+     * The jobs are distributed round-robin over the worker queues; idle workers steal jobs from other
+     * queues, hence the initial placement only matters for the cache locality of homogeneous batches.
+     */
+    template <typename fn_type, typename first_range_type, typename second_range_type, typename delegate_type>
+    //!\cond
+        requires std::Invocable<fn_type, first_range_type &, second_range_type &> &&
+                 std::Invocable<delegate_type, std::invoke_result_t<fn_type, first_range_type &, second_range_type &>>
+    //!\endcond
+    void execute(fn_type && func,
+                 first_range_type first_range,
+                 second_range_type second_range,
+                 delegate_type && delegate)
+    {
+        assert(state_ptr != nullptr);
+
+        task_type task{[func,
+                        first_range = std::move(first_range),
+                        second_range = std::move(second_range),
+                        delegate] () mutable
+        {
+            delegate(func(first_range, second_range));
+        }};
+
+        worker_queue & queue = *state_ptr->queues[state_ptr->next_queue++ % state_ptr->queues.size()];
+        {
+            std::unique_lock<std::mutex> lock{queue.mutex};
+            queue.tasks.push_back(std::move(task));
+        }
+
+        {
+            std::unique_lock<std::mutex> lock{state_ptr->sleep_mutex};
+            ++state_ptr->pending;
+            ++state_ptr->available;
+        }
+        state_ptr->wake_worker.notify_one();
+    }
+
+    //!\brief Blocks until all submitted jobs have been processed.
+    void wait()
+    {
+        assert(state_ptr != nullptr);
+
+        std::unique_lock<std::mutex> lock{state_ptr->sleep_mutex};
+        state_ptr->wake_caller.wait(lock, [this] { return state_ptr->pending == 0; });
+    }
+    //!\}
+
+private:
+    //!\brief The task queue owned by one worker thread.
+    struct worker_queue
+    {
+        //!\brief The jobs placed into this queue.
+        std::deque<task_type> tasks{};
+        //!\brief The mutex protecting this queue.
+        std::mutex mutex{};
+    };
+
+    //!\brief The shared state between the caller and the worker threads.
+    struct internal_state
+    {
+        //!\brief One task queue per worker thread.
+        std::vector<std::unique_ptr<worker_queue>> queues{};
+        //!\brief The numa node every worker thread is pinned to.
+        std::vector<size_t> worker_node{};
+        //!\brief The worker threads processing the task queues.
+        std::vector<std::thread> threads{};
+        //!\brief The mutex protecting the sleep/wake bookkeeping.
+        std::mutex sleep_mutex{};
+        //!\brief Signalled whenever a new task was submitted or the handler is destructed.
+        std::condition_variable wake_worker{};
+        //!\brief Signalled whenever all submitted tasks have been processed.
+        std::condition_variable wake_caller{};
+        //!\brief The queue index used for the round-robin placement of new tasks.
+        size_t next_queue{0};
+        //!\brief The number of submitted but not yet finished tasks.
+        size_t pending{0};
+        //!\brief The number of queued but not yet acquired tasks.
+        std::atomic<size_t> available{0};
+        //!\brief Set on destruction to terminate the worker threads.
+        bool stop{false};
+    };
+
+    /*!\brief Tries to acquire a task for the given worker; first from its own queue, then by stealing.
+     * \param[in,out] state     The shared state holding the worker queues.
+     * \param[in]     worker_id The index of the worker trying to acquire a task.
+     * \param[out]    task      The acquired task.
+     * \returns `true` if a task could be acquired, `false` otherwise.
+     */
+    static bool try_acquire_task(internal_state & state, size_t const worker_id, task_type & task)
+    {
+        size_t const queue_count = state.queues.size();
+
+        // The own queue is accessed LIFO to reuse the warm caches; steals happen FIFO from the oldest task.
+        {
+            worker_queue & own = *state.queues[worker_id];
+            std::unique_lock<std::mutex> lock{own.mutex};
+            if (!own.tasks.empty())
+            {
+                task = std::move(own.tasks.back());
+                own.tasks.pop_back();
+                --state.available;
+                return true;
+            }
+        }
+
+        // Steal preferably from a worker pinned to the same numa node and only fall back to the queues of
+        // remote nodes when the whole node ran out of work.
+        auto steal_from = [&] (bool const same_node) -> bool
+        {
+            for (size_t offset = 1; offset < queue_count; ++offset)
+            {
+                size_t const victim_id = (worker_id + offset) % queue_count;
+                if ((state.worker_node[victim_id] == state.worker_node[worker_id]) != same_node)
+                    continue;
+
+                worker_queue & victim = *state.queues[victim_id];
+                std::unique_lock<std::mutex> lock{victim.mutex};
+                if (!victim.tasks.empty())
+                {
+                    task = std::move(victim.tasks.front());
+                    victim.tasks.pop_front();
+                    --state.available;
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        return steal_from(true) || steal_from(false);
+    }
+
+    /*!\brief Detects the numa topology of the machine.
+     * \returns The cpus of every numa node; a single node spanning all cpus if the topology is unknown.
+     *
+     * \details
+     *
+     * On Linux the topology is read from `/sys/devices/system/node/node<n>/cpulist`. On other platforms, or
+     * if the sysfs entries are not readable, all cpus are reported as one node, which makes the pinning and
+     * the steal order degenerate to the behaviour of a topology-unaware handler.
+     */
+    static std::vector<std::vector<unsigned>> detect_numa_topology()
+    {
+#if defined(__linux__)
+        std::vector<std::vector<unsigned>> nodes{};
+
+        for (unsigned node = 0; ; ++node)
+        {
+            std::ifstream cpulist_file{"/sys/devices/system/node/node" + std::to_string(node) + "/cpulist"};
+            if (!cpulist_file.good())
+                break;
+
+            // The cpulist holds comma separated cpu ranges, e.g. "0-31,64-95".
+            std::string cpulist{};
+            std::getline(cpulist_file, cpulist);
+
+            std::vector<unsigned> cpus{};
+            size_t position = 0;
+            while (position < cpulist.size() && std::isdigit(cpulist[position]))
+            {
+                size_t consumed = 0;
+                unsigned first = std::stoul(cpulist.substr(position), &consumed);
+                unsigned last = first;
+                position += consumed;
+
+                if (position < cpulist.size() && cpulist[position] == '-')
+                {
+                    last = std::stoul(cpulist.substr(position + 1), &consumed);
+                    position += consumed + 1;
+                }
+
+                for (unsigned cpu = first; cpu <= last; ++cpu)
+                    cpus.push_back(cpu);
+
+                if (position < cpulist.size() && cpulist[position] == ',')
+                    ++position;
+            }
+
+            if (!cpus.empty())
+                nodes.push_back(std::move(cpus));
+        }
+
+        if (!nodes.empty())
+            return nodes;
+#endif
+
+        std::vector<unsigned> all_cpus(std::max<unsigned>(1u, std::thread::hardware_concurrency()));
+        std::iota(all_cpus.begin(), all_cpus.end(), 0u);
+        return {std::move(all_cpus)};
+    }
+
+    /*!\brief Pins the given thread to the given cpus.
+     * \param[in,out] thread The thread to pin.
+     * \param[in]     cpus   The cpus the thread is allowed to run on.
+     *
+     * \details
+     *
+     * The pinning is best-effort: on platforms without thread affinity support, or if setting the affinity
+     * fails, the thread keeps the inherited affinity mask.
+     */
+    static void pin_to_cpus([[maybe_unused]] std::thread & thread,
+                            [[maybe_unused]] std::vector<unsigned> const & cpus)
+    {
+#if defined(__linux__)
+        cpu_set_t cpu_set{};
+        CPU_ZERO(&cpu_set);
+        for (unsigned const cpu : cpus)
+            CPU_SET(cpu, &cpu_set);
+
+        pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t), &cpu_set);
+#endif
+    }
+
+    //!\brief The internal state; stored on the heap to keep the handler movable.
+    std::unique_ptr<internal_state> state_ptr{};
+};
+
+} // namespace seqan3::detail
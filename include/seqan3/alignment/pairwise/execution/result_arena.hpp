@@ -0,0 +1,116 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::result_arena.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <vector>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A recycled slab of alignment result slots owned by the executor.
+ * \ingroup execution
+ * \tparam result_t The type of the stored results.
+ *
+ * \details
+ *
+ * The seqan3::detail::alignment_executor_two_way computes its results in batches. Allocating a fresh result
+ * object per alignment would put the allocator on the hot path at millions of pairs per second, so the
+ * executor instead owns one arena per concurrently filled batch and recycles it: the slots are constructed
+ * once, every batch assigns its results over the previous batch in place, and nested containers keep their
+ * grown capacity across batches. The consumer receives references into the arena (see
+ * seqan3::detail::alignment_executor_two_way::bump); they remain valid until the consumer releases the
+ * batch by requesting a result beyond it.
+ *
+ * During a fill every in-flight job writes exclusively to the slot reserved for its invocation, hence the
+ * worker threads of a parallel execution handler write to disjoint slots and need no synchronisation.
+ */
+template <typename result_t>
+class result_arena
+{
+public:
+    /*!\name Member types
+     * \{
+     */
+    //!\brief The type of the stored results.
+    using value_type = result_t;
+    //!\brief A reference to a stored result.
+    using reference  = result_t &;
+    //!\brief The iterator over the slots.
+    using iterator   = typename std::vector<result_t>::iterator;
+    //!\brief The difference type of the iterator.
+    using difference_type = typename std::vector<result_t>::difference_type;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    result_arena() = default;                                 //!< Defaulted
+    result_arena(result_arena const &) = default;             //!< Defaulted
+    result_arena(result_arena &&) = default;                  //!< Defaulted
+    result_arena & operator=(result_arena const &) = default; //!< Defaulted
+    result_arena & operator=(result_arena &&) = default;      //!< Defaulted
+    ~result_arena() = default;                                //!< Defaulted
+    //!\}
+
+    /*!\brief Sets the number of slots.
+     * \param[in] count The new number of slots.
+     *
+     * \details
+     *
+     * Existing slots keep their storage. Must not be called while references into the arena are live,
+     * since growing may relocate the slots.
+     */
+    void resize(size_t const count)
+    {
+        slots.resize(count);
+    }
+
+    //!\brief Returns the number of slots.
+    size_t size() const noexcept
+    {
+        return slots.size();
+    }
+
+    //!\brief Checks whether the arena holds no slots.
+    bool empty() const noexcept
+    {
+        return slots.empty();
+    }
+
+    //!\brief Returns the slot with the given index.
+    reference operator[](size_t const index) noexcept
+    {
+        assert(index < slots.size());
+        return slots[index];
+    }
+
+    //!\brief Returns an iterator to the first slot.
+    iterator begin() noexcept
+    {
+        return slots.begin();
+    }
+
+    //!\brief Returns an iterator behind the last slot.
+    iterator end() noexcept
+    {
+        return slots.end();
+    }
+
+private:
+    //!\brief The recycled result slots.
+    std::vector<result_t> slots{};
+};
+
+} // namespace seqan3::detail
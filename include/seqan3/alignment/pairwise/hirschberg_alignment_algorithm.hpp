@@ -0,0 +1,282 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::hirschberg_alignment_algorithm.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/matrix/alignment_coordinate.hpp>
+#include <seqan3/alignment/pairwise/align_result_selector.hpp>
+#include <seqan3/alignment/pairwise/alignment_parameter_block.hpp>
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alphabet/gap/gapped.hpp>
+#include <seqan3/core/algorithm/configuration.hpp>
+#include <seqan3/core/metafunction/range.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes a global alignment in linear space using the algorithm of Hirschberg.
+ * \implements std::Invocable
+ * \ingroup pairwise_alignment
+ * \tparam config_t The configuration type.
+ *
+ * \details
+ *
+ * Instead of materialising the full trace matrix, the alignment matrix is recursively split at the middle
+ * row of the first sequence. The optimal crossing column is determined from a forward score pass over the
+ * upper half and a backward score pass over the lower half, both of which only keep a single score row in
+ * memory. The two halves are then solved recursively until they degenerate into trivial alignments. This
+ * computes roughly twice as many cells as the score-only alignment but reduces the memory consumption of
+ * the traceback from \f$ O(n \cdot m) \f$ to \f$ O(n+m) \f$.
+ *
+ * This function object is selected by the seqan3::detail::alignment_configurator when
+ * seqan3::align_cfg::linear_space is set and offers the same invocation interface as the other alignment
+ * kernels. Only global alignments with linear gap costs are supported.
+ */
+template <typename config_t>
+class hirschberg_alignment_algorithm
+{
+private:
+    //!\brief The type of the score.
+    using score_type = int32_t;
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr hirschberg_alignment_algorithm() = default;                                                  //!< Defaulted
+    constexpr hirschberg_alignment_algorithm(hirschberg_alignment_algorithm const &) = default;            //!< Defaulted
+    constexpr hirschberg_alignment_algorithm(hirschberg_alignment_algorithm &&) = default;                 //!< Defaulted
+    constexpr hirschberg_alignment_algorithm & operator=(hirschberg_alignment_algorithm const &) = default; //!< Defaulted
+    constexpr hirschberg_alignment_algorithm & operator=(hirschberg_alignment_algorithm &&) = default;     //!< Defaulted
+    ~hirschberg_alignment_algorithm() = default;                                                           //!< Defaulted
+
+    /*!\brief Constructs the algorithm with the passed configuration.
+     * \param cfg The configuration to be passed to the algorithm.
+     *
+     * \details
+     *
+     * Resolves all configuration values the algorithm reads once into a flattened
+     * seqan3::detail::alignment_parameter_block stored by value, since the function object is stored in a
+     * copyable std::function by the configurator.
+     */
+    constexpr hirschberg_alignment_algorithm(config_t const & cfg) :
+        params{make_alignment_parameter_block(cfg, gap_scheme{gap_score{-1}})}
+    {}
+    //!\}
+
+    /*!\brief Invokes the actual alignment computation given two sequences.
+     * \tparam    first_range_t  The type of the first sequence; must model std::ForwardRange.
+     * \tparam    second_range_t The type of the second sequence; must model std::ForwardRange.
+     * \param[in] first_range    The first sequence.
+     * \param[in] second_range   The second sequence.
+     */
+    template <std::ranges::ForwardRange first_range_t, std::ranges::ForwardRange second_range_t>
+    constexpr auto operator()(first_range_t && first_range, second_range_t && second_range)
+    {
+        using result_t = typename detail::align_result_selector<remove_cvref_t<first_range_t>,
+                                                                remove_cvref_t<second_range_t>,
+                                                                remove_cvref_t<config_t>>::type;
+
+        // The recursion indexes into the sequences from both directions, hence they are buffered locally.
+        std::vector<value_type_t<remove_cvref_t<first_range_t>>> first_seq{};
+        for (auto && symbol : first_range)
+            first_seq.push_back(symbol);
+
+        std::vector<value_type_t<remove_cvref_t<second_range_t>>> second_seq{};
+        for (auto && symbol : second_range)
+            second_seq.push_back(symbol);
+
+        auto const & scheme = params.scoring;
+        score_type const gap_cost = params.gap.get_gap_score();
+
+        result_t res_vt{};
+
+        if constexpr (!std::is_same_v<decltype(res_vt.score), std::nullopt_t *>)
+        {
+            res_vt.score = last_row(first_seq, 0, first_seq.size(), second_seq, 0, second_seq.size(),
+                                    false, scheme, gap_cost).back();
+        }
+
+        if constexpr (!std::is_same_v<decltype(res_vt.back_coordinate), std::nullopt_t *>)
+        {
+            res_vt.back_coordinate = alignment_coordinate{column_index_type{first_seq.size() - 1},
+                                                          row_index_type{second_seq.size() - 1}};
+        }
+
+        if constexpr (!std::is_same_v<decltype(res_vt.front_coordinate), std::nullopt_t *>)
+        {
+            res_vt.front_coordinate = alignment_coordinate{column_index_type{0u}, row_index_type{0u}};
+        }
+
+        if constexpr (!std::is_same_v<decltype(res_vt.alignment), std::nullopt_t *>)
+        {
+            auto & [gapped_first, gapped_second] = res_vt.alignment;
+            gapped_first.reserve(first_seq.size() + second_seq.size());
+            gapped_second.reserve(first_seq.size() + second_seq.size());
+
+            trace(first_seq, 0, first_seq.size(), second_seq, 0, second_seq.size(),
+                  scheme, gap_cost, gapped_first, gapped_second);
+        }
+
+        return alignment_result<result_t>{res_vt};
+    }
+
+private:
+    /*!\brief Computes the scores of aligning the given part of the first sequence against all prefixes
+     *        (respectively suffixes if `reversed` is set) of the given part of the second sequence.
+     * \returns The last row of the score matrix over the two sequence parts.
+     */
+    template <typename first_seq_t, typename second_seq_t, typename scheme_t>
+    std::vector<score_type> last_row(first_seq_t const & first_seq, size_t const first_begin, size_t const first_end,
+                                     second_seq_t const & second_seq, size_t const second_begin, size_t const second_end,
+                                     bool const reversed, scheme_t const & scheme, score_type const gap_cost) const
+    {
+        size_t const second_size = second_end - second_begin;
+
+        std::vector<score_type> row(second_size + 1);
+        for (size_t cell = 0; cell <= second_size; ++cell)
+            row[cell] = static_cast<score_type>(cell) * gap_cost;
+
+        for (size_t column = 0; column < first_end - first_begin; ++column)
+        {
+            auto const & first_symbol = reversed ? first_seq[first_end - 1 - column]
+                                                 : first_seq[first_begin + column];
+            score_type diagonal = row[0];
+            row[0] += gap_cost;
+
+            for (size_t cell = 1; cell <= second_size; ++cell)
+            {
+                auto const & second_symbol = reversed ? second_seq[second_end - cell]
+                                                      : second_seq[second_begin + cell - 1];
+                score_type best = diagonal + scheme.score(first_symbol, second_symbol);
+                diagonal = row[cell];
+                best = std::max({best, row[cell] + gap_cost, row[cell - 1] + gap_cost});
+                row[cell] = best;
+            }
+        }
+
+        return row;
+    }
+
+    /*!\brief Recursively splits the alignment matrix at the optimal midpoint and emits the gapped sequences.
+     */
+    template <typename first_seq_t, typename second_seq_t, typename scheme_t,
+              typename gapped_first_t, typename gapped_second_t>
+    void trace(first_seq_t const & first_seq, size_t const first_begin, size_t const first_end,
+               second_seq_t const & second_seq, size_t const second_begin, size_t const second_end,
+               scheme_t const & scheme, score_type const gap_cost,
+               std::vector<gapped_first_t> & gapped_first, std::vector<gapped_second_t> & gapped_second) const
+    {
+        size_t const first_size = first_end - first_begin;
+        size_t const second_size = second_end - second_begin;
+
+        if (first_size == 0)
+        {
+            for (size_t cell = 0; cell < second_size; ++cell)
+            {
+                gapped_first.push_back(seqan3::gap{});
+                gapped_second.push_back(second_seq[second_begin + cell]);
+            }
+            return;
+        }
+
+        if (second_size == 0)
+        {
+            for (size_t column = 0; column < first_size; ++column)
+            {
+                gapped_first.push_back(first_seq[first_begin + column]);
+                gapped_second.push_back(seqan3::gap{});
+            }
+            return;
+        }
+
+        if (first_size == 1)
+        {
+            // Either the single symbol is aligned against the best matching symbol of the second sequence
+            // or it is deleted and the whole second sequence part is inserted.
+            auto const & first_symbol = first_seq[first_begin];
+
+            size_t best_position = 0;
+            score_type best_score = std::numeric_limits<score_type>::lowest();
+            for (size_t cell = 0; cell < second_size; ++cell)
+            {
+                score_type const symbol_score = scheme.score(first_symbol, second_seq[second_begin + cell]);
+                if (symbol_score > best_score)
+                {
+                    best_score = symbol_score;
+                    best_position = cell;
+                }
+            }
+
+            score_type const aligned_score = static_cast<score_type>(second_size - 1) * gap_cost + best_score;
+            score_type const gap_only_score = static_cast<score_type>(second_size + 1) * gap_cost;
+
+            if (gap_only_score > aligned_score)
+            {
+                gapped_first.push_back(first_symbol);
+                gapped_second.push_back(seqan3::gap{});
+                for (size_t cell = 0; cell < second_size; ++cell)
+                {
+                    gapped_first.push_back(seqan3::gap{});
+                    gapped_second.push_back(second_seq[second_begin + cell]);
+                }
+            }
+            else
+            {
+                for (size_t cell = 0; cell < second_size; ++cell)
+                {
+                    gapped_first.push_back((cell == best_position) ? gapped_first_t{first_symbol}
+                                                                   : gapped_first_t{seqan3::gap{}});
+                    gapped_second.push_back(second_seq[second_begin + cell]);
+                }
+            }
+            return;
+        }
+
+        size_t const first_middle = first_begin + first_size / 2;
+
+        std::vector<score_type> forward = last_row(first_seq, first_begin, first_middle,
+                                                   second_seq, second_begin, second_end,
+                                                   false, scheme, gap_cost);
+        std::vector<score_type> backward = last_row(first_seq, first_middle, first_end,
+                                                    second_seq, second_begin, second_end,
+                                                    true, scheme, gap_cost);
+
+        size_t split = 0;
+        score_type best_score = std::numeric_limits<score_type>::lowest();
+        for (size_t cell = 0; cell <= second_size; ++cell)
+        {
+            if (forward[cell] + backward[second_size - cell] > best_score)
+            {
+                best_score = forward[cell] + backward[second_size - cell];
+                split = cell;
+            }
+        }
+
+        trace(first_seq, first_begin, first_middle, second_seq, second_begin, second_begin + split,
+              scheme, gap_cost, gapped_first, gapped_second);
+        trace(first_seq, first_middle, first_end, second_seq, second_begin + split, second_end,
+              scheme, gap_cost, gapped_first, gapped_second);
+    }
+
+    //!\brief The configuration values resolved once into a flattened block stored by value.
+    alignment_parameter_block_t<config_t> params{};
+};
+
+} // namespace seqan3::detail
@@ -100,8 +100,7 @@ private:
         }
 
         // Check if this was the optimum. Possibly a noop.
-        static_cast<derived_type const &>(*this).check_score(
-            alignment_optimum{main_score, static_cast<alignment_coordinate>(coordinate)}, opt);
+        static_cast<derived_type const &>(*this).check_score(main_score, coordinate, opt);
 
         tmp = main_score + gap_open;
         vt_score += gap_extend;
@@ -158,8 +157,7 @@ private:
         }
 
         // Check if this was the optimum. Possibly a noop.
-        static_cast<derived_type const &>(*this).check_score(
-                alignment_optimum{main_score, static_cast<alignment_coordinate>(coordinate)}, get<3>(cache));
+        static_cast<derived_type const &>(*this).check_score(main_score, coordinate, get<3>(cache));
         // At the top of the band we can not come from up but only diagonal or left, so the next vertical must be a
         // gap open.
         vt_score = main_score + get<1>(cache);  // add gap open cost
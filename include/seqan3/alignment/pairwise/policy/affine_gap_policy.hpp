@@ -101,8 +101,7 @@ private:
         prev_score = main_score;
         main_score = tmp;
         // Check if this was the optimum. Possibly a noop.
-        static_cast<derived_t const &>(*this).check_score(
-                alignment_optimum{tmp, static_cast<alignment_coordinate>(coordinate)}, opt);
+        static_cast<derived_t const &>(*this).check_score(tmp, coordinate, opt);
 
         // Prepare horizontal and vertical score for next column.
         tmp += gap_open;
@@ -138,6 +137,10 @@ private:
                           static_cast<score_t>(scheme.get_gap_score()),
                           std::move(opt)};
     }
+
+    //!\brief Caches the vertical state at the end of the initialisation column, so that the derived algorithm
+    //!       can reuse the initialisation column across sequence pairs of the same length (one-vs-many batches).
+    cell_t init_column_state{};
 };
 
 } // namespace seqan3::detail
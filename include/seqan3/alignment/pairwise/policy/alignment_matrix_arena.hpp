@@ -0,0 +1,97 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::alignment_matrix_arena.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A pool of capacity-retaining buffers for the alignment matrix policies.
+ * \ingroup alignment_policy
+ * \tparam buffer_t The buffer type handed out by the arena; usually a std::vector over the matrix cells.
+ *
+ * \details
+ *
+ * When many pairwise alignments are computed, allocating fresh score and trace storage for every sequence
+ * pair dominates the runtime for short sequences. The matrix policies therefore share one arena per
+ * configured alignment: a policy acquires its matrix buffer from the arena before the computation and
+ * returns it on destruction, so the buffer capacities survive the per-pair copies of the type-erased
+ * alignment function and the steady state runs without heap allocations.
+ *
+ * The arena is thread-safe, since the parallel execution handlers copy the alignment function per submitted
+ * job and hence acquire and release buffers concurrently. The pooled buffers are kept per releasing thread:
+ * a thread only ever reuses buffers it released itself, such that with the numa pinning of
+ * seqan3::detail::execution_handler_work_stealing the buffer pages stay on the node that first touched them
+ * and recycled matrices never migrate across numa nodes.
+ */
+template <typename buffer_t>
+class alignment_matrix_arena
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \brief The arena is shared through a std::shared_ptr and therefore not copyable or movable itself.
+     * \{
+     */
+    alignment_matrix_arena() = default;                                           //!< Defaulted
+    alignment_matrix_arena(alignment_matrix_arena const &) = delete;              //!< Deleted
+    alignment_matrix_arena(alignment_matrix_arena &&) = delete;                   //!< Deleted
+    alignment_matrix_arena & operator=(alignment_matrix_arena const &) = delete;  //!< Deleted
+    alignment_matrix_arena & operator=(alignment_matrix_arena &&) = delete;       //!< Deleted
+    ~alignment_matrix_arena() = default;                                          //!< Defaulted
+    //!\}
+
+    /*!\brief Acquires a buffer with the given size.
+     * \param[in] size The requested buffer size.
+     * \returns A buffer resized to `size`, reusing the capacity of a pooled buffer if one is available.
+     */
+    buffer_t acquire(size_t const size)
+    {
+        buffer_t buffer{};
+        {
+            std::lock_guard<std::mutex> lock{pool_mutex};
+            std::vector<buffer_t> & pool = pools[std::this_thread::get_id()];
+            if (!pool.empty())
+            {
+                buffer = std::move(pool.back());
+                pool.pop_back();
+            }
+        }
+        buffer.resize(size);
+        return buffer;
+    }
+
+    /*!\brief Returns a buffer to the arena.
+     * \param[in] buffer The buffer to return; its capacity is retained for subsequent acquisitions by the
+     *                   calling thread.
+     */
+    void release(buffer_t && buffer)
+    {
+        std::lock_guard<std::mutex> lock{pool_mutex};
+        pools[std::this_thread::get_id()].push_back(std::move(buffer));
+    }
+
+private:
+    //!\brief The returned buffers waiting for reuse, pooled per releasing thread (see the class description).
+    std::unordered_map<std::thread::id, std::vector<buffer_t>> pools{};
+    //!\brief The mutex protecting the pools.
+    std::mutex pool_mutex{};
+};
+
+} // namespace seqan3::detail
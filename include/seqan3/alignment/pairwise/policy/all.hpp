@@ -18,9 +18,11 @@
 #include <seqan3/alignment/pairwise/policy/affine_gap_banded_policy.hpp>
 #include <seqan3/alignment/pairwise/policy/affine_gap_init_policy.hpp>
 #include <seqan3/alignment/pairwise/policy/affine_gap_policy.hpp>
+#include <seqan3/alignment/pairwise/policy/alignment_matrix_arena.hpp>
 #include <seqan3/alignment/pairwise/policy/banded_score_dp_matrix_policy.hpp>
 #include <seqan3/alignment/pairwise/policy/banded_score_trace_dp_matrix_policy.hpp>
 #include <seqan3/alignment/pairwise/policy/find_optimum_policy.hpp>
+#include <seqan3/alignment/pairwise/policy/scoring_scheme_policy.hpp>
 #include <seqan3/alignment/pairwise/policy/unbanded_score_dp_matrix_policy.hpp>
 #include <seqan3/alignment/pairwise/policy/unbanded_score_trace_dp_matrix_policy.hpp>
 
@@ -152,23 +154,24 @@
  *
  * These policies are used to define the search space of the alignment optimum.
  *
- * Function name             | Arguments                     | Return value                         |
- * ------------------------- | ----------------------------- | ------------------------------------ |
- * `check_score`             | `score const`, `optimum &`    | `void`                               |
- * `check_score_last_row`    | `score const`, `optimum &`    | `void`                               |
- * `check_score_last_column` | `rng_t &&`, `optimum &`       | `void`                               |
+ * Function name             | Arguments                                     | Return value         |
+ * ------------------------- | --------------------------------------------- | -------------------- |
+ * `check_score`             | `score const`, `coordinate const &`, `optimum &` | `void`            |
+ * `check_score_last_row`    | `score const`, `coordinate const &`, `optimum &` | `void`            |
+ * `check_score_last_column` | `rng_t &&`, `optimum &`                       | `void`               |
  *
  * - check_score:
  *
  *    Is called for every cell in the dynamic programming matrix. Might be a "NO-OP".
- *    The left operand is the score of the current cell and the right operand is the current optimum that will
- *    be updated if the current score was higher.
+ *    Gets the score and the coordinate of the current cell and the current optimum that will be updated if the
+ *    current score was higher. The optimum candidate, including the coordinate conversion, is only materialised
+ *    if the configured search space covers the cell, such that the disabled variants run a straight-line kernel.
  *
  * - check_score_last_row:
  *
  *    Is called only for the cells in the last row of the dynamic programming matrix. Might be a NO-OP.
- *    The left operand is the score of the current cell and the right operand is the current optimum that will
- *    be updated if the current score was higher.
+ *    Gets the score and the coordinate of the current cell and the current optimum that will be updated if the
+ *    current score was higher.
  *
  * - check_score_last_column:
  *
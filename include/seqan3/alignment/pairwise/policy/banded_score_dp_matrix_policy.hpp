@@ -221,6 +221,21 @@ public:
         return std::tuple{trim_first_range(), trim_second_range()};
     }
 
+    /*!\brief Checks whether the given coordinate of the banded matrix lies on one of the band boundaries.
+     * \param[in] coordinate The coordinate within the banded matrix, i.e. before it was refined with
+     *                       seqan3::detail::banded_score_dp_matrix_policy::map_banded_coordinate_to_range_position.
+     *
+     * \details
+     *
+     * Within the banded matrix the first row of the band buffer corresponds to the upper diagonal of the band and
+     * the last row to the lower diagonal. If the optimum lies on one of these diagonals, the band might have
+     * clipped the true optimum and the alignment is recomputed with a wider band (see seqan3::adaptive_band).
+     */
+    constexpr bool optimum_touches_band_boundary(alignment_coordinate const & coordinate) const noexcept
+    {
+        return coordinate.second == 0 || coordinate.second + 1 == band_size;
+    }
+
     /*!\brief Refines the coordinate for the banded matrix to map the actual sequence position.
      * \param coordinate The coordinate to refine.
      */
@@ -77,30 +77,50 @@ private:
 
 protected:
 
+    /*!\name Compile-time queryable search space
+     * \brief Allows the alignment algorithm to skip the optimum bookkeeping entirely in the disabled variants.
+     * \{
+     */
+    //!\brief Whether the optimum search inspects every cell of the dynamic programming matrix.
+    static constexpr bool find_optimum_in_every_cell  = traits_type::find_in_every_cell_type::value;
+    //!\brief Whether the optimum search inspects the last row of the dynamic programming matrix.
+    static constexpr bool find_optimum_in_last_row    = traits_type::find_in_last_row_type::value;
+    //!\brief Whether the optimum search inspects the last column of the dynamic programming matrix.
+    static constexpr bool find_optimum_in_last_column = traits_type::find_in_last_column_type::value;
+    //!\}
+
     /*!\brief Checks every cell of the dynamic programming matrix.
-     * \tparam score_t The type of the score.
-     * \param[in]     current   The current value.
-     * \param[in,out] optimum   The current optimum to compare with.
+     * \tparam score_t      The type of the score.
+     * \tparam coordinate_t The type of the matrix coordinate.
+     * \param[in]     score      The score of the current cell.
+     * \param[in]     coordinate The coordinate of the current cell.
+     * \param[in,out] optimum    The current optimum to compare with.
      *
      * \details
      *
      * This function resolves to a "NO-OP" function if the trait for searching every cell is set to std::false_type.
+     * The seqan3::detail::alignment_optimum candidate, including the coordinate conversion, is only materialised
+     * inside of the enabled branch, such that the variants not searching every cell run a straight-line kernel.
      */
-    template <typename score_t>
-    constexpr void check_score([[maybe_unused]] alignment_optimum<score_t> const & current,
+    template <typename score_t, typename coordinate_t>
+    constexpr void check_score([[maybe_unused]] score_t const score,
+                               [[maybe_unused]] coordinate_t const & coordinate,
                                [[maybe_unused]] alignment_optimum<score_t> & optimum) const noexcept
     {
         if constexpr (traits_type::find_in_every_cell_type::value)
         {
-            optimum = std::max(current, optimum, alignment_optimum_compare_less{});
+            optimum = std::max(alignment_optimum{score, static_cast<alignment_coordinate>(coordinate)},
+                               optimum,
+                               alignment_optimum_compare_less{});
         }
-
     }
 
     /*!\brief Checks a cell of the last row of the dynamic programming matrix.
-     * \tparam score_t The type of the score.
-     * \param[in]     current   The current value.
-     * \param[in,out] optimum   The current optimum to compare with.
+     * \tparam score_t      The type of the score.
+     * \tparam coordinate_t The type of the matrix coordinate.
+     * \param[in]     score      The score of the current cell.
+     * \param[in]     coordinate The coordinate of the current cell.
+     * \param[in,out] optimum    The current optimum to compare with.
      *
      * \details
      *
@@ -108,12 +128,42 @@ protected:
      * Due to a column based iteration layout this computes only one cell at a time. The alignment algorithm
      * takes care of calling this function for the appropriate cells.
      */
-    template <typename score_t>
-    constexpr void check_score_last_row([[maybe_unused]] alignment_optimum<score_t> const & current,
+    template <typename score_t, typename coordinate_t>
+    constexpr void check_score_last_row([[maybe_unused]] score_t const score,
+                                        [[maybe_unused]] coordinate_t const & coordinate,
                                         [[maybe_unused]] alignment_optimum<score_t> & optimum) const noexcept
     {
         if constexpr (traits_type::find_in_last_row_type::value)
-            optimum = std::max(current, optimum, alignment_optimum_compare_less{});
+        {
+            optimum = std::max(alignment_optimum{score, static_cast<alignment_coordinate>(coordinate)},
+                               optimum,
+                               alignment_optimum_compare_less{});
+        }
+    }
+
+    /*!\brief Determines the optimum of one column of the dynamic programming matrix.
+     * \tparam rng_t   The type of the column; must model std::ranges::ForwardRange.
+     * \tparam score_t The type of the optimal score.
+     * \param[in]     rng            The column of the dynamic programming matrix.
+     * \param[in,out] column_optimum The column optimum to be updated.
+     *
+     * \details
+     *
+     * In contrast to the other check functions this function is independent of the configured traits. It is
+     * used by the seqan3::align_cfg::x_drop termination, which compares the optimum of every computed column
+     * with the running optimum of the matrix.
+     */
+    template <std::ranges::ForwardRange rng_t, typename score_t>
+    constexpr void check_score_column(rng_t const & rng, alignment_optimum<score_t> & column_optimum) const noexcept
+    {
+        using std::get;
+        ranges::for_each(rng, [&](auto && entry)
+        {
+            column_optimum = std::max(alignment_optimum<score_t>{get<0>(get<0>(entry)),
+                                                                 static_cast<alignment_coordinate>(get<1>(entry))},
+                                      column_optimum,
+                                      alignment_optimum_compare_less{});
+        });
     }
 
     /*!\brief Checks the complete last column for the optimal score.
@@ -0,0 +1,150 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::scoring_scheme_policy.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <type_traits>
+
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna15.hpp>
+#include <seqan3/core/metafunction/deferred_crtp_base.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Tests whether the given scheme scores every match and every mismatch with the same value.
+ * \ingroup alignment_policy
+ * \tparam score_t The score type of the scheme.
+ * \param[in] scheme The scheme to probe.
+ *
+ * \details
+ *
+ * Schemes with this property can be evaluated with a single equality test instead of the two-dimensional
+ * matrix lookup (see seqan3::detail::scoring_scheme_policy).
+ */
+template <Arithmetic score_t>
+constexpr bool is_simple_scoring_scheme(nucleotide_scoring_scheme<score_t> const & scheme) noexcept
+{
+    auto const match_score = scheme.score('A'_dna15, 'A'_dna15);
+    auto const mismatch_score = scheme.score('A'_dna15, 'C'_dna15);
+
+    for (size_t rank1 = 0; rank1 < alphabet_size_v<dna15>; ++rank1)
+        for (size_t rank2 = 0; rank2 < alphabet_size_v<dna15>; ++rank2)
+        {
+            auto const score = scheme.score(assign_rank(dna15{}, rank1), assign_rank(dna15{}, rank2));
+            if (score != ((rank1 == rank2) ? match_score : mismatch_score))
+                return false;
+        }
+
+    return true;
+}
+
+/*!\brief The default traits class for seqan3::detail::scoring_scheme_policy.
+ * \ingroup alignment_policy
+ *
+ * \details
+ *
+ * Scores every cell through the matrix lookup of the configured scoring scheme.
+ */
+struct default_scoring_scheme_trait
+{
+    //!\brief Disables the branchless match/mismatch fast path.
+    using use_simple_scheme_type = std::false_type;
+};
+
+/*!\brief A policy to compute the substitution score of two letters.
+ * \ingroup alignment_policy
+ * \tparam derived_t   The type of the derived class.
+ * \tparam traits_type A traits type that determines whether the simple scheme fast path is used.
+ *                     Defaults to seqan3::detail::default_scoring_scheme_trait.
+ *
+ * \details
+ *
+ * By default the score is delegated to the configured scoring scheme, i.e. a lookup in the two-dimensional
+ * substitution matrix. If the traits enable the simple scheme fast path, the match and mismatch score are
+ * cached once per alignment invocation and every cell is scored with a branchless compare-and-select on the
+ * letter ranks instead, avoiding the table walk in the innermost loop. The fast path is selected by the
+ * seqan3::detail::alignment_configurator if the configured scheme is a seqan3::nucleotide_scoring_scheme
+ * that fulfils seqan3::detail::is_simple_scoring_scheme.
+ */
+template <typename derived_t, typename traits_type = default_scoring_scheme_trait>
+class scoring_scheme_policy
+{
+private:
+
+    //!\brief Befriends the derived class to grant it access to the private members.
+    friend derived_t;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr scoring_scheme_policy() = default;                                          //!< Defaulted
+    constexpr scoring_scheme_policy(scoring_scheme_policy const &) = default;             //!< Defaulted
+    constexpr scoring_scheme_policy(scoring_scheme_policy &&) = default;                  //!< Defaulted
+    constexpr scoring_scheme_policy & operator=(scoring_scheme_policy const &) = default; //!< Defaulted
+    constexpr scoring_scheme_policy & operator=(scoring_scheme_policy &&) = default;      //!< Defaulted
+    ~scoring_scheme_policy() = default;                                                   //!< Defaulted
+    //!\}
+
+protected:
+
+    /*!\brief Caches the match and mismatch score of the scheme if the fast path is enabled.
+     * \tparam scheme_t The type of the scoring scheme.
+     * \param[in] scheme The configured scoring scheme.
+     *
+     * \details
+     *
+     * This function resolves to a "NO-OP" function if the trait for the simple scheme is set to std::false_type.
+     */
+    template <typename scheme_t>
+    constexpr void initialise_scoring_scheme([[maybe_unused]] scheme_t const & scheme) noexcept
+    {
+        if constexpr (traits_type::use_simple_scheme_type::value)
+        {
+            match_score = scheme.score('A'_dna15, 'A'_dna15);
+            mismatch_score = scheme.score('A'_dna15, 'C'_dna15);
+        }
+    }
+
+    /*!\brief Scores two letters with the configured scoring scheme.
+     * \tparam scheme_t The type of the scoring scheme.
+     * \tparam alph1_t  Type of the first letter.
+     * \tparam alph2_t  Type of the second letter.
+     * \param[in] scheme The configured scoring scheme.
+     * \param[in] alph1  The first letter to score.
+     * \param[in] alph2  The second letter to score.
+     * \returns The score of the two letters.
+     */
+    template <typename scheme_t, typename alph1_t, typename alph2_t>
+    constexpr auto score(scheme_t const & scheme, alph1_t const alph1, alph2_t const alph2) const noexcept
+    {
+        if constexpr (traits_type::use_simple_scheme_type::value)
+        {
+            // Compare-and-select on the ranks; compiles to a branchless conditional move.
+            return (to_rank(static_cast<dna15>(alph1)) == to_rank(static_cast<dna15>(alph2))) ? match_score
+                                                                                              : mismatch_score;
+        }
+        else
+        {
+            return scheme.score(alph1, alph2);
+        }
+    }
+
+private:
+
+    //!\brief The cached score of two matching letters; only used by the fast path.
+    int32_t match_score{};
+    //!\brief The cached score of two mismatching letters; only used by the fast path.
+    int32_t mismatch_score{};
+};
+
+} // namespace seqan3::detail
@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <memory>
 #include <vector>
 #include <tuple>
 
@@ -21,6 +22,8 @@
 #include <range/v3/view/zip.hpp>
 
 #include <seqan3/alignment/matrix/alignment_coordinate.hpp>
+#include <seqan3/alignment/pairwise/policy/alignment_matrix_arena.hpp>
+#include <seqan3/core/memory_stats.hpp>
 #include <seqan3/core/metafunction/range.hpp>
 #include <seqan3/range/shortcuts.hpp>
 #include <seqan3/std/span>
@@ -52,16 +55,40 @@ private:
     //!\}
 
     /*!\name Constructors, destructor and assignment
-     * \brief Defaulted all standard constructor.
+     * \brief Copies share the matrix arena but not the matrix, so the per-pair copies of the type-erased
+     *        alignment function recycle their buffers through the arena instead of duplicating them.
      * \{
      */
     constexpr unbanded_score_dp_matrix_policy() = default;                                               //!< Defaulted
-    constexpr unbanded_score_dp_matrix_policy(unbanded_score_dp_matrix_policy const &) = default;        //!< Defaulted
+
+    //!\brief Copies the policy without the matrix; the buffer is acquired from the shared arena on demand.
+    constexpr unbanded_score_dp_matrix_policy(unbanded_score_dp_matrix_policy const & other) :
+        dimension_first_range{other.dimension_first_range},
+        dimension_second_range{other.dimension_second_range},
+        current_column_index{other.current_column_index},
+        score_matrix_arena{other.score_matrix_arena}
+    {}
+
     constexpr unbanded_score_dp_matrix_policy(unbanded_score_dp_matrix_policy &&) = default;             //!< Defaulted
-    //!\brief Defaulted
-    constexpr unbanded_score_dp_matrix_policy & operator=(unbanded_score_dp_matrix_policy const &) = default;
+
+    //!\brief Copies the policy without the matrix; the own buffer is kept for reuse.
+    constexpr unbanded_score_dp_matrix_policy & operator=(unbanded_score_dp_matrix_policy const & other)
+    {
+        dimension_first_range = other.dimension_first_range;
+        dimension_second_range = other.dimension_second_range;
+        current_column_index = other.current_column_index;
+        score_matrix_arena = other.score_matrix_arena;
+        return *this;
+    }
+
     constexpr unbanded_score_dp_matrix_policy & operator=(unbanded_score_dp_matrix_policy &&) = default; //!< Defaulted
-    ~unbanded_score_dp_matrix_policy() = default;                                                        //!< Defaulted
+
+    //!\brief Returns the matrix buffer to the arena so that subsequent alignments can reuse its capacity.
+    ~unbanded_score_dp_matrix_policy()
+    {
+        if (score_matrix_arena != nullptr && score_matrix.capacity() != 0u)
+            score_matrix_arena->release(std::move(score_matrix));
+    }
     //!\}
 
     /*!\brief Allocates the memory for the dynamic programming matrix given the two sequences.
@@ -79,7 +106,12 @@ private:
         current_column_index = 0;
 
         // We use only one column to compute the score.
-        score_matrix.resize(dimension_second_range);
+        if (score_matrix.capacity() == 0u)
+            score_matrix = score_matrix_arena->acquire(dimension_second_range);
+        else
+            score_matrix.resize(dimension_second_range);
+
+        record_memory_use(memory_stats::subsystem::dp_matrix, dimension_second_range * sizeof(cell_type));
     }
 
     //!\brief Returns the current column of the alignment matrix.
@@ -95,20 +127,76 @@ private:
                                  ranges::view::repeat_n(std::ignore, dimension_second_range) | std::view::common);
     }
 
+    /*!\brief Returns the cells of the current column that lie within the given row interval.
+     * \param[in] row_begin The first row of the block.
+     * \param[in] row_end   The row behind the last row of the block.
+     *
+     * \details
+     *
+     * Used by the blocked alignment computation (see seqan3::align_cfg::tile) to restrict the column access to
+     * the rows of the active block, such that the working set stays within the cache for long second sequences.
+     */
+    constexpr auto current_block(size_t const row_begin, size_t const row_end) noexcept
+    {
+        assert(row_begin < row_end);
+        assert(row_end <= dimension_second_range);
+
+        advanceable_alignment_coordinate<advanceable_alignment_coordinate_state::row>
+            block_begin{column_index_type{current_column_index}, row_index_type{row_begin}};
+        advanceable_alignment_coordinate<advanceable_alignment_coordinate_state::row>
+            block_end{column_index_type{current_column_index}, row_index_type{row_end}};
+
+        return std::view::zip(std::span{score_matrix.data() + row_begin, row_end - row_begin},
+                                 std::view::iota(block_begin, block_end),
+                                 ranges::view::repeat_n(std::ignore, row_end - row_begin) | std::view::common);
+    }
+
     //!\brief Moves internal matrix pointer to the next column.
     constexpr void go_next_column() noexcept
     {
         ++current_column_index;
     }
 
+    /*!\name Initialisation column reuse
+     * \brief The initialisation column only depends on the number of rows and the gap scheme, which are fixed
+     *        per algorithm instance, hence it can be cached and reused for subsequent sequence pairs of the
+     *        same length, e.g. in a one-vs-many batch.
+     * \{
+     */
+    //!\brief Returns whether the cached initialisation column matches the current matrix dimension.
+    constexpr bool init_column_is_cached() const noexcept
+    {
+        return init_column_cache.size() == dimension_second_range;
+    }
+
+    //!\brief Stores a copy of the initialisation column for subsequent sequence pairs.
+    void snapshot_init_column()
+    {
+        init_column_cache.assign(std::ranges::begin(score_matrix), std::ranges::end(score_matrix));
+    }
+
+    //!\brief Restores the initialisation column from the cache.
+    void restore_init_column() noexcept
+    {
+        std::ranges::copy(init_column_cache, std::ranges::begin(score_matrix));
+    }
+    //!\}
+
     //!\brief The data container.
     score_matrix_type score_matrix{};
+    //!\brief The cached initialisation column (see init_column_is_cached).
+    score_matrix_type init_column_cache{};
     //!\brief Caches the size of the horizontal dimension (number of columns).
     size_t dimension_first_range  = 0;
     //!\brief Caches the size of the vertical dimension (number of rows).
     size_t dimension_second_range = 0;
     //!\brief The index of the active column.
     size_t current_column_index = 0;
+    //!\brief The arena recycling the matrix buffers over all copies of this policy.
+    std::shared_ptr<alignment_matrix_arena<score_matrix_type>> score_matrix_arena
+    {
+        new alignment_matrix_arena<score_matrix_type>{}
+    };
 };
 
 /*!\brief Returns only the score column of the current matrix column.
@@ -13,6 +13,8 @@
 #pragma once
 
 #include <deque>
+#include <memory>
+#include <utility>
 
 #include <range/v3/view/iota.hpp>
 #include <range/v3/view/reverse.hpp>
@@ -38,6 +40,94 @@ struct gap_segment
     size_t size;
 };
 
+/*!\brief Parses an unbanded trace matrix starting from the given coordinate.
+ * \ingroup alignment_policy
+ * \tparam trace_matrix_t The type of the trace matrix; its value type must be seqan3::detail::trace_directions.
+ * \param[in] trace_matrix           The trace matrix in column-major order.
+ * \param[in] dimension_second_range The number of rows of the trace matrix (size of the second range + 1).
+ * \param[in] back_coordinate        The coordinate from where to start the traceback.
+ *
+ * \returns A tuple containing the front coordinate and a deque with all seqan3::detail::gap_segment s for the
+ *          first sequence and the second sequence.
+ */
+template <typename trace_matrix_t>
+constexpr auto parse_trace_matrix(trace_matrix_t const & trace_matrix,
+                                  size_t const dimension_second_range,
+                                  alignment_coordinate const & back_coordinate)
+{
+    // Store the trace segments.
+    std::deque<gap_segment> first_segments{};
+    std::deque<gap_segment> second_segments{};
+
+    // Put the iterator to the position where the traceback starts.
+    auto direction_iter = std::ranges::begin(trace_matrix);
+    std::ranges::advance(direction_iter,
+                         back_coordinate.first * dimension_second_range + back_coordinate.second);
+
+    // Parse the trace until interrupt.
+    while (*direction_iter != trace_directions::none)
+    {
+        // parse until end of diagonal run
+        while (static_cast<bool>(*direction_iter & trace_directions::diagonal))
+        {
+            std::ranges::advance(direction_iter, -dimension_second_range - 1);
+        }
+
+        // parse vertical gap -> record gap in first_segments (will be translated into gap of first sequence)
+        if (static_cast<bool>(*direction_iter & trace_directions::up) ||
+            static_cast<bool>(*direction_iter & trace_directions::up_open))
+        {
+            // Get the current column index (note the column based layout)
+            size_t pos = std::ranges::distance(std::ranges::begin(trace_matrix), direction_iter) /
+                         dimension_second_range;
+            gap_segment gap{pos, 0u};
+
+            // Follow gap until open signal is detected.
+            while (!static_cast<bool>(*direction_iter & trace_directions::up_open))
+            {
+                --direction_iter;
+                ++gap.size;
+            }
+            // explicitly follow opening gap
+            --direction_iter;
+            ++gap.size;
+            // record the gap
+            first_segments.push_front(std::move(gap));
+            continue;
+        }
+        // parse horizontal gap -> record gap in second_segments (will be translated into gap of second sequence)
+        if (static_cast<bool>(*direction_iter & trace_directions::left) ||
+            static_cast<bool>(*direction_iter & trace_directions::left_open))
+        {
+            // Get the current row index (note the column based layout)
+            size_t pos = std::ranges::distance(std::ranges::begin(trace_matrix), direction_iter) %
+                         dimension_second_range;
+            gap_segment gap{pos, 0u};
+
+            // Follow gap until open signal is detected.
+            while (!static_cast<bool>(*direction_iter & trace_directions::left_open))
+            {
+                std::ranges::advance(direction_iter, -dimension_second_range);
+                ++gap.size;
+            }
+            // explicitly follow opening gap
+            std::ranges::advance(direction_iter, -dimension_second_range);
+            ++gap.size;
+            second_segments.push_front(std::move(gap));
+        }
+    }
+
+    // Get front coordinate.
+    auto c = column_index_type{std::ranges::distance(std::ranges::begin(trace_matrix), direction_iter) /
+                               dimension_second_range};
+    auto r = row_index_type{std::ranges::distance(std::ranges::begin(trace_matrix), direction_iter) %
+                            dimension_second_range};
+
+    return std::tuple{alignment_coordinate{column_index_type{std::move(c)}, row_index_type{std::move(r)}},
+                      first_segments,
+                      second_segments};
+}
+
 /*!\brief Manages the allocation and provision of an unbanded dynamic programming matrix.
  * \ingroup alignment_policy
  * \tparam derived_t   The derived alignment algorithm.
@@ -90,17 +180,36 @@ private:
     //!\}
 
     /*!\name Constructors, destructor and assignment
+     * \brief Copies share the matrix arenas but not the matrices (see the base policy for the rationale).
      * \{
      */
     constexpr unbanded_score_trace_dp_matrix_policy() = default;                                         //!< Defaulted
-    //!\brief Defaulted
-    constexpr unbanded_score_trace_dp_matrix_policy(unbanded_score_trace_dp_matrix_policy const &) = default;
+
+    //!\brief Copies the policy without the trace matrix; the buffer is acquired from the shared arena on demand.
+    constexpr unbanded_score_trace_dp_matrix_policy(unbanded_score_trace_dp_matrix_policy const & other) :
+        base_t{other},
+        trace_matrix_arena{other.trace_matrix_arena}
+    {}
+
     constexpr unbanded_score_trace_dp_matrix_policy(unbanded_score_trace_dp_matrix_policy &&) = default; //!< Defaulted
-    //!\brief Defaulted
-    constexpr unbanded_score_trace_dp_matrix_policy & operator=(unbanded_score_trace_dp_matrix_policy const &) = default;
+
+    //!\brief Copies the policy without the trace matrix; the own buffer is kept for reuse.
+    constexpr unbanded_score_trace_dp_matrix_policy & operator=(unbanded_score_trace_dp_matrix_policy const & other)
+    {
+        base_t::operator=(other);
+        trace_matrix_arena = other.trace_matrix_arena;
+        return *this;
+    }
+
     //!\brief Defaulted
     constexpr unbanded_score_trace_dp_matrix_policy & operator=(unbanded_score_trace_dp_matrix_policy &&) = default;
-    ~unbanded_score_trace_dp_matrix_policy() = default;                                                  //!< Defaulted
+
+    //!\brief Returns the trace matrix buffer to the arena so that subsequent alignments can reuse its capacity.
+    ~unbanded_score_trace_dp_matrix_policy()
+    {
+        if (trace_matrix_arena != nullptr && trace_matrix.capacity() != 0u)
+            trace_matrix_arena->release(std::move(trace_matrix));
+    }
     //!\}
 
     /*!\brief Allocates the memory for the dynamic programming matrix given the two sequences.
@@ -115,8 +224,14 @@ private:
         base_t::allocate_matrix(first_range, second_range);
 
         // We use the full matrix to store the trace direction.
-        trace_matrix.resize(dimension_first_range * dimension_second_range);
+        if (trace_matrix.capacity() == 0u)
+            trace_matrix = trace_matrix_arena->acquire(dimension_first_range * dimension_second_range);
+        else
+            trace_matrix.resize(dimension_first_range * dimension_second_range);
         trace_matrix_iter = trace_matrix.begin();
+
+        record_memory_use(memory_stats::subsystem::trace_matrix,
+                          dimension_first_range * dimension_second_range * sizeof(trace_directions));
     }
 
     //!\brief Returns the current column of the alignment matrix.
@@ -147,77 +262,19 @@ private:
      */
     constexpr auto parse_traceback(alignment_coordinate const & back_coordinate)
     {
-        // Store the trace segments.
-        std::deque<gap_segment> first_segments{};
-        std::deque<gap_segment> second_segments{};
-
-        // Put the iterator to the position where the traceback starts.
-        auto direction_iter = std::ranges::begin(trace_matrix);
-        std::ranges::advance(direction_iter,
-                             back_coordinate.first * dimension_second_range + back_coordinate.second);
-
-        // Parse the trace until interrupt.
-        while (*direction_iter != trace_directions::none)
-        {
-            // parse until end of diagonal run
-            while (static_cast<bool>(*direction_iter & trace_directions::diagonal))
-            {
-                std::ranges::advance(direction_iter, -dimension_second_range - 1);
-            }
-
-            // parse vertical gap -> record gap in first_segments (will be translated into gap of first sequence)
-            if (static_cast<bool>(*direction_iter & trace_directions::up) ||
-                static_cast<bool>(*direction_iter & trace_directions::up_open))
-            {
-                // Get the current column index (note the column based layout)
-                size_t pos = std::ranges::distance(std::ranges::begin(trace_matrix), direction_iter) /
-                             dimension_second_range;
-                gap_segment gap{pos, 0u};
-
-                // Follow gap until open signal is detected.
-                while (!static_cast<bool>(*direction_iter & trace_directions::up_open))
-                {
-                    --direction_iter;
-                    ++gap.size;
-                }
-                // explicitly follow opening gap
-                --direction_iter;
-                ++gap.size;
-                // record the gap
-                first_segments.push_front(std::move(gap));
-                continue;
-            }
-            // parse horizontal gap -> record gap in second_segments (will be translated into gap of second sequence)
-            if (static_cast<bool>(*direction_iter & trace_directions::left) ||
-                static_cast<bool>(*direction_iter & trace_directions::left_open))
-            {
-                // Get the current row index (note the column based layout)
-                size_t pos = std::ranges::distance(std::ranges::begin(trace_matrix), direction_iter) %
-                             dimension_second_range;
-                gap_segment gap{pos, 0u};
-
-                // Follow gap until open signal is detected.
-                while (!static_cast<bool>(*direction_iter & trace_directions::left_open))
-                {
-                    std::ranges::advance(direction_iter, -dimension_second_range);
-                    ++gap.size;
-                }
-                // explicitly follow opening gap
-                std::ranges::advance(direction_iter, -dimension_second_range);
-                ++gap.size;
-                second_segments.push_front(std::move(gap));
-            }
-        }
-
-        // Get front coordinate.
-        auto c = column_index_type{std::ranges::distance(std::ranges::begin(trace_matrix), direction_iter) /
-                                   dimension_second_range};
-        auto r = row_index_type{std::ranges::distance(std::ranges::begin(trace_matrix), direction_iter) %
-                                dimension_second_range};
+        return parse_trace_matrix(trace_matrix, dimension_second_range, back_coordinate);
+    }
 
-        return std::tuple{alignment_coordinate{column_index_type{std::move(c)}, row_index_type{std::move(r)}},
-                          first_segments,
-                          second_segments};
+    /*!\brief Moves the trace matrix out of this policy, e.g. to defer the traceback.
+     *
+     * \details
+     *
+     * The next call to allocate_matrix acquires a fresh buffer from the arena, such that the extracted matrix
+     * can outlive the computation of subsequent sequence pairs.
+     */
+    trace_matrix_type extract_trace_matrix() noexcept
+    {
+        return std::exchange(trace_matrix, trace_matrix_type{});
     }
 
     //!\brief Helper function to print the trace matrix; for debugging only.
@@ -253,6 +310,11 @@ private:
 
     //!\brief The data container.
     trace_matrix_type trace_matrix{};
+    //!\brief The arena recycling the trace matrix buffers over all copies of this policy.
+    std::shared_ptr<alignment_matrix_arena<trace_matrix_type>> trace_matrix_arena
+    {
+        new alignment_matrix_arena<trace_matrix_type>{}
+    };
     //!\brief The current iterator in the trace matrix.
     std::ranges::iterator_t<trace_matrix_type> trace_matrix_iter{};
 };
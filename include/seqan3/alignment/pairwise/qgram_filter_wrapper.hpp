@@ -0,0 +1,166 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::qgram_filter_wrapper.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+
+#include <seqan3/alignment/configuration/align_config_qgram_filter.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/pairwise/align_result_selector.hpp>
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/metafunction/range.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief This type wraps an alignment algorithm with the q-gram pre-filter.
+ * \implements std::Invocable
+ * \tparam config_t    The configuration type.
+ * \tparam algorithm_t The type-erased alignment algorithm to wrap.
+ *
+ * \details
+ *
+ * On invocation the wrapper counts the number of shared q-grams of the two sequences, i.e. the size of the
+ * multiset intersection of their q-gram contents, in linear time. Only if the count reaches the threshold of the
+ * seqan3::align_cfg::qgram_filter configuration the call is delegated to the wrapped alignment algorithm;
+ * otherwise the dynamic programming computation is skipped entirely and a seqan3::alignment_result flagged as
+ * filtered is returned (see seqan3::alignment_result::is_filtered). The interface is identical to the wrapped
+ * algorithm, such that the wrapper transparently plugs into the execution model of the pairwise alignment.
+ */
+template <typename config_t, typename algorithm_t>
+class qgram_filter_wrapper
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr qgram_filter_wrapper() = default;                                        //!< Defaulted
+    constexpr qgram_filter_wrapper(qgram_filter_wrapper const &) = default;            //!< Defaulted
+    constexpr qgram_filter_wrapper(qgram_filter_wrapper &&) = default;                 //!< Defaulted
+    constexpr qgram_filter_wrapper & operator=(qgram_filter_wrapper const &) = default;//!< Defaulted
+    constexpr qgram_filter_wrapper & operator=(qgram_filter_wrapper &&) = default;     //!< Defaulted
+    ~qgram_filter_wrapper() = default;                                                 //!< Defaulted
+
+    /*!\brief Constructs the wrapper with the passed configuration and the algorithm to wrap.
+     * \param cfg       The configuration holding the seqan3::align_cfg::qgram_filter element.
+     * \param algorithm The configured alignment algorithm invoked for the pairs that pass the filter.
+     *
+     * \details
+     *
+     * The configuration is copied once to the heap during construction and maintained by a std::shared_ptr,
+     * since the function object is stored in a std::function which requires copyable objects and in parallel
+     * executions the function object must be copied as well.
+     */
+    constexpr qgram_filter_wrapper(config_t const & cfg, algorithm_t algorithm) :
+        cfg_ptr{new config_t(cfg)}, algorithm{std::move(algorithm)}
+    {}
+    //!\}
+
+    /*!\brief Counts the shared q-grams and invokes the alignment computation only if the threshold is reached.
+     * \tparam    first_range_t  The type of the first sequence; must model std::ForwardRange.
+     * \tparam    second_range_t The type of the second sequence; must model std::ForwardRange.
+     * \param[in] first_range    The first sequence.
+     * \param[in] second_range   The second sequence.
+     */
+    template <std::ranges::ForwardRange first_range_t, std::ranges::ForwardRange second_range_t>
+    constexpr auto operator()(first_range_t && first_range, second_range_t && second_range)
+    {
+        using std::get;
+        auto const & scheme = get<align_cfg::qgram_filter>(*cfg_ptr).value;
+
+        if (shared_qgram_count(first_range, second_range, scheme.size) >= scheme.threshold)
+            return algorithm(first_range, second_range);
+
+        using result_t = typename align_result_selector<remove_cvref_t<first_range_t>,
+                                                        remove_cvref_t<second_range_t>,
+                                                        remove_cvref_t<config_t>>::type;
+        result_t res{};
+        res.filtered = true;
+        return alignment_result{res};
+    }
+
+private:
+    /*!\brief Counts the number of shared q-grams of the two sequences.
+     * \tparam    first_range_t  The type of the first sequence.
+     * \tparam    second_range_t The type of the second sequence.
+     * \param[in] first_range    The first sequence.
+     * \param[in] second_range   The second sequence.
+     * \param[in] size           The length of the counted q-grams.
+     * \returns The size of the multiset intersection of the q-gram contents of the two sequences.
+     *
+     * \throws seqan3::invalid_alignment_configuration if the q-gram hashes of the sequence alphabet are not
+     *         representable in one machine word.
+     */
+    template <typename first_range_t, typename second_range_t>
+    uint32_t shared_qgram_count(first_range_t & first_range,
+                                second_range_t & second_range,
+                                uint8_t const size) const
+    {
+        using alphabet_t = value_type_t<remove_cvref_t<first_range_t>>;
+        constexpr uint64_t sigma = alphabet_size_v<alphabet_t>;
+
+        // The hash of a q-gram is its rank in the lexicographic enumeration of all q-grams, i.e. a number
+        // below sigma^q; the rolling computation below additionally multiplies one hash with sigma.
+        uint64_t modulus = 1;
+        for (uint8_t i = 0; i <= size; ++i)
+        {
+            if (modulus > std::numeric_limits<uint64_t>::max() / sigma)
+            {
+                throw invalid_alignment_configuration{"The configured q-gram size exceeds the representable "
+                                                      "hash space of the sequence alphabet."};
+            }
+            if (i < size)
+                modulus *= sigma;
+        }
+
+        auto for_each_qgram = [size, modulus] (auto & range, auto && on_qgram)
+        {
+            uint64_t hash = 0;
+            size_t length = 0;
+            for (auto const & symbol : range)
+            {
+                hash = (hash * sigma + to_rank(symbol)) % modulus;
+                if (++length >= size)
+                    on_qgram(hash);
+            }
+        };
+
+        // Count the q-gram content of the first sequence and consume it with the q-grams of the second one.
+        std::unordered_map<uint64_t, uint32_t> qgram_counts{};
+        for_each_qgram(first_range, [&] (uint64_t const hash) { ++qgram_counts[hash]; });
+
+        uint32_t shared = 0;
+        for_each_qgram(second_range, [&] (uint64_t const hash)
+        {
+            if (auto it = qgram_counts.find(hash); it != qgram_counts.end() && it->second > 0u)
+            {
+                --(it->second);
+                ++shared;
+            }
+        });
+
+        return shared;
+    }
+
+    //!\brief The alignment configuration stored on the heap.
+    std::shared_ptr<config_t> cfg_ptr{};
+    //!\brief The wrapped alignment algorithm.
+    algorithm_t algorithm{};
+};
+
+} // namespace seqan3::detail
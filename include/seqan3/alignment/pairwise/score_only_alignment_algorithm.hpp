@@ -0,0 +1,174 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::score_only_alignment_algorithm.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_result_selector.hpp>
+#include <seqan3/alignment/pairwise/alignment_parameter_block.hpp>
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/scoring/gap_scheme.hpp>
+#include <seqan3/core/metafunction/basic.hpp>
+#include <seqan3/core/tracing.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes the score of a global alignment keeping only two rolling score vectors.
+ * \implements std::Invocable
+ * \ingroup pairwise_alignment
+ * \tparam config_t The configuration type.
+ *
+ * \details
+ *
+ * The general seqan3::detail::alignment_algorithm threads coordinate and optimum bookkeeping through its policy
+ * chain because some result configurations need them. When only the score of a global alignment without free end
+ * gaps is requested, the optimum is known to lie in the last cell of the matrix and no coordinate is ever
+ * reported. This kernel exploits that: it maintains one vector with the optimal scores and one vector with the
+ * scores ending in a horizontal gap of the current column and nothing else, such that the inner loop consists of
+ * the plain affine gap cost recursion without any per-cell bookkeeping.
+ *
+ * This function object is selected by the seqan3::detail::alignment_configurator for the global score-only
+ * alignment without free end gaps and without a special processing mode (band, tiling, x-drop termination) and
+ * offers the same invocation interface as the other alignment kernels.
+ */
+template <typename config_t>
+class score_only_alignment_algorithm
+{
+private:
+    //!\brief The type of the score.
+    using score_type = int32_t;
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr score_only_alignment_algorithm()                                                      = default; //!< Defaulted
+    constexpr score_only_alignment_algorithm(score_only_alignment_algorithm const &)                = default; //!< Defaulted
+    constexpr score_only_alignment_algorithm(score_only_alignment_algorithm &&)                     = default; //!< Defaulted
+    constexpr score_only_alignment_algorithm & operator=(score_only_alignment_algorithm const &)    = default; //!< Defaulted
+    constexpr score_only_alignment_algorithm & operator=(score_only_alignment_algorithm &&)         = default; //!< Defaulted
+    ~score_only_alignment_algorithm()                                                               = default; //!< Defaulted
+
+    /*!\brief Constructs the algorithm with the passed configuration.
+     * \param cfg The configuration to be passed to the algorithm.
+     *
+     * \details
+     *
+     * Resolves all configuration values the kernel reads once into a flattened
+     * seqan3::detail::alignment_parameter_block stored by value.
+     */
+    explicit constexpr score_only_alignment_algorithm(config_t const & cfg) :
+        params{make_alignment_parameter_block(cfg)}
+    {}
+    //!\}
+
+    /*!\brief Invokes the actual alignment computation given two sequences.
+     * \tparam    first_range_t  The type of the first sequence; must model std::ForwardRange.
+     * \tparam    second_range_t The type of the second sequence; must model std::ForwardRange.
+     * \param[in] first_range    The first sequence.
+     * \param[in] second_range   The second sequence.
+     *
+     * \details
+     *
+     * ### Exception
+     *
+     * Strong exception guarantee.
+     *
+     * ### Thread-safety
+     *
+     * Calls to this functions in a concurrent environment are not thread safe. Instead use a copy of the alignment
+     * algorithm type.
+     *
+     * ### Complexity
+     *
+     * The code always runs in \f$ O(N^2) \f$ time and requires \f$ O(N) \f$ space.
+     */
+    template <std::ranges::ForwardRange first_range_t, std::ranges::ForwardRange second_range_t>
+    auto operator()(first_range_t && first_range, second_range_t && second_range)
+    {
+        SEQAN3_TRACE_SCOPE("align::score_only_kernel");
+
+        using result_t = typename align_result_selector<remove_cvref_t<first_range_t>,
+                                                        remove_cvref_t<second_range_t>,
+                                                        config_t>::type;
+
+        auto const & scheme = params.scoring;
+        auto const & gaps = params.gap;
+        score_type const gap_extend = gaps.get_gap_score();
+        score_type const gap_open = gaps.get_gap_open_score() + gap_extend;
+
+        size_t const second_size = static_cast<size_t>(std::ranges::distance(second_range));
+
+        // The rolling vectors are members, such that streaming many pairs through one kernel instance does not
+        // allocate per pair; optimal[row] holds the optimal score, horizontal[row] the score ending in a
+        // horizontal gap of the current column.
+        optimal.resize(second_size + 1);
+        horizontal.resize(second_size + 1);
+
+        // Initialise the first column; without free end gaps every initialisation cell pays the gap costs.
+        optimal[0] = 0;
+        horizontal[0] = gap_open;
+        for (size_t row = 1; row <= second_size; ++row)
+        {
+            optimal[row] = gap_open + static_cast<score_type>(row - 1) * gap_extend;
+            horizontal[row] = optimal[row] + gap_open;
+        }
+
+        size_t column_index = 0;
+        for (auto const & first_symbol : first_range)
+        {
+            score_type diagonal = optimal[0];
+            optimal[0] = gap_open + static_cast<score_type>(column_index) * gap_extend;
+            score_type vertical = optimal[0] + gap_open;
+            ++column_index;
+
+            size_t row = 1;
+            for (auto const & second_symbol : second_range)
+            {
+                score_type const substituted =
+                    diagonal + static_cast<score_type>(scheme.score(first_symbol, second_symbol));
+                score_type const best_horizontal = std::max(optimal[row] + gap_open,
+                                                            horizontal[row] + gap_extend);
+                score_type const best = std::max({substituted, best_horizontal, vertical});
+
+                diagonal = optimal[row];
+                optimal[row] = best;
+                horizontal[row] = best_horizontal;
+                vertical = std::max(best + gap_open, vertical + gap_extend);
+                ++row;
+            }
+        }
+
+        // In the global alignment without free end gaps the optimum lies in the last cell of the matrix.
+        result_t res{};
+        res.score = optimal[second_size];
+        return alignment_result{res};
+    }
+
+private:
+    //!\brief The rolling vector with the optimal scores of the current column.
+    std::vector<score_type> optimal{};
+    //!\brief The rolling vector with the scores ending in a horizontal gap of the current column.
+    std::vector<score_type> horizontal{};
+
+    //!\brief The configuration values resolved once into a flattened block stored by value.
+    alignment_parameter_block_t<config_t> params{};
+};
+
+} // namespace seqan3::detail
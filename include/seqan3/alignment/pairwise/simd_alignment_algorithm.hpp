@@ -0,0 +1,527 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::simd_alignment_algorithm.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_result_selector.hpp>
+#include <seqan3/alignment/pairwise/alignment_parameter_block.hpp>
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/scoring/gap_scheme.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/metafunction/range.hpp>
+#include <seqan3/core/simd/simd.hpp>
+#include <seqan3/core/simd/simd_algorithm.hpp>
+#include <seqan3/core/simd/simd_traits.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief The alignment algorithm to compute multiple pairwise alignments simultaneously using an
+ *        inter-sequence SIMD vectorisation.
+ * \ingroup pairwise_alignment
+ * \tparam config_t The configuration type; must be of type seqan3::configuration.
+ *
+ * \details
+ *
+ * This algorithm packs one cell of many independent sequence pairs into each lane of a seqan3::simd::simd_type
+ * vector and computes the affine gap cost recursion over all lanes at once.
+ * Sequences within one batch are padded to the longest sequence of the batch using a padding rank that can never
+ * match, such that cells beyond a pair's own matrix dimensions do not influence its final score. The final score
+ * of every lane is extracted from the cell corresponding to the lane's own matrix dimensions.
+ *
+ * Since the cost of a batch is dominated by the longest sequence of the batch, pairs of dissimilar lengths waste
+ * the lanes of the shorter pairs on padding. Before the batches are formed, the pairs are therefore ordered by
+ * bands of their longest sequence length with a counting sort over the band histogram, such that pairs of similar
+ * length share a batch. Every result keeps the id of the pair's input position and the result vector is re-sorted
+ * by id at the end, i.e. the batching stage is not observable in the reported order.
+ *
+ * Every batch is first computed with an 8-bit score type, which packs the most lanes into one vector. All score
+ * additions saturate at the limits of the score type (see seqan3::simd::saturated_add), such that an overflowing
+ * lane cannot corrupt the comparisons of its neighbours. Lanes whose scores reached a limit of the score type are
+ * detected during the computation and only these lanes are recomputed with the next wider score type (16-bit,
+ * then 32-bit), so that long or high scoring pairs stay exact while the common case runs at full lane count.
+ *
+ * The algorithm is selected by the seqan3::align_cfg::vectorise configuration element and currently computes the
+ * score only. It requires a simple scoring scheme, i.e. a scheme that assigns one score for a match and one score
+ * for a mismatch independent of the compared symbols.
+ */
+template <typename config_t>
+class simd_alignment_algorithm
+{
+private:
+    //!\brief The scalar score type in which the final scores are exact.
+    using score_t = int32_t;
+
+    //!\brief The number of alignments gathered per batch; the lane count of the narrowest score type.
+    static constexpr size_t simd_length = simd_traits<simd_type_t<int8_t>>::length;
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr simd_alignment_algorithm()                                             = default; //!< Defaulted
+    constexpr simd_alignment_algorithm(simd_alignment_algorithm const &)             = default; //!< Defaulted
+    constexpr simd_alignment_algorithm(simd_alignment_algorithm &&)                  = default; //!< Defaulted
+    constexpr simd_alignment_algorithm & operator=(simd_alignment_algorithm const &) = default; //!< Defaulted
+    constexpr simd_alignment_algorithm & operator=(simd_alignment_algorithm &&)      = default; //!< Defaulted
+    ~simd_alignment_algorithm()                                                      = default; //!< Defaulted
+
+    /*!\brief Constructs the algorithm with the passed configuration.
+     * \param cfg The configuration to be passed to the algorithm.
+     */
+    explicit constexpr simd_alignment_algorithm(config_t const & cfg) :
+        params{make_alignment_parameter_block(cfg)}
+    {}
+    //!\}
+
+    /*!\brief Computes the pairwise alignments for all sequence pairs in batches of `simd_length` many alignments.
+     * \tparam    sequence_pairs_t The range type over the sequence pairs; must model std::ranges::ForwardRange.
+     * \param[in] sequence_pairs   The range over the sequence pairs to align.
+     * \param[in] first_id         The id assigned to the first alignment; subsequent alignments count up from it.
+     * \returns A std::vector over seqan3::alignment_result with one score per sequence pair in order of the input.
+     */
+    template <std::ranges::ForwardRange sequence_pairs_t>
+    auto operator()(sequence_pairs_t && sequence_pairs, uint32_t const first_id = 0)
+    {
+        using first_range_t  = remove_cvref_t<std::tuple_element_t<0, value_type_t<sequence_pairs_t>>>;
+        using second_range_t = remove_cvref_t<std::tuple_element_t<1, value_type_t<sequence_pairs_t>>>;
+        using alphabet1_t = value_type_t<first_range_t>;
+        using alphabet2_t = value_type_t<second_range_t>;
+        using result_value_t = typename align_result_selector<first_range_t, second_range_t, config_t>::type;
+        using result_t = alignment_result<result_value_t>;
+
+        static_assert(!config_t::template exists<align_cfg::band>(),
+                      "The vectorised alignment does not support the banded alignment yet.");
+        static_assert(!config_t::template exists<align_cfg::result<with_back_coordinate_type>>() &&
+                      !config_t::template exists<align_cfg::result<with_front_coordinate_type>>() &&
+                      !config_t::template exists<align_cfg::result<with_alignment_type>>(),
+                      "The vectorised alignment supports only the score computation yet.");
+
+        using std::get;
+        auto const & scheme = params.scoring;
+
+        // Probe the simple scoring scheme for the match and mismatch score.
+        score_t const match_score =
+            scheme.score(assign_rank(alphabet1_t{}, 0), assign_rank(alphabet2_t{}, 0));
+        score_t const mismatch_score =
+            scheme.score(assign_rank(alphabet1_t{}, 0), assign_rank(alphabet2_t{}, 1));
+
+        std::vector<result_t> results{};
+
+        // Materialise the rank representations of all pairs, such that the batches can be formed from the
+        // length-sorted order instead of the input order.
+        std::vector<std::vector<score_t>> first_sequences{};
+        std::vector<std::vector<score_t>> second_sequences{};
+        for (auto && sequence_pair : sequence_pairs)
+        {
+            auto & first_ranks = first_sequences.emplace_back();
+            auto & second_ranks = second_sequences.emplace_back();
+            for (auto const & symbol : get<0>(sequence_pair))
+                first_ranks.push_back(static_cast<score_t>(to_rank(symbol)));
+            for (auto const & symbol : get<1>(sequence_pair))
+                second_ranks.push_back(static_cast<score_t>(to_rank(symbol)));
+        }
+
+        // Gather the pairs into batches in the order of their length bands and flush whenever all lanes are
+        // occupied; every lane remembers the input position of its pair as the id of its result.
+        std::array<std::vector<score_t>, simd_length> first_batch{};
+        std::array<std::vector<score_t>, simd_length> second_batch{};
+        std::array<uint32_t, simd_length> lane_ids{};
+
+        size_t lane = 0;
+        for (size_t const pair_index : sorted_batch_order(first_sequences, second_sequences))
+        {
+            first_batch[lane] = std::move(first_sequences[pair_index]);
+            second_batch[lane] = std::move(second_sequences[pair_index]);
+            lane_ids[lane] = first_id + static_cast<uint32_t>(pair_index);
+
+            if (++lane == simd_length)
+            {
+                compute_batch<result_value_t>(first_batch, second_batch, lane,
+                                              match_score, mismatch_score, lane_ids, results);
+                lane = 0;
+            }
+        }
+
+        if (lane > 0)
+            compute_batch<result_value_t>(first_batch, second_batch, lane,
+                                          match_score, mismatch_score, lane_ids, results);
+
+        // Restore the input order, which the length-sorted batches permuted.
+        std::sort(results.begin(), results.end(),
+                  [] (result_t const & lhs, result_t const & rhs) { return lhs.id() < rhs.id(); });
+
+        return results;
+    }
+
+private:
+    //!\brief The width of one length band; pairs whose longest sequences fall into one band share a batch.
+    static constexpr size_t length_band_width = 16;
+
+    /*!\brief Orders the pairs by bands of their longest sequence length.
+     * \param[in] first_sequences  The rank representations of the first sequences per pair.
+     * \param[in] second_sequences The rank representations of the second sequences per pair.
+     * \returns The pair indices in the order in which the pairs are gathered into batches.
+     *
+     * \details
+     *
+     * The band of a pair is the length of its longer sequence divided by #length_band_width. The indices are
+     * ordered with a counting sort over the band histogram, which is stable, i.e. pairs of one band keep their
+     * input order. Filling the batches from this order keeps the padding to the longest pair of a batch small.
+     *
+     * ### Complexity
+     *
+     * Linear in the number of pairs plus the number of occupied bands.
+     */
+    static std::vector<size_t> sorted_batch_order(std::vector<std::vector<score_t>> const & first_sequences,
+                                                  std::vector<std::vector<score_t>> const & second_sequences)
+    {
+        size_t const pair_count = first_sequences.size();
+
+        std::vector<size_t> bands(pair_count);
+        size_t max_band = 0;
+        for (size_t pair_index = 0; pair_index < pair_count; ++pair_index)
+        {
+            bands[pair_index] = std::max(first_sequences[pair_index].size(),
+                                         second_sequences[pair_index].size()) / length_band_width;
+            max_band = std::max(max_band, bands[pair_index]);
+        }
+
+        // Accumulate the histogram into the first index of every band.
+        std::vector<size_t> band_offsets(max_band + 2, 0);
+        for (size_t const band : bands)
+            ++band_offsets[band + 1];
+        for (size_t band = 1; band < band_offsets.size(); ++band)
+            band_offsets[band] += band_offsets[band - 1];
+
+        std::vector<size_t> order(pair_count);
+        for (size_t pair_index = 0; pair_index < pair_count; ++pair_index)
+            order[band_offsets[bands[pair_index]]++] = pair_index;
+
+        return order;
+    }
+
+    /*!\brief Computes one batch of at most `simd_length` many alignments and appends the results.
+     * \tparam        result_value_t The alignment result value type to generate.
+     * \tparam        result_t       The alignment result type stored in `results`.
+     * \param[in]     first_batch    The rank representations of the first sequences per lane.
+     * \param[in]     second_batch   The rank representations of the second sequences per lane.
+     * \param[in]     batch_size     The number of occupied lanes.
+     * \param[in]     match_score    The score for a match.
+     * \param[in]     mismatch_score The score for a mismatch.
+     * \param[in]     lane_ids       The result id per lane, i.e. the input position of the lane's pair.
+     * \param[in,out] results        The container to append the alignment results to.
+     *
+     * \details
+     *
+     * Runs the whole batch with the 8-bit score type first and then escalates only the saturated lanes to the
+     * 16-bit and finally the exact 32-bit score type.
+     */
+    template <typename result_value_t, typename result_t>
+    void compute_batch(std::array<std::vector<score_t>, simd_length> const & first_batch,
+                       std::array<std::vector<score_t>, simd_length> const & second_batch,
+                       size_t const batch_size,
+                       score_t const match_score,
+                       score_t const mismatch_score,
+                       std::array<uint32_t, simd_length> const & lane_ids,
+                       std::vector<result_t> & results)
+    {
+        std::array<score_t, simd_length> final_scores{};
+        std::array<bool, simd_length> saturated{};
+
+        compute_scores<int8_t>(first_batch, second_batch, batch_size,
+                               match_score, mismatch_score, final_scores, saturated);
+        escalate_saturated_lanes<int16_t>(first_batch, second_batch, batch_size,
+                                          match_score, mismatch_score, final_scores, saturated);
+        escalate_saturated_lanes<int32_t>(first_batch, second_batch, batch_size,
+                                          match_score, mismatch_score, final_scores, saturated);
+
+        for (size_t lane = 0; lane < batch_size; ++lane)
+        {
+            result_value_t res{};
+            res.id = lane_ids[lane];
+            res.score = final_scores[lane];
+            results.emplace_back(res);
+        }
+    }
+
+    /*!\brief Recomputes the saturated lanes of a batch with a wider score type.
+     * \tparam        batch_score_t  The wider score type to recompute the flagged lanes with.
+     * \param[in]     first_batch    The rank representations of the first sequences per lane.
+     * \param[in]     second_batch   The rank representations of the second sequences per lane.
+     * \param[in]     batch_size     The number of occupied lanes.
+     * \param[in]     match_score    The score for a match.
+     * \param[in]     mismatch_score The score for a mismatch.
+     * \param[in,out] final_scores   The final scores per lane; overwritten for the recomputed lanes.
+     * \param[in,out] saturated      The saturation flags per lane; reset for lanes that are now exact.
+     *
+     * \details
+     *
+     * The flagged lanes are compacted into a fresh batch, such that the recomputation runs at the full lane
+     * count of the wider score type, and the recomputed scores are scattered back to their original lanes.
+     */
+    template <typename batch_score_t>
+    void escalate_saturated_lanes(std::array<std::vector<score_t>, simd_length> const & first_batch,
+                                  std::array<std::vector<score_t>, simd_length> const & second_batch,
+                                  size_t const batch_size,
+                                  score_t const match_score,
+                                  score_t const mismatch_score,
+                                  std::array<score_t, simd_length> & final_scores,
+                                  std::array<bool, simd_length> & saturated)
+    {
+        std::array<std::vector<score_t>, simd_length> sub_first{};
+        std::array<std::vector<score_t>, simd_length> sub_second{};
+        std::array<size_t, simd_length> origin{};
+
+        size_t sub_size = 0;
+        for (size_t lane = 0; lane < batch_size; ++lane)
+        {
+            if (saturated[lane])
+            {
+                sub_first[sub_size] = first_batch[lane];
+                sub_second[sub_size] = second_batch[lane];
+                origin[sub_size] = lane;
+                ++sub_size;
+            }
+        }
+
+        if (sub_size == 0)
+            return;
+
+        std::array<score_t, simd_length> sub_scores{};
+        std::array<bool, simd_length> sub_saturated{};
+        compute_scores<batch_score_t>(sub_first, sub_second, sub_size,
+                                      match_score, mismatch_score, sub_scores, sub_saturated);
+
+        for (size_t index = 0; index < sub_size; ++index)
+        {
+            final_scores[origin[index]] = sub_scores[index];
+            saturated[origin[index]] = sub_saturated[index];
+        }
+    }
+
+    /*!\brief Computes the scores of one batch with the given score type.
+     * \tparam        batch_score_t  The scalar score type of the dynamic programming recursion.
+     * \param[in]     first_batch    The rank representations of the first sequences per lane.
+     * \param[in]     second_batch   The rank representations of the second sequences per lane.
+     * \param[in]     batch_size     The number of occupied lanes.
+     * \param[in]     match_score    The score for a match.
+     * \param[in]     mismatch_score The score for a mismatch.
+     * \param[out]    final_scores   The final scores per lane.
+     * \param[out]    saturated      Set per lane iff the lane's score might have been clamped and must be
+     *                               recomputed with a wider score type.
+     *
+     * \details
+     *
+     * The batch is processed in chunks of the native lane count of `batch_score_t`, such that the wider score
+     * types reuse the same kernel on the compacted batches of the escalation path.
+     */
+    template <typename batch_score_t>
+    void compute_scores(std::array<std::vector<score_t>, simd_length> const & first_batch,
+                        std::array<std::vector<score_t>, simd_length> const & second_batch,
+                        size_t const batch_size,
+                        score_t const match_score,
+                        score_t const mismatch_score,
+                        std::array<score_t, simd_length> & final_scores,
+                        std::array<bool, simd_length> & saturated)
+    {
+        constexpr size_t chunk_length = simd_traits<simd_type_t<batch_score_t>>::length;
+
+        for (size_t chunk_begin = 0; chunk_begin < batch_size; chunk_begin += chunk_length)
+            compute_chunk<batch_score_t>(first_batch, second_batch,
+                                         chunk_begin, std::min(batch_size, chunk_begin + chunk_length),
+                                         match_score, mismatch_score, final_scores, saturated);
+    }
+
+    /*!\brief Computes the affine gap cost recursion for the lanes `[chunk_begin, chunk_end)` of a batch.
+     * \tparam        batch_score_t  The scalar score type of the dynamic programming recursion.
+     * \param[in]     first_batch    The rank representations of the first sequences per lane.
+     * \param[in]     second_batch   The rank representations of the second sequences per lane.
+     * \param[in]     chunk_begin    The first lane of the chunk.
+     * \param[in]     chunk_end      The lane behind the last lane of the chunk.
+     * \param[in]     match_score    The score for a match.
+     * \param[in]     mismatch_score The score for a mismatch.
+     * \param[in,out] final_scores   The final scores per lane.
+     * \param[in,out] saturated      The saturation flags per lane.
+     *
+     * \details
+     *
+     * All score additions use seqan3::simd::saturated_add. A lane is flagged as saturated iff its optimal score
+     * reached a limit of `batch_score_t` in any cell of its own matrix, or iff one of its initialisation rows or
+     * columns extends beyond the representable gap costs. A clamped candidate score can only corrupt a cell by
+     * winning the maximum, in which case the optimal score of that cell equals the limit itself, hence comparing
+     * the optimal score against the limits detects every affected lane.
+     */
+    template <typename batch_score_t>
+    void compute_chunk(std::array<std::vector<score_t>, simd_length> const & first_batch,
+                       std::array<std::vector<score_t>, simd_length> const & second_batch,
+                       size_t const chunk_begin,
+                       size_t const chunk_end,
+                       score_t const match_score,
+                       score_t const mismatch_score,
+                       std::array<score_t, simd_length> & final_scores,
+                       std::array<bool, simd_length> & saturated)
+    {
+        using batch_simd_t = simd_type_t<batch_score_t>;
+
+        // The exact score type cannot saturate on the supported sequence lengths; skip the bookkeeping for it.
+        constexpr bool track_saturation = sizeof(batch_score_t) < sizeof(score_t);
+        constexpr score_t score_lowest = std::numeric_limits<batch_score_t>::lowest();
+        constexpr score_t score_highest = std::numeric_limits<batch_score_t>::max();
+
+        auto const & gaps = params.gap;
+        score_t const gap_extend = gaps.get_gap_score();
+        score_t const gap_open = gaps.get_gap_open_score() + gap_extend;
+        batch_simd_t const gap_extend_simd = fill<batch_simd_t>(static_cast<batch_score_t>(gap_extend));
+        batch_simd_t const gap_open_simd = fill<batch_simd_t>(static_cast<batch_score_t>(gap_open));
+        batch_simd_t const match_simd = fill<batch_simd_t>(static_cast<batch_score_t>(match_score));
+        batch_simd_t const mismatch_simd = fill<batch_simd_t>(static_cast<batch_score_t>(mismatch_score));
+
+        // ----------------------------------------------------------------------------
+        // Pack the sequences lane-wise; pad with ranks that can never match.
+        // ----------------------------------------------------------------------------
+
+        size_t max_size_first = 0;
+        size_t max_size_second = 0;
+        for (size_t lane = chunk_begin; lane < chunk_end; ++lane)
+        {
+            max_size_first = std::max(max_size_first, first_batch[lane].size());
+            max_size_second = std::max(max_size_second, second_batch[lane].size());
+        }
+
+        std::vector<batch_simd_t> first_ranks(max_size_first, fill<batch_simd_t>(-1));
+        std::vector<batch_simd_t> second_ranks(max_size_second, fill<batch_simd_t>(-2));
+
+        for (size_t lane = chunk_begin; lane < chunk_end; ++lane)
+        {
+            for (size_t position = 0; position < first_batch[lane].size(); ++position)
+                first_ranks[position][lane - chunk_begin] = static_cast<batch_score_t>(first_batch[lane][position]);
+            for (size_t position = 0; position < second_batch[lane].size(); ++position)
+                second_ranks[position][lane - chunk_begin] = static_cast<batch_score_t>(second_batch[lane][position]);
+        }
+
+        // ----------------------------------------------------------------------------
+        // Compute the affine gap cost recursion column-wise over all lanes at once.
+        // ----------------------------------------------------------------------------
+
+        // The initialisation scores are clamped in scalar arithmetic; every lane whose own matrix reaches the
+        // first clamped initialisation index is flagged for the escalation, since the clamped cells feed its
+        // recursion with wrong values that the lane-wise limit check below cannot observe.
+        auto clamped_init_score = [&] (size_t const index) -> batch_score_t
+        {
+            score_t const value = gap_open + static_cast<score_t>(index - 1) * gap_extend;
+            return static_cast<batch_score_t>(std::clamp(value, score_lowest, score_highest));
+        };
+
+        size_t first_clamped_index = std::numeric_limits<size_t>::max();
+        if constexpr (track_saturation)
+        {
+            for (size_t index = 1; index <= std::max(max_size_first, max_size_second); ++index)
+            {
+                score_t const value = gap_open + static_cast<score_t>(index - 1) * gap_extend;
+                if (value < score_lowest || value > score_highest)
+                {
+                    first_clamped_index = index;
+                    break;
+                }
+            }
+        }
+
+        // column_optimal[row] holds the optimal score, column_horizontal[row] the score ending in a horizontal gap.
+        std::vector<batch_simd_t> column_optimal(max_size_second + 1);
+        std::vector<batch_simd_t> column_horizontal(max_size_second + 1);
+
+        // Initialise the first column.
+        column_optimal[0] = fill<batch_simd_t>(0);
+        column_horizontal[0] = gap_open_simd;
+        for (size_t row = 1; row <= max_size_second; ++row)
+        {
+            column_optimal[row] = fill<batch_simd_t>(clamped_init_score(row));
+            column_horizontal[row] = saturated_add(column_optimal[row], gap_open_simd);
+        }
+
+        // Accumulates per lane whether the optimal score ever reached a limit of the score type.
+        batch_simd_t saturation_seen{};
+        batch_simd_t const lowest_simd = fill<batch_simd_t>(std::numeric_limits<batch_score_t>::lowest());
+        batch_simd_t const highest_simd = fill<batch_simd_t>(std::numeric_limits<batch_score_t>::max());
+
+        // The saturation flag is snapshotted together with the score, such that clamping that only happens in the
+        // padded region behind a lane's own matrix does not force the lane into the escalation.
+        auto extract_finished_lanes = [&] (size_t const column)
+        {
+            for (size_t lane = chunk_begin; lane < chunk_end; ++lane)
+            {
+                if (first_batch[lane].size() == column)
+                {
+                    final_scores[lane] = column_optimal[second_batch[lane].size()][lane - chunk_begin];
+                    if constexpr (track_saturation)
+                        saturated[lane] = (saturation_seen[lane - chunk_begin] != 0)
+                                       || (first_batch[lane].size() >= first_clamped_index)
+                                       || (second_batch[lane].size() >= first_clamped_index);
+                    else
+                        saturated[lane] = false;
+                }
+            }
+        };
+
+        extract_finished_lanes(0);
+
+        for (size_t column = 1; column <= max_size_first; ++column)
+        {
+            batch_simd_t const column_ranks = first_ranks[column - 1];
+
+            batch_simd_t diagonal = column_optimal[0];
+            column_optimal[0] = fill<batch_simd_t>(clamped_init_score(column));
+            batch_simd_t vertical = saturated_add(column_optimal[0], gap_open_simd);
+
+            for (size_t row = 1; row <= max_size_second; ++row)
+            {
+                // Compare the packed ranks to select between the match and the mismatch score.
+                auto const is_match = (column_ranks == second_ranks[row - 1]);
+                batch_simd_t const substitution_score =
+                    (match_simd & reinterpret_cast<batch_simd_t const &>(is_match)) |
+                    (mismatch_simd & ~reinterpret_cast<batch_simd_t const &>(is_match));
+
+                batch_simd_t const horizontal = max(saturated_add(column_optimal[row], gap_open_simd),
+                                                    saturated_add(column_horizontal[row], gap_extend_simd));
+                batch_simd_t const best = max(saturated_add(diagonal, substitution_score),
+                                              max(horizontal, vertical));
+
+                diagonal = column_optimal[row];
+                column_optimal[row] = best;
+                column_horizontal[row] = horizontal;
+                vertical = max(saturated_add(best, gap_open_simd), saturated_add(vertical, gap_extend_simd));
+
+                if constexpr (track_saturation)
+                {
+                    auto const at_limit = (best == lowest_simd) | (best == highest_simd);
+                    saturation_seen |= reinterpret_cast<batch_simd_t const &>(at_limit);
+                }
+            }
+
+            extract_finished_lanes(column);
+        }
+    }
+
+    //!\brief The configuration values resolved once into a flattened block stored by value.
+    alignment_parameter_block_t<config_t> params{};
+};
+
+} // namespace seqan3::detail
@@ -43,6 +43,10 @@
  * their scores via `set_()` functions and by returning references to their internal score matrix. You can however
  * add completely different types, as long as they model seqan3::scoring_scheme_concept.
  *
+ * For aligning against a position-specific profile (e.g. a position weight matrix), where the score of a letter
+ * depends on the position within the profile instead of a second letter, seqan3::position_specific_scoring_scheme
+ * is provided.
+ *
  * <small><i>The base type seqan3::scoring_scheme_base is only implementation detail and not required for most users.
  * Types that model seqan3::scoring_scheme_concept can (but don't need to!) inherit from it.</i></small>
  *
@@ -61,5 +65,7 @@
 #include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
 #include <seqan3/alignment/scoring/gap_scheme.hpp>
 #include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/position_specific_scoring_scheme.hpp>
 #include <seqan3/alignment/scoring/scoring_scheme_base.hpp>
 #include <seqan3/alignment/scoring/scoring_scheme_concept.hpp>
+#include <seqan3/alignment/scoring/simd_matrix_scoring_scheme.hpp>
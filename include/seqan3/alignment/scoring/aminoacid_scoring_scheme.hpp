@@ -17,6 +17,7 @@
 
 #include <seqan3/alignment/scoring/scoring_scheme_base.hpp>
 #include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/aminoacid/concept.hpp>
 #include <seqan3/range/shortcuts.hpp>
 #include <seqan3/std/ranges>
 
@@ -68,6 +69,16 @@ enum class aminoacid_similarity_matrix
  * You can use an instance of this class to score two amino acids. The amino acids need not be of the same type.
  * Different scoring behaviour can be set via the member functions.
  *
+ * ### Reduced alphabets
+ *
+ * The scheme is templated on the amino acid alphabet it scores and defaults to the full seqan3::aa27
+ * alphabet. When instantiated with a reduced alphabet, e.g. seqan3::aa10murphy, the similarity matrices
+ * are folded into the reduced alphabet via the representative letter of each class, i.e. the score of two
+ * reduced letters is the score their representatives have in the full matrix. The resulting matrix has
+ * only `alphabet size * alphabet size` entries (100 instead of 729 for seqan3::aa10murphy) and thus fits
+ * into the first-level cache, which pays off in alignment prefilters that call score() in the innermost
+ * loop. Letters of the full alphabet may still be passed to score(), they are folded on-the-fly.
+ *
  * ### Example
  *
  * Score two letters:
@@ -79,15 +90,19 @@ enum class aminoacid_similarity_matrix
  * Score two sequences:
  * \snippet test/snippet/alignment/scoring/aminoacid_scoring_scheme.cpp score sequences
  */
-template <Arithmetic score_type = int8_t>
-class aminoacid_scoring_scheme : public scoring_scheme_base<aminoacid_scoring_scheme<score_type>, aa27, score_type>
+template <Arithmetic score_type = int8_t, AminoacidAlphabet alphabet_t = aa27>
+class aminoacid_scoring_scheme :
+    public scoring_scheme_base<aminoacid_scoring_scheme<score_type, alphabet_t>, alphabet_t, score_type>
 {
 private:
     //!\brief Type of the CRTP-base.
-    using base_t = scoring_scheme_base<aminoacid_scoring_scheme<score_type>, aa27, score_type>;
+    using base_t = scoring_scheme_base<aminoacid_scoring_scheme<score_type, alphabet_t>, alphabet_t, score_type>;
 
     //!\brief Make the base's private member visible.
     using base_t::matrix;
+
+    //!\brief The type of the full 27x27 matrices the similarity matrix data is stored in.
+    using aa27_matrix_type = std::array<std::array<score_type, 27>, 27>;
 public:
     //!\privatesection
     //!\brief Inherit the base class's constructors.
@@ -124,24 +139,51 @@ public:
     /*!\brief Set the similarity matrix scheme (e.g. BLOSUM62).
      * \param[in] matrix_id The enum ID of the matrix, see seqan3::aminoacid_similarity_matrix.
      * \throws std::invalid_argument If there is no matrix data for the given ID (usually a BUG).
+     *
+     * \details
+     *
+     * If the scheme's alphabet is smaller than seqan3::aa27, the matrix is folded into the reduced
+     * alphabet: two reduced letters score what their representative letters score in the full matrix.
      */
     constexpr void set_similarity_matrix(aminoacid_similarity_matrix const matrix_id)
     {
+        aa27_matrix_type const * source = nullptr;
+
         switch (matrix_id)
         {
-            case aminoacid_similarity_matrix::BLOSUM30: std::ranges::copy(blosum30, begin(matrix)); break;
-            case aminoacid_similarity_matrix::BLOSUM45: std::ranges::copy(blosum45, begin(matrix)); break;
-            case aminoacid_similarity_matrix::BLOSUM62: std::ranges::copy(blosum62, begin(matrix)); break;
-            case aminoacid_similarity_matrix::BLOSUM80: std::ranges::copy(blosum80, begin(matrix)); break;
+            case aminoacid_similarity_matrix::BLOSUM30: source = &blosum30; break;
+            case aminoacid_similarity_matrix::BLOSUM45: source = &blosum45; break;
+            case aminoacid_similarity_matrix::BLOSUM62: source = &blosum62; break;
+            case aminoacid_similarity_matrix::BLOSUM80: source = &blosum80; break;
             default:
                 throw std::invalid_argument{"ERROR in set_similarity_matrix(), matrix_id has no matrix."};
         }
+
+        if constexpr (std::Same<alphabet_t, aa27>)
+        {
+            std::ranges::copy(*source, begin(matrix));
+        }
+        else // fold the matrix into the reduced alphabet via the representative letter of each class
+        {
+            for (typename base_t::matrix_size_type i = 0; i < base_t::matrix_size; ++i)
+            {
+                alphabet_t row{};
+                row.assign_rank(i);
+
+                for (typename base_t::matrix_size_type j = 0; j < base_t::matrix_size; ++j)
+                {
+                    alphabet_t col{};
+                    col.assign_rank(j);
+                    matrix[i][j] = (*source)[to_rank(aa27{row})][to_rank(aa27{col})];
+                }
+            }
+        }
     }
     //!\}
 
 private:
     //!\brief The matrix data corresponding to seqan3::aminoacid_similarity_matrix::BLOSUM30.
-    static constexpr matrix_type blosum30
+    static constexpr aa27_matrix_type blosum30
     {{
         //! [matrix_data blosum30]
         //A   B   C   D   E   F   G   H   I   J   K   L   M   N   O   P   Q   R   S   T   U   V   W   X   Y   Z   *
@@ -176,7 +218,7 @@ private:
     }};
 
     //!\brief The matrix data corresponding to seqan3::aminoacid_similarity_matrix::BLOSUM45.
-    static constexpr matrix_type blosum45
+    static constexpr aa27_matrix_type blosum45
     {{
         //! [matrix_data blosum45]
         //A   B   C   D   E   F   G   H   I   J   K   L   M   N   O   P   Q   R   S   T   U   V   W   X   Y   Z   *
@@ -211,7 +253,7 @@ private:
     }};
 
     //!\brief The matrix data corresponding to seqan3::aminoacid_similarity_matrix::BLOSUM62.
-    static constexpr matrix_type blosum62
+    static constexpr aa27_matrix_type blosum62
     {{
         //! [matrix_data blosum62]
         //A   B   C   D   E   F   G   H   I   J   K   L   M   N   O   P   Q   R   S   T   U   V   W   X   Y   Z   *
@@ -246,7 +288,7 @@ private:
     }};
 
     //!\brief The matrix data corresponding to seqan3::aminoacid_similarity_matrix::BLOSUM80.
-    static constexpr matrix_type blosum80
+    static constexpr aa27_matrix_type blosum80
     {{
         //! [matrix_data blosum80]
         //A   B   C   D   E   F   G   H   I   J   K   L   M   N   O   P   Q   R   S   T   U   V   W   X   Y   Z   *
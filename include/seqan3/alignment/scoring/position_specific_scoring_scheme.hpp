@@ -0,0 +1,206 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::position_specific_scoring_scheme.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include <seqan3/alignment/scoring/scoring_scheme_concept.hpp>
+#include <seqan3/alphabet/adaptation/uint.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/bit_manipulation.hpp>
+#include <seqan3/core/concept/core_language.hpp>
+#include <seqan3/core/metafunction/basic.hpp>
+#include <seqan3/core/metafunction/range.hpp>
+#include <seqan3/range/container/aligned_allocator.hpp>
+#include <seqan3/std/concepts>
+#include <seqan3/std/ranges>
+
+namespace seqan3
+{
+
+/*!\brief A data structure for scoring a sequence against a position-specific profile.
+ * \tparam alphabet_t The alphabet over which the profile is defined; must model seqan3::Alphabet.
+ * \tparam score_t    The underlying score type; must model seqan3::Arithmetic.
+ * \ingroup scoring
+ * \implements seqan3::scoring_scheme_concept
+ *
+ * \details
+ *
+ * In contrast to seqan3::nucleotide_scoring_scheme and seqan3::aminoacid_scoring_scheme the score of a letter
+ * does not depend on a second letter but on the position within a profile, e.g. a position weight matrix derived
+ * from a multiple sequence alignment or a profile HMM. Hence the first "sequence" of such an alignment is the
+ * range of profile positions `[0, size())` (e.g. `std::view::iota(0u, pssm.size())`) and this scheme models
+ * seqan3::scoring_scheme_concept for an unsigned position type (see the \link adaptation uint adaptations
+ * \endlink) and the profile's alphabet type.
+ *
+ * The per-position score vectors are stored contiguously in one buffer in profile order, such that walking along
+ * the profile in the dynamic programming matrix touches the memory strictly sequentially. Every score vector is
+ * padded to the next power of two of the alphabet size and the buffer is allocated over-aligned
+ * (seqan3::aligned_allocator), so a whole vector can be loaded with aligned SIMD instructions.
+ *
+ * ### Example
+ *
+ * \snippet test/unit/alignment/position_specific_scoring_scheme_test.cpp usage
+ */
+template <Alphabet alphabet_t, Arithmetic score_t = int8_t>
+class position_specific_scoring_scheme
+{
+public:
+    /*!\name Member types
+     * \{
+     */
+    //!\brief Type of the score values.
+    using score_type = score_t;
+    //!\brief Type of one unpadded per-position score vector.
+    using column_type = std::array<score_t, alphabet_size_v<alphabet_t>>;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    position_specific_scoring_scheme() = default;                                                    //!< Defaulted
+    position_specific_scoring_scheme(position_specific_scoring_scheme const &) = default;            //!< Defaulted
+    position_specific_scoring_scheme(position_specific_scoring_scheme &&) = default;                 //!< Defaulted
+    position_specific_scoring_scheme & operator=(position_specific_scoring_scheme const &) = default;//!< Defaulted
+    position_specific_scoring_scheme & operator=(position_specific_scoring_scheme &&) = default;     //!< Defaulted
+    ~position_specific_scoring_scheme() = default;                                                   //!< Defaulted
+
+    /*!\brief Constructs the scheme from a range of per-position score vectors.
+     * \tparam    profile_t The range type over the score vectors; must model std::ranges::ForwardRange and its
+     *                      value type must be convertible to column_type.
+     * \param[in] profile   The per-position score vectors in profile order.
+     */
+    template <std::ranges::ForwardRange profile_t>
+    //!\cond
+        requires std::ConvertibleTo<value_type_t<remove_cvref_t<profile_t>>, column_type>
+    //!\endcond
+    explicit position_specific_scoring_scheme(profile_t const & profile)
+    {
+        profile_length = std::ranges::distance(profile);
+        data.resize(profile_length * column_stride);
+
+        auto data_it = std::ranges::begin(data);
+        for (column_type const & column : profile)
+        {
+            data_it = std::ranges::copy(column, data_it).out;
+            data_it += column_stride - column.size();  // Skip the padding of this score vector.
+        }
+    }
+
+    /*!\brief Constructs the scheme as the profile of a single sequence under a regular scoring scheme.
+     * \tparam    sequence_t The type of the sequence; must model std::ranges::ForwardRange over `alphabet_t`.
+     * \tparam    scheme_t   The type of the scheme used to derive the score vectors; must model
+     *                       seqan3::scoring_scheme_concept for `alphabet_t`.
+     * \param[in] sequence   The sequence the profile is derived from.
+     * \param[in] scheme     The scheme scoring the sequence's letters against the alphabet.
+     *
+     * \details
+     *
+     * The score vector of position `i` contains `scheme.score(sequence[i], a)` for every letter `a` of the
+     * alphabet. Aligning against the resulting profile is equivalent to aligning against `sequence` with
+     * `scheme`, which is mostly useful for testing and for mixing profile and non-profile queries in one
+     * pipeline.
+     */
+    template <std::ranges::ForwardRange sequence_t, typename scheme_t>
+    //!\cond
+        requires std::ConvertibleTo<value_type_t<remove_cvref_t<sequence_t>>, alphabet_t> &&
+                 scoring_scheme_concept<scheme_t, alphabet_t>
+    //!\endcond
+    position_specific_scoring_scheme(sequence_t const & sequence, scheme_t const & scheme)
+    {
+        profile_length = std::ranges::distance(sequence);
+        data.resize(profile_length * column_stride);
+
+        auto data_it = std::ranges::begin(data);
+        for (alphabet_t const letter : sequence)
+        {
+            for (size_t rank = 0; rank < alphabet_size_v<alphabet_t>; ++rank)
+                *(data_it + rank) = scheme.score(letter, assign_rank(alphabet_t{}, rank));
+            data_it += column_stride;
+        }
+    }
+    //!\}
+
+    /*!\name Accessors
+     * \{
+     */
+    /*!\brief Score a letter at a profile position.
+     * \tparam    position_t Type of the profile position; must model std::UnsignedIntegral.
+     * \tparam    alph_t     Type of the letter; must be explicitly convertible to `alphabet_t`.
+     * \param[in] position   The position within the profile; must be smaller than size().
+     * \param[in] alph       The letter to score.
+     * \return The score of the letter at the given profile position.
+     */
+    template <std::UnsignedIntegral position_t, ExplicitlyConvertibleTo<alphabet_t> alph_t>
+    constexpr score_t score(position_t const position, alph_t const alph) const noexcept
+    {
+        assert(static_cast<size_t>(position) < profile_length);
+        return data[static_cast<size_t>(position) * column_stride + to_rank(static_cast<alphabet_t>(alph))];
+    }
+
+    //!\brief Returns the number of positions in the profile.
+    constexpr size_t size() const noexcept
+    {
+        return profile_length;
+    }
+
+    /*!\brief Returns a pointer to the padded score vector of the given profile position.
+     * \param[in] position The position within the profile; must be smaller than size().
+     *
+     * \details
+     *
+     * The returned pointer is over-aligned to the padded score vector size, such that the whole vector can be
+     * loaded with one aligned SIMD instruction for small alphabets.
+     */
+    constexpr score_t const * profile_column_data(size_t const position) const noexcept
+    {
+        assert(position < profile_length);
+        return data.data() + position * column_stride;
+    }
+
+    //!\brief The number of score values between the start of two consecutive score vectors.
+    static constexpr size_t column_stride = detail::next_power_of_two(alphabet_size_v<alphabet_t>);
+    //!\}
+
+    //!\name Comparison operators
+    //!\{
+    bool operator==(position_specific_scoring_scheme const & rhs) const noexcept
+    {
+        return data == rhs.data;
+    }
+
+    bool operator!=(position_specific_scoring_scheme const & rhs) const noexcept
+    {
+        return data != rhs.data;
+    }
+    //!\}
+
+private:
+    //!\brief The contiguous buffer holding the padded per-position score vectors.
+    std::vector<score_t, aligned_allocator<score_t, column_stride * sizeof(score_t)>> data{};
+    //!\brief The number of positions in the profile.
+    size_t profile_length{};
+};
+
+/*!\name Type deduction guides
+ * \relates seqan3::position_specific_scoring_scheme
+ * \{
+ */
+//!\brief Deduces the alphabet from the sequence the profile is derived from; the score type defaults to `int8_t`.
+template <std::ranges::ForwardRange sequence_t, typename scheme_t>
+position_specific_scoring_scheme(sequence_t const &, scheme_t const &)
+    -> position_specific_scoring_scheme<value_type_t<remove_cvref_t<sequence_t>>, int8_t>;
+//!\}
+
+} // namespace seqan3
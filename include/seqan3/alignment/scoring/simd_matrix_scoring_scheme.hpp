@@ -0,0 +1,156 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::simd_matrix_scoring_scheme.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include <seqan3/alignment/scoring/scoring_scheme_concept.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/simd/concept.hpp>
+#include <seqan3/core/simd/simd_algorithm.hpp>
+#include <seqan3/core/simd/simd_traits.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A scoring scheme adapter that applies a whole matrix row to many cells with one byte shuffle.
+ * \ingroup scoring
+ * \tparam simd_t     The simd vector type the scores are computed in; must satisfy seqan3::simd::simd_concept
+ *                    and have a single-byte scalar type.
+ * \tparam alphabet_t The alphabet the wrapped scheme is defined over; must satisfy seqan3::Alphabet and
+ *                    have an alphabet size of at most 16.
+ *
+ * \details
+ *
+ * A matrix-based scoring scheme (e.g. seqan3::nucleotide_scoring_scheme over seqan3::dna15) costs one table
+ * load per cell in a vectorised alignment kernel, because every lane addresses a different matrix entry.
+ * For alphabets with at most 16 values the ranks fit the index range of the byte shuffle instructions
+ * (`pshufb` and friends), so a whole matrix row — "rank `r` against everything" — can be held in one vector
+ * register and applied to all lanes at once.
+ *
+ * This adapter precomputes one such shuffle vector per rank from the wrapped scheme when the alignment is
+ * configured. The kernel then calls score_row() with the fixed rank of the current symbol of one sequence
+ * and a vector of ranks of the other sequence, paying a single shuffle per vector of cells. score() handles
+ * the general case of two rank vectors via a flattened-matrix gather and is provided for kernel parts that
+ * cannot fix one operand.
+ *
+ * The row vectors replicate the 16 row entries every 16 lanes, so the adapter works unchanged with vectors
+ * wider than 128 bit whose shuffle instruction operates per 128-bit half (see seqan3::simd::shuffle).
+ */
+template <simd_concept simd_t, Alphabet alphabet_t>
+//!\cond
+    requires (alphabet_size_v<alphabet_t> <= 16) && (sizeof(typename simd_traits<simd_t>::scalar_type) == 1)
+//!\endcond
+class simd_matrix_scoring_scheme
+{
+private:
+    //!\brief The scalar score type of one lane.
+    using scalar_t = typename simd_traits<simd_t>::scalar_type;
+
+    //!\brief The number of lanes of the simd vector type.
+    static constexpr size_t simd_length = simd_traits<simd_t>::length;
+    //!\brief The index range of a 128-bit byte shuffle; rows are replicated with this period.
+    static constexpr size_t row_size = 16;
+
+public:
+    /*!\name Associated types
+     * \{
+     */
+    //!\brief The type returned by score() and score_row().
+    using score_type = simd_t;
+    //!\brief The rank type of the adapted alphabet.
+    using rank_type = underlying_rank_t<alphabet_t>;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr simd_matrix_scoring_scheme()                                                = default; //!< Defaulted
+    constexpr simd_matrix_scoring_scheme(simd_matrix_scoring_scheme const &)              = default; //!< Defaulted
+    constexpr simd_matrix_scoring_scheme(simd_matrix_scoring_scheme &&)                   = default; //!< Defaulted
+    constexpr simd_matrix_scoring_scheme & operator=(simd_matrix_scoring_scheme const &)  = default; //!< Defaulted
+    constexpr simd_matrix_scoring_scheme & operator=(simd_matrix_scoring_scheme &&)       = default; //!< Defaulted
+    ~simd_matrix_scoring_scheme()                                                         = default; //!< Defaulted
+
+    /*!\brief Precomputes the shuffle vectors from a scalar scoring scheme.
+     * \tparam scheme_t The type of the wrapped scheme; must satisfy seqan3::scoring_scheme_concept over
+     *                  the adapted alphabet.
+     * \param[in] scheme The scheme to adapt; every score must be representable in the scalar type of `simd_t`.
+     */
+    template <typename scheme_t>
+    //!\cond
+        requires scoring_scheme_concept<scheme_t, alphabet_t>
+    //!\endcond
+    constexpr explicit simd_matrix_scoring_scheme(scheme_t const & scheme)
+    {
+        for (size_t rank1 = 0; rank1 < alphabet_size_v<alphabet_t>; ++rank1)
+        {
+            for (size_t lane = 0; lane < simd_length; ++lane)
+            {
+                size_t const rank2 = (lane % row_size) % alphabet_size_v<alphabet_t>;
+                matrix_rows[rank1][lane] =
+                    static_cast<scalar_t>(scheme.score(assign_rank(alphabet_t{}, rank1),
+                                                       assign_rank(alphabet_t{}, rank2)));
+            }
+
+            for (size_t rank2 = 0; rank2 < alphabet_size_v<alphabet_t>; ++rank2)
+                flattened_matrix[rank1 * row_size + rank2] = matrix_rows[rank1][rank2];
+        }
+    }
+    //!\}
+
+    /*!\name Score computation
+     * \{
+     */
+    /*!\brief Scores one fixed rank against a vector of ranks — one shuffle for a whole vector of cells.
+     * \param[in] rank1 The rank of the current symbol of the first sequence (the same for all lanes).
+     * \param[in] ranks2 The per-lane ranks of the symbols of the second sequence; every lane must be a
+     *                   valid rank, i.e. `< alphabet_size_v<alphabet_t>`.
+     * \returns A vector where lane `i` holds the score of `rank1` against `ranks2[i]`.
+     *
+     * This is the fast path for kernels that advance through one sequence symbol by symbol (e.g. column- or
+     * diagonal-wise) while the lanes cover positions of the other sequence: the matrix row of the current
+     * symbol is selected once and applied to all lanes with a single byte shuffle.
+     */
+    constexpr simd_t score_row(rank_type const rank1, simd_t const & ranks2) const noexcept
+    {
+        return shuffle(matrix_rows[rank1], ranks2);
+    }
+
+    /*!\brief Scores two vectors of ranks lane by lane.
+     * \param[in] ranks1 The per-lane ranks of the symbols of the first sequence.
+     * \param[in] ranks2 The per-lane ranks of the symbols of the second sequence.
+     * \returns A vector where lane `i` holds the score of `ranks1[i]` against `ranks2[i]`.
+     *
+     * The general fallback when neither operand is fixed: the two ranks are combined into one flattened
+     * matrix offset and resolved with a per-lane gather. Prefer score_row() wherever the kernel structure
+     * allows it.
+     */
+    constexpr simd_t score(simd_t const & ranks1, simd_t const & ranks2) const noexcept
+    {
+        simd_t vec{};
+        for (size_t i = 0; i < simd_length; ++i)
+            vec[i] = flattened_matrix[static_cast<uint8_t>(ranks1[i]) * row_size + static_cast<uint8_t>(ranks2[i])];
+        return vec;
+    }
+    //!\}
+
+private:
+    //!\brief One shuffle vector per rank; lane `j` of row `r` holds the score of rank `r` against rank
+    //!       `j % 16` (rows are replicated every 16 lanes, see the class documentation).
+    std::array<simd_t, alphabet_size_v<alphabet_t>> matrix_rows{};
+    //!\brief The matrix rows concatenated with a stride of 16, indexed as `rank1 * 16 + rank2` by score().
+    std::array<scalar_t, row_size * row_size> flattened_matrix{};
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,239 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \author Sara Hetzel <sara.hetzel AT fu-berlin.de>
+ * \brief Contains seqan3::aa10murphy, container aliases and string literals.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <seqan3/alphabet/aminoacid/aminoacid_base.hpp>
+#include <seqan3/alphabet/aminoacid/concept.hpp>
+#include <seqan3/io/stream/char_operations.hpp>
+
+namespace seqan3
+{
+
+/*!\brief The reduced Murphy amino acid alphabet.
+ * \ingroup aminoacid
+ * \implements seqan3::AminoacidAlphabet
+ * \implements seqan3::detail::ConstexprAlphabet
+ * \implements seqan3::TriviallyCopyable
+ * \implements seqan3::StandardLayout
+ *
+ * \details
+ * The alphabet consists of letters A, B, C, F, G, H, I, K, P, S
+ *
+ * The alphabet was described by Murphy, Wallqvist and Levy<sup>1</sup>. It groups amino acids with similar
+ * physico-chemical properties and substitution preferences into ten classes, which preserves most of the
+ * information of the full alphabet while shrinking the scoring matrix from 27x27 to 10x10 entries.
+ * A matrix this small fits into the first-level cache and makes vectorised lookups feasible, which is why
+ * reduced alphabets are popular for protein prefilters.
+ *
+ * The alphabet may be brace initialized from the static letter members (see above). Note that you cannot assign
+ * regular characters, but additional functions for this are available.
+ *
+ * *Note:* Letters which belong in the extended alphabet will be automatically converted based on the frequency
+ * of their options.\n Terminator characters are converted to F, because the most commonly occurring
+ * stop codon in higher eukaryotes is UGA<sup>2</sup>, which is most similar to a Tryptophan that itself
+ * maps to F in this alphabet.
+ * Anything unknown is converted to S, because it occurs most frequently across 53 vertebrates<sup>3</sup>.
+ *
+ * |Input Letter  |Converts to  |
+ * |--------------|-------------|
+ * |D             |B<sup>1</sup>|
+ * |E             |B<sup>1</sup>|
+ * |J             |I<sup>1</sup>|
+ * |L             |I<sup>1</sup>|
+ * |M             |I<sup>1</sup>|
+ * |N             |B<sup>1</sup>|
+ * |O             |K<sup>1</sup>|
+ * |Q             |B<sup>1</sup>|
+ * |R             |K<sup>1</sup>|
+ * |T             |S<sup>1</sup>|
+ * |U             |C<sup>1</sup>|
+ * |V             |I<sup>1</sup>|
+ * |W             |F<sup>1</sup>|
+ * |Y             |F<sup>1</sup>|
+ * |Z             |B<sup>1</sup>|
+ * |X (Unknown)   |S<sup>3</sup>|
+ * |* (Terminator)|F<sup>2</sup>|
+ * <sup><b>1</b></sup>Murphy, L. R., Wallqvist, A., & Levy, R. M. (2000). Simplified amino acid alphabets for
+ * protein fold recognition and implications for folding. Protein Engineering, 13(3), 149-152.
+ * doi:10.1093/protein/13.3.149\n
+ * <sup><b>2</b></sup>Trotta, E. (2016). Selective forces and mutational biases drive stop codon usage
+ * in the human genome: a comparison with sense codon usage.
+ * BMC Genomics, 17, 366. http://doi.org/10.1186/s12864-016-2692-4\n
+ * <sup><b>3</b></sup>King, J. L., & Jukes, T. H. (1969). Non-Darwinian Evolution.
+ * Science, 164(3881), 788-798. doi:10.1126/science.164.3881.788
+ *
+ * \snippet test/snippet/alphabet/aminoacid/aa10murphy.cpp construction
+ */
+class aa10murphy : public aminoacid_base<aa10murphy, 10>
+{
+private:
+    //!\brief The base class.
+    using base_t = aminoacid_base<aa10murphy, 10>;
+
+    //!\brief Befriend seqan3::aminoacid_base.
+    friend base_t;
+    //!\cond \brief Befriend seqan3::alphabet_base.
+    friend base_t::base_t;
+    //!\endcond
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr aa10murphy() : base_t{} {}
+    constexpr aa10murphy(aa10murphy const &) = default;
+    constexpr aa10murphy(aa10murphy &&) = default;
+    constexpr aa10murphy & operator=(aa10murphy const &) = default;
+    constexpr aa10murphy & operator=(aa10murphy &&) = default;
+    ~aa10murphy() = default;
+
+    using base_t::base_t;
+    //!\}
+
+protected:
+    //!\brief Value to char conversion table.
+    static constexpr char_type rank_to_char[value_size]
+    {
+        'A',
+        'B',
+        'C',
+        'F',
+        'G',
+        'H',
+        'I',
+        'K',
+        'P',
+        'S',
+    };
+
+    //!\brief Char to value conversion table.
+    static constexpr std::array<rank_type, 256> char_to_rank
+    {
+        [] () constexpr
+        {
+            std::array<rank_type, 256> ret{};
+
+            // initialize with UNKNOWN (std::array::fill unfortunately not constexpr)
+            for (auto & c : ret)
+                c = 9; // value of 'S', because that appears most frequently
+
+            // reverse mapping for characters and their lowercase
+            for (rank_type rnk = 0u; rnk < value_size; ++rnk)
+            {
+                ret[static_cast<rank_type>(         rank_to_char[rnk]) ] = rnk;
+                ret[static_cast<rank_type>(to_lower(rank_to_char[rnk]))] = rnk;
+            }
+
+            ret['D'] = ret['B']; ret['d'] = ret['B']; // Convert D to B (either D/N).
+            ret['E'] = ret['B']; ret['e'] = ret['B']; // Convert E to B (either D/N).
+            ret['J'] = ret['I']; ret['j'] = ret['I']; // Convert J (either I/L) to I.
+            ret['L'] = ret['I']; ret['l'] = ret['I']; // Convert L to I.
+            ret['M'] = ret['I']; ret['m'] = ret['I']; // Convert M to I.
+            ret['N'] = ret['B']; ret['n'] = ret['B']; // Convert N to B (either D/N).
+            ret['O'] = ret['K']; ret['o'] = ret['K']; // Convert Pyrrolysine to K.
+            ret['Q'] = ret['B']; ret['q'] = ret['B']; // Convert Q to B (either D/N).
+            ret['R'] = ret['K']; ret['r'] = ret['K']; // Convert R to K.
+            ret['T'] = ret['S']; ret['t'] = ret['S']; // Convert T to S.
+            ret['U'] = ret['C']; ret['u'] = ret['C']; // Convert Selenocysteine to cysteine.
+            ret['V'] = ret['I']; ret['v'] = ret['I']; // Convert V to I.
+            ret['W'] = ret['F']; ret['w'] = ret['F']; // Convert W to F.
+            ret['X'] = ret['S']; ret['x'] = ret['S']; // Convert unknown amino acids to serine.
+            ret['Y'] = ret['F']; ret['y'] = ret['F']; // Convert Y to F.
+            ret['Z'] = ret['B']; ret['z'] = ret['B']; // Convert Z (either E/Q) to B.
+            ret['*'] = ret['F']; // The most common stop codon is UGA. This is most similar to a Tryptophan which maps to F.
+            return ret;
+        }()
+    };
+};
+
+} // namespace seqan3
+
+// ------------------------------------------------------------------
+// metafunctions
+// ------------------------------------------------------------------
+
+namespace seqan3
+{
+
+//!\brief Helper metafunction that identifies aa10murphy as an amino acid alphabet.
+//!\ingroup aminoacid
+template <>
+struct is_aminoacid<aa10murphy> : std::true_type {};
+
+} // namespace seqan3
+
+// ------------------------------------------------------------------
+// containers
+// ------------------------------------------------------------------
+
+namespace seqan3
+{
+//!\brief Alias for an std::vector of seqan3::aa10murphy.
+//!\relates aa10murphy
+using aa10murphy_vector = std::vector<aa10murphy>;
+
+} // namespace seqan3
+
+// ------------------------------------------------------------------
+// literals
+// ------------------------------------------------------------------
+
+namespace seqan3
+{
+
+/*!\name Literals
+ * \{
+ */
+
+/*!\brief The seqan3::aa10murphy char literal.
+ * \param[in] c The character to assign.
+ * \relates seqan3::aa10murphy
+ * \returns seqan3::aa10murphy
+ *
+ * \snippet test/snippet/alphabet/aminoacid/aa10murphy.cpp char_literal
+ *
+ */
+constexpr aa10murphy operator""_aa10murphy(char const c) noexcept
+{
+    return aa10murphy{}.assign_char(c);
+}
+
+/*!\brief The seqan3::aa10murphy string literal.
+ * \param[in] s A pointer to the character string to assign.
+ * \param[in] n The size of the character string to assign.
+ * \relates seqan3::aa10murphy
+ * \returns seqan3::aa10murphy_vector
+ *
+ * You can use this string literal to easily assign to aa10murphy_vector:
+ *
+ * \snippet test/snippet/alphabet/aminoacid/aa10murphy.cpp literal
+ *
+ * \attention
+ * All seqan3 literals are in the namespace seqan3!
+ */
+
+inline aa10murphy_vector operator""_aa10murphy(const char * s, std::size_t n)
+{
+    aa10murphy_vector r;
+    r.resize(n);
+
+    for (size_t i = 0; i < n; ++i)
+        r[i].assign_char(s[i]);
+
+    return r;
+}
+//!\}
+
+} // namespace seqan3
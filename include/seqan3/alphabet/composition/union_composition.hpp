@@ -310,7 +310,7 @@ public:
     constexpr bool is_alternative() const noexcept
     {
         static_assert(index < value_size, "The union_composition contains less alternatives than you are checking.");
-        return (to_rank() >= partial_sum_sizes[index]) && (to_rank() < partial_sum_sizes[index + 1]);
+        return rank_to_alternative[to_rank()] == index; // single indexed load instead of partial-sum comparisons
     }
 
     /*!\brief Convert to the specified alphabet (throws if is_alternative() would be false).
@@ -447,7 +447,7 @@ protected:
         }
 
         using seqan3::assign_rank;
-        return assign_rank(alternative_t{}, to_rank() - partial_sum_sizes[index]);
+        return assign_rank(alternative_t{}, rank_to_inner_rank[to_rank()]);
     }
 
     /*!\brief Compile-time generated lookup table which contains the partial
@@ -468,6 +468,33 @@ protected:
         return partial_sum;
     }();
 
+    /*!\brief Compile-time generated lookup table which maps each rank to the index of the alternative
+     * holding it.
+     *
+     * Resolving the alternative through this flattened table is a single indexed load, whereas comparing
+     * against the partial sums is a chain of branches — this matters inside alignment inner loops over
+     * gap-extended alphabets, where every character access resolves its alternative.
+     */
+    static constexpr std::array<rank_type, value_size> rank_to_alternative = []() constexpr
+    {
+        std::array<rank_type, value_size> table{};
+        for (size_t i = 0u; i < sizeof...(alternative_types); ++i)
+            for (size_t rank = partial_sum_sizes[i]; rank < partial_sum_sizes[i + 1]; ++rank)
+                table[rank] = static_cast<rank_type>(i);
+        return table;
+    }();
+
+    /*!\brief Compile-time generated lookup table which maps each rank to the rank within its alternative,
+     * i.e. the rank minus the partial sum of the preceding alternatives' sizes.
+     */
+    static constexpr std::array<rank_type, value_size> rank_to_inner_rank = []() constexpr
+    {
+        std::array<rank_type, value_size> table{};
+        for (size_t rank = 0u; rank < value_size; ++rank)
+            table[rank] = static_cast<rank_type>(rank - partial_sum_sizes[rank_to_alternative[rank]]);
+        return table;
+    }();
+
     /*!\brief Compile-time generated lookup table which maps the rank to char.
      *
      * A map generated at compile time where the key is the rank of the union
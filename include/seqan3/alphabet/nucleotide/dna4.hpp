@@ -78,6 +78,31 @@ public:
     }
     //!\}
 
+    /*!\name Read functions
+     * \{
+     */
+    /*!\brief Return the complement of the letter (branchless).
+     *
+     * \details
+     *
+     * Complementing swaps 'A' (rank 0) with 'T' (rank 3) and 'C' (rank 1) with 'G' (rank 2), which is exactly
+     * `rank XOR 3`. This shadows the table lookup of seqan3::nucleotide_base with a single XOR instruction
+     * that compilers auto-vectorise in reverse-complement loops.
+     *
+     * \par Complexity
+     *
+     * Constant.
+     *
+     * \par Exceptions
+     *
+     * Guaranteed not to throw.
+     */
+    constexpr dna4 complement() const noexcept
+    {
+        return dna4{}.assign_rank(to_rank() ^ 0b11);
+    }
+    //!\}
+
 protected:
     //!\privatesection
 
@@ -73,6 +73,16 @@ public:
     }
     //!\}
 
+    /*!\name Read functions
+     * \{
+     */
+    //!\copydoc seqan3::dna4::complement
+    constexpr rna4 complement() const noexcept
+    {
+        return rna4{}.assign_rank(to_rank() ^ 0b11);
+    }
+    //!\}
+
 protected:
     //!\privatesection
 
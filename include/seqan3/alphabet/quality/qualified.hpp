@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <array>
 #include <iostream>
 #include <string>
 #include <utility>
@@ -143,7 +144,10 @@ public:
     //!\brief Return a character. This reads the internal sequence letter.
     constexpr char_type to_char() const noexcept
     {
-        return seqan3::to_char(get<0>(*this));
+        if constexpr (detail::ConstexprAlphabet<sequence_alphabet_type>)
+            return rank_to_char_table[base_type::to_rank()]; // single load, no component extraction
+        else
+            return seqan3::to_char(get<0>(*this));
     }
 
     /*!\brief Return a qualified where the quality is preserved, but the sequence letter is complemented.
@@ -163,6 +167,28 @@ public:
     {
         return char_is_valid_for<sequence_alphabet_type>(c);
     }
+
+private:
+    /*!\brief The character of every rank is cached so that to_char() is a single table lookup.
+     *
+     * Writing FASTQ calls to_char() once per base; re-deriving the sequence letter from the combined rank
+     * each time costs a division. The first component contributes the most significant digit of the rank
+     * (see seqan3::cartesian_composition), so the sequence rank of rank `i` is
+     * `i / alphabet_size_v<quality_alphabet_type>`.
+     */
+    static constexpr std::array<char_type, base_type::value_size> rank_to_char_table = [] () constexpr
+    {
+        std::array<char_type, base_type::value_size> ret{};
+
+        for (size_t i = 0u; i < base_type::value_size; ++i)
+        {
+            sequence_alphabet_type seq{};
+            seqan3::assign_rank(seq, i / alphabet_size_v<quality_alphabet_type>);
+            ret[i] = seqan3::to_char(seq);
+        }
+
+        return ret;
+    }();
 };
 
 //!\brief Type deduction guide enables usage of qualified without specifying template args.
@@ -17,6 +17,7 @@
 #include <set>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <variant>
 #include <vector>
 
@@ -453,8 +454,8 @@ private:
      *
      * \details
      *
-     * This function adds all command line parameters to a std::vector<std::string>
-     * to take advantage of the vector functionality later on. Additionally,
+     * This function hands all command line parameters to the parse format, which
+     * stores views on them (they are not copied). Additionally,
      * the format member variable is set, depending on which parameters are given
      * by the user:
      *
@@ -482,7 +483,7 @@ private:
 
         for(int i = 1; i < argc; ++i) // start at 1 to skip binary name
         {
-            std::string arg{argv[i]};
+            std::string_view const arg{argv[i]};
 
             if (arg == "-h" || arg == "--help")
             {
@@ -501,7 +502,11 @@ private:
             }
             else if (arg == "--export-help")
             {
-                std::string export_format{argv[i+1]};
+                if (i + 1 >= argc) // no format follows
+                    throw validation_failed("Validation Failed. "
+                                            "Value of --export-help must be one of [html, man, ctd]");
+
+                std::string_view const export_format{argv[i+1]};
 
                 if (export_format == "html")
                     format = detail::format_html{};
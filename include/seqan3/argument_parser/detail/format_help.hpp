@@ -16,6 +16,7 @@
 
 #include <cassert>
 #include <iostream>
+#include <optional>
 
 #include <range/v3/view/repeat_n.hpp>
 
@@ -137,6 +138,7 @@ protected:
      */
     void print_subsection(std::string const & title)
     {
+        console_layout_struct const & layout = get_layout();
         std::ostream_iterator<char> out(std::cout);
         std::cout << '\n' << to_text("\\fB");
         std::fill_n(out, layout.leftPadding / 2, ' ');
@@ -151,6 +153,8 @@ protected:
      */
     void print_line(std::string const & text, bool const line_is_paragraph)
     {
+        console_layout_struct const & layout = get_layout();
+
         if (prev_was_paragraph)
             std::cout << '\n';
 
@@ -176,6 +180,8 @@ protected:
      */
     void print_list_item(std::string const & term, std::string const & desc)
     {
+        console_layout_struct const & layout = get_layout();
+
         if (prev_was_paragraph)
             std::cout << '\n';
 
@@ -199,6 +205,7 @@ protected:
     //!\brief Prints the version information to std::cout.
     void print_version()
     {
+        console_layout_struct const & layout = get_layout();
         std::ostream_iterator<char> out(std::cout);
 
         // Print version, date and url.
@@ -225,6 +232,7 @@ protected:
     {
         print_version();
 
+        console_layout_struct const & layout = get_layout();
         std::ostream_iterator<char> out(std::cout);
 
         // Print legal stuff
@@ -421,10 +429,22 @@ protected:
             std::cout << '\n';
     }
 
+    /*!\brief Returns the console layout, determining it on first use.
+     * \details Determining the layout probes the terminal width, which is only needed when a page
+     *          is actually printed. Deferring it keeps constructing this format (which happens for
+     *          every seqan3::argument_parser, see the format member there) free of system calls.
+     */
+    console_layout_struct const & get_layout()
+    {
+        if (!layout.has_value())
+            layout.emplace();
+        return *layout;
+    }
+
     //!\brief Needed for correct formatting while calling different print functions.
     bool prev_was_paragraph{false};
-    //!\brief Stores the relevant parameters of the documentation on the screen.
-    console_layout_struct layout;
+    //!\brief Stores the relevant parameters of the documentation on the screen (lazily determined).
+    std::optional<console_layout_struct> layout{};
 };
 
 /*!\brief The format that prints a short help message to std::cout.
@@ -12,8 +12,10 @@
 
 #pragma once
 
+#include <deque>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <seqan3/argument_parser/detail/format_base.hpp>
@@ -46,6 +48,15 @@ namespace seqan3::detail
  * When parsing flags and options, the identifiers (and values) are removed from
  * the vector format_parse::argv. That way, options that are specified multiple times,
  * but are no container type, can be identified and an error is reported.
+ *
+ * The arguments themselves are never copied: format_parse::argv stores std::string_view's
+ * into the original `argv` array (which outlives the parser) and all value extraction
+ * operates on (sub)views. Only the final assignment into the user's variable and the
+ * error messages materialize strings.
+ *
+ * Validators are not invoked while parsing; they are collected and only executed after
+ * the complete command line was parsed successfully (see format_parse::parse), so that
+ * possibly expensive checks (e.g. on files) do not run on malformed command lines.
  */
 class format_parse : public format_base
 {
@@ -157,12 +168,17 @@ public:
         check_for_unknown_ids();
 
         if (end_of_options_it != argv.end())
-            *end_of_options_it = ""; // remove -- before parsing positional arguments
+            *end_of_options_it = std::string_view{}; // remove -- before parsing positional arguments
 
         for (auto && f : positional_option_calls)
             f();
 
         check_for_left_over_args();
+
+        // validators may perform expensive checks (e.g. on files), so they only run
+        // once the complete command line was parsed successfully
+        for (auto && f : validator_calls)
+            f();
     }
 
     // functions are not needed for command line parsing but are part of the format interface.
@@ -190,22 +206,23 @@ private:
      * \param[in] argv_ Vector of command line arguments.
      *
      * \details
-     * Adds all command line arguments to the member format_parse::argv,
-     * but splits all values (options) containing an equality sign.
+     * Adds views on all command line arguments to the member format_parse::argv.
+     * The arguments themselves are not copied; the views point into the `argv_`
+     * array which outlives the parser.
      */
     void init(int argc_, char const * const * const  argv_)
     {
-        argv.resize(argc_ - 1); // -1 because of the binary name
+        argv.reserve(argc_ - 1); // -1 because of the binary name
 
         for(int i = 1; i < argc_; ++i) // start at 1 to skip binary name
-            argv.push_back(argv_[i]);
+            argv.emplace_back(argv_[i]);
     }
 
     /*!\brief Appends a double dash to a long identifier and returns it.
     * \param[in] long_id The name of the long identifier.
     * \returns The input long name prepended with a double dash.
     */
-    std::string prepend_dash(std::string const & long_id)
+    static std::string prepend_dash(std::string const & long_id)
     {
         return ("--" + long_id);
     }
@@ -214,7 +231,7 @@ private:
     * \param[in] short_id The name of the short identifier.
     * \returns The input short name prepended with a single dash.
     */
-    std::string prepend_dash(char const short_id)
+    static std::string prepend_dash(char const short_id)
     {
         return ("-" + std::string(1, short_id));
     }
@@ -224,7 +241,7 @@ private:
     * \param[in] long_id  The name of the long identifier.
     * \returns The short_id prepended with a single dash and the long_id prepended with a double dash, separated by '/'.
     */
-    std::string combine_option_names(char const short_id, std::string const & long_id)
+    static std::string combine_option_names(char const short_id, std::string const & long_id)
     {
         if (short_id == '\0')
             return prepend_dash(long_id);
@@ -247,19 +264,21 @@ private:
      *       that "-idValue" arguments are correctly identified.
      */
     template <typename id_type>
-    std::vector<std::string>::iterator find_option_id(std::vector<std::string>::iterator const begin_it, id_type const & id)
+    std::vector<std::string_view>::iterator find_option_id(std::vector<std::string_view>::iterator const begin_it,
+                                                           id_type const & id)
     {
         if (is_empty_id(id))
             return end_of_options_it;
 
+        std::string const dashed_id{prepend_dash(id)}; // materialized once instead of once per argument
+
         return (std::find_if(begin_it, end_of_options_it,
-            [&] (const std::string & v)
+            [&] (std::string_view const v)
             {
-                size_t id_size{(prepend_dash(id)).size()};
-                if (v.size() < id_size)
+                if (v.size() < dashed_id.size())
                     return false; // cannot be the correct identifier
 
-                return v.substr(0, id_size) == prepend_dash(id); // check if prefix of v is the same
+                return v.substr(0, dashed_id.size()) == dashed_id; // check if prefix of v is the same
             }));
     }
 
@@ -271,7 +290,7 @@ private:
         auto it = std::find(argv.begin(), end_of_options_it, prepend_dash(long_id));
 
         if (it != end_of_options_it)
-            *it = ""; // remove seen flag
+            *it = std::string_view{}; // remove seen flag
 
         return(it != end_of_options_it);
     }
@@ -282,18 +301,24 @@ private:
     bool flag_is_set(char const short_id)
     {
         // short flags need special attention, since they could be grouped (-rGv <=> -r -G -v)
-        for (std::string & arg : argv)
+        for (std::string_view & arg : argv)
         {
-            if (arg[0] == '-' && arg.size() > 1 && arg[1] != '-') // is option && not dash && no long option
+            if (arg.size() > 1 && arg[0] == '-' && arg[1] != '-') // is option && not dash && no long option
             {
                 auto pos = arg.find(short_id);
 
-                if (pos != std::string::npos)
+                if (pos != std::string_view::npos)
                 {
-                    arg.erase(pos, 1); // remove seen bool
-
-                    if (arg == "-") // if flag is empty now
-                        arg = "";
+                    if (arg.size() == 2) // the group only contained this flag, the token is fully consumed
+                    {
+                        arg = std::string_view{};
+                    }
+                    else // a view cannot drop a character in the middle, so back the rewritten token by storage
+                    {
+                        modified_tokens.emplace_back(arg);
+                        modified_tokens.back().erase(pos, 1); // remove seen bool
+                        arg = modified_tokens.back();
+                    }
 
                     return true;
                 }
@@ -315,18 +340,18 @@ private:
     //!\cond
         requires IStream<std::istringstream, option_t>
     //!\endcond
-    void retrieve_value(option_t & value, std::string const & in)
+    void retrieve_value(option_t & value, std::string_view const in)
     {
-        std::istringstream stream{in};
+        std::istringstream stream{std::string{in}}; // only non-arithmetic types take the stream detour
         stream >> value;
 
         if (stream.fail() || !stream.eof())
-            throw type_conversion_failed("Argument " + in + " could not be casted to type " +
+            throw type_conversion_failed("Argument " + std::string{in} + " could not be casted to type " +
                                          get_type_name_as_string(value) + ".");
     }
 
     //!\cond
-    void retrieve_value(std::string & value, std::string const & in)
+    void retrieve_value(std::string & value, std::string_view const in)
     {
         value = in;
     }
@@ -344,7 +369,7 @@ private:
     //!\cond
         requires IStream<std::istringstream, typename container_option_t::value_type>
     //!\cond
-    void retrieve_value(container_option_t & value, std::string const & in)
+    void retrieve_value(container_option_t & value, std::string_view const in)
     {
         typename container_option_t::value_type tmp;
 
@@ -368,16 +393,16 @@ private:
     //!\cond
         requires IStream<std::istringstream, option_t>
     //!\endcond
-    void retrieve_value(option_t & value, std::string const & in)
+    void retrieve_value(option_t & value, std::string_view const in)
     {
-        auto res = std::from_chars(&in[0], &in[in.size()], value);
+        auto res = std::from_chars(in.data(), in.data() + in.size(), value);
 
         if (res.ec == std::errc::result_out_of_range)
-            throw overflow_error_on_conversion("Argument " + in + " is not in integer range [" +
+            throw overflow_error_on_conversion("Argument " + std::string{in} + " is not in integer range [" +
                                                std::to_string(std::numeric_limits<option_t>::min()) + "," +
                                                std::to_string(std::numeric_limits<option_t>::max()) + "].");
-        else if (res.ec == std::errc::invalid_argument || res.ptr != &in[in.size()])
-            throw type_conversion_failed("Argument " + in + " could not be casted to type " +
+        else if (res.ec == std::errc::invalid_argument || res.ptr != in.data() + in.size())
+            throw type_conversion_failed("Argument " + std::string{in} + " could not be casted to type " +
                                          get_type_name_as_string(value) + ".");
     }
 
@@ -391,7 +416,7 @@ private:
      *
      * This function delegates to std::from_chars.
      */
-    void retrieve_value(bool & value, std::string const & in)
+    void retrieve_value(bool & value, std::string_view const in)
     {
         if (in == "0")
             value = false;
@@ -402,7 +427,7 @@ private:
         else if (in == "false")
             value = false;
         else
-            throw type_conversion_failed("Argument '" + in + "' could not be casted to boolean.");
+            throw type_conversion_failed("Argument '" + std::string{in} + "' could not be casted to boolean.");
     }
 
     /*!\brief Handles value retrieval for options based on different kev value pairs.
@@ -423,12 +448,12 @@ private:
      */
     template <typename option_type, typename id_type>
     bool identify_and_retrieve_option_value(option_type & value,
-                                            std::vector<std::string>::iterator & option_it,
+                                            std::vector<std::string_view>::iterator & option_it,
                                             id_type const & id)
     {
         if (option_it != end_of_options_it)
         {
-            std::string input_value;
+            std::string_view input_value; // a (sub)view on the argument, no copy is made
             size_t id_size = (prepend_dash(id)).size();
 
             if ((*option_it).size() > id_size) // identifier includes value (-keyValue or -key=value)
@@ -446,18 +471,18 @@ private:
                     input_value = (*option_it).substr(id_size);
                 }
 
-                *option_it = ""; // remove used identifier-value pair
+                *option_it = std::string_view{}; // remove used identifier-value pair
             }
             else // -key value
             {
-                *option_it = ""; // remove used identifier
+                *option_it = std::string_view{}; // remove used identifier
                 ++option_it;
                 if (option_it == end_of_options_it) // should not happen
                     throw parser_invalid_argument("Value cast failed for option " +
                                                   prepend_dash(id) +
                                                   ": No value was provided.");
                 input_value = *option_it;
-                *option_it = ""; // remove value
+                *option_it = std::string_view{}; // remove value
             }
 
             try
@@ -552,7 +577,7 @@ private:
     {
         for (auto it = argv.begin(); it != end_of_options_it; ++it)
         {
-            std::string arg{*it};
+            std::string_view const arg{*it};
             if (!arg.empty() && arg[0] == '-') // may be an identifier
             {
                 if (arg == "-")
@@ -561,14 +586,14 @@ private:
                 }
                 else if (arg[1] != '-' && arg.size() > 2) // one dash, but more than one character (-> multiple flags)
                 {
-                    throw unknown_option("Unknown flags " + expand_multiple_flags(arg) +
+                    throw unknown_option("Unknown flags " + expand_multiple_flags(std::string{arg}) +
                                          ". In case this is meant to be a non-option/argument/parameter, " +
                                          "please specify the start of arguments with '--'. " +
                                          "See -h/--help for program information.");
                 }
                 else // unknown short or long option
                 {
-                    throw unknown_option("Unknown option " + arg +
+                    throw unknown_option("Unknown option " + std::string{arg} +
                                          ". In case this is meant to be a non-option/argument/parameter, " +
                                          "please specify the start of non-options with '--'. " +
                                          "See -h/--help for program information.");
@@ -590,7 +615,7 @@ private:
      */
     void check_for_left_over_args()
     {
-        if (std::find_if(argv.begin(), argv.end(), [](std::string const & s){return (s != "");}) != argv.end())
+        if (std::find_if(argv.begin(), argv.end(), [](std::string_view const s){return !s.empty();}) != argv.end())
             throw too_many_arguments("Too many arguments provided. Please see -h/--help for more information.");
     }
 
@@ -612,7 +637,8 @@ private:
      * - checks if the option is required but not set,
      * - retrieves any value found by the short or long identifier,
      * - throws on (mis)use of both identifiers for non-container type values,
-     * - re-throws the validation exception with appended option information
+     * - defers the validator invocation (with appended option information on failure)
+     *   until the whole command line was parsed successfully
      */
     template <typename option_type, typename validator_type>
     void get_option(option_type & value,
@@ -632,15 +658,18 @@ private:
 
         if (short_id_is_set || long_id_is_set)
         {
-            try
+            validator_calls.push_back([&value, validator, short_id, long_id] ()
             {
-                validator(value);
-            }
-            catch (std::exception & ex)
-            {
-                throw validation_failed(std::string("Validation failed for option ") +
-                                        combine_option_names(short_id, long_id) + ": " + ex.what());
-            }
+                try
+                {
+                    validator(value);
+                }
+                catch (std::exception & ex)
+                {
+                    throw validation_failed(std::string("Validation failed for option ") +
+                                            combine_option_names(short_id, long_id) + ": " + ex.what());
+                }
+            });
         }
         else // option is not set
         {
@@ -688,14 +717,15 @@ private:
      * - retrieves the next(no container type) or all (container type),
      *   remaining non empty value/s in argv,
      * - re-throws the value cast exception with appended positional option information,
-     * - and re-throws the validation exception with appended positional option information
+     * - and defers the validator invocation (with appended positional option information
+     *   on failure) until the whole command line was parsed successfully
      */
     template <typename option_type, typename validator_type>
     void get_positional_option(option_type & value,
                                validator_type && validator)
     {
         ++positional_option_count;
-        auto it = std::find_if(argv.begin(), argv.end(), [](std::string const & s){return (s != "");});
+        auto it = std::find_if(argv.begin(), argv.end(), [](std::string_view const s){return !s.empty();});
 
         if (it == argv.end())
             throw too_few_arguments("Not enough positional arguments provided (Need at least " +
@@ -718,8 +748,8 @@ private:
                                                   std::to_string(positional_option_count) + ": " + ex.what());
                 }
 
-                *it = ""; // remove arg from argv
-                it = std::find_if(it, argv.end(), [](std::string const & s){return (s != "");});
+                *it = std::string_view{}; // remove arg from argv
+                it = std::find_if(it, argv.end(), [](std::string_view const s){return !s.empty();});
                 ++positional_option_count;
             }
         }
@@ -735,18 +765,21 @@ private:
                                               std::to_string(positional_option_count) + ": " + ex.what());
             }
 
-            *it = ""; // remove arg from argv
+            *it = std::string_view{}; // remove arg from argv
         }
 
-        try
-        {
-            validator(value);
-        }
-        catch (std::exception & ex)
+        validator_calls.push_back([&value, validator, count = positional_option_count] ()
         {
-            throw validation_failed("Validation failed for positional option " +
-                                    std::to_string(positional_option_count) + ": " + ex.what());
-        }
+            try
+            {
+                validator(value);
+            }
+            catch (std::exception & ex)
+            {
+                throw validation_failed("Validation failed for positional option " +
+                                        std::to_string(count) + ": " + ex.what());
+            }
+        });
     }
 
     //!\brief Stores get_option calls to be evaluated when calling format_parse::parse().
@@ -755,14 +788,21 @@ private:
     std::vector<std::function<void()>> flag_calls;
     //!\brief Stores get_positional_option calls to be evaluated when calling format_parse::parse().
     std::vector<std::function<void()>> positional_option_calls;
+    //!\brief Stores deferred validator calls, executed after all arguments were parsed successfully.
+    std::vector<std::function<void()>> validator_calls;
     //!\brief Keeps track of the number of specified positional options.
     unsigned positional_option_count{0};
-    //!\brief Vector of command line arguments.
-    std::vector<std::string> argv;
+    //!\brief Views on the command line arguments (pointing into the original argv array).
+    std::vector<std::string_view> argv;
+    /*!\brief Backing storage for tokens rewritten while parsing grouped short flags.
+     * \details A std::deque never relocates its elements on growth, so the views in
+     *          format_parse::argv stay valid while more tokens are rewritten.
+     */
+    std::deque<std::string> modified_tokens;
     //!\brief Number of command line arguments.
     int argc;
     //!\brief Artificial end of argv if \-- was seen.
-    std::vector<std::string>::iterator end_of_options_it;
+    std::vector<std::string_view>::iterator end_of_options_it;
 };
 
 } // namespace seqan3
@@ -0,0 +1,344 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::contrib::buffer_queue.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+#include <seqan3/core/metafunction/iterator.hpp>
+#include <seqan3/core/platform.hpp>
+#include <seqan3/std/concepts>
+#include <seqan3/std/iterator>
+
+namespace seqan3::contrib
+{
+
+//!\brief The status returned by the operations of seqan3::contrib::buffer_queue.
+enum class queue_op_status : uint8_t
+{
+    //!\brief The operation was successful.
+    success = 0,
+    //!\brief The queue was empty (non-blocking pop only).
+    empty,
+    //!\brief The queue was full (non-blocking push only).
+    full,
+    //!\brief The queue was closed (and, for pop operations, empty).
+    closed
+};
+
+/*!\brief A bounded, thread-safe multi-producer multi-consumer queue over a ring buffer.
+ * \tparam value_t The element type; must satisfy std::Movable and std::DefaultConstructible
+ *                 (the ring buffer is preallocated with default-constructed elements).
+ *
+ * \details
+ *
+ * This queue is the shared building block of the parallel facilities in SeqAn (parallel alignment
+ * execution, asynchronous input/output): any number of producers push elements and any number of
+ * consumers pop them in FIFO order. The capacity is fixed at construction, so a slow consumer
+ * exerts backpressure on the producers instead of letting the queue grow without bound.
+ *
+ * The elements are stored in a preallocated ring buffer; all operations synchronise over a single
+ * mutex and two condition variables, but waiters are counted so that the common uncontended
+ * push/pop only pays for the mutex and never for a futile notify. The bulk overloads of
+ * wait_push() and wait_pop() move several elements per lock acquisition, which reduces the
+ * per-element synchronisation cost for cheap elements considerably.
+ *
+ * A queue can be closed via close(): subsequent pushes fail with seqan3::contrib::queue_op_status::closed
+ * and pops drain the remaining elements before also failing with
+ * seqan3::contrib::queue_op_status::closed. This is how producers signal "no more input" to blocked
+ * consumers, e.g. the destructor of seqan3::detail::execution_handler_parallel closes the task queue
+ * to terminate its worker threads.
+ */
+template <std::Movable value_t>
+//!\cond
+    requires std::DefaultConstructible<value_t>
+//!\endcond
+class buffer_queue
+{
+public:
+    /*!\name Associated types
+     * \{
+     */
+    //!\brief The element type.
+    using value_type = value_t;
+    //!\brief An unsigned integer type.
+    using size_type  = size_t;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \brief The queue is neither copyable nor movable, because producers and consumers hold references to it.
+     * \{
+     */
+    buffer_queue() = delete;
+    buffer_queue(buffer_queue const &) = delete;
+    buffer_queue(buffer_queue &&) = delete;
+    buffer_queue & operator=(buffer_queue const &) = delete;
+    buffer_queue & operator=(buffer_queue &&) = delete;
+    ~buffer_queue() = default;
+
+    //!\brief Constructs a queue that holds at most `capacity` elements (at least 1).
+    explicit buffer_queue(size_type const capacity) :
+        ring(std::max<size_type>(1, capacity))
+    {}
+    //!\}
+
+    /*!\name Pushing
+     * \{
+     */
+    /*!\brief Appends an element to the queue if space is available, without blocking.
+     * \param[in] value The element to append.
+     * \returns seqan3::contrib::queue_op_status::success, \ref queue_op_status::full "full" or
+     *          \ref queue_op_status::closed "closed".
+     */
+    queue_op_status try_push(value_type value)
+    {
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+
+            if (closed_)
+                return queue_op_status::closed;
+            if (count() == ring.size())
+                return queue_op_status::full;
+
+            ring[tail++ % ring.size()] = std::move(value);
+        }
+
+        notify_poppers();
+        return queue_op_status::success;
+    }
+
+    /*!\brief Appends an element to the queue, blocking while the queue is full.
+     * \param[in] value The element to append.
+     * \returns seqan3::contrib::queue_op_status::success or \ref queue_op_status::closed "closed"
+     *          (in which case the element was not appended).
+     */
+    queue_op_status wait_push(value_type value)
+    {
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+
+            ++push_waiters;
+            not_full.wait(lock, [this] { return count() < ring.size() || closed_; });
+            --push_waiters;
+
+            if (closed_)
+                return queue_op_status::closed;
+
+            ring[tail++ % ring.size()] = std::move(value);
+        }
+
+        notify_poppers();
+        return queue_op_status::success;
+    }
+
+    /*!\brief Appends the elements of `[begin_it, end_it)` to the queue, blocking while the queue is full.
+     * \tparam begin_iterator_type Must satisfy std::ForwardIterator.
+     * \param[in] begin_it Iterator to the first element to append.
+     * \param[in] end_it   Iterator behind the last element to append.
+     * \returns seqan3::contrib::queue_op_status::success or \ref queue_op_status::closed "closed"
+     *          (in which case a prefix of the elements may already have been appended).
+     *
+     * As many elements as fit are moved into the ring under a single lock acquisition; popped
+     * elements interleave with the pushed ones in submission order, like for repeated wait_push().
+     */
+    template <std::ForwardIterator begin_iterator_type, std::Sentinel<begin_iterator_type> end_iterator_type>
+    //!\cond
+        requires std::ConvertibleTo<value_type_t<begin_iterator_type>, value_type>
+    //!\endcond
+    queue_op_status wait_push(begin_iterator_type begin_it, end_iterator_type end_it)
+    {
+        while (begin_it != end_it)
+        {
+            {
+                std::unique_lock<std::mutex> lock{mutex};
+
+                ++push_waiters;
+                not_full.wait(lock, [this] { return count() < ring.size() || closed_; });
+                --push_waiters;
+
+                if (closed_)
+                    return queue_op_status::closed;
+
+                for (; (begin_it != end_it) && (count() < ring.size()); ++begin_it)
+                    ring[tail++ % ring.size()] = *begin_it;
+            }
+
+            notify_poppers();
+        }
+
+        return queue_op_status::success;
+    }
+    //!\}
+
+    /*!\name Popping
+     * \{
+     */
+    /*!\brief Extracts the oldest element of the queue if one is available, without blocking.
+     * \param[out] value Assigned the extracted element on success.
+     * \returns seqan3::contrib::queue_op_status::success, \ref queue_op_status::empty "empty" or
+     *          \ref queue_op_status::closed "closed" (only when the queue is also drained).
+     */
+    queue_op_status try_pop(value_type & value)
+    {
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+
+            if (count() == 0)
+                return closed_ ? queue_op_status::closed : queue_op_status::empty;
+
+            value = std::move(ring[head++ % ring.size()]);
+        }
+
+        notify_pushers();
+        return queue_op_status::success;
+    }
+
+    /*!\brief Extracts the oldest element of the queue, blocking while the queue is empty.
+     * \param[out] value Assigned the extracted element on success.
+     * \returns seqan3::contrib::queue_op_status::success or \ref queue_op_status::closed "closed"
+     *          (only once the queue is also drained).
+     */
+    queue_op_status wait_pop(value_type & value)
+    {
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+
+            ++pop_waiters;
+            not_empty.wait(lock, [this] { return count() > 0 || closed_; });
+            --pop_waiters;
+
+            if (count() == 0) // closed and drained
+                return queue_op_status::closed;
+
+            value = std::move(ring[head++ % ring.size()]);
+        }
+
+        notify_pushers();
+        return queue_op_status::success;
+    }
+
+    /*!\brief Extracts up to `max_count` elements, blocking while the queue is empty.
+     * \tparam output_iterator_type Must satisfy std::OutputIterator over #value_type.
+     * \param[out] out       Iterator the extracted elements are moved to.
+     * \param[in]  max_count The maximum number of elements to extract.
+     * \returns The number of extracted elements; `0` only when the queue is closed and drained.
+     *
+     * All immediately available elements (at most `max_count`) are moved out under a single lock
+     * acquisition; the call returns as soon as at least one element was extracted.
+     */
+    template <typename output_iterator_type>
+    //!\cond
+        requires std::OutputIterator<output_iterator_type, value_type>
+    //!\endcond
+    size_type wait_pop(output_iterator_type out, size_type const max_count)
+    {
+        size_type popped = 0;
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+
+            ++pop_waiters;
+            not_empty.wait(lock, [this] { return count() > 0 || closed_; });
+            --pop_waiters;
+
+            for (; (popped < max_count) && (count() > 0); ++popped, ++out)
+                *out = std::move(ring[head++ % ring.size()]);
+        }
+
+        if (popped > 0)
+            notify_pushers();
+        return popped;
+    }
+    //!\}
+
+    /*!\name State
+     * \{
+     */
+    /*!\brief Closes the queue: blocked and future pushes fail, pops drain the remaining elements.
+     *
+     * Closing an already closed queue is a no-op.
+     */
+    void close()
+    {
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            closed_ = true;
+        }
+        not_empty.notify_all();
+        not_full.notify_all();
+    }
+
+    //!\brief Whether the queue was closed.
+    bool is_closed() const
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        return closed_;
+    }
+
+    //!\brief The number of elements currently in the queue (a snapshot, stale as soon as it is returned).
+    size_type size() const
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        return count();
+    }
+
+    //!\brief The maximum number of elements the queue can hold.
+    size_type capacity() const noexcept
+    {
+        return ring.size();
+    }
+    //!\}
+
+private:
+    //!\brief The number of elements currently in the queue; the mutex must be held.
+    size_type count() const noexcept
+    {
+        return tail - head;
+    }
+
+    //!\brief Wakes a blocked consumer, but only if one is actually waiting.
+    void notify_poppers()
+    {
+        if (pop_waiters.load(std::memory_order_relaxed) > 0) // a waiter that registers after this check
+            not_empty.notify_one();                          // re-checks its predicate under the mutex
+    }
+
+    //!\brief Wakes a blocked producer, but only if one is actually waiting.
+    void notify_pushers()
+    {
+        if (push_waiters.load(std::memory_order_relaxed) > 0)
+            not_full.notify_one();
+    }
+
+    //!\brief The preallocated ring buffer.
+    std::vector<value_type> ring;
+    //!\brief Index of the oldest element; monotonically increasing, reduced modulo the capacity on access.
+    size_type head{0};
+    //!\brief Index behind the newest element; monotonically increasing, reduced modulo the capacity on access.
+    size_type tail{0};
+    //!\brief The mutex protecting the ring and the counters.
+    std::mutex mutable mutex{};
+    //!\brief Signalled when an element was extracted or the queue was closed.
+    std::condition_variable not_full{};
+    //!\brief Signalled when an element was appended or the queue was closed.
+    std::condition_variable not_empty{};
+    //!\brief The number of producers blocked in wait_push().
+    std::atomic<size_type> push_waiters{0};
+    //!\brief The number of consumers blocked in wait_pop().
+    std::atomic<size_type> pop_waiters{0};
+    //!\brief Whether close() was called.
+    bool closed_{false};
+};
+
+} // namespace seqan3::contrib
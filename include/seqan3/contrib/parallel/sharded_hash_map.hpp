@@ -0,0 +1,427 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::contrib::sharded_hash_map.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <seqan3/core/platform.hpp>
+#include <seqan3/std/concepts>
+
+namespace seqan3::contrib
+{
+
+/*!\brief A sharded open-addressing hash map for concurrent counting and deduplication workloads.
+ * \tparam key_t    The key type; must satisfy std::UnsignedIntegral (tuned for 8-byte keys).
+ * \tparam mapped_t The mapped type; must be default-constructible and copyable (tuned for 8-byte values).
+ *
+ * \details
+ *
+ * A single `std::unordered_map` behind one mutex serialises every thread on that mutex and collapses
+ * once a handful of threads hammer it. This map splits the key space over many independent shards
+ * (a power of two, default 64), each a linear-probing open-addressing table behind its own lock:
+ * threads only contend when they touch the same shard, and the flat tables avoid the allocation per
+ * node and pointer chasing of the std map. Keys are scrambled with a 64-bit finaliser before use,
+ * the high bits select the shard and the low bits the slot, so consecutive keys (k-mer ranks, text
+ * positions) spread evenly.
+ *
+ * All operations are linearisable per key. Rehashing happens per shard ("bulk rehash"): when a shard
+ * exceeds a load factor of 0.7 it doubles its slots while holding only its own lock, so the other
+ * shards stay writable throughout. Sizing hints via reserve() avoid rehashes entirely.
+ *
+ * The element count per operation protocol is:
+ *
+ * | operation          | effect                                                               |
+ * |--------------------|----------------------------------------------------------------------|
+ * | increment()        | `map[key] += delta`, inserting `delta` if absent (counting)          |
+ * | insert()           | insert only if absent, report whether it was (deduplication)         |
+ * | insert_or_assign() | insert or overwrite                                                  |
+ * | upsert()           | insert `init` if absent, else apply a functor to the mapped value    |
+ * | find()             | copy of the mapped value, if any                                     |
+ * | erase()            | remove (backward-shift deletion, no tombstones)                      |
+ *
+ * \attention The functors passed to upsert() and for_each() run under a shard lock; they must not
+ *            call back into the same map (self-deadlock) and should be cheap.
+ *
+ * ### Thread safety
+ *
+ * All member functions except clear() and reserve() may be called concurrently with each other.
+ * size() is only exact while no writers are active. clear() and reserve() require external
+ * synchronisation against concurrent writers of the affected keys.
+ */
+template <std::UnsignedIntegral key_t, typename mapped_t>
+class sharded_hash_map
+{
+private:
+    //!\brief One slot of a shard's table.
+    struct slot_type
+    {
+        key_t key;       //!< The key, valid while #occupied.
+        mapped_t mapped; //!< The mapped value, valid while #occupied.
+        bool occupied;   //!< Whether this slot holds an element.
+    };
+
+    //!\brief An independent table with its own lock; threads contend per shard only.
+    struct shard_type
+    {
+        //!\brief Protects everything below (mutable so that lookups on a const map can lock, too).
+        mutable std::mutex mutex{};
+        //!\brief The open-addressing table; its size is always a power of two.
+        std::vector<slot_type> slots{};
+        //!\brief The number of occupied slots.
+        size_t element_count{0};
+    };
+
+    //!\brief The default number of shards; plenty of lock striping for current thread counts.
+    static constexpr size_t default_shard_count = 64;
+    //!\brief Initial slots per shard (before the first rehash).
+    static constexpr size_t initial_slot_count = 16;
+
+    //!\brief The shards; the count is fixed at construction (a power of two).
+    std::vector<shard_type> shards;
+    //!\brief log2 of the shard count; the hash's high bits select the shard.
+    unsigned shard_bits;
+
+    //!\brief Scrambles a key (the splitmix64 finaliser); all bits of the result depend on all key bits.
+    static uint64_t mix(uint64_t value) noexcept
+    {
+        value += 0x9e3779b97f4a7c15u;
+        value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9u;
+        value = (value ^ (value >> 27)) * 0x94d049bb133111ebu;
+        return value ^ (value >> 31);
+    }
+
+    //!\brief The shard responsible for a hash (its high bits).
+    shard_type & shard_of(uint64_t const hash) noexcept
+    {
+        return shards[shard_bits == 0 ? 0 : (hash >> (64u - shard_bits))];
+    }
+
+    //!\copydoc shard_of()
+    shard_type const & shard_of(uint64_t const hash) const noexcept
+    {
+        return shards[shard_bits == 0 ? 0 : (hash >> (64u - shard_bits))];
+    }
+
+    //!\brief Round up to the next power of two (at least initial_slot_count).
+    static size_t round_up_slots(size_t n) noexcept
+    {
+        size_t slots = initial_slot_count;
+        while (slots < n)
+            slots *= 2;
+        return slots;
+    }
+
+    /*!\brief The slot of `key` in `shard`, or the first free slot of its probe chain.
+     * \pre The shard's lock is held and the shard is not full.
+     */
+    static size_t probe(shard_type const & shard, key_t const key, uint64_t const hash) noexcept
+    {
+        size_t const mask = shard.slots.size() - 1;
+        size_t i = hash & mask;
+
+        while (shard.slots[i].occupied && shard.slots[i].key != key)
+            i = (i + 1) & mask;
+
+        return i;
+    }
+
+    /*!\brief Doubles the shard's table when inserting one more element would exceed the load factor.
+     * \pre The shard's lock is held.
+     *
+     * All elements are re-inserted into the new table in one go while only this shard's lock is held,
+     * so writers of other shards proceed unhindered ("bulk rehash").
+     */
+    static void grow_if_needed(shard_type & shard)
+    {
+        if (shard.slots.empty())
+        {
+            shard.slots.resize(initial_slot_count, slot_type{key_t{}, mapped_t{}, false});
+            return;
+        }
+
+        if ((shard.element_count + 1) * 10 <= shard.slots.size() * 7) // load factor 0.7
+            return;
+
+        std::vector<slot_type> old_slots(shard.slots.size() * 2, slot_type{key_t{}, mapped_t{}, false});
+        std::swap(old_slots, shard.slots);
+
+        for (slot_type & slot : old_slots)
+        {
+            if (!slot.occupied)
+                continue;
+
+            size_t const i = probe(shard, slot.key, mix(slot.key));
+            shard.slots[i] = std::move(slot);
+        }
+    }
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    //!\brief The shards' mutexes pin the map to its address.
+    sharded_hash_map(sharded_hash_map const &)             = delete;
+    //!\copydoc sharded_hash_map(sharded_hash_map const &)
+    sharded_hash_map & operator=(sharded_hash_map const &) = delete;
+    //!\copydoc sharded_hash_map(sharded_hash_map const &)
+    sharded_hash_map(sharded_hash_map &&)                  = delete;
+    //!\copydoc sharded_hash_map(sharded_hash_map const &)
+    sharded_hash_map & operator=(sharded_hash_map &&)      = delete;
+    ~sharded_hash_map()                                    = default;
+
+    /*!\brief Construct the map.
+     * \param[in] expected_elements Sizing hint; tables are preallocated so this many elements fit
+     *                              without a rehash (0 defers allocation to the first insertions).
+     * \param[in] shard_count_hint  The number of shards, rounded up to a power of two
+     *                              (0 selects the default of 64).
+     */
+    explicit sharded_hash_map(size_t const expected_elements = 0, size_t const shard_count_hint = 0)
+    {
+        size_t const target = (shard_count_hint == 0) ? default_shard_count : shard_count_hint;
+        size_t shard_count = 1;
+        shard_bits = 0;
+        while (shard_count < target)
+        {
+            shard_count *= 2;
+            ++shard_bits;
+        }
+
+        shards = std::vector<shard_type>(shard_count);
+
+        if (expected_elements > 0)
+            reserve(expected_elements);
+    }
+    //!\}
+
+    //!\brief The number of shards (a power of two).
+    size_t shard_count() const noexcept
+    {
+        return shards.size();
+    }
+
+    /*!\brief Adds `delta` to the value of `key`, inserting `delta` if the key is absent.
+     * \returns A copy of the value after the addition.
+     *
+     * The canonical counting operation: `increment(kmer)` in a parallel loop builds a k-mer
+     * spectrum with contention only on shard collisions.
+     */
+    mapped_t increment(key_t const key, mapped_t const delta = mapped_t{1})
+    {
+        return upsert(key, delta, [delta] (mapped_t & value) { value += delta; });
+    }
+
+    /*!\brief Inserts `(key, value)` if `key` is absent.
+     * \returns `true` iff the element was inserted (i.e. the key was seen for the first time).
+     */
+    bool insert(key_t const key, mapped_t const value)
+    {
+        uint64_t const hash = mix(key);
+        shard_type & shard = shard_of(hash);
+        std::lock_guard<std::mutex> lock{shard.mutex};
+
+        grow_if_needed(shard);
+        size_t const i = probe(shard, key, hash);
+
+        if (shard.slots[i].occupied)
+            return false;
+
+        shard.slots[i] = slot_type{key, value, true};
+        ++shard.element_count;
+        return true;
+    }
+
+    //!\brief Inserts `(key, value)`, overwriting the value if the key is present.
+    void insert_or_assign(key_t const key, mapped_t const value)
+    {
+        upsert(key, value, [value] (mapped_t & mapped) { mapped = value; });
+    }
+
+    /*!\brief Inserts `(key, init)` if `key` is absent, otherwise applies `update_fn` to the mapped value.
+     * \param[in] key       The key.
+     * \param[in] init      The value inserted when the key is absent.
+     * \param[in] update_fn Invoked as `update_fn(mapped_t &)` under the shard lock when the key is present.
+     * \returns A copy of the mapped value after the operation.
+     */
+    template <typename update_fn_t>
+    mapped_t upsert(key_t const key, mapped_t const init, update_fn_t && update_fn)
+    {
+        uint64_t const hash = mix(key);
+        shard_type & shard = shard_of(hash);
+        std::lock_guard<std::mutex> lock{shard.mutex};
+
+        grow_if_needed(shard);
+        size_t const i = probe(shard, key, hash);
+
+        if (shard.slots[i].occupied)
+        {
+            update_fn(shard.slots[i].mapped);
+        }
+        else
+        {
+            shard.slots[i] = slot_type{key, init, true};
+            ++shard.element_count;
+        }
+
+        return shard.slots[i].mapped;
+    }
+
+    //!\brief A copy of the value of `key`, or std::nullopt if the key is absent.
+    std::optional<mapped_t> find(key_t const key) const
+    {
+        uint64_t const hash = mix(key);
+        shard_type const & shard = shard_of(hash);
+        std::lock_guard<std::mutex> lock{shard.mutex};
+
+        if (shard.slots.empty())
+            return std::nullopt;
+
+        size_t const i = probe(shard, key, hash);
+        if (!shard.slots[i].occupied)
+            return std::nullopt;
+
+        return shard.slots[i].mapped;
+    }
+
+    //!\brief Whether `key` is present.
+    bool contains(key_t const key) const
+    {
+        return find(key).has_value();
+    }
+
+    /*!\brief Removes `key` from the map.
+     * \returns `true` iff the key was present.
+     *
+     * Uses backward-shift deletion, i.e. the probe chains stay dense and lookups never pay for
+     * tombstones of deleted elements.
+     */
+    bool erase(key_t const key)
+    {
+        uint64_t const hash = mix(key);
+        shard_type & shard = shard_of(hash);
+        std::lock_guard<std::mutex> lock{shard.mutex};
+
+        if (shard.slots.empty())
+            return false;
+
+        size_t const mask = shard.slots.size() - 1;
+        size_t i = probe(shard, key, hash);
+
+        if (!shard.slots[i].occupied)
+            return false;
+
+        // close the gap: pull every displaced element of the probe chain one step towards its home
+        size_t j = i;
+        while (true)
+        {
+            j = (j + 1) & mask;
+            if (!shard.slots[j].occupied)
+                break;
+
+            size_t const home = mix(shard.slots[j].key) & mask;
+            if (((j - home) & mask) >= ((j - i) & mask)) // slot j may move into the gap at i
+            {
+                shard.slots[i] = std::move(shard.slots[j]);
+                i = j;
+            }
+        }
+
+        shard.slots[i].occupied = false;
+        --shard.element_count;
+        return true;
+    }
+
+    /*!\brief Applies `fn` to every element as `fn(key_t, mapped_t const &)`, shard by shard.
+     *
+     * Each shard is locked while its elements are visited; elements inserted concurrently into
+     * not-yet-visited shards may or may not be seen. The iteration order is unspecified.
+     */
+    template <typename fn_t>
+    void for_each(fn_t && fn) const
+    {
+        for (shard_type const & shard : shards)
+        {
+            std::lock_guard<std::mutex> lock{shard.mutex};
+            for (slot_type const & slot : shard.slots)
+                if (slot.occupied)
+                    fn(slot.key, slot.mapped);
+        }
+    }
+
+    //!\brief The number of elements; exact only while no writers are active.
+    size_t size() const
+    {
+        size_t total = 0;
+        for (shard_type const & shard : shards)
+        {
+            std::lock_guard<std::mutex> lock{shard.mutex};
+            total += shard.element_count;
+        }
+        return total;
+    }
+
+    //!\brief Whether the map holds no elements; exact only while no writers are active.
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    /*!\brief Preallocates tables so that `expected_elements` fit without a rehash.
+     * \attention Requires external synchronisation against concurrent writers.
+     */
+    void reserve(size_t const expected_elements)
+    {
+        // distribute over the shards and leave headroom below the load factor
+        size_t const per_shard = (expected_elements + shards.size() - 1) / shards.size();
+        size_t const slot_count = round_up_slots(per_shard * 10 / 7 + 1);
+
+        for (shard_type & shard : shards)
+        {
+            std::lock_guard<std::mutex> lock{shard.mutex};
+
+            if (shard.slots.size() >= slot_count)
+                continue;
+
+            std::vector<slot_type> old_slots(slot_count, slot_type{key_t{}, mapped_t{}, false});
+            std::swap(old_slots, shard.slots);
+
+            for (slot_type & slot : old_slots)
+            {
+                if (!slot.occupied)
+                    continue;
+
+                size_t const i = probe(shard, slot.key, mix(slot.key));
+                shard.slots[i] = std::move(slot);
+            }
+        }
+    }
+
+    /*!\brief Removes all elements, keeping the allocated tables.
+     * \attention Requires external synchronisation against concurrent writers.
+     */
+    void clear()
+    {
+        for (shard_type & shard : shards)
+        {
+            std::lock_guard<std::mutex> lock{shard.mutex};
+            for (slot_type & slot : shard.slots)
+                slot.occupied = false;
+            shard.element_count = 0;
+        }
+    }
+};
+
+} // namespace seqan3::contrib
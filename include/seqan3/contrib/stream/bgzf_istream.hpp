@@ -0,0 +1,344 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+// BGZF block-decompressing istream with parallel decompression.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <future>
+#include <iostream>
+#include <vector>
+
+#ifndef SEQAN3_HAS_ZLIB
+#error "This file cannot be used when building without ZLIB-support."
+#endif
+
+#include <zlib.h>
+
+#include <seqan3/contrib/stream/bgzf_stream_util.hpp>
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::contrib
+{
+
+// --------------------------------------------------------------------------
+// Class basic_bgzf_istreambuf
+// --------------------------------------------------------------------------
+// A stream decorator that takes BGZF compressed input (concatenated fixed-size
+// gzip members, see section 4.1 of the SAM specification) and decompresses it.
+//
+// The compressed blocks are read ahead serially (their size is stored in the
+// gzip extra field, so no decompression is needed to find the block borders)
+// and handed to asynchronous worker jobs, so up to thread_count_ blocks are
+// inflated concurrently while the consumer drains the oldest one.
+
+template <typename Elem,
+          typename Tr = std::char_traits<Elem>,
+          typename ElemA = std::allocator<Elem>,
+          typename ByteT = unsigned char,
+          typename ByteAT = std::allocator<ByteT>
+          >
+class basic_bgzf_istreambuf :
+    public std::basic_streambuf<Elem, Tr>
+{
+public:
+    typedef std::basic_istream<Elem, Tr> &              istream_reference;
+    typedef ElemA                                       char_allocator_type;
+    typedef ByteT                                       byte_type;
+    typedef ByteAT                                      byte_allocator_type;
+    typedef Tr                                          traits_type;
+    typedef typename Tr::char_type                      char_type;
+    typedef typename Tr::int_type                       int_type;
+    typedef std::vector<char_type, char_allocator_type> char_vector_type;
+
+    static_assert(sizeof(char_type) == 1, "BGZF streams are byte oriented.");
+
+    // Construct a BGZF decompressing stream buffer.
+    basic_bgzf_istreambuf(istream_reference istream_,
+                          size_t thread_count_ = bgzf_thread_count) :
+        m_istream(istream_),
+        m_thread_count(thread_count_ == 0 ? 1 : thread_count_),
+        m_buffer(4)
+    {
+        this->setg(&(m_buffer[0]) + 4,  // beginning of putback area
+                   &(m_buffer[0]) + 4,  // read position
+                   &(m_buffer[0]) + 4); // end position
+    }
+
+    int_type underflow()
+    {
+        if (this->gptr() && (this->gptr() < this->egptr()))
+            return *reinterpret_cast<unsigned char *>(this->gptr());
+
+        int n_putback = static_cast<int>(this->gptr() - this->eback());
+        if (n_putback > 4)
+            n_putback = 4;
+
+        char_type putback[4];
+        std::memcpy(putback, this->gptr() - n_putback, n_putback);
+
+        // fetch the next non-empty decompressed block, in the order the blocks occur in the file
+        std::vector<char> block{};
+        do
+        {
+            fill_queue();
+
+            if (m_queue.empty()) // no more blocks -> EOF
+                return traits_type::eof();
+
+            block = m_queue.front().get();
+            m_queue.pop_front();
+            m_current_block_offset = m_block_offsets.front();
+            m_block_offsets.pop_front();
+        }
+        while (block.empty()); // empty blocks carry no data, e.g. the end-of-file marker
+
+        m_buffer.resize(4 + block.size());
+        std::memcpy(&(m_buffer[0]) + (4 - n_putback), putback, n_putback);
+        std::memcpy(&(m_buffer[0]) + 4, block.data(), block.size());
+
+        // reset buffer pointers
+        this->setg(&(m_buffer[0]) + (4 - n_putback),         // beginning of putback area
+                   &(m_buffer[0]) + 4,                       // read position
+                   &(m_buffer[0]) + 4 + block.size());       // end of buffer
+
+        // return next character
+        return *reinterpret_cast<unsigned char *>(this->gptr());
+    }
+
+    // returns the compressed input istream
+    istream_reference get_istream() { return m_istream; }
+
+    // Repositions the stream to a BGZF virtual file offset, i.e. the offset of a compressed
+    // block in the underlying file shifted left by 16 bits, combined with the offset inside
+    // the decompressed block (the coordinate system used by BAI/CSI/tabix indexes).
+    // The underlying stream must be seekable.
+    void seek_virtual(uint64_t const voffset)
+    {
+        // discard blocks read ahead; popping a future blocks until its job has finished
+        m_queue.clear();
+        m_block_offsets.clear();
+        m_reached_end = false;
+
+        m_istream.clear();
+        m_istream.seekg(static_cast<std::streamoff>(voffset >> 16));
+        if (!m_istream.good())
+            throw std::runtime_error{"Could not seek to the requested BGZF virtual offset."};
+
+        this->setg(&(m_buffer[0]) + 4, &(m_buffer[0]) + 4, &(m_buffer[0]) + 4); // drop buffered data
+
+        size_t const uoffset = voffset & 0xffffu;
+
+        if (traits_type::eq_int_type(underflow(), traits_type::eof()))
+        {
+            if (uoffset != 0)
+                throw std::runtime_error{"The BGZF virtual offset points behind the end of the file."};
+            return; // seeking to the position right after the last block is a valid "end" position
+        }
+
+        if (uoffset > static_cast<size_t>(this->egptr() - this->gptr()))
+            throw std::runtime_error{"The BGZF virtual offset points outside of its block."};
+
+        this->gbump(static_cast<int>(uoffset));
+    }
+
+    // Returns the BGZF virtual file offset of the next character to be read.
+    uint64_t tell_virtual()
+    {
+        if (this->gptr() != this->egptr()) // inside the current block
+            return (m_current_block_offset << 16) |
+                   static_cast<uint64_t>(this->gptr() - (&(m_buffer[0]) + 4));
+
+        // the current block is exhausted; the next character comes from the following block
+        fill_queue();
+
+        if (!m_block_offsets.empty())
+            return m_block_offsets.front() << 16;
+
+        return m_end_offset << 16; // end of file; the offset right after the last block
+    }
+
+private:
+    // reads ahead compressed blocks until thread_count_ decompression jobs are in flight
+    void fill_queue()
+    {
+        while (!m_reached_end && m_queue.size() < m_thread_count)
+        {
+            std::vector<char> compressed{};
+
+            uint64_t const block_offset = static_cast<uint64_t>(std::streamoff(m_istream.tellg()));
+
+            if (!read_compressed_block(compressed))
+            {
+                m_reached_end = true;
+                m_end_offset = block_offset;
+                break;
+            }
+
+            m_block_offsets.push_back(block_offset);
+            m_queue.push_back(std::async(std::launch::async, bgzf_decompress_block, std::move(compressed)));
+        }
+    }
+
+    // reads one complete block; returns false on a clean EOF of the underlying stream
+    bool read_compressed_block(std::vector<char> & compressed)
+    {
+        unsigned char header[BGZF_BLOCK_HEADER_LENGTH];
+
+        m_istream.read(reinterpret_cast<char *>(&header[0]), 12); // fixed part of the gzip header
+        if (m_istream.gcount() == 0)
+            return false; // clean end of the compressed stream
+
+        if (m_istream.gcount() != 12 ||
+            header[0] != 0x1f || header[1] != 0x8b || header[2] != 0x08 || (header[3] & 0x04) == 0)
+            throw std::runtime_error{"BGZF block header is malformed."};
+
+        size_t const xlen = header[10] | (header[11] << 8);
+        std::vector<char> extra(xlen);
+        m_istream.read(extra.data(), xlen);
+        if (static_cast<size_t>(m_istream.gcount()) != xlen)
+            throw std::runtime_error{"BGZF block header is truncated."};
+
+        // find the "BC" subfield that holds the total block size
+        size_t block_size = 0;
+        bool found_bc = false;
+        for (size_t i = 0; i + 4 <= xlen;)
+        {
+            size_t const slen = static_cast<unsigned char>(extra[i + 2]) |
+                                (static_cast<unsigned char>(extra[i + 3]) << 8);
+            if (extra[i] == 'B' && extra[i + 1] == 'C' && slen == 2 && i + 6 <= xlen)
+            {
+                block_size = (static_cast<unsigned char>(extra[i + 4]) |
+                              (static_cast<unsigned char>(extra[i + 5]) << 8)) + 1;
+                found_bc = true;
+                break;
+            }
+            i += 4 + slen;
+        }
+
+        if (!found_bc || block_size < 12 + xlen + BGZF_BLOCK_FOOTER_LENGTH || block_size > BGZF_MAX_BLOCK_SIZE)
+            throw std::runtime_error{"BGZF block header lacks a valid BC subfield."};
+
+        // the remainder of the block: compressed data and the 8 byte footer
+        compressed.resize(block_size - 12 - xlen);
+        m_istream.read(compressed.data(), compressed.size());
+        if (static_cast<size_t>(m_istream.gcount()) != compressed.size())
+            throw std::runtime_error{"BGZF block is truncated."};
+
+        return true;
+    }
+
+    istream_reference m_istream;
+    size_t m_thread_count;
+    char_vector_type m_buffer;
+    std::deque<std::future<std::vector<char>>> m_queue;
+    std::deque<uint64_t> m_block_offsets;     // compressed file offsets of the queued blocks
+    uint64_t m_current_block_offset{0};       // compressed file offset of the block in the get area
+    uint64_t m_end_offset{0};                 // compressed file offset right after the last block
+    bool m_reached_end{false};
+};
+
+// --------------------------------------------------------------------------
+// Class basic_bgzf_istreambase
+// --------------------------------------------------------------------------
+// Base class for BGZF istreams.
+// Contains a basic_bgzf_istreambuf.
+
+template <typename Elem,
+          typename Tr = std::char_traits<Elem>,
+          typename ElemA = std::allocator<Elem>,
+          typename ByteT = unsigned char,
+          typename ByteAT = std::allocator<ByteT>
+          >
+class basic_bgzf_istreambase :
+    virtual public std::basic_ios<Elem, Tr>
+{
+public:
+    typedef std::basic_istream<Elem, Tr> &                        istream_reference;
+    typedef basic_bgzf_istreambuf<Elem, Tr, ElemA, ByteT, ByteAT> bgzf_streambuf_type;
+
+    basic_bgzf_istreambase(istream_reference istream_,
+                           size_t thread_count_) :
+        m_buf(istream_, thread_count_)
+    {
+        this->init(&m_buf);
+    }
+
+    // returns the underlying BGZF istream object
+    bgzf_streambuf_type * rdbuf() { return &m_buf; }
+
+private:
+    bgzf_streambuf_type m_buf;
+};
+
+// --------------------------------------------------------------------------
+// Class basic_bgzf_istream
+// --------------------------------------------------------------------------
+// A BGZF decompressing istream
+//
+// This class is an istream decorator like basic_gz_istream, but it exploits
+// the block structure of BGZF to decompress multiple blocks concurrently.
+// It only accepts BGZF input; arbitrary gzip files must be read with
+// basic_gz_istream instead.
+
+template <typename Elem,
+          typename Tr = std::char_traits<Elem>,
+          typename ElemA = std::allocator<Elem>,
+          typename ByteT = unsigned char,
+          typename ByteAT = std::allocator<ByteT>
+          >
+class basic_bgzf_istream :
+    public basic_bgzf_istreambase<Elem, Tr, ElemA, ByteT, ByteAT>,
+    public std::basic_istream<Elem, Tr>
+{
+public:
+    typedef basic_bgzf_istreambase<Elem, Tr, ElemA, ByteT, ByteAT> bgzf_istreambase_type;
+    typedef std::basic_istream<Elem, Tr>                           istream_type;
+    typedef istream_type &                                         istream_reference;
+
+    // Construct a BGZF decompressing stream
+    //
+    // istream_ input stream holding the compressed data
+    // thread_count_ number of blocks decompressed concurrently
+
+    basic_bgzf_istream(istream_reference istream_,
+                       size_t thread_count_ = bgzf_thread_count) :
+        bgzf_istreambase_type(istream_, thread_count_),
+        istream_type(this->rdbuf())
+    {}
+
+    // Repositions the stream to a BGZF virtual file offset (see basic_bgzf_istreambuf::seek_virtual).
+    void seek_virtual(uint64_t const voffset)
+    {
+        this->clear(); // a previous read may have set eofbit
+        this->rdbuf()->seek_virtual(voffset);
+    }
+
+    // Returns the BGZF virtual file offset of the next character to be read.
+    uint64_t tell_virtual()
+    {
+        return this->rdbuf()->tell_virtual();
+    }
+
+#ifdef _WIN32
+private:
+    void _Add_vtordisp1() {}  // Required to avoid VC++ warning C4250
+    void _Add_vtordisp2() {}  // Required to avoid VC++ warning C4250
+#endif
+};
+
+// ===========================================================================
+// Typedefs
+// ===========================================================================
+
+// A typedef for basic_bgzf_istream<char>
+typedef basic_bgzf_istream<char> bgzf_istream;
+
+} // namespace seqan3::contrib
@@ -0,0 +1,271 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+// BGZF block-compressing ostream with parallel compression.
+
+#pragma once
+
+#include <deque>
+#include <future>
+#include <iostream>
+#include <vector>
+
+#ifndef SEQAN3_HAS_ZLIB
+#error "This file cannot be used when building without ZLIB-support."
+#endif
+
+#include <zlib.h>
+
+#include <seqan3/contrib/stream/bgzf_stream_util.hpp>
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::contrib
+{
+
+// --------------------------------------------------------------------------
+// Class basic_bgzf_ostreambuf
+// --------------------------------------------------------------------------
+// A stream decorator that compresses its input into BGZF blocks (concatenated
+// fixed-size gzip members, see section 4.1 of the SAM specification).
+//
+// Every full put buffer is handed to an asynchronous worker job, so up to
+// thread_count_ blocks are compressed concurrently while the streambuf
+// already fills the next one; the finished blocks are written out in order.
+
+template <typename Elem,
+          typename Tr = std::char_traits<Elem>,
+          typename ElemA = std::allocator<Elem>,
+          typename ByteT = unsigned char,
+          typename ByteAT = std::allocator<ByteT>
+          >
+class basic_bgzf_ostreambuf :
+    public std::basic_streambuf<Elem, Tr>
+{
+public:
+    typedef std::basic_ostream<Elem, Tr> &              ostream_reference;
+    typedef ElemA                                       char_allocator_type;
+    typedef ByteT                                       byte_type;
+    typedef ByteAT                                      byte_allocator_type;
+    typedef Tr                                          traits_type;
+    typedef typename Tr::char_type                      char_type;
+    typedef typename Tr::int_type                       int_type;
+    typedef std::vector<char_type, char_allocator_type> char_vector_type;
+
+    static_assert(sizeof(char_type) == 1, "BGZF streams are byte oriented.");
+
+    // Construct a BGZF compressing stream buffer.
+    basic_bgzf_ostreambuf(ostream_reference ostream_,
+                          size_t level_ = Z_DEFAULT_COMPRESSION,
+                          size_t thread_count_ = bgzf_thread_count) :
+        m_ostream(ostream_),
+        m_level(static_cast<int>(level_)),
+        m_thread_count(thread_count_ == 0 ? 1 : thread_count_),
+        m_buffer(BGZF_BLOCK_SIZE)
+    {
+        this->setp(&(m_buffer[0]), &(m_buffer[m_buffer.size() - 1]));
+    }
+
+    ~basic_bgzf_ostreambuf()
+    {
+        flush_finalize();
+        m_ostream.flush();
+    }
+
+    int sync()
+    {
+        if (this->pptr() && this->pptr() > this->pbase())
+        {
+            if (traits_type::eq_int_type(overflow(traits_type::eof()), traits_type::eof()))
+                return -1;
+        }
+
+        write_pending_blocks();
+        m_ostream.flush();
+        return m_ostream.good() ? 0 : -1;
+    }
+
+    int_type overflow(int_type c)
+    {
+        int w = static_cast<int>(this->pptr() - this->pbase());
+
+        if (!traits_type::eq_int_type(c, traits_type::eof()))
+        {
+            *this->pptr() = c;
+            ++w;
+        }
+
+        if (compress_block(this->pbase(), w))
+        {
+            this->setp(this->pbase(), this->epptr());
+            return c;
+        }
+        else
+        {
+            return traits_type::eof();
+        }
+    }
+
+    // flushes all pending blocks and writes the BGZF end-of-file marker.
+    // This method is called by the destructor; afterwards nothing must be written anymore.
+    std::streamsize flush_finalize()
+    {
+        if (m_finalized)
+            return 0;
+        m_finalized = true;
+
+        if (this->pptr() && this->pptr() > this->pbase())
+            overflow(traits_type::eof());
+
+        write_pending_blocks();
+
+        m_ostream.write(reinterpret_cast<char const *>(&BGZF_END_OF_FILE_MARKER[0]),
+                        sizeof(BGZF_END_OF_FILE_MARKER));
+        m_ostream.flush();
+
+        return sizeof(BGZF_END_OF_FILE_MARKER);
+    }
+
+private:
+    // dispatches one block to a compression job; stalls on the oldest job when the pipeline is full
+    bool compress_block(char_type * buffer_, std::streamsize buffer_size_)
+    {
+        if (buffer_size_ > 0)
+        {
+            std::vector<char> data(buffer_, buffer_ + buffer_size_);
+            m_queue.push_back(std::async(std::launch::async, bgzf_compress_block, std::move(data), m_level));
+        }
+
+        while (m_queue.size() >= m_thread_count)
+            if (!write_front_block())
+                return false;
+
+        return m_ostream.good();
+    }
+
+    // writes the oldest compressed block to the underlying stream, preserving the block order
+    bool write_front_block()
+    {
+        std::string const block = m_queue.front().get();
+        m_queue.pop_front();
+
+        m_ostream.write(block.data(), block.size());
+        return m_ostream.good();
+    }
+
+    void write_pending_blocks()
+    {
+        while (!m_queue.empty())
+            write_front_block();
+    }
+
+    ostream_reference m_ostream;
+    int m_level;
+    size_t m_thread_count;
+    char_vector_type m_buffer;
+    std::deque<std::future<std::string>> m_queue;
+    bool m_finalized{false};
+};
+
+// --------------------------------------------------------------------------
+// Class basic_bgzf_ostreambase
+// --------------------------------------------------------------------------
+// Base class for BGZF ostreams.
+// Contains a basic_bgzf_ostreambuf.
+
+template <typename Elem,
+          typename Tr = std::char_traits<Elem>,
+          typename ElemA = std::allocator<Elem>,
+          typename ByteT = unsigned char,
+          typename ByteAT = std::allocator<ByteT>
+          >
+class basic_bgzf_ostreambase :
+    virtual public std::basic_ios<Elem, Tr>
+{
+public:
+    typedef std::basic_ostream<Elem, Tr> &                        ostream_reference;
+    typedef basic_bgzf_ostreambuf<Elem, Tr, ElemA, ByteT, ByteAT> bgzf_streambuf_type;
+
+    basic_bgzf_ostreambase(ostream_reference ostream_,
+                           size_t level_,
+                           size_t thread_count_) :
+        m_buf(ostream_, level_, thread_count_)
+    {
+        this->init(&m_buf);
+    }
+
+    // returns the underlying BGZF ostream object
+    bgzf_streambuf_type * rdbuf() { return &m_buf; }
+
+private:
+    bgzf_streambuf_type m_buf;
+};
+
+// --------------------------------------------------------------------------
+// Class basic_bgzf_ostream
+// --------------------------------------------------------------------------
+// A BGZF compressing ostream
+//
+// This class is an ostream decorator like basic_gz_ostream, but it produces
+// the block layout of BGZF and compresses blocks with multiple threads.
+// The output is a valid (multi-member) gzip file that any gzip decompressor
+// can read, while the block structure additionally permits random access and
+// parallel decompression.
+
+template <typename Elem,
+          typename Tr = std::char_traits<Elem>,
+          typename ElemA = std::allocator<Elem>,
+          typename ByteT = unsigned char,
+          typename ByteAT = std::allocator<ByteT>
+          >
+class basic_bgzf_ostream :
+    public basic_bgzf_ostreambase<Elem, Tr, ElemA, ByteT, ByteAT>,
+    public std::basic_ostream<Elem, Tr>
+{
+public:
+    typedef basic_bgzf_ostreambase<Elem, Tr, ElemA, ByteT, ByteAT> bgzf_ostreambase_type;
+    typedef std::basic_ostream<Elem, Tr>                           ostream_type;
+    typedef ostream_type &                                         ostream_reference;
+
+    // Constructs a BGZF ostream decorator
+    //
+    // ostream_ ostream where the compressed output is written
+    // level_ level of compression 0, bad and fast, 9, good and slower
+    // thread_count_ number of blocks compressed concurrently
+
+    basic_bgzf_ostream(ostream_reference ostream_,
+                       size_t level_ = Z_DEFAULT_COMPRESSION,
+                       size_t thread_count_ = bgzf_thread_count) :
+        bgzf_ostreambase_type(ostream_, level_, thread_count_),
+        ostream_type(this->rdbuf())
+    {}
+
+    ~basic_bgzf_ostream()
+    {
+        this->flush(); this->rdbuf()->flush_finalize();
+    }
+
+    // flush inner buffer and compression pipeline
+    basic_bgzf_ostream<Elem, Tr> & zflush()
+    {
+        this->flush(); this->rdbuf()->sync(); return *this;
+    }
+
+#ifdef _WIN32
+private:
+    void _Add_vtordisp1() {}  // Required to avoid VC++ warning C4250
+    void _Add_vtordisp2() {}  // Required to avoid VC++ warning C4250
+#endif
+};
+
+// ===========================================================================
+// Typedefs
+// ===========================================================================
+
+// A typedef for basic_bgzf_ostream<char>
+typedef basic_bgzf_ostream<char> bgzf_ostream;
+
+} // namespace seqan3::contrib
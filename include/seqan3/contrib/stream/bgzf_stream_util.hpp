@@ -0,0 +1,139 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+// Shared utilities of the BGZF compression streams.
+
+#pragma once
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef SEQAN3_HAS_ZLIB
+#error "This file cannot be used when building without ZLIB-support."
+#endif
+
+#include <zlib.h>
+
+#include <seqan3/core/platform.hpp>
+#include <seqan3/contrib/stream/crc32.hpp>
+
+namespace seqan3::contrib
+{
+
+// BGZF block layout constants, see section 4.1 of the SAM specification.
+const size_t BGZF_BLOCK_HEADER_LENGTH = 18;
+const size_t BGZF_BLOCK_FOOTER_LENGTH = 8;
+// Maximum total size of one BGZF block (header + compressed data + footer).
+const size_t BGZF_MAX_BLOCK_SIZE = 65536;
+// Uncompressed bytes stored per block; the value used by the reference bgzip implementation.
+// It is small enough that even incompressible data deflates into one block.
+const size_t BGZF_BLOCK_SIZE = 65280;
+
+// The fixed empty block that marks the end of a BGZF file.
+const unsigned char BGZF_END_OF_FILE_MARKER[28] =
+{
+    0x1f, 0x8b, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x06, 0x00, 0x42, 0x43,
+    0x02, 0x00, 0x1b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+// Number of (de)compression jobs kept in flight by the BGZF streams.
+// Defaults to the number of hardware threads; assign to it before opening a
+// file to raise or lower the parallelism of compressed reading and writing.
+inline size_t bgzf_thread_count = (std::thread::hardware_concurrency() == 0)
+                                ? 2
+                                : std::thread::hardware_concurrency();
+
+// Compresses up to BGZF_BLOCK_SIZE bytes into one complete BGZF block.
+inline std::string bgzf_compress_block(std::vector<char> const & data, int level)
+{
+    std::string block(BGZF_MAX_BLOCK_SIZE, '\0');
+
+    z_stream zip_stream{};
+    if (deflateInit2(&zip_stream, level, Z_DEFLATED, -15 /*raw deflate*/, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+        throw std::runtime_error{"BGZF deflateInit2() failed."};
+
+    zip_stream.next_in = (Bytef *)data.data();
+    zip_stream.avail_in = static_cast<uInt>(data.size());
+    zip_stream.next_out = (Bytef *)block.data() + BGZF_BLOCK_HEADER_LENGTH;
+    zip_stream.avail_out = static_cast<uInt>(BGZF_MAX_BLOCK_SIZE - BGZF_BLOCK_HEADER_LENGTH
+                                                                 - BGZF_BLOCK_FOOTER_LENGTH);
+
+    int const status = deflate(&zip_stream, Z_FINISH);
+    size_t const compressed_size = zip_stream.total_out;
+    deflateEnd(&zip_stream);
+
+    if (status != Z_STREAM_END)
+        throw std::runtime_error{"BGZF deflate() failed (data does not fit into one block)."};
+
+    size_t const block_size = BGZF_BLOCK_HEADER_LENGTH + compressed_size + BGZF_BLOCK_FOOTER_LENGTH;
+
+    // gzip header with the FEXTRA flag and the "BC" subfield holding the block size.
+    unsigned char * const header = (unsigned char *)block.data();
+    std::memset(header, 0, BGZF_BLOCK_HEADER_LENGTH);
+    header[0] = 0x1f;                                   // ID1
+    header[1] = 0x8b;                                   // ID2
+    header[2] = 0x08;                                   // CM = deflate
+    header[3] = 0x04;                                   // FLG = FEXTRA
+    header[9] = 0xff;                                   // OS = unknown
+    header[10] = 6;                                     // XLEN
+    header[12] = 'B';                                   // SI1
+    header[13] = 'C';                                   // SI2
+    header[14] = 2;                                     // SLEN
+    header[16] = (block_size - 1) & 0xff;               // BSIZE (total block size - 1)
+    header[17] = ((block_size - 1) >> 8) & 0xff;
+
+    uint32_t const crc = crc32_checksum(data.data(), data.size());
+    uint32_t const isize = data.size();
+
+    unsigned char * const footer = header + BGZF_BLOCK_HEADER_LENGTH + compressed_size;
+    std::memcpy(footer, &crc, 4);                       // CRC32 of the uncompressed data
+    std::memcpy(footer + 4, &isize, 4);                 // ISIZE
+
+    block.resize(block_size);
+    return block;
+}
+
+// Decompresses one BGZF block; expects the compressed payload followed by the 8 byte footer.
+inline std::vector<char> bgzf_decompress_block(std::vector<char> const & compressed)
+{
+    if (compressed.size() < BGZF_BLOCK_FOOTER_LENGTH)
+        throw std::runtime_error{"BGZF block is truncated."};
+
+    uint32_t crc{}, isize{};
+    std::memcpy(&crc, compressed.data() + compressed.size() - 8, 4);
+    std::memcpy(&isize, compressed.data() + compressed.size() - 4, 4);
+
+    std::vector<char> data(isize);
+
+    if (isize == 0) // the empty block, e.g. the end-of-file marker
+        return data;
+
+    z_stream zip_stream{};
+    if (inflateInit2(&zip_stream, -15 /*raw deflate*/) != Z_OK)
+        throw std::runtime_error{"BGZF inflateInit2() failed."};
+
+    zip_stream.next_in = (Bytef *)compressed.data();
+    zip_stream.avail_in = static_cast<uInt>(compressed.size() - BGZF_BLOCK_FOOTER_LENGTH);
+    zip_stream.next_out = (Bytef *)data.data();
+    zip_stream.avail_out = static_cast<uInt>(data.size());
+
+    int const status = inflate(&zip_stream, Z_FINISH);
+    inflateEnd(&zip_stream);
+
+    if (status != Z_STREAM_END || zip_stream.avail_out != 0)
+        throw std::runtime_error{"BGZF block decompression failed."};
+
+    if (crc32_checksum(data.data(), data.size()) != crc)
+        throw std::runtime_error{"CRC mismatch in a BGZF block."};
+
+    return data;
+}
+
+} // namespace seqan3::contrib
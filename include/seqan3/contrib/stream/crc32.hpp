@@ -0,0 +1,176 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+// Hardware-accelerated gzip CRC32 for the contrib compression streams.
+//
+// zlib's table-driven crc32() processes one byte per step; on blocks of a few ten kilobytes (the unit
+// the BGZF codec checksums) it is a measurable share of the compression time. When the compiler is
+// allowed to emit PCLMULQDQ (-mpclmul), bulk input is instead folded 64 bytes at a time with carry-less
+// multiplications, following the scheme of Gopal et al., "Fast CRC Computation for Generic Polynomials
+// Using PCLMULQDQ Instruction" (the same algorithm zlib-ng and the chromium zlib fork use). Note that
+// the crc32 instruction of SSE4.2 computes CRC-32C (Castagnoli) and cannot produce the gzip checksum,
+// which is why the carry-less multiply path is used.
+//
+// The remainder of the input (and everything on other architectures) goes through zlib's crc32().
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#ifndef SEQAN3_HAS_ZLIB
+#error "This file cannot be used when building without ZLIB-support."
+#endif
+
+#include <zlib.h>
+
+#if defined(__PCLMUL__) && defined(__SSE4_1__)
+#include <immintrin.h>
+#endif
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::contrib
+{
+
+#if defined(__PCLMUL__) && defined(__SSE4_1__)
+
+// Folds `length` bytes (a multiple of 16, at least 64) into the raw (uninverted) CRC32 register.
+inline uint32_t crc32_pclmul_fold(unsigned char const * data, size_t length, uint32_t crc)
+{
+    // Folding constants for the gzip polynomial 0x04C11DB7 (reflected 0xEDB88320).
+    __m128i const k1k2 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4); // fold by 512 bits
+    __m128i const k3k4 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0); // fold by 128 bits
+    __m128i const k5k0 = _mm_set_epi64x(0x0000000000, 0x0163cd6124); // fold 128 -> 64 bits
+    __m128i const poly = _mm_set_epi64x(0x01f7011641, 0x01db710641); // Barrett reduction constants
+
+    __m128i x0, x1, x2, x3, x4, x5, x6, x7, x8, y5, y6, y7, y8;
+
+    x1 = _mm_loadu_si128((__m128i const *)(data + 0x00));
+    x2 = _mm_loadu_si128((__m128i const *)(data + 0x10));
+    x3 = _mm_loadu_si128((__m128i const *)(data + 0x20));
+    x4 = _mm_loadu_si128((__m128i const *)(data + 0x30));
+
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(crc));
+
+    x0 = k1k2;
+
+    data += 64;
+    length -= 64;
+
+    // parallel fold of four 128 bit lanes over the bulk of the input
+    while (length >= 64)
+    {
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+        x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+        x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+
+        y5 = _mm_loadu_si128((__m128i const *)(data + 0x00));
+        y6 = _mm_loadu_si128((__m128i const *)(data + 0x10));
+        y7 = _mm_loadu_si128((__m128i const *)(data + 0x20));
+        y8 = _mm_loadu_si128((__m128i const *)(data + 0x30));
+
+        x1 = _mm_xor_si128(x1, x5);
+        x2 = _mm_xor_si128(x2, x6);
+        x3 = _mm_xor_si128(x3, x7);
+        x4 = _mm_xor_si128(x4, x8);
+
+        x1 = _mm_xor_si128(x1, y5);
+        x2 = _mm_xor_si128(x2, y6);
+        x3 = _mm_xor_si128(x3, y7);
+        x4 = _mm_xor_si128(x4, y8);
+
+        data += 64;
+        length -= 64;
+    }
+
+    // fold the four lanes into one
+    x0 = k3k4;
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(x1, x2);
+    x1 = _mm_xor_si128(x1, x5);
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(x1, x3);
+    x1 = _mm_xor_si128(x1, x5);
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(x1, x4);
+    x1 = _mm_xor_si128(x1, x5);
+
+    // fold the remaining full 128 bit blocks
+    while (length >= 16)
+    {
+        x2 = _mm_loadu_si128((__m128i const *)data);
+
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x1 = _mm_xor_si128(x1, x2);
+        x1 = _mm_xor_si128(x1, x5);
+
+        data += 16;
+        length -= 16;
+    }
+
+    // fold 128 -> 64 bits
+    x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+    x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+    x1 = _mm_srli_si128(x1, 8);
+    x1 = _mm_xor_si128(x1, x2);
+
+    x0 = k5k0;
+
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, x3);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    // Barrett reduction to 32 bits
+    x0 = poly;
+
+    x2 = _mm_and_si128(x1, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+    x2 = _mm_and_si128(x2, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    return _mm_extract_epi32(x1, 1);
+}
+
+#endif // defined(__PCLMUL__) && defined(__SSE4_1__)
+
+// Drop-in replacement for zlib's crc32() over a whole buffer: same polynomial, same pre- and
+// post-conditioning, so values can be continued across calls and compared with crc32() results.
+inline uint32_t crc32_checksum(void const * data, size_t length, uint32_t crc = 0u)
+{
+    unsigned char const * bytes = (unsigned char const *)data;
+
+#if defined(__PCLMUL__) && defined(__SSE4_1__)
+    if (length >= 64)
+    {
+        // the folding kernel consumes whole 16 byte blocks and works on the raw CRC register
+        size_t const folded = length & ~(size_t)15;
+        crc = ~crc32_pclmul_fold(bytes, folded, ~crc);
+        bytes += folded;
+        length -= folded;
+    }
+#endif
+
+    return crc32(crc, (Bytef const *)bytes, (uInt)length);
+}
+
+} // namespace seqan3::contrib
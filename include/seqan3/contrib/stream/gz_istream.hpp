@@ -32,6 +32,7 @@
 #include <zlib.h>
 
 #include <seqan3/core/platform.hpp>
+#include <seqan3/contrib/stream/zlib_state_pool.hpp>
 
 namespace seqan3::contrib
 {
@@ -44,6 +45,15 @@ const size_t GZ_INPUT_DEFAULT_BUFFER_SIZE = 921600;
 // --------------------------------------------------------------------------
 // A stream decorator that takes compressed input and unzips it to a istream.
 // The class wraps up the deflate method of the zlib library 1.1.4 http://www.gzip.org/zlib/
+//
+// Concatenated gzip files (e.g. the output of parallel compressors and BGZF) are decompressed
+// in full: at every member boundary the zlib stream is reset and decompression continues with
+// the following member. This also works on non-seekable sources like pipes.
+//
+// The inflate state is acquired from zlib_inflate_state_pool instead of being initialised from
+// scratch, so that opening many small files in sequence reuses the same zlib allocations.
+// An optional preset dictionary can be passed for zlib-wrapped data (window_size <= 15) that was
+// compressed against one; the gzip wrapper does not support dictionaries.
 
 template <typename Elem,
           typename Tr = std::char_traits<Elem>,
@@ -71,7 +81,9 @@ public:
     basic_gz_istreambuf(istream_reference istream_,
                           size_t window_size_,
                           size_t read_buffer_size_,
-                          size_t input_buffer_size_);
+                          size_t input_buffer_size_,
+                          byte_type const * dictionary_,
+                          size_t dictionary_size_);
 
     ~basic_gz_istreambuf();
 
@@ -80,7 +92,7 @@ public:
     // returns the compressed input istream
     istream_reference get_istream()  { return m_istream; }
     // returns the zlib stream structure
-    z_stream & get_zip_stream()      { return m_zip_stream; }
+    z_stream & get_zip_stream()      { return *m_zip_stream; }
 
 private:
     void put_back_from_zip_stream();
@@ -88,10 +100,12 @@ private:
     size_t fill_input_buffer();
 
     istream_reference m_istream;
-    z_stream m_zip_stream;
+    z_stream * m_zip_stream; // owned by zlib_inflate_state_pool
     int m_err;
     byte_vector_type m_input_buffer;
     char_vector_type m_buffer;
+    byte_type const * m_dictionary;
+    size_t m_dictionary_size;
 };
 
 // --------------------------------------------------------------------------
@@ -107,22 +121,18 @@ basic_gz_istreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::basic_gz_istreambuf(
     istream_reference istream_,
     size_t window_size_,
     size_t read_buffer_size_,
-    size_t input_buffer_size_
+    size_t input_buffer_size_,
+    byte_type const * dictionary_,
+    size_t dictionary_size_
     ) :
     m_istream(istream_),
     m_input_buffer(input_buffer_size_),
-    m_buffer(read_buffer_size_)
+    m_buffer(read_buffer_size_),
+    m_dictionary(dictionary_),
+    m_dictionary_size(dictionary_size_)
 {
-    // setting zalloc, zfree and opaque
-    m_zip_stream.zalloc = (alloc_func)0;
-    m_zip_stream.zfree = (free_func)0;
-
-    m_zip_stream.next_in = NULL;
-    m_zip_stream.avail_in = 0;
-    m_zip_stream.avail_out = 0;
-    m_zip_stream.next_out = NULL;
-
-    m_err = inflateInit2(&m_zip_stream, static_cast<int>(window_size_));
+    // a recycled state skips the expensive window allocations of inflateInit2
+    m_zip_stream = zlib_inflate_state_pool::get().acquire(static_cast<int>(window_size_), m_err);
 
     this->setg(&(m_buffer[0]) + 4,  // beginning of putback area
                &(m_buffer[0]) + 4,  // read position
@@ -136,7 +146,7 @@ template <typename Elem,
           typename ByteAT>
 basic_gz_istreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::~basic_gz_istreambuf()
 {
-    inflateEnd(&m_zip_stream);
+    zlib_inflate_state_pool::get().release(m_zip_stream);
 }
 
 template <typename Elem,
@@ -180,29 +190,32 @@ std::streamsize basic_gz_istreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::unzip_from_
     char_type * buffer_,
     std::streamsize buffer_size_)
 {
-    m_zip_stream.next_out = (byte_buffer_type)buffer_;
-    m_zip_stream.avail_out = static_cast<uInt>(buffer_size_ * sizeof(char_type));
-    size_t count = m_zip_stream.avail_in;
+    m_zip_stream->next_out = (byte_buffer_type)buffer_;
+    m_zip_stream->avail_out = static_cast<uInt>(buffer_size_ * sizeof(char_type));
+    size_t count = m_zip_stream->avail_in;
 
     do
     {
-        if (m_zip_stream.avail_in == 0)
+        if (m_zip_stream->avail_in == 0)
             count = fill_input_buffer();
 
-        if (m_zip_stream.avail_in)
-            m_err = inflate(&m_zip_stream, Z_SYNC_FLUSH);
+        if (m_zip_stream->avail_in)
+            m_err = inflate(m_zip_stream, Z_SYNC_FLUSH);
+
+        if (m_err == Z_NEED_DICT && m_dictionary != NULL) // zlib-wrapped data with a preset dictionary
+            m_err = inflateSetDictionary(m_zip_stream, m_dictionary, static_cast<uInt>(m_dictionary_size));
 
         if (m_err == Z_STREAM_END)
-            inflateReset(&m_zip_stream);
-        else if (m_err < 0)
+            inflateReset(m_zip_stream); // member boundary: continue with the next member of a concatenated file
+        else if (m_err < 0 || m_err == Z_NEED_DICT)
             break;
     }
-    while (m_zip_stream.avail_out > 0 && count > 0);
+    while (m_zip_stream->avail_out > 0 && count > 0);
 
-    std::streamsize n_read = buffer_size_ - m_zip_stream.avail_out / sizeof(char_type);
+    std::streamsize n_read = buffer_size_ - m_zip_stream->avail_out / sizeof(char_type);
 
     // check if it is the end
-    if (m_zip_stream.avail_out > 0 && m_err == Z_STREAM_END)
+    if (m_zip_stream->avail_out > 0 && m_err == Z_STREAM_END)
         put_back_from_zip_stream();
 
     return n_read;
@@ -215,10 +228,10 @@ template <typename Elem,
           typename ByteAT>
 size_t basic_gz_istreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::fill_input_buffer()
 {
-    m_zip_stream.next_in = &(m_input_buffer[0]);
+    m_zip_stream->next_in = &(m_input_buffer[0]);
     m_istream.read((char_type *)(&(m_input_buffer[0])),
                    static_cast<std::streamsize>(m_input_buffer.size() / sizeof(char_type)));
-    return m_zip_stream.avail_in = m_istream.gcount() * sizeof(char_type);
+    return m_zip_stream->avail_in = m_istream.gcount() * sizeof(char_type);
 }
 
 template <typename Elem,
@@ -228,13 +241,13 @@ template <typename Elem,
           typename ByteAT>
 void basic_gz_istreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::put_back_from_zip_stream()
 {
-    if (m_zip_stream.avail_in == 0)
+    if (m_zip_stream->avail_in == 0)
         return;
 
     m_istream.clear(std::ios::goodbit);
-    m_istream.seekg(-static_cast<int>(m_zip_stream.avail_in), std::ios_base::cur);
+    m_istream.seekg(-static_cast<int>(m_zip_stream->avail_in), std::ios_base::cur);
 
-    m_zip_stream.avail_in = 0;
+    m_zip_stream->avail_in = 0;
 }
 
 // --------------------------------------------------------------------------
@@ -259,8 +272,10 @@ public:
     basic_gz_istreambase(istream_reference ostream_,
                           size_t window_size_,
                           size_t read_buffer_size_,
-                          size_t input_buffer_size_) :
-        m_buf(ostream_, window_size_, read_buffer_size_, input_buffer_size_)
+                          size_t input_buffer_size_,
+                          ByteT const * dictionary_,
+                          size_t dictionary_size_) :
+        m_buf(ostream_, window_size_, read_buffer_size_, input_buffer_size_, dictionary_, dictionary_size_)
     {
         this->init(&m_buf);
     }
@@ -312,12 +327,17 @@ public:
     // window_size_
     // read_buffer_size_
     // input_buffer_size_
+    // dictionary_ / dictionary_size_ optional preset dictionary the data was compressed against
+    //                                (zlib wrapper only, i.e. window_size_ <= 15)
 
     basic_gz_istream(istream_reference istream_,
                       size_t window_size_ = 31, // 15 (size) + 16 (gzip header)
                       size_t read_buffer_size_ = GZ_INPUT_DEFAULT_BUFFER_SIZE,
-                      size_t input_buffer_size_ = GZ_INPUT_DEFAULT_BUFFER_SIZE) :
-        zip_istreambase_type(istream_, window_size_, read_buffer_size_, input_buffer_size_),
+                      size_t input_buffer_size_ = GZ_INPUT_DEFAULT_BUFFER_SIZE,
+                      byte_type const * dictionary_ = NULL,
+                      size_t dictionary_size_ = 0) :
+        zip_istreambase_type(istream_, window_size_, read_buffer_size_, input_buffer_size_,
+                             dictionary_, dictionary_size_),
         istream_type(this->rdbuf())
     {}
 
@@ -32,6 +32,7 @@
 #include <zlib.h>
 
 #include <seqan3/core/platform.hpp>
+#include <seqan3/contrib/stream/zlib_state_pool.hpp>
 
 namespace seqan3::contrib
 {
@@ -56,6 +57,11 @@ enum EStrategy
 // --------------------------------------------------------------------------
 // A stream decorator that takes raw input and zips it to a ostream.
 // The class wraps up the inflate method of the zlib library 1.1.4 http://www.gzip.org/zlib/
+//
+// The deflate state is acquired from zlib_deflate_state_pool instead of being initialised from
+// scratch, so that writing many small files in sequence reuses the same zlib allocations.
+// An optional preset dictionary can be passed for zlib-wrapped output (window_size <= 15);
+// the gzip wrapper does not support dictionaries.
 
 template <typename Elem,
           typename Tr = std::char_traits<Elem>,
@@ -85,7 +91,9 @@ public:
                         EStrategy strategy_,
                         size_t window_size_,
                         size_t memory_level_,
-                        size_t buffer_size_);
+                        size_t buffer_size_,
+                        byte_type const * dictionary_,
+                        size_t dictionary_size_);
 
     ~basic_gz_ostreambuf();
 
@@ -109,10 +117,14 @@ private:
     std::streamsize flush(int flush_mode);
 
     ostream_reference m_ostream;
-    z_stream m_zip_stream;
+    z_stream * m_zip_stream; // owned by zlib_deflate_state_pool
     int m_err;
     byte_vector_type m_output_buffer;
     char_vector_type m_buffer;
+    int m_level;        // the deflate parameters the state was acquired with,
+    int m_window_size;  // needed to return it to the right pool slot
+    int m_memory_level;
+    int m_strategy;
 };
 
 // --------------------------------------------------------------------------
@@ -130,28 +142,23 @@ basic_gz_ostreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::basic_gz_ostreambuf(
     EStrategy strategy_,
     size_t window_size_,
     size_t memory_level_,
-    size_t buffer_size_
+    size_t buffer_size_,
+    byte_type const * dictionary_,
+    size_t dictionary_size_
     ) :
     m_ostream(ostream_),
     m_output_buffer(buffer_size_, 0),
-    m_buffer(buffer_size_, 0)
+    m_buffer(buffer_size_, 0),
+    m_level(std::min(9, static_cast<int>(level_))),
+    m_window_size(static_cast<int>(window_size_)),
+    m_memory_level(std::min(9, static_cast<int>(memory_level_))),
+    m_strategy(static_cast<int>(strategy_))
 {
-    m_zip_stream.zalloc = (alloc_func)0;
-    m_zip_stream.zfree = (free_func)0;
-
-    m_zip_stream.next_in = NULL;
-    m_zip_stream.avail_in = 0;
-    m_zip_stream.avail_out = 0;
-    m_zip_stream.next_out = NULL;
-
-    m_err = deflateInit2(
-        &m_zip_stream,
-        std::min(9, static_cast<int>(level_)),
-        Z_DEFLATED,
-        static_cast<int>(window_size_),
-        std::min(9, static_cast<int>(memory_level_)),
-        static_cast<int>(strategy_)
-        );
+    // a recycled state skips the expensive window allocations of deflateInit2
+    m_zip_stream = zlib_deflate_state_pool::get().acquire(m_level, m_window_size, m_memory_level, m_strategy, m_err);
+
+    if (m_err == Z_OK && dictionary_ != NULL) // must be re-applied per file, a reset clears it
+        m_err = deflateSetDictionary(m_zip_stream, dictionary_, static_cast<uInt>(dictionary_size_));
 
     this->setp(&(m_buffer[0]), &(m_buffer[m_buffer.size() - 1]));
 }
@@ -165,7 +172,7 @@ basic_gz_ostreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::~basic_gz_ostreambuf()
 {
     flush_finalize();
     m_ostream.flush();
-    m_err = deflateEnd(&m_zip_stream);
+    zlib_deflate_state_pool::get().release(m_zip_stream, m_level, m_window_size, m_memory_level, m_strategy);
 }
 
 template <typename Elem,
@@ -223,19 +230,19 @@ bool basic_gz_ostreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::zip_to_stream(
 {
     std::streamsize written_byte_size = 0, total_written_byte_size = 0;
 
-    m_zip_stream.next_in = (byte_buffer_type)buffer_;
-    m_zip_stream.avail_in = static_cast<uInt>(buffer_size_ * sizeof(char_type));
-    m_zip_stream.avail_out = static_cast<uInt>(m_output_buffer.size());
-    m_zip_stream.next_out = &(m_output_buffer[0]);
+    m_zip_stream->next_in = (byte_buffer_type)buffer_;
+    m_zip_stream->avail_in = static_cast<uInt>(buffer_size_ * sizeof(char_type));
+    m_zip_stream->avail_out = static_cast<uInt>(m_output_buffer.size());
+    m_zip_stream->next_out = &(m_output_buffer[0]);
     size_t remainder = 0;
 
     do
     {
-        m_err = deflate(&m_zip_stream, 0);
+        m_err = deflate(m_zip_stream, 0);
 
         if (m_err == Z_OK  || m_err == Z_STREAM_END)
         {
-            written_byte_size = static_cast<std::streamsize>(m_output_buffer.size()) - m_zip_stream.avail_out;
+            written_byte_size = static_cast<std::streamsize>(m_output_buffer.size()) - m_zip_stream->avail_out;
             total_written_byte_size += written_byte_size;
 
             // ouput buffer is full, dumping to ostream
@@ -251,11 +258,11 @@ bool basic_gz_ostreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::zip_to_stream(
                              remainder);
             }
 
-            m_zip_stream.avail_out = static_cast<uInt>(m_output_buffer.size() - remainder);
-            m_zip_stream.next_out = &m_output_buffer[remainder];
+            m_zip_stream->avail_out = static_cast<uInt>(m_output_buffer.size() - remainder);
+            m_zip_stream->next_out = &m_output_buffer[remainder];
         }
     }
-    while (m_zip_stream.avail_in != 0 && m_err == Z_OK);
+    while (m_zip_stream->avail_in != 0 && m_err == Z_OK);
 
     return m_err == Z_OK;
 }
@@ -271,18 +278,18 @@ std::streamsize basic_gz_ostreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::flush(int f
 
     std::streamsize written_byte_size = 0, total_written_byte_size = 0;
 
-    m_zip_stream.next_in = (byte_buffer_type) this->pbase();
-    m_zip_stream.avail_in = static_cast<uInt>(buffer_size * sizeof(char_type));
-    m_zip_stream.avail_out = static_cast<uInt>(m_output_buffer.size());
-    m_zip_stream.next_out = &(m_output_buffer[0]);
+    m_zip_stream->next_in = (byte_buffer_type) this->pbase();
+    m_zip_stream->avail_in = static_cast<uInt>(buffer_size * sizeof(char_type));
+    m_zip_stream->avail_out = static_cast<uInt>(m_output_buffer.size());
+    m_zip_stream->next_out = &(m_output_buffer[0]);
     size_t remainder = 0;
 
     do
     {
-        m_err = deflate(&m_zip_stream, flush_mode);
+        m_err = deflate(m_zip_stream, flush_mode);
         if (m_err == Z_OK || m_err == Z_STREAM_END)
         {
-            written_byte_size = static_cast<std::streamsize>(m_output_buffer.size()) - m_zip_stream.avail_out;
+            written_byte_size = static_cast<std::streamsize>(m_output_buffer.size()) - m_zip_stream->avail_out;
             total_written_byte_size += written_byte_size;
 
             // ouput buffer is full, dumping to ostream
@@ -298,8 +305,8 @@ std::streamsize basic_gz_ostreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::flush(int f
                              remainder);
             }
 
-            m_zip_stream.avail_out = static_cast<uInt>(m_output_buffer.size() - remainder);
-            m_zip_stream.next_out = &m_output_buffer[remainder];
+            m_zip_stream->avail_out = static_cast<uInt>(m_output_buffer.size() - remainder);
+            m_zip_stream->next_out = &m_output_buffer[remainder];
         }
     }
     while (m_err == Z_OK);
@@ -355,8 +362,10 @@ public:
                           EStrategy strategy_,
                           size_t window_size_,
                           size_t memory_level_,
-                          size_t buffer_size_) :
-        m_buf(ostream_, level_, strategy_, window_size_, memory_level_, buffer_size_)
+                          size_t buffer_size_,
+                          ByteT const * dictionary_,
+                          size_t dictionary_size_) :
+        m_buf(ostream_, level_, strategy_, window_size_, memory_level_, buffer_size_, dictionary_, dictionary_size_)
     {
         this->init(&m_buf);
     }
@@ -413,14 +422,19 @@ public:
     // window_size_ see zlib doc
     // memory_level_ see zlib doc
     // buffer_size_ the buffer size used to zip data
+    // dictionary_ / dictionary_size_ optional preset dictionary to compress against
+    //                                (zlib wrapper only, i.e. window_size_ <= 15)
 
     basic_gz_ostream(ostream_reference ostream_,
                       size_t level_ = Z_DEFAULT_COMPRESSION,
                       EStrategy strategy_ = DefaultStrategy,
                       size_t window_size_ = 31, // 15 (size) + 16 (gzip header)
                       size_t memory_level_ = 8,
-                      size_t buffer_size_ = GZ_OUTPUT_DEFAULT_BUFFER_SIZE) :
-        zip_ostreambase_type(ostream_, level_, strategy_, window_size_, memory_level_, buffer_size_),
+                      size_t buffer_size_ = GZ_OUTPUT_DEFAULT_BUFFER_SIZE,
+                      ByteT const * dictionary_ = NULL,
+                      size_t dictionary_size_ = 0) :
+        zip_ostreambase_type(ostream_, level_, strategy_, window_size_, memory_level_, buffer_size_,
+                             dictionary_, dictionary_size_),
         ostream_type(this->rdbuf())
     {}
 
@@ -0,0 +1,222 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+// Pools of initialised zlib states, recycled across gz streams.
+//
+// inflateInit2/deflateInit2 allocate the internal zlib windows (tens to hundreds of kilobytes) on every
+// call, which dominates the cost of opening small compressed files. The pools below keep finished states
+// and hand them out again after an inflateReset2 respectively deflateReset, which merely rewinds the
+// existing allocations. The z_stream structs are heap-allocated and passed around by pointer, because
+// zlib keeps a back-pointer to the z_stream inside its internal state and rejects a struct that has
+// been moved to a different address.
+
+#pragma once
+
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+#ifndef SEQAN3_HAS_ZLIB
+#error "This file cannot be used when building without ZLIB-support."
+#endif
+
+#include <zlib.h>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::contrib
+{
+
+// Maximum number of idle states kept per pool; surplus states are freed on release.
+const size_t ZLIB_STATE_POOL_MAX_IDLE = 64;
+
+// --------------------------------------------------------------------------
+// Class zlib_inflate_state_pool
+// --------------------------------------------------------------------------
+// Recycles inflate states. Any pooled state fits any request, because
+// inflateReset2 can change the window size and wrapper of an existing state.
+
+class zlib_inflate_state_pool
+{
+public:
+    static zlib_inflate_state_pool & get()
+    {
+        static zlib_inflate_state_pool pool;
+        return pool;
+    }
+
+    // Hand out an initialised inflate state for the given window bits (recycled
+    // if possible); the zlib error code is stored in err.
+    z_stream * acquire(int window_bits, int & err)
+    {
+        z_stream * zip_stream = NULL;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!idle_states.empty())
+            {
+                zip_stream = idle_states.back();
+                idle_states.pop_back();
+            }
+        }
+
+        if (zip_stream != NULL)
+        {
+            zip_stream->next_in = NULL;  // the buffer pointers of the previous use are stale
+            zip_stream->avail_in = 0;
+            zip_stream->next_out = NULL;
+            zip_stream->avail_out = 0;
+            err = inflateReset2(zip_stream, window_bits);
+        }
+        else
+        {
+            zip_stream = new z_stream;
+            std::memset(zip_stream, 0, sizeof(z_stream));
+            err = inflateInit2(zip_stream, window_bits);
+        }
+
+        return zip_stream;
+    }
+
+    // Take back a state previously handed out by acquire().
+    void release(z_stream * zip_stream)
+    {
+        if (zip_stream == NULL)
+            return;
+
+        if (zip_stream->state != NULL) // otherwise initialisation failed; nothing to recycle
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (idle_states.size() < ZLIB_STATE_POOL_MAX_IDLE)
+            {
+                idle_states.push_back(zip_stream);
+                return;
+            }
+        }
+
+        inflateEnd(zip_stream);
+        delete zip_stream;
+    }
+
+    ~zlib_inflate_state_pool()
+    {
+        for (z_stream * zip_stream : idle_states)
+        {
+            inflateEnd(zip_stream);
+            delete zip_stream;
+        }
+    }
+
+private:
+    zlib_inflate_state_pool() = default;
+
+    std::mutex mutex;
+    std::vector<z_stream *> idle_states;
+};
+
+// --------------------------------------------------------------------------
+// Class zlib_deflate_state_pool
+// --------------------------------------------------------------------------
+// Recycles deflate states. deflateReset keeps the parameters of the original
+// deflateInit2, so states are only reused for an identical parameter set;
+// requests with other parameters get a freshly initialised state.
+
+class zlib_deflate_state_pool
+{
+public:
+    static zlib_deflate_state_pool & get()
+    {
+        static zlib_deflate_state_pool pool;
+        return pool;
+    }
+
+    // Hand out an initialised deflate state for the given parameters (recycled
+    // if possible); the zlib error code is stored in err.
+    z_stream * acquire(int level, int window_bits, int memory_level, int strategy, int & err)
+    {
+        z_stream * zip_stream = NULL;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (size_t i = 0; i < idle_states.size(); ++i)
+            {
+                if (idle_states[i].level == level && idle_states[i].window_bits == window_bits &&
+                    idle_states[i].memory_level == memory_level && idle_states[i].strategy == strategy)
+                {
+                    zip_stream = idle_states[i].zip_stream;
+                    idle_states[i] = idle_states.back();
+                    idle_states.pop_back();
+                    break;
+                }
+            }
+        }
+
+        if (zip_stream != NULL)
+        {
+            zip_stream->next_in = NULL;  // the buffer pointers of the previous use are stale
+            zip_stream->avail_in = 0;
+            zip_stream->next_out = NULL;
+            zip_stream->avail_out = 0;
+            err = deflateReset(zip_stream);
+        }
+        else
+        {
+            zip_stream = new z_stream;
+            std::memset(zip_stream, 0, sizeof(z_stream));
+            err = deflateInit2(zip_stream, level, Z_DEFLATED, window_bits, memory_level, strategy);
+        }
+
+        return zip_stream;
+    }
+
+    // Take back a state previously handed out by acquire(), together with the
+    // parameters it was acquired with.
+    void release(z_stream * zip_stream, int level, int window_bits, int memory_level, int strategy)
+    {
+        if (zip_stream == NULL)
+            return;
+
+        if (zip_stream->state != NULL) // otherwise initialisation failed; nothing to recycle
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (idle_states.size() < ZLIB_STATE_POOL_MAX_IDLE)
+            {
+                idle_states.push_back({zip_stream, level, window_bits, memory_level, strategy});
+                return;
+            }
+        }
+
+        deflateEnd(zip_stream);
+        delete zip_stream;
+    }
+
+    ~zlib_deflate_state_pool()
+    {
+        for (idle_state & entry : idle_states)
+        {
+            deflateEnd(entry.zip_stream);
+            delete entry.zip_stream;
+        }
+    }
+
+private:
+    zlib_deflate_state_pool() = default;
+
+    struct idle_state
+    {
+        z_stream * zip_stream;
+        int level;
+        int window_bits;
+        int memory_level;
+        int strategy;
+    };
+
+    std::mutex mutex;
+    std::vector<idle_state> idle_states;
+};
+
+} // namespace seqan3::contrib
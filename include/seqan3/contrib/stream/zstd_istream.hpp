@@ -0,0 +1,220 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+// Zstandard decompressing istream, modelled after the gz/bz2 stream decorators.
+
+#pragma once
+
+#ifndef SEQAN3_HAS_ZSTD
+#error "This file cannot be used when building without Zstandard-support."
+#endif
+
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include <zstd.h>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::contrib
+{
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_istreambuf
+// --------------------------------------------------------------------------
+// A stream decorator that takes Zstandard compressed input and decompresses
+// it using the streaming API of libzstd.
+
+template <typename Elem,
+          typename Tr = std::char_traits<Elem>,
+          typename ElemA = std::allocator<Elem>,
+          typename ByteT = char,
+          typename ByteAT = std::allocator<ByteT>
+          >
+class basic_zstd_istreambuf :
+    public std::basic_streambuf<Elem, Tr>
+{
+public:
+    typedef std::basic_istream<Elem, Tr> &              istream_reference;
+    typedef ElemA                                       char_allocator_type;
+    typedef ByteT                                       byte_type;
+    typedef ByteAT                                      byte_allocator_type;
+    typedef Tr                                          traits_type;
+    typedef typename Tr::char_type                      char_type;
+    typedef typename Tr::int_type                       int_type;
+    typedef std::vector<byte_type, byte_allocator_type> byte_vector_type;
+    typedef std::vector<char_type, char_allocator_type> char_vector_type;
+
+    static_assert(sizeof(char_type) == 1, "Zstandard streams are byte oriented.");
+
+    // Construct a decompressing stream buffer; the buffer sizes recommended by libzstd are used by default.
+    basic_zstd_istreambuf(istream_reference istream_,
+                          size_t read_buffer_size_ = ZSTD_DStreamOutSize(),
+                          size_t input_buffer_size_ = ZSTD_DStreamInSize()) :
+        m_istream(istream_),
+        m_input_buffer(input_buffer_size_),
+        m_buffer(read_buffer_size_ + 4)
+    {
+        m_zstd_stream = ZSTD_createDStream();
+        ZSTD_initDStream(m_zstd_stream);
+
+        m_input.src = m_input_buffer.data();
+        m_input.size = 0;
+        m_input.pos = 0;
+
+        this->setg(&(m_buffer[0]) + 4,  // beginning of putback area
+                   &(m_buffer[0]) + 4,  // read position
+                   &(m_buffer[0]) + 4); // end position
+    }
+
+    ~basic_zstd_istreambuf()
+    {
+        ZSTD_freeDStream(m_zstd_stream);
+    }
+
+    int_type underflow()
+    {
+        if (this->gptr() && (this->gptr() < this->egptr()))
+            return *reinterpret_cast<unsigned char *>(this->gptr());
+
+        int n_putback = static_cast<int>(this->gptr() - this->eback());
+        if (n_putback > 4)
+            n_putback = 4;
+
+        std::memmove(&(m_buffer[0]) + (4 - n_putback), this->gptr() - n_putback, n_putback * sizeof(char_type));
+
+        std::streamsize num = decompress_from_stream(&(m_buffer[0]) + 4,
+                                                     static_cast<std::streamsize>(m_buffer.size() - 4));
+
+        if (num <= 0)     // ERROR or EOF
+            return traits_type::eof();
+
+        // reset buffer pointers
+        this->setg(&(m_buffer[0]) + (4 - n_putback),         // beginning of putback area
+                   &(m_buffer[0]) + 4,                       // read position
+                   &(m_buffer[0]) + 4 + num);                // end of buffer
+
+        // return next character
+        return *reinterpret_cast<unsigned char *>(this->gptr());
+    }
+
+    // returns the compressed input istream
+    istream_reference get_istream() { return m_istream; }
+
+private:
+    std::streamsize decompress_from_stream(char_type * buffer_, std::streamsize buffer_size_)
+    {
+        ZSTD_outBuffer output{buffer_, static_cast<size_t>(buffer_size_), 0};
+
+        while (output.pos == 0)
+        {
+            if (m_input.pos == m_input.size)
+            {
+                if (!fill_input_buffer())
+                    break; // end of the compressed stream
+            }
+
+            size_t const status = ZSTD_decompressStream(m_zstd_stream, &output, &m_input);
+
+            if (ZSTD_isError(status))
+                return -1;
+        }
+
+        return output.pos;
+    }
+
+    bool fill_input_buffer()
+    {
+        m_istream.read(m_input_buffer.data(), m_input_buffer.size());
+        m_input.size = m_istream.gcount();
+        m_input.pos = 0;
+        return m_input.size != 0;
+    }
+
+    istream_reference m_istream;
+    ZSTD_DStream * m_zstd_stream;
+    ZSTD_inBuffer m_input;
+    byte_vector_type m_input_buffer;
+    char_vector_type m_buffer;
+};
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_istreambase
+// --------------------------------------------------------------------------
+// Base class for Zstandard istreams.
+// Contains a basic_zstd_istreambuf.
+
+template <typename Elem,
+          typename Tr = std::char_traits<Elem>,
+          typename ElemA = std::allocator<Elem>,
+          typename ByteT = char,
+          typename ByteAT = std::allocator<ByteT>
+          >
+class basic_zstd_istreambase :
+    virtual public std::basic_ios<Elem, Tr>
+{
+public:
+    typedef std::basic_istream<Elem, Tr> &                        istream_reference;
+    typedef basic_zstd_istreambuf<Elem, Tr, ElemA, ByteT, ByteAT> zstd_streambuf_type;
+
+    basic_zstd_istreambase(istream_reference istream_) :
+        m_buf(istream_)
+    {
+        this->init(&m_buf);
+    }
+
+    // returns the underlying Zstandard istream object
+    zstd_streambuf_type * rdbuf() { return &m_buf; }
+
+private:
+    zstd_streambuf_type m_buf;
+};
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_istream
+// --------------------------------------------------------------------------
+// A Zstandard decompressing istream
+//
+// This class is an istream decorator like basic_gz_istream; at construction
+// it takes any istream that provides the compressed data.
+
+template <typename Elem,
+          typename Tr = std::char_traits<Elem>,
+          typename ElemA = std::allocator<Elem>,
+          typename ByteT = char,
+          typename ByteAT = std::allocator<ByteT>
+          >
+class basic_zstd_istream :
+    public basic_zstd_istreambase<Elem, Tr, ElemA, ByteT, ByteAT>,
+    public std::basic_istream<Elem, Tr>
+{
+public:
+    typedef basic_zstd_istreambase<Elem, Tr, ElemA, ByteT, ByteAT> zstd_istreambase_type;
+    typedef std::basic_istream<Elem, Tr>                           istream_type;
+    typedef istream_type &                                         istream_reference;
+
+    basic_zstd_istream(istream_reference istream_) :
+        zstd_istreambase_type(istream_),
+        istream_type(this->rdbuf())
+    {}
+
+#ifdef _WIN32
+private:
+    void _Add_vtordisp1() {}  // Required to avoid VC++ warning C4250
+    void _Add_vtordisp2() {}  // Required to avoid VC++ warning C4250
+#endif
+};
+
+// ===========================================================================
+// Typedefs
+// ===========================================================================
+
+// A typedef for basic_zstd_istream<char>
+typedef basic_zstd_istream<char> zstd_istream;
+
+} // namespace seqan3::contrib
@@ -0,0 +1,260 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+// Zstandard compressing ostream, modelled after the gz/bz2 stream decorators.
+
+#pragma once
+
+#ifndef SEQAN3_HAS_ZSTD
+#error "This file cannot be used when building without Zstandard-support."
+#endif
+
+#include <iostream>
+#include <vector>
+
+#include <zstd.h>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::contrib
+{
+
+// Default Zstandard compression level; a good speed/ratio trade-off, see the zstd documentation.
+const int ZSTD_OUTPUT_DEFAULT_LEVEL = 3;
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_ostreambuf
+// --------------------------------------------------------------------------
+// A stream decorator that takes raw input and compresses it to a ostream
+// using the streaming API of libzstd.
+
+template <typename Elem,
+          typename Tr = std::char_traits<Elem>,
+          typename ElemA = std::allocator<Elem>,
+          typename ByteT = char,
+          typename ByteAT = std::allocator<ByteT>
+          >
+class basic_zstd_ostreambuf :
+    public std::basic_streambuf<Elem, Tr>
+{
+public:
+    typedef std::basic_ostream<Elem, Tr> &              ostream_reference;
+    typedef ElemA                                       char_allocator_type;
+    typedef ByteT                                       byte_type;
+    typedef ByteAT                                      byte_allocator_type;
+    typedef Tr                                          traits_type;
+    typedef typename Tr::char_type                      char_type;
+    typedef typename Tr::int_type                       int_type;
+    typedef std::vector<byte_type, byte_allocator_type> byte_vector_type;
+    typedef std::vector<char_type, char_allocator_type> char_vector_type;
+
+    static_assert(sizeof(char_type) == 1, "Zstandard streams are byte oriented.");
+
+    // Construct a compressing stream buffer; the buffer sizes recommended by libzstd are used by default.
+    basic_zstd_ostreambuf(ostream_reference ostream_,
+                          int level_ = ZSTD_OUTPUT_DEFAULT_LEVEL,
+                          size_t buffer_size_ = ZSTD_CStreamInSize(),
+                          size_t output_buffer_size_ = ZSTD_CStreamOutSize()) :
+        m_ostream(ostream_),
+        m_output_buffer(output_buffer_size_),
+        m_buffer(buffer_size_)
+    {
+        m_zstd_stream = ZSTD_createCStream();
+        ZSTD_initCStream(m_zstd_stream, level_);
+
+        this->setp(&(m_buffer[0]), &(m_buffer[m_buffer.size() - 1]));
+    }
+
+    ~basic_zstd_ostreambuf()
+    {
+        flush_finalize();
+        m_ostream.flush();
+        ZSTD_freeCStream(m_zstd_stream);
+    }
+
+    int sync()
+    {
+        if (this->pptr() && this->pptr() > this->pbase())
+        {
+            if (traits_type::eq_int_type(overflow(traits_type::eof()), traits_type::eof()))
+                return -1;
+        }
+
+        flush_frame(false);
+        m_ostream.flush();
+        return m_ostream.good() ? 0 : -1;
+    }
+
+    int_type overflow(int_type c)
+    {
+        int w = static_cast<int>(this->pptr() - this->pbase());
+
+        if (!traits_type::eq_int_type(c, traits_type::eof()))
+        {
+            *this->pptr() = c;
+            ++w;
+        }
+
+        if (compress_to_stream(this->pbase(), w))
+        {
+            this->setp(this->pbase(), this->epptr());
+            return c;
+        }
+        else
+        {
+            return traits_type::eof();
+        }
+    }
+
+    // flushes the compression buffers and finalizes the Zstandard frame.
+    // This method is called by the destructor; afterwards nothing must be written anymore.
+    void flush_finalize()
+    {
+        if (m_finalized)
+            return;
+        m_finalized = true;
+
+        if (this->pptr() && this->pptr() > this->pbase())
+            overflow(traits_type::eof());
+
+        flush_frame(true);
+    }
+
+private:
+    bool compress_to_stream(char_type * buffer_, std::streamsize buffer_size_)
+    {
+        ZSTD_inBuffer input{buffer_, static_cast<size_t>(buffer_size_), 0};
+
+        while (input.pos < input.size)
+        {
+            ZSTD_outBuffer output{m_output_buffer.data(), m_output_buffer.size(), 0};
+
+            size_t const status = ZSTD_compressStream(m_zstd_stream, &output, &input);
+
+            if (ZSTD_isError(status))
+                return false;
+
+            m_ostream.write(m_output_buffer.data(), output.pos);
+        }
+
+        return m_ostream.good();
+    }
+
+    // flushes buffered compressed data; ends the current frame if end_frame is set
+    void flush_frame(bool const end_frame)
+    {
+        size_t remaining{};
+        do
+        {
+            ZSTD_outBuffer output{m_output_buffer.data(), m_output_buffer.size(), 0};
+
+            remaining = end_frame ? ZSTD_endStream(m_zstd_stream, &output)
+                                  : ZSTD_flushStream(m_zstd_stream, &output);
+
+            if (ZSTD_isError(remaining))
+                break;
+
+            m_ostream.write(m_output_buffer.data(), output.pos);
+        }
+        while (remaining != 0);
+    }
+
+    ostream_reference m_ostream;
+    ZSTD_CStream * m_zstd_stream;
+    byte_vector_type m_output_buffer;
+    char_vector_type m_buffer;
+    bool m_finalized{false};
+};
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_ostreambase
+// --------------------------------------------------------------------------
+// Base class for Zstandard ostreams.
+// Contains a basic_zstd_ostreambuf.
+
+template <typename Elem,
+          typename Tr = std::char_traits<Elem>,
+          typename ElemA = std::allocator<Elem>,
+          typename ByteT = char,
+          typename ByteAT = std::allocator<ByteT>
+          >
+class basic_zstd_ostreambase :
+    virtual public std::basic_ios<Elem, Tr>
+{
+public:
+    typedef std::basic_ostream<Elem, Tr> &                        ostream_reference;
+    typedef basic_zstd_ostreambuf<Elem, Tr, ElemA, ByteT, ByteAT> zstd_streambuf_type;
+
+    basic_zstd_ostreambase(ostream_reference ostream_,
+                           int level_) :
+        m_buf(ostream_, level_)
+    {
+        this->init(&m_buf);
+    }
+
+    // returns the underlying Zstandard ostream object
+    zstd_streambuf_type * rdbuf() { return &m_buf; }
+
+private:
+    zstd_streambuf_type m_buf;
+};
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_ostream
+// --------------------------------------------------------------------------
+// A Zstandard compressing ostream
+//
+// This class is an ostream decorator like basic_gz_ostream; at construction
+// it takes any ostream that shall receive the compressed data.
+
+template <typename Elem,
+          typename Tr = std::char_traits<Elem>,
+          typename ElemA = std::allocator<Elem>,
+          typename ByteT = char,
+          typename ByteAT = std::allocator<ByteT>
+          >
+class basic_zstd_ostream :
+    public basic_zstd_ostreambase<Elem, Tr, ElemA, ByteT, ByteAT>,
+    public std::basic_ostream<Elem, Tr>
+{
+public:
+    typedef basic_zstd_ostreambase<Elem, Tr, ElemA, ByteT, ByteAT> zstd_ostreambase_type;
+    typedef std::basic_ostream<Elem, Tr>                           ostream_type;
+    typedef ostream_type &                                         ostream_reference;
+
+    basic_zstd_ostream(ostream_reference ostream_,
+                       int level_ = ZSTD_OUTPUT_DEFAULT_LEVEL) :
+        zstd_ostreambase_type(ostream_, level_),
+        ostream_type(this->rdbuf())
+    {}
+
+    ~basic_zstd_ostream()
+    {
+        this->flush(); this->rdbuf()->flush_finalize();
+    }
+
+    // flush inner buffer and compression buffer
+    basic_zstd_ostream<Elem, Tr> & zflush()
+    {
+        this->flush(); this->rdbuf()->sync(); return *this;
+    }
+
+#ifdef _WIN32
+private:
+    void _Add_vtordisp1() {}  // Required to avoid VC++ warning C4250
+    void _Add_vtordisp2() {}  // Required to avoid VC++ warning C4250
+#endif
+};
+
+// ===========================================================================
+// Typedefs
+// ===========================================================================
+
+// A typedef for basic_zstd_ostream<char>
+typedef basic_zstd_ostream<char> zstd_ostream;
+
+} // namespace seqan3::contrib
@@ -21,9 +21,12 @@
 #include <seqan3/core/add_enum_bitwise_operators.hpp>
 #include <seqan3/core/concept/all.hpp>
 #include <seqan3/core/detail/all.hpp>
+#include <seqan3/core/memory_stats.hpp>
 #include <seqan3/core/metafunction/all.hpp>
+#include <seqan3/core/parallel/all.hpp>
 #include <seqan3/core/platform.hpp>
 #include <seqan3/core/pod_tuple.hpp>
+#include <seqan3/core/tracing.hpp>
 #include <seqan3/core/tuple_utility.hpp>
 #include <seqan3/core/type_list.hpp>
 
@@ -59,4 +59,19 @@ constexpr size_t next_power_of_two(size_t n)
     return n + 1;
 }
 
+/*!\brief Returns \f$\lfloor\log_2(n)\rfloor\f$ for an \f$n > 0\f$.
+ * \ingroup core
+ *
+ * \param[in] n A number; must be greater than zero.
+ *
+ * \returns The position of the highest set bit of *n*; for powers of two this is the exact base two logarithm.
+ */
+constexpr size_t floor_log2(size_t n)
+{
+    size_t result = 0;
+    while (n >>= 1)
+        ++result;
+    return result;
+}
+
 } // namespace seqan3::detail
@@ -0,0 +1,160 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides the opt-in memory telemetry counters (seqan3::memory_stats).
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string_view>
+
+#include <seqan3/core/platform.hpp>
+
+/*!\def SEQAN3_ENABLE_MEMORY_STATS
+ * \brief Whether the per-subsystem memory counters are compiled in (default: 0).
+ * \ingroup core
+ *
+ * \details
+ *
+ * Define this macro to `1` **before including any SeqAn3 header** to activate the counters incremented at
+ * the library's allocation points (dynamic programming matrices, index construction, record buffers).
+ * When left at its default of `0`, the counting calls compile to nothing.
+ */
+#ifndef SEQAN3_ENABLE_MEMORY_STATS
+#define SEQAN3_ENABLE_MEMORY_STATS 0
+#endif
+
+namespace seqan3::memory_stats
+{
+
+//!\brief Whether the memory counters are compiled in (mirrors \ref SEQAN3_ENABLE_MEMORY_STATS).
+//!\ingroup core
+inline constexpr bool enabled = static_cast<bool>(SEQAN3_ENABLE_MEMORY_STATS);
+
+/*!\brief The subsystems whose memory consumption is counted separately.
+ * \ingroup core
+ */
+enum class subsystem : uint8_t
+{
+    dp_matrix,    //!< Score matrices of the pairwise alignment kernels.
+    trace_matrix, //!< Trace matrices of the pairwise alignment kernels.
+    index,        //!< Constructed index structures (e.g. the FM-index).
+    io_record,    //!< Field buffers filled by the record based input machinery.
+    //!\cond
+    SIZE
+    //!\endcond
+};
+
+//!\brief Returns the display name of a subsystem.
+//!\ingroup core
+constexpr std::string_view name(subsystem const s) noexcept
+{
+    switch (s)
+    {
+        case subsystem::dp_matrix:    return "dp_matrix";
+        case subsystem::trace_matrix: return "trace_matrix";
+        case subsystem::index:        return "index";
+        case subsystem::io_record:    return "io_record";
+        default:                      return "";
+    }
+}
+
+//!\brief The counters of one subsystem as returned by seqan3::memory_stats::snapshot.
+//!\ingroup core
+struct counters
+{
+    //!\brief The total number of bytes requested since program start (or the last reset).
+    uint64_t bytes;
+    //!\brief The number of counted requests.
+    uint64_t count;
+};
+
+} // namespace seqan3::memory_stats
+
+namespace seqan3::detail
+{
+
+//!\brief The process-wide counter array behind seqan3::memory_stats.
+//!\ingroup core
+struct memory_stats_registry
+{
+    //!\brief The number of counted subsystems.
+    static constexpr size_t subsystem_count = static_cast<size_t>(memory_stats::subsystem::SIZE);
+
+    //!\brief The total bytes per subsystem.
+    std::array<std::atomic<uint64_t>, subsystem_count> bytes{};
+    //!\brief The number of requests per subsystem.
+    std::array<std::atomic<uint64_t>, subsystem_count> count{};
+
+    //!\brief Returns the process-wide registry.
+    static memory_stats_registry & instance() noexcept
+    {
+        static memory_stats_registry registry{};
+        return registry;
+    }
+};
+
+/*!\brief Adds one memory request of `bytes` bytes to the counters of the given subsystem.
+ * \ingroup core
+ *
+ * \details
+ *
+ * Compiles to nothing unless \ref SEQAN3_ENABLE_MEMORY_STATS is `1`; when enabled, the increments are
+ * relaxed atomics, so counting from concurrent threads is safe and cheap.
+ */
+inline void record_memory_use([[maybe_unused]] memory_stats::subsystem const s,
+                              [[maybe_unused]] size_t const bytes) noexcept
+{
+    if constexpr (memory_stats::enabled)
+    {
+        memory_stats_registry & registry = memory_stats_registry::instance();
+        registry.bytes[static_cast<size_t>(s)].fetch_add(bytes, std::memory_order_relaxed);
+        registry.count[static_cast<size_t>(s)].fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+} // namespace seqan3::detail
+
+namespace seqan3::memory_stats
+{
+
+//!\brief Returns the current counters of one subsystem.
+//!\ingroup core
+inline counters snapshot(subsystem const s) noexcept
+{
+    detail::memory_stats_registry & registry = detail::memory_stats_registry::instance();
+    return {registry.bytes[static_cast<size_t>(s)].load(std::memory_order_relaxed),
+            registry.count[static_cast<size_t>(s)].load(std::memory_order_relaxed)};
+}
+
+//!\brief Returns the current counters of all subsystems, indexed by seqan3::memory_stats::subsystem.
+//!\ingroup core
+inline std::array<counters, detail::memory_stats_registry::subsystem_count> snapshot() noexcept
+{
+    std::array<counters, detail::memory_stats_registry::subsystem_count> result{};
+    for (size_t i = 0; i < result.size(); ++i)
+        result[i] = snapshot(static_cast<subsystem>(i));
+    return result;
+}
+
+//!\brief Resets all counters to zero (e.g. to measure one pipeline stage in isolation).
+//!\ingroup core
+inline void reset() noexcept
+{
+    detail::memory_stats_registry & registry = detail::memory_stats_registry::instance();
+    for (size_t i = 0; i < detail::memory_stats_registry::subsystem_count; ++i)
+    {
+        registry.bytes[i].store(0, std::memory_order_relaxed);
+        registry.count[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+} // namespace seqan3::memory_stats
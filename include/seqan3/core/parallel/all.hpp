@@ -0,0 +1,19 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Meta-header for the parallel module.
+ */
+
+#pragma once
+
+/*!\defgroup parallel Parallel
+ * \brief Provides the shared execution context the parallel facilities of the library draw from.
+ * \ingroup core
+ */
+
+#include <seqan3/core/parallel/thread_pool.hpp>
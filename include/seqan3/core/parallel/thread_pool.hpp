@@ -0,0 +1,227 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::thread_pool.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#endif
+
+#include <seqan3/contrib/parallel/buffer_queue.hpp>
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3
+{
+
+/*!\brief A fixed-size pool of worker threads that the parallel facilities of the library draw from.
+ * \ingroup parallel
+ *
+ * \details
+ *
+ * Parallel alignment, parallel search and parallel I/O all need worker threads. If every subsystem spawns
+ * its own threads, running them together oversubscribes the machine; this class provides one execution
+ * context they can share. Tasks submitted via submit() are enqueued into a bounded queue and processed by
+ * the worker threads in submission order; when the workers fall behind by more than a few tasks per thread,
+ * the submission blocks until a slot frees up. The pool itself does not track which client submitted a task
+ * — a client that needs to wait for its own tasks keeps its own counter in the submitted closures (see e.g.
+ * seqan3::detail::execution_handler_shared_pool).
+ *
+ * A process-wide default pool is available via shared(); it is created lazily on first access with one
+ * worker per hardware thread and can be sized differently with configure_shared() before it is first used.
+ * Facilities that accept an execution context (e.g. seqan3::align_cfg::execution_context) draw from the
+ * shared pool unless an explicitly constructed pool is injected, so independent subsystems running
+ * concurrently compete for the same workers instead of multiplying them.
+ *
+ * The worker threads can be pinned to a set of cpus by passing the cpu ids to the constructor; worker `i` is
+ * pinned to `cpus[i % cpus.size()]`. The pinning is best-effort: on platforms without thread affinity
+ * support, or if setting the affinity fails, the threads keep the inherited affinity mask.
+ *
+ * The pool is neither copyable nor movable; clients hold references (or pointers) to it. The destructor
+ * drains the queue, i.e. all submitted tasks are executed before the worker threads terminate.
+ *
+ * \attention Tasks must not block on the completion of tasks submitted to the same pool after them, since
+ *            the workers process the queue in order and such a task would deadlock the pool.
+ */
+class thread_pool
+{
+public:
+    //!\brief The type eraser over the submitted tasks.
+    using task_type = std::function<void()>;
+
+    /*!\name Constructors, destructor and assignment
+     * \brief The class is neither copyable nor movable; clients reference the pool.
+     * \{
+     */
+    //!\brief Constructs a pool with `std::thread::hardware_concurrency()` many worker threads.
+    thread_pool() : thread_pool{std::thread::hardware_concurrency()}
+    {}
+
+    /*!\brief Constructs a pool with the given number of worker threads.
+     * \param[in] thread_count The number of worker threads to spawn; `0` is treated as `1`.
+     * \param[in] cpus         The cpus to pin the worker threads to (worker `i` is pinned to
+     *                         `cpus[i % cpus.size()]`); no pinning happens if empty.
+     */
+    explicit thread_pool(size_t const thread_count, std::vector<unsigned> const & cpus = {}) :
+        tasks{std::max<size_t>(1, thread_count) * tasks_per_thread}
+    {
+        for (size_t i = 0; i < std::max<size_t>(1, thread_count); ++i)
+        {
+            threads.emplace_back([this] ()
+            {
+                for (;;)
+                {
+                    task_type task{};
+                    if (tasks.wait_pop(task) == contrib::queue_op_status::closed)
+                        return; // Only happens if the pool is destructed.
+
+                    task();
+                }
+            });
+
+            if (!cpus.empty())
+                pin_to_cpu(threads.back(), cpus[i % cpus.size()]);
+        }
+    }
+
+    thread_pool(thread_pool const &) = delete;             //!< Clients reference the pool.
+    thread_pool(thread_pool &&) = delete;                  //!< Clients reference the pool.
+    thread_pool & operator=(thread_pool const &) = delete; //!< Clients reference the pool.
+    thread_pool & operator=(thread_pool &&) = delete;      //!< Clients reference the pool.
+
+    //!\brief Executes all submitted tasks and joins the worker threads.
+    ~thread_pool()
+    {
+        tasks.close(); // the workers drain the queue and then terminate
+
+        for (std::thread & thread : threads)
+            if (thread.joinable())
+                thread.join();
+    }
+    //!\}
+
+    /*!\name Task submission
+     * \{
+     */
+    /*!\brief Enqueues a task for execution by one of the worker threads.
+     * \param[in] task The task to execute.
+     *
+     * \details
+     *
+     * Blocks when the queue is full, i.e. when the workers are more than capacity many tasks behind. The
+     * task is executed exactly once; clients that need to wait for their tasks or collect results do so
+     * through state captured in the task (see seqan3::detail::execution_handler_shared_pool).
+     */
+    void submit(task_type task)
+    {
+        [[maybe_unused]] contrib::queue_op_status const status = tasks.wait_push(std::move(task));
+        assert(status == contrib::queue_op_status::success); // the queue is only closed on destruction
+    }
+    //!\}
+
+    /*!\name Observers
+     * \{
+     */
+    //!\brief Returns the number of worker threads of this pool.
+    size_t thread_count() const noexcept
+    {
+        return threads.size();
+    }
+    //!\}
+
+    /*!\name The shared pool
+     * \{
+     */
+    /*!\brief Returns the process-wide shared pool; created on first access.
+     *
+     * \details
+     *
+     * Unless configured differently via configure_shared(), the shared pool spawns one worker per hardware
+     * thread and does not pin its workers. The pool lives until the end of the program.
+     */
+    static thread_pool & shared()
+    {
+        shared_created().store(true);
+        static thread_pool pool{shared_parameters().first, shared_parameters().second};
+        return pool;
+    }
+
+    /*!\brief Sets the parameters the shared pool is created with.
+     * \param[in] thread_count The number of worker threads of the shared pool; `0` is treated as `1`.
+     * \param[in] cpus         The cpus to pin the worker threads of the shared pool to; no pinning if empty.
+     * \throws std::logic_error if the shared pool has already been created, i.e. shared() was called before.
+     *
+     * \details
+     *
+     * Must be called before the shared pool is first used, e.g. at the start of `main`. Note that the check
+     * against prior use is not race free; configuring the shared pool concurrently with its first use is a
+     * programming error.
+     */
+    static void configure_shared(size_t const thread_count, std::vector<unsigned> cpus = {})
+    {
+        if (shared_created().load())
+            throw std::logic_error{"The shared thread pool has already been created; "
+                                   "it must be configured before its first use."};
+
+        shared_parameters() = {thread_count, std::move(cpus)};
+    }
+    //!\}
+
+private:
+    //!\brief The queue capacity granted per worker thread before submissions block.
+    static constexpr size_t tasks_per_thread = 4;
+
+    //!\brief The parameters the shared pool is created with (thread count and cpus to pin to).
+    static std::pair<size_t, std::vector<unsigned>> & shared_parameters()
+    {
+        static std::pair<size_t, std::vector<unsigned>> parameters{std::thread::hardware_concurrency(),
+                                                                   std::vector<unsigned>{}};
+        return parameters;
+    }
+
+    //!\brief Whether the shared pool has been created (set on access, checked by configure_shared()).
+    static std::atomic<bool> & shared_created()
+    {
+        static std::atomic<bool> created{false};
+        return created;
+    }
+
+    /*!\brief Pins the given thread to the given cpu (best-effort).
+     * \param[in,out] thread The thread to pin.
+     * \param[in]     cpu    The cpu the thread is allowed to run on.
+     */
+    static void pin_to_cpu([[maybe_unused]] std::thread & thread, [[maybe_unused]] unsigned const cpu)
+    {
+#if defined(__linux__)
+        cpu_set_t cpu_set{};
+        CPU_ZERO(&cpu_set);
+        CPU_SET(cpu, &cpu_set);
+
+        pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t), &cpu_set);
+#endif
+    }
+
+    //!\brief The worker threads processing the task queue.
+    std::vector<std::thread> threads{};
+    //!\brief The queue of submitted tasks; closed on destruction to terminate the worker threads.
+    contrib::buffer_queue<task_type> tasks;
+};
+
+} // namespace seqan3
@@ -0,0 +1,292 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::radix_sort.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <seqan3/core/metafunction/basic.hpp>
+#include <seqan3/core/metafunction/range.hpp>
+#include <seqan3/core/metafunction/template_inspection.hpp>
+#include <seqan3/core/parallel/thread_pool.hpp>
+#include <seqan3/std/concepts>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\interface seqan3::detail::RadixSortable <>
+ * \brief Whether a value can be sorted by seqan3::detail::radix_sort: an unsigned integral or a pair of
+ *        unsigned integrals (sorted lexicographically, like their `operator<`).
+ * \ingroup core
+ */
+//!\cond
+template <typename value_t>
+SEQAN3_CONCEPT RadixSortable = std::UnsignedIntegral<value_t> ||
+                               (is_type_specialisation_of_v<value_t, std::pair> &&
+                                std::UnsignedIntegral<typename value_t::first_type> &&
+                                std::UnsignedIntegral<typename value_t::second_type>);
+//!\endcond
+
+//!\brief Below this many elements radix_sort delegates to comparison sorting (the histograms do not pay off).
+constexpr size_t radix_sort_min_size = 2048;
+
+//!\brief The number of elements each task of the parallel radix_sort should process at least.
+constexpr size_t radix_sort_min_chunk = 65536;
+
+/*!\brief Runs one LSD counting pass per key byte, ping-ponging between the two arrays.
+ * \returns The array the sorted elements ended up in (`src` or `dst`).
+ * \ingroup core
+ *
+ * Passes in which all keys share the same byte (e.g. the high bytes of small values) are skipped, so
+ * sorting 64 bit positions of a short text does not pay for eight passes. Every pass is stable, hence
+ * the whole sort is.
+ */
+template <typename value_t, typename key_fn_t>
+inline value_t * radix_sort_passes(value_t * src, value_t * dst, size_t const size, key_fn_t key_fn)
+{
+    using key_t = remove_cvref_t<decltype(key_fn(src[0]))>;
+
+    for (size_t pass = 0; pass < sizeof(key_t); ++pass)
+    {
+        size_t const shift = pass * 8;
+
+        std::array<size_t, 256> counts{};
+        for (size_t i = 0; i < size; ++i)
+            ++counts[(key_fn(src[i]) >> shift) & 0xffu];
+
+        if (std::find(counts.begin(), counts.end(), size) != counts.end())
+            continue; // all keys share this byte
+
+        std::array<size_t, 256> offsets;
+        size_t running = 0;
+        for (size_t digit = 0; digit < 256; ++digit)
+        {
+            offsets[digit] = running;
+            running += counts[digit];
+        }
+
+        for (size_t i = 0; i < size; ++i)
+            dst[offsets[(key_fn(src[i]) >> shift) & 0xffu]++] = src[i];
+
+        std::swap(src, dst);
+    }
+
+    return src;
+}
+
+/*!\brief Submits one task per chunk to the pool and blocks until all of them have finished.
+ * \ingroup core
+ */
+template <typename chunk_fn_t>
+inline void radix_sort_run_chunks(thread_pool & pool, size_t const chunk_count, chunk_fn_t && chunk_fn)
+{
+    std::atomic<size_t> remaining{chunk_count};
+    std::mutex mutex;
+    std::condition_variable done;
+
+    for (size_t chunk = 0; chunk < chunk_count; ++chunk)
+    {
+        pool.submit([&, chunk] ()
+        {
+            chunk_fn(chunk);
+
+            if (remaining.fetch_sub(1) == 1)
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+                done.notify_one();
+            }
+        });
+    }
+
+    std::unique_lock<std::mutex> lock{mutex};
+    done.wait(lock, [&] () { return remaining.load() == 0; });
+}
+
+/*!\brief The parallel counterpart of radix_sort_passes: histograms and scatters run chunked on the pool.
+ * \returns The array the sorted elements ended up in (`src` or `dst`).
+ * \ingroup core
+ *
+ * Every pass splits the input into one chunk per worker, computes per-chunk histograms in parallel,
+ * derives non-overlapping scatter areas from them on the calling thread and scatters the chunks in
+ * parallel. Scattering chunk by chunk in input order keeps the pass (and thereby the sort) stable.
+ */
+template <typename value_t, typename key_fn_t>
+inline value_t * radix_sort_passes_parallel(value_t * src, value_t * dst, size_t const size, key_fn_t key_fn,
+                                            thread_pool & pool, size_t const chunk_count)
+{
+    using key_t = remove_cvref_t<decltype(key_fn(src[0]))>;
+
+    size_t const chunk_size = (size + chunk_count - 1) / chunk_count;
+    std::vector<std::array<size_t, 256>> chunk_counts(chunk_count);
+    std::vector<std::array<size_t, 256>> chunk_offsets(chunk_count);
+
+    auto chunk_bounds = [&] (size_t const chunk)
+    {
+        return std::pair<size_t, size_t>{chunk * chunk_size, std::min((chunk + 1) * chunk_size, size)};
+    };
+
+    for (size_t pass = 0; pass < sizeof(key_t); ++pass)
+    {
+        size_t const shift = pass * 8;
+
+        radix_sort_run_chunks(pool, chunk_count, [&] (size_t const chunk)
+        {
+            auto const [first, last] = chunk_bounds(chunk);
+            std::array<size_t, 256> counts{};
+            for (size_t i = first; i < last; ++i)
+                ++counts[(key_fn(src[i]) >> shift) & 0xffu];
+            chunk_counts[chunk] = counts;
+        });
+
+        // an element with digit d of chunk c goes behind all elements with smaller digits and behind the
+        // d-elements of earlier chunks; walking digit-major/chunk-minor yields exactly these offsets
+        size_t running = 0;
+        bool degenerate = false;
+        for (size_t digit = 0; digit < 256; ++digit)
+        {
+            for (size_t chunk = 0; chunk < chunk_count; ++chunk)
+            {
+                chunk_offsets[chunk][digit] = running;
+                running += chunk_counts[chunk][digit];
+            }
+            degenerate |= (running == size && chunk_offsets[0][digit] == 0);
+        }
+
+        if (degenerate) // all keys share this byte
+            continue;
+
+        radix_sort_run_chunks(pool, chunk_count, [&] (size_t const chunk)
+        {
+            auto const [first, last] = chunk_bounds(chunk);
+            std::array<size_t, 256> offsets = chunk_offsets[chunk];
+            for (size_t i = first; i < last; ++i)
+                dst[offsets[(key_fn(src[i]) >> shift) & 0xffu]++] = src[i];
+        });
+
+        std::swap(src, dst);
+    }
+
+    return src;
+}
+
+/*!\brief Sorts a contiguous range of unsigned integers (or pairs thereof) with an LSD radix sort.
+ * \tparam rng_t The range type; must model std::ranges::ContiguousRange and std::ranges::SizedRange over a
+ *               seqan3::detail::RadixSortable value type.
+ * \param[in,out] range The range to sort in ascending order (pairs lexicographically).
+ * \ingroup core
+ *
+ * \details
+ *
+ * Sorting text positions (and other bulk integer data) dominates the post-processing of locate-heavy
+ * index searches; an LSD radix sort replaces the \f$O(n \log n)\f$ comparisons of std::sort with a few
+ * counting passes over the data. Small inputs fall back to std::sort, passes over constant key bytes are
+ * skipped, and the sort is stable.
+ *
+ * ### Complexity
+ *
+ * Linear in the number of elements times the number of distinct key bytes; allocates one buffer of the
+ * input size.
+ */
+template <std::ranges::ContiguousRange rng_t>
+//!\cond
+    requires std::ranges::SizedRange<rng_t> && RadixSortable<value_type_t<remove_cvref_t<rng_t>>>
+//!\endcond
+inline void radix_sort(rng_t && range)
+{
+    using value_t = value_type_t<remove_cvref_t<rng_t>>;
+
+    size_t const size = std::ranges::size(range);
+    if (size < radix_sort_min_size)
+    {
+        std::sort(std::ranges::begin(range), std::ranges::end(range));
+        return;
+    }
+
+    value_t * const data = std::ranges::data(range);
+    std::vector<value_t> buffer(size);
+
+    value_t * sorted;
+    if constexpr (is_type_specialisation_of_v<value_t, std::pair>)
+    {
+        // LSD over the composite key: the stable passes over `first` preserve the order established
+        // by `second`, which yields the lexicographic order of the pair
+        sorted = radix_sort_passes(data, buffer.data(), size, [] (value_t const & value) { return value.second; });
+        sorted = radix_sort_passes(sorted, (sorted == data) ? buffer.data() : data, size,
+                                   [] (value_t const & value) { return value.first; });
+    }
+    else
+    {
+        sorted = radix_sort_passes(data, buffer.data(), size, [] (value_t const value) { return value; });
+    }
+
+    if (sorted != data)
+        std::copy(sorted, sorted + size, data);
+}
+
+/*!\brief The parallel overload of seqan3::detail::radix_sort; histogram and scatter run on the given pool.
+ * \param[in,out] range The range to sort in ascending order (pairs lexicographically).
+ * \param[in,out] pool  The worker threads to run on, e.g. seqan3::thread_pool::shared().
+ * \ingroup core
+ *
+ * \attention Must not be called from a task running on \p pool itself: the calling thread blocks on tasks
+ *            submitted after it, which the pool's in-order workers cannot get to (see seqan3::thread_pool).
+ */
+template <std::ranges::ContiguousRange rng_t>
+//!\cond
+    requires std::ranges::SizedRange<rng_t> && RadixSortable<value_type_t<remove_cvref_t<rng_t>>>
+//!\endcond
+inline void radix_sort(rng_t && range, thread_pool & pool)
+{
+    using value_t = value_type_t<remove_cvref_t<rng_t>>;
+
+    size_t const size = std::ranges::size(range);
+    size_t const chunk_count = std::min(pool.thread_count(),
+                                        (size + radix_sort_min_chunk - 1) / radix_sort_min_chunk);
+
+    if (chunk_count < 2) // too small to be worth distributing
+    {
+        radix_sort(range);
+        return;
+    }
+
+    value_t * const data = std::ranges::data(range);
+    std::vector<value_t> buffer(size);
+
+    value_t * sorted;
+    if constexpr (is_type_specialisation_of_v<value_t, std::pair>)
+    {
+        sorted = radix_sort_passes_parallel(data, buffer.data(), size,
+                                            [] (value_t const & value) { return value.second; },
+                                            pool, chunk_count);
+        sorted = radix_sort_passes_parallel(sorted, (sorted == data) ? buffer.data() : data, size,
+                                            [] (value_t const & value) { return value.first; },
+                                            pool, chunk_count);
+    }
+    else
+    {
+        sorted = radix_sort_passes_parallel(data, buffer.data(), size,
+                                            [] (value_t const value) { return value; },
+                                            pool, chunk_count);
+    }
+
+    if (sorted != data)
+        std::copy(sorted, sorted + size, data);
+}
+
+} // namespace seqan3::detail
@@ -0,0 +1,108 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Contains seqan3::detail::max_simd_width_at_runtime and seqan3::detail::cpu_dispatch.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+#include <seqan3/core/simd/detail/builtin_simd.hpp>
+#include <seqan3/core/simd/detail/default_simd_length.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief The vector register width (in bytes) supported by the cpu this binary runs on.
+ * \ingroup simd
+ * \returns `64` on avx512(bw) cpus, `32` on avx2 cpus, `16` on sse4 cpus and `1` otherwise.
+ *
+ * \details
+ *
+ * While seqan3::detail::default_simd_max_length reflects what the binary was *compiled* for (`-msse4`,
+ * `-mavx2`, ...), this function queries what the executing cpu actually *supports* (on x86 via cpuid,
+ * cached after the first call). The two differ whenever one binary is distributed to heterogeneous
+ * nodes; seqan3::detail::cpu_dispatch combines both to select the widest kernel that is both compiled
+ * in and executable.
+ */
+inline size_t max_simd_width_at_runtime()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    static size_t const width = []
+    {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512bw"))
+            return 64u;
+        if (__builtin_cpu_supports("avx2"))
+            return 32u;
+        if (__builtin_cpu_supports("sse4.1"))
+            return 16u;
+        return 1u;
+    }();
+    return width;
+#else
+    // On other architectures the compile-time width is all we know.
+    return default_simd_max_length<builtin_simd>;
+#endif
+}
+
+/*!\brief Invokes `fn` with the widest usable simd width as a `std::integral_constant<size_t, width>`.
+ * \ingroup simd
+ * \tparam fn_t The callable; must be invocable with `std::integral_constant<size_t, width>` for every
+ *              width in `{64, 32, 16, 1}` that does not exceed the compile-time maximum.
+ * \param[in] fn The callable to invoke, typically a generic lambda instantiating a kernel per width.
+ * \returns The result of invoking `fn`.
+ *
+ * \details
+ *
+ * The selected width is the widest that is (a) not larger than what the translation unit was compiled
+ * for (seqan3::detail::default_simd_max_length, so every instantiated kernel can legally use its
+ * instructions) and (b) supported by the executing cpu (seqan3::detail::max_simd_width_at_runtime, so a
+ * binary built with `-mavx512bw` still runs on sse4 silicon by taking a narrower branch). Since the
+ * width arrives as an integral_constant, the callable can use it as a constant expression:
+ *
+ * ```cpp
+ * detail::cpu_dispatch([&] (auto width)
+ * {
+ *     using score_t = simd_type_t<int16_t, width / sizeof(int16_t)>;
+ *     // ... width-specialised kernel ...
+ * });
+ * ```
+ *
+ * Every width branch is instantiated at compile time; the runtime cost is one cached cpuid lookup and
+ * a handful of comparisons, so dispatching is only worthwhile around kernels, not inner loops.
+ *
+ * \attention The instruction set a kernel may use is still capped by the compiler flags of the
+ * translation unit — instantiating a 64-element vector in a `-msse4` build produces (slow but correct)
+ * synthesised code, which is why widths beyond the compile-time maximum are never selected.
+ */
+template <typename fn_t>
+auto cpu_dispatch(fn_t && fn)
+{
+    constexpr size_t compiled_width = std::max<size_t>(1u, default_simd_max_length<builtin_simd>);
+    size_t const runtime_width = max_simd_width_at_runtime();
+
+    if constexpr (compiled_width >= 64)
+        if (runtime_width >= 64)
+            return std::forward<fn_t>(fn)(std::integral_constant<size_t, 64>{});
+
+    if constexpr (compiled_width >= 32)
+        if (runtime_width >= 32)
+            return std::forward<fn_t>(fn)(std::integral_constant<size_t, 32>{});
+
+    if constexpr (compiled_width >= 16)
+        if (runtime_width >= 16)
+            return std::forward<fn_t>(fn)(std::integral_constant<size_t, 16>{});
+
+    return std::forward<fn_t>(fn)(std::integral_constant<size_t, 1>{});
+}
+
+} // namespace seqan3::detail
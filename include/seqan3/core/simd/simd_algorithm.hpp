@@ -12,6 +12,11 @@
 
 #pragma once
 
+#include <array>
+#include <cassert>
+#include <cstring>
+#include <limits>
+#include <type_traits>
 #include <utility>
 
 #include <seqan3/core/simd/concept.hpp>
@@ -36,6 +41,31 @@ constexpr simd_t iota_impl(scalar_t const offset, std::integer_sequence<scalar_t
     return simd_t{static_cast<scalar_t>(offset + I)...};
 }
 
+/*!\brief Rotates the lanes of a simd vector to the left by `count` positions.
+ * \ingroup simd
+ *
+ * Used by the horizontal reductions to combine the two halves of a vector; on GCC the rotation is a
+ * single shuffle instruction, other compilers get an equivalent lane loop.
+ */
+template <simd_concept simd_t>
+constexpr simd_t rotate_lanes_left(simd_t const & vec, size_t const count)
+{
+    constexpr size_t length = simd_traits<simd_t>::length;
+    using scalar_t = typename simd_traits<simd_t>::scalar_type;
+
+#if defined(__GNUC__) && !defined(__clang__)
+    simd_t mask{};
+    for (size_t i = 0; i < length; ++i)
+        mask[i] = static_cast<scalar_t>((i + count) % length);
+    return __builtin_shuffle(vec, mask);
+#else
+    simd_t result{};
+    for (size_t i = 0; i < length; ++i)
+        result[i] = vec[(i + count) % length];
+    return result;
+#endif
+}
+
 } // namespace seqan3::detail
 
 namespace seqan3
@@ -60,6 +90,104 @@ constexpr simd_t fill(typename simd_traits<simd_t>::scalar_type const scalar)
     return detail::fill_impl<simd_t>(scalar, std::make_index_sequence<length>{});
 }
 
+/*!\brief Computes the element-wise maximum of two seqan3::simd::simd_type vectors.
+ * \tparam    simd_t The simd type which satisfies seqan3::simd::simd_concept.
+ * \param[in] lhs    The left operand.
+ * \param[in] rhs    The right operand.
+ * \returns A simd vector where each element is the maximum of the corresponding elements of `lhs` and `rhs`.
+ * \ingroup simd
+ */
+template <simd_concept simd_t>
+constexpr simd_t max(simd_t const lhs, simd_t const rhs)
+{
+    // The comparison yields a mask with all bits set for the lanes where lhs > rhs holds.
+    typename simd_traits<simd_t>::mask_type const mask = lhs > rhs;
+    return (lhs & reinterpret_cast<simd_t const &>(mask)) | (rhs & ~reinterpret_cast<simd_t const &>(mask));
+}
+
+/*!\brief Computes the element-wise minimum of two seqan3::simd::simd_type vectors.
+ * \tparam    simd_t The simd type which satisfies seqan3::simd::simd_concept.
+ * \param[in] lhs    The left operand.
+ * \param[in] rhs    The right operand.
+ * \returns A simd vector where each element is the minimum of the corresponding elements of `lhs` and `rhs`.
+ * \ingroup simd
+ */
+template <simd_concept simd_t>
+constexpr simd_t min(simd_t const lhs, simd_t const rhs)
+{
+    typename simd_traits<simd_t>::mask_type const mask = lhs < rhs;
+    return (lhs & reinterpret_cast<simd_t const &>(mask)) | (rhs & ~reinterpret_cast<simd_t const &>(mask));
+}
+
+/*!\brief Adds two seqan3::simd::simd_type vectors lane-wise, clamping each sum to the limits of the scalar type
+ *        instead of wrapping around on overflow.
+ * \tparam    simd_t The simd type which satisfies seqan3::simd::simd_concept; must pack a signed integral type.
+ * \param[in] lhs    The left operand.
+ * \param[in] rhs    The right operand.
+ * \returns A simd vector where each element is the saturated sum of the corresponding elements of `lhs` and `rhs`.
+ * \ingroup simd
+ *
+ * \details
+ *
+ * A signed addition overflows iff both operands have the same sign and the wrapped sum has the opposite sign.
+ * In that case the lane is replaced with the maximum value of the scalar type for positive operands and with the
+ * minimum value for negative operands. This allows alignment kernels to run many lanes of a small score type and
+ * to detect the affected lanes afterwards by comparing against the type's limits (see
+ * seqan3::detail::simd_alignment_algorithm).
+ */
+template <simd_concept simd_t>
+constexpr simd_t saturated_add(simd_t const lhs, simd_t const rhs)
+{
+    using scalar_t = typename simd_traits<simd_t>::scalar_type;
+    static_assert(std::is_signed_v<scalar_t>, "The saturated addition is only implemented for signed types.");
+
+    constexpr int sign_shift = sizeof(scalar_t) * 8 - 1;
+
+    simd_t const sum = lhs + rhs;  // May wrap around.
+    // The sign bit is set for every lane that overflowed.
+    simd_t const overflow = ~(lhs ^ rhs) & (lhs ^ sum);
+    // The saturation value of a lane: the maximum of the scalar type for positive operands, the minimum for
+    // negative ones (flipping all bits of the maximum yields the minimum in two's complement).
+    simd_t const saturation = (lhs >> sign_shift) ^ fill<simd_t>(std::numeric_limits<scalar_t>::max());
+    // Smear the overflow sign bit over the whole lane to build a selection mask.
+    simd_t const mask = overflow >> sign_shift;
+
+    return (saturation & mask) | (sum & ~mask);
+}
+
+/*!\brief Subtracts two seqan3::simd::simd_type vectors lane-wise, clamping each difference to the limits of the
+ *        scalar type instead of wrapping around on overflow.
+ * \tparam    simd_t The simd type which satisfies seqan3::simd::simd_concept; must pack a signed integral type.
+ * \param[in] lhs    The left operand.
+ * \param[in] rhs    The right operand.
+ * \returns A simd vector where each element is the saturated difference of the corresponding elements of `lhs`
+ *          and `rhs`.
+ * \ingroup simd
+ *
+ * \details
+ *
+ * The counterpart of seqan3::simd::saturated_add: a signed subtraction overflows iff the operands have
+ * different signs and the wrapped difference has the opposite sign of `lhs`; the affected lanes saturate
+ * towards the sign of `lhs`.
+ */
+template <simd_concept simd_t>
+constexpr simd_t saturated_sub(simd_t const lhs, simd_t const rhs)
+{
+    using scalar_t = typename simd_traits<simd_t>::scalar_type;
+    static_assert(std::is_signed_v<scalar_t>, "The saturated subtraction is only implemented for signed types.");
+
+    constexpr int sign_shift = sizeof(scalar_t) * 8 - 1;
+
+    simd_t const diff = lhs - rhs;  // May wrap around.
+    // The sign bit is set for every lane that overflowed.
+    simd_t const overflow = (lhs ^ rhs) & (lhs ^ diff);
+    // Saturate towards the sign of lhs, like for the saturated addition.
+    simd_t const saturation = (lhs >> sign_shift) ^ fill<simd_t>(std::numeric_limits<scalar_t>::max());
+    simd_t const mask = overflow >> sign_shift;
+
+    return (saturation & mask) | (diff & ~mask);
+}
+
 /*!\brief Fills a seqan3::simd::simd_type vector with the scalar values offset, offset+1, offset+2, ...
  * \tparam    simd_t The simd type which satisfies seqan3::simd::simd_concept.
  * \param[in] offset The scalar offset to fill the seqan3::simd::simd_type vector.
@@ -77,6 +205,208 @@ constexpr simd_t iota(typename simd_traits<simd_t>::scalar_type const offset)
     return detail::iota_impl<simd_t>(offset, std::make_integer_sequence<scalar_type, length>{});
 }
 
+/*!\brief Extracts a single lane of a seqan3::simd::simd_type vector.
+ * \tparam    simd_t The simd type which satisfies seqan3::simd::simd_concept.
+ * \param[in] vec    The vector to extract from.
+ * \param[in] i      The lane to extract; must be smaller than the vector's length.
+ * \returns The scalar value of the i-th lane.
+ * \ingroup simd
+ */
+template <simd_concept simd_t>
+constexpr typename simd_traits<simd_t>::scalar_type extract(simd_t const & vec, size_t const i)
+{
+    assert(i < simd_traits<simd_t>::length);
+    return vec[i];
+}
+
+/*!\brief Returns a copy of a seqan3::simd::simd_type vector with a single lane replaced.
+ * \tparam    simd_t The simd type which satisfies seqan3::simd::simd_concept.
+ * \param[in] vec    The vector to merge the scalar into.
+ * \param[in] i      The lane to replace; must be smaller than the vector's length.
+ * \param[in] scalar The new value of the i-th lane.
+ * \returns `vec` with lane `i` set to `scalar`.
+ * \ingroup simd
+ */
+template <simd_concept simd_t>
+constexpr simd_t insert(simd_t vec, size_t const i, typename simd_traits<simd_t>::scalar_type const scalar)
+{
+    assert(i < simd_traits<simd_t>::length);
+    vec[i] = scalar;
+    return vec;
+}
+
+/*!\brief Loads a full seqan3::simd::simd_type vector from (possibly unaligned) memory.
+ * \tparam    simd_t The simd type which satisfies seqan3::simd::simd_concept.
+ * \param[in] mem    Pointer to at least `sizeof(simd_t)` readable bytes.
+ * \returns A vector holding the loaded values.
+ * \ingroup simd
+ *
+ * \details
+ *
+ * The load is expressed as a `memcpy`, which the compiler turns into a single unaligned vector load
+ * on every relevant platform.
+ */
+template <simd_concept simd_t>
+simd_t load(void const * mem)
+{
+    simd_t vec{};
+    std::memcpy(&vec, mem, sizeof(simd_t));
+    return vec;
+}
+
+/*!\brief Loads the first `count` lanes of a seqan3::simd::simd_type vector from memory, zeroing the rest.
+ * \tparam    simd_t The simd type which satisfies seqan3::simd::simd_concept.
+ * \param[in] mem    Pointer to at least `count` readable scalars.
+ * \param[in] count  The number of scalars to load; must not exceed the vector's length.
+ * \returns A vector holding the loaded values in its first `count` lanes and zeroes in the remaining ones.
+ * \ingroup simd
+ *
+ * \details
+ *
+ * This is the masked load needed at the ragged tails of vectorised loops, where fewer elements remain
+ * than the vector has lanes; in contrast to seqan3::simd::load it never reads behind `mem + count`.
+ */
+template <simd_concept simd_t>
+simd_t load_partial(typename simd_traits<simd_t>::scalar_type const * mem, size_t const count)
+{
+    assert(count <= simd_traits<simd_t>::length);
+
+    simd_t vec{};
+    std::memcpy(&vec, mem, count * sizeof(typename simd_traits<simd_t>::scalar_type));
+    return vec;
+}
+
+/*!\brief Looks up one table entry per lane of an index vector.
+ * \tparam    simd_t       The result simd type which satisfies seqan3::simd::simd_concept.
+ * \tparam    index_simd_t The index simd type which satisfies seqan3::simd::simd_concept; must have the
+ *                         same length as `simd_t`.
+ * \param[in] table        Pointer to the table to gather from; every index must be a valid offset.
+ * \param[in] indices      The per-lane table offsets.
+ * \returns A vector where lane `i` holds `table[indices[i]]`.
+ * \ingroup simd
+ *
+ * \details
+ *
+ * This is the access pattern of vectorised scoring-matrix lookups: the indices are computed in
+ * registers and every lane reads a different table cell.
+ */
+template <simd_concept simd_t, simd_concept index_simd_t>
+//!\cond
+    requires simd_traits<simd_t>::length == simd_traits<index_simd_t>::length
+//!\endcond
+constexpr simd_t gather(typename simd_traits<simd_t>::scalar_type const * table, index_simd_t const & indices)
+{
+    simd_t vec{};
+    for (size_t i = 0; i < simd_traits<simd_t>::length; ++i)
+        vec[i] = table[indices[i]];
+    return vec;
+}
+
+/*!\brief Per-lane table lookup where the table itself is a simd vector ("in-register gather").
+ * \tparam    simd_t  The simd type which satisfies seqan3::simd::simd_concept.
+ * \param[in] table   The vector holding the table entries.
+ * \param[in] indices The per-lane table offsets; every lane is taken modulo the vector length.
+ * \returns A vector where lane `i` holds `table[indices[i] % length]`.
+ * \ingroup simd
+ *
+ * \details
+ *
+ * Unlike seqan3::simd::gather the table lives in a register, so no memory access happens at all: for byte
+ * vectors GCC lowers this to a single shuffle instruction (`pshufb` on SSSE3 and later). Note that wide
+ * byte shuffles (e.g. `vpshufb` on AVX2) operate within 128-bit halves only — tables that shall be looked
+ * up with such vectors must replicate their entries every 16 lanes (and use indices `< 16`), which makes
+ * the per-half instruction semantics coincide with the modulo semantics above.
+ */
+template <simd_concept simd_t>
+constexpr simd_t shuffle(simd_t const & table, simd_t const & indices)
+{
+#if defined(__GNUC__) && !defined(__clang__)
+    return __builtin_shuffle(table, indices);
+#else
+    constexpr size_t length = simd_traits<simd_t>::length;
+    simd_t vec{};
+    for (size_t i = 0; i < length; ++i)
+        vec[i] = table[indices[i] % length];
+    return vec;
+#endif
+}
+
+/*!\brief Transposes a square matrix of seqan3::simd::simd_type vectors in place.
+ * \tparam        simd_t The simd type which satisfies seqan3::simd::simd_concept.
+ * \param[in,out] matrix The matrix to transpose, given as one vector per row.
+ * \ingroup simd
+ *
+ * \details
+ *
+ * After the call `matrix[i][j]` holds the previous value of `matrix[j][i]`. This converts between
+ * sequence-major layout (one sequence per vector) and lane-major layout (one position per vector,
+ * one sequence per lane), which is how batches of sequences enter an inter-sequence vectorised
+ * alignment kernel.
+ */
+template <simd_concept simd_t>
+constexpr void transpose(std::array<simd_t, simd_traits<simd_t>::length> & matrix)
+{
+    for (size_t i = 0; i < simd_traits<simd_t>::length; ++i)
+    {
+        for (size_t j = i + 1; j < simd_traits<simd_t>::length; ++j)
+        {
+            auto const tmp = matrix[i][j];
+            matrix[i][j] = matrix[j][i];
+            matrix[j][i] = tmp;
+        }
+    }
+}
+
+/*!\brief Returns the maximum over all lanes of a seqan3::simd::simd_type vector.
+ * \tparam    simd_t The simd type which satisfies seqan3::simd::simd_concept.
+ * \param[in] vec    The vector to reduce.
+ * \returns The largest scalar value held in any lane of `vec`.
+ * \ingroup simd
+ *
+ * \details
+ *
+ * The reduction repeatedly folds the vector onto its rotated self, so it needs log2(length) vector
+ * operations instead of a lane loop; this is the find-optimum step of vectorised dynamic programming.
+ */
+template <simd_concept simd_t>
+constexpr typename simd_traits<simd_t>::scalar_type hmax(simd_t vec)
+{
+    for (size_t half = simd_traits<simd_t>::length / 2; half > 0; half /= 2)
+        vec = max(vec, detail::rotate_lanes_left(vec, half));
+    return vec[0];
+}
+
+/*!\brief Returns the minimum over all lanes of a seqan3::simd::simd_type vector.
+ * \tparam    simd_t The simd type which satisfies seqan3::simd::simd_concept.
+ * \param[in] vec    The vector to reduce.
+ * \returns The smallest scalar value held in any lane of `vec`.
+ * \ingroup simd
+ */
+template <simd_concept simd_t>
+constexpr typename simd_traits<simd_t>::scalar_type hmin(simd_t vec)
+{
+    for (size_t half = simd_traits<simd_t>::length / 2; half > 0; half /= 2)
+        vec = min(vec, detail::rotate_lanes_left(vec, half));
+    return vec[0];
+}
+
+/*!\brief Returns the sum over all lanes of a seqan3::simd::simd_type vector.
+ * \tparam    simd_t The simd type which satisfies seqan3::simd::simd_concept.
+ * \param[in] vec    The vector to reduce.
+ * \returns The sum of the scalar values of all lanes of `vec`, wrapping around on overflow.
+ * \ingroup simd
+ *
+ * \attention The accumulation happens in the scalar type of the vector, so summing e.g. many `int8_t`
+ * pileup counters can wrap; widen the lanes before reducing if the sum can exceed the scalar's range.
+ */
+template <simd_concept simd_t>
+constexpr typename simd_traits<simd_t>::scalar_type hadd(simd_t vec)
+{
+    for (size_t half = simd_traits<simd_t>::length / 2; half > 0; half /= 2)
+        vec = vec + detail::rotate_lanes_left(vec, half);
+    return vec[0];
+}
+
 } // inline namespace simd
 
 } // namespace seqan3
@@ -0,0 +1,270 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides the opt-in tracing instrumentation (SEQAN3_TRACE_SCOPE, seqan3::tracing).
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <seqan3/core/platform.hpp>
+
+/*!\def SEQAN3_ENABLE_TRACING
+ * \brief Whether the SEQAN3_TRACE_SCOPE instrumentation points are compiled in (default: 0).
+ * \ingroup core
+ *
+ * \details
+ *
+ * Define this macro to `1` **before including any SeqAn3 header** to activate the trace points placed
+ * throughout the library's hot paths (record parsing, alignment kernels, index traversal). When left at
+ * its default of `0`, every SEQAN3_TRACE_SCOPE expands to nothing, so instrumented code carries no
+ * overhead whatsoever.
+ */
+#ifndef SEQAN3_ENABLE_TRACING
+#define SEQAN3_ENABLE_TRACING 0
+#endif
+
+namespace seqan3::detail
+{
+
+//!\brief One completed trace scope; timestamps are microseconds since seqan3::detail::trace_epoch().
+//!\ingroup core
+struct trace_event
+{
+    //!\brief The name of the scope; must point to a string literal.
+    char const * name;
+    //!\brief The begin of the scope in microseconds since the trace epoch.
+    uint64_t begin_us;
+    //!\brief The duration of the scope in microseconds.
+    uint64_t duration_us;
+    //!\brief A small sequential id of the recording thread.
+    uint32_t thread_id;
+};
+
+//!\brief Returns the time point all trace timestamps are relative to (fixed on first use).
+//!\ingroup core
+inline std::chrono::steady_clock::time_point trace_epoch() noexcept
+{
+    static std::chrono::steady_clock::time_point const epoch = std::chrono::steady_clock::now();
+    return epoch;
+}
+
+/*!\brief Collects the trace events of all threads.
+ * \ingroup core
+ *
+ * \details
+ *
+ * Every thread records into a thread-local buffer (see seqan3::detail::trace_buffer) that is flushed into
+ * this registry when it grows large and when the thread terminates, so recording a scope in the steady
+ * state is a plain vector append without synchronisation.
+ */
+struct trace_registry
+{
+    //!\brief The mutex protecting #events.
+    std::mutex mutex{};
+    //!\brief All flushed events.
+    std::vector<trace_event> events{};
+
+    //!\brief Returns the process-wide registry.
+    static trace_registry & instance() noexcept
+    {
+        static trace_registry registry{};
+        return registry;
+    }
+
+    //!\brief Hands out small sequential thread ids (chrome://tracing displays one row per tid).
+    static uint32_t thread_id() noexcept
+    {
+        static std::atomic<uint32_t> counter{0};
+        static thread_local uint32_t const id = counter.fetch_add(1, std::memory_order_relaxed);
+        return id;
+    }
+};
+
+//!\brief The thread-local event buffer; flushes into the seqan3::detail::trace_registry.
+//!\ingroup core
+struct trace_buffer
+{
+    //!\brief How many events are buffered locally before flushing.
+    static constexpr size_t flush_threshold = 4096;
+
+    //!\brief The locally buffered events.
+    std::vector<trace_event> events{};
+
+    //!\brief Appends one event, flushing if the buffer grew large.
+    void record(trace_event const event)
+    {
+        events.push_back(event);
+        if (events.size() >= flush_threshold)
+            flush();
+    }
+
+    //!\brief Moves the buffered events into the global registry.
+    void flush()
+    {
+        if (events.empty())
+            return;
+
+        trace_registry & registry = trace_registry::instance();
+        std::unique_lock<std::mutex> lock{registry.mutex};
+        registry.events.insert(registry.events.end(), events.begin(), events.end());
+        lock.unlock();
+        events.clear();
+    }
+
+    //!\brief Flushes the remaining events when the thread terminates.
+    ~trace_buffer()
+    {
+        flush();
+    }
+
+    //!\brief Returns the buffer of the calling thread.
+    static trace_buffer & local() noexcept
+    {
+        static thread_local trace_buffer buffer{};
+        return buffer;
+    }
+};
+
+/*!\brief RAII helper that records the lifetime of a scope as one trace event.
+ * \ingroup core
+ *
+ * \details
+ *
+ * Use via SEQAN3_TRACE_SCOPE rather than directly, so the instrumentation point disappears entirely when
+ * \ref SEQAN3_ENABLE_TRACING is `0`.
+ */
+class trace_scope
+{
+public:
+    trace_scope() = delete;
+    trace_scope(trace_scope const &) = delete;
+    trace_scope(trace_scope &&) = delete;
+    trace_scope & operator=(trace_scope const &) = delete;
+    trace_scope & operator=(trace_scope &&) = delete;
+
+    //!\brief Starts the scope; `name` must point to a string literal.
+    explicit trace_scope(char const * name) noexcept :
+        scope_name{name},
+        begin{std::chrono::steady_clock::now()}
+    {
+        trace_epoch(); // make sure the epoch precedes the first event
+    }
+
+    //!\brief Ends the scope and records the event.
+    ~trace_scope()
+    {
+        using std::chrono::duration_cast;
+        using std::chrono::microseconds;
+
+        auto const end = std::chrono::steady_clock::now();
+        trace_buffer::local().record(
+            trace_event{scope_name,
+                        static_cast<uint64_t>(duration_cast<microseconds>(begin - trace_epoch()).count()),
+                        static_cast<uint64_t>(duration_cast<microseconds>(end - begin).count()),
+                        trace_registry::thread_id()});
+    }
+
+private:
+    //!\brief The name under which the event is recorded.
+    char const * scope_name;
+    //!\brief When the scope was entered.
+    std::chrono::steady_clock::time_point begin;
+};
+
+} // namespace seqan3::detail
+
+namespace seqan3::tracing
+{
+
+//!\brief Whether tracing is compiled in (mirrors \ref SEQAN3_ENABLE_TRACING).
+//!\ingroup core
+inline constexpr bool enabled = static_cast<bool>(SEQAN3_ENABLE_TRACING);
+
+/*!\brief Writes all events recorded so far as chrome://tracing JSON to the given stream.
+ * \param[in,out] stream The stream to write to.
+ * \ingroup core
+ *
+ * \details
+ *
+ * The output is a complete trace in the Trace Event Format ("X" phase events) and can be loaded directly
+ * into `chrome://tracing` or any compatible viewer (e.g. Perfetto, speedscope). Only events of terminated
+ * scopes appear; the buffers of threads still running are flushed on their next large batch or at thread
+ * exit, so write the trace after the instrumented work has finished.
+ */
+inline void write(std::ostream & stream)
+{
+    detail::trace_buffer::local().flush(); // the calling thread's buffer would otherwise be invisible
+
+    detail::trace_registry & registry = detail::trace_registry::instance();
+    std::unique_lock<std::mutex> lock{registry.mutex};
+
+    stream << "{\"traceEvents\":[";
+    bool first = true;
+    for (detail::trace_event const & event : registry.events)
+    {
+        if (!first)
+            stream << ',';
+        first = false;
+        stream << "{\"name\":\"" << event.name << "\",\"cat\":\"seqan3\",\"ph\":\"X\""
+               << ",\"ts\":" << event.begin_us << ",\"dur\":" << event.duration_us
+               << ",\"pid\":0,\"tid\":" << event.thread_id << '}';
+    }
+    stream << "]}";
+}
+
+//!\brief Writes all events recorded so far as chrome://tracing JSON to the given file.
+//!\ingroup core
+inline void write(std::string const & path)
+{
+    std::ofstream stream{path};
+    write(stream);
+}
+
+//!\brief Discards all events recorded so far (e.g. to exclude a warm-up phase from the trace).
+//!\ingroup core
+inline void clear()
+{
+    detail::trace_buffer::local().events.clear();
+
+    detail::trace_registry & registry = detail::trace_registry::instance();
+    std::unique_lock<std::mutex> lock{registry.mutex};
+    registry.events.clear();
+}
+
+} // namespace seqan3::tracing
+
+//!\cond
+#define SEQAN3_TRACE_CONCAT_IMPL(x, y) x##y
+#define SEQAN3_TRACE_CONCAT(x, y) SEQAN3_TRACE_CONCAT_IMPL(x, y)
+//!\endcond
+
+/*!\def SEQAN3_TRACE_SCOPE
+ * \brief Records the enclosing scope as a trace event named `name` (a string literal).
+ * \ingroup core
+ *
+ * \details
+ *
+ * Expands to nothing unless \ref SEQAN3_ENABLE_TRACING is `1`, in which case a
+ * seqan3::detail::trace_scope measures the time from this statement to the end of the enclosing scope.
+ * Retrieve the collected events with seqan3::tracing::write.
+ */
+#if SEQAN3_ENABLE_TRACING
+#define SEQAN3_TRACE_SCOPE(name) \
+    seqan3::detail::trace_scope const SEQAN3_TRACE_CONCAT(seqan3_trace_scope_, __LINE__){name}
+#else
+#define SEQAN3_TRACE_SCOPE(name) static_cast<void>(0)
+#endif
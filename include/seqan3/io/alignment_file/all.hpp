@@ -17,6 +17,9 @@
  * \brief \todo document at a later point in time
  */
 
+#include <seqan3/io/alignment_file/bam_index.hpp>
+#include <seqan3/io/alignment_file/format_bam.hpp>
+#include <seqan3/io/alignment_file/format_cram.hpp>
 #include <seqan3/io/alignment_file/format_sam.hpp>
 #include <seqan3/io/alignment_file/header.hpp>
 #include <seqan3/io/alignment_file/input.hpp>
@@ -0,0 +1,471 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::bam_index.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <seqan3/core/platform.hpp>
+#include <seqan3/io/exception.hpp>
+#include <seqan3/std/filesystem>
+
+#ifdef SEQAN3_HAS_ZLIB
+#include <seqan3/contrib/stream/bgzf_istream.hpp>
+#include <seqan3/contrib/stream/bgzf_ostream.hpp>
+#endif
+
+namespace seqan3
+{
+
+/*!\brief A BAI/CSI index over a BGZF compressed, coordinate sorted alignment file.
+ * \ingroup alignment_file
+ *
+ * \details
+ *
+ * The index maps genomic regions to **BGZF virtual file offsets** (the offset of a compressed block
+ * in the file shifted left by 16 bits, combined with the offset inside the decompressed block).
+ * It is compatible with the `.bai` and `.csi` files written by `samtools index`:
+ *
+ *   * **BAI**: the classic binning index with a fixed layout (bins of 5 levels over 16kbp windows
+ *     plus a linear index of 16kbp windows); limited to references shorter than 2^29 bases.
+ *   * **CSI**: the generalised index with configurable `min_shift` and `depth`; stored
+ *     BGZF compressed and therefore only available when built with zlib support.
+ *
+ * An index can be read from an existing file via load() and written via save(). The central query is
+ * query_min_offset(), which returns the smallest virtual offset at which a record overlapping the
+ * given region can start; it is consumed by seqan3::alignment_file_input::fetch() to seek there and
+ * then scan forward only while records can still intersect the region.
+ */
+class bam_index
+{
+public:
+    //!\brief A half-open interval of BGZF virtual file offsets covering records of one bin.
+    struct chunk_t
+    {
+        uint64_t begin{}; //!< Virtual offset of the first record of the chunk.
+        uint64_t end{};   //!< Virtual offset right after the last record of the chunk.
+    };
+
+    //!\brief The chunks of one bin of the binning scheme.
+    struct bin_t
+    {
+        //!\brief Virtual offset of the first record overlapping the bin's interval (CSI only; 0 in BAI).
+        uint64_t linear_offset{};
+        //!\brief The chunks of the bin, sorted by begin offset.
+        std::vector<chunk_t> chunks{};
+    };
+
+    //!\brief The index data of a single reference sequence.
+    struct reference_index_t
+    {
+        //!\brief Maps bin numbers to their chunks.
+        std::map<uint32_t, bin_t> bins{};
+        //!\brief Smallest virtual offset of each 2^min_shift window (filled for BAI, empty for CSI).
+        std::vector<uint64_t> linear_index{};
+    };
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    bam_index()                              = default; //!< Defaulted.
+    bam_index(bam_index const &)             = default; //!< Defaulted.
+    bam_index & operator=(bam_index const &) = default; //!< Defaulted.
+    bam_index(bam_index &&)                  = default; //!< Defaulted.
+    bam_index & operator=(bam_index &&)      = default; //!< Defaulted.
+    ~bam_index()                             = default; //!< Defaulted.
+
+    /*!\brief Construct from per-reference index data.
+     * \param[in] refs      The index data, one element per reference (in header order).
+     * \param[in] min_shift Bits of the smallest bin size (14 in BAI, i.e. 16kbp bins).
+     * \param[in] depth     Number of binning levels below the top-level bin (5 in BAI).
+     */
+    explicit bam_index(std::vector<reference_index_t> refs, int32_t const min_shift = 14, int32_t const depth = 5) :
+        min_shift_{min_shift}, depth_{depth}, refs_{std::move(refs)}
+    {}
+    //!\}
+
+    /*!\brief Read the index from a `.bai` or `.csi` file (detected by its magic bytes).
+     * \param[in] index_path Path to the index file.
+     * \throws seqan3::file_open_error If the file could not be opened, or if it is a CSI file and
+     *                                 the library was built without zlib support.
+     * \throws seqan3::parse_error If the file is not a valid BAI/CSI index.
+     */
+    void load(std::filesystem::path const & index_path)
+    {
+        std::ifstream stream{index_path, std::ios::binary};
+        if (!stream.good())
+            throw file_open_error{"Could not open index file " + index_path.string() + " for reading."};
+
+        // CSI indexes are themselves BGZF compressed; peek for the gzip magic bytes
+        if ((stream.peek() & 0xff) == 0x1f)
+        {
+#ifdef SEQAN3_HAS_ZLIB
+            contrib::bgzf_istream decompressed{stream};
+            parse(decompressed, index_path.string());
+#else
+            throw file_open_error{"The index file " + index_path.string() +
+                                  " is compressed, but the library was built without zlib support."};
+#endif
+        }
+        else
+        {
+            parse(stream, index_path.string());
+        }
+    }
+
+    /*!\brief Write the index to a file; a `.csi` extension selects the CSI format, everything else BAI.
+     * \param[in] index_path Path to the index file.
+     * \throws seqan3::file_open_error If the file could not be opened, or if the CSI format was
+     *                                 requested and the library was built without zlib support.
+     */
+    void save(std::filesystem::path const & index_path) const
+    {
+        std::ofstream stream{index_path, std::ios::binary};
+        if (!stream.good())
+            throw file_open_error{"Could not open index file " + index_path.string() + " for writing."};
+
+        if (index_path.extension() == ".csi")
+        {
+#ifdef SEQAN3_HAS_ZLIB
+            contrib::bgzf_ostream compressed{stream};
+            write_csi(compressed);
+#else
+            throw file_open_error{"Cannot write the compressed index file " + index_path.string() +
+                                  " because the library was built without zlib support."};
+#endif
+        }
+        else
+        {
+            write_bai(stream);
+        }
+    }
+
+    /*!\brief The smallest virtual offset at which a record overlapping the region can start.
+     * \param[in] ref_id Position of the reference in the file's header.
+     * \param[in] beg    Begin of the region (0-based, inclusive).
+     * \param[in] end    End of the region (0-based, exclusive).
+     * \returns The virtual offset to seek to, or std::nullopt if no record overlaps the region.
+     *
+     * \details
+     *
+     * Collects the chunks of all bins that can hold records overlapping `[beg, end)` and lower-bounds
+     * them with the linear index (BAI) or the closest ancestor bin's `loffset` (CSI): chunks that end
+     * before that offset cannot contain overlapping records and are dropped.
+     */
+    std::optional<uint64_t> query_min_offset(size_t const ref_id, int32_t const beg, int32_t const end) const
+    {
+        if (ref_id >= refs_.size() || beg >= end || beg < 0)
+            return std::nullopt;
+
+        reference_index_t const & ref = refs_[ref_id];
+
+        // lower bound on the virtual offset of records at position >= beg
+        uint64_t min_offset = 0;
+        if (!ref.linear_index.empty()) // BAI: look up the 2^min_shift window that contains beg
+        {
+            size_t const window = std::min<size_t>(static_cast<size_t>(beg) >> min_shift_,
+                                                   ref.linear_index.size() - 1);
+            min_offset = ref.linear_index[window];
+        }
+        else // CSI: take the loffset of the closest (grand-)parent bin present in the index
+        {
+            for (uint32_t bin = leaf_bin(beg); ; bin = (bin - 1) >> 3)
+            {
+                if (auto it = ref.bins.find(bin); it != ref.bins.end())
+                {
+                    min_offset = it->second.linear_offset;
+                    break;
+                }
+
+                if (bin == 0)
+                    break;
+            }
+        }
+
+        std::optional<uint64_t> best{};
+        for (uint32_t const bin : reg2bins(beg, end))
+        {
+            auto it = ref.bins.find(bin);
+            if (it == ref.bins.end())
+                continue;
+
+            for (chunk_t const & chunk : it->second.chunks)
+            {
+                if (chunk.end <= min_offset) // lies entirely before any record that can overlap
+                    continue;
+
+                uint64_t const candidate = std::max(chunk.begin, min_offset);
+                if (!best.has_value() || candidate < *best)
+                    best = candidate;
+            }
+        }
+
+        return best;
+    }
+
+    //!\brief The number of references covered by the index.
+    size_t size() const
+    {
+        return refs_.size();
+    }
+
+    //!\brief Whether the index is empty.
+    bool empty() const
+    {
+        return refs_.empty();
+    }
+
+    //!\brief Return the index data of the reference at the given position (in header order).
+    reference_index_t const & operator[](size_t const i) const
+    {
+        return refs_[i];
+    }
+
+    //!\brief Bits of the smallest bin size.
+    int32_t min_shift() const
+    {
+        return min_shift_;
+    }
+
+    //!\brief Number of binning levels below the top-level bin.
+    int32_t depth() const
+    {
+        return depth_;
+    }
+
+    //!\brief Remove all references from the index.
+    void clear()
+    {
+        refs_.clear();
+        min_shift_ = 14;
+        depth_ = 5;
+        aux_.clear();
+        n_no_coor_.reset();
+    }
+
+private:
+    //!\brief Read an integer stored in little endian byte order.
+    template <typename int_t>
+    static int_t read_le(std::istream & stream)
+    {
+        std::array<unsigned char, sizeof(int_t)> bytes{};
+        stream.read(reinterpret_cast<char *>(bytes.data()), bytes.size());
+        if (!stream.good() || static_cast<size_t>(stream.gcount()) != bytes.size())
+            throw parse_error{"The alignment index file ended unexpectedly."};
+
+        uint64_t value = 0;
+        for (size_t i = 0; i < bytes.size(); ++i)
+            value |= static_cast<uint64_t>(bytes[i]) << (8 * i);
+
+        return static_cast<int_t>(value);
+    }
+
+    //!\brief Write an integer in little endian byte order.
+    template <typename int_t>
+    static void write_le(std::ostream & stream, int_t const value)
+    {
+        auto const unsigned_value = static_cast<std::make_unsigned_t<int_t>>(value);
+        for (size_t i = 0; i < sizeof(int_t); ++i)
+            stream.put(static_cast<char>((unsigned_value >> (8 * i)) & 0xffu));
+    }
+
+    //!\brief Detect BAI vs CSI by the magic bytes and parse the rest of the stream.
+    void parse(std::istream & stream, std::string const & path_string)
+    {
+        clear();
+
+        std::array<char, 4> magic{};
+        stream.read(magic.data(), magic.size());
+        if (static_cast<size_t>(stream.gcount()) != magic.size())
+            throw parse_error{"The index file " + path_string + " ended unexpectedly."};
+
+        if (magic == std::array<char, 4>{'B', 'A', 'I', '\1'})
+            parse_bai(stream);
+        else if (magic == std::array<char, 4>{'C', 'S', 'I', '\1'})
+            parse_csi(stream);
+        else
+            throw parse_error{"The file " + path_string + " is neither a BAI nor a CSI index."};
+    }
+
+    //!\brief Parse a BAI index (after the magic bytes).
+    void parse_bai(std::istream & stream)
+    {
+        min_shift_ = 14; // the BAI binning scheme is fixed
+        depth_ = 5;
+
+        int32_t const n_ref = read_le<int32_t>(stream);
+        refs_.resize(n_ref);
+
+        for (reference_index_t & ref : refs_)
+        {
+            int32_t const n_bin = read_le<int32_t>(stream);
+            for (int32_t b = 0; b < n_bin; ++b)
+            {
+                uint32_t const bin_number = read_le<uint32_t>(stream);
+                bin_t & bin = ref.bins[bin_number];
+
+                int32_t const n_chunk = read_le<int32_t>(stream);
+                bin.chunks.resize(n_chunk);
+                for (chunk_t & chunk : bin.chunks)
+                {
+                    chunk.begin = read_le<uint64_t>(stream);
+                    chunk.end = read_le<uint64_t>(stream);
+                }
+            }
+
+            int32_t const n_intv = read_le<int32_t>(stream);
+            ref.linear_index.resize(n_intv);
+            for (uint64_t & offset : ref.linear_index)
+                offset = read_le<uint64_t>(stream);
+        }
+
+        // the number of unplaced reads is optional trailing data
+        if (stream.peek() != std::char_traits<char>::eof())
+            n_no_coor_ = read_le<uint64_t>(stream);
+    }
+
+    //!\brief Parse a CSI index (after the magic bytes).
+    void parse_csi(std::istream & stream)
+    {
+        min_shift_ = read_le<int32_t>(stream);
+        depth_ = read_le<int32_t>(stream);
+
+        int32_t const l_aux = read_le<int32_t>(stream);
+        aux_.resize(l_aux);
+        stream.read(aux_.data(), l_aux);
+        if (static_cast<size_t>(stream.gcount()) != aux_.size())
+            throw parse_error{"The alignment index file ended unexpectedly."};
+
+        int32_t const n_ref = read_le<int32_t>(stream);
+        refs_.resize(n_ref);
+
+        for (reference_index_t & ref : refs_)
+        {
+            int32_t const n_bin = read_le<int32_t>(stream);
+            for (int32_t b = 0; b < n_bin; ++b)
+            {
+                uint32_t const bin_number = read_le<uint32_t>(stream);
+                bin_t & bin = ref.bins[bin_number];
+                bin.linear_offset = read_le<uint64_t>(stream);
+
+                int32_t const n_chunk = read_le<int32_t>(stream);
+                bin.chunks.resize(n_chunk);
+                for (chunk_t & chunk : bin.chunks)
+                {
+                    chunk.begin = read_le<uint64_t>(stream);
+                    chunk.end = read_le<uint64_t>(stream);
+                }
+            }
+        }
+
+        if (stream.peek() != std::char_traits<char>::eof())
+            n_no_coor_ = read_le<uint64_t>(stream);
+    }
+
+    //!\brief Write the index in the BAI format.
+    void write_bai(std::ostream & stream) const
+    {
+        stream.write("BAI\1", 4);
+        write_le<int32_t>(stream, refs_.size());
+
+        for (reference_index_t const & ref : refs_)
+        {
+            write_le<int32_t>(stream, ref.bins.size());
+            for (auto const & [bin_number, bin] : ref.bins)
+            {
+                write_le<uint32_t>(stream, bin_number);
+                write_le<int32_t>(stream, bin.chunks.size());
+                for (chunk_t const & chunk : bin.chunks)
+                {
+                    write_le<uint64_t>(stream, chunk.begin);
+                    write_le<uint64_t>(stream, chunk.end);
+                }
+            }
+
+            write_le<int32_t>(stream, ref.linear_index.size());
+            for (uint64_t const offset : ref.linear_index)
+                write_le<uint64_t>(stream, offset);
+        }
+
+        if (n_no_coor_.has_value())
+            write_le<uint64_t>(stream, *n_no_coor_);
+    }
+
+    //!\brief Write the index in the CSI format (without the BGZF compression layer).
+    void write_csi(std::ostream & stream) const
+    {
+        stream.write("CSI\1", 4);
+        write_le<int32_t>(stream, min_shift_);
+        write_le<int32_t>(stream, depth_);
+        write_le<int32_t>(stream, aux_.size());
+        stream.write(aux_.data(), aux_.size());
+        write_le<int32_t>(stream, refs_.size());
+
+        for (reference_index_t const & ref : refs_)
+        {
+            write_le<int32_t>(stream, ref.bins.size());
+            for (auto const & [bin_number, bin] : ref.bins)
+            {
+                write_le<uint32_t>(stream, bin_number);
+                write_le<uint64_t>(stream, bin.linear_offset);
+                write_le<int32_t>(stream, bin.chunks.size());
+                for (chunk_t const & chunk : bin.chunks)
+                {
+                    write_le<uint64_t>(stream, chunk.begin);
+                    write_le<uint64_t>(stream, chunk.end);
+                }
+            }
+        }
+
+        if (n_no_coor_.has_value())
+            write_le<uint64_t>(stream, *n_no_coor_);
+    }
+
+    //!\brief The bin number of the smallest bin containing the given position.
+    uint32_t leaf_bin(int32_t const position) const
+    {
+        return ((1u << (depth_ * 3)) - 1) / 7 + (static_cast<uint32_t>(position) >> min_shift_);
+    }
+
+    //!\brief The numbers of all bins whose interval overlaps the region `[beg, end)`.
+    std::vector<uint32_t> reg2bins(int32_t const beg, int32_t end) const
+    {
+        std::vector<uint32_t> bins{};
+
+        int32_t s = min_shift_ + depth_ * 3; // bit width of the top-level bin
+        for (int32_t l = 0, t = 0; l <= depth_; s -= 3, t += 1 << (l * 3), ++l)
+            for (int32_t i = t + (beg >> s); i <= t + ((end - 1) >> s); ++i)
+                bins.push_back(static_cast<uint32_t>(i));
+
+        return bins;
+    }
+
+    //!\brief Bits of the smallest bin size (14 in BAI).
+    int32_t min_shift_{14};
+    //!\brief Number of binning levels below the top-level bin (5 in BAI).
+    int32_t depth_{5};
+    //!\brief The index data, one element per reference in header order.
+    std::vector<reference_index_t> refs_;
+    //!\brief Auxiliary data of a CSI index, preserved verbatim for round-trips.
+    std::string aux_;
+    //!\brief The number of unplaced reads, if the index records it.
+    std::optional<uint64_t> n_no_coor_;
+};
+
+} // namespace seqan3
@@ -0,0 +1,390 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides low-level decoding primitives for the CRAM format (ITF8/LTF8 integers, bit streams and
+ *        block compression codecs).
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <seqan3/core/platform.hpp>
+#include <seqan3/io/exception.hpp>
+
+#ifdef SEQAN3_HAS_ZLIB
+#include <zlib.h>
+#endif
+
+namespace seqan3::detail
+{
+
+/*!\brief A consuming cursor over the in-memory bytes of a CRAM structure.
+ * \ingroup alignment_file
+ *
+ * \details
+ *
+ * All CRAM structures (container headers, blocks, data series, ...) are parsed from byte buffers through
+ * this cursor; every accessor throws seqan3::format_error when the buffer is exhausted, so callers do not
+ * need to bounds-check manually.
+ */
+class cram_data_cursor
+{
+public:
+    cram_data_cursor() = default;                                    //!< Defaulted.
+    cram_data_cursor(cram_data_cursor const &) = default;            //!< Defaulted.
+    cram_data_cursor(cram_data_cursor &&) = default;                 //!< Defaulted.
+    cram_data_cursor & operator=(cram_data_cursor const &) = default;//!< Defaulted.
+    cram_data_cursor & operator=(cram_data_cursor &&) = default;     //!< Defaulted.
+    ~cram_data_cursor() = default;                                   //!< Defaulted.
+
+    //!\brief Construct from the buffer to consume (the buffer is referenced, not copied).
+    explicit cram_data_cursor(std::string_view const buffer) : buffer_{buffer}
+    {}
+
+    //!\brief Whether all bytes have been consumed.
+    bool at_end() const noexcept
+    {
+        return buffer_.empty();
+    }
+
+    //!\brief The number of bytes left.
+    size_t size() const noexcept
+    {
+        return buffer_.size();
+    }
+
+    //!\brief Returns the remaining bytes without consuming them (e.g. for checksum computations).
+    std::string_view remaining() const noexcept
+    {
+        return buffer_;
+    }
+
+    //!\brief Consumes and returns `count` bytes.
+    std::string_view take(size_t const count)
+    {
+        if (buffer_.size() < count)
+            throw format_error{"[CORRUPTED CRAM FILE] Unexpected end of data while parsing a structure."};
+
+        std::string_view const bytes = buffer_.substr(0, count);
+        buffer_.remove_prefix(count);
+        return bytes;
+    }
+
+    //!\brief Consumes and returns one byte.
+    uint8_t take_byte()
+    {
+        return static_cast<uint8_t>(take(1)[0]);
+    }
+
+    //!\brief Consumes and returns one little-endian encoded 32 bit value.
+    uint32_t take_uint32_le()
+    {
+        uint32_t value{};
+        std::memcpy(&value, take(sizeof(value)).data(), sizeof(value)); // the platform is little-endian
+        return value;
+    }
+
+    //!\brief Consumes and returns one ITF8 encoded integer (1-5 bytes, up to 32 bits).
+    int32_t take_itf8()
+    {
+        uint32_t const b0 = take_byte();
+
+        if (b0 < 0x80)
+            return static_cast<int32_t>(b0);
+        else if (b0 < 0xC0)
+            return static_cast<int32_t>(((b0 & 0x3Fu) << 8) | take_byte());
+        else if (b0 < 0xE0)
+            return static_cast<int32_t>(((b0 & 0x1Fu) << 16) | (take_byte() << 8) | take_byte());
+        else if (b0 < 0xF0)
+            return static_cast<int32_t>(((b0 & 0x0Fu) << 24) | (take_byte() << 16) | (take_byte() << 8) | take_byte());
+        else
+            return static_cast<int32_t>(((b0 & 0x0Fu) << 28) | (take_byte() << 20) | (take_byte() << 12) |
+                                        (take_byte() << 4) | (take_byte() & 0x0Fu));
+    }
+
+    //!\brief Consumes and returns one LTF8 encoded integer (1-9 bytes, up to 64 bits).
+    int64_t take_ltf8()
+    {
+        uint64_t const b0 = take_byte();
+
+        // the number of leading 1 bits of the first byte equals the number of additional bytes
+        size_t extra_bytes = 0;
+        while ((extra_bytes < 8) && ((b0 >> (7 - extra_bytes)) & 1u))
+            ++extra_bytes;
+
+        uint64_t value = (extra_bytes < 8) ? (b0 & ((1u << (7 - extra_bytes)) - 1)) : 0u;
+        for (size_t i = 0; i < extra_bytes; ++i)
+            value = (value << 8) | take_byte();
+
+        return static_cast<int64_t>(value);
+    }
+
+private:
+    //!\brief The remaining bytes.
+    std::string_view buffer_{};
+};
+
+/*!\brief A most-significant-bit-first bit reader over the core data block of a CRAM slice.
+ * \ingroup alignment_file
+ */
+class cram_bit_reader
+{
+public:
+    cram_bit_reader() = default;                                   //!< Defaulted.
+    cram_bit_reader(cram_bit_reader const &) = default;            //!< Defaulted.
+    cram_bit_reader(cram_bit_reader &&) = default;                 //!< Defaulted.
+    cram_bit_reader & operator=(cram_bit_reader const &) = default;//!< Defaulted.
+    cram_bit_reader & operator=(cram_bit_reader &&) = default;     //!< Defaulted.
+    ~cram_bit_reader() = default;                                  //!< Defaulted.
+
+    //!\brief Construct from the buffer to consume (the buffer is referenced, not copied).
+    explicit cram_bit_reader(std::string_view const buffer) : buffer_{buffer}
+    {}
+
+    //!\brief Consumes and returns a single bit.
+    bool read_bit()
+    {
+        if (byte_position_ >= buffer_.size())
+            throw format_error{"[CORRUPTED CRAM FILE] Unexpected end of the core data block."};
+
+        bool const bit = (static_cast<uint8_t>(buffer_[byte_position_]) >> bit_position_) & 1u;
+
+        if (bit_position_ == 0)
+        {
+            bit_position_ = 7;
+            ++byte_position_;
+        }
+        else
+        {
+            --bit_position_;
+        }
+
+        return bit;
+    }
+
+    //!\brief Consumes `count` bits (up to 32) and returns them with the first bit read as the highest bit.
+    uint32_t read_bits(size_t const count)
+    {
+        uint32_t value{};
+        for (size_t i = 0; i < count; ++i)
+            value = (value << 1) | read_bit();
+        return value;
+    }
+
+private:
+    std::string_view buffer_{};   //!< The bytes of the core data block.
+    size_t byte_position_{0};     //!< The current byte.
+    uint8_t bit_position_{7};     //!< The next bit inside the current byte (7 = highest).
+};
+
+#ifdef SEQAN3_HAS_ZLIB
+/*!\brief Decompresses one gzip-compressed CRAM block.
+ * \ingroup alignment_file
+ * \param[in] compressed        The compressed bytes.
+ * \param[in] uncompressed_size The expected size of the decompressed data.
+ * \throws seqan3::format_error on malformed compressed data or a size mismatch.
+ */
+inline std::string cram_inflate_gzip(std::string_view const compressed, size_t const uncompressed_size)
+{
+    std::string out(uncompressed_size, '\0');
+
+    z_stream zip_stream{};
+    zip_stream.next_in   = reinterpret_cast<Bytef *>(const_cast<char *>(compressed.data()));
+    zip_stream.avail_in  = compressed.size();
+    zip_stream.next_out  = reinterpret_cast<Bytef *>(out.data());
+    zip_stream.avail_out = out.size();
+
+    if (inflateInit2(&zip_stream, 15 + 32) != Z_OK) // accept gzip and zlib wrapped data
+        throw format_error{"Could not initialise the zlib decompression stream."};
+
+    int const status = inflate(&zip_stream, Z_FINISH);
+    size_t const produced = out.size() - zip_stream.avail_out;
+    inflateEnd(&zip_stream);
+
+    if (status != Z_STREAM_END || produced != uncompressed_size)
+        throw format_error{"[CORRUPTED CRAM FILE] Malformed gzip-compressed block."};
+
+    return out;
+}
+#endif // SEQAN3_HAS_ZLIB
+
+/*!\brief Decompresses one rANS (4x8) compressed CRAM block (orders 0 and 1).
+ * \ingroup alignment_file
+ * \param[in] compressed The compressed bytes (including the rANS header).
+ * \returns The decompressed bytes.
+ * \throws seqan3::format_error on malformed compressed data.
+ *
+ * \details
+ *
+ * Implements the asymmetric numeral system codec of the CRAM 3.0 specification: four interleaved 32 bit
+ * decoder states over frequency tables normalised to a total of 4096, either context-free (order-0) or
+ * conditioned on the previously decoded byte (order-1).
+ */
+inline std::string cram_rans_decompress(std::string_view const compressed)
+{
+    constexpr uint32_t total_frequency_bits = 12;                      // frequencies are normalised to 2^12
+    constexpr uint32_t lower_bound          = 1u << 23;                // renormalisation threshold
+
+    cram_data_cursor in{compressed};
+
+    uint8_t const order = in.take_byte();
+    in.take_uint32_le(); // compressed size (excluding this header); unused, the cursor bounds-checks anyway
+    uint32_t const uncompressed_size = in.take_uint32_le();
+
+    // reads one frequency table (symbol -> frequency) with run-length encoded symbol values
+    auto read_frequency_table = [] (cram_data_cursor & in, std::array<uint32_t, 256> & frequencies,
+                                    auto && on_symbol)
+    {
+        frequencies.fill(0u);
+
+        int rle = 0;
+        uint8_t symbol = in.take_byte();
+        uint8_t last_symbol = symbol;
+
+        do
+        {
+            on_symbol(symbol, in);
+            if (rle > 0)
+            {
+                --rle;
+                ++symbol;
+            }
+            else
+            {
+                symbol = in.take_byte();
+                if (symbol == static_cast<uint8_t>(last_symbol + 1))
+                    rle = in.take_byte();
+            }
+            last_symbol = symbol;
+        } while (symbol != 0);
+    };
+
+    // turns a frequency table into cumulative frequencies and a 4096-entry symbol look-up table
+    auto build_lookup = [] (std::array<uint32_t, 256> const & frequencies,
+                            std::array<uint32_t, 256> & cumulative,
+                            std::vector<uint8_t> & lookup)
+    {
+        uint32_t running = 0;
+        for (size_t s = 0; s < 256; ++s)
+        {
+            cumulative[s] = running;
+            running += frequencies[s];
+        }
+
+        if (running > (1u << total_frequency_bits))
+            throw format_error{"[CORRUPTED CRAM FILE] rANS frequencies exceed the expected total."};
+
+        lookup.assign(1u << total_frequency_bits, 0u);
+        for (size_t s = 0; s < 256; ++s)
+            for (uint32_t f = 0; f < frequencies[s]; ++f)
+                lookup[cumulative[s] + f] = static_cast<uint8_t>(s);
+    };
+
+    auto advance_state = [&] (uint32_t & state, cram_data_cursor & in,
+                              std::array<uint32_t, 256> const & frequencies,
+                              std::array<uint32_t, 256> const & cumulative,
+                              std::vector<uint8_t> const & lookup) -> uint8_t
+    {
+        uint32_t const f = state & ((1u << total_frequency_bits) - 1);
+        uint8_t const symbol = lookup[f];
+
+        state = frequencies[symbol] * (state >> total_frequency_bits) + f - cumulative[symbol];
+        while (state < lower_bound)
+            state = (state << 8) | in.take_byte();
+
+        return symbol;
+    };
+
+    std::string out(uncompressed_size, '\0');
+
+    if (order == 0)
+    {
+        std::array<uint32_t, 256> frequencies{};
+        read_frequency_table(in, frequencies, [&frequencies] (uint8_t const symbol, cram_data_cursor & in)
+        {
+            frequencies[symbol] = static_cast<uint32_t>(in.take_itf8());
+        });
+
+        std::array<uint32_t, 256> cumulative{};
+        std::vector<uint8_t> lookup{};
+        build_lookup(frequencies, cumulative, lookup);
+
+        std::array<uint32_t, 4> states{};
+        for (auto & state : states)
+            state = in.take_uint32_le();
+
+        for (size_t i = 0; i < uncompressed_size; ++i)
+            out[i] = advance_state(states[i % 4], in, frequencies, cumulative, lookup);
+    }
+    else if (order == 1)
+    {
+        // one frequency table per context (the previously decoded byte)
+        std::vector<std::array<uint32_t, 256>> frequencies(256);
+        std::vector<std::array<uint32_t, 256>> cumulative(256);
+        std::vector<std::vector<uint8_t>> lookup(256);
+        for (auto & table : frequencies)
+            table.fill(0u);
+
+        read_frequency_table(in, frequencies[0] /*unused dummy*/,
+                             [&] (uint8_t const context, cram_data_cursor & in)
+        {
+            read_frequency_table(in, frequencies[context],
+                                 [&, context] (uint8_t const symbol, cram_data_cursor & in)
+            {
+                frequencies[context][symbol] = static_cast<uint32_t>(in.take_itf8());
+            });
+            build_lookup(frequencies[context], cumulative[context], lookup[context]);
+        });
+
+        std::array<uint32_t, 4> states{};
+        for (auto & state : states)
+            state = in.take_uint32_le();
+
+        // the output is split into four equally sized parts, each decoded by one state with its own context
+        size_t const quarter = uncompressed_size / 4;
+        std::array<size_t, 4> positions{0 * quarter, 1 * quarter, 2 * quarter, 3 * quarter};
+        std::array<uint8_t, 4> contexts{};
+
+        for (size_t i = 0; i < quarter; ++i)
+        {
+            for (size_t j = 0; j < 4; ++j)
+            {
+                uint8_t const symbol = advance_state(states[j], in,
+                                                     frequencies[contexts[j]],
+                                                     cumulative[contexts[j]],
+                                                     lookup[contexts[j]]);
+                out[positions[j]++] = symbol;
+                contexts[j] = symbol;
+            }
+        }
+
+        while (positions[3] < uncompressed_size) // the remainder is decoded by the last state
+        {
+            uint8_t const symbol = advance_state(states[3], in,
+                                                 frequencies[contexts[3]],
+                                                 cumulative[contexts[3]],
+                                                 lookup[contexts[3]]);
+            out[positions[3]++] = symbol;
+            contexts[3] = symbol;
+        }
+    }
+    else
+    {
+        throw format_error{"[CORRUPTED CRAM FILE] Unknown rANS order (only orders 0 and 1 exist)."};
+    }
+
+    return out;
+}
+
+} // namespace seqan3::detail
@@ -12,7 +12,10 @@
 
 #pragma once
 
+#include <limits>
 #include <sstream>
+#include <utility>
+#include <vector>
 
 #include <seqan3/alignment/aligned_sequence/aligned_sequence_concept.hpp>
 #include <seqan3/core/concept/tuple.hpp>
@@ -37,6 +40,135 @@ struct view_equality_fn
     }
 };
 
+/*!\brief A map from reference name to reference index with contiguous storage.
+ * \ingroup alignment_file
+ * \tparam key_t    The key type; compared through seqan3::detail::view_equality_fn and hashed through std::hash.
+ * \tparam mapped_t The mapped type.
+ *
+ * \details
+ *
+ * Provides the subset of the std::unordered_map interface that the alignment file header uses. The entries
+ * are kept in one contiguous vector in insertion order and found through an open addressing hash index, i.e.
+ * neither insertions nor lookups allocate per entry as node based maps do — with the many thousand references
+ * of e.g. metagenomic assemblies this is considerably faster to fill and to query.
+ */
+template <typename key_t, typename mapped_t>
+class flat_reference_dictionary
+{
+public:
+    //!\brief The key type.
+    using key_type = key_t;
+    //!\brief The mapped type.
+    using mapped_type = mapped_t;
+    //!\brief The entry type.
+    using value_type = std::pair<key_t, mapped_t>;
+    //!\brief Iterator over the entries in insertion order.
+    using iterator = typename std::vector<value_type>::iterator;
+    //!\brief Const iterator over the entries in insertion order.
+    using const_iterator = typename std::vector<value_type>::const_iterator;
+
+    /*!\name Iterators
+     * \{
+     */
+    //!\brief Returns an iterator to the first entry (insertion order).
+    iterator begin() noexcept { return entries.begin(); }
+    //!\copydoc begin()
+    const_iterator begin() const noexcept { return entries.begin(); }
+    //!\brief Returns an iterator behind the last entry.
+    iterator end() noexcept { return entries.end(); }
+    //!\copydoc end()
+    const_iterator end() const noexcept { return entries.end(); }
+    //!\}
+
+    //!\brief Returns the number of entries.
+    size_t size() const noexcept { return entries.size(); }
+
+    //!\brief Returns whether the dictionary holds no entries.
+    bool empty() const noexcept { return entries.empty(); }
+
+    //!\brief Removes all entries.
+    void clear() noexcept
+    {
+        entries.clear();
+        slots.clear();
+    }
+
+    //!\brief Returns an iterator to the entry of the given key or end() if the key is not present.
+    iterator find(key_type const & key)
+    {
+        size_t const idx = locate(key);
+        return idx == npos ? entries.end() : entries.begin() + idx;
+    }
+
+    //!\copydoc find()
+    const_iterator find(key_type const & key) const
+    {
+        size_t const idx = locate(key);
+        return idx == npos ? entries.end() : entries.begin() + idx;
+    }
+
+    //!\brief Returns the number of entries of the given key (0 or 1).
+    size_t count(key_type const & key) const
+    {
+        return locate(key) == npos ? 0u : 1u;
+    }
+
+    //!\brief Returns a reference to the value of the given key; a missing key is value initialised first.
+    mapped_type & operator[](key_type const & key)
+    {
+        if (size_t const idx = locate(key); idx != npos)
+            return entries[idx].second;
+
+        if ((entries.size() + 1) * 2 > slots.size()) // keep the load factor of the hash index below 50 %
+            grow();
+
+        entries.emplace_back(key, mapped_type{});
+        place(entries.size() - 1);
+        return entries.back().second;
+    }
+
+private:
+    //!\brief Marks an empty slot of the hash index and a failed lookup.
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+    //!\brief The entries in insertion order.
+    std::vector<value_type> entries{};
+    //!\brief The hash index; holds positions into `entries`. The size is always a power of two.
+    std::vector<size_t> slots{};
+
+    //!\brief Returns the position of the key's entry or npos; linear probing over the hash index.
+    size_t locate(key_type const & key) const
+    {
+        if (slots.empty())
+            return npos;
+
+        for (size_t slot = std::hash<key_type>{}(key) & (slots.size() - 1);; slot = (slot + 1) & (slots.size() - 1))
+        {
+            if (slots[slot] == npos)
+                return npos;
+            if (view_equality_fn{}(entries[slots[slot]].first, key))
+                return slots[slot];
+        }
+    }
+
+    //!\brief Writes the given entry position into the first free slot of its probe sequence.
+    void place(size_t const idx)
+    {
+        size_t slot = std::hash<key_type>{}(entries[idx].first) & (slots.size() - 1);
+        while (slots[slot] != npos)
+            slot = (slot + 1) & (slots.size() - 1);
+        slots[slot] = idx;
+    }
+
+    //!\brief Doubles the hash index and redistributes all entries.
+    void grow()
+    {
+        slots.assign(std::max<size_t>(16u, 2 * slots.size()), npos);
+        for (size_t idx = 0; idx < entries.size(); ++idx)
+            place(idx);
+    }
+};
+
 /*!\brief Compares two aligned sequence values and returns their CIGAR operation.
  * \ingroup alignment_file
  * \tparam reference_char_type Must be equality comparable to seqan3::gap.
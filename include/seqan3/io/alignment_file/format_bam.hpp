@@ -0,0 +1,1074 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides the seqan3::alignment_file_format_bam class.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <range/v3/view/repeat_n.hpp>
+
+#include <seqan3/core/concept/core_language.hpp>
+#include <seqan3/core/concept/tuple.hpp>
+#include <seqan3/core/metafunction/basic.hpp>
+#include <seqan3/core/metafunction/range.hpp>
+#include <seqan3/core/metafunction/template_inspection.hpp>
+#include <seqan3/io/alignment_file/detail.hpp>
+#include <seqan3/io/alignment_file/format_sam.hpp>
+#include <seqan3/io/alignment_file/header.hpp>
+#include <seqan3/io/alignment_file/input_options.hpp>
+#include <seqan3/io/alignment_file/output_options.hpp>
+#include <seqan3/io/alignment_file/sam_tag_dictionary.hpp>
+#include <seqan3/io/detail/misc.hpp>
+#include <seqan3/io/stream/parse_condition.hpp>
+#include <seqan3/range/view/char_to.hpp>
+#include <seqan3/range/view/slice.hpp>
+#include <seqan3/range/view/to_char.hpp>
+#include <seqan3/std/concepts>
+#include <seqan3/std/ranges>
+
+namespace seqan3
+{
+
+/*!\brief       The BAM format.
+ * \implements  alignment_file_format_concept
+ * \ingroup     alignment_file
+ *
+ * \details
+ *
+ * ### Introduction
+ *
+ * BAM is the binary counterpart of the SAM format and is the de-facto standard for storing read-to-reference
+ * alignments in production pipelines. See the official
+ * [SAM format specifications](https://samtools.github.io/hts-specs/SAMv1.pdf) (section 4) for a description
+ * of the encoding. **SeqAn implements the BAM encoding of version 1.6 of the SAM specification**.
+ *
+ * Like the official tools, this format expects/produces the BGZF-compressed representation by default: the
+ * compression is transparently handled by the stream layer (see seqan3::detail::make_secondary_istream and
+ * seqan3::detail::make_secondary_ostream), so this class itself only reads and writes the uncompressed
+ * binary container.
+ *
+ * ### Fields
+ *
+ * The BAM format provides exactly the same fields as the seqan3::alignment_file_format_sam; see there for the
+ * mapping of SAM/BAM columns to record fields. The only difference is that the reference information of
+ * records (`refID`) is stored as an index into the reference dictionary instead of a name.
+ *
+ * \attention The BAM encoding is little-endian; reading/writing on big-endian platforms is not supported.
+ *
+ * ### Header implementation
+ *
+ * The BAM header (the plain SAM header text plus the binary reference dictionary) is read/written once in the
+ * beginning before the first record is read/written. In contrast to SAM, the binary reference dictionary is
+ * mandatory, so records can only be written with reference names if the header is given.
+ */
+class alignment_file_format_bam : protected alignment_file_format_sam
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    alignment_file_format_bam() = default;                                         //!< Defaulted
+    //!\brief Copy construction is explicitly deleted, because you can't have multiple access to the same file.
+    alignment_file_format_bam(alignment_file_format_bam const &) = delete;
+    //!\brief Copy assignment is explicitly deleted, because you can't have multiple access to the same file.
+    alignment_file_format_bam & operator=(alignment_file_format_bam const &) = delete;
+    alignment_file_format_bam(alignment_file_format_bam &&) = default;             //!< Defaulted
+    alignment_file_format_bam & operator=(alignment_file_format_bam &&) = default; //!< Defaulted
+    ~alignment_file_format_bam() = default;                                        //!< Defaulted
+    //!\}
+
+    //!\brief The valid file extensions for this format; note that you can modify this value.
+    static inline std::vector<std::string> file_extensions
+    {
+        { "bam" },
+    };
+
+    //!\copydoc AlignmentFileInputFormat::read
+    template <typename stream_type,     // constraints checked by file
+              typename seq_legal_alph_type,
+              typename ref_seqs_type,
+              typename ref_ids_type,
+              typename seq_type,
+              typename id_type,
+              typename offset_type,
+              typename ref_seq_type,
+              typename ref_id_type,
+              typename ref_offset_type,
+              typename align_type,
+              typename flag_type,
+              typename mapq_type,
+              typename qual_type,
+              typename mate_type,
+              typename tag_dict_type,
+              typename e_value_type,
+              typename bit_score_type>
+    void read(stream_type                                             & stream,
+              alignment_file_input_options<seq_legal_alph_type> const & SEQAN3_DOXYGEN_ONLY(options),
+              ref_seqs_type                                           & ref_seqs,
+              alignment_file_header<ref_ids_type>                     & header,
+              seq_type                                                & seq,
+              qual_type                                               & qual,
+              id_type                                                 & id,
+              offset_type                                             & offset,
+              ref_seq_type                                            & SEQAN3_DOXYGEN_ONLY(ref_seq),
+              ref_id_type                                             & ref_id,
+              ref_offset_type                                         & ref_offset,
+              align_type                                              & align,
+              flag_type                                               & flag,
+              mapq_type                                               & mapq,
+              mate_type                                               & mate,
+              tag_dict_type                                           & tag_dict,
+              e_value_type                                            & SEQAN3_DOXYGEN_ONLY(e_value),
+              bit_score_type                                          & SEQAN3_DOXYGEN_ONLY(bit_score))
+    {
+        static_assert(detail::decays_to_ignore_v<ref_offset_type> ||
+                      detail::is_type_specialisation_of_v<ref_offset_type, std::optional>,
+                      "The ref_offset must be a specialisation of std::optional.");
+
+        using stream_buf_t = std::istreambuf_iterator<typename stream_type::char_type>;
+
+        // Header
+        // -------------------------------------------------------------------------------------------------------------
+        if (!header_was_read)
+        {
+            read_header(stream, header, ref_seqs);
+            header_was_read = true;
+
+            if (stream_buf_t{stream} == stream_buf_t{}) // file has no records
+                return;
+        }
+
+        // these variables need to be stored to compute the ALIGNMENT
+        [[maybe_unused]] int32_t offset_tmp{};
+        [[maybe_unused]] int32_t soft_clipping_end{};
+        std::vector<std::pair<char, size_t>> cigar{};
+        [[maybe_unused]] int32_t ref_length{0}, seq_length{0}; // length of aligned part for ref and query
+
+        // Fixed-length part of the record
+        // -------------------------------------------------------------------------------------------------------------
+        int32_t block_size{}, ref_id_raw{}, position{}, l_seq{}, next_ref_id_raw{}, next_position{}, tlen{};
+        uint8_t l_read_name{}, mapq_raw{};
+        uint16_t bin{}, n_cigar_op{}, flag_raw{};
+
+        read_integral_field(stream, block_size);
+        read_integral_field(stream, ref_id_raw);
+        read_integral_field(stream, position);
+        read_integral_field(stream, l_read_name);
+        read_integral_field(stream, mapq_raw);
+        read_integral_field(stream, bin);
+        (void) bin; // the BAI bin is recomputed on write and not exposed as a field
+        read_integral_field(stream, n_cigar_op);
+        read_integral_field(stream, flag_raw);
+        read_integral_field(stream, l_seq);
+        read_integral_field(stream, next_ref_id_raw);
+        read_integral_field(stream, next_position);
+        read_integral_field(stream, tlen);
+
+        if (!stream)
+            throw format_error{"[CORRUPTED BAM FILE] Unexpected end of stream while reading a record."};
+
+        int32_t bytes_left = block_size - 32; // the fixed-length fields after block_size sum up to 32 bytes
+
+        if (l_read_name == 0 ||
+            bytes_left < l_read_name + 4 * n_cigar_op + (l_seq + 1) / 2 + l_seq)
+            throw format_error{"[CORRUPTED BAM FILE] Invalid block_size or field lengths."};
+
+        flag = flag_raw;
+        mapq = mapq_raw;
+
+        if (ref_id_raw >= 0)
+        {
+            if (static_cast<size_t>(ref_id_raw) >= std::ranges::size(header.ref_ids()))
+                throw format_error{"[CORRUPTED BAM FILE] Reference id of a record exceeds the reference dictionary."};
+
+            ref_id = ref_id_raw;
+        }
+
+        if (position >= 0) // -1 indicates an unmapped read
+            ref_offset = position;
+
+        // read name
+        // -------------------------------------------------------------------------------------------------------------
+        std::string read_name_tmp(l_read_name - 1, '\0');
+        stream.read(read_name_tmp.data(), l_read_name - 1);
+        stream.ignore(1); // skip the NUL terminator
+        bytes_left -= l_read_name;
+
+        if constexpr (!detail::decays_to_ignore_v<id_type>)
+            if (read_name_tmp != "*")
+                std::ranges::copy(read_name_tmp | view::char_to<value_type_t<id_type>>, std::back_inserter(id));
+
+        // cigar
+        // -------------------------------------------------------------------------------------------------------------
+        for (uint16_t i = 0; i < n_cigar_op; ++i)
+        {
+            uint32_t operation_and_count{};
+            read_integral_field(stream, operation_and_count);
+
+            char const operation = cigar_operation_characters[operation_and_count & 0x0f];
+
+            if (operation == '\0')
+                throw format_error{"[CORRUPTED BAM FILE] Invalid cigar operation code."};
+
+            cigar.emplace_back(operation, operation_and_count >> 4);
+        }
+        bytes_left -= 4 * n_cigar_op;
+
+        // Hard clipping at either end is discarded, soft clipping is stored as query offsets (as for SAM).
+        if (!cigar.empty() && cigar.front().first == 'H')
+            cigar.erase(cigar.begin());
+        if (!cigar.empty() && cigar.front().first == 'S')
+        {
+            offset_tmp = cigar.front().second;
+            cigar.erase(cigar.begin());
+        }
+        if (!cigar.empty() && cigar.back().first == 'H')
+            cigar.pop_back();
+        if (!cigar.empty() && cigar.back().first == 'S')
+        {
+            soft_clipping_end = cigar.back().second;
+            cigar.pop_back();
+        }
+
+        for (auto const & [cigar_op, cigar_count] : cigar)
+        {
+            if (is_char<'M'>(cigar_op) || is_char<'='>(cigar_op) || is_char<'X'>(cigar_op))
+            {
+                ref_length += cigar_count;
+                seq_length += cigar_count;
+            }
+            else if (is_char<'D'>(cigar_op) || is_char<'N'>(cigar_op))
+            {
+                ref_length += cigar_count;
+            }
+            else if (is_char<'I'>(cigar_op))
+            {
+                seq_length += cigar_count;
+            }
+            else // S or H inside the alignment, or P
+            {
+                if (is_char<'P'>(cigar_op))
+                    throw format_error{"We do currently not support cigar operation 'P'."};
+                else
+                    throw format_error{std::string{"Illegal cigar operation: "} + std::string{cigar_op}};
+            }
+        }
+
+        offset = offset_tmp;
+
+        // sequence (4-bit packed)
+        // -------------------------------------------------------------------------------------------------------------
+        std::string packed_seq((l_seq + 1) / 2, '\0');
+        stream.read(packed_seq.data(), packed_seq.size());
+        bytes_left -= packed_seq.size();
+
+        auto constexpr is_legal_alph = is_in_alphabet<seq_legal_alph_type>;
+        auto seq_char_at = [&packed_seq, is_legal_alph] (int32_t const i) // decode and check the i-th base
+        {
+            uint8_t const code = (i % 2 == 0) ? (packed_seq[i / 2] >> 4) & 0x0f : packed_seq[i / 2] & 0x0f;
+            char const c = sequence_nibble_characters[code];
+
+            if (!is_legal_alph(c))
+                throw format_error{std::string{"Encountered an unexpected letter: "} +
+                                   is_legal_alph.msg.string() +
+                                   " evaluated to false on " +
+                                   detail::make_printable(c)};
+            return c;
+        };
+
+        if constexpr (detail::decays_to_ignore_v<seq_type>)
+        {
+            if constexpr (!detail::decays_to_ignore_v<align_type>)
+            {
+                static_assert(sequence_container_concept<std::remove_reference_t<decltype(get<1>(align))>>,
+                              "If you want to read ALIGNMENT but not SEQ, the alignment"
+                              " object must store a sequence container at the second (query) position.");
+
+                if (!cigar.empty()) // only parse alignment if cigar information was given
+                {
+                    for (int32_t i = offset_tmp; i < offset_tmp + seq_length; ++i)
+                        get<1>(align).push_back(value_type_t<decltype(get<1>(align))>{}.assign_char(seq_char_at(i)));
+                }
+                else
+                {
+                    get<1>(align) = std::remove_reference_t<decltype(get<1>(align))>{}; // empty container
+                }
+            }
+        }
+        else
+        {
+            for (int32_t i = 0; i < l_seq; ++i)
+                seq.push_back(value_type_t<seq_type>{}.assign_char(seq_char_at(i)));
+
+            if constexpr (!detail::decays_to_ignore_v<align_type>)
+            {
+                assign_unaligned(get<1>(align),
+                                 seq | view::slice(static_cast<decltype(std::ranges::size(seq))>(offset_tmp),
+                                                   std::ranges::size(seq) - soft_clipping_end));
+            }
+        }
+
+        // qualities
+        // -------------------------------------------------------------------------------------------------------------
+        std::string packed_qual(l_seq, '\0');
+        stream.read(packed_qual.data(), packed_qual.size());
+        bytes_left -= packed_qual.size();
+
+        if constexpr (!detail::decays_to_ignore_v<qual_type>)
+        {
+            if (l_seq > 0 && static_cast<uint8_t>(packed_qual[0]) != 0xff) // 0xff indicates missing qualities
+                for (int32_t i = 0; i < l_seq; ++i)
+                    qual.push_back(value_type_t<qual_type>{}.assign_char(static_cast<char>(packed_qual[i] + 33)));
+        }
+
+        // mate
+        // -------------------------------------------------------------------------------------------------------------
+        if constexpr (!detail::decays_to_ignore_v<mate_type>)
+        {
+            if (next_ref_id_raw >= 0)
+            {
+                if (static_cast<size_t>(next_ref_id_raw) >= std::ranges::size(header.ref_ids()))
+                    throw format_error{"[CORRUPTED BAM FILE] Mate reference id of a record exceeds the "
+                                       "reference dictionary."};
+
+                get<0>(mate) = next_ref_id_raw;
+            }
+
+            if (next_position >= 0) // -1 indicates an unmapped mate
+                get<1>(mate) = next_position;
+
+            get<2>(mate) = tlen;
+        }
+
+        // optional tags
+        // -------------------------------------------------------------------------------------------------------------
+        if (bytes_left < 0)
+            throw format_error{"[CORRUPTED BAM FILE] The record data exceeds its block_size."};
+
+        std::string tag_buffer(bytes_left, '\0');
+        stream.read(tag_buffer.data(), tag_buffer.size());
+
+        if (!stream)
+            throw format_error{"[CORRUPTED BAM FILE] Unexpected end of stream while reading a record."};
+
+        if constexpr (!detail::decays_to_ignore_v<tag_dict_type>)
+            read_tag_fields(tag_buffer, tag_dict);
+
+        // DONE READING - wrap up
+        // -------------------------------------------------------------------------------------------------------------
+        // Alignment object construction
+        // Note that the query sequence in get<1>(align) has already been filled while decoding the sequence.
+        if constexpr (!detail::decays_to_ignore_v<align_type>)
+        {
+            if (!cigar.empty() && !std::ranges::empty(get<1>(align))) // only parse alignment if cigar and seq was given
+            {
+                if constexpr (!detail::decays_to_ignore_v<ref_seqs_type>)
+                {
+                    // the record's reference id is an index into the reference dictionary (checked above)
+                    size_t pos = ref_id_raw;
+
+                    assert(static_cast<size_t>(position + ref_length) <= std::ranges::size(ref_seqs[pos]));
+
+                    // copy over unaligned reference sequence part
+                    assign_unaligned(get<0>(align), ref_seqs[pos] | view::slice(position, position + ref_length));
+                }
+                else
+                {
+                    using unaligned_t = remove_cvref_t<detail::unaligned_seq_t<decltype(get<0>(align))>>;
+                    auto dummy_seq    = ranges::view::repeat_n(value_type_t<unaligned_t>{}, ref_length)
+                                      | std::view::transform(detail::access_restrictor_fn{});
+                    static_assert(std::Same<unaligned_t, decltype(dummy_seq)>,
+                                  "No reference information was given so the type of the first alignment tuple position"
+                                  "must have an unaligned sequence type of a dummy sequence ("
+                                  "ranges::view::repeat_n(dna5{}, size_t{}) | "
+                                  "std::view::transform(detail::access_restrictor_fn{}))");
+
+                    assign_unaligned(get<0>(align), dummy_seq); // assign dummy sequence
+                }
+
+                // insert gaps according to the cigar information
+                detail::alignment_from_cigar(align, cigar);
+            }
+            else // not enough information for an alignment, assign an empty view/dummy_sequence
+            {
+                if constexpr (!detail::decays_to_ignore_v<ref_seqs_type>) // reference info given
+                {
+                    assert(std::ranges::size(ref_seqs) > 0); // we assume that the given ref info is not empty
+                    assign_unaligned(get<0>(align), ref_seqs[0] | view::slice(0, 0));
+                }
+                else
+                {
+                    using unaligned_t = remove_cvref_t<detail::unaligned_seq_t<decltype(get<0>(align))>>;
+                    assign_unaligned(get<0>(align), ranges::view::repeat_n(value_type_t<unaligned_t>{}, 0)
+                                                    | std::view::transform(detail::access_restrictor_fn{}));
+                }
+            }
+        }
+    }
+
+    //!\copydoc AlignmentFileOutputFormat::write
+    template <typename stream_type,
+              typename header_type,
+              typename seq_type,
+              typename id_type,
+              typename ref_seq_type,
+              typename ref_id_type,
+              typename align_type,
+              typename qual_type,
+              typename mate_type,
+              typename tag_dict_type>
+    void write(stream_type                            &  stream,
+               alignment_file_output_options const    &  options,
+               header_type                            && header,
+               seq_type                               && seq,
+               qual_type                              && qual,
+               id_type                                && id,
+               int32_t                                   offset,
+               ref_seq_type                           && SEQAN3_DOXYGEN_ONLY(ref_seq),
+               ref_id_type                            && ref_id,
+               std::optional<int32_t>                    ref_offset,
+               align_type                             && align,
+               uint16_t                                  flag,
+               uint8_t                                   mapq,
+               mate_type                              && mate,
+               tag_dict_type                          && tag_dict,
+               double                                    SEQAN3_DOXYGEN_ONLY(e_value),
+               double                                    SEQAN3_DOXYGEN_ONLY(bit_score))
+    {
+        // ---------------------------------------------------------------------
+        // Type Requirements (as static asserts for user friendliness)
+        // ---------------------------------------------------------------------
+        static_assert((std::ranges::ForwardRange<seq_type>        &&
+                      Alphabet<value_type_t<remove_cvref_t<seq_type>>>),
+                      "The seq object must be a std::ranges::ForwardRange over "
+                      "letters that model seqan3::Alphabet.");
+
+        static_assert((std::ranges::ForwardRange<id_type>         &&
+                      Alphabet<value_type_t<remove_cvref_t<id_type>>>),
+                      "The id object must be a std::ranges::ForwardRange over "
+                      "letters that model seqan3::Alphabet.");
+
+        static_assert(tuple_like_concept<remove_cvref_t<align_type>>,
+                      "The align object must be a std::pair of two ranges whose "
+                      "value_type is comparable to seqan3::gap");
+
+        static_assert((std::ranges::ForwardRange<qual_type>       &&
+                       Alphabet<value_type_t<remove_cvref_t<qual_type>>>),
+                      "The qual object must be a std::ranges::ForwardRange "
+                      "over letters that model seqan3::Alphabet.");
+
+        static_assert(tuple_like_concept<remove_cvref_t<mate_type>>,
+                      "The mate object must be a std::tuple of size 3 with "
+                      "1) a std::ranges::ForwardRange with a value_type modelling seqan3::Alphabet, "
+                      "2) a std::Integral or std::optional<std::Integral>, and "
+                      "3) a std::Integral.");
+
+        static_assert(std::Same<remove_cvref_t<tag_dict_type>, sam_tag_dictionary>,
+                      "The tag_dict object must be of type seqan3::sam_tag_dictionary.");
+
+        if (ref_offset.has_value() && (ref_offset.value() + 1) < 0)
+            throw format_error{"The ref_offset object must be an std::Integral >= 0."};
+
+        // ---------------------------------------------------------------------
+        // Writing the Header on first call
+        // ---------------------------------------------------------------------
+        if (!written_header)
+        {
+            write_header(stream, options, header);
+            written_header = true;
+        }
+
+        // ---------------------------------------------------------------------
+        // Writing the Record
+        // ---------------------------------------------------------------------
+        std::string record_data{}; // the variable-length part of the record; assembled to compute block_size
+
+        // read name
+        std::string read_name{};
+        for (auto const c : id | view::to_char)
+            read_name += c;
+        if (read_name.empty())
+            read_name = "*";
+        if (read_name.size() >= 255)
+            throw format_error{"BAM can only store read names up to a length of 254 characters."};
+
+        // cigar (computed from the alignment like for SAM)
+        std::vector<uint32_t> binary_cigar{};
+        int32_t ref_length{0};
+
+        if (!std::ranges::empty(get<0>(align)) && !std::ranges::empty(get<1>(align)))
+        {
+            // compute possible distance from alignment end to sequence end
+            // which indicates soft clipping at the end.
+            size_t off_end{std::ranges::size(seq) - offset};
+            for (auto chr : get<1>(align))
+                if (chr == gap{})
+                    ++off_end;
+            off_end -= std::ranges::size(get<1>(align));
+
+            std::tie(binary_cigar, ref_length) =
+                encode_cigar(detail::get_cigar_string(std::forward<align_type>(align), offset, off_end));
+        }
+
+        if (binary_cigar.size() > std::numeric_limits<uint16_t>::max())
+            throw format_error{"BAM can only store up to 65535 cigar operations per record."};
+
+        // reference ids and positions
+        int32_t const ref_id_index      = resolve_ref_id_index(std::forward<ref_id_type>(ref_id), header);
+        int32_t const position          = ref_offset.value_or(-1);
+        int32_t const next_ref_id_index = resolve_ref_id_index(get<0>(mate), header);
+        int32_t const next_position     = resolve_position(get<1>(mate));
+
+        int32_t const l_seq = std::ranges::distance(seq);
+
+        // fixed-length part
+        append_integral_field(record_data, ref_id_index);
+        append_integral_field(record_data, position);
+        append_integral_field(record_data, static_cast<uint8_t>(read_name.size() + 1));
+        append_integral_field(record_data, mapq);
+        append_integral_field(record_data, position < 0 ? static_cast<uint16_t>(4680) // reg2bin(-1, 0)
+                                                        : reg2bin(position, position + std::max<int32_t>(ref_length, 1)));
+        append_integral_field(record_data, static_cast<uint16_t>(binary_cigar.size()));
+        append_integral_field(record_data, flag);
+        append_integral_field(record_data, l_seq);
+        append_integral_field(record_data, next_ref_id_index);
+        append_integral_field(record_data, next_position);
+        append_integral_field(record_data, static_cast<int32_t>(get<2>(mate)));
+
+        // read name (NUL-terminated)
+        record_data += read_name;
+        record_data += '\0';
+
+        // cigar
+        for (uint32_t const operation_and_count : binary_cigar)
+            append_integral_field(record_data, operation_and_count);
+
+        // sequence (4-bit packed)
+        uint8_t packed{0};
+        int32_t i{0};
+        for (auto const c : seq | view::to_char)
+        {
+            if (i % 2 == 0)
+                packed = char_to_sequence_nibble(c) << 4;
+            else
+                record_data += static_cast<char>(packed | char_to_sequence_nibble(c));
+            ++i;
+        }
+        if (i % 2 == 1) // pad the last nibble
+            record_data += static_cast<char>(packed);
+
+        // qualities (raw phred values; 0xff indicates missing qualities)
+        if (std::ranges::empty(qual))
+        {
+            record_data.append(l_seq, static_cast<char>(0xff));
+        }
+        else
+        {
+            for (auto const q : qual)
+                record_data += static_cast<char>(to_rank(q));
+        }
+
+        // optional tags
+        write_tag_fields(record_data, tag_dict);
+
+        // record
+        append_integral_field_to_stream(stream, static_cast<int32_t>(record_data.size()));
+        stream.write(record_data.data(), record_data.size());
+    }
+
+protected:
+    //!\privatesection
+
+    //!\brief A variable that tracks whether the header has been read or not.
+    bool header_was_read{false};
+
+    //!\brief The characters of the cigar operations by their BAM operation code ('\0' for invalid codes).
+    static constexpr std::array<char, 16> cigar_operation_characters
+    {
+        'M', 'I', 'D', 'N', 'S', 'H', 'P', '=', 'X', '\0', '\0', '\0', '\0', '\0', '\0', '\0'
+    };
+
+    //!\brief The characters of the 4-bit encoded sequence alphabet by their code.
+    static constexpr std::array<char, 16> sequence_nibble_characters
+    {
+        '=', 'A', 'C', 'M', 'G', 'R', 'S', 'V', 'T', 'W', 'Y', 'H', 'K', 'D', 'B', 'N'
+    };
+
+    /*!\brief Returns the 4-bit sequence code of a character (any character without a code is encoded as 'N').
+     * \param[in] c The sequence character to encode.
+     */
+    static constexpr uint8_t char_to_sequence_nibble(char const c) noexcept
+    {
+        char const upper = (c >= 'a' && c <= 'z') ? c - ('a' - 'A') : c;
+
+        for (uint8_t code = 0; code < 16; ++code)
+            if (sequence_nibble_characters[code] == upper)
+                return code;
+        return 15; // 'N'
+    }
+
+    /*!\brief Computes the BAI bin of an alignment as described in the SAM specification.
+     * \param[in] begin The 0-based begin position of the alignment.
+     * \param[in] end   The 0-based exclusive end position of the alignment.
+     */
+    static constexpr uint16_t reg2bin(int32_t const begin, int32_t end) noexcept
+    {
+        --end;
+        if (begin >> 14 == end >> 14) return ((1 << 15) - 1) / 7 + (begin >> 14);
+        if (begin >> 17 == end >> 17) return ((1 << 12) - 1) / 7 + (begin >> 17);
+        if (begin >> 20 == end >> 20) return ((1 <<  9) - 1) / 7 + (begin >> 20);
+        if (begin >> 23 == end >> 23) return ((1 <<  6) - 1) / 7 + (begin >> 23);
+        if (begin >> 26 == end >> 26) return ((1 <<  3) - 1) / 7 + (begin >> 26);
+        return 0;
+    }
+
+    /*!\brief Reads an integral value from its little-endian binary representation.
+     * \tparam stream_t The input stream type.
+     * \tparam number_t The type of the value to read; must model std::Integral.
+     *
+     * \param[in, out] stream The input stream to read from.
+     * \param[out]     target The value to fill.
+     */
+    template <typename stream_t, std::Integral number_t>
+    void read_integral_field(stream_t & stream, number_t & target)
+    {
+        stream.read(reinterpret_cast<char *>(&target), sizeof(target)); // BAM is little-endian, as is the platform
+    }
+
+    /*!\brief Appends the little-endian binary representation of an arithmetic value to a buffer.
+     * \tparam number_t The type of the value to append; must model seqan3::Arithmetic.
+     *
+     * \param[in, out] buffer The buffer to append to.
+     * \param[in]      value  The value to append.
+     */
+    template <Arithmetic number_t>
+    static void append_integral_field(std::string & buffer, number_t const value)
+    {
+        buffer.append(reinterpret_cast<char const *>(&value), sizeof(value)); // BAM is little-endian, as is the platform
+    }
+
+    //!\brief Writes the little-endian binary representation of an arithmetic value to a stream.
+    template <typename stream_t, Arithmetic number_t>
+    static void append_integral_field_to_stream(stream_t & stream, number_t const value)
+    {
+        stream.write(reinterpret_cast<char const *>(&value), sizeof(value));
+    }
+
+    /*!\brief Reads the BAM header (magic bytes, SAM header text and binary reference dictionary).
+     * \tparam stream_t      The input stream type.
+     * \tparam ref_ids_type  The type of the reference ids in the header.
+     * \tparam ref_seqs_type A tag whether the reference information were given or not (std::ignore or not).
+     *
+     * \param[in, out] stream   The input stream to read from.
+     * \param[in, out] hdr      The header to fill.
+     * \param[in]      ref_seqs The reference sequences (or std::ignore).
+     *
+     * \throws seqan3::format_error if the magic bytes are wrong or the binary reference dictionary contradicts
+     *         the SAM header text or the given reference information.
+     *
+     * \details
+     *
+     * The SAM header text is parsed with the machinery of seqan3::alignment_file_format_sam. The binary
+     * reference dictionary is authoritative for the reference ids of the records: if reference information
+     * was given (or \@SQ lines were present in the text), the binary dictionary must match it in order and
+     * length, otherwise the reference ids of the header are filled from the binary dictionary.
+     */
+    template <typename stream_t, typename ref_ids_type, typename ref_seqs_type>
+    void read_header(stream_t & stream, alignment_file_header<ref_ids_type> & hdr, ref_seqs_type & ref_seqs)
+    {
+        std::array<char, 4> magic{};
+        stream.read(magic.data(), magic.size());
+
+        if (!stream || magic != std::array<char, 4>{'B', 'A', 'M', '\1'})
+            throw format_error{"File is not in BAM format (wrong magic bytes)."};
+
+        int32_t l_text{};
+        read_integral_field(stream, l_text);
+
+        std::string text(l_text, '\0');
+        stream.read(text.data(), l_text);
+        text.resize(text.find('\0') == std::string::npos ? text.size() : text.find('\0')); // strip NUL padding
+
+        if (!text.empty() && text.front() == '@')
+        {
+            if (text.back() != '\n') // the SAM header parser is line based
+                text += '\n';
+
+            // reuse the SAM header parser on the plain header text
+            std::istringstream text_stream{text};
+            using stream_buf_t = std::istreambuf_iterator<char>;
+            auto text_view = std::ranges::subrange<stream_buf_t, stream_buf_t>{stream_buf_t{text_stream},
+                                                                               stream_buf_t{}};
+            alignment_file_format_sam::read_header(text_view, hdr, ref_seqs);
+        }
+
+        int32_t n_ref{};
+        read_integral_field(stream, n_ref);
+
+        bool const ref_info_given = ref_info_present_in_header || !std::ranges::empty(hdr.ref_ids());
+
+        for (int32_t ref_idx = 0; ref_idx < n_ref; ++ref_idx)
+        {
+            int32_t l_name{}, l_ref{};
+            read_integral_field(stream, l_name);
+
+            std::string name(l_name - 1, '\0');
+            stream.read(name.data(), l_name - 1);
+            stream.ignore(1); // skip the NUL terminator
+
+            read_integral_field(stream, l_ref);
+
+            if (ref_info_given)
+            {
+                auto id_it = hdr.ref_dict().find(name);
+
+                if (id_it == hdr.ref_dict().end())
+                    throw format_error{"Unknown reference name found in the binary BAM reference dictionary."};
+
+                if (id_it->second != static_cast<size_t>(ref_idx))
+                    throw format_error{"The binary BAM reference dictionary disagrees with the given reference "
+                                       "information on the order of the references."};
+
+                if (std::get<0>(hdr.ref_id_info()[id_it->second]) != l_ref)
+                    throw format_error{"The binary BAM reference dictionary disagrees with the given reference "
+                                       "information on the length of a reference."};
+            }
+            else
+            {
+                hdr.ref_ids().push_back(name);
+                hdr.ref_id_info().emplace_back(l_ref, "");
+                hdr.ref_dict()[(hdr.ref_ids())[(hdr.ref_ids()).size() - 1]] = (hdr.ref_ids()).size() - 1;
+            }
+        }
+
+        if (!stream)
+            throw format_error{"[CORRUPTED BAM FILE] Unexpected end of stream while reading the header."};
+    }
+
+    /*!\brief Reads the optional tag fields from the in-memory tag block into the seqan3::sam_tag_dictionary.
+     * \param[in]      tag_buffer The remaining bytes of a record holding the optional tags.
+     * \param[in, out] target     The seqan3::sam_tag_dictionary to store the tag information.
+     *
+     * \throws seqan3::format_error if any unknown tag type was encountered or a tag is truncated.
+     */
+    void read_tag_fields(std::string_view tag_buffer, sam_tag_dictionary & target)
+    {
+        auto take_bytes = [&tag_buffer] (size_t const count) // consume and return `count` bytes of the buffer
+        {
+            if (tag_buffer.size() < count)
+                throw format_error{"[CORRUPTED BAM FILE] Truncated tag field in a record."};
+
+            std::string_view const bytes = tag_buffer.substr(0, count);
+            tag_buffer.remove_prefix(count);
+            return bytes;
+        };
+
+        auto read_value = [&take_bytes] (auto & value) // read one little-endian encoded value
+        {
+            std::memcpy(&value, take_bytes(sizeof(value)).data(), sizeof(value));
+        };
+
+        auto read_string = [&tag_buffer, &take_bytes] () // read one NUL-terminated string
+        {
+            size_t const length = tag_buffer.find('\0');
+
+            if (length == std::string_view::npos)
+                throw format_error{"[CORRUPTED BAM FILE] Unterminated string tag in a record."};
+
+            std::string value{take_bytes(length)};
+            take_bytes(1); // skip the NUL terminator
+            return value;
+        };
+
+        auto read_array = [&] (auto && dict_entry, auto value)
+        {
+            int32_t count{};
+            read_value(count);
+
+            std::vector<decltype(value)> tmp_vector{};
+            tmp_vector.reserve(count);
+            for (int32_t i = 0; i < count; ++i)
+            {
+                read_value(value);
+                tmp_vector.push_back(value);
+            }
+            dict_entry = std::move(tmp_vector);
+        };
+
+        while (!tag_buffer.empty())
+        {
+            std::string_view const tag_chars = take_bytes(2);
+            uint16_t const tag = (static_cast<uint16_t>(tag_chars[0]) << 8) + static_cast<uint16_t>(tag_chars[1]);
+            char const type_id = take_bytes(1)[0];
+
+            switch (type_id)
+            {
+                case 'A' : // char
+                {
+                    target[tag] = take_bytes(1)[0];
+                    break;
+                }
+                // all integer types are stored as int32_t in the dictionary (as for SAM)
+                case 'c' : { int8_t   tmp{}; read_value(tmp); target[tag] = static_cast<int32_t>(tmp); break; }
+                case 'C' : { uint8_t  tmp{}; read_value(tmp); target[tag] = static_cast<int32_t>(tmp); break; }
+                case 's' : { int16_t  tmp{}; read_value(tmp); target[tag] = static_cast<int32_t>(tmp); break; }
+                case 'S' : { uint16_t tmp{}; read_value(tmp); target[tag] = static_cast<int32_t>(tmp); break; }
+                case 'i' : { int32_t  tmp{}; read_value(tmp); target[tag] = tmp;                       break; }
+                case 'I' : { uint32_t tmp{}; read_value(tmp); target[tag] = static_cast<int32_t>(tmp); break; }
+                case 'f' : // float
+                {
+                    float tmp{};
+                    read_value(tmp);
+                    target[tag] = tmp;
+                    break;
+                }
+                case 'Z' : case 'H' : // string and hex string
+                {
+                    target[tag] = read_string();
+                    break;
+                }
+                case 'B' : // Array. Value type depends on second char [cCsSiIf]
+                {
+                    char const array_value_type_id = take_bytes(1)[0];
+
+                    switch (array_value_type_id)
+                    {
+                        case 'c' : { read_array(target[tag], int8_t{});   break; }
+                        case 'C' : { read_array(target[tag], uint8_t{});  break; }
+                        case 's' : { read_array(target[tag], int16_t{});  break; }
+                        case 'S' : { read_array(target[tag], uint16_t{}); break; }
+                        case 'i' : { read_array(target[tag], int32_t{});  break; }
+                        case 'I' : { read_array(target[tag], uint32_t{}); break; }
+                        case 'f' : { read_array(target[tag], float{});    break; }
+                        default:
+                            throw format_error{std::string("The first character in the numerical ") +
+                                               "id of a SAM tag must be one of [cCsSiIf] but " + array_value_type_id +
+                                               " was given."};
+                    }
+                    break;
+                }
+                default:
+                    throw format_error{std::string("The second character in the numerical id of a "
+                                       "SAM tag must be one of [A,cCsSiI,Z,H,B,f] but ") + type_id + " was given."};
+            }
+        }
+    }
+
+    /*!\brief Resolves any of the valid reference id representations to the index used in BAM records.
+     * \tparam ref_id_type The type of the reference id (integral, std::optional or a range of characters).
+     * \tparam header_type The type of the alignment header (or decltype(std::ignore)).
+     *
+     * \param[in] ref_id The reference id to resolve.
+     * \param[in] header The header holding the reference dictionary.
+     * \returns The index of the reference in the reference dictionary or -1 for unset reference ids.
+     *
+     * \throws seqan3::format_error if a reference name cannot be resolved (no header given or unknown name).
+     */
+    template <typename ref_id_type, typename header_type>
+    int32_t resolve_ref_id_index(ref_id_type && ref_id, header_type && header)
+    {
+        if constexpr (detail::decays_to_ignore_v<remove_cvref_t<ref_id_type>>)
+        {
+            return -1;
+        }
+        else if constexpr (std::Integral<remove_cvref_t<ref_id_type>>)
+        {
+            return ref_id;
+        }
+        else if constexpr (detail::is_type_specialisation_of_v<remove_cvref_t<ref_id_type>, std::optional>)
+        {
+            return ref_id.value_or(-1);
+        }
+        else // a range over characters that needs to be looked up in the header
+        {
+            if (std::ranges::empty(ref_id))
+                return -1;
+
+            if constexpr (detail::decays_to_ignore_v<remove_cvref_t<header_type>>)
+            {
+                throw format_error{"BAM records store reference ids as indices into the reference dictionary, "
+                                   "so reference names can only be written when a header is given."};
+            }
+            else
+            {
+                auto search = header.ref_dict().find(std::string{begin(ref_id), end(ref_id)});
+
+                if (search == header.ref_dict().end())
+                    throw format_error{std::string("The ref_id '") + std::string{begin(ref_id), end(ref_id)} +
+                                       "' was not in the list of references"};
+                return search->second;
+            }
+        }
+    }
+
+    /*!\brief Resolves a position that is either integral or a std::optional to the -1-for-unset BAM encoding.
+     * \tparam position_type The type of the position.
+     * \param[in] position The position to resolve.
+     */
+    template <typename position_type>
+    static int32_t resolve_position(position_type && position)
+    {
+        if constexpr (detail::is_type_specialisation_of_v<remove_cvref_t<position_type>, std::optional>)
+            return position.value_or(-1);
+        else
+            return position;
+    }
+
+    /*!\brief Converts a cigar string into the binary BAM cigar encoding.
+     * \param[in] cigar_string The cigar string (as produced by seqan3::detail::get_cigar_string).
+     * \returns A pair of the binary cigar operations and the length of the aligned reference region.
+     */
+    std::pair<std::vector<uint32_t>, int32_t> encode_cigar(std::string const & cigar_string)
+    {
+        std::vector<uint32_t> binary_cigar{};
+        int32_t ref_length{0};
+        uint32_t count{0};
+
+        for (char const c : cigar_string)
+        {
+            if (is_digit(c))
+            {
+                count = count * 10 + (c - '0');
+                continue;
+            }
+
+            size_t const operation_code =
+                std::string_view{cigar_operation_characters.data(), 9}.find(c);
+
+            if (operation_code == std::string_view::npos)
+                throw format_error{std::string{"Illegal cigar operation: "} + std::string{c}};
+
+            if (c == 'M' || c == '=' || c == 'X' || c == 'D' || c == 'N')
+                ref_length += count;
+
+            binary_cigar.push_back((count << 4) | operation_code);
+            count = 0;
+        }
+
+        return {std::move(binary_cigar), ref_length};
+    }
+
+    /*!\brief Appends the optional fields of the seqan3::sam_tag_dictionary in binary encoding.
+     * \param[in, out] buffer   The record buffer to append to.
+     * \param[in]      tag_dict The tag dictionary to write.
+     */
+    void write_tag_fields(std::string & buffer, sam_tag_dictionary const & tag_dict)
+    {
+        auto stream_variant_fn = [&buffer] (auto && arg) // helper to write the value of an std::variant
+        {
+            using T = remove_cvref_t<decltype(arg)>;
+
+            if constexpr (std::Same<T, char>)
+            {
+                buffer += 'A';
+                buffer += arg;
+            }
+            else if constexpr (std::Same<T, int32_t>)
+            {
+                buffer += 'i';
+                append_integral_field(buffer, arg);
+            }
+            else if constexpr (std::Same<T, float>)
+            {
+                buffer += 'f';
+                append_integral_field(buffer, arg);
+            }
+            else if constexpr (std::Same<T, std::string>)
+            {
+                buffer += 'Z';
+                buffer += arg;
+                buffer += '\0';
+            }
+            else // an array tag
+            {
+                using value_t = value_type_t<T>;
+
+                buffer += 'B';
+                if constexpr      (std::Same<value_t, int8_t>)   buffer += 'c';
+                else if constexpr (std::Same<value_t, uint8_t>)  buffer += 'C';
+                else if constexpr (std::Same<value_t, int16_t>)  buffer += 's';
+                else if constexpr (std::Same<value_t, uint16_t>) buffer += 'S';
+                else if constexpr (std::Same<value_t, int32_t>)  buffer += 'i';
+                else if constexpr (std::Same<value_t, uint32_t>) buffer += 'I';
+                else                                             buffer += 'f';
+
+                append_integral_field(buffer, static_cast<int32_t>(arg.size()));
+                for (value_t const element : arg)
+                    append_integral_field(buffer, element);
+            }
+        };
+
+        for (auto const & [tag, variant] : tag_dict)
+        {
+            buffer += static_cast<char>(tag / 256);
+            buffer += static_cast<char>(tag % 256);
+
+            std::visit(stream_variant_fn, variant);
+        }
+    }
+
+    /*!\brief Writes the BAM header (magic bytes, SAM header text and binary reference dictionary).
+     * \tparam stream_t    The stream type.
+     * \tparam header_type The type of the alignment header (or decltype(std::ignore)).
+     *
+     * \param[in, out] stream  The stream to write to.
+     * \param[in]      options The options to alter printing.
+     * \param[in]      header  The header to write.
+     *
+     * \details
+     *
+     * The SAM header text is produced with the machinery of seqan3::alignment_file_format_sam. If no header is
+     * given, an empty header text and an empty reference dictionary are written (records can then only carry
+     * unset reference ids).
+     */
+    template <typename stream_t, typename header_type>
+    void write_header(stream_t & stream, alignment_file_output_options const & options, header_type && header)
+    {
+        stream.write("BAM\1", 4);
+
+        if constexpr (detail::decays_to_ignore_v<remove_cvref_t<header_type>>)
+        {
+            (void) options;
+            append_integral_field_to_stream(stream, int32_t{0}); // l_text
+            append_integral_field_to_stream(stream, int32_t{0}); // n_ref
+        }
+        else
+        {
+            std::ostringstream text_stream{};
+            alignment_file_format_sam::write_header(text_stream, options, header);
+            std::string const text = text_stream.str();
+
+            append_integral_field_to_stream(stream, static_cast<int32_t>(text.size()));
+            stream.write(text.data(), text.size());
+
+            append_integral_field_to_stream(stream, static_cast<int32_t>(std::ranges::size(header.ref_ids())));
+
+            for (auto const & [ref_name, ref_info] : std::view::zip(header.ref_ids(), header.ref_id_info()))
+            {
+                std::string const name{begin(ref_name), end(ref_name)};
+
+                append_integral_field_to_stream(stream, static_cast<int32_t>(name.size() + 1));
+                stream.write(name.data(), name.size());
+                stream.write("\0", 1);
+                append_integral_field_to_stream(stream, std::get<0>(ref_info));
+            }
+        }
+    }
+};
+
+} // namespace seqan3
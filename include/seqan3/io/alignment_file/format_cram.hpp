@@ -0,0 +1,1666 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides the seqan3::alignment_file_format_cram class.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <range/v3/view/repeat_n.hpp>
+
+#include <seqan3/core/concept/core_language.hpp>
+#include <seqan3/core/concept/tuple.hpp>
+#include <seqan3/core/metafunction/basic.hpp>
+#include <seqan3/core/metafunction/range.hpp>
+#include <seqan3/core/metafunction/template_inspection.hpp>
+#include <seqan3/io/alignment_file/cram_codec.hpp>
+#include <seqan3/io/alignment_file/detail.hpp>
+#include <seqan3/io/alignment_file/format_sam.hpp>
+#include <seqan3/io/alignment_file/header.hpp>
+#include <seqan3/io/alignment_file/input_options.hpp>
+#include <seqan3/io/alignment_file/sam_tag_dictionary.hpp>
+#include <seqan3/io/detail/misc.hpp>
+#include <seqan3/io/stream/parse_condition.hpp>
+#include <seqan3/range/view/char_to.hpp>
+#include <seqan3/range/view/slice.hpp>
+#include <seqan3/range/view/to_char.hpp>
+#include <seqan3/std/concepts>
+#include <seqan3/std/ranges>
+
+namespace seqan3
+{
+
+/*!\brief       The CRAM format (reading only).
+ * \implements  alignment_file_format_concept
+ * \ingroup     alignment_file
+ *
+ * \details
+ *
+ * ### Introduction
+ *
+ * CRAM is a column-oriented, reference-based compression format for read-to-reference alignments that
+ * typically produces considerably smaller files than BAM. See the official
+ * [CRAM format specification](https://samtools.github.io/hts-specs/CRAMv3.pdf) for a description of the
+ * encoding. **SeqAn reads version 3.0 of the CRAM specification**; writing CRAM is currently not supported,
+ * i.e. this format can only be used with seqan3::alignment_file_input.
+ *
+ * Records are stored in containers of data series that are compressed independently; this class decodes
+ * whole slices at a time and hands out the buffered records one by one. The codecs used by the common
+ * implementations are supported (raw, gzip and rANS block compression; the EXTERNAL, HUFFMAN, BETA,
+ * BYTE_ARRAY_LEN and BYTE_ARRAY_STOP encodings), other codecs cause a seqan3::format_error.
+ *
+ * ### Fields
+ *
+ * The CRAM format provides exactly the same fields as the seqan3::alignment_file_format_sam; see there for
+ * the mapping of SAM columns to record fields. As for BAM, the reference information of records is stored
+ * as an index into the reference dictionary of the header.
+ *
+ * \attention CRAM stores sequences as differences to the reference, so decoding mapped records requires the
+ *            reference sequences: either pass them to seqan3::alignment_file_input on construction or use
+ *            files with embedded reference sequences. Files written with reference-less compression
+ *            (e.g. `samtools view --output-fmt-option no_ref`) carry all bases verbatim and need neither.
+ *
+ * ### Header implementation
+ *
+ * The file definition and the SAM header text (stored in the first container of the file) are read once
+ * before the first record; the plain header text is parsed with the machinery of
+ * seqan3::alignment_file_format_sam.
+ */
+class alignment_file_format_cram : protected alignment_file_format_sam
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    alignment_file_format_cram() = default;                                          //!< Defaulted
+    //!\brief Copy construction is explicitly deleted, because you can't have multiple access to the same file.
+    alignment_file_format_cram(alignment_file_format_cram const &) = delete;
+    //!\brief Copy assignment is explicitly deleted, because you can't have multiple access to the same file.
+    alignment_file_format_cram & operator=(alignment_file_format_cram const &) = delete;
+    alignment_file_format_cram(alignment_file_format_cram &&) = default;             //!< Defaulted
+    alignment_file_format_cram & operator=(alignment_file_format_cram &&) = default; //!< Defaulted
+    ~alignment_file_format_cram() = default;                                         //!< Defaulted
+    //!\}
+
+    //!\brief The valid file extensions for this format; note that you can modify this value.
+    static inline std::vector<std::string> file_extensions
+    {
+        { "cram" },
+    };
+
+    //!\copydoc AlignmentFileInputFormat::read
+    template <typename stream_type,     // constraints checked by file
+              typename seq_legal_alph_type,
+              typename ref_seqs_type,
+              typename ref_ids_type,
+              typename seq_type,
+              typename id_type,
+              typename offset_type,
+              typename ref_seq_type,
+              typename ref_id_type,
+              typename ref_offset_type,
+              typename align_type,
+              typename flag_type,
+              typename mapq_type,
+              typename qual_type,
+              typename mate_type,
+              typename tag_dict_type,
+              typename e_value_type,
+              typename bit_score_type>
+    void read(stream_type                                             & stream,
+              alignment_file_input_options<seq_legal_alph_type> const & SEQAN3_DOXYGEN_ONLY(options),
+              ref_seqs_type                                           & ref_seqs,
+              alignment_file_header<ref_ids_type>                     & header,
+              seq_type                                                & seq,
+              qual_type                                               & qual,
+              id_type                                                 & id,
+              offset_type                                             & offset,
+              ref_seq_type                                            & SEQAN3_DOXYGEN_ONLY(ref_seq),
+              ref_id_type                                             & ref_id,
+              ref_offset_type                                         & ref_offset,
+              align_type                                              & align,
+              flag_type                                               & flag,
+              mapq_type                                               & mapq,
+              mate_type                                               & mate,
+              tag_dict_type                                           & tag_dict,
+              e_value_type                                            & SEQAN3_DOXYGEN_ONLY(e_value),
+              bit_score_type                                          & SEQAN3_DOXYGEN_ONLY(bit_score))
+    {
+        static_assert(detail::decays_to_ignore_v<ref_offset_type> ||
+                      detail::is_type_specialisation_of_v<ref_offset_type, std::optional>,
+                      "The ref_offset must be a specialisation of std::optional.");
+
+        // Header
+        // -------------------------------------------------------------------------------------------------------------
+        if (!header_was_read)
+        {
+            read_header(stream, header, ref_seqs);
+            header_was_read = true;
+        }
+
+        // Record (whole slices are decoded at once, so most calls only hand out a buffered record)
+        // -------------------------------------------------------------------------------------------------------------
+        if (record_buffer_position >= record_buffer.size() && !load_records(stream, header, ref_seqs))
+            return; // file has no records
+
+        cram_alignment_record const & rec = record_buffer[record_buffer_position++];
+
+        flag = rec.flag;
+        mapq = rec.mapq;
+
+        if (rec.ref_id >= 0)
+        {
+            if (static_cast<size_t>(rec.ref_id) >= std::ranges::size(header.ref_ids()))
+                throw format_error{"[CORRUPTED CRAM FILE] Reference id of a record exceeds the reference dictionary."};
+
+            ref_id = rec.ref_id;
+        }
+
+        if (rec.position >= 0) // -1 indicates an unmapped read
+            ref_offset = rec.position;
+
+        if constexpr (!detail::decays_to_ignore_v<id_type>)
+            if (rec.read_name != "*")
+                std::ranges::copy(rec.read_name | view::char_to<value_type_t<id_type>>, std::back_inserter(id));
+
+        // cigar (hard clipping at either end is discarded, soft clipping is stored as query offsets, as for SAM)
+        // -------------------------------------------------------------------------------------------------------------
+        [[maybe_unused]] int32_t offset_tmp{};
+        [[maybe_unused]] int32_t soft_clipping_end{};
+        std::vector<std::pair<char, size_t>> cigar = rec.cigar;
+        [[maybe_unused]] int32_t ref_length{0}, seq_length{0}; // length of aligned part for ref and query
+
+        if (!cigar.empty() && cigar.front().first == 'H')
+            cigar.erase(cigar.begin());
+        if (!cigar.empty() && cigar.front().first == 'S')
+        {
+            offset_tmp = cigar.front().second;
+            cigar.erase(cigar.begin());
+        }
+        if (!cigar.empty() && cigar.back().first == 'H')
+            cigar.pop_back();
+        if (!cigar.empty() && cigar.back().first == 'S')
+        {
+            soft_clipping_end = cigar.back().second;
+            cigar.pop_back();
+        }
+
+        for (auto const & [cigar_op, cigar_count] : cigar)
+        {
+            if (is_char<'M'>(cigar_op) || is_char<'='>(cigar_op) || is_char<'X'>(cigar_op))
+            {
+                ref_length += cigar_count;
+                seq_length += cigar_count;
+            }
+            else if (is_char<'D'>(cigar_op) || is_char<'N'>(cigar_op))
+            {
+                ref_length += cigar_count;
+            }
+            else if (is_char<'I'>(cigar_op))
+            {
+                seq_length += cigar_count;
+            }
+            else // S or H inside the alignment, or P
+            {
+                if (is_char<'P'>(cigar_op))
+                    throw format_error{"We do currently not support cigar operation 'P'."};
+                else
+                    throw format_error{std::string{"Illegal cigar operation: "} + std::string{cigar_op}};
+            }
+        }
+
+        offset = offset_tmp;
+
+        // sequence
+        // -------------------------------------------------------------------------------------------------------------
+        auto constexpr is_legal_alph = is_in_alphabet<seq_legal_alph_type>;
+        auto check_legal = [is_legal_alph] (char const c)
+        {
+            if (!is_legal_alph(c))
+                throw format_error{std::string{"Encountered an unexpected letter: "} +
+                                   is_legal_alph.msg.string() +
+                                   " evaluated to false on " +
+                                   detail::make_printable(c)};
+            return c;
+        };
+
+        if constexpr (detail::decays_to_ignore_v<seq_type>)
+        {
+            if constexpr (!detail::decays_to_ignore_v<align_type>)
+            {
+                static_assert(sequence_container_concept<std::remove_reference_t<decltype(get<1>(align))>>,
+                              "If you want to read ALIGNMENT but not SEQ, the alignment"
+                              " object must store a sequence container at the second (query) position.");
+
+                if (!cigar.empty()) // only parse alignment if cigar information was given
+                {
+                    for (int32_t i = offset_tmp; i < offset_tmp + seq_length; ++i)
+                        get<1>(align).push_back(value_type_t<decltype(get<1>(align))>{}
+                                                    .assign_char(check_legal(rec.sequence[i])));
+                }
+                else
+                {
+                    get<1>(align) = std::remove_reference_t<decltype(get<1>(align))>{}; // empty container
+                }
+            }
+        }
+        else
+        {
+            for (char const c : rec.sequence)
+                seq.push_back(value_type_t<seq_type>{}.assign_char(check_legal(c)));
+
+            if constexpr (!detail::decays_to_ignore_v<align_type>)
+            {
+                assign_unaligned(get<1>(align),
+                                 seq | view::slice(static_cast<decltype(std::ranges::size(seq))>(offset_tmp),
+                                                   std::ranges::size(seq) - soft_clipping_end));
+            }
+        }
+
+        // qualities (already decoded to the offset-33 representation)
+        // -------------------------------------------------------------------------------------------------------------
+        if constexpr (!detail::decays_to_ignore_v<qual_type>)
+        {
+            for (char const c : rec.qualities)
+                qual.push_back(value_type_t<qual_type>{}.assign_char(c));
+        }
+
+        // mate
+        // -------------------------------------------------------------------------------------------------------------
+        if constexpr (!detail::decays_to_ignore_v<mate_type>)
+        {
+            if (rec.mate_ref_id >= 0)
+            {
+                if (static_cast<size_t>(rec.mate_ref_id) >= std::ranges::size(header.ref_ids()))
+                    throw format_error{"[CORRUPTED CRAM FILE] Mate reference id of a record exceeds the "
+                                       "reference dictionary."};
+
+                get<0>(mate) = rec.mate_ref_id;
+            }
+
+            if (rec.mate_position >= 0) // -1 indicates an unmapped mate
+                get<1>(mate) = rec.mate_position;
+
+            get<2>(mate) = rec.template_length;
+        }
+
+        // optional tags
+        // -------------------------------------------------------------------------------------------------------------
+        if constexpr (!detail::decays_to_ignore_v<tag_dict_type>)
+            tag_dict = rec.tags;
+
+        // DONE READING - wrap up
+        // -------------------------------------------------------------------------------------------------------------
+        // Alignment object construction (the query sequence in get<1>(align) has already been filled above)
+        if constexpr (!detail::decays_to_ignore_v<align_type>)
+        {
+            if (!cigar.empty() && !std::ranges::empty(get<1>(align))) // only parse alignment if cigar and seq was given
+            {
+                if constexpr (!detail::decays_to_ignore_v<ref_seqs_type>)
+                {
+                    // the record's reference id is an index into the reference dictionary (checked above)
+                    size_t pos = rec.ref_id;
+
+                    assert(static_cast<size_t>(rec.position + ref_length) <= std::ranges::size(ref_seqs[pos]));
+
+                    // copy over unaligned reference sequence part
+                    assign_unaligned(get<0>(align),
+                                     ref_seqs[pos] | view::slice(rec.position, rec.position + ref_length));
+                }
+                else
+                {
+                    using unaligned_t = remove_cvref_t<detail::unaligned_seq_t<decltype(get<0>(align))>>;
+                    auto dummy_seq    = ranges::view::repeat_n(value_type_t<unaligned_t>{}, ref_length)
+                                      | std::view::transform(detail::access_restrictor_fn{});
+                    static_assert(std::Same<unaligned_t, decltype(dummy_seq)>,
+                                  "No reference information was given so the type of the first alignment tuple position"
+                                  "must have an unaligned sequence type of a dummy sequence ("
+                                  "ranges::view::repeat_n(dna5{}, size_t{}) | "
+                                  "std::view::transform(detail::access_restrictor_fn{}))");
+
+                    assign_unaligned(get<0>(align), dummy_seq); // assign dummy sequence
+                }
+
+                // insert gaps according to the cigar information
+                detail::alignment_from_cigar(align, cigar);
+            }
+            else // not enough information for an alignment, assign an empty view/dummy_sequence
+            {
+                if constexpr (!detail::decays_to_ignore_v<ref_seqs_type>) // reference info given
+                {
+                    assert(std::ranges::size(ref_seqs) > 0); // we assume that the given ref info is not empty
+                    assign_unaligned(get<0>(align), ref_seqs[0] | view::slice(0, 0));
+                }
+                else
+                {
+                    using unaligned_t = remove_cvref_t<detail::unaligned_seq_t<decltype(get<0>(align))>>;
+                    assign_unaligned(get<0>(align), ranges::view::repeat_n(value_type_t<unaligned_t>{}, 0)
+                                                    | std::view::transform(detail::access_restrictor_fn{}));
+                }
+            }
+        }
+
+        // Read ahead so the stream is at its end once the last record was handed out: the remaining containers
+        // of a finished file hold no records (the mandatory EOF container) and are skipped by load_records.
+        if (record_buffer_position >= record_buffer.size())
+            load_records(stream, header, ref_seqs);
+    }
+
+protected:
+    //!\privatesection
+
+    //!\brief A variable that tracks whether the header has been read or not.
+    bool header_was_read{false};
+
+    //!\brief One fully decoded alignment record (the binary fields in their SAM/BAM semantics).
+    struct cram_alignment_record
+    {
+        uint16_t flag{};                               //!< The alignment flag.
+        int32_t ref_id{-1};                            //!< The index into the reference dictionary (-1 = unset).
+        int32_t position{-1};                          //!< The 0-based mapping position (-1 = unmapped).
+        uint8_t mapq{255};                             //!< The mapping quality (255 = unavailable).
+        std::string read_name{"*"};                    //!< The read name ("*" = unset).
+        std::vector<std::pair<char, size_t>> cigar{};  //!< The cigar operations (including soft/hard clips).
+        int32_t mate_ref_id{-1};                       //!< The mate's reference index (-1 = unset).
+        int32_t mate_position{-1};                     //!< The mate's 0-based mapping position (-1 = unmapped).
+        int32_t template_length{0};                    //!< The template length.
+        std::string sequence{};                        //!< The sequence characters.
+        std::string qualities{};                       //!< The quality characters (phred + 33).
+        sam_tag_dictionary tags{};                     //!< The optional tags.
+    };
+
+    //!\brief The decoded records of the current container that have not been handed out yet.
+    std::vector<cram_alignment_record> record_buffer{};
+    //!\brief The position of the next record inside the record buffer.
+    size_t record_buffer_position{0};
+
+    //!\brief One parsed encoding of the compression header (how the values of one data series are stored).
+    struct cram_encoding
+    {
+        //!\brief The codec ids of the CRAM specification.
+        enum codec_id : int32_t
+        {
+            null_codec      = 0, //!< No values are stored at all.
+            external        = 1, //!< Values are stored in an external block (ITF8 for integers, raw for bytes).
+            huffman         = 3, //!< Canonical huffman codes in the core data block.
+            byte_array_len  = 4, //!< A length encoding followed by a value encoding.
+            byte_array_stop = 5, //!< Bytes of an external block up to a stop byte.
+            beta            = 6  //!< Fixed-width binary numbers in the core data block.
+        };
+
+        int32_t codec{null_codec};                          //!< Which codec the values are stored with.
+        int32_t external_id{-1};                            //!< EXTERNAL/BYTE_ARRAY_STOP: the external block id.
+        std::vector<int32_t> huffman_symbols{};             //!< HUFFMAN: the symbol values.
+        std::vector<int32_t> huffman_code_lengths{};        //!< HUFFMAN: the canonical code length per symbol.
+        std::vector<std::array<int32_t, 3>> huffman_codes{};//!< HUFFMAN: (length, code, symbol) sorted by length.
+        int32_t beta_offset{0};                             //!< BETA: the value offset.
+        int32_t beta_bits{0};                               //!< BETA: the number of bits per value.
+        uint8_t stop_byte{0};                               //!< BYTE_ARRAY_STOP: the delimiting byte.
+        std::shared_ptr<cram_encoding> length_encoding{};   //!< BYTE_ARRAY_LEN: how the lengths are stored.
+        std::shared_ptr<cram_encoding> value_encoding{};    //!< BYTE_ARRAY_LEN: how the bytes are stored.
+    };
+
+    //!\brief The parsed compression header of one container.
+    struct cram_compression_header
+    {
+        bool read_names_included{true};                      //!< Whether read names are stored (RN).
+        bool ap_delta{true};                                 //!< Whether positions are delta encoded (AP).
+        bool reference_required{true};                       //!< Whether decoding requires the reference (RR).
+        std::array<std::array<char, 4>, 5> substitution_matrix{}; //!< Substitution code -> base, per reference base.
+        std::vector<std::vector<std::array<char, 3>>> tag_lines{};//!< The tag dictionary (tag ids + types per line).
+        std::map<uint16_t, cram_encoding> data_series{};     //!< The encoding of each data series.
+        std::map<int32_t, cram_encoding> tag_encodings{};    //!< The encoding of each tag id/type combination.
+    };
+
+    //!\brief The parsed header of one slice.
+    struct cram_slice_header
+    {
+        int32_t ref_seq_id{-1};        //!< The reference of the slice (-1 = unmapped, -2 = multiple references).
+        int32_t start{0};              //!< The 1-based start of the covered reference region.
+        int32_t span{0};               //!< The length of the covered reference region.
+        int32_t n_records{0};          //!< The number of records in the slice.
+        int64_t record_counter{0};     //!< The absolute index of the first record of the slice.
+        int32_t n_blocks{0};           //!< The number of data blocks of the slice.
+        int32_t embedded_ref_id{-1};   //!< The block id of the embedded reference (-1 = none).
+    };
+
+    //!\brief One read (and decompressed) block.
+    struct cram_block
+    {
+        uint8_t content_type{};        //!< The content type id (file header, compression header, slice, ...).
+        int32_t content_id{};          //!< The external block id (only meaningful for external blocks).
+        std::string data{};            //!< The decompressed block data.
+    };
+
+    //!\brief The decoding state of one slice (the core bit stream and one cursor per external block).
+    struct cram_slice_context
+    {
+        detail::cram_bit_reader core{};                        //!< Reads bits off the core data block.
+        std::map<int32_t, detail::cram_data_cursor> external{};//!< Reads bytes off the external blocks.
+    };
+
+    //!\brief Builds the two-character key of a data series (e.g. `series_key("BF")`).
+    static constexpr uint16_t series_key(char const (&name)[3]) noexcept
+    {
+        return (static_cast<uint16_t>(name[0]) << 8) | static_cast<uint16_t>(name[1]);
+    }
+
+    /*!\brief Reads an integral value from its little-endian binary representation.
+     * \tparam stream_t The input stream type.
+     * \tparam number_t The type of the value to read; must model std::Integral.
+     *
+     * \param[in, out] stream The input stream to read from.
+     * \param[out]     target The value to fill.
+     */
+    template <typename stream_t, std::Integral number_t>
+    void read_integral_field(stream_t & stream, number_t & target)
+    {
+        stream.read(reinterpret_cast<char *>(&target), sizeof(target)); // CRAM is little-endian, as is the platform
+    }
+
+    //!\brief Reads one byte from the stream (throws on an unexpected end of the stream).
+    template <typename stream_t>
+    uint8_t take_byte_from_stream(stream_t & stream)
+    {
+        typename stream_t::int_type const c = stream.get();
+
+        if (c == stream_t::traits_type::eof())
+            throw format_error{"[CORRUPTED CRAM FILE] Unexpected end of stream."};
+
+        return static_cast<uint8_t>(c);
+    }
+
+    //!\brief Reads one ITF8 encoded integer directly from the stream.
+    template <typename stream_t>
+    int32_t read_itf8_from_stream(stream_t & stream)
+    {
+        uint32_t const b0 = take_byte_from_stream(stream);
+
+        if (b0 < 0x80)
+            return static_cast<int32_t>(b0);
+        else if (b0 < 0xC0)
+            return static_cast<int32_t>(((b0 & 0x3Fu) << 8) | take_byte_from_stream(stream));
+        else if (b0 < 0xE0)
+            return static_cast<int32_t>(((b0 & 0x1Fu) << 16) | (take_byte_from_stream(stream) << 8) |
+                                        take_byte_from_stream(stream));
+        else if (b0 < 0xF0)
+            return static_cast<int32_t>(((b0 & 0x0Fu) << 24) | (take_byte_from_stream(stream) << 16) |
+                                        (take_byte_from_stream(stream) << 8) | take_byte_from_stream(stream));
+        else
+            return static_cast<int32_t>(((b0 & 0x0Fu) << 28) | (take_byte_from_stream(stream) << 20) |
+                                        (take_byte_from_stream(stream) << 12) |
+                                        (take_byte_from_stream(stream) << 4) |
+                                        (take_byte_from_stream(stream) & 0x0Fu));
+    }
+
+    //!\brief Reads one LTF8 encoded integer directly from the stream.
+    template <typename stream_t>
+    int64_t read_ltf8_from_stream(stream_t & stream)
+    {
+        uint64_t const b0 = take_byte_from_stream(stream);
+
+        size_t extra_bytes = 0;
+        while ((extra_bytes < 8) && ((b0 >> (7 - extra_bytes)) & 1u))
+            ++extra_bytes;
+
+        uint64_t value = (extra_bytes < 8) ? (b0 & ((1u << (7 - extra_bytes)) - 1)) : 0u;
+        for (size_t i = 0; i < extra_bytes; ++i)
+            value = (value << 8) | take_byte_from_stream(stream);
+
+        return static_cast<int64_t>(value);
+    }
+
+    /*!\brief Reads one container off the stream into memory.
+     * \param[in, out] stream  The input stream to read from.
+     * \param[out]     payload The raw bytes of the container's blocks.
+     * \returns The number of records the container holds.
+     *
+     * \details
+     *
+     * The container header fields that are irrelevant for sequential reading (reference coordinates,
+     * landmarks, the header checksum) are parsed but discarded; the blocks carry their own checksums,
+     * which are verified when they are read.
+     */
+    template <typename stream_t>
+    int32_t read_container(stream_t & stream, std::string & payload)
+    {
+        int32_t length{};
+        read_integral_field(stream, length);
+
+        if (!stream)
+            throw format_error{"[CORRUPTED CRAM FILE] Unexpected end of stream while reading a container."};
+
+        read_itf8_from_stream(stream);                        // reference sequence id
+        read_itf8_from_stream(stream);                        // alignment start
+        read_itf8_from_stream(stream);                        // alignment span
+        int32_t const n_records = read_itf8_from_stream(stream);
+        read_ltf8_from_stream(stream);                        // record counter
+        read_ltf8_from_stream(stream);                        // number of read bases
+
+        read_itf8_from_stream(stream);                        // number of blocks
+        int32_t const n_landmarks = read_itf8_from_stream(stream);
+        for (int32_t i = 0; i < n_landmarks; ++i)
+            read_itf8_from_stream(stream);                    // landmark (byte offset of a slice)
+
+        uint32_t stored_crc{}; // the checksum of the container header; the block checksums cover all data
+        read_integral_field(stream, stored_crc);
+
+        if (length < 0)
+            throw format_error{"[CORRUPTED CRAM FILE] Negative container length."};
+
+        payload.resize(length);
+        stream.read(payload.data(), length);
+
+        if (!stream)
+            throw format_error{"[CORRUPTED CRAM FILE] Unexpected end of stream while reading a container."};
+
+        return n_records;
+    }
+
+    /*!\brief Reads the file definition and the SAM header (stored in the first container of the file).
+     * \tparam stream_t      The input stream type.
+     * \tparam ref_ids_type  The type of the reference ids in the header.
+     * \tparam ref_seqs_type A tag whether the reference information were given or not (std::ignore or not).
+     *
+     * \param[in, out] stream   The input stream to read from.
+     * \param[in, out] hdr      The header to fill.
+     * \param[in]      ref_seqs The reference sequences (or std::ignore).
+     *
+     * \throws seqan3::format_error if the magic bytes or the format version are wrong.
+     */
+    template <typename stream_t, typename ref_ids_type, typename ref_seqs_type>
+    void read_header(stream_t & stream, alignment_file_header<ref_ids_type> & hdr, ref_seqs_type & ref_seqs)
+    {
+        std::array<char, 4> magic{};
+        stream.read(magic.data(), magic.size());
+
+        if (!stream || magic != std::array<char, 4>{'C', 'R', 'A', 'M'})
+            throw format_error{"File is not in CRAM format (wrong magic bytes)."};
+
+        uint8_t const major = take_byte_from_stream(stream);
+        take_byte_from_stream(stream); // minor version
+
+        if (major != 3)
+            throw format_error{"Only version 3 of the CRAM format is supported."};
+
+        stream.ignore(20); // the file id
+
+        // the first container holds the SAM header text as its first block
+        std::string payload{};
+        read_container(stream, payload);
+
+        detail::cram_data_cursor cursor{payload};
+        cram_block const block = read_block(cursor);
+
+        if (block.content_type != 0) // FILE_HEADER
+            throw format_error{"[CORRUPTED CRAM FILE] The first block of a CRAM file must hold the SAM header."};
+
+        detail::cram_data_cursor text_cursor{block.data};
+        int32_t const l_text = static_cast<int32_t>(text_cursor.take_uint32_le());
+        std::string text{text_cursor.take(l_text)};
+        text.resize(text.find('\0') == std::string::npos ? text.size() : text.find('\0')); // strip NUL padding
+
+        if (!text.empty() && text.front() == '@')
+        {
+            if (text.back() != '\n') // the SAM header parser is line based
+                text += '\n';
+
+            // reuse the SAM header parser on the plain header text
+            std::istringstream text_stream{text};
+            using stream_buf_t = std::istreambuf_iterator<char>;
+            auto text_view = std::ranges::subrange<stream_buf_t, stream_buf_t>{stream_buf_t{text_stream},
+                                                                               stream_buf_t{}};
+            alignment_file_format_sam::read_header(text_view, hdr, ref_seqs);
+        }
+    }
+
+    /*!\brief Reads (and decompresses) one block off a container payload.
+     * \param[in, out] cursor The cursor over the container payload.
+     * \returns The decompressed block.
+     *
+     * \throws seqan3::format_error on truncated/corrupted data or an unsupported compression method.
+     */
+    cram_block read_block(detail::cram_data_cursor & cursor)
+    {
+        std::string_view const block_start = cursor.remaining(); // for the checksum computation
+
+        uint8_t const method = cursor.take_byte();
+
+        cram_block block{};
+        block.content_type = cursor.take_byte();
+        block.content_id   = cursor.take_itf8();
+
+        int32_t const compressed_size = cursor.take_itf8();
+        int32_t const raw_size        = cursor.take_itf8();
+
+        if (compressed_size < 0 || raw_size < 0)
+            throw format_error{"[CORRUPTED CRAM FILE] Negative block size."};
+
+        std::string_view const data = cursor.take(compressed_size);
+
+        size_t const block_bytes = block_start.size() - cursor.remaining().size();
+        uint32_t const stored_crc = cursor.take_uint32_le();
+
+#ifdef SEQAN3_HAS_ZLIB
+        if (stored_crc != crc32(crc32(0, nullptr, 0),
+                                reinterpret_cast<Bytef const *>(block_start.data()), block_bytes))
+            throw format_error{"[CORRUPTED CRAM FILE] Block checksum mismatch."};
+#else
+        (void) stored_crc;
+        (void) block_bytes;
+#endif
+
+        switch (method)
+        {
+            case 0: // raw
+            {
+                block.data = std::string{data};
+                break;
+            }
+            case 1: // gzip
+            {
+#ifdef SEQAN3_HAS_ZLIB
+                block.data = detail::cram_inflate_gzip(data, raw_size);
+                break;
+#else
+                throw format_error{"The file holds gzip-compressed blocks, but SeqAn was built without zlib."};
+#endif
+            }
+            case 4: // rANS
+            {
+                block.data = detail::cram_rans_decompress(data);
+                break;
+            }
+            default: // 2 = bzip2, 3 = lzma
+                throw format_error{"Unsupported CRAM block compression method (only raw, gzip and rANS "
+                                   "are supported)."};
+        }
+
+        if (block.data.size() != static_cast<size_t>(raw_size))
+            throw format_error{"[CORRUPTED CRAM FILE] A block's decompressed size contradicts its header."};
+
+        return block;
+    }
+
+    //!\brief Parses one encoding (recursively for BYTE_ARRAY_LEN) from the compression header.
+    cram_encoding parse_encoding(detail::cram_data_cursor & cursor)
+    {
+        cram_encoding encoding{};
+        encoding.codec = cursor.take_itf8();
+
+        int32_t const n_arg_bytes = cursor.take_itf8();
+        detail::cram_data_cursor args{cursor.take(n_arg_bytes)};
+
+        switch (encoding.codec)
+        {
+            case cram_encoding::null_codec:
+            {
+                break;
+            }
+            case cram_encoding::external:
+            {
+                encoding.external_id = args.take_itf8();
+                break;
+            }
+            case cram_encoding::huffman:
+            {
+                int32_t const n_symbols = args.take_itf8();
+                for (int32_t i = 0; i < n_symbols; ++i)
+                    encoding.huffman_symbols.push_back(args.take_itf8());
+
+                int32_t const n_lengths = args.take_itf8();
+                if (n_lengths != n_symbols)
+                    throw format_error{"[CORRUPTED CRAM FILE] Huffman symbol and code length counts differ."};
+                for (int32_t i = 0; i < n_lengths; ++i)
+                    encoding.huffman_code_lengths.push_back(args.take_itf8());
+
+                build_huffman_codes(encoding);
+                break;
+            }
+            case cram_encoding::byte_array_len:
+            {
+                encoding.length_encoding = std::make_shared<cram_encoding>(parse_encoding(args));
+                encoding.value_encoding  = std::make_shared<cram_encoding>(parse_encoding(args));
+                break;
+            }
+            case cram_encoding::byte_array_stop:
+            {
+                encoding.stop_byte   = args.take_byte();
+                encoding.external_id = args.take_itf8();
+                break;
+            }
+            case cram_encoding::beta:
+            {
+                encoding.beta_offset = args.take_itf8();
+                encoding.beta_bits   = args.take_itf8();
+                break;
+            }
+            default: // GOLOMB and friends; only diagnosed when a record actually uses the series
+            {
+                break;
+            }
+        }
+
+        return encoding;
+    }
+
+    //!\brief Assigns the canonical huffman codes (sorted by code length, then symbol value).
+    static void build_huffman_codes(cram_encoding & encoding)
+    {
+        for (size_t i = 0; i < encoding.huffman_symbols.size(); ++i)
+            encoding.huffman_codes.push_back({encoding.huffman_code_lengths[i], 0, encoding.huffman_symbols[i]});
+
+        std::sort(encoding.huffman_codes.begin(), encoding.huffman_codes.end(),
+                  [] (auto const & lhs, auto const & rhs)
+                  {
+                      return std::tie(lhs[0], lhs[2]) < std::tie(rhs[0], rhs[2]);
+                  });
+
+        int32_t code = 0;
+        for (size_t i = 0; i < encoding.huffman_codes.size(); ++i)
+        {
+            if (i > 0)
+                code = (code + 1) << (encoding.huffman_codes[i][0] - encoding.huffman_codes[i - 1][0]);
+            encoding.huffman_codes[i][1] = code;
+        }
+    }
+
+    /*!\brief Parses the compression header of a container.
+     * \param[in] block The decompressed compression header block.
+     * \returns The parsed compression header.
+     */
+    cram_compression_header parse_compression_header(cram_block const & block)
+    {
+        cram_compression_header compression_header{};
+
+        // substitution code -> base tables default to the identity-free order of the specification
+        constexpr std::array<char, 5> bases{'A', 'C', 'G', 'T', 'N'};
+        for (size_t ref_base = 0; ref_base < 5; ++ref_base)
+        {
+            size_t code = 0;
+            for (size_t candidate = 0; candidate < 5; ++candidate)
+                if (candidate != ref_base)
+                    compression_header.substitution_matrix[ref_base][code++] = bases[candidate];
+        }
+
+        detail::cram_data_cursor cursor{block.data};
+
+        { // preservation map
+            cursor.take_itf8(); // size in bytes
+            int32_t const n_entries = cursor.take_itf8();
+
+            for (int32_t i = 0; i < n_entries; ++i)
+            {
+                std::string_view const key = cursor.take(2);
+
+                if (key == "RN")
+                {
+                    compression_header.read_names_included = (cursor.take_byte() != 0);
+                }
+                else if (key == "AP")
+                {
+                    compression_header.ap_delta = (cursor.take_byte() != 0);
+                }
+                else if (key == "RR")
+                {
+                    compression_header.reference_required = (cursor.take_byte() != 0);
+                }
+                else if (key == "SM")
+                {
+                    for (size_t ref_base = 0; ref_base < 5; ++ref_base)
+                    {
+                        uint8_t const codes = cursor.take_byte();
+
+                        // of the 4 candidate bases (ACGTN minus the reference base, in that order),
+                        // candidate i carries the 2-bit code stored at bit position 6 - 2i
+                        std::array<char, 4> candidates{};
+                        size_t candidate_count = 0;
+                        for (size_t candidate = 0; candidate < 5; ++candidate)
+                            if (candidate != ref_base)
+                                candidates[candidate_count++] = bases[candidate];
+
+                        for (size_t candidate = 0; candidate < 4; ++candidate)
+                            compression_header.substitution_matrix[ref_base][(codes >> (6 - 2 * candidate)) & 3u] =
+                                candidates[candidate];
+                    }
+                }
+                else if (key == "TD")
+                {
+                    int32_t const n_bytes = cursor.take_itf8();
+                    detail::cram_data_cursor dictionary{cursor.take(n_bytes)};
+
+                    std::vector<std::array<char, 3>> line{}; // 3 bytes per tag: id characters and type
+                    while (!dictionary.at_end())
+                    {
+                        if (dictionary.remaining().front() == '\0') // lines are NUL-terminated
+                        {
+                            dictionary.take(1);
+                            compression_header.tag_lines.push_back(std::move(line));
+                            line.clear();
+                            continue;
+                        }
+
+                        std::string_view const entry = dictionary.take(3);
+                        line.push_back({entry[0], entry[1], entry[2]});
+                    }
+
+                    if (!line.empty())
+                        throw format_error{"[CORRUPTED CRAM FILE] Unterminated tag dictionary line."};
+                }
+                else
+                {
+                    throw format_error{std::string{"[CORRUPTED CRAM FILE] Unknown preservation map key: "} +
+                                       std::string{key}};
+                }
+            }
+
+            if (compression_header.tag_lines.empty()) // no TD entry: all records use an empty tag line
+                compression_header.tag_lines.emplace_back();
+        }
+
+        { // data series encoding map
+            cursor.take_itf8(); // size in bytes
+            int32_t const n_entries = cursor.take_itf8();
+
+            for (int32_t i = 0; i < n_entries; ++i)
+            {
+                std::string_view const key = cursor.take(2);
+                uint16_t const series = (static_cast<uint16_t>(key[0]) << 8) | static_cast<uint16_t>(key[1]);
+                compression_header.data_series[series] = parse_encoding(cursor);
+            }
+        }
+
+        { // tag encoding map
+            cursor.take_itf8(); // size in bytes
+            int32_t const n_entries = cursor.take_itf8();
+
+            for (int32_t i = 0; i < n_entries; ++i)
+            {
+                int32_t const key = cursor.take_itf8(); // tag character 1, tag character 2 and type, one byte each
+                compression_header.tag_encodings[key] = parse_encoding(cursor);
+            }
+        }
+
+        return compression_header;
+    }
+
+    //!\brief Parses the header block of a slice.
+    cram_slice_header parse_slice_header(cram_block const & block)
+    {
+        cram_slice_header slice{};
+        detail::cram_data_cursor cursor{block.data};
+
+        slice.ref_seq_id     = cursor.take_itf8();
+        slice.start          = cursor.take_itf8();
+        slice.span           = cursor.take_itf8();
+        slice.n_records      = cursor.take_itf8();
+        slice.record_counter = cursor.take_ltf8();
+        slice.n_blocks       = cursor.take_itf8();
+
+        int32_t const n_content_ids = cursor.take_itf8();
+        for (int32_t i = 0; i < n_content_ids; ++i)
+            cursor.take_itf8(); // the content ids are repeated in the block headers
+
+        slice.embedded_ref_id = cursor.take_itf8();
+        // the remainder (md5 checksum of the covered reference region, optional tags) is not needed
+
+        return slice;
+    }
+
+    /*!\name Decoding single values
+     * \brief The per-encoding dispatch; integers and bytes come from the core bit stream or external blocks.
+     * \{
+     */
+    //!\brief Decodes one integer value with the given encoding.
+    int32_t decode_int(cram_encoding const & encoding, cram_slice_context & context)
+    {
+        switch (encoding.codec)
+        {
+            case cram_encoding::null_codec:
+            {
+                return 0;
+            }
+            case cram_encoding::external:
+            {
+                return external_cursor(encoding.external_id, context).take_itf8();
+            }
+            case cram_encoding::huffman:
+            {
+                return decode_huffman(encoding, context);
+            }
+            case cram_encoding::beta:
+            {
+                return static_cast<int32_t>(context.core.read_bits(encoding.beta_bits)) - encoding.beta_offset;
+            }
+            default:
+                throw format_error{"Unsupported CRAM encoding for an integer data series."};
+        }
+    }
+
+    //!\brief Decodes one byte value with the given encoding.
+    uint8_t decode_byte(cram_encoding const & encoding, cram_slice_context & context)
+    {
+        switch (encoding.codec)
+        {
+            case cram_encoding::external:
+            {
+                return external_cursor(encoding.external_id, context).take_byte();
+            }
+            case cram_encoding::huffman:
+            {
+                return static_cast<uint8_t>(decode_huffman(encoding, context));
+            }
+            case cram_encoding::beta:
+            {
+                return static_cast<uint8_t>(context.core.read_bits(encoding.beta_bits) - encoding.beta_offset);
+            }
+            default:
+                throw format_error{"Unsupported CRAM encoding for a byte data series."};
+        }
+    }
+
+    //!\brief Decodes one byte array with the given encoding.
+    std::string decode_array(cram_encoding const & encoding, cram_slice_context & context)
+    {
+        switch (encoding.codec)
+        {
+            case cram_encoding::byte_array_stop:
+            {
+                detail::cram_data_cursor & cursor = external_cursor(encoding.external_id, context);
+                std::string_view const remaining = cursor.remaining();
+                size_t const length = remaining.find(static_cast<char>(encoding.stop_byte));
+
+                if (length == std::string_view::npos)
+                    throw format_error{"[CORRUPTED CRAM FILE] Unterminated BYTE_ARRAY_STOP value."};
+
+                std::string value{cursor.take(length)};
+                cursor.take(1); // skip the stop byte
+                return value;
+            }
+            case cram_encoding::byte_array_len:
+            {
+                if (!encoding.length_encoding || !encoding.value_encoding)
+                    throw format_error{"[CORRUPTED CRAM FILE] Incomplete BYTE_ARRAY_LEN encoding."};
+
+                int32_t const length = decode_int(*encoding.length_encoding, context);
+                if (length < 0)
+                    throw format_error{"[CORRUPTED CRAM FILE] Negative BYTE_ARRAY_LEN length."};
+
+                if (encoding.value_encoding->codec == cram_encoding::external) // bulk copy
+                    return std::string{external_cursor(encoding.value_encoding->external_id, context).take(length)};
+
+                std::string value(length, '\0');
+                for (int32_t i = 0; i < length; ++i)
+                    value[i] = static_cast<char>(decode_byte(*encoding.value_encoding, context));
+                return value;
+            }
+            default:
+                throw format_error{"Unsupported CRAM encoding for a byte array data series."};
+        }
+    }
+
+    //!\brief Decodes one canonical huffman code word off the core bit stream.
+    int32_t decode_huffman(cram_encoding const & encoding, cram_slice_context & context)
+    {
+        if (encoding.huffman_codes.empty())
+            throw format_error{"[CORRUPTED CRAM FILE] Empty huffman code table."};
+
+        if (encoding.huffman_codes.size() == 1) // single-symbol tables use zero bits (the common case)
+            return encoding.huffman_codes[0][2];
+
+        int32_t code{0};
+        int32_t length{0};
+
+        for (auto const & [code_length, code_value, symbol] : encoding.huffman_codes)
+        {
+            while (length < code_length)
+            {
+                code = (code << 1) | context.core.read_bit();
+                ++length;
+            }
+
+            if (code == code_value)
+                return symbol;
+        }
+
+        throw format_error{"[CORRUPTED CRAM FILE] Invalid huffman code word in the core data block."};
+    }
+    //!\}
+
+    //!\brief Returns the cursor of the external block with the given id (throws if there is none).
+    detail::cram_data_cursor & external_cursor(int32_t const content_id, cram_slice_context & context)
+    {
+        auto it = context.external.find(content_id);
+
+        if (it == context.external.end())
+            throw format_error{"[CORRUPTED CRAM FILE] An encoding references a non-existent external block."};
+
+        return it->second;
+    }
+
+    //!\brief Looks up the encoding of a data series (throws if the series was not declared).
+    cram_encoding const & series_encoding(cram_compression_header const & compression_header, uint16_t const key)
+    {
+        auto it = compression_header.data_series.find(key);
+
+        if (it == compression_header.data_series.end())
+            throw format_error{"[CORRUPTED CRAM FILE] A record requires a data series that has no encoding."};
+
+        return it->second;
+    }
+
+    /*!\brief Loads the records of the next non-empty container into the record buffer.
+     * \tparam stream_t      The input stream type.
+     * \tparam ref_ids_type  The type of the reference ids in the header.
+     * \tparam ref_seqs_type The type of the reference sequences (or decltype(std::ignore)).
+     *
+     * \param[in, out] stream   The input stream to read from.
+     * \param[in]      header   The header (for the read group names).
+     * \param[in]      ref_seqs The reference sequences (or std::ignore).
+     *
+     * \returns `true` if records were loaded, `false` if the end of the file was reached.
+     *
+     * \details
+     *
+     * Containers without records (most importantly the mandatory EOF container at the end of every CRAM
+     * file) are skipped, so reaching the last record of a file leaves the stream at its very end.
+     */
+    template <typename stream_t, typename ref_ids_type, typename ref_seqs_type>
+    bool load_records(stream_t & stream, alignment_file_header<ref_ids_type> const & header,
+                      ref_seqs_type & ref_seqs)
+    {
+        record_buffer.clear();
+        record_buffer_position = 0;
+
+        std::string payload{};
+
+        while (true)
+        {
+            if (stream.peek() == stream_t::traits_type::eof()) // no more containers
+                return false;
+
+            if (read_container(stream, payload) == 0) // e.g. the EOF container
+                continue;
+
+            detail::cram_data_cursor cursor{payload};
+
+            cram_block const first_block = read_block(cursor);
+            if (first_block.content_type != 1) // COMPRESSION_HEADER
+                throw format_error{"[CORRUPTED CRAM FILE] A container with records must start with a "
+                                   "compression header."};
+
+            cram_compression_header const compression_header = parse_compression_header(first_block);
+
+            while (!cursor.at_end())
+            {
+                cram_block const block = read_block(cursor);
+
+                if (block.content_type != 2) // SLICE_HEADER
+                    continue;
+
+                cram_slice_header const slice = parse_slice_header(block);
+
+                // the slice's data blocks: the core block first, then the external blocks
+                cram_slice_context context{};
+                std::vector<std::string> block_storage{}; // keeps the decompressed data alive for the cursors
+                block_storage.reserve(slice.n_blocks);
+                std::string_view embedded_ref{};
+
+                for (int32_t i = 0; i < slice.n_blocks; ++i)
+                {
+                    cram_block data_block = read_block(cursor);
+                    block_storage.push_back(std::move(data_block.data));
+
+                    if (data_block.content_type == 5) // CORE_DATA
+                        context.core = detail::cram_bit_reader{block_storage.back()};
+                    else
+                        context.external.emplace(data_block.content_id,
+                                                 detail::cram_data_cursor{block_storage.back()});
+
+                    if (data_block.content_id == slice.embedded_ref_id && slice.embedded_ref_id >= 0)
+                        embedded_ref = block_storage.back();
+                }
+
+                decode_slice(compression_header, slice, context, embedded_ref, header, ref_seqs);
+            }
+
+            if (!record_buffer.empty())
+                return true;
+        }
+    }
+
+    /*!\brief Decodes all records of one slice into the record buffer.
+     * \tparam ref_ids_type  The type of the reference ids in the header.
+     * \tparam ref_seqs_type The type of the reference sequences (or decltype(std::ignore)).
+     *
+     * \param[in]      compression_header The compression header of the enclosing container.
+     * \param[in]      slice              The slice header.
+     * \param[in, out] context            The core/external decoding state of the slice.
+     * \param[in]      embedded_ref       The embedded reference bases of the slice (may be empty).
+     * \param[in]      header             The header (for the read group names).
+     * \param[in]      ref_seqs           The reference sequences (or std::ignore).
+     */
+    template <typename ref_ids_type, typename ref_seqs_type>
+    void decode_slice(cram_compression_header const & compression_header,
+                      cram_slice_header const & slice,
+                      cram_slice_context & context,
+                      std::string_view const embedded_ref,
+                      alignment_file_header<ref_ids_type> const & header,
+                      ref_seqs_type & ref_seqs)
+    {
+        // looks up one reference base (0-based position) for reference-based sequence reconstruction
+        auto ref_base_at = [&] (int32_t const ref_idx, int32_t const position) -> char
+        {
+            if constexpr (!detail::decays_to_ignore_v<ref_seqs_type>)
+            {
+                if (ref_idx < 0 || static_cast<size_t>(ref_idx) >= std::ranges::size(ref_seqs) ||
+                    position < 0 || static_cast<size_t>(position) >= std::ranges::size(ref_seqs[ref_idx]))
+                    throw format_error{"[CORRUPTED CRAM FILE] A record references a position outside of "
+                                       "the reference sequences."};
+
+                return to_char(ref_seqs[ref_idx][position]);
+            }
+            else
+            {
+                if (ref_idx == slice.ref_seq_id && !embedded_ref.empty())
+                {
+                    int32_t const embedded_position = position - (slice.start - 1);
+
+                    if (embedded_position < 0 || static_cast<size_t>(embedded_position) >= embedded_ref.size())
+                        throw format_error{"[CORRUPTED CRAM FILE] A record references a position outside of "
+                                           "the embedded reference of its slice."};
+
+                    return embedded_ref[embedded_position];
+                }
+
+                throw format_error{"Decoding this CRAM file requires the reference sequences; "
+                                   "pass them to the alignment file on construction."};
+            }
+        };
+
+        auto ref_base_index = [] (char const base) -> size_t // row of the substitution matrix
+        {
+            switch (base)
+            {
+                case 'A': case 'a': return 0;
+                case 'C': case 'c': return 1;
+                case 'G': case 'g': return 2;
+                case 'T': case 't': return 3;
+                default:            return 4; // 'N'
+            }
+        };
+
+        int32_t previous_position = slice.start; // for delta encoded alignment positions
+
+        for (int32_t record_index = 0; record_index < slice.n_records; ++record_index)
+        {
+            cram_alignment_record record{};
+
+            int32_t const bam_flags  = decode_int(series_encoding(compression_header, series_key("BF")), context);
+            int32_t const cram_flags = decode_int(series_encoding(compression_header, series_key("CF")), context);
+
+            record.flag = static_cast<uint16_t>(bam_flags);
+
+            record.ref_id = (slice.ref_seq_id == -2) // -2 marks a multi-reference slice
+                          ? decode_int(series_encoding(compression_header, series_key("RI")), context)
+                          : slice.ref_seq_id;
+
+            int32_t const read_length =
+                decode_int(series_encoding(compression_header, series_key("RL")), context);
+            if (read_length < 0)
+                throw format_error{"[CORRUPTED CRAM FILE] Negative read length."};
+
+            int32_t const position_value =
+                decode_int(series_encoding(compression_header, series_key("AP")), context);
+            int32_t const position_1_based = compression_header.ap_delta ? previous_position + position_value
+                                                                         : position_value;
+            if (compression_header.ap_delta)
+                previous_position = position_1_based;
+            record.position = position_1_based - 1; // CRAM positions are 1-based
+
+            int32_t const read_group =
+                decode_int(series_encoding(compression_header, series_key("RG")), context);
+            if (read_group >= 0 && static_cast<size_t>(read_group) < header.read_groups.size())
+                record.tags[static_cast<uint16_t>(('R' << 8) | 'G')] = header.read_groups[read_group].first;
+
+            if (compression_header.read_names_included)
+                record.read_name = decode_array(series_encoding(compression_header, series_key("RN")), context);
+
+            // mate information
+            int32_t mate_downstream_distance{-1};
+            if (cram_flags & 0x2) // the mate is detached (not in this slice)
+            {
+                int32_t const mate_flags =
+                    decode_int(series_encoding(compression_header, series_key("MF")), context);
+                if (mate_flags & 0x1)
+                    record.flag |= 0x20; // the mate is reverse complemented
+                if (mate_flags & 0x2)
+                    record.flag |= 0x8;  // the mate is unmapped
+
+                if (!compression_header.read_names_included)
+                    record.read_name = decode_array(series_encoding(compression_header, series_key("RN")), context);
+
+                record.mate_ref_id =
+                    decode_int(series_encoding(compression_header, series_key("NS")), context);
+                record.mate_position =
+                    decode_int(series_encoding(compression_header, series_key("NP")), context) - 1;
+                record.template_length =
+                    decode_int(series_encoding(compression_header, series_key("TS")), context);
+            }
+            else if (cram_flags & 0x4) // the mate is a downstream record of this slice
+            {
+                mate_downstream_distance =
+                    decode_int(series_encoding(compression_header, series_key("NF")), context);
+            }
+
+            // optional tags (the tag line of a record lists which tags it carries)
+            int32_t const tag_line_index =
+                decode_int(series_encoding(compression_header, series_key("TL")), context);
+            if (tag_line_index < 0 ||
+                static_cast<size_t>(tag_line_index) >= compression_header.tag_lines.size())
+                throw format_error{"[CORRUPTED CRAM FILE] Tag line index of a record exceeds the tag dictionary."};
+
+            for (auto const & [tag_char_1, tag_char_2, tag_type] :
+                     compression_header.tag_lines[tag_line_index])
+            {
+                int32_t const tag_key = (static_cast<int32_t>(static_cast<uint8_t>(tag_char_1)) << 16) |
+                                        (static_cast<int32_t>(static_cast<uint8_t>(tag_char_2)) << 8) |
+                                        static_cast<int32_t>(static_cast<uint8_t>(tag_type));
+
+                auto it = compression_header.tag_encodings.find(tag_key);
+                if (it == compression_header.tag_encodings.end())
+                    throw format_error{"[CORRUPTED CRAM FILE] A tag of a record has no encoding."};
+
+                uint16_t const tag = (static_cast<uint16_t>(static_cast<uint8_t>(tag_char_1)) << 8) |
+                                     static_cast<uint16_t>(static_cast<uint8_t>(tag_char_2));
+                parse_tag_value(tag, tag_type, decode_array(it->second, context), record.tags);
+            }
+
+            // sequence, cigar and qualities
+            if (!(bam_flags & 0x4)) // a mapped record: the sequence is stored as differences to the reference
+            {
+                decode_mapped_record(record, read_length, compression_header, context,
+                                     ref_base_at, ref_base_index);
+
+                record.mapq =
+                    static_cast<uint8_t>(decode_int(series_encoding(compression_header, series_key("MQ")), context));
+            }
+            else // an unmapped record: the sequence is stored verbatim
+            {
+                cram_encoding const & base_encoding = series_encoding(compression_header, series_key("BA"));
+
+                record.sequence.resize(read_length);
+                for (int32_t i = 0; i < read_length; ++i)
+                    record.sequence[i] = static_cast<char>(decode_byte(base_encoding, context));
+            }
+
+            if (cram_flags & 0x1) // the quality scores are stored as an array
+            {
+                cram_encoding const & quality_encoding =
+                    series_encoding(compression_header, series_key("QS"));
+
+                if (quality_encoding.codec == cram_encoding::external) // bulk copy
+                {
+                    std::string_view const raw =
+                        external_cursor(quality_encoding.external_id, context).take(read_length);
+                    record.qualities.assign(raw);
+                }
+                else
+                {
+                    record.qualities.resize(read_length);
+                    for (int32_t i = 0; i < read_length; ++i)
+                        record.qualities[i] = static_cast<char>(decode_byte(quality_encoding, context));
+                }
+
+                for (char & q : record.qualities) // raw phred values -> offset-33 representation
+                    q = static_cast<char>(q + 33);
+            }
+
+            if (mate_downstream_distance >= 0) // resolved once the mate has been decoded, see below
+                pending_mate_pairs.emplace_back(record_buffer.size(),
+                                                record_buffer.size() + 1 + mate_downstream_distance);
+
+            record_buffer.push_back(std::move(record));
+        }
+
+        // resolve mate pairs stored within the slice (both records are in the buffer now)
+        for (auto const & [first_index, second_index] : pending_mate_pairs)
+        {
+            if (second_index >= record_buffer.size())
+                throw format_error{"[CORRUPTED CRAM FILE] A record's mate distance points beyond its slice."};
+
+            cram_alignment_record & first  = record_buffer[first_index];
+            cram_alignment_record & second = record_buffer[second_index];
+
+            first.mate_ref_id    = second.ref_id;
+            first.mate_position  = second.position;
+            second.mate_ref_id   = first.ref_id;
+            second.mate_position = first.position;
+
+            if (second.flag & 0x10)
+                first.flag |= 0x20;
+            if (second.flag & 0x4)
+                first.flag |= 0x8;
+            if (first.flag & 0x10)
+                second.flag |= 0x20;
+            if (first.flag & 0x4)
+                second.flag |= 0x8;
+
+            // the template length spans from the leftmost start to the rightmost end
+            int32_t const first_end  = first.position + cigar_reference_length(first.cigar);
+            int32_t const second_end = second.position + cigar_reference_length(second.cigar);
+            int32_t const length     = std::max(first_end, second_end) -
+                                       std::min(first.position, second.position);
+
+            if (first.position <= second.position)
+            {
+                first.template_length  = length;
+                second.template_length = -length;
+            }
+            else
+            {
+                first.template_length  = -length;
+                second.template_length = length;
+            }
+        }
+        pending_mate_pairs.clear();
+    }
+
+    /*!\brief Decodes the sequence and cigar of a mapped record from its read features.
+     * \tparam ref_base_at_t    The type of the reference base lookup.
+     * \tparam ref_base_index_t The type of the substitution matrix row lookup.
+     *
+     * \param[in, out] record             The record to fill.
+     * \param[in]      read_length        The length of the read.
+     * \param[in]      compression_header The compression header of the enclosing container.
+     * \param[in, out] context            The core/external decoding state of the slice.
+     * \param[in]      ref_base_at        Returns the reference base at a 0-based position.
+     * \param[in]      ref_base_index     Returns the substitution matrix row of a reference base.
+     *
+     * \details
+     *
+     * Read positions between features are filled from the reference (an implicit match); the read features
+     * describe all differences (substitutions, indels, clips, verbatim base stretches, ...).
+     */
+    template <typename ref_base_at_t, typename ref_base_index_t>
+    void decode_mapped_record(cram_alignment_record & record,
+                              int32_t const read_length,
+                              cram_compression_header const & compression_header,
+                              cram_slice_context & context,
+                              ref_base_at_t && ref_base_at,
+                              ref_base_index_t && ref_base_index)
+    {
+        int32_t read_position{1};                // 1-based position of the next read base to reconstruct
+        int32_t reference_position{record.position}; // 0-based position of the corresponding reference base
+
+        auto append_cigar = [&record] (char const operation, size_t const count)
+        {
+            if (count == 0)
+                return;
+            if (!record.cigar.empty() && record.cigar.back().first == operation)
+                record.cigar.back().second += count;
+            else
+                record.cigar.emplace_back(operation, count);
+        };
+
+        auto fill_matches = [&] (int32_t const until) // copy [read_position, until) from the reference
+        {
+            int32_t const count = until - read_position;
+            if (count < 0)
+                throw format_error{"[CORRUPTED CRAM FILE] Read features are not sorted by position."};
+
+            for (int32_t i = 0; i < count; ++i)
+                record.sequence += ref_base_at(record.ref_id, reference_position + i);
+
+            append_cigar('M', count);
+            read_position      += count;
+            reference_position += count;
+        };
+
+        int32_t const n_features =
+            decode_int(series_encoding(compression_header, series_key("FN")), context);
+        int32_t feature_position{0};
+
+        for (int32_t feature_index = 0; feature_index < n_features; ++feature_index)
+        {
+            uint8_t const feature_code =
+                decode_byte(series_encoding(compression_header, series_key("FC")), context);
+            feature_position += decode_int(series_encoding(compression_header, series_key("FP")), context);
+
+            fill_matches(feature_position);
+
+            switch (feature_code)
+            {
+                case 'X': // a substitution, stored as a code into the substitution matrix
+                {
+                    uint8_t const code =
+                        decode_byte(series_encoding(compression_header, series_key("BS")), context);
+                    if (code > 3)
+                        throw format_error{"[CORRUPTED CRAM FILE] Invalid substitution code."};
+
+                    char const reference_base = ref_base_at(record.ref_id, reference_position);
+                    record.sequence +=
+                        compression_header.substitution_matrix[ref_base_index(reference_base)][code];
+                    append_cigar('M', 1);
+                    ++read_position;
+                    ++reference_position;
+                    break;
+                }
+                case 'B': // a verbatim base with its quality score
+                {
+                    record.sequence += static_cast<char>(
+                        decode_byte(series_encoding(compression_header, series_key("BA")), context));
+                    decode_byte(series_encoding(compression_header, series_key("QS")), context); // see CF & 0x1
+                    append_cigar('M', 1);
+                    ++read_position;
+                    ++reference_position;
+                    break;
+                }
+                case 'b': // a stretch of verbatim bases
+                {
+                    std::string const bases =
+                        decode_array(series_encoding(compression_header, series_key("BB")), context);
+                    record.sequence += bases;
+                    append_cigar('M', bases.size());
+                    read_position      += static_cast<int32_t>(bases.size());
+                    reference_position += static_cast<int32_t>(bases.size());
+                    break;
+                }
+                case 'I': // an insertion of several bases
+                {
+                    std::string const bases =
+                        decode_array(series_encoding(compression_header, series_key("IN")), context);
+                    record.sequence += bases;
+                    append_cigar('I', bases.size());
+                    read_position += static_cast<int32_t>(bases.size());
+                    break;
+                }
+                case 'i': // an insertion of a single base
+                {
+                    record.sequence += static_cast<char>(
+                        decode_byte(series_encoding(compression_header, series_key("BA")), context));
+                    append_cigar('I', 1);
+                    ++read_position;
+                    break;
+                }
+                case 'S': // a soft clip
+                {
+                    std::string const bases =
+                        decode_array(series_encoding(compression_header, series_key("SC")), context);
+                    record.sequence += bases;
+                    append_cigar('S', bases.size());
+                    read_position += static_cast<int32_t>(bases.size());
+                    break;
+                }
+                case 'D': // a deletion
+                {
+                    int32_t const length =
+                        decode_int(series_encoding(compression_header, series_key("DL")), context);
+                    append_cigar('D', length);
+                    reference_position += length;
+                    break;
+                }
+                case 'N': // a reference skip
+                {
+                    int32_t const length =
+                        decode_int(series_encoding(compression_header, series_key("RS")), context);
+                    append_cigar('N', length);
+                    reference_position += length;
+                    break;
+                }
+                case 'H': // a hard clip
+                {
+                    int32_t const length =
+                        decode_int(series_encoding(compression_header, series_key("HC")), context);
+                    append_cigar('H', length);
+                    break;
+                }
+                case 'P': // padding
+                {
+                    int32_t const length =
+                        decode_int(series_encoding(compression_header, series_key("PD")), context);
+                    append_cigar('P', length);
+                    break;
+                }
+                case 'Q': // a single quality score (the base is an implicit match)
+                {
+                    decode_byte(series_encoding(compression_header, series_key("QS")), context); // see CF & 0x1
+                    fill_matches(feature_position + 1);
+                    break;
+                }
+                case 'q': // a stretch of quality scores (the bases are implicit matches)
+                {
+                    std::string const scores =
+                        decode_array(series_encoding(compression_header, series_key("QQ")), context);
+                    fill_matches(feature_position + static_cast<int32_t>(scores.size()));
+                    break;
+                }
+                default:
+                    throw format_error{std::string{"[CORRUPTED CRAM FILE] Unknown read feature code: "} +
+                                       detail::make_printable(static_cast<char>(feature_code))};
+            }
+        }
+
+        fill_matches(read_length + 1); // the remainder of the read matches the reference
+    }
+
+    //!\brief Computes the length of the reference region covered by a cigar (for the template length).
+    static int32_t cigar_reference_length(std::vector<std::pair<char, size_t>> const & cigar) noexcept
+    {
+        int32_t length{0};
+        for (auto const & [operation, count] : cigar)
+            if (operation == 'M' || operation == '=' || operation == 'X' || operation == 'D' || operation == 'N')
+                length += count;
+        return length;
+    }
+
+    /*!\brief Parses the value bytes of one optional tag (BAM value encoding) into the tag dictionary.
+     * \param[in]      tag    The two-character tag id.
+     * \param[in]      type   The type character of the tag ([A,cCsSiI,Z,H,B,f]).
+     * \param[in]      bytes  The value bytes.
+     * \param[in, out] target The seqan3::sam_tag_dictionary to store the tag information.
+     *
+     * \throws seqan3::format_error if an unknown tag type was encountered or the value is truncated.
+     */
+    void parse_tag_value(uint16_t const tag, char const type, std::string const & bytes,
+                         sam_tag_dictionary & target)
+    {
+        detail::cram_data_cursor cursor{bytes};
+
+        auto read_value = [&cursor] (auto & value) // read one little-endian encoded value
+        {
+            std::memcpy(&value, cursor.take(sizeof(value)).data(), sizeof(value));
+        };
+
+        auto read_array = [&] (auto && dict_entry, auto value)
+        {
+            int32_t count{};
+            read_value(count);
+
+            std::vector<decltype(value)> tmp_vector{};
+            tmp_vector.reserve(count);
+            for (int32_t i = 0; i < count; ++i)
+            {
+                read_value(value);
+                tmp_vector.push_back(value);
+            }
+            dict_entry = std::move(tmp_vector);
+        };
+
+        switch (type)
+        {
+            case 'A' : // char
+            {
+                target[tag] = static_cast<char>(cursor.take_byte());
+                break;
+            }
+            // all integer types are stored as int32_t in the dictionary (as for SAM)
+            case 'c' : { int8_t   tmp{}; read_value(tmp); target[tag] = static_cast<int32_t>(tmp); break; }
+            case 'C' : { uint8_t  tmp{}; read_value(tmp); target[tag] = static_cast<int32_t>(tmp); break; }
+            case 's' : { int16_t  tmp{}; read_value(tmp); target[tag] = static_cast<int32_t>(tmp); break; }
+            case 'S' : { uint16_t tmp{}; read_value(tmp); target[tag] = static_cast<int32_t>(tmp); break; }
+            case 'i' : { int32_t  tmp{}; read_value(tmp); target[tag] = tmp;                       break; }
+            case 'I' : { uint32_t tmp{}; read_value(tmp); target[tag] = static_cast<int32_t>(tmp); break; }
+            case 'f' : // float
+            {
+                float tmp{};
+                read_value(tmp);
+                target[tag] = tmp;
+                break;
+            }
+            case 'Z' : case 'H' : // string and hex string (stored with their NUL terminator)
+            {
+                std::string value{bytes};
+                if (!value.empty() && value.back() == '\0')
+                    value.pop_back();
+                target[tag] = std::move(value);
+                break;
+            }
+            case 'B' : // Array. Value type depends on second char [cCsSiIf]
+            {
+                char const array_value_type_id = static_cast<char>(cursor.take_byte());
+
+                switch (array_value_type_id)
+                {
+                    case 'c' : { read_array(target[tag], int8_t{});   break; }
+                    case 'C' : { read_array(target[tag], uint8_t{});  break; }
+                    case 's' : { read_array(target[tag], int16_t{});  break; }
+                    case 'S' : { read_array(target[tag], uint16_t{}); break; }
+                    case 'i' : { read_array(target[tag], int32_t{});  break; }
+                    case 'I' : { read_array(target[tag], uint32_t{}); break; }
+                    case 'f' : { read_array(target[tag], float{});    break; }
+                    default:
+                        throw format_error{std::string("The first character in the numerical ") +
+                                           "id of a SAM tag must be one of [cCsSiIf] but " + array_value_type_id +
+                                           " was given."};
+                }
+                break;
+            }
+            default:
+                throw format_error{std::string("The second character in the numerical id of a "
+                                   "SAM tag must be one of [A,cCsSiI,Z,H,B,f] but ") + type + " was given."};
+        }
+    }
+
+    //!\brief Records whose mate is a downstream record of the same slice (buffer indices, resolved per slice).
+    std::vector<std::pair<size_t, size_t>> pending_mate_pairs{};
+};
+
+} // namespace seqan3
@@ -28,6 +28,8 @@
 #include <seqan3/io/alignment_file/input_options.hpp>
 #include <seqan3/io/alignment_file/output_options.hpp>
 #include <seqan3/io/alignment_file/sam_tag_dictionary.hpp>
+#include <seqan3/io/detail/fast_istreambuf_iterator.hpp>
+#include <seqan3/io/detail/fast_streambuf_skip.hpp>
 #include <seqan3/io/detail/ignore_output_iterator.hpp>
 #include <seqan3/io/detail/misc.hpp>
 #include <seqan3/io/stream/parse_condition.hpp>
@@ -156,7 +158,7 @@ public:
               typename e_value_type,
               typename bit_score_type>
     void read(stream_type                                             & stream,
-              alignment_file_input_options<seq_legal_alph_type> const & SEQAN3_DOXYGEN_ONLY(options),
+              alignment_file_input_options<seq_legal_alph_type> const & options,
               ref_seqs_type                                           & ref_seqs,
               alignment_file_header<ref_ids_type>                     & header,
               seq_type                                                & seq,
@@ -178,9 +180,9 @@ public:
                       detail::is_type_specialisation_of_v<ref_offset_type, std::optional>,
                       "The ref_offset must be a specialisation of std::optional.");
 
-        using stream_buf_t = std::istreambuf_iterator<typename stream_type::char_type>;
-        auto stream_view = std::ranges::subrange<decltype(stream_buf_t{stream}), decltype(stream_buf_t{})>
-                               {stream_buf_t{stream}, stream_buf_t{}};
+        using stream_buf_t = detail::fast_istreambuf_iterator<typename stream_type::char_type>;
+        auto stream_view = std::ranges::subrange<stream_buf_t, std::ranges::default_sentinel_t>
+                               {stream_buf_t{*stream.rdbuf()}, std::ranges::default_sentinel};
 
         auto next_field = view::take_until_or_throw(is_char<'\t'>);
 
@@ -198,16 +200,23 @@ public:
         {
             read_header(stream_view, header, ref_seqs);
 
-            if (stream_buf_t{stream} == stream_buf_t{}) // file has no records
+            if (std::ranges::begin(stream_view) == std::ranges::end(stream_view)) // file has no records
                 return;
         }
 
         // Fields 1-5: ID FLAG REF_ID REF_OFFSET MAPQ
         // -------------------------------------------------------------------------------------------------------------
-        read_field(stream_view | next_field, id);
+        // columns that are not requested are skipped at buffer level instead of being scanned character-wise
+        if constexpr (detail::decays_to_ignore_v<id_type>)
+            detail::fast_skip_until(*stream.rdbuf(), '\t');
+        else
+            read_field(stream_view | next_field, id);
         std::ranges::next(std::ranges::begin(stream_view)); // skip tab
 
-        read_field(stream_view | next_field, flag);
+        if constexpr (detail::decays_to_ignore_v<flag_type>)
+            detail::fast_skip_until(*stream.rdbuf(), '\t');
+        else
+            read_field(stream_view | next_field, flag);
         std::ranges::next(std::ranges::begin(stream_view));
 
         read_field(stream_view | next_field, ref_id_tmp);
@@ -224,7 +233,10 @@ public:
             throw format_error{"No negative values are allowed for field::REF_OFFSET."};
         // ref_offset_tmp == 0 indicates an unmapped read -> out-param ref_offset (std::optional) will not be filled
 
-        read_field(stream_view | next_field, mapq);
+        if constexpr (detail::decays_to_ignore_v<mapq_type>)
+            detail::fast_skip_until(*stream.rdbuf(), '\t');
+        else
+            read_field(stream_view | next_field, mapq);
         std::ranges::next(std::ranges::begin(stream_view));
 
         // Field 6: CIGAR
@@ -243,7 +255,7 @@ public:
         }
         else
         {
-            detail::consume(stream_view | next_field);
+            detail::fast_skip_until(*stream.rdbuf(), '\t');
         }
 
         offset = offset_tmp;
@@ -288,7 +300,7 @@ public:
         {
             for (size_t i = 0; i < 3u; ++i)
             {
-                detail::consume(stream_view | next_field);
+                detail::fast_skip_until(*stream.rdbuf(), '\t');
                 std::ranges::next(std::ranges::begin(stream_view));
             }
         }
@@ -340,7 +352,7 @@ public:
                 }
                 else
                 {
-                    detail::consume(seq_stream);
+                    detail::fast_skip_until(*stream.rdbuf(), '\t'); // nobody sees this column, do not validate it
                 }
             }
             else
@@ -364,14 +376,41 @@ public:
         // Field 11:  Quality
         // -------------------------------------------------------------------------------------------------------------
         auto const tab_or_end = is_char<'\t'> || is_char<'\r'> || is_char<'\n'>;
-        read_field(stream_view | view::take_until_or_throw(tab_or_end), qual);
+        if constexpr (detail::decays_to_ignore_v<qual_type>)
+            detail::fast_skip_until(*stream.rdbuf(), '\t', '\r', '\n');
+        else
+            read_field(stream_view | view::take_until_or_throw(tab_or_end), qual);
 
         // All remaining optional fields if any: SAM tags dictionary
         // -------------------------------------------------------------------------------------------------------------
-        while (is_char<'\t'>(*std::ranges::begin(stream_view))) // read all tags if present
+        if constexpr (detail::decays_to_ignore_v<tag_dict_type>)
         {
-            std::ranges::next(std::ranges::begin(stream_view));
-            read_field(stream_view | view::take_until_or_throw(tab_or_end), tag_dict);
+            if (is_char<'\t'>(*std::ranges::begin(stream_view))) // skip all tag columns at once
+                detail::fast_skip_until(*stream.rdbuf(), '\r', '\n');
+        }
+        else
+        {
+            std::string raw_tag_buffer{};
+
+            while (is_char<'\t'>(*std::ranges::begin(stream_view))) // read all tags if present
+            {
+                std::ranges::next(std::ranges::begin(stream_view));
+
+                if (options.lazy_tags) // store the raw tag text; parsing happens on first access
+                {
+                    if (!raw_tag_buffer.empty())
+                        raw_tag_buffer.push_back('\t');
+
+                    std::ranges::copy(stream_view | view::take_until_or_throw(tab_or_end),
+                                      std::back_inserter(raw_tag_buffer));
+                    continue;
+                }
+
+                read_field(stream_view | view::take_until_or_throw(tab_or_end), tag_dict);
+            }
+
+            if (options.lazy_tags && !raw_tag_buffer.empty())
+                tag_dict.assign_raw_tags(std::move(raw_tag_buffer));
         }
 
         if (is_char<'\r'>(*std::ranges::begin(stream_view)))    // protect against '\r\n'
@@ -388,9 +427,9 @@ public:
             {
                 if constexpr (!detail::decays_to_ignore_v<ref_seqs_type>)
                 {
-                    assert(header.ref_dict.count(ref_id_tmp) != 0); // taken care of in check_and_assign_ref_id()
+                    assert(header.ref_dict().count(ref_id_tmp) != 0); // taken care of in check_and_assign_ref_id()
 
-                    size_t pos = header.ref_dict[ref_id_tmp]; // get index for reference sequence
+                    size_t pos = header.ref_dict()[ref_id_tmp]; // get index for reference sequence
 
                     assert(static_cast<size_t>(ref_offset_tmp + ref_length) <= std::ranges::size(ref_seqs[pos]));
 
@@ -554,13 +593,14 @@ public:
                       !std::Integral<std::remove_reference_t<ref_id_type>> &&
                       !detail::is_type_specialisation_of_v<std::remove_reference_t<ref_id_type>, std::optional>)
         {
-            static_assert(ImplicitlyConvertibleTo<ref_id_type &, typename decltype(header.ref_dict)::key_type>,
+            static_assert(ImplicitlyConvertibleTo<ref_id_type &,
+                                                  typename std::remove_reference_t<decltype(header.ref_dict())>::key_type>,
                       "The ref_id type is not convertible to the reference id information stored in the "
                       "reference dictionary of the header object.");
 
             if (options.sam_require_header && !std::ranges::empty(ref_id))
             {
-                if ((header.ref_dict).count(ref_id) == 0) // no reference id matched
+                if ((header.ref_dict()).count(ref_id) == 0) // no reference id matched
                     throw format_error{std::string("The ref_id '") + std::string(ref_id) +
                                        "' was not in the list of references"};
             }
@@ -718,9 +758,9 @@ protected:
     {
         if (!std::ranges::empty(ref_id_tmp)) // otherwise the std::optional will not be filled
         {
-            auto search = header.ref_dict.find(ref_id_tmp);
+            auto search = header.ref_dict().find(ref_id_tmp);
 
-            if (search == header.ref_dict.end())
+            if (search == header.ref_dict().end())
             {
                 if constexpr(detail::decays_to_ignore_v<ref_seqs_type>) // no reference information given
                 {
@@ -732,7 +772,7 @@ protected:
                     {
                         header.ref_ids().push_back(ref_id_tmp);
                         auto pos = std::ranges::size(header.ref_ids()) - 1;
-                        header.ref_dict[header.ref_ids()[pos]] = pos;
+                        header.ref_dict()[header.ref_ids()[pos]] = pos;
                         ref_id = pos;
                     }
                 }
@@ -1051,35 +1091,37 @@ protected:
             if (is_char<'S'>(*std::ranges::begin(stream_view)))              // SQ (sequence dictionary) tag
             {
                 ref_info_present_in_header = true;
-                std::string id;
-                std::tuple<int32_t, std::string> info{};
-
-                parse_tag_value(id);                                         // parse required SN (sequence name) tag
-                std::ranges::next(std::ranges::begin(stream_view));          // skip tab or newline
-                parse_tag_value(get<0>(info));                               // parse required LN (length) tag
 
-                if (is_char<'\t'>(*std::ranges::begin(stream_view)))         // read rest of the tags
-                {
-                    std::ranges::next(std::ranges::begin(stream_view));      // skip tab
-                    read_field(stream_view | view::take_until_or_throw(is_char<'\n'>), get<1>(info));
-                }
-                std::ranges::next(std::ranges::begin(stream_view));          // skip newline
-
-                /* If reference information were given, the ids exist and we can fill ref_dict directly.
-                 * If not, wee need to update the ids first and fill the reference dictionary afterwards. */
+                /* If reference information were given, the ids exist and we tokenise the line directly to check it
+                 * against the given information. If not, the raw line is merely buffered inside the header and only
+                 * tokenised once the reference information is accessed for the first time. */
                 if constexpr (!detail::decays_to_ignore_v<ref_seqs_type>) // reference information given
                 {
-                    auto id_it = hdr.ref_dict.find(id);
+                    std::string id;
+                    std::tuple<int32_t, std::string> info{};
+
+                    parse_tag_value(id);                                     // parse required SN (sequence name) tag
+                    std::ranges::next(std::ranges::begin(stream_view));      // skip tab or newline
+                    parse_tag_value(get<0>(info));                           // parse required LN (length) tag
+
+                    if (is_char<'\t'>(*std::ranges::begin(stream_view)))     // read rest of the tags
+                    {
+                        std::ranges::next(std::ranges::begin(stream_view));  // skip tab
+                        read_field(stream_view | view::take_until_or_throw(is_char<'\n'>), get<1>(info));
+                    }
+                    std::ranges::next(std::ranges::begin(stream_view));      // skip newline
 
-                    if (id_it == hdr.ref_dict.end())
+                    auto id_it = hdr.ref_dict().find(id);
+
+                    if (id_it == hdr.ref_dict().end())
                         throw format_error{"Unknown reference name found in SAM header."};
 
-                    auto & given_ref_info = hdr.ref_id_info[id_it->second];
+                    auto & given_ref_info = hdr.ref_id_info()[id_it->second];
 
                     if (std::get<0>(given_ref_info) != std::get<0>(info))
                         throw format_error{"Provided reference has unequal length as specified in the header."};
 
-                    hdr.ref_id_info[id_it->second] = std::move(info);
+                    hdr.ref_id_info()[id_it->second] = std::move(info);
                 }
                 else
                 {
@@ -1087,9 +1129,11 @@ protected:
                                   "The range over reference ids must be of type std::deque such that "
                                   "pointers are not invalidated.");
 
-                    hdr.ref_ids().push_back(id);
-                    hdr.ref_id_info.push_back(info);
-                    hdr.ref_dict[(hdr.ref_ids())[(hdr.ref_ids()).size() - 1]] = (hdr.ref_ids()).size() - 1;
+                    std::string raw_line{};
+                    read_field(stream_view | view::take_until_or_throw(is_char<'\n'>), raw_line);
+                    std::ranges::next(std::ranges::begin(stream_view));      // skip newline
+
+                    hdr.defer_sq_line(raw_line);
                 }
             }
             else if (is_char<'R'>(*std::ranges::begin(stream_view)))         // RG (read group) tag
@@ -1242,6 +1286,23 @@ protected:
 
             std::visit(stream_variant_fn, variant);
         }
+
+        // tags read lazily that were never accessed are still stored as raw text; write them back verbatim
+        std::string const & raw_tags = tag_dict.raw_tags();
+        for (size_t pos = 0; pos < raw_tags.size(); )
+        {
+            size_t field_end = raw_tags.find('\t', pos);
+            if (field_end == std::string::npos)
+                field_end = raw_tags.size();
+
+            if (field_end > pos)
+            {
+                stream << separator;
+                stream << std::string_view{raw_tags.data() + pos, field_end - pos};
+            }
+
+            pos = field_end + 1;
+        }
     }
 
     /*!\brief Writes the SAM header.
@@ -1318,7 +1379,7 @@ protected:
         detail::write_eol(stream_it, options.add_carriage_return);
 
         // (@SQ) Write Reference Sequence Dictionary lines [required].
-        for (auto const & [ref_name, ref_info] : std::view::zip(header.ref_ids(), header.ref_id_info))
+        for (auto const & [ref_name, ref_info] : std::view::zip(header.ref_ids(), header.ref_id_info()))
         {
             stream << "@SQ\tSN:";
 
@@ -13,11 +13,14 @@
 #pragma once
 
 #include <deque>
-#include <unordered_map>
+#include <string_view>
 #include <vector>
 
+#include <seqan3/alphabet/detail/hash.hpp>
 #include <seqan3/core/metafunction/pre.hpp>
 #include <seqan3/io/alignment_file/detail.hpp>
+#include <seqan3/io/exception.hpp>
+#include <seqan3/std/charconv>
 #include <seqan3/std/ranges>
 
 namespace seqan3
@@ -112,9 +115,13 @@ public:
      * 3) No reference information is provided on construction an no \@SQ tags are present in the header.
      *    In this case, the reference information is parsed from the records field::REF_ID and stored in the header.
      *    This member function then provides access to the unique list of reference ids encountered in the records.
+     *
+     * If \@SQ lines were buffered for deferred parsing (see defer_sq_line()), calling this function
+     * materialises them first.
      */
     ref_ids_type & ref_ids()
     {
+        materialise_sq_cache();
         return *ref_ids_ptr;
     }
 
@@ -154,11 +161,45 @@ public:
      * | UR  | URI of the sequence.  This value may start with one of the standard
      *         protocols, e.g http:  or ftp:. If it does not start with one of these
      *         protocols, it is assumed to be a file-system path |
+     *
+     * If \@SQ lines were buffered for deferred parsing (see defer_sq_line()), calling this function
+     * materialises them first.
      */
-    std::vector<std::tuple<int32_t, std::string>> ref_id_info{};
+    std::vector<std::tuple<int32_t, std::string>> & ref_id_info()
+    {
+        materialise_sq_cache();
+        return ref_id_info_;
+    }
 
-    //!\brief The mapping of reference id to position in the ref_ids() range and the ref_id_info range.
-    std::unordered_map<key_type, int32_t, std::hash<key_type>, detail::view_equality_fn> ref_dict{};
+    /*!\brief The mapping of reference id to position in the ref_ids() range and the ref_id_info() range.
+     *
+     * \details
+     *
+     * If \@SQ lines were buffered for deferred parsing (see defer_sq_line()), calling this function
+     * materialises them first.
+     */
+    detail::flat_reference_dictionary<key_type, int32_t> & ref_dict()
+    {
+        materialise_sq_cache();
+        return ref_dict_;
+    }
+
+    /*!\brief Buffers one raw \@SQ line for deferred parsing.
+     * \param[in] raw_line The line's content without the leading "\@" and without the trailing newline,
+     *                     i.e. "SQ\tSN:<name>\tLN:<length>[\t<further tags>]".
+     *
+     * \details
+     *
+     * The formats call this function while reading the header when no reference information was given by the
+     * user. The line is merely appended to an internal buffer; it is tokenised into ref_ids(), ref_id_info()
+     * and ref_dict() only when one of those functions is called for the first time. Thereby opening a file is
+     * independent of the number of \@SQ lines in its header.
+     */
+    void defer_sq_line(std::string_view const raw_line)
+    {
+        sq_cache_ += raw_line;
+        sq_cache_ += '\n';
+    }
 
     /*!\brief The Read Group Dictionary. (used by the SAM/BAM format)
      *
@@ -200,6 +241,64 @@ public:
      * | SM  | Sample. Use pool name where a pool is being sequenced. |
      */
     std::vector<std::pair<std::string, std::string>> read_groups;
+
+private:
+    //!\brief The reference information accessed via ref_id_info().
+    std::vector<std::tuple<int32_t, std::string>> ref_id_info_{};
+
+    //!\brief The reference dictionary accessed via ref_dict().
+    detail::flat_reference_dictionary<key_type, int32_t> ref_dict_{};
+
+    //!\brief Raw \@SQ lines buffered by defer_sq_line() that have not been tokenised yet.
+    std::string sq_cache_{};
+
+    /*!\brief Tokenises all buffered \@SQ lines into ref_ids(), ref_id_info() and ref_dict().
+     * \throws seqan3::format_error if a buffered line misses the SN or LN tag or if its LN value is not a number.
+     */
+    void materialise_sq_cache()
+    {
+        if (sq_cache_.empty())
+            return;
+
+        std::string cache{};
+        cache.swap(sq_cache_); // empty the buffer first so that the accessors below do not recurse
+
+        size_t line_begin = 0;
+        while (line_begin < cache.size())
+        {
+            size_t const line_end = cache.find('\n', line_begin); // always present; appended by defer_sq_line()
+            std::string_view const line{cache.data() + line_begin, line_end - line_begin};
+            line_begin = line_end + 1;
+
+            size_t id_begin = line.find(':'); // first colon, skips over "SQ\tSN"
+            if (id_begin == std::string_view::npos)
+                throw format_error{"The @SQ header line does not contain an SN tag."};
+            ++id_begin;
+
+            size_t const id_end = line.find('\t', id_begin);
+            if (id_end == std::string_view::npos)
+                throw format_error{"The @SQ header line does not contain an LN tag."};
+            std::string_view const id = line.substr(id_begin, id_end - id_begin);
+
+            size_t length_begin = line.find(':', id_end);
+            if (length_begin == std::string_view::npos)
+                throw format_error{"The @SQ header line does not contain an LN tag."};
+            ++length_begin;
+
+            int32_t length{};
+            auto const [ptr, errc] = std::from_chars(line.data() + length_begin, line.data() + line.size(), length);
+            if (errc != std::errc{})
+                throw format_error{"The LN tag of the @SQ header line does not contain a number."};
+
+            std::string further_tags{};
+            if (ptr != line.data() + line.size() && *ptr == '\t')
+                further_tags.assign(ptr + 1, line.data() + line.size());
+
+            ref_ids_ptr->push_back(std::string{id});
+            ref_id_info_.emplace_back(length, std::move(further_tags));
+            ref_dict_[(*ref_ids_ptr)[(ref_ids_ptr->size() - 1)]] = (ref_ids_ptr->size() - 1);
+        }
+    }
 };
 
 } // namespace seqan3
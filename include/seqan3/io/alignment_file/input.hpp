@@ -12,8 +12,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
 #include <fstream>
+#include <memory>
+#include <optional>
 #include <string>
 #include <variant>
 #include <vector>
@@ -29,11 +32,15 @@
 #include <seqan3/core/metafunction/basic.hpp>
 #include <seqan3/core/metafunction/transformation_trait_or.hpp>
 #include <seqan3/io/alignment_file/input_format_concept.hpp>
+#include <seqan3/io/alignment_file/bam_index.hpp>
+#include <seqan3/io/alignment_file/format_bam.hpp>
+#include <seqan3/io/alignment_file/format_cram.hpp>
 #include <seqan3/io/alignment_file/format_sam.hpp>
 #include <seqan3/io/alignment_file/misc.hpp>
 #include <seqan3/io/detail/in_file_iterator.hpp>
 #include <seqan3/io/detail/misc_input.hpp>
 #include <seqan3/io/detail/record.hpp>
+#include <seqan3/io/detail/record_prefetcher.hpp>
 #include <seqan3/io/exception.hpp>
 #include <seqan3/io/record.hpp>
 #include <seqan3/io/stream/concept.hpp>
@@ -353,6 +360,22 @@ struct alignment_file_input_default_traits
  * You can check whether a file is at its end by comparing begin() and end() (if they are the same, the file is
  * at its end).
  *
+ * ### Region queries
+ *
+ * For BGZF compressed files (e.g. BAM) that are coordinate sorted and accompanied by a BAI or CSI index
+ * (see seqan3::bam_index), fetch() restricts iteration to the records overlapping a genomic region:
+ *
+ * ```cpp
+ * alignment_file_input fin{"mapping.bam"};
+ * fin.fetch("chr7", 55'019'017, 55'211'628);
+ *
+ * for (auto & rec : fin) // only records overlapping the region
+ *     // ...
+ * ```
+ *
+ * The index is used to seek directly to the first record that can overlap the region (via BGZF virtual
+ * file offsets), so the time spent is proportional to the size of the region, not the size of the file.
+ *
  * ### Formats
  *
  * \todo give overview of formats, once they are all implemented
@@ -374,7 +397,9 @@ template <
                                                                               field::EVALUE,
                                                                               field::BIT_SCORE,
                                                                               field::HEADER_PTR>,
-    detail::TypeListOfAlignmentFileInputFormats  valid_formats_ = type_list<alignment_file_format_sam>,
+    detail::TypeListOfAlignmentFileInputFormats  valid_formats_ = type_list<alignment_file_format_sam,
+                                                                            alignment_file_format_bam,
+                                                                            alignment_file_format_cram>,
     char_concept                                 stream_char_type_ = char>
 class alignment_file_input
 {
@@ -817,6 +842,176 @@ public:
         return *header_ptr;
     }
 
+    /*!\brief Use the given index for subsequent region queries instead of loading one from disk.
+     * \param[in] idx The index over this file.
+     * \sa seqan3::alignment_file_input::fetch
+     */
+    void load_index(bam_index idx)
+    {
+        index = std::move(idx);
+    }
+
+    /*!\brief Restrict iteration to the records overlapping the given genomic region.
+     * \param[in] ref_name The name of the reference (e.g. "chr7"), as spelt in the file's header.
+     * \param[in] beg      Begin of the region (0-based, inclusive).
+     * \param[in] end      End of the region (0-based, exclusive).
+     * \throws std::out_of_range If the header does not know the reference name.
+     *
+     * \details
+     *
+     * See the overload taking a reference position for the requirements and the exact semantics.
+     */
+    void fetch(std::string const & ref_name, int32_t const beg, int32_t const end)
+    {
+        int32_t ref_id = 0;
+        for (auto && id : header_ptr->ref_ids())
+        {
+            if (std::ranges::equal(id, ref_name))
+                return fetch(ref_id, beg, end);
+
+            ++ref_id;
+        }
+
+        throw std::out_of_range{"The reference name " + ref_name + " is not present in the header."};
+    }
+
+    /*!\brief Restrict iteration to the records overlapping the given genomic region.
+     * \param[in] ref_id Position of the reference in the file's header.
+     * \param[in] beg    Begin of the region (0-based, inclusive).
+     * \param[in] end    End of the region (0-based, exclusive).
+     * \throws seqan3::file_open_error If the file is not BGZF compressed, if no index was loaded and
+     *                                 no index file is found next to the file, or if the library was
+     *                                 built without zlib support.
+     *
+     * \details
+     *
+     * Requires a coordinate sorted, BGZF compressed file (e.g. BAM) and an index: either set one via
+     * load_index() or place a `<filename>.bai` or `<filename>.csi` file next to the file. The index is
+     * queried for the smallest BGZF virtual offset at which an overlapping record can start, the
+     * stream seeks there, and subsequent iteration yields only records intersecting the region,
+     * ending when no further record can overlap it.
+     *
+     * The seqan3::field::REF_ID and seqan3::field::REF_OFFSET fields must be selected, because they
+     * determine whether a record intersects the region. The end position of a record on the reference
+     * is taken from the seqan3::field::ALIGNMENT field if selected, otherwise it is approximated by
+     * the length of the seqan3::field::SEQ field (deletions then slightly shrink the record's
+     * apparent span).
+     *
+     * Calling fetch() again (re)positions the file on a new region; the previous region is dropped.
+     */
+    void fetch([[maybe_unused]] int32_t const ref_id,
+               [[maybe_unused]] int32_t const beg,
+               [[maybe_unused]] int32_t const end)
+    {
+        static_assert(selected_field_ids::contains(field::REF_ID) &&
+                      selected_field_ids::contains(field::REF_OFFSET),
+                      "Region queries require the REF_ID and REF_OFFSET fields to be selected.");
+
+#ifdef SEQAN3_HAS_ZLIB
+        auto * bgzf_stream = dynamic_cast<contrib::basic_bgzf_istream<stream_char_type> *>(secondary_stream.get());
+        if (bgzf_stream == nullptr)
+            throw file_open_error{"Region queries require a BGZF compressed file (e.g. a BAM file)."};
+
+        if (index.empty()) // no index was loaded; look for an index file next to the alignment file
+        {
+            std::filesystem::path index_path{file_path};
+            index_path += ".bai";
+            if (!std::filesystem::exists(index_path))
+            {
+                index_path = file_path;
+                index_path += ".csi";
+            }
+
+            index.load(index_path); // throws file_open_error if neither file exists
+        }
+
+        region_active = true;
+        region_ref_id = ref_id;
+        region_begin = beg;
+        region_end = end;
+
+        std::optional<uint64_t> const voffset = index.query_min_offset(ref_id, beg, end);
+        if (!voffset.has_value()) // the index guarantees that no record overlaps the region
+        {
+            at_end = true;
+            return;
+        }
+
+        bgzf_stream->seek_virtual(*voffset);
+        at_end = false;
+        read_next_record();
+#else
+        throw file_open_error{"Region queries require a BGZF compressed file, but the library was built "
+                              "without zlib support."};
+#endif
+    }
+
+    /*!\brief Parse subsequent records on a background thread, keeping up to `depth` records ready.
+     * \param[in] depth The maximum number of records parsed ahead of the consumer.
+     *
+     * \details
+     *
+     * Record parsing then overlaps with the consumer's per-record work — the iterator interface is
+     * unchanged, operator++ hands out the next prefetched record (blocking only if the parser has not
+     * caught up yet). When a region was selected via fetch(), only its records are prefetched.
+     *
+     * Parse errors surface on the consuming thread in file order, just like in sequential mode.
+     * Set all options before calling this and do not call fetch() afterwards — the stream belongs to
+     * the background thread from here on.
+     */
+    void prefetch(size_t const depth = 4)
+    {
+        if ((prefetcher != nullptr) || at_end)
+            return;
+
+        prefetcher = std::make_unique<detail::record_prefetcher<record_type>>(depth,
+            [this] (record_type & rec) { return read_next_record_sequential(rec); });
+    }
+
+    /*!\brief Request the next record without blocking, for multiplexing many open files from one thread.
+     * \param[out] rec Assigned the next record if seqan3::record_availability::ready is returned.
+     * \returns seqan3::record_availability::ready if `rec` was assigned, seqan3::record_availability::pending
+     *          if the background parser has not produced the next record yet, and
+     *          seqan3::record_availability::at_end at the end of the file (or region).
+     *
+     * \details
+     *
+     * With an active prefetch() this function only inspects the record ring that the background thread
+     * refills and therefore never blocks — a single reactor/executor thread can poll many open files
+     * round-robin (treating seqan3::record_availability::pending as "try another file") instead of
+     * dedicating one blocked iterator or thread per file. Without prefetch() the record is parsed
+     * synchronously on the calling thread and seqan3::record_availability::pending is never returned.
+     *
+     * The first call hands out the record already parsed on construction; records are consumed from
+     * the same stream as the iterator interface, so do not mix the two.
+     *
+     * Parse errors of the background thread surface here in file order, like in sequential mode.
+     */
+    record_availability try_next_record(record_type & rec)
+    {
+        if (!first_record_polled) // the first record was already parsed on construction
+        {
+            first_record_polled = true;
+
+            if (at_end)
+                return record_availability::at_end;
+
+            rec = std::move(record_buffer);
+            return record_availability::ready;
+        }
+
+        if (prefetcher != nullptr)
+            return prefetcher->try_pop(rec);
+
+        if (at_end || !read_next_record_sequential(rec))
+        {
+            at_end = true;
+            return record_availability::at_end;
+        }
+
+        return record_availability::ready;
+    }
+
 protected:
     //!\privatesection
 
@@ -827,6 +1022,7 @@ protected:
         if (!primary_stream->good())
             throw file_open_error{"Could not open file " + filename.string() + " for reading."};
 
+        file_path = filename;
         secondary_stream = detail::make_secondary_istream(*primary_stream, filename);
         detail::set_format(format, filename);
 
@@ -877,11 +1073,37 @@ protected:
     //!\brief File is one position behind the last record.
     bool at_end{false};
 
+    //!\brief The path the file was opened from (empty when constructed from a stream).
+    std::filesystem::path file_path{};
+
+    /*!\name Region query state
+     * \{
+     */
+    //!\brief The index over the file, set via load_index() or loaded on the first fetch().
+    bam_index index{};
+    //!\brief Whether iteration is currently restricted to a region.
+    bool region_active{false};
+    //!\brief Position of the queried reference in the header.
+    int32_t region_ref_id{0};
+    //!\brief Begin of the queried region (0-based, inclusive).
+    int32_t region_begin{0};
+    //!\brief End of the queried region (0-based, exclusive).
+    int32_t region_end{0};
+    //!\}
+
     //!\brief Type of the format, an std::variant over the `valid_formats`.
     using format_type = detail::transfer_template_args_onto_t<valid_formats, std::variant>;
 
     //!\brief The actual std::variant holding a pointer to the detected/selected format.
     format_type format;
+
+    /*!\brief The background-thread ring buffer created by prefetch() (`nullptr` while inactive).
+     * Declared after the stream members so that the thread is joined before the stream is destroyed.
+     */
+    std::unique_ptr<detail::record_prefetcher<record_type>> prefetcher{nullptr};
+
+    //!\brief Whether try_next_record() has handed out the record that was parsed on construction.
+    bool first_record_polled{false};
     //!\}
 
     /*!\name Reference information
@@ -911,28 +1133,98 @@ protected:
         // initialise reference map and ref_dict if ref_ids are non-empty
         for (size_t idx = 0; idx < ref_ids.size(); ++idx)
         {
-            header_ptr->ref_id_info.emplace_back(std::ranges::size(ref_sequences[idx]), "");
-            header_ptr->ref_dict[header_ptr->ref_ids()[idx]] = idx;
+            header_ptr->ref_id_info().emplace_back(std::ranges::size(ref_sequences[idx]), "");
+            header_ptr->ref_dict()[header_ptr->ref_ids()[idx]] = idx;
         }
     }
     //!\}
 
-    //!\brief Tell the format to move to the next record and update the buffer.
+    //!\brief Update the buffer with the next record; when a region is active, with the next overlapping record.
     void read_next_record()
+    {
+        if (prefetcher != nullptr)
+        {
+            at_end = !prefetcher->pop(record_buffer);
+            return;
+        }
+
+        at_end = !read_next_record_sequential(record_buffer);
+    }
+
+    /*!\brief Parse the next record from the stream into `rec`; when a region is active, the next overlapping one.
+     * \returns `false` if the stream holds no further (overlapping) record, `true` otherwise.
+     *
+     * Called on the consuming thread in sequential mode and on the background thread when prefetch()
+     * is active (then `rec` is the prefetcher's scratch record, not \ref record_buffer).
+     */
+    bool read_next_record_sequential(record_type & rec)
+    {
+        while (true)
+        {
+            if (!read_record_buffer(rec))
+                return false;
+
+            if (!region_active)
+                return true;
+
+            if constexpr (selected_field_ids::contains(field::REF_ID) &&
+                          selected_field_ids::contains(field::REF_OFFSET))
+            {
+                auto const & ref_id = detail::get_or_ignore<field::REF_ID>(rec);
+                auto const & ref_offset = detail::get_or_ignore<field::REF_OFFSET>(rec);
+
+                // records without a position sort after all placed records in a coordinate sorted file
+                if (!ref_id.has_value() || !ref_offset.has_value() || (*ref_id > region_ref_id))
+                {
+                    region_active = false;
+                    return false;
+                }
+
+                if (*ref_id < region_ref_id) // chunks may begin with records of a preceding reference
+                    continue;
+
+                if (*ref_offset >= region_end) // this and all following records lie behind the region
+                {
+                    region_active = false;
+                    return false;
+                }
+
+                // the span of the record on the reference; without the alignment the read length approximates it
+                int32_t span = 1;
+                if constexpr (selected_field_ids::contains(field::ALIGNMENT))
+                    span = std::ranges::distance(std::get<0>(detail::get_or_ignore<field::ALIGNMENT>(rec)));
+                else if constexpr (selected_field_ids::contains(field::SEQ))
+                    span = std::ranges::distance(detail::get_or_ignore<field::SEQ>(rec));
+
+                if (*ref_offset + std::max<int32_t>(span, 1) <= region_begin)
+                    continue; // record ends before the region begins
+
+                return true; // the record overlaps the region
+            }
+            else
+            {
+                return true; // unreachable: fetch() statically requires the fields needed for filtering
+            }
+        }
+    }
+
+    /*!\brief Tell the format to move to the next record and parse it into `rec`.
+     * \returns `false` if the stream holds no further record, `true` otherwise.
+     */
+    bool read_record_buffer(record_type & rec)
     {
         // clear the record
-        record_buffer.clear();
-        detail::get_or_ignore<field::HEADER_PTR>(record_buffer) = header_ptr.get();
+        rec.clear();
+        detail::get_or_ignore<field::HEADER_PTR>(rec) = header_ptr.get();
 
         // at end if we could not read further
         if (std::istreambuf_iterator<stream_char_type>{*secondary_stream} ==
             std::istreambuf_iterator<stream_char_type>{})
         {
-            at_end = true;
-            return;
+            return false;
         }
 
-        auto call_read_func = [this] (auto & ref_seq_info)
+        auto call_read_func = [this, &rec] (auto & ref_seq_info)
         {
             std::visit([&] (AlignmentFileInputFormat & f)
             {
@@ -940,20 +1232,20 @@ protected:
                        options,
                        ref_seq_info,
                        *header_ptr,
-                       detail::get_or_ignore<field::SEQ>(record_buffer),
-                       detail::get_or_ignore<field::QUAL>(record_buffer),
-                       detail::get_or_ignore<field::ID>(record_buffer),
-                       detail::get_or_ignore<field::OFFSET>(record_buffer),
-                       detail::get_or_ignore<field::REF_SEQ>(record_buffer),
-                       detail::get_or_ignore<field::REF_ID>(record_buffer),
-                       detail::get_or_ignore<field::REF_OFFSET>(record_buffer),
-                       detail::get_or_ignore<field::ALIGNMENT>(record_buffer),
-                       detail::get_or_ignore<field::FLAG>(record_buffer),
-                       detail::get_or_ignore<field::MAPQ>(record_buffer),
-                       detail::get_or_ignore<field::MATE>(record_buffer),
-                       detail::get_or_ignore<field::TAGS>(record_buffer),
-                       detail::get_or_ignore<field::EVALUE>(record_buffer),
-                       detail::get_or_ignore<field::BIT_SCORE>(record_buffer));
+                       detail::get_or_ignore<field::SEQ>(rec),
+                       detail::get_or_ignore<field::QUAL>(rec),
+                       detail::get_or_ignore<field::ID>(rec),
+                       detail::get_or_ignore<field::OFFSET>(rec),
+                       detail::get_or_ignore<field::REF_SEQ>(rec),
+                       detail::get_or_ignore<field::REF_ID>(rec),
+                       detail::get_or_ignore<field::REF_OFFSET>(rec),
+                       detail::get_or_ignore<field::ALIGNMENT>(rec),
+                       detail::get_or_ignore<field::FLAG>(rec),
+                       detail::get_or_ignore<field::MAPQ>(rec),
+                       detail::get_or_ignore<field::MATE>(rec),
+                       detail::get_or_ignore<field::TAGS>(rec),
+                       detail::get_or_ignore<field::EVALUE>(rec),
+                       detail::get_or_ignore<field::BIT_SCORE>(rec));
 
             }, format);
         };
@@ -964,6 +1256,8 @@ protected:
             call_read_func(*reference_sequences_ptr);
         else
             call_read_func(std::ignore);
+
+        return true;
     }
 
     //!\brief Befriend iterator so it can access the buffers.
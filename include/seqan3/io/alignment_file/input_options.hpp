@@ -22,7 +22,18 @@ namespace seqan3
 template <typename sequence_legal_alphabet>
 struct alignment_file_input_options
 {
-    // options to define
+    /*!\brief Store the optional tags of a record as raw text and parse a tag only on first access.
+     *
+     * \details
+     *
+     * When set, formats that support it (currently only SAM) do not tokenize and convert the optional
+     * tag fields while reading. Instead the raw tag text is handed to the seqan3::sam_tag_dictionary
+     * and an individual tag is materialized on its first seqan3::sam_tag_dictionary::get() access.
+     * This saves substantial parsing time on tag-heavy files where only few tags are ever inspected,
+     * but the unaccessed tags are invisible to the std::map interface of the dictionary until
+     * seqan3::sam_tag_dictionary::materialize() is called.
+     */
+    bool lazy_tags = false;
 };
 
 } // namespace seqan3
@@ -13,15 +13,21 @@
 #pragma once
 
 #include <cassert>
+#include <deque>
 #include <fstream>
+#include <future>
+#include <sstream>
 #include <string>
 #include <string_view>
+#include <thread>
+#include <tuple>
 #include <variant>
 #include <vector>
 
 #include <seqan3/core/concept/tuple.hpp>
 #include <seqan3/core/metafunction/basic.hpp>
 #include <seqan3/core/metafunction/template_inspection.hpp>
+#include <seqan3/io/alignment_file/format_bam.hpp>
 #include <seqan3/io/alignment_file/format_sam.hpp>
 #include <seqan3/io/alignment_file/header.hpp>
 #include <seqan3/io/alignment_file/misc.hpp>
@@ -158,6 +164,14 @@ namespace seqan3
  *
  * \snippet test/snippet/io/alignment_file/alignment_file_output.cpp io_pipeline
  *
+ * ### Asynchronous writing
+ *
+ * Formatting a SAM record with many tag fields is CPU-bound; when several producer threads funnel their
+ * records through one output file, the formatting can become the bottleneck. Calling write_parallel()
+ * switches the file into an asynchronous mode where push_back() only moves the record into a formatting
+ * job and returns; the jobs run on background threads and their buffers are written out in submission
+ * order. See write_parallel() for the requirements on the records.
+ *
  * ### Formats
  *
  * TODO give overview of formats, once they are all implemented
@@ -181,8 +195,8 @@ template <detail::fields_concept selected_field_ids_ =
                      field::BIT_SCORE,
                      field::HEADER_PTR>,
           detail::TypeListOfAlignmentFileOutputFormats valid_formats_ =
-              type_list<alignment_file_format_sam/*,
-                        alignment_file_format_bam,*/>,
+              type_list<alignment_file_format_sam,
+                        alignment_file_format_bam>,
           OStream<char> stream_type_ = std::ofstream,
           typename ref_ids_type = ref_info_not_given>
 class alignment_file_output
@@ -259,8 +273,17 @@ public:
     alignment_file_output(alignment_file_output &&) = default;
     //!\brief Move assignment is defaulted.
     alignment_file_output & operator=(alignment_file_output &&) = default;
-    //!\brief Destructor is defaulted.
-    ~alignment_file_output() = default;
+    //!\brief Destructor drains buffers that are still being formatted asynchronously.
+    ~alignment_file_output()
+    {
+        try
+        {
+            while (!format_jobs.empty())
+                drain_one_format_job();
+        }
+        catch (...) // a destructor must not throw; records still in flight are lost on error
+        {}
+    }
 
     /*!\brief Construct from filename.
      * \param[in] _file_name    Path to the file you wish to open.
@@ -352,8 +375,8 @@ public:
         // fill ref_dict
         for (size_t idx = 0; idx < std::ranges::size(ref_ids); ++idx)
         {
-            header_ptr->ref_id_info.push_back({ref_lengths[idx], ""});
-            header_ptr->ref_dict[(header_ptr->ref_ids()[idx])] = idx;
+            header_ptr->ref_id_info().push_back({ref_lengths[idx], ""});
+            header_ptr->ref_dict()[(header_ptr->ref_ids()[idx])] = idx;
         }
     }
 
@@ -390,8 +413,8 @@ public:
         // fill ref_dict
         for (uint32_t idx = 0; idx < std::ranges::size(ref_ids); ++idx)
         {
-            header_ptr->ref_id_info.emplace_back(ref_lengths[idx], "");
-            header_ptr->ref_dict[header_ptr->ref_ids()[idx]] = idx;
+            header_ptr->ref_id_info().emplace_back(ref_lengths[idx], "");
+            header_ptr->ref_dict()[header_ptr->ref_ids()[idx]] = idx;
         }
     }
     //!\}
@@ -469,21 +492,23 @@ public:
         using default_align_t = std::pair<std::basic_string_view<gapped<char>>, std::basic_string_view<gapped<char>>>;
         using default_mate_t  = std::tuple<std::string_view, std::optional<int32_t>, int32_t>;
 
-        write_record(detail::get_or<field::HEADER_PTR>(r, nullptr),
-                     detail::get_or<field::SEQ>(r, std::string_view{}),
-                     detail::get_or<field::QUAL>(r, std::string_view{}),
-                     detail::get_or<field::ID>(r, std::string_view{}),
-                     detail::get_or<field::OFFSET>(r, 0u),
-                     detail::get_or<field::REF_SEQ>(r, std::string_view{}),
-                     detail::get_or<field::REF_ID>(r, std::ignore),
-                     detail::get_or<field::REF_OFFSET>(r, std::optional<int32_t>{}),
-                     detail::get_or<field::ALIGNMENT>(r, default_align_t{}),
-                     detail::get_or<field::FLAG>(r, 0u),
-                     detail::get_or<field::MAPQ>(r, 0u),
-                     detail::get_or<field::MATE>(r, default_mate_t{}),
-                     detail::get_or<field::TAGS>(r, sam_tag_dictionary{}),
-                     detail::get_or<field::EVALUE>(r, 0u),
-                     detail::get_or<field::BIT_SCORE>(r, 0u));
+        // forwarding the record preserves its value category, so fields of an rvalue record can be
+        // moved into an asynchronous formatting job instead of being copied
+        write_record(detail::get_or<field::HEADER_PTR>(std::forward<record_t>(r), nullptr),
+                     detail::get_or<field::SEQ>(std::forward<record_t>(r), std::string_view{}),
+                     detail::get_or<field::QUAL>(std::forward<record_t>(r), std::string_view{}),
+                     detail::get_or<field::ID>(std::forward<record_t>(r), std::string_view{}),
+                     detail::get_or<field::OFFSET>(std::forward<record_t>(r), 0u),
+                     detail::get_or<field::REF_SEQ>(std::forward<record_t>(r), std::string_view{}),
+                     detail::get_or<field::REF_ID>(std::forward<record_t>(r), std::ignore),
+                     detail::get_or<field::REF_OFFSET>(std::forward<record_t>(r), std::optional<int32_t>{}),
+                     detail::get_or<field::ALIGNMENT>(std::forward<record_t>(r), default_align_t{}),
+                     detail::get_or<field::FLAG>(std::forward<record_t>(r), 0u),
+                     detail::get_or<field::MAPQ>(std::forward<record_t>(r), 0u),
+                     detail::get_or<field::MATE>(std::forward<record_t>(r), default_mate_t{}),
+                     detail::get_or<field::TAGS>(std::forward<record_t>(r), sam_tag_dictionary{}),
+                     detail::get_or<field::EVALUE>(std::forward<record_t>(r), 0u),
+                     detail::get_or<field::BIT_SCORE>(std::forward<record_t>(r), 0u));
     }
 
     /*!\brief           Write a record in form of a std::tuple to the file.
@@ -517,21 +542,21 @@ public:
         using default_mate_t  = std::tuple<std::string_view, std::optional<int32_t>, int32_t>;
 
         // index_of might return npos, but this will be handled well by get_or_ignore (and just return ignore)
-        write_record(detail::get_or<selected_field_ids::index_of(field::HEADER_PTR)>(t, nullptr),
-                     detail::get_or<selected_field_ids::index_of(field::SEQ)>(t, std::string_view{}),
-                     detail::get_or<selected_field_ids::index_of(field::QUAL)>(t, std::string_view{}),
-                     detail::get_or<selected_field_ids::index_of(field::ID)>(t, std::string_view{}),
-                     detail::get_or<selected_field_ids::index_of(field::OFFSET)>(t, 0u),
-                     detail::get_or<selected_field_ids::index_of(field::REF_SEQ)>(t, std::string_view{}),
-                     detail::get_or<selected_field_ids::index_of(field::REF_ID)>(t, std::ignore),
-                     detail::get_or<selected_field_ids::index_of(field::REF_OFFSET)>(t, std::optional<int32_t>{}),
-                     detail::get_or<selected_field_ids::index_of(field::ALIGNMENT)>(t, default_align_t{}),
-                     detail::get_or<selected_field_ids::index_of(field::FLAG)>(t, 0u),
-                     detail::get_or<selected_field_ids::index_of(field::MAPQ)>(t, 0u),
-                     detail::get_or<selected_field_ids::index_of(field::MATE)>(t, default_mate_t{}),
-                     detail::get_or<selected_field_ids::index_of(field::TAGS)>(t, sam_tag_dictionary{}),
-                     detail::get_or<selected_field_ids::index_of(field::EVALUE)>(t, 0u),
-                     detail::get_or<selected_field_ids::index_of(field::BIT_SCORE)>(t, 0u));
+        write_record(detail::get_or<selected_field_ids::index_of(field::HEADER_PTR)>(std::forward<tuple_t>(t), nullptr),
+                     detail::get_or<selected_field_ids::index_of(field::SEQ)>(std::forward<tuple_t>(t), std::string_view{}),
+                     detail::get_or<selected_field_ids::index_of(field::QUAL)>(std::forward<tuple_t>(t), std::string_view{}),
+                     detail::get_or<selected_field_ids::index_of(field::ID)>(std::forward<tuple_t>(t), std::string_view{}),
+                     detail::get_or<selected_field_ids::index_of(field::OFFSET)>(std::forward<tuple_t>(t), 0u),
+                     detail::get_or<selected_field_ids::index_of(field::REF_SEQ)>(std::forward<tuple_t>(t), std::string_view{}),
+                     detail::get_or<selected_field_ids::index_of(field::REF_ID)>(std::forward<tuple_t>(t), std::ignore),
+                     detail::get_or<selected_field_ids::index_of(field::REF_OFFSET)>(std::forward<tuple_t>(t), std::optional<int32_t>{}),
+                     detail::get_or<selected_field_ids::index_of(field::ALIGNMENT)>(std::forward<tuple_t>(t), default_align_t{}),
+                     detail::get_or<selected_field_ids::index_of(field::FLAG)>(std::forward<tuple_t>(t), 0u),
+                     detail::get_or<selected_field_ids::index_of(field::MAPQ)>(std::forward<tuple_t>(t), 0u),
+                     detail::get_or<selected_field_ids::index_of(field::MATE)>(std::forward<tuple_t>(t), default_mate_t{}),
+                     detail::get_or<selected_field_ids::index_of(field::TAGS)>(std::forward<tuple_t>(t), sam_tag_dictionary{}),
+                     detail::get_or<selected_field_ids::index_of(field::EVALUE)>(std::forward<tuple_t>(t), 0u),
+                     detail::get_or<selected_field_ids::index_of(field::BIT_SCORE)>(std::forward<tuple_t>(t), 0u));
     }
 
     /*!\brief            Write a record to the file by passing individual fields.
@@ -676,6 +701,42 @@ public:
         return *header_ptr;
     }
 
+    /*!\name Parallel interface
+     * \brief Provides multi-threaded record formatting behind the regular push_back() interface.
+     * \{
+     */
+    /*!\brief Format subsequent records on a pool of background threads.
+     * \param[in] thread_count The number of formatting jobs that may run concurrently.
+     *
+     * \details
+     *
+     * After this call every record passed to push_back() is moved into its own formatting job
+     * (seqan3::contrib::bgzf_ostream-style bounded queue of std::async tasks) that renders it into a
+     * string buffer; the buffers are written to the stream in submission order, so the file contents
+     * are identical to sequential writing. The caller only blocks while the queue is full, i.e. one
+     * buffer needs to be drained.
+     *
+     * Only the SAM format is supported; for other formats this call is a no-op and writing stays
+     * synchronous. Since the formatting happens after push_back() has returned, the records must own
+     * their data — views into storage that the caller invalidates afterwards would dangle. Errors
+     * raised while formatting surface on the thread that drains the respective buffer, in submission
+     * order. Pending buffers are flushed by the destructor.
+     */
+    void write_parallel(size_t const thread_count = std::thread::hardware_concurrency())
+    {
+        bool const supported = std::visit([] (auto const & f)
+        {
+            return std::is_same_v<remove_cvref_t<decltype(f)>, alignment_file_format_sam>;
+        }, format);
+
+        if (!supported)
+            return;
+
+        async_thread_count = (thread_count == 0) ? 2u : thread_count; // hardware_concurrency may report 0
+        async_writing = true;
+    }
+    //!\}
+
 protected:
     //!\privatesection
 
@@ -699,6 +760,19 @@ protected:
     //!\brief The file header object (will be set on construction).
     std::unique_ptr<header_type> header_ptr;
 
+    /*!\name Asynchronous writing state
+     * \{
+     */
+    //!\brief Whether write_parallel() activated the pipeline.
+    bool async_writing{false};
+    //!\brief The maximum number of formatting jobs in flight.
+    size_t async_thread_count{0};
+    //!\brief Whether a job that writes the header has already been enqueued.
+    bool async_header_written{false};
+    //!\brief The in-flight formatting jobs; buffers are drained front-to-back to preserve submission order.
+    std::deque<std::future<std::basic_string<typename stream_type::char_type>>> format_jobs;
+    //!\}
+
     //!\brief Write record to format.
     template <typename record_header_ptr_t, typename ...pack_type>
     void write_record(record_header_ptr_t && record_header_ptr, pack_type && ...remainder)
@@ -707,6 +781,13 @@ protected:
 
         assert(!format.valueless_by_exception());
 
+        if (async_writing)
+        {
+            enqueue_record(std::forward<record_header_ptr_t>(record_header_ptr),
+                           std::forward<pack_type>(remainder)...);
+            return;
+        }
+
         std::visit([&] (auto & f)
         {
             // use header from record if explicitly given, e.g. file_out = file_in
@@ -719,6 +800,52 @@ protected:
         }, format);
     }
 
+    //!\brief Move the record into a formatting job; rvalue fields are moved, lvalue fields are copied.
+    template <typename record_header_ptr_t, typename ...pack_type>
+    void enqueue_record(record_header_ptr_t && record_header_ptr, pack_type && ...remainder)
+    {
+        while (format_jobs.size() >= async_thread_count) // bounded queue: drain the oldest buffer first
+            drain_one_format_job();
+
+        // only the first job may write the header; every job gets its own format copy below and the
+        // copies cannot know of each other
+        alignment_file_output_options job_options = options;
+        job_options.sam_require_header = options.sam_require_header && !async_header_written;
+        async_header_written = true;
+
+        format_jobs.push_back(std::async(std::launch::async,
+            [job_options,
+             fmt = format,
+             record_header_ptr, // a pointer (or nullptr); the pointee must outlive the job
+             header = header_ptr.get(),
+             fields = std::tuple<std::decay_t<pack_type>...>{std::forward<pack_type>(remainder)...}] () mutable
+            {
+                std::basic_ostringstream<typename stream_type::char_type> buffer_stream{};
+
+                std::apply([&] (auto & ...field_values)
+                {
+                    std::visit([&] (auto f) // fresh format copy, the formats buffer internally
+                    {
+                        if constexpr (!std::Same<std::decay_t<record_header_ptr_t>, std::nullptr_t>)
+                            f.write(buffer_stream, job_options, *record_header_ptr, field_values...);
+                        else if constexpr (std::Same<ref_ids_type, ref_info_not_given>)
+                            f.write(buffer_stream, job_options, std::ignore, field_values...);
+                        else
+                            f.write(buffer_stream, job_options, *header, field_values...);
+                    }, fmt);
+                }, fields);
+
+                return std::move(buffer_stream).str();
+            }));
+    }
+
+    //!\brief Write the oldest pending buffer to the stream.
+    void drain_one_format_job()
+    {
+        stream << format_jobs.front().get();
+        format_jobs.pop_front();
+    }
+
     //!\brief Befriend iterator so it can access the buffers.
     friend iterator;
 };
@@ -13,12 +13,15 @@
 #pragma once
 
 #include <map>
+#include <string>
 #include <variant>
 
 #include <seqan3/core/concept/core_language.hpp>
 #include <seqan3/core/metafunction/template_inspection.hpp>
+#include <seqan3/io/exception.hpp>
 #include <seqan3/io/stream/parse_condition.hpp>
 #include <seqan3/range/container/constexpr_string.hpp>
+#include <seqan3/std/charconv>
 #include <seqan3/std/concepts>
 
 namespace seqan3::detail
@@ -316,6 +319,18 @@ template <> struct sam_tag_type<"UQ"_tag> { using type = int32_t; };
  * for the tag "XZ" or learn more about an std::variant at
  * https://en.cppreference.com/w/cpp/utility/variant.
  *
+ * ### Lazy tag parsing
+ *
+ * When reading tag-heavy files most applications only ever look at one or two
+ * tags per record, so converting every tag eagerly wastes time. If you set
+ * seqan3::alignment_file_input_options::lazy_tags, the SAM format stores the
+ * raw tag text of a record via assign_raw_tags() instead of parsing it and a
+ * tag is materialized on its first seqan3::sam_tag_dictionary::get() access.
+ *
+ * \attention Raw tags are not visible through the std::map interface
+ *            (iteration, std::map::count, ...) until they have been accessed
+ *            via get() or materialize() has been called.
+ *
  * \sa seqan3::sam_tag_type
  * \sa https://en.cppreference.com/w/cpp/utility/variant
  * \sa https://samtools.github.io/hts-specs/SAMv1.pdf
@@ -353,7 +368,7 @@ public:
     //!\endcond
     auto & get() &
     {
-        if ((*this).count(tag) == 0)
+        if ((*this).count(tag) == 0 && !parse_raw_tag(tag))
             (*this)[tag] = sam_tag_type_t<tag>{}; // set correct type if tag is not set yet on
 
         return std::get<sam_tag_type_t<tag>>((*this)[tag]);
@@ -366,7 +381,7 @@ public:
     //!\endcond
     auto && get() &&
     {
-        if ((*this).count(tag) == 0)
+        if ((*this).count(tag) == 0 && !parse_raw_tag(tag))
             (*this)[tag] = sam_tag_type_t<tag>{}; // set correct type if tag is not set yet on
 
         return std::get<sam_tag_type_t<tag>>(std::move((*this)[tag]));
@@ -394,6 +409,225 @@ public:
         return std::get<sam_tag_type_t<tag>>(std::move((*this).at(tag)));
     }
     //!\}
+
+    /*!\name Lazy tag parsing
+     * \brief Stores unparsed tag text so individual tags are only parsed on first access.
+     * \{
+     */
+
+    /*!\brief Assigns raw tag text ("TAG:TYPE:VALUE" fields separated by tabs) for lazy parsing.
+     * \param[in] raw_tag_text The tag columns of a SAM record, without leading or trailing tab.
+     *
+     * \details
+     *
+     * The stored text is scanned (but not parsed) whenever get() does not find its tag in the map;
+     * only the matching field is then converted and moved into the map. Call materialize() before
+     * accessing the dictionary through its std::map interface.
+     */
+    void assign_raw_tags(std::string raw_tag_text)
+    {
+        raw_tags_ = std::move(raw_tag_text);
+    }
+
+    //!\brief Returns the raw tag text that has not been materialized yet.
+    std::string const & raw_tags() const noexcept
+    {
+        return raw_tags_;
+    }
+
+    /*!\brief Parses all remaining raw tags into the dictionary.
+     * \throws seqan3::format_error if the raw tag text is ill-formed.
+     *
+     * \details
+     *
+     * Tags that are already present in the map (because they were accessed via get() or set
+     * explicitly) take precedence over their raw text counterpart. The raw text is cleared
+     * afterwards.
+     */
+    void materialize()
+    {
+        size_t pos = 0;
+        while (pos < raw_tags_.size())
+        {
+            size_t field_end = raw_tags_.find('\t', pos);
+            if (field_end == std::string::npos)
+                field_end = raw_tags_.size();
+
+            if (field_end - pos >= 2)
+            {
+                uint16_t const id = static_cast<uint16_t>(raw_tags_[pos]) * 256 +
+                                    static_cast<uint16_t>(raw_tags_[pos + 1]);
+
+                if ((*this).count(id) == 0) // values set explicitly take precedence over raw text
+                    parse_raw_field(id, raw_tags_.data() + pos, raw_tags_.data() + field_end);
+            }
+
+            pos = field_end + 1;
+        }
+
+        raw_tags_.clear();
+    }
+    //!\}
+
+private:
+    //!\brief The raw tag text of a record that has not been parsed yet (see assign_raw_tags()).
+    std::string raw_tags_{};
+
+    /*!\brief Searches the raw tag text for `tag`, parses the field on a hit and removes it from the raw text.
+     * \param[in] tag The unique tag id to search for.
+     * \returns `true` if the tag was found (and is now stored in the map), `false` otherwise.
+     */
+    bool parse_raw_tag(uint16_t const tag)
+    {
+        size_t pos = 0;
+        while (pos < raw_tags_.size())
+        {
+            size_t field_end = raw_tags_.find('\t', pos);
+            if (field_end == std::string::npos)
+                field_end = raw_tags_.size();
+
+            if ((field_end - pos >= 2) &&
+                (static_cast<uint16_t>(raw_tags_[pos]) * 256 + static_cast<uint16_t>(raw_tags_[pos + 1]) == tag))
+            {
+                parse_raw_field(tag, raw_tags_.data() + pos, raw_tags_.data() + field_end);
+
+                if (field_end < raw_tags_.size())      // also remove the separating tab
+                    raw_tags_.erase(pos, field_end - pos + 1);
+                else if (pos > 0)
+                    raw_tags_.erase(pos - 1);
+                else
+                    raw_tags_.clear();
+
+                return true;
+            }
+
+            pos = field_end + 1;
+        }
+
+        return false;
+    }
+
+    /*!\brief Parses a single raw "TAG:TYPE:VALUE" field and stores the value in the map under `id`.
+     * \param[in] id    The unique tag id the field belongs to.
+     * \param[in] first Begin of the field (points at the first tag letter).
+     * \param[in] last  End of the field (exclusive).
+     * \throws seqan3::format_error if the field is ill-formed or the type identifier is unknown.
+     */
+    void parse_raw_field(uint16_t const id, char const * const first, char const * const last)
+    {
+        if ((last - first < 5) || (first[2] != ':') || (first[4] != ':'))
+            throw format_error{std::string{"[CORRUPTED SAM FILE] Malformed tag field '"} +
+                               std::string(first, last) + "'."};
+
+        char const type_id = first[3];
+        char const * value = first + 5;
+
+        switch (type_id)
+        {
+            case 'A' : // char
+            {
+                if (value == last)
+                    throw format_error{std::string{"[CORRUPTED SAM FILE] Malformed tag field '"} +
+                                       std::string(first, last) + "'."};
+                (*this)[id] = *value;
+                break;
+            }
+            case 'i' : // int32_t
+            {
+                int32_t tmp{};
+                parse_raw_arithmetic(value, last, tmp);
+                (*this)[id] = tmp;
+                break;
+            }
+            case 'f' : // float
+            {
+                float tmp{};
+                parse_raw_arithmetic(value, last, tmp);
+                (*this)[id] = tmp;
+                break;
+            }
+            case 'Z' : // string
+            {
+                (*this)[id] = std::string(value, last);
+                break;
+            }
+            case 'H' :
+            {
+                // TODO
+                break;
+            }
+            case 'B' : // Array. Value type depends on second char [cCsSiIf]
+            {
+                char const array_value_type_id = *value;
+                value = (last - value > 2) ? value + 2 : last; // skip the value type char and the first ','
+
+                switch (array_value_type_id)
+                {
+                    case 'c' : parse_raw_vector(id, value, last, int8_t{});   break;
+                    case 'C' : parse_raw_vector(id, value, last, uint8_t{});  break;
+                    case 's' : parse_raw_vector(id, value, last, int16_t{});  break;
+                    case 'S' : parse_raw_vector(id, value, last, uint16_t{}); break;
+                    case 'i' : parse_raw_vector(id, value, last, int32_t{});  break;
+                    case 'I' : parse_raw_vector(id, value, last, uint32_t{}); break;
+                    case 'f' : parse_raw_vector(id, value, last, float{});    break;
+                    default:
+                        throw format_error{std::string("The first character in the numerical ") +
+                                           "id of a SAM tag must be one of [cCsSiIf] but " + array_value_type_id +
+                                           " was given."};
+                }
+                break;
+            }
+            default:
+                throw format_error{std::string("The second character in the numerical id of a "
+                                   "SAM tag must be one of [A,i,Z,H,B,f] but ") + type_id + "was given."};
+        }
+    }
+
+    /*!\brief Parses an arithmetic tag value using std::from_chars.
+     * \tparam arithmetic_t The type of value to parse; must model seqan3::Arithmetic.
+     * \param[in]  first  Begin of the value text.
+     * \param[in]  last   End of the value text (exclusive).
+     * \param[out] target The arithmetic value object to store the parsed value.
+     * \throws seqan3::format_error if the text cannot be converted to a value of type `arithmetic_t`.
+     */
+    template <Arithmetic arithmetic_t>
+    void parse_raw_arithmetic(char const * const first, char const * const last, arithmetic_t & target)
+    {
+        std::from_chars_result res = std::from_chars(first, last, target);
+
+        if (res.ec == std::errc::invalid_argument || res.ptr != last)
+            throw format_error{std::string("[CORRUPTED SAM FILE] The string '") + std::string(first, last) +
+                                           "' could not be cast into an arithmetic tag value."};
+
+        if (res.ec == std::errc::result_out_of_range)
+            throw format_error{std::string("[CORRUPTED SAM FILE] Casting '") + std::string(first, last) +
+                                           "' into an arithmetic tag value would cause an overflow."};
+    }
+
+    /*!\brief Parses a comma separated list of values into a tag array stored in the map under `id`.
+     * \tparam value_type The type of values to be stored in the tag array.
+     * \param[in] id    The unique tag id the array belongs to.
+     * \param[in] first Begin of the comma separated value text.
+     * \param[in] last  End of the value text (exclusive).
+     * \param[in] value A temporary value that determines the underlying type of the tag array.
+     */
+    template <Arithmetic value_type>
+    void parse_raw_vector(uint16_t const id, char const * first, char const * const last, value_type value)
+    {
+        std::vector<value_type> tmp_vector;
+        while (first != last)
+        {
+            char const * value_end = first;
+            while ((value_end != last) && (*value_end != ','))
+                ++value_end;
+
+            parse_raw_arithmetic(first, value_end, value);
+            tmp_vector.push_back(value);
+
+            first = (value_end == last) ? last : value_end + 1; // skip ','
+        }
+        (*this)[id] = std::move(tmp_vector);
+    }
 };
 
 } // namespace seqan3
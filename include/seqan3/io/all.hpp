@@ -48,6 +48,17 @@
  * Formatted files employ compression/decompression streams transparently, i.e. if the given file-extension or
  * "magic-header" of a file suggest this, the respective stream is automatically (de-)compressed.
  *
+ * ## Parallel (de-)compression
+ *
+ * When a file with a `.gz` extension is **written**, the BGZF variant is chosen automatically: the formatted
+ * output is collected in fixed-size chunks that are deflated on a pool of worker jobs and written out in
+ * order, so compressed writing scales with the number of cores instead of being capped by a single deflate
+ * stream. The result is a valid multi-member GZip file that any decompressor can read. BGZF compressed input
+ * is decompressed in parallel in the same manner.
+ *
+ * The number of jobs kept in flight per stream defaults to the number of hardware threads and can be changed
+ * by assigning to seqan3::contrib::bgzf_thread_count before opening the file.
+ *
  * # Serialisation {#serialisation}
  *
  * \todo write me!
@@ -57,6 +68,7 @@
 
 #include <seqan3/io/alignment_file/all.hpp>
 #include <seqan3/io/exception.hpp>
+#include <seqan3/io/for_each_record_parallel.hpp>
 #include <seqan3/io/record.hpp>
 #include <seqan3/io/sequence_file/all.hpp>
 #include <seqan3/io/stream/all.hpp>
@@ -0,0 +1,217 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::async_istream.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <seqan3/core/concept/core_language.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A stream buffer that reads from the wrapped stream on a background thread into ping-pong buffers.
+ * \tparam char_t The character type of the stream.
+ * \ingroup io
+ *
+ * \details
+ *
+ * The background thread always fills one of two fixed-size buffers while the consumer drains the other
+ * one, so the cost of pulling bytes out of the wrapped stream (e.g. single-threaded decompression) overlaps
+ * with the record parsing happening on the consuming thread.
+ *
+ * The wrapped stream must not be accessed by anyone else while this buffer is alive and must outlive it.
+ */
+template <char_concept char_t>
+class async_istreambuf :
+    public std::basic_streambuf<char_t>
+{
+public:
+    //!\brief The traits type of the stream buffer.
+    using traits_type = typename std::basic_streambuf<char_t>::traits_type;
+    //!\brief The integer type used for EOF signalling.
+    using int_type = typename traits_type::int_type;
+
+    //!\brief The default size of each of the two buffers.
+    static constexpr size_t default_buffer_size = 1u << 20;
+
+    /*!\brief Construct from the stream to read from and start the background thread.
+     * \param[in, out] source       The stream to read from in the background.
+     * \param[in]      buffer_size_ The size of each of the two buffers.
+     */
+    explicit async_istreambuf(std::basic_istream<char_t> & source, size_t const buffer_size_ = default_buffer_size) :
+        m_source(source),
+        m_buffer_size(buffer_size_ == 0 ? default_buffer_size : buffer_size_)
+    {
+        for (buffer_t & buffer : m_buffers)
+            buffer.data.resize(putback_size + m_buffer_size);
+
+        this->setg(nullptr, nullptr, nullptr);
+
+        m_worker = std::thread{[this] () { run(); }};
+    }
+
+    //!\brief Stops the background thread.
+    ~async_istreambuf()
+    {
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            m_stop = true;
+        }
+        m_condition.notify_all();
+        m_worker.join();
+    }
+
+    //!\brief Swaps to the next filled buffer, blocking until the background thread has filled it.
+    int_type underflow() override
+    {
+        if (this->gptr() && (this->gptr() < this->egptr()))
+            return traits_type::to_int_type(*this->gptr());
+
+        if (m_at_eof)
+            return traits_type::eof();
+
+        // preserve up to putback_size characters across the buffer swap
+        int n_putback = 0;
+        char_t putback[putback_size];
+        if (this->gptr())
+        {
+            n_putback = static_cast<int>(this->gptr() - this->eback());
+            if (n_putback > static_cast<int>(putback_size))
+                n_putback = putback_size;
+            std::memcpy(putback, this->gptr() - n_putback, n_putback * sizeof(char_t));
+        }
+
+        {
+            std::unique_lock<std::mutex> lock{m_mutex};
+
+            if (m_active) // release the drained buffer to the background thread
+            {
+                m_buffers[m_consume_index].filled = false;
+                m_consume_index ^= 1;
+                m_condition.notify_all();
+            }
+            m_active = true;
+
+            m_condition.wait(lock, [this] () { return m_buffers[m_consume_index].filled; });
+
+            if (m_buffers[m_consume_index].count == 0) // the empty buffer marks the end of the stream
+            {
+                m_at_eof = true;
+                return traits_type::eof();
+            }
+        }
+
+        buffer_t & buffer = m_buffers[m_consume_index];
+        std::memcpy(buffer.data.data() + (putback_size - n_putback), putback, n_putback * sizeof(char_t));
+
+        this->setg(buffer.data.data() + (putback_size - n_putback),  // beginning of putback area
+                   buffer.data.data() + putback_size,                // read position
+                   buffer.data.data() + putback_size + buffer.count);// end of buffer
+
+        return traits_type::to_int_type(*this->gptr());
+    }
+
+private:
+    //!\brief The number of characters that survive a buffer swap for put back.
+    static constexpr size_t putback_size = 4;
+
+    //!\brief One of the two buffers filled in the background.
+    struct buffer_t
+    {
+        std::vector<char_t> data;  //!< The characters (the first putback_size ones are the putback area).
+        size_t count{0};           //!< The number of characters read into the buffer.
+        bool filled{false};        //!< Whether the buffer is ready for consumption.
+    };
+
+    //!\brief The loop run by the background thread.
+    void run()
+    {
+        size_t produce_index = 0;
+
+        while (true)
+        {
+            std::unique_lock<std::mutex> lock{m_mutex};
+            m_condition.wait(lock, [&] () { return m_stop || !m_buffers[produce_index].filled; });
+
+            if (m_stop)
+                return;
+
+            lock.unlock();
+
+            buffer_t & buffer = m_buffers[produce_index];
+            m_source.read(buffer.data.data() + putback_size, m_buffer_size);
+            size_t const count = m_source.gcount();
+
+            lock.lock();
+            buffer.count = count;
+            buffer.filled = true;
+            lock.unlock();
+            m_condition.notify_all();
+
+            if (count == 0) // published the end-of-stream marker
+                return;
+
+            produce_index ^= 1;
+        }
+    }
+
+    std::basic_istream<char_t> & m_source; //!< The stream read in the background.
+    size_t m_buffer_size;                  //!< The size of each of the two buffers.
+    buffer_t m_buffers[2];                 //!< The ping-pong buffers.
+    size_t m_consume_index{0};             //!< The buffer currently drained by the consumer.
+    bool m_active{false};                  //!< Whether the consumer currently holds a buffer.
+    bool m_at_eof{false};                  //!< Whether the end of the wrapped stream was reached.
+    bool m_stop{false};                    //!< Signals the background thread to terminate.
+    std::mutex m_mutex;                    //!< Synchronises the buffer states.
+    std::condition_variable m_condition;   //!< Signals buffer state changes.
+    std::thread m_worker;                  //!< The background thread.
+};
+
+/*!\brief An input stream that prefetches the wrapped stream on a background thread.
+ * \tparam char_t The character type of the stream.
+ * \ingroup io
+ *
+ * \details
+ *
+ * This is a decorator like the contrib compression streams: it reads from the given stream via
+ * seqan3::detail::async_istreambuf, i.e. a background thread keeps one buffer filled while the
+ * consumer drains the other one. Wrapped around a decompression stream it overlaps decompression
+ * with parsing.
+ */
+template <char_concept char_t>
+class async_istream :
+    public std::basic_istream<char_t>
+{
+public:
+    /*!\brief Construct from the stream to read from.
+     * \param[in, out] source       The stream to read from in the background; must outlive this stream.
+     * \param[in]      buffer_size_ The size of each of the two buffers.
+     */
+    explicit async_istream(std::basic_istream<char_t> & source,
+                           size_t const buffer_size_ = async_istreambuf<char_t>::default_buffer_size) :
+        std::basic_istream<char_t>{nullptr},
+        m_buf{source, buffer_size_}
+    {
+        this->rdbuf(&m_buf); // also clears the state flags set by the nullptr above
+    }
+
+private:
+    //!\brief The stream buffer doing the actual work.
+    async_istreambuf<char_t> m_buf;
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,176 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::fast_istreambuf_iterator.
+ * \author Hannes Hauswedell <hannes.hauswedell AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <cassert>
+#include <iterator>
+#include <streambuf>
+
+#include <seqan3/io/detail/fast_streambuf_skip.hpp>
+#include <seqan3/std/ranges>
+#include <seqan3/std/span>
+
+namespace seqan3::detail
+{
+
+/*!\brief Functionally the same as std::istreambuf_iterator, but faster.
+ * \ingroup io
+ * \tparam char_t   The stream's character type.
+ * \tparam traits_t The stream's traits type.
+ *
+ * \details
+ *
+ * Performs less virtual function calls than std::istreambuf_iterator: dereferencing reads directly from
+ * the stream buffer's get area and incrementing only calls into the stream buffer when the get area is
+ * exhausted, i.e. the per-character cost is a raw pointer read/bump instead of a virtual `sbumpc()`.
+ * The end of the stream is detected by comparing against std::ranges::default_sentinel (instead of
+ * comparing against another iterator), which reduces to a pointer comparison on the get area.
+ *
+ * All copies of this iterator work on the same stream buffer, i.e. it has the same single-pass semantics
+ * as std::istreambuf_iterator.
+ *
+ * \attention The iterator may only be dereferenced if it does not compare equal to
+ * std::ranges::default_sentinel.
+ */
+template <typename char_t, typename traits_t = std::char_traits<char_t>>
+class fast_istreambuf_iterator
+{
+private:
+    //!\brief Down-cast pointer to the stream-buffer that grants access to the get area.
+    stream_buffer_exposer<char_t, traits_t> * stream_buf = nullptr;
+
+public:
+    /*!\name Associated types
+     * \{
+     */
+    using difference_type   = std::ptrdiff_t;           //!< Defaults to std::ptrdiff_t.
+    using value_type        = char_t;                   //!< The char type of the stream.
+    using reference         = char_t;                   //!< The char type of the stream.
+    using pointer           = void;                     //!< Has no pointer type.
+    using iterator_category = std::input_iterator_tag;  //!< Pure input iterator.
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    fast_istreambuf_iterator()                                              noexcept = default; //!< Defaulted.
+    fast_istreambuf_iterator(fast_istreambuf_iterator const &)              noexcept = default; //!< Defaulted.
+    fast_istreambuf_iterator(fast_istreambuf_iterator &&)                   noexcept = default; //!< Defaulted.
+    fast_istreambuf_iterator & operator=(fast_istreambuf_iterator const &)  noexcept = default; //!< Defaulted.
+    fast_istreambuf_iterator & operator=(fast_istreambuf_iterator &&)       noexcept = default; //!< Defaulted.
+    ~fast_istreambuf_iterator()                                             noexcept = default; //!< Defaulted.
+
+    //!\brief Construct from a stream buffer.
+    explicit fast_istreambuf_iterator(std::basic_streambuf<char_t, traits_t> & ibuf) :
+        stream_buf{reinterpret_cast<stream_buffer_exposer<char_t, traits_t> *>(&ibuf)}
+    {
+        // ensure the get area is filled, so that the comparison against the sentinel is valid right away
+        stream_buf->underflow();
+    }
+    //!\}
+
+    /*!\name Arithmetic operators
+     * \{
+     */
+    //!\brief Advance by one and rebuffer if necessary (vtable lookup iff rebuffering).
+    fast_istreambuf_iterator & operator++()
+    {
+        assert(stream_buf != nullptr);
+        if ((stream_buf->gptr() + 1) == stream_buf->egptr())
+            stream_buf->snextc(); // move right, then underflow()
+        else
+            stream_buf->gbump(1);
+        return *this;
+    }
+
+    //!\overload
+    void operator++(int)
+    {
+        ++(*this);
+    }
+    //!\}
+
+    //!\brief Read the current character (no vtable lookup).
+    reference operator*() const
+    {
+        assert(stream_buf != nullptr);
+        return *stream_buf->gptr();
+    }
+
+    /*!\name Buffered chunk access
+     * \{
+     */
+    /*!\brief Exposes the stream buffer's current get area as a contiguous segment.
+     *
+     * \details
+     *
+     * The returned segment is empty iff the iterator compares equal to std::ranges::default_sentinel.
+     * It is invalidated by any operation that advances the stream, i.e. chunk_advance() and operator++().
+     */
+    std::span<char_t const> chunk() const
+    {
+        assert(stream_buf != nullptr);
+        return {stream_buf->gptr(), static_cast<size_t>(stream_buf->egptr() - stream_buf->gptr())};
+    }
+
+    /*!\brief Marks the given number of characters of the current chunk as consumed.
+     * \param[in] count The number of characters to consume; must not be greater than the size of chunk().
+     *
+     * \details
+     *
+     * If the get area is exhausted it is refilled eagerly (one vtable lookup), so that the comparison
+     * against std::ranges::default_sentinel remains valid.
+     */
+    void chunk_advance(size_t const count)
+    {
+        assert(stream_buf != nullptr);
+        assert(static_cast<ptrdiff_t>(count) <= stream_buf->egptr() - stream_buf->gptr());
+        stream_buf->gbump(static_cast<int>(count));
+        if (stream_buf->gptr() == stream_buf->egptr())
+            stream_buf->underflow();
+    }
+    //!\}
+
+    /*!\name Comparison operators
+     * \brief We define comparison only against the sentinel.
+     * \{
+     */
+    //!\brief True if the get area is empty, i.e. the end of the stream was reached.
+    friend bool operator==(fast_istreambuf_iterator const & lhs, std::ranges::default_sentinel_t const &) noexcept
+    {
+        assert(lhs.stream_buf != nullptr);
+        // the get area is never empty while characters remain, because operator++ refills it eagerly
+        return lhs.stream_buf->gptr() == lhs.stream_buf->egptr();
+    }
+
+    //!\brief True if characters remain in the stream.
+    friend bool operator!=(fast_istreambuf_iterator const & lhs, std::ranges::default_sentinel_t const &) noexcept
+    {
+        return !(lhs == std::ranges::default_sentinel);
+    }
+
+    //!\copydoc operator==(fast_istreambuf_iterator const & lhs, std::ranges::default_sentinel_t const &)
+    friend bool operator==(std::ranges::default_sentinel_t const &, fast_istreambuf_iterator const & rhs) noexcept
+    {
+        return rhs == std::ranges::default_sentinel;
+    }
+
+    //!\copydoc operator!=(fast_istreambuf_iterator const & lhs, std::ranges::default_sentinel_t const &)
+    friend bool operator!=(std::ranges::default_sentinel_t const &, fast_istreambuf_iterator const & rhs) noexcept
+    {
+        return rhs != std::ranges::default_sentinel;
+    }
+    //!\}
+};
+
+} // namespace seqan3::detail
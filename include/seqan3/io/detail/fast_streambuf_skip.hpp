@@ -0,0 +1,109 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::fast_skip_until for advancing over unparsed stream contents.
+ * \author Hannes Hauswedell <hannes.hauswedell AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <cstring>
+#include <streambuf>
+
+#include <seqan3/io/exception.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Exposes the protected get area interface of a std::basic_streambuf.
+ * \ingroup io
+ * \tparam char_t   The stream's character type.
+ * \tparam traits_t The stream's traits type.
+ *
+ * \details
+ *
+ * The get area pointers of a std::basic_streambuf are protected, but algorithms that want to process
+ * the buffer contents in bulk (instead of character-by-character through std::istreambuf_iterator)
+ * need access to them. Since this type adds no members, a std::basic_streambuf can safely be
+ * reinterpreted as this type to call the exposed functions.
+ */
+template <typename char_t, typename traits_t = std::char_traits<char_t>>
+struct stream_buffer_exposer : public std::basic_streambuf<char_t, traits_t>
+{
+    //!\brief The base type.
+    using base_t = std::basic_streambuf<char_t, traits_t>;
+
+    //!\cond
+    using base_t::eback;
+    using base_t::gptr;
+    using base_t::egptr;
+    using base_t::gbump;
+    using base_t::underflow;
+    //!\endcond
+};
+
+/*!\brief Advances the stream buffer to the next occurrence of one of the given delimiters.
+ * \ingroup io
+ * \tparam char_t        The stream's character type; must be one byte large so std::memchr can be used.
+ * \tparam traits_t      The stream's traits type.
+ * \tparam more_char_t   Further delimiter types (all `char_t`).
+ *
+ * \param[in,out] streambuf       The stream buffer to advance.
+ * \param[in]     delimiter       The delimiter to stop at.
+ * \param[in]     more_delimiters Optional further delimiters; the stream stops at whichever comes first.
+ *
+ * \throws seqan3::unexpected_end_of_input if the end of the stream is reached before any delimiter.
+ *
+ * \details
+ *
+ * The function scans the get area of the stream buffer with std::memchr and moves the get pointer in
+ * buffer-sized jumps, i.e. skipped characters are never copied or inspected individually. On return
+ * the stream is positioned **on** the found delimiter (it is not consumed).
+ */
+template <typename char_t, typename traits_t, typename ...more_char_t>
+inline void fast_skip_until(std::basic_streambuf<char_t, traits_t> & streambuf,
+                            char_t const delimiter,
+                            more_char_t const ...more_delimiters)
+{
+    static_assert(sizeof(char_t) == 1, "fast_skip_until requires a character type of size 1.");
+    static_assert((std::is_same_v<more_char_t, char_t> && ...),
+                  "All delimiters must be of the stream's character type.");
+
+    auto * buf = reinterpret_cast<stream_buffer_exposer<char_t, traits_t> *>(&streambuf);
+
+    while (true)
+    {
+        if (buf->gptr() == buf->egptr()) // get area exhausted, refill it
+        {
+            if (traits_t::eq_int_type(buf->sgetc(), traits_t::eof()))
+                throw unexpected_end_of_input{"Reached end of input while expecting a field delimiter."};
+        }
+
+        char_t const * const first = buf->gptr();
+        char_t const * closest_hit = buf->egptr();
+
+        auto scan = [first, &closest_hit] (char_t const d)
+        {
+            if (auto const * hit = static_cast<char_t const *>(std::memchr(first, d, closest_hit - first));
+                hit != nullptr)
+            {
+                closest_hit = hit; // shrink the window to the closest delimiter found so far
+            }
+        };
+
+        scan(delimiter);
+        (scan(more_delimiters), ...);
+
+        buf->gbump(closest_hit - first);
+
+        if (closest_hit != buf->egptr()) // the stream is now positioned on the delimiter
+            return;
+    }
+}
+
+} // namespace seqan3::detail
@@ -17,6 +17,7 @@
 #include <range/v3/range_fwd.hpp>
 
 #include <seqan3/core/platform.hpp>
+#include <seqan3/core/tracing.hpp>
 
 #include <seqan3/std/ranges>
 
@@ -88,6 +89,7 @@ public:
     in_file_iterator & operator++()
     {
         assert(host != nullptr);
+        SEQAN3_TRACE_SCOPE("io::read_record");
         host->read_next_record();
         return *this;
     }
@@ -21,8 +21,13 @@
     #include <seqan3/contrib/stream/bz2_istream.hpp>
 #endif
 #ifdef SEQAN3_HAS_ZLIB
+    #include <seqan3/contrib/stream/bgzf_istream.hpp>
     #include <seqan3/contrib/stream/gz_istream.hpp>
 #endif
+#ifdef SEQAN3_HAS_ZSTD
+    #include <seqan3/contrib/stream/zstd_istream.hpp>
+#endif
+#include <seqan3/io/detail/async_istream.hpp>
 #include <seqan3/std/concepts>
 #include <seqan3/std/filesystem>
 #include <seqan3/std/ranges>
@@ -62,6 +67,23 @@ inline bool starts_with(ref_t && reference, query_t && query)
     }
 }
 
+/*!\brief Wraps a freshly created decompression stream into a stream that prefetches on a background thread.
+ * \param[in] inner A pointer to the decompression stream; ownership is taken over.
+ * \returns A pointer to the prefetching stream whose deleter also destroys the decompression stream.
+ *
+ * \details
+ *
+ * Single-threaded decompressors serialise inflation and record parsing; draining them from a
+ * background thread into the double buffer of seqan3::detail::async_istream overlaps the two.
+ */
+template <char_concept char_t>
+inline auto make_async_secondary_istream(std::basic_istream<char_t> * inner)
+    -> std::unique_ptr<std::basic_istream<char_t>, std::function<void(std::basic_istream<char_t>*)>>
+{
+    return {new async_istream<char_t>{*inner},
+            [inner] (std::basic_istream<char_t> * ptr) { delete ptr; delete inner; }};
+}
+
 /*!\brief Depending on the magic bytes of the given stream, return a decompression stream or forward the primary stream.
  * \param[in] primary_stream The primary (device) stream for reading.
  * \param[in,out] filename  The associated filename; compression extensions will be stripped. [optional]
@@ -103,7 +125,12 @@ inline auto make_secondary_istream(std::basic_istream<char_t> & primary_stream,
         if ((extension == ".gz") || (extension == ".bgzf"))
             filename.replace_extension();
 
-        return {new contrib::basic_gz_istream<char_t>{primary_stream}, stream_deleter_default};
+        // FEXTRA is set for BGZF (block-compressed GZIP) -> decompress blocks in parallel
+        if (magic_number[3] == '\x04')
+            return {new contrib::basic_bgzf_istream<char_t>{primary_stream}, stream_deleter_default};
+
+        // plain gzip decompresses single-threaded -> drain it on a background thread
+        return make_async_secondary_istream(new contrib::basic_gz_istream<char_t>{primary_stream});
     #else
         throw file_open_error{"Trying to read from a gzipped file, but no ZLIB available."};
     #endif
@@ -114,14 +141,21 @@ inline auto make_secondary_istream(std::basic_istream<char_t> & primary_stream,
         if (extension == ".bz2")
             filename.replace_extension();
 
-        return {new contrib::basic_bz2_istream<char_t>{primary_stream}, stream_deleter_default};
+        return make_async_secondary_istream(new contrib::basic_bz2_istream<char_t>{primary_stream});
     #else
         throw file_open_error{"Trying to read from a bzipped file, but no libbz2 available."};
     #endif
     }
     else if (starts_with(magic_number, std::array{'\x28', '\xb5', '\x2f', '\xfd'})) // ZStd
     {
-        throw file_open_error{"Trying to read from a zst'ed file, but SeqAn does not yet support this."};
+    #ifdef SEQAN3_HAS_ZSTD
+        if (extension == ".zst")
+            filename.replace_extension();
+
+        return make_async_secondary_istream(new contrib::basic_zstd_istream<char_t>{primary_stream});
+    #else
+        throw file_open_error{"Trying to read from a zst'ed file, but no libzstd available."};
+    #endif
     }
 
     return {&primary_stream, stream_deleter_noop};
@@ -21,8 +21,12 @@
     #include <seqan3/contrib/stream/bz2_ostream.hpp>
 #endif
 #ifdef SEQAN3_HAS_ZLIB
+    #include <seqan3/contrib/stream/bgzf_ostream.hpp>
     #include <seqan3/contrib/stream/gz_ostream.hpp>
 #endif
+#ifdef SEQAN3_HAS_ZSTD
+    #include <seqan3/contrib/stream/zstd_ostream.hpp>
+#endif
 
 namespace seqan3::detail
 {
@@ -46,12 +50,13 @@ inline auto make_secondary_ostream(std::basic_ostream<char_t> & primary_stream,
 
     if ((extension == ".gz") || (extension == ".bgzf") || (extension == ".bam"))
     {
-        //TODO: always write bgzf even when gz was requested? It's compatible and faster
+        // bgzf is always written, even when gz was requested: it is a valid multi-member gzip
+        // file that any gzip decompressor reads, but it compresses with multiple threads
     #ifdef SEQAN3_HAS_ZLIB
         if (extension != ".bam") // remove extension except for bam
             filename.replace_extension("");
 
-        return {new contrib::basic_gz_ostream<char_t>{primary_stream}, stream_deleter_default};
+        return {new contrib::basic_bgzf_ostream<char_t>{primary_stream}, stream_deleter_default};
     #else
         throw file_open_error{"Trying to write a gzipped file, but no ZLIB available."};
     #endif
@@ -67,7 +72,12 @@ inline auto make_secondary_ostream(std::basic_ostream<char_t> & primary_stream,
     }
     else if (extension == ".zst")
     {
-        throw file_open_error{"Trying to write a zst'ed file, but SeqAn3 does not yet support this."};
+    #ifdef SEQAN3_HAS_ZSTD
+        filename.replace_extension("");
+        return {new contrib::basic_zstd_ostream<char_t>{primary_stream}, stream_deleter_default};
+    #else
+        throw file_open_error{"Trying to write a zst'ed file, but no libzstd available."};
+    #endif
     }
 
     return {&primary_stream, stream_deleter_noop};
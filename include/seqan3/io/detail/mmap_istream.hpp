@@ -0,0 +1,284 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::mmap_istream.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <iostream>
+
+#include <seqan3/core/concept/core_language.hpp>
+#include <seqan3/std/filesystem>
+
+#if defined(__unix__) || (defined(__APPLE__) && defined(__MACH__))
+    #define SEQAN3_HAS_MMAP 1
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace seqan3::detail
+{
+
+/*!\brief A read-only stream buffer over a memory-mapped file.
+ * \tparam char_t The character type of the stream; must be byte-sized.
+ * \ingroup io
+ *
+ * \details
+ *
+ * The entire mapping serves as the get area, i.e. after construction every sgetc()/sbumpc() is an
+ * inlined pointer access and underflow() is only reached at the end of the file. This avoids the
+ * per-character virtual call and copy overhead of a std::basic_filebuf.
+ *
+ * Mapping can fail (unsupported platform, special files like pipes, …); check is_open() after
+ * construction and fall back to a regular file stream if it returns false.
+ */
+template <char_concept char_t>
+class mmap_istreambuf :
+    public std::basic_streambuf<char_t>
+{
+public:
+    static_assert(sizeof(char_t) == 1, "mmap_istreambuf requires a byte-sized character type.");
+
+    //!\brief The traits type of the stream buffer.
+    using traits_type = typename std::basic_streambuf<char_t>::traits_type;
+    //!\brief The integer type used for EOF signalling.
+    using int_type = typename traits_type::int_type;
+
+    /*!\brief Try to map the given file into memory.
+     * \param[in] filename    Path to the file to map.
+     * \param[in] single_pass Whether to advise the OS to drop consumed pages (see seqan3::stream_single_pass).
+     *
+     * On failure no exception is thrown; the buffer simply remains closed.
+     */
+    explicit mmap_istreambuf(std::filesystem::path const & filename, bool const single_pass = false)
+    {
+#ifdef SEQAN3_HAS_MMAP
+        int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd == -1)
+            return;
+
+        struct stat file_status;
+        if ((::fstat(fd, &file_status) == -1) || !S_ISREG(file_status.st_mode))
+        {
+            ::close(fd);
+            return;
+        }
+
+        m_size = file_status.st_size;
+
+        if (m_size > 0)
+        {
+            void * mapping = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping == MAP_FAILED)
+            {
+                ::close(fd);
+                m_size = 0;
+                return;
+            }
+
+            ::posix_madvise(mapping, m_size, POSIX_MADV_SEQUENTIAL);
+            m_mapping = reinterpret_cast<char_t *>(mapping);
+        }
+
+        if (single_pass && m_size > 0)
+        {
+            // page-cache eviction needs the descriptor, so it is kept open until destruction
+            m_fd = fd;
+            m_single_pass = true;
+#ifdef POSIX_FADV_SEQUENTIAL
+            ::posix_fadvise(m_fd, 0, 0, POSIX_FADV_SEQUENTIAL); // doubles the kernel read-ahead window
+#endif
+        }
+        else
+        {
+            ::close(fd); // the mapping stays valid without the descriptor
+        }
+
+        m_open = true;
+
+        this->setg(m_mapping, m_mapping, m_mapping + window_end(0));
+#else
+        (void) filename;
+        (void) single_pass;
+#endif
+    }
+
+    //!\brief Unmaps the file and in single-pass mode evicts it from the page cache.
+    ~mmap_istreambuf()
+    {
+#ifdef SEQAN3_HAS_MMAP
+        if (m_mapping != nullptr)
+            ::munmap(m_mapping, m_size);
+
+        if (m_fd != -1)
+        {
+#ifdef POSIX_FADV_DONTNEED
+            ::posix_fadvise(m_fd, 0, 0, POSIX_FADV_DONTNEED); // now unreferenced -> pages can be evicted
+#endif
+            ::close(m_fd);
+        }
+#endif
+    }
+
+    //!\brief Whether the file was successfully mapped.
+    bool is_open() const
+    {
+        return m_open;
+    }
+
+    //!\brief Direct access to the mapped region (nullptr for empty files).
+    char_t const * data() const
+    {
+        return m_mapping;
+    }
+
+    //!\brief The size of the mapped region.
+    size_t size() const
+    {
+        return m_size;
+    }
+
+protected:
+    /*!\brief Advances the get area to the next window (single-pass mode) or signals end-of-file.
+     *
+     * Without single-pass mode the get area spans the whole file, so reaching its end means
+     * end-of-file. In single-pass mode the get area is a sliding window instead; whenever it is
+     * exhausted, the pages behind it are released and evicted before the window moves on.
+     */
+    int_type underflow() override
+    {
+#ifdef SEQAN3_HAS_MMAP
+        size_t const consumed = this->gptr() - this->eback();
+        if (consumed >= m_size)
+            return traits_type::eof();
+
+        drop_consumed_pages(consumed);
+        this->setg(m_mapping, m_mapping + consumed, m_mapping + window_end(consumed));
+        return traits_type::to_int_type(*this->gptr());
+#else
+        return traits_type::eof();
+#endif
+    }
+
+    //!\brief The traits' position type.
+    using pos_type = typename traits_type::pos_type;
+    //!\brief The traits' offset type.
+    using off_type = typename traits_type::off_type;
+
+    //!\brief Seeking just moves the get pointer within the mapping.
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override
+    {
+        if (!m_open || !(which & std::ios_base::in))
+            return pos_type{off_type{-1}};
+
+        off_type const base = (dir == std::ios_base::beg) ? 0
+                            : (dir == std::ios_base::cur) ? (this->gptr() - this->eback())
+                                                          : static_cast<off_type>(m_size);
+        off_type const new_pos = base + off;
+
+        if ((new_pos < 0) || (new_pos > static_cast<off_type>(m_size)))
+            return pos_type{off_type{-1}};
+
+        this->setg(m_mapping, m_mapping + new_pos, m_mapping + window_end(new_pos));
+        return pos_type{new_pos};
+    }
+
+    //!\copydoc seekoff
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override
+    {
+        return seekoff(off_type{pos}, std::ios_base::beg, which);
+    }
+
+private:
+    //!\brief The size of the sliding get area window in single-pass mode.
+    static constexpr size_t window_size = 1u << 22; // 4MiB
+
+    //!\brief Returns the end offset of the get area starting at \p position.
+    size_t window_end(size_t const position) const
+    {
+        if (!m_single_pass)
+            return m_size;
+        return std::min(m_size, position + window_size);
+    }
+
+    //!\brief Releases and evicts all whole pages before \p up_to (single-pass mode only).
+    void drop_consumed_pages(size_t const up_to)
+    {
+#ifdef SEQAN3_HAS_MMAP
+        if (!m_single_pass)
+            return;
+
+        static size_t const page_size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        size_t const aligned = up_to & ~(page_size - 1);
+        if (aligned <= m_dropped)
+            return;
+
+        // first drop our references to the pages, then ask for their eviction from the page cache
+        ::madvise(m_mapping + m_dropped, aligned - m_dropped, MADV_DONTNEED);
+#ifdef POSIX_FADV_DONTNEED
+        ::posix_fadvise(m_fd, m_dropped, aligned - m_dropped, POSIX_FADV_DONTNEED);
+#endif
+        m_dropped = aligned;
+#else
+        (void) up_to;
+#endif
+    }
+
+    char_t * m_mapping{nullptr}; //!< Pointer to the mapped region (nullptr for empty files).
+    size_t m_size{0};            //!< The size of the mapped region.
+    bool m_open{false};          //!< Whether mapping succeeded.
+    bool m_single_pass{false};   //!< Whether consumed pages are dropped behind the get area.
+    int m_fd{-1};                //!< The file descriptor (kept open in single-pass mode only).
+    size_t m_dropped{0};         //!< The number of leading bytes already released.
+};
+
+/*!\brief A read-only input stream over a memory-mapped file.
+ * \tparam char_t The character type of the stream; must be byte-sized.
+ * \ingroup io
+ *
+ * \details
+ *
+ * Drop-in replacement for a std::basic_ifstream opened in binary mode, but backed by
+ * seqan3::detail::mmap_istreambuf, i.e. character extraction happens straight from the page cache.
+ * If mapping the file fails, is_open() returns false and the failbit is set.
+ */
+template <char_concept char_t>
+class mmap_istream :
+    public std::basic_istream<char_t>
+{
+public:
+    /*!\brief Try to open the given file via a memory mapping.
+     * \param[in] filename    Path to the file to map.
+     * \param[in] single_pass Whether to advise the OS to drop consumed pages (see seqan3::stream_single_pass).
+     */
+    explicit mmap_istream(std::filesystem::path const & filename, bool const single_pass = false) :
+        std::basic_istream<char_t>{nullptr},
+        m_buf{filename, single_pass}
+    {
+        this->rdbuf(&m_buf); // also clears the state flags set by the nullptr above
+
+        if (!m_buf.is_open())
+            this->setstate(std::ios_base::failbit);
+    }
+
+    //!\brief Whether the file was successfully mapped.
+    bool is_open() const
+    {
+        return m_buf.is_open();
+    }
+
+private:
+    //!\brief The stream buffer doing the actual work.
+    mmap_istreambuf<char_t> m_buf;
+};
+
+} // namespace seqan3::detail
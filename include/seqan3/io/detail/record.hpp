@@ -153,6 +153,26 @@ auto const & get_or_ignore(std::tuple<types...> const & t)
     else
         return std::ignore;
 }
+
+//!\copydoc seqan3::detail::get_or_ignore
+template <field f, typename field_types, typename field_ids>
+decltype(auto) get_or_ignore(record<field_types, field_ids> && r)
+{
+    if constexpr (field_ids::contains(f))
+        return std::get<field_ids::index_of(f)>(std::move(r));
+    else
+        return (std::ignore); // parenthesised so that a reference is returned
+}
+
+//!\copydoc seqan3::detail::get_or_ignore
+template <size_t i, typename ... types>
+decltype(auto) get_or_ignore(std::tuple<types...> && t)
+{
+    if constexpr (i < sizeof...(types))
+        return std::get<i>(std::move(t));
+    else
+        return (std::ignore); // parenthesised so that a reference is returned
+}
 //!\}
 
 
@@ -183,6 +203,16 @@ decltype(auto) get_or(record<field_types, field_ids> const & r, or_type && or_va
         return std::forward<or_type>(or_value);
 }
 
+//!\copydoc seqan3::detail::get_or
+template <field f, typename field_types, typename field_ids, typename or_type>
+decltype(auto) get_or(record<field_types, field_ids> && r, or_type && or_value)
+{
+    if constexpr (field_ids::contains(f))
+        return std::get<field_ids::index_of(f)>(std::move(r));
+    else
+        return std::forward<or_type>(or_value);
+}
+
 //!\copydoc seqan3::detail::get_or
 template <size_t i, typename or_type, typename ... types>
 decltype(auto) get_or(std::tuple<types...> & t, or_type && or_value)
@@ -202,6 +232,16 @@ decltype(auto) get_or(std::tuple<types...> const & t, or_type && or_value)
     else
         return std::forward<or_type>(or_value);
 }
+
+//!\copydoc seqan3::detail::get_or
+template <size_t i, typename or_type, typename ... types>
+decltype(auto) get_or(std::tuple<types...> && t, or_type && or_value)
+{
+    if constexpr (i < sizeof...(types))
+        return std::get<i>(std::move(t));
+    else
+        return std::forward<or_type>(or_value);
+}
 //!\}
 
 // ----------------------------------------------------------------------------
@@ -0,0 +1,212 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::record_prefetcher.
+ * \author Hannes Hauswedell <hannes.hauswedell AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3
+{
+
+/*!\brief The result of a non-blocking record request on an input file.
+ * \ingroup io
+ * \see seqan3::sequence_file_input::try_next_record
+ */
+enum class record_availability
+{
+    ready,   //!< A record was available and has been assigned to the output parameter.
+    pending, //!< No record is buffered yet, but the input is not exhausted either; poll again later.
+    at_end   //!< The input is exhausted; no further record will become available.
+};
+
+} // namespace seqan3
+
+namespace seqan3::detail
+{
+
+/*!\brief Keeps a bounded ring of records filled by a background thread ahead of the consumer.
+ * \tparam record_t The type of the buffered records.
+ * \ingroup io
+ *
+ * \details
+ *
+ * On construction a background thread is started that repeatedly invokes the producer function and
+ * stores the produced records in a ring of at most `depth` elements; the thread blocks while the ring
+ * is full. The consumer retrieves records in production order via pop(), which blocks while the ring
+ * is empty and the producer has not finished.
+ *
+ * The producer function is only ever called from the background thread; it must fill the passed record
+ * and return `true`, or return `false` when the input is exhausted. If it throws, records produced
+ * before the exception are still delivered and the exception is then rethrown from pop().
+ *
+ * Used by the input files to overlap record parsing with the consumer's work, see e.g.
+ * seqan3::sequence_file_input::prefetch().
+ */
+template <typename record_t>
+class record_prefetcher
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    record_prefetcher()                                      = delete; //!< A producer function is required.
+    record_prefetcher(record_prefetcher const &)             = delete; //!< The background thread binds `this`.
+    record_prefetcher & operator=(record_prefetcher const &) = delete; //!< The background thread binds `this`.
+    record_prefetcher(record_prefetcher &&)                  = delete; //!< The background thread binds `this`.
+    record_prefetcher & operator=(record_prefetcher &&)      = delete; //!< The background thread binds `this`.
+
+    /*!\brief Start prefetching.
+     * \param[in] depth    The maximum number of records buffered ahead of the consumer (at least 1).
+     * \param[in] producer Invoked on the background thread to fill the next record; returns `false` at the
+     *                     end of the input.
+     */
+    record_prefetcher(size_t const depth, std::function<bool(record_t &)> producer) :
+        max_depth{std::max<size_t>(depth, 1u)}
+    {
+        producer_thread = std::thread{[this, producer = std::move(producer)] ()
+        {
+            record_t scratch{};
+
+            while (true)
+            {
+                bool produced = false;
+
+                try
+                {
+                    produced = producer(scratch);
+                }
+                catch (...)
+                {
+                    std::unique_lock lock{mutex};
+                    producer_error = std::current_exception();
+                    producer_done = true;
+                    ring_filled.notify_all();
+                    return;
+                }
+
+                std::unique_lock lock{mutex};
+
+                if (!produced)
+                {
+                    producer_done = true;
+                    ring_filled.notify_all();
+                    return;
+                }
+
+                ring_drained.wait(lock, [this] { return (ring.size() < max_depth) || stop_requested; });
+
+                if (stop_requested)
+                    return;
+
+                ring.push_back(std::move(scratch));
+                ring_filled.notify_one();
+            }
+        }};
+    }
+
+    //!\brief Stops the background thread (records still in the ring are discarded).
+    ~record_prefetcher()
+    {
+        {
+            std::unique_lock lock{mutex};
+            stop_requested = true;
+        }
+        ring_drained.notify_all();
+
+        if (producer_thread.joinable())
+            producer_thread.join();
+    }
+    //!\}
+
+    /*!\brief Retrieve the next record, blocking until one is available.
+     * \param[out] out Assigned the next record.
+     * \returns `false` when the input is exhausted (`out` is left unchanged), `true` otherwise.
+     * \throws The producer's exception, after all records produced before it have been delivered.
+     */
+    bool pop(record_t & out)
+    {
+        std::unique_lock lock{mutex};
+        ring_filled.wait(lock, [this] { return !ring.empty() || producer_done; });
+
+        if (ring.empty())
+        {
+            if (producer_error != nullptr)
+                std::rethrow_exception(std::exchange(producer_error, nullptr));
+
+            return false;
+        }
+
+        out = std::move(ring.front());
+        ring.pop_front();
+        ring_drained.notify_one();
+        return true;
+    }
+
+    /*!\brief Retrieve the next record if one is buffered, without ever blocking.
+     * \param[out] out Assigned the next record if seqan3::record_availability::ready is returned.
+     * \returns The availability of a record; on seqan3::record_availability::pending the producer has not
+     *          caught up yet and the caller should poll again later.
+     * \throws The producer's exception, after all records produced before it have been delivered.
+     */
+    record_availability try_pop(record_t & out)
+    {
+        std::unique_lock lock{mutex};
+
+        if (ring.empty())
+        {
+            if (!producer_done)
+                return record_availability::pending;
+
+            if (producer_error != nullptr)
+                std::rethrow_exception(std::exchange(producer_error, nullptr));
+
+            return record_availability::at_end;
+        }
+
+        out = std::move(ring.front());
+        ring.pop_front();
+        ring_drained.notify_one();
+        return record_availability::ready;
+    }
+
+private:
+    //!\brief Maximum number of records buffered ahead of the consumer.
+    size_t max_depth{1};
+    //!\brief The buffered records in production order.
+    std::deque<record_t> ring{};
+    //!\brief Protects \ref ring and the flags below.
+    std::mutex mutex{};
+    //!\brief Signalled when a record was added to the ring (or the producer finished).
+    std::condition_variable ring_filled{};
+    //!\brief Signalled when a record was taken from the ring (or a stop was requested).
+    std::condition_variable ring_drained{};
+    //!\brief Whether the producer finished (end of input or exception).
+    bool producer_done{false};
+    //!\brief Whether the destructor asked the producer to stop.
+    bool stop_requested{false};
+    //!\brief An exception thrown by the producer, rethrown from pop().
+    std::exception_ptr producer_error{nullptr};
+    //!\brief The background thread running the producer.
+    std::thread producer_thread{};
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,243 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::for_each_record_parallel.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <seqan3/core/metafunction/basic.hpp>
+#include <seqan3/core/parallel/thread_pool.hpp>
+#include <seqan3/std/concepts>
+
+namespace seqan3::detail
+{
+
+/*!\brief The ordered record pipeline shared by the seqan3::for_each_record_parallel overloads.
+ * \param[in,out] file         The input file to iterate.
+ * \param[in,out] fn           Invoked with each record on a worker thread.
+ * \param[in,out] emit         Invoked with each (non-void) result of `fn` on the calling thread, in record order.
+ * \param[in]     thread_count The number of worker threads.
+ * \ingroup io
+ *
+ * \details
+ *
+ * The calling thread reads records from the file and submits one task per record to a private pool;
+ * tasks deposit their result under a ticket number and the calling thread hands finished results to
+ * `emit` strictly in ticket (i.e. record) order. At most `4 * thread_count` records are in flight, so
+ * memory stays bounded even when one record takes much longer than its successors. Worker tasks never
+ * block on each other, which keeps the pipeline safe for the in-order queue of seqan3::thread_pool.
+ *
+ * If `fn` throws, all results of earlier records are still emitted, then the exception is rethrown on
+ * the calling thread (after every in-flight task has finished).
+ */
+template <typename file_t, typename fn_t, typename emit_t>
+void for_each_record_parallel_impl(file_t & file, fn_t & fn, emit_t && emit, size_t const thread_count)
+{
+    using record_t = typename remove_cvref_t<file_t>::record_type;
+    using raw_result_t = std::invoke_result_t<fn_t &, record_t &>;
+    constexpr bool has_result = !std::is_void_v<raw_result_t>;
+    //!\cond
+    struct no_result_t {};
+    //!\endcond
+    using result_t = std::conditional_t<has_result, raw_result_t, no_result_t>;
+
+    // state shared with the worker tasks; declared before the pool so that it outlives all tasks even
+    // when emit throws while tasks are still running (the pool's destructor joins them)
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::map<size_t, result_t> finished;              // results not yet handed to emit, keyed by ticket
+    std::map<size_t, std::exception_ptr> failed;      // exceptions from fn, keyed by ticket
+    size_t completed = 0;                             // tasks that deposited a result or an exception
+    size_t submitted = 0;
+    size_t emitted = 0;
+
+    thread_pool pool{thread_count};
+    size_t const window = 4 * pool.thread_count();
+
+    // emits finished results in record order until `done_for_now` holds; called on this thread only
+    auto drain = [&] (auto && done_for_now)
+    {
+        std::unique_lock lock{mutex};
+
+        while (true)
+        {
+            if (auto it = failed.find(emitted); it != failed.end()) // the next record in order failed
+            {
+                std::exception_ptr error = it->second;
+                ready.wait(lock, [&] () { return completed == submitted; }); // tasks reference our state
+                std::rethrow_exception(error);
+            }
+
+            if (auto it = finished.find(emitted); it != finished.end())
+            {
+                result_t result = std::move(it->second);
+                finished.erase(it);
+                ++emitted;
+
+                if constexpr (has_result)
+                {
+                    lock.unlock();
+                    emit(std::move(result));
+                    lock.lock();
+                }
+                continue;
+            }
+
+            if (done_for_now())
+                return;
+
+            ready.wait(lock);
+        }
+    };
+
+    for (auto record_it = file.begin(); record_it != file.end(); ++record_it)
+    {
+        drain([&] () { return submitted - emitted < window; });
+
+        size_t const ticket = submitted++;
+        pool.submit([&, ticket, record = std::move(*record_it)] () mutable
+        {
+            try
+            {
+                if constexpr (has_result)
+                {
+                    result_t result = fn(record);
+                    std::lock_guard<std::mutex> lock{mutex};
+                    finished.emplace(ticket, std::move(result));
+                    ++completed;
+                }
+                else
+                {
+                    fn(record);
+                    std::lock_guard<std::mutex> lock{mutex};
+                    finished.emplace(ticket, result_t{});
+                    ++completed;
+                }
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+                failed.emplace(ticket, std::current_exception());
+                ++completed;
+            }
+
+            ready.notify_all();
+        });
+    }
+
+    drain([&] () { return emitted == submitted; });
+}
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+/*!\brief Applies a function to every record of an input file in parallel, collecting results in record order.
+ * \tparam file_t The input file type, e.g. seqan3::sequence_file_input or seqan3::alignment_file_input.
+ * \tparam fn_t   The type of the per-record function; invoked with a reference to the file's record type.
+ * \param[in,out] file         The input file to iterate; consumed by the call.
+ * \param[in,out] fn           Invoked once per record on a worker thread; must be safe to invoke concurrently.
+ * \param[in]     thread_count The number of worker threads.
+ * \returns The results of `fn` in record order as a std::vector, or nothing if `fn` returns `void`.
+ * \throws The first (in record order) exception thrown by `fn`, rethrown on the calling thread after the
+ *         results of all earlier records have been collected.
+ * \ingroup io
+ *
+ * \details
+ *
+ * This is the one-call wrapper over the parallel input machinery: the calling thread parses records and
+ * dispatches them to `thread_count` worker threads, at most `4 * thread_count` records are in flight at
+ * any time, and results are collected strictly in record order — so downstream output keeps the order of
+ * the input file no matter how the per-record runtimes vary. Record parsing itself stays on the calling
+ * thread; combine with seqan3::sequence_file_input::parse_parallel() or prefetch() (set up before this
+ * call) when parsing is the bottleneck.
+ *
+ * If `fn` returns `void` its invocations are merely completed before the call returns; their relative
+ * order across worker threads is unspecified. Use the three-argument overload to consume ordered
+ * results one by one without materialising all of them.
+ *
+ * ### Example
+ *
+ * \include test/snippet/io/for_each_record_parallel.cpp
+ *
+ * ### Exceptions
+ *
+ * Basic exception guarantee; the file is left in an unspecified reading position if `fn` throws.
+ */
+template <typename file_t, typename fn_t>
+//!\cond
+    requires requires { typename remove_cvref_t<file_t>::record_type; } &&
+             std::Invocable<fn_t &, typename remove_cvref_t<file_t>::record_type &>
+//!\endcond
+auto for_each_record_parallel(file_t && file, fn_t fn,
+                              size_t const thread_count = std::thread::hardware_concurrency())
+{
+    using record_t = typename remove_cvref_t<file_t>::record_type;
+
+    if constexpr (std::is_void_v<std::invoke_result_t<fn_t &, record_t &>>)
+    {
+        detail::for_each_record_parallel_impl(file, fn, [] (auto &&) {}, std::max<size_t>(thread_count, 1u));
+    }
+    else
+    {
+        std::vector<std::invoke_result_t<fn_t &, record_t &>> results{};
+        detail::for_each_record_parallel_impl(file, fn,
+                                              [&results] (auto && result)
+                                              {
+                                                  results.push_back(std::forward<decltype(result)>(result));
+                                              },
+                                              std::max<size_t>(thread_count, 1u));
+        return results;
+    }
+}
+
+/*!\brief Applies a function to every record of an input file in parallel, consuming results in record order.
+ * \tparam consume_fn_t The type of the result consumer; invoked with each result of `fn`.
+ * \param[in,out] file         The input file to iterate; consumed by the call.
+ * \param[in,out] fn           Invoked once per record on a worker thread; must be safe to invoke concurrently.
+ * \param[in,out] consume_fn   Invoked with the results of `fn` on the calling thread, strictly in record order.
+ * \param[in]     thread_count The number of worker threads.
+ * \ingroup io
+ *
+ * \details
+ *
+ * The streaming counterpart of the two-argument overload: instead of materialising all results in a
+ * std::vector, each result is handed to `consume_fn` (e.g. a write to an output file) as soon as all
+ * results of earlier records have been consumed. Memory stays bounded by the in-flight window of
+ * `4 * thread_count` records regardless of the input size.
+ */
+template <typename file_t, typename fn_t, typename consume_fn_t>
+//!\cond
+    requires requires { typename remove_cvref_t<file_t>::record_type; } &&
+             std::Invocable<fn_t &, typename remove_cvref_t<file_t>::record_type &> &&
+             std::Invocable<consume_fn_t &,
+                            std::invoke_result_t<fn_t &, typename remove_cvref_t<file_t>::record_type &>>
+//!\endcond
+void for_each_record_parallel(file_t && file, fn_t fn, consume_fn_t consume_fn,
+                              size_t const thread_count = std::thread::hardware_concurrency())
+{
+    detail::for_each_record_parallel_impl(file, fn,
+                                          [&consume_fn] (auto && result)
+                                          {
+                                              consume_fn(std::forward<decltype(result)>(result));
+                                          },
+                                          std::max<size_t>(thread_count, 1u));
+}
+
+} // namespace seqan3
@@ -18,6 +18,7 @@
 
 #include <seqan3/core/type_list.hpp>
 #include <seqan3/core/metafunction/template_inspection.hpp>
+#include <seqan3/range/container/concept.hpp>
 
 namespace seqan3
 {
@@ -180,7 +181,7 @@ public:
     static_assert(field_types::size() == field_ids::as_array.size(),
                   "You must give as many IDs as types to seqan3::record.");
 
-    //!\brief (Re-)Initialise all tuple elements with `{}`.
+    //!\brief Clear all tuple elements; elements that are containers retain their capacity.
     void clear()
     {
         clear_impl(*this, std::make_integer_sequence<size_t, field_types::size()>{});
@@ -190,7 +191,17 @@ private:
     template <size_t ...Is>
     constexpr void clear_impl(base_type & tup, std::integer_sequence<size_t, Is...> const &)
     {
-        ((std::get<Is>(tup) = {}), ...);
+        (clear_element(std::get<Is>(tup)), ...);
+    }
+
+    //!\brief Clears a single element; containers keep their allocation, other types are value-initialised.
+    template <typename field_t>
+    static constexpr void clear_element(field_t & element)
+    {
+        if constexpr (container_concept<field_t>)
+            element.clear();
+        else
+            element = {};
     }
 };
 
@@ -17,8 +17,12 @@
  * \brief \todo document at a later point in time
  */
 
+#include <seqan3/io/sequence_file/bulk_load.hpp>
+#include <seqan3/io/sequence_file/fai_index.hpp>
+#include <seqan3/io/sequence_file/format_binary.hpp>
 #include <seqan3/io/sequence_file/format_fasta.hpp>
 #include <seqan3/io/sequence_file/input_format_concept.hpp>
 #include <seqan3/io/sequence_file/input.hpp>
 #include <seqan3/io/sequence_file/output_format_concept.hpp>
 #include <seqan3/io/sequence_file/output.hpp>
+#include <seqan3/io/sequence_file/statistics.hpp>
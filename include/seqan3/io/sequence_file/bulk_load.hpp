@@ -0,0 +1,139 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::sequence_file_bulk_load.
+ * \author Hannes Hauswedell <hannes.hauswedell AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/metafunction/range.hpp>
+#include <seqan3/io/detail/mmap_istream.hpp>
+#include <seqan3/io/exception.hpp>
+#include <seqan3/io/stream/parse_condition.hpp>
+#include <seqan3/range/container/concatenated_sequences.hpp>
+#include <seqan3/std/filesystem>
+
+namespace seqan3
+{
+
+/*!\brief Load an entire (uncompressed) FastA file into two seqan3::concatenated_sequences in one pass.
+ * \tparam seq_legal_alphabet_t The alphabet that characters in the file are checked against; defaults to the
+ *                              sequence container's alphabet.
+ * \param[in]     filename  Path to the file to load.
+ * \param[in,out] sequences The container the sequences are loaded into; previous contents are discarded.
+ * \param[in,out] ids       The container the IDs are loaded into; previous contents are discarded.
+ * \throws seqan3::file_open_error If the file could not be opened.
+ * \throws seqan3::parse_error     If the file violates the FastA format or contains illegal characters.
+ * \ingroup sequence
+ *
+ * \details
+ *
+ * Reading record-by-record through seqan3::sequence_file_input grows every container incrementally and pays
+ * for one intermediate sequence vector per record. This function instead stats the file, reserves the
+ * concatenated storage from the file size in one shot (the concatenation can never be larger than the file)
+ * and parses straight into the final buffers — one allocation and one pass over the data.
+ *
+ * Only plain FastA is supported; compressed files and other formats must go through
+ * seqan3::sequence_file_input. Whitespace and digits inside the sequence are skipped and IDs are stripped of
+ * the `>`/`;` marker and leading blanks, exactly as seqan3::sequence_file_format_fasta does.
+ */
+template <typename seq_legal_alphabet_t = void,
+          typename seq_inner_type, typename seq_delimiters_type,
+          typename id_inner_type,  typename id_delimiters_type>
+void sequence_file_bulk_load(std::filesystem::path const & filename,
+                             concatenated_sequences<seq_inner_type, seq_delimiters_type> & sequences,
+                             concatenated_sequences<id_inner_type, id_delimiters_type> & ids)
+{
+    using sequence_alphabet_t = value_type_t<seq_inner_type>;
+    using id_alphabet_t       = value_type_t<id_inner_type>;
+    using legal_alphabet_t    = std::conditional_t<std::is_void_v<seq_legal_alphabet_t>,
+                                                   sequence_alphabet_t,
+                                                   seq_legal_alphabet_t>;
+
+    sequences.clear();
+    ids.clear();
+
+    // the file's bytes, either the mapping itself or (fallback) a copy read in one go
+    char const * file_begin = nullptr;
+    char const * file_end   = nullptr;
+
+    detail::mmap_istreambuf<char> mapping{filename};
+    std::vector<char> fallback_buffer{};
+
+    if (mapping.is_open())
+    {
+        file_begin = mapping.data();
+        file_end   = mapping.data() + mapping.size();
+    }
+    else
+    {
+        std::ifstream stream{filename, std::ios_base::in | std::ios::binary};
+        if (!stream.is_open())
+            throw file_open_error{"Could not open file " + filename.string() + " for reading."};
+
+        fallback_buffer.assign(std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{});
+        file_begin = fallback_buffer.data();
+        file_end   = fallback_buffer.data() + fallback_buffer.size();
+    }
+
+    // the concatenation of all sequences (and of all IDs) can never exceed the file size
+    sequences.concat_reserve(file_end - file_begin);
+
+    auto [ seq_concat, seq_delimiters ] = sequences.data(); // pair of references into the containers
+    auto [ id_concat,  id_delimiters  ] = ids.data();
+
+    auto constexpr is_id         = is_char<'>'> || is_char<';'>;
+    auto constexpr is_legal_alph = is_in_alphabet<legal_alphabet_t>;
+
+    char const * it = file_begin;
+    while (it != file_end)
+    {
+        // ID
+        if (!is_id(*it))
+            throw parse_error{std::string{"Expected to be on beginning of ID, but "} + is_id.msg.string() +
+                              " evaluated to false on " + detail::make_printable(*it)};
+
+        while ((it != file_end) && (is_id(*it) || is_blank(*it))) // skip leading > and blanks
+            ++it;
+
+        for (; (it != file_end) && !(is_char<'\n'>(*it) || is_char<'\r'>(*it)); ++it)
+            id_concat.push_back(assign_char(id_alphabet_t{}, *it));
+
+        id_delimiters.push_back(id_concat.size());
+
+        // Sequence (runs until the next header or the end of the file)
+        for (; (it != file_end) && !is_id(*it); ++it)
+        {
+            char const c = *it;
+
+            if (is_space(c) || is_digit(c)) // ignore whitespace and numbers
+                continue;
+
+            if (!is_legal_alph(c))
+            {
+                throw parse_error{std::string{"Encountered an unexpected letter: "} +
+                                  is_legal_alph.msg.string() +
+                                  " evaluated to false on " + detail::make_printable(c)};
+            }
+
+            seq_concat.push_back(assign_char(sequence_alphabet_t{}, c));
+        }
+
+        seq_delimiters.push_back(seq_concat.size());
+    }
+}
+
+} // namespace seqan3
@@ -0,0 +1,230 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::fai_index.
+ */
+
+#pragma once
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <seqan3/io/exception.hpp>
+#include <seqan3/std/filesystem>
+
+namespace seqan3
+{
+
+/*!\brief A FASTA index ("faidx") that maps sequence IDs to byte offsets in the FASTA file.
+ * \ingroup sequence
+ *
+ * \details
+ *
+ * The index is compatible with the `.fai` files written by `samtools faidx`: one line per sequence
+ * with the five tab-separated columns NAME, LENGTH, OFFSET, LINEBASES and LINEWIDTH, where OFFSET
+ * is the byte position of the first sequence character (not of the `>` line), LINEBASES the number
+ * of characters per sequence line and LINEWIDTH the number of bytes per sequence line including the
+ * line terminator.
+ *
+ * An index can be read from an existing `.fai` file via load(), written via save() or built from a
+ * FASTA file directly via build(). It is consumed by seqan3::sequence_file_input::seek_to() to jump
+ * to a record without parsing everything before it.
+ */
+class fai_index
+{
+public:
+    //!\brief One line of the index, describing a single sequence.
+    struct entry
+    {
+        std::string id;      //!< The ID of the sequence (without description).
+        uint64_t length{};   //!< The number of characters in the sequence.
+        uint64_t offset{};   //!< The byte offset of the first sequence character in the FASTA file.
+        uint64_t linebases{};//!< The number of sequence characters per line.
+        uint64_t linewidth{};//!< The number of bytes per line, including the line terminator.
+    };
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    fai_index()                              = default; //!< Defaulted.
+    fai_index(fai_index const &)             = default; //!< Defaulted.
+    fai_index & operator=(fai_index const &) = default; //!< Defaulted.
+    fai_index(fai_index &&)                  = default; //!< Defaulted.
+    fai_index & operator=(fai_index &&)      = default; //!< Defaulted.
+    ~fai_index()                             = default; //!< Defaulted.
+    //!\}
+
+    /*!\brief Read the index from a `.fai` file.
+     * \param[in] fai_path Path to the index file.
+     * \throws seqan3::file_open_error If the file could not be opened.
+     * \throws seqan3::parse_error If a line does not have five numeric-tailed columns.
+     */
+    void load(std::filesystem::path const & fai_path)
+    {
+        std::ifstream stream{fai_path};
+        if (!stream.good())
+            throw file_open_error{"Could not open index file " + fai_path.string() + " for reading."};
+
+        clear();
+
+        std::string line;
+        while (std::getline(stream, line))
+        {
+            if (line.empty())
+                continue;
+
+            entry e;
+            std::istringstream line_stream{line};
+            if (!(std::getline(line_stream, e.id, '\t') &&
+                  (line_stream >> e.length >> e.offset >> e.linebases >> e.linewidth)))
+                throw parse_error{"Malformed line in index file " + fai_path.string() + ": " + line};
+
+            add_entry(std::move(e));
+        }
+    }
+
+    /*!\brief Write the index to a `.fai` file (samtools compatible).
+     * \param[in] fai_path Path to the index file.
+     * \throws seqan3::file_open_error If the file could not be opened.
+     */
+    void save(std::filesystem::path const & fai_path) const
+    {
+        std::ofstream stream{fai_path};
+        if (!stream.good())
+            throw file_open_error{"Could not open index file " + fai_path.string() + " for writing."};
+
+        for (entry const & e : entries_)
+            stream << e.id << '\t' << e.length << '\t' << e.offset << '\t'
+                   << e.linebases << '\t' << e.linewidth << '\n';
+    }
+
+    /*!\brief Build the index by scanning a (uncompressed) FASTA file once.
+     * \param[in] fasta_path Path to the FASTA file.
+     * \returns The index over all sequences in the file.
+     * \throws seqan3::file_open_error If the file could not be opened.
+     * \throws seqan3::parse_error If the file does not start with a FASTA header.
+     */
+    static fai_index build(std::filesystem::path const & fasta_path)
+    {
+        std::ifstream stream{fasta_path, std::ios::binary};
+        if (!stream.good())
+            throw file_open_error{"Could not open file " + fasta_path.string() + " for reading."};
+
+        fai_index index;
+
+        entry current;
+        bool in_record = false;
+
+        std::string line;
+        while (stream.good())
+        {
+            uint64_t const line_offset = stream.tellg();
+
+            if (!std::getline(stream, line))
+                break;
+
+            if (!line.empty() && ((line.front() == '>') || (line.front() == ';')))
+            {
+                if (in_record)
+                    index.add_entry(std::move(current));
+
+                current = entry{};
+                in_record = true;
+
+                // the ID ends at the first whitespace; the rest of the line is the description
+                size_t const id_end = line.find_first_of(" \t");
+                current.id = line.substr(1, id_end == std::string::npos ? std::string::npos : id_end - 1);
+                current.offset = static_cast<uint64_t>(stream.tellg());
+            }
+            else if (in_record && !line.empty())
+            {
+                size_t bases = line.size();
+                if (!line.empty() && (line.back() == '\r')) // getline keeps the CR of CRLF files
+                    --bases;
+
+                if (current.linebases == 0) // line geometry is defined by the first sequence line
+                {
+                    current.linebases = bases;
+                    current.linewidth = static_cast<uint64_t>(stream.tellg()) - line_offset;
+                }
+
+                current.length += bases;
+            }
+            else if (!in_record && !line.empty())
+            {
+                throw parse_error{"Expected to be on beginning of ID when building index for " +
+                                  fasta_path.string() + ", but the file starts with: " + line};
+            }
+        }
+
+        if (in_record)
+            index.add_entry(std::move(current));
+
+        return index;
+    }
+
+    /*!\brief Whether the index holds an entry for the given ID.
+     * \param[in] id The sequence ID to look for.
+     */
+    bool contains(std::string const & id) const
+    {
+        return ids_.count(id) != 0;
+    }
+
+    /*!\brief Return the entry for the given ID.
+     * \param[in] id The sequence ID to look for.
+     * \throws std::out_of_range If the index holds no entry for the ID.
+     */
+    entry const & at(std::string const & id) const
+    {
+        return entries_.at(ids_.at(id));
+    }
+
+    //!\brief Return the entry at the given position (in file order).
+    entry const & operator[](size_t const i) const
+    {
+        return entries_[i];
+    }
+
+    //!\brief The number of sequences in the index.
+    size_t size() const
+    {
+        return entries_.size();
+    }
+
+    //!\brief Whether the index is empty.
+    bool empty() const
+    {
+        return entries_.empty();
+    }
+
+    //!\brief Remove all entries from the index.
+    void clear()
+    {
+        entries_.clear();
+        ids_.clear();
+    }
+
+private:
+    //!\brief Append an entry and register its ID for lookup.
+    void add_entry(entry e)
+    {
+        ids_[e.id] = entries_.size();
+        entries_.push_back(std::move(e));
+    }
+
+    //!\brief The entries in file order.
+    std::vector<entry> entries_;
+    //!\brief Maps IDs to positions in \ref entries_.
+    std::unordered_map<std::string, size_t> ids_;
+};
+
+} // namespace seqan3
@@ -0,0 +1,276 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides the seqan3::sequence_file_format_binary class.
+ * \author Hannes Hauswedell <hannes.hauswedell AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <array>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/metafunction/range.hpp>
+#include <seqan3/io/detail/ignore_output_iterator.hpp>
+#include <seqan3/io/detail/misc.hpp>
+#include <seqan3/io/exception.hpp>
+#include <seqan3/io/sequence_file/input_options.hpp>
+#include <seqan3/io/sequence_file/output_options.hpp>
+#include <seqan3/range/shortcuts.hpp>
+#include <seqan3/range/view/char_to.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3
+{
+/*!\brief       The SeqAn native binary sequence format.
+ * \implements  SequenceFileFormat
+ * \ingroup     sequence
+ *
+ * \details
+ *
+ * ### Introduction
+ *
+ * This format is an interchange format for pipelines whose stages all use SeqAn: instead of rendering records
+ * to text and re-parsing them at the next stage, the fields are stored with length-prefixed framing and the
+ * sequence letters as their alphabet **ranks**, so reading and writing are plain block transfers without any
+ * scanning, case folding or character conversion. It is not intended for archival or for exchanging data with
+ * other tools — the rank values are only meaningful to a reader that uses a rank-compatible alphabet (i.e. the
+ * same traits the writer used).
+ *
+ * Each record is laid out as three little-endian `uint32_t` lengths followed by the raw field bytes:
+ *
+ * | field       | size           | content                                                 |
+ * |-------------|----------------|---------------------------------------------------------|
+ * | `id_size`   | 4 bytes        | length of the ID in bytes                               |
+ * | `seq_size`  | 4 bytes        | length of the sequence in letters                       |
+ * | `qual_size` | 4 bytes        | length of the qualities, `0` or equal to `seq_size`     |
+ * | ID          | `id_size`      | the ID as plain characters                              |
+ * | sequence    | `seq_size`     | one rank value per letter                               |
+ * | qualities   | `qual_size`    | one rank value per letter                               |
+ *
+ * The fixed-width prefixes make it possible to skip over records without inspecting the payload.
+ *
+ * ### Fields
+ *
+ * The format provides the fields seqan3::field::SEQ, seqan3::field::ID and seqan3::field::QUAL (or
+ * seqan3::field::SEQ_QUAL as a combined field). Only the sequence is required when writing; a missing ID is
+ * stored as empty and missing qualities as `qual_size == 0`.
+ */
+class sequence_file_format_binary
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    sequence_file_format_binary() = default;                                           //!< Defaulted
+    //!\brief Copy construction is explicitly deleted, because you can't have multiple access to the same file.
+    sequence_file_format_binary(sequence_file_format_binary const &) = delete;
+    //!\brief Copy assignment is explicitly deleted, because you can't have multiple access to the same file.
+    sequence_file_format_binary & operator=(sequence_file_format_binary const &) = delete;
+    sequence_file_format_binary(sequence_file_format_binary &&) = default;             //!< Defaulted
+    sequence_file_format_binary & operator=(sequence_file_format_binary &&) = default; //!< Defaulted
+    ~sequence_file_format_binary() = default;                                          //!< Defaulted
+    //!\}
+
+    //!\brief The valid file extensions for this format; note that you can modify this value.
+    static inline std::vector<std::string> file_extensions
+    {
+        { "sqb" }
+    };
+
+    //!\copydoc SequenceFileInputFormat::read
+    template <typename stream_type,     // constraints checked by file
+              typename seq_legal_alph_type, bool seq_qual_combined,
+              typename seq_type,        // other constraints checked inside function
+              typename id_type,
+              typename qual_type>
+    void read(stream_type                                                               & stream,
+              sequence_file_input_options<seq_legal_alph_type, seq_qual_combined> const & SEQAN3_DOXYGEN_ONLY(options),
+              seq_type                                                                  & sequence,
+              id_type                                                                   & id,
+              qual_type                                                                 & qualities)
+    {
+        static_assert(sizeof(typename stream_type::char_type) == 1,
+                      "The binary format requires a byte-sized stream character type.");
+
+        auto * streambuf = stream.rdbuf();
+
+        auto read_exactly = [streambuf] (char * target, size_t const count)
+        {
+            if (static_cast<size_t>(streambuf->sgetn(reinterpret_cast<typename stream_type::char_type *>(target),
+                                                     count)) != count)
+                throw unexpected_end_of_input{"Reached end of input while reading a binary record."};
+        };
+
+        std::array<char, 12> record_header{};
+        read_exactly(record_header.data(), record_header.size());
+
+        uint32_t id_size{}, seq_size{}, qual_size{};
+        std::memcpy(&id_size,   record_header.data(),     4);
+        std::memcpy(&seq_size,  record_header.data() + 4, 4);
+        std::memcpy(&qual_size, record_header.data() + 8, 4);
+
+        if ((qual_size != 0) && (qual_size != seq_size))
+            throw parse_error{"The quality length of a binary record is neither 0 nor the sequence length."};
+
+        // rank values are validated against the target alphabet before assignment
+        auto checked_rank = [] (auto alphabet, char const c)
+        {
+            uint8_t const rank = static_cast<uint8_t>(c);
+            if (rank >= alphabet_size_v<decltype(alphabet)>)
+            {
+                throw parse_error{"Invalid rank value " + std::to_string(rank) +
+                                  " for an alphabet of size " +
+                                  std::to_string(static_cast<size_t>(alphabet_size_v<decltype(alphabet)>)) + "."};
+            }
+            return assign_rank(alphabet, rank);
+        };
+
+        /* ID */
+        read_buffer.resize(id_size);
+        read_exactly(read_buffer.data(), id_size);
+
+        if constexpr (!detail::decays_to_ignore_v<id_type>)
+            std::ranges::copy(read_buffer | view::char_to<value_type_t<id_type>>, std::back_inserter(id));
+
+        // cache the begin position so we write quals to the same position as seq in seq_qual case
+        size_t sequence_size_before = 0;
+        if constexpr (!detail::decays_to_ignore_v<seq_type>)
+            sequence_size_before = size(sequence);
+
+        /* Sequence */
+        read_buffer.resize(seq_size);
+        read_exactly(read_buffer.data(), seq_size);
+
+        if constexpr (!detail::decays_to_ignore_v<seq_type>)
+        {
+            if constexpr (seq_qual_combined)
+            {
+                using seq_alphabet_t = typename value_type_t<seq_type>::sequence_alphabet_type;
+
+                sequence.resize(sequence_size_before + seq_size);
+                auto out_it = begin(sequence) + sequence_size_before;
+                for (char const c : read_buffer)
+                    *out_it++ = checked_rank(seq_alphabet_t{}, c);
+            }
+            else
+            {
+                for (char const c : read_buffer)
+                    sequence.push_back(checked_rank(value_type_t<seq_type>{}, c));
+            }
+        }
+
+        /* Qualities */
+        read_buffer.resize(qual_size);
+        read_exactly(read_buffer.data(), qual_size);
+
+        if constexpr (!detail::decays_to_ignore_v<qual_type>)
+        {
+            if constexpr (seq_qual_combined)
+            {
+                // seq_qual field implies that they are the same variable
+                assert(std::addressof(sequence) == std::addressof(qualities));
+                using quality_alphabet_t = typename value_type_t<qual_type>::quality_alphabet_type;
+
+                auto out_it = begin(qualities) + sequence_size_before;
+                for (char const c : read_buffer)
+                    *out_it++ = checked_rank(quality_alphabet_t{}, c);
+            }
+            else
+            {
+                for (char const c : read_buffer)
+                    qualities.push_back(checked_rank(value_type_t<qual_type>{}, c));
+            }
+        }
+    }
+
+    //!\copydoc SequenceFileOutputFormat::write
+    template <typename stream_type,     // constraints checked by file
+              typename seq_type,        // other constraints checked inside function
+              typename id_type,
+              typename qual_type>
+    void write(stream_type                        & stream,
+               sequence_file_output_options const & SEQAN3_DOXYGEN_ONLY(options),
+               seq_type                          && sequence,
+               id_type                           && id,
+               qual_type                         && qualities)
+    {
+        static_assert(sizeof(typename stream_type::char_type) == 1,
+                      "The binary format requires a byte-sized stream character type.");
+
+        // the fields are buffered first, because the lengths must be known before the payload is written
+        std::string id_buffer{};
+        std::string seq_buffer{};
+        std::string qual_buffer{};
+
+        if constexpr (!detail::decays_to_ignore_v<id_type>)
+        {
+            for (auto && c : id)
+                id_buffer += c;
+        }
+
+        if constexpr (detail::decays_to_ignore_v<seq_type>)
+        {
+            throw std::logic_error{"The SEQ field may not be set to ignore when writing binary sequence files."};
+        }
+        else
+        {
+            if (empty(sequence)) //[[unlikely]]
+                throw std::runtime_error{"The SEQ field may not be empty when writing binary sequence files."};
+
+            for (auto && s : sequence)
+                seq_buffer += static_cast<char>(to_rank(s));
+        }
+
+        if constexpr (!detail::decays_to_ignore_v<qual_type>)
+        {
+            for (auto && q : qualities)
+                qual_buffer += static_cast<char>(to_rank(q));
+
+            if (!qual_buffer.empty() && (qual_buffer.size() != seq_buffer.size()))
+                throw std::runtime_error{"The SEQ and QUAL fields must have the same length."};
+        }
+
+        auto * streambuf = stream.rdbuf();
+
+        auto write_length = [streambuf] (size_t const length)
+        {
+            if (length > std::numeric_limits<uint32_t>::max())
+                throw std::runtime_error{"A field is too long for the binary format's 32 bit length prefix."};
+
+            uint32_t const value = static_cast<uint32_t>(length);
+            std::array<char, 4> bytes{};
+            std::memcpy(bytes.data(), &value, 4);
+            streambuf->sputn(reinterpret_cast<typename stream_type::char_type const *>(bytes.data()), 4);
+        };
+
+        auto write_bytes = [streambuf] (std::string const & buffer)
+        {
+            streambuf->sputn(reinterpret_cast<typename stream_type::char_type const *>(buffer.data()),
+                             buffer.size());
+        };
+
+        write_length(id_buffer.size());
+        write_length(seq_buffer.size());
+        write_length(qual_buffer.size());
+        write_bytes(id_buffer);
+        write_bytes(seq_buffer);
+        write_bytes(qual_buffer);
+    }
+
+private:
+    //!\brief A reused buffer that field bytes are block-read into.
+    std::string read_buffer{};
+};
+
+} // namespace seqan3
@@ -12,7 +12,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <iterator>
+#include <limits>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -27,20 +29,24 @@
 #include <seqan3/alphabet/nucleotide/dna5.hpp>
 #include <seqan3/alphabet/quality/aliases.hpp>
 #include <seqan3/core/metafunction/range.hpp>
+#include <seqan3/io/detail/fast_istreambuf_iterator.hpp>
 #include <seqan3/io/detail/ignore_output_iterator.hpp>
 #include <seqan3/io/detail/misc.hpp>
 #include <seqan3/io/sequence_file/input_options.hpp>
 #include <seqan3/io/sequence_file/output_options.hpp>
 #include <seqan3/io/stream/parse_condition.hpp>
 #include <seqan3/range/shortcuts.hpp>
+#include <seqan3/range/container/concept.hpp>
 #include <seqan3/range/detail/misc.hpp>
 #include <seqan3/range/view/char_to.hpp>
+#include <seqan3/range/view/convert_copy.hpp>
 #include <seqan3/range/view/to_char.hpp>
 #include <seqan3/range/view/take.hpp>
 #include <seqan3/range/view/take_exactly.hpp>
 #include <seqan3/range/view/take_line.hpp>
 #include <seqan3/range/view/take_until.hpp>
 #include <seqan3/std/ranges>
+#include <seqan3/std/span>
 
 namespace seqan3
 {
@@ -116,10 +122,10 @@ public:
               qual_type                                                              & SEQAN3_DOXYGEN_ONLY(qualities))
     {
         using stream_char_t = typename stream_type::char_type;
-        auto stream_view = std::ranges::subrange<decltype(std::istreambuf_iterator<stream_char_t>{stream}),
-                                          decltype(std::istreambuf_iterator<stream_char_t>{})>
-                            {std::istreambuf_iterator<stream_char_t>{stream},
-                             std::istreambuf_iterator<stream_char_t>{}};
+        auto stream_view = std::ranges::subrange<detail::fast_istreambuf_iterator<stream_char_t>,
+                                                 std::ranges::default_sentinel_t>
+                            {detail::fast_istreambuf_iterator<stream_char_t>{*stream.rdbuf()},
+                             std::ranges::default_sentinel};
         // ID
         read_id(stream_view, options, id);
 
@@ -164,7 +170,7 @@ public:
             if (empty(sequence)) //[[unlikely]]
                 throw std::runtime_error{"The SEQ field may not be empty when writing FASTA files."};
 
-            write_seq(stream_it, options, sequence);
+            write_seq(stream, stream_it, options, sequence);
         }
     }
 
@@ -224,9 +230,38 @@ protected:
         if constexpr (!detail::decays_to_ignore_v<seq_type>)
         {
             auto constexpr is_legal_alph = is_in_alphabet<seq_legal_alph_type>;
-            std::ranges::copy(stream_view | view::take_until(is_id)                      // until next header (or end)
-                                          | std::view::filter(!(is_space || is_digit))// ignore whitespace and numbers
-                                          | std::view::transform([is_legal_alph] (char const c)
+            using seq_alph_t = value_type_t<seq_type>;
+
+            auto seq_view = stream_view | view::take_until(is_id)                        // until next header (or end)
+                                        | std::view::filter(!(is_space || is_digit)); // ignore whitespace and numbers
+
+            // bulk fast path: buffer the sequence characters contiguously, validate the whole buffer via
+            // the chunked classification of the parse condition and convert it via the chunked kernel of
+            // seqan3::convert_copy — instead of a validation branch and a conversion per character
+            if constexpr (random_access_container_concept<seq_type> &&
+                          std::ranges::ContiguousRange<seq_type> &&
+                          Alphabet<seq_alph_t> && sizeof(seq_alph_t) == 1 &&
+                          std::is_same_v<underlying_char_t<seq_alph_t>, char>)
+            {
+                read_buffer.clear();
+                std::ranges::copy(seq_view, std::back_inserter(read_buffer));
+
+                if (size_t const bad = is_legal_alph.validate(std::span<char const>{read_buffer});
+                    bad != read_buffer.size())
+                {
+                    throw parse_error{std::string{"Encountered an unexpected letter: "} +
+                                      is_legal_alph.msg.string() +
+                                      " evaluated to false on " +
+                                      detail::make_printable(read_buffer[bad])};
+                }
+
+                size_t const size_before = size(seq);
+                seq.resize(size_before + read_buffer.size());
+                convert_copy(read_buffer, std::ranges::subrange{begin(seq) + size_before, end(seq)});
+            }
+            else
+            {
+                std::ranges::copy(seq_view | std::view::transform([is_legal_alph] (char const c)
                                             {
                                                 if (!is_legal_alph(c))
                                                 {
@@ -237,8 +272,9 @@ protected:
                                                 }
                                                 return c;
                                             })                                           // enforce legal alphabet
-                                          | view::char_to<value_type_t<seq_type>>,       // convert to actual target alphabet
-                              std::back_inserter(seq));
+                                            | view::char_to<seq_alph_t>,                 // convert to actual target alphabet
+                                  std::back_inserter(seq));
+            }
         }
         else
         {
@@ -267,39 +303,105 @@ protected:
     }
 
     //!\brief Implementation of writing the sequence.
-    template <typename stream_it_t,
+    template <typename stream_type,
+              typename stream_it_t,
               typename seq_type>
-    void write_seq(stream_it_t                    & stream_it,
+    void write_seq(stream_type                    & stream,
+                  stream_it_t                     & stream_it,
                   sequence_file_output_options const & options,
                   seq_type                       && seq)
     {
-        if (options.fasta_letters_per_line > 0)
+        if constexpr (sizeof(typename stream_type::char_type) == 1 && detail::BulkToCharConvertible<seq_type>)
         {
-            std::ranges::copy(seq | view::to_char
-                             | ranges::view::chunk(options.fasta_letters_per_line)
-                             | std::view::join(options.add_carriage_return
-                                                    ? std::string_view{"\r\n"}
-                                                    : std::string_view{"\n"}),
-                         stream_it);
-            // TODO(h-2): benchmark the above vs:
-//             size_t count = 0;
-//             for (auto seq_it = begin(seq); seq_it != end(seq_it); ++seq_it)
-//             {
-//                 stream_it = to_char(*seq_it);
-//                 ++count;
-//                 if (count % fasta_letters_per_line == 0)
-//                 {
-//                     detail::write_eol(stream_it, options.add_carriage_return);
-//                 }
-//             }
+            // The sequence sits in contiguous memory, so its characters can be decoded chunk-wise via
+            // seqan3::convert_copy and the lines emitted with bulk sputn instead of one letter at a time.
+            std::string_view const eol = options.add_carriage_return ? std::string_view{"\r\n"}
+                                                                     : std::string_view{"\n"};
+            size_t const seq_size = size(seq);
+
+            write_buffer.resize(seq_size);
+            convert_copy(seq, write_buffer);
+
+            if (options.fasta_letters_per_line > 0)
+            {
+                size_t pos = 0;
+                do // also writes the terminal line break (and sole line break of an empty sequence)
+                {
+                    size_t const line_length = std::min<size_t>(options.fasta_letters_per_line, seq_size - pos);
+                    stream.rdbuf()->sputn(write_buffer.data() + pos, line_length);
+                    stream.rdbuf()->sputn(eol.data(), eol.size());
+                    pos += line_length;
+                }
+                while (pos < seq_size);
+            }
+            else
+            {
+                stream.rdbuf()->sputn(write_buffer.data(), seq_size);
+                stream.rdbuf()->sputn(eol.data(), eol.size());
+            }
         }
-        else
+        else if constexpr (sizeof(typename stream_type::char_type) == 1)
         {
-            std::ranges::copy(seq | view::to_char, stream_it);
+            // Convert into a scratch buffer (line breaks included) and flush it to the stream buffer in
+            // large blocks; this is notably faster than pushing single characters through the iterator.
+            std::string_view const eol = options.add_carriage_return ? std::string_view{"\r\n"}
+                                                                     : std::string_view{"\n"};
+            size_t const letters_per_line = options.fasta_letters_per_line > 0 ? options.fasta_letters_per_line
+                                                                               : std::numeric_limits<size_t>::max();
+            size_t letters_in_line = 0;
+
+            write_buffer.clear();
+
+            for (auto it = begin(seq); it != end(seq); ++it)
+            {
+                if (letters_in_line == letters_per_line)
+                {
+                    write_buffer.append(eol);
+                    letters_in_line = 0;
+                }
+
+                write_buffer.push_back(to_char(*it));
+                ++letters_in_line;
+
+                if (write_buffer.size() >= write_block_size) // [[unlikely]]
+                {
+                    stream.rdbuf()->sputn(write_buffer.data(), write_buffer.size());
+                    write_buffer.clear();
+                }
+            }
+
+            write_buffer.append(eol); // the terminal line break is always written
+
+            stream.rdbuf()->sputn(write_buffer.data(), write_buffer.size());
         }
+        else // wide streams perform the character conversion inside the iterator
+        {
+            if (options.fasta_letters_per_line > 0)
+            {
+                std::ranges::copy(seq | view::to_char
+                                 | ranges::view::chunk(options.fasta_letters_per_line)
+                                 | std::view::join(options.add_carriage_return
+                                                        ? std::string_view{"\r\n"}
+                                                        : std::string_view{"\n"}),
+                             stream_it);
+            }
+            else
+            {
+                std::ranges::copy(seq | view::to_char, stream_it);
+            }
 
-        detail::write_eol(stream_it, options.add_carriage_return);
+            detail::write_eol(stream_it, options.add_carriage_return);
+        }
     }
+
+    //!\brief The number of buffered characters above which write_seq() flushes to the stream.
+    static constexpr size_t write_block_size = 1u << 16;
+
+    //!\brief Scratch buffer that write_seq() assembles output lines in (kept to reuse the allocation).
+    std::string write_buffer{};
+
+    //!\brief Scratch buffer that read_seq() collects the sequence characters of one record in (see read_seq()).
+    std::string read_buffer{};
 };
 
 } // namespace seqan3
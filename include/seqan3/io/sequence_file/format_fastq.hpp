@@ -25,20 +25,24 @@
 #include <seqan3/alphabet/nucleotide/dna5.hpp>
 #include <seqan3/alphabet/quality/aliases.hpp>
 #include <seqan3/core/metafunction/range.hpp>
+#include <seqan3/io/detail/fast_istreambuf_iterator.hpp>
 #include <seqan3/io/detail/ignore_output_iterator.hpp>
 #include <seqan3/io/detail/misc.hpp>
 #include <seqan3/io/sequence_file/input_options.hpp>
 #include <seqan3/io/sequence_file/output_options.hpp>
 #include <seqan3/io/stream/parse_condition.hpp>
 #include <seqan3/range/shortcuts.hpp>
+#include <seqan3/range/container/concept.hpp>
 #include <seqan3/range/detail/misc.hpp>
 #include <seqan3/range/view/char_to.hpp>
+#include <seqan3/range/view/convert_copy.hpp>
 #include <seqan3/range/view/to_char.hpp>
 #include <seqan3/range/view/take.hpp>
 #include <seqan3/range/view/take_exactly.hpp>
 #include <seqan3/range/view/take_line.hpp>
 #include <seqan3/range/view/take_until.hpp>
 #include <seqan3/std/ranges>
+#include <seqan3/std/span>
 
 namespace seqan3
 {
@@ -109,10 +113,10 @@ public:
               qual_type                                                              & qualities)
     {
         using stream_char_t = typename stream_type::char_type;
-        auto stream_view = std::ranges::subrange<decltype(std::istreambuf_iterator<stream_char_t>{stream}),
-                                                 decltype(std::istreambuf_iterator<stream_char_t>{})>
-                            {std::istreambuf_iterator<stream_char_t>{stream},
-                             std::istreambuf_iterator<stream_char_t>{}};
+        auto stream_view = std::ranges::subrange<detail::fast_istreambuf_iterator<stream_char_t>,
+                                                 std::ranges::default_sentinel_t>
+                            {detail::fast_istreambuf_iterator<stream_char_t>{*stream.rdbuf()},
+                             std::ranges::default_sentinel};
 
         auto stream_it = begin(stream_view);
 
@@ -157,19 +161,48 @@ public:
         if constexpr (!detail::decays_to_ignore_v<seq_type>)
         {
             auto constexpr is_legal_alph = is_in_alphabet<seq_legal_alph_type>;
-            std::ranges::copy(seq_view | std::view::transform([is_legal_alph] (char const c) // enforce legal alphabet
-                                    {
-                                        if (!is_legal_alph(c))
+            using seq_alph_t = value_type_t<seq_type>;
+
+            // bulk fast path: buffer the sequence characters contiguously, validate the whole buffer via
+            // the chunked classification of the parse condition and convert it via the chunked kernel of
+            // seqan3::convert_copy — instead of a validation branch and a conversion per character
+            if constexpr (random_access_container_concept<seq_type> &&
+                          std::ranges::ContiguousRange<seq_type> &&
+                          Alphabet<seq_alph_t> && sizeof(seq_alph_t) == 1 &&
+                          std::is_same_v<underlying_char_t<seq_alph_t>, char>)
+            {
+                scratch_buffer.clear();
+                std::ranges::copy(seq_view, std::back_inserter(scratch_buffer));
+
+                if (size_t const bad = is_legal_alph.validate(std::span<char const>{scratch_buffer});
+                    bad != scratch_buffer.size())
+                {
+                    throw parse_error{std::string{"Encountered an unexpected letter: "} +
+                                      is_legal_alph.msg.string() +
+                                      " evaluated to false on " +
+                                      detail::make_printable(scratch_buffer[bad])};
+                }
+
+                sequence.resize(sequence_size_before + scratch_buffer.size());
+                convert_copy(scratch_buffer,
+                             std::ranges::subrange{begin(sequence) + sequence_size_before, end(sequence)});
+            }
+            else
+            {
+                std::ranges::copy(seq_view | std::view::transform([is_legal_alph] (char const c) // enforce legal alphabet
                                         {
-                                            throw parse_error{std::string{"Encountered an unexpected letter: "} +
-                                                                is_legal_alph.msg.string() +
-                                                                " evaluated to false on " +
-                                                                detail::make_printable(c)};
-                                        }
-                                        return c;
-                                    })
-                                        | view::char_to<value_type_t<seq_type>>,         // convert to actual target alphabet
-                              std::back_inserter(sequence));
+                                            if (!is_legal_alph(c))
+                                            {
+                                                throw parse_error{std::string{"Encountered an unexpected letter: "} +
+                                                                    is_legal_alph.msg.string() +
+                                                                    " evaluated to false on " +
+                                                                    detail::make_printable(c)};
+                                            }
+                                            return c;
+                                        })
+                                            | view::char_to<seq_alph_t>,         // convert to actual target alphabet
+                                  std::back_inserter(sequence));
+            }
             sequence_size_after = size(sequence);
         }
         else // consume, but count
@@ -192,19 +225,69 @@ public:
         detail::consume(stream_view | view::take_line_or_throw);
 
         /* Qualities */
-        auto qview = stream_view | std::view::filter(!is_space)                  // this consumes trailing newline
-                                 | view::take_exactly_or_throw(sequence_size_after - sequence_size_before);
         if constexpr (seq_qual_combined)
         {
             // seq_qual field implies that they are the same variable
             assert(std::addressof(sequence) == std::addressof(qualities));
-            std::ranges::copy(qview | view::char_to<typename value_type_t<qual_type>::quality_alphabet_type>,
-                              begin(qualities) + sequence_size_before);
+
+            // fused fast path: the combined container was already sized by the sequence pass, so the
+            // quality values are streamed directly into it without a second view stack
+            using quality_alphabet_t = typename value_type_t<qual_type>::quality_alphabet_type;
+
+            auto it_end = end(stream_view);
+            auto out_it = begin(qualities) + sequence_size_before;
+
+            for (size_t i = sequence_size_before; i < sequence_size_after; )
+            {
+                if (stream_it == it_end) // [[unlikely]]
+                    throw unexpected_end_of_input{"Reached end of input before the expected number of qualities."};
+
+                char const c = *stream_it;
+                ++stream_it;
+
+                if (!is_space(c))
+                {
+                    *out_it = assign_char(quality_alphabet_t{}, c);
+                    ++out_it;
+                    ++i;
+                }
+            }
+
+            // consume trailing whitespace like the filter view of the uncombined path does
+            while ((stream_it != it_end) && is_space(*stream_it))
+                ++stream_it;
+
+            return;
         }
-        else if constexpr (!detail::decays_to_ignore_v<qual_type>)
+
+        auto qview = stream_view | std::view::filter(!is_space)                  // this consumes trailing newline
+                                 | view::take_exactly_or_throw(sequence_size_after - sequence_size_before);
+        if constexpr (!detail::decays_to_ignore_v<qual_type>)
         {
-            std::ranges::copy(qview | view::char_to<value_type_t<qual_type>>,
-                              std::back_inserter(qualities));
+            using qual_alph_t = value_type_t<qual_type>;
+
+            // bulk fast path: buffer the quality characters contiguously and decode the whole line via the
+            // chunked kernel of seqan3::convert_copy — for the quality alphabets this is a saturating
+            // subtract of the phred offset plus clamping per vector of characters instead of a table
+            // lookup per character
+            if constexpr (random_access_container_concept<qual_type> &&
+                          std::ranges::ContiguousRange<qual_type> &&
+                          Alphabet<qual_alph_t> && sizeof(qual_alph_t) == 1 &&
+                          std::is_same_v<underlying_char_t<qual_alph_t>, char>)
+            {
+                scratch_buffer.clear();
+                std::ranges::copy(qview, std::back_inserter(scratch_buffer));
+
+                size_t const size_before = size(qualities);
+                qualities.resize(size_before + scratch_buffer.size());
+                convert_copy(scratch_buffer,
+                             std::ranges::subrange{begin(qualities) + size_before, end(qualities)});
+            }
+            else
+            {
+                std::ranges::copy(qview | view::char_to<qual_alph_t>,
+                                  std::back_inserter(qualities));
+            }
         }
         else
         {
@@ -251,7 +334,18 @@ public:
             if (empty(sequence)) //[[unlikely]]
                 throw std::runtime_error{"The SEQ field may not be empty when writing FASTQ files."};
 
-            std::ranges::copy(sequence | view::to_char, stream_it);
+            if constexpr (sizeof(typename stream_type::char_type) == 1 &&
+                          detail::BulkToCharConvertible<seq_type>)
+            {
+                // decode the whole line chunk-wise into the scratch buffer and emit it with a single sputn
+                scratch_buffer.resize(size(sequence));
+                convert_copy(sequence, scratch_buffer);
+                stream.rdbuf()->sputn(scratch_buffer.data(), scratch_buffer.size());
+            }
+            else
+            {
+                std::ranges::copy(sequence | view::to_char, stream_it);
+            }
 
             detail::write_eol(stream_it, options.add_carriage_return);
         }
@@ -282,11 +376,25 @@ public:
                 assert(size(sequence) == size(qualities));
             }
 
-            std::ranges::copy(qualities | view::to_char, stream_it);
+            if constexpr (sizeof(typename stream_type::char_type) == 1 &&
+                          detail::BulkToCharConvertible<qual_type>)
+            {
+                scratch_buffer.resize(size(qualities));
+                convert_copy(qualities, scratch_buffer);
+                stream.rdbuf()->sputn(scratch_buffer.data(), scratch_buffer.size());
+            }
+            else
+            {
+                std::ranges::copy(qualities | view::to_char, stream_it);
+            }
 
             detail::write_eol(stream_it, options.add_carriage_return);
         }
     }
+
+private:
+    //!\brief Reused buffer for the sequence respectively quality characters of one record (see read() and write()).
+    std::string scratch_buffer;
 };
 
 } // namespace seqan3
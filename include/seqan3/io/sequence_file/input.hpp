@@ -12,9 +12,16 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
+#include <deque>
 #include <fstream>
+#include <future>
+#include <memory>
+#include <sstream>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <variant>
 #include <vector>
 
@@ -25,20 +32,29 @@
 #include <seqan3/alphabet/nucleotide/all.hpp>
 #include <seqan3/alphabet/quality/phred42.hpp>
 #include <seqan3/alphabet/quality/qualified.hpp>
+#include <seqan3/core/memory_stats.hpp>
 #include <seqan3/core/metafunction/basic.hpp>
+#include <seqan3/core/metafunction/range.hpp>
+#include <seqan3/io/stream/buffer.hpp>
 #include <seqan3/io/stream/concept.hpp>
+#include <seqan3/io/stream/parse_condition.hpp>
 #include <seqan3/io/exception.hpp>
 #include <seqan3/std/filesystem>
 #include <seqan3/io/record.hpp>
 #include <seqan3/io/detail/in_file_iterator.hpp>
 #include <seqan3/io/detail/misc_input.hpp>
+#include <seqan3/io/detail/mmap_istream.hpp>
 #include <seqan3/io/detail/record.hpp>
+#include <seqan3/io/detail/record_prefetcher.hpp>
+#include <seqan3/io/sequence_file/fai_index.hpp>
 #include <seqan3/io/sequence_file/input_format_concept.hpp>
+#include <seqan3/io/sequence_file/format_binary.hpp>
 #include <seqan3/io/sequence_file/format_embl.hpp>
 #include <seqan3/io/sequence_file/format_fasta.hpp>
 #include <seqan3/io/sequence_file/format_fastq.hpp>
 #include <seqan3/io/sequence_file/format_sam.hpp>
 #include <seqan3/range/container/concatenated_sequences.hpp>
+#include <seqan3/range/container/concept.hpp>
 
 namespace seqan3
 {
@@ -198,6 +214,35 @@ struct sequence_file_input_default_traits_aa : sequence_file_input_default_trait
     //!\}
 };
 
+/*!\brief A traits type for "borrowed" records: sequences are stored as plain characters without conversion.
+ * \implements SequenceFileInputTraits
+ * \ingroup sequence
+ *
+ * \details
+ *
+ * With these traits the seqan3::field::SEQ buffer is a std::string that is filled without alphabet
+ * conversion or legality checking. Since the record buffer is reused between increments, iterating a
+ * file in this mode performs no per-record allocations in the steady state — the fields yielded by
+ * the iterator and by front() merely borrow the file's internal buffer and are valid until the next
+ * increment.
+ *
+ * Apply seqan3::view::char_to on a field to get lazy, on-demand conversion to an actual alphabet,
+ * e.g. `get<field::SEQ>(rec) | view::char_to<dna5>`. This is ideal for counting and filtering passes
+ * that never need ownership of the data.
+ */
+struct sequence_file_input_raw_traits : sequence_file_input_default_traits_dna
+{
+    /*!\name Member types
+     * \brief Definitions to satisfy seqan3::SequenceFileInputTraits.
+     * \{
+     */
+    using sequence_alphabet       = char;
+    using sequence_legal_alphabet = char;
+    template <typename _sequence_alphabet>
+    using sequence_container      = std::basic_string<_sequence_alphabet>;
+    //!\}
+};
+
 // ----------------------------------------------------------------------------
 // sequence_file_input
 // ----------------------------------------------------------------------------
@@ -337,7 +382,8 @@ template <
     detail::fields_concept                     selected_field_ids_ = fields<field::SEQ,
                                                                             field::ID,
                                                                             field::QUAL>,
-    detail::TypeListOfSequenceFileInputFormats valid_formats_      = type_list<sequence_file_format_embl,
+    detail::TypeListOfSequenceFileInputFormats valid_formats_      = type_list<sequence_file_format_binary,
+                                                                               sequence_file_format_embl,
                                                                                sequence_file_format_fasta,
                                                                                sequence_file_format_fastq,
                                                                                sequence_file_format_sam
@@ -488,14 +534,42 @@ public:
      * This constructor transparently applies a decompression stream on top of the file stream in case
      * the file is detected as being compressed.
      * See the section on \link io_compression compression and decompression \endlink for more information.
+     *
+     * ### Memory mapping
+     *
+     * Regular files are memory-mapped instead of being read through a std::ifstream where the platform
+     * supports it, which avoids per-character stream overhead during parsing. Files that cannot be
+     * mapped (e.g. process substitutions) automatically fall back to a regular stream.
+     * The fallback stream receives an enlarged I/O buffer whose size is controlled by
+     * seqan3::stream_buffer_size. For files that are read exactly once, seqan3::stream_single_pass
+     * additionally advises the OS to stream the data without polluting the page cache.
      */
     sequence_file_input(std::filesystem::path filename,
                         selected_field_ids const & SEQAN3_DOXYGEN_ONLY(fields_tag) = selected_field_ids{}) :
-        primary_stream{new std::ifstream{filename, std::ios_base::in | std::ios::binary}, stream_deleter_default}
+        primary_stream{new detail::mmap_istream<stream_char_type>{filename, stream_single_pass},
+                       stream_deleter_default}
     {
+        // mapping can fail for special files (e.g. process substitution) -> fall back to a regular stream
+        if (!primary_stream->good())
+        {
+            std::ifstream * fstream = new std::ifstream{};
+            primary_stream = stream_ptr_t{fstream, stream_deleter_default};
+
+            // the buffer must be installed before the first read, i.e. before the file is opened
+            if (stream_buffer_size > 0)
+            {
+                stream_buffer.resize(stream_buffer_size);
+                fstream->rdbuf()->pubsetbuf(stream_buffer.data(), stream_buffer.size());
+            }
+
+            fstream->open(filename, std::ios_base::in | std::ios::binary);
+        }
+
         if (!primary_stream->good())
             throw file_open_error{"Could not open file " + filename.string() + " for reading."};
 
+        file_path = filename; // remember the path for lazy index loading in seek_to()
+
         // possibly add intermediate compression stream
         secondary_stream = detail::make_secondary_istream(*primary_stream, filename);
 
@@ -619,6 +693,10 @@ public:
      *
      * \snippet test/snippet/io/sequence_file/sequence_file_input.cpp record_move
      *
+     * You can also steal individual fields instead of the whole record, e.g.
+     * `auto seq = std::move(get<field::SEQ>(fin.front()));` — the file's buffer is then simply replaced by a
+     * fresh allocation when the next record is parsed, so the handover is copy-free.
+     *
      * ### Complexity
      *
      * Constant.
@@ -631,6 +709,54 @@ public:
     {
         return record_buffer;
     }
+
+    /*!\brief Returns the exact bytes of the currently buffered record.
+     * \returns A view of the record's bytes, or an empty view if they cannot be recovered.
+     *
+     * \details
+     *
+     * The bytes can be handed to seqan3::sequence_file_output::push_back_raw() to copy records between
+     * files of the same format without parsing and re-formatting them ("passthrough").
+     *
+     * The raw bytes are only recoverable if the (possibly decompressed) stream is seekable and parallel
+     * parsing is not active; otherwise an empty view is returned and callers must fall back to regular
+     * record-based writing. The view is invalidated by advancing the file's iterator.
+     *
+     * ### Exceptions
+     *
+     * Basic exception safety.
+     */
+    std::basic_string_view<stream_char_type> raw_record()
+    {
+        if ((raw_record_begin < 0) || (raw_record_end <= raw_record_begin))
+            return {};
+
+        raw_record_buffer.resize(static_cast<size_t>(raw_record_end - raw_record_begin));
+
+        secondary_stream->clear();
+        secondary_stream->seekg(raw_record_begin);
+        if (!secondary_stream->good())
+        {
+            secondary_stream->clear();
+            return {};
+        }
+
+        // reading the span puts the stream back to where it was (directly behind the record)
+        secondary_stream->read(raw_record_buffer.data(), raw_record_buffer.size());
+        return {raw_record_buffer.data(), raw_record_buffer.size()};
+    }
+
+    /*!\brief Whether the format detected (or selected) for this file is the given one.
+     * \tparam format_t The format type to check for, e.g. seqan3::sequence_file_format_fasta.
+     */
+    template <typename format_t>
+    bool current_format_is() const noexcept
+    {
+        return std::visit([] (auto const & f)
+        {
+            return std::is_same_v<remove_cvref_t<decltype(f)>, format_t>;
+        }, format);
+    }
     //!\}
 
     /*!\name Tuple interface
@@ -691,6 +817,311 @@ public:
     }
     //!\}
 
+    /*!\name Batch interface
+     * \brief Provides functions for reading many records in one call.
+     * \{
+     */
+    /*!\brief Read up to `max_records` records into the given column buffers.
+     * \tparam id_buffer_t  Type of the ID buffer; must support `push_back()` of \ref id_type.
+     * \tparam seq_buffer_t Type of the sequence buffer; must support `push_back()` of \ref sequence_type.
+     * \param[in,out] id_buffer   Buffer that the IDs are appended to (e.g. \ref id_column_type).
+     * \param[in,out] seq_buffer  Buffer that the sequences are appended to (e.g. \ref sequence_column_type).
+     * \param[in]     max_records The maximum number of records to read.
+     * \returns The number of records actually read; smaller than `max_records` only at end of the file.
+     *
+     * \details
+     *
+     * In contrast to reading record-by-record via the iterator interface, the format is dispatched only
+     * once per batch and the fields are appended directly to the given buffers, e.g. appending to the
+     * concatenation of a seqan3::concatenated_sequences. This amortises the per-record overhead and
+     * yields the struct-of-arrays layout directly.
+     *
+     * The batch starts at the current record, i.e. it interoperates with the iterator interface; after
+     * the call front() refers to the first record not part of the batch.
+     *
+     * ### Complexity
+     *
+     * Linear in the number of records read.
+     *
+     * ### Exceptions
+     *
+     * Basic exception safety. Throws seqan3::format_error on malformed records, just like the iterator
+     * interface.
+     */
+    template <typename id_buffer_t, typename seq_buffer_t>
+    size_t read_batch(id_buffer_t & id_buffer, seq_buffer_t & seq_buffer, size_t const max_records)
+    {
+        static_assert(selected_field_ids::contains(field::ID) && selected_field_ids::contains(field::SEQ),
+                      "You may only call read_batch if field::ID and field::SEQ are selected for the file.");
+
+        if (at_end || (max_records == 0))
+            return 0;
+
+        size_t count = 0;
+
+        // the record buffered on construction resp. by the iterator is the first record of the batch
+        id_buffer.push_back(std::move(seqan3::get<field::ID>(record_buffer)));
+        seq_buffer.push_back(std::move(seqan3::get<field::SEQ>(record_buffer)));
+        ++count;
+
+        assert(!format.valueless_by_exception());
+        std::visit([&] (SequenceFileInputFormat & f) // one format dispatch for the entire batch
+        {
+            id_type       id;
+            sequence_type seq;
+
+            while (count < max_records)
+            {
+                if ((std::istreambuf_iterator<stream_char_type>{*secondary_stream} ==
+                     std::istreambuf_iterator<stream_char_type>{}))
+                {
+                    at_end = true;
+                    break;
+                }
+
+                id.clear();
+                seq.clear();
+                f.read(*secondary_stream, options, seq, id, std::ignore);
+
+                id_buffer.push_back(id);
+                seq_buffer.push_back(seq);
+                ++count;
+            }
+        }, format);
+
+        if (at_end)                 // batch ended on end-of-file
+            record_buffer.clear();
+        else
+            read_next_record();     // rebuffer so that begin()/front() yield the first record after the batch
+
+        return count;
+    }
+    //!\}
+
+    /*!\name Random access interface
+     * \brief Provides index-based random access to records (FASTA only).
+     * \{
+     */
+    /*!\brief Use the given index for subsequent calls to seek_to().
+     * \param[in] idx The index to use.
+     */
+    void load_index(fai_index idx)
+    {
+        index = std::move(idx);
+    }
+
+    /*!\brief Position the file at the record with the given ID.
+     * \param[in] id The ID of the record to jump to.
+     * \throws seqan3::file_open_error If the input is compressed, not seekable or was not constructed from
+     *                                 a filename while no index was loaded.
+     * \throws std::out_of_range If the index holds no entry for the ID.
+     * \throws seqan3::unexpected_end_of_input If the file ends before the indexed sequence length is reached.
+     * \throws seqan3::parse_error If an illegal sequence character is encountered.
+     *
+     * \details
+     *
+     * Requires a faidx-style index (see seqan3::fai_index): if none was supplied via load_index(), a
+     * `.fai` file next to the input file is loaded, or — if that does not exist — the index is built
+     * by scanning the file once.
+     *
+     * After the call front() yields the requested record and iteration continues with the records
+     * following it, i.e. looking up one contig costs one seek instead of parsing everything before it.
+     *
+     * Only uncompressed, seekable input (i.e. files constructed from a filename) is supported, because
+     * the byte offsets of the index refer to the uncompressed stream.
+     */
+    void seek_to(std::string const & id)
+    {
+        static_assert(selected_field_ids::contains(field::ID) && selected_field_ids::contains(field::SEQ),
+                      "You may only call seek_to if field::ID and field::SEQ are selected for the file.");
+
+        if (secondary_stream.get() != primary_stream.get()) // a decompression layer is in between
+            throw file_open_error{"seek_to() requires uncompressed input, because the index stores "
+                                  "offsets into the uncompressed file."};
+
+        if (index.empty())
+        {
+            if (file_path.empty())
+                throw file_open_error{"seek_to() requires an index; provide one via load_index() when the "
+                                      "file was not constructed from a filename."};
+
+            std::filesystem::path fai_path{file_path};
+            fai_path += ".fai";
+
+            if (std::filesystem::exists(fai_path))
+                index.load(fai_path);
+            else
+                index = fai_index::build(file_path);
+        }
+
+        fai_index::entry const & entry = index.at(id); // throws std::out_of_range for unknown IDs
+
+        secondary_stream->clear();
+        secondary_stream->seekg(entry.offset);
+        if (!secondary_stream->good())
+            throw file_open_error{"Could not seek to record \"" + id + "\"."};
+
+        at_end = false;
+        record_buffer.clear();
+        raw_record_begin = raw_record_end = -1; // the record is assembled from the index, not parsed from a span
+
+        // the ID is known from the index, the header line is not reparsed
+        auto & id_buffer = detail::get_or_ignore<field::ID>(record_buffer);
+        for (char const c : id)
+            id_buffer.push_back(assign_char(value_type_t<id_type>{}, c));
+
+        // read the sequence line-wise, validating each line in bulk via the indexed line geometry
+        auto & seq_buffer = detail::get_or_ignore<field::SEQ>(record_buffer);
+        auto constexpr is_legal_alph = is_in_alphabet<typename traits_type::sequence_legal_alphabet>;
+
+        std::string line_buffer;
+        line_buffer.resize(entry.linebases);
+
+        for (uint64_t remaining = entry.length; remaining > 0; )
+        {
+            size_t const to_read = std::min<uint64_t>(remaining, entry.linebases);
+
+            secondary_stream->read(line_buffer.data(), to_read);
+            if (static_cast<size_t>(secondary_stream->gcount()) != to_read)
+                throw unexpected_end_of_input{"Record \"" + id + "\" ends before the length stored in the index."};
+
+            char const * const line_end = line_buffer.data() + to_read;
+            if (char const * bad = is_legal_alph.find_first_not_of(line_buffer.data(), line_end); bad != line_end)
+            {
+                throw parse_error{std::string{"Encountered an unexpected letter: "} + is_legal_alph.msg.string() +
+                                  " evaluated to false on " + detail::make_printable(*bad)};
+            }
+
+            for (char const * it = line_buffer.data(); it != line_end; ++it)
+                seq_buffer.push_back(assign_char(typename traits_type::sequence_alphabet{}, *it));
+
+            remaining -= to_read;
+            if (remaining > 0) // skip the line terminator
+                secondary_stream->ignore(entry.linewidth - entry.linebases);
+        }
+
+        // consume trailing whitespace so that iteration continues at the following record
+        while (true)
+        {
+            auto const c = secondary_stream->peek();
+            if ((c == std::char_traits<stream_char_type>::eof()) || !is_space(static_cast<char>(c)))
+                break;
+
+            secondary_stream->get();
+        }
+    }
+    //!\}
+
+    /*!\name Parallel interface
+     * \brief Provides multi-threaded parsing behind the regular iterator interface.
+     * \{
+     */
+    /*!\brief Parse subsequent records on a pool of background threads.
+     * \param[in] thread_count  The number of parse jobs that may run concurrently.
+     * \param[in] chunk_records The number of records per parse job.
+     *
+     * \details
+     *
+     * An I/O pass splits the stream into chunks at record boundaries, every chunk is parsed by its own
+     * job (seqan3::detail::bgzf_istream-style bounded queue of std::async tasks) and the results are
+     * handed to the consumer in file order — the iterator interface is unchanged, only throughput
+     * scales with the cores.
+     *
+     * Chunking understands FASTA (records start at `>`/`;` header lines) and canonical four-line FASTQ
+     * records; for other formats — or FASTQ files with line breaks inside sequence or qualities — this
+     * call is a no-op and parsing stays sequential. Parse errors surface on the consuming thread in
+     * file order, just like in sequential mode. Do not combine with seek_to().
+     */
+    void parse_parallel(size_t const thread_count = std::thread::hardware_concurrency(),
+                        size_t const chunk_records = 1024)
+    {
+        bool const supported = std::visit([] (auto const & f)
+        {
+            using format_t = remove_cvref_t<decltype(f)>;
+            return std::is_same_v<format_t, sequence_file_format_fasta> ||
+                   std::is_same_v<format_t, sequence_file_format_fastq>;
+        }, format);
+
+        if (!supported || at_end)
+            return;
+
+        parallel_thread_count = (thread_count == 0) ? 2u : thread_count; // hardware_concurrency may report 0
+        parallel_chunk_records = std::max<size_t>(chunk_records, 1u);
+        parallel_parsing = true;
+
+        fill_parse_queue();
+    }
+
+    /*!\brief Parse subsequent records on a single background thread, keeping up to `depth` records ready.
+     * \param[in] depth The maximum number of records parsed ahead of the consumer.
+     *
+     * \details
+     *
+     * Record parsing then overlaps with the consumer's per-record work — the iterator interface is
+     * unchanged, operator++ hands out the next prefetched record (blocking only if the parser has not
+     * caught up yet). Works with every format; for higher levels of parallelism on FASTA/FASTQ see
+     * parse_parallel() instead.
+     *
+     * Parse errors surface on the consuming thread in file order, just like in sequential mode.
+     * Set all options before calling this and do not combine it with seek_to(), parse_parallel() or
+     * raw_record() — the stream belongs to the background thread from here on.
+     */
+    void prefetch(size_t const depth = 4)
+    {
+        if ((prefetcher != nullptr) || parallel_parsing || at_end)
+            return;
+
+        raw_record_begin = raw_record_end = -1; // the stream now belongs to the background thread
+
+        prefetcher = std::make_unique<detail::record_prefetcher<record_type>>(depth,
+            [this] (record_type & rec) { return read_next_record_sequential(rec); });
+    }
+
+    /*!\brief Request the next record without blocking, for multiplexing many open files from one thread.
+     * \param[out] rec Assigned the next record if seqan3::record_availability::ready is returned.
+     * \returns seqan3::record_availability::ready if `rec` was assigned, seqan3::record_availability::pending
+     *          if the background parser has not produced the next record yet, and
+     *          seqan3::record_availability::at_end at the end of the file.
+     *
+     * \details
+     *
+     * With an active prefetch() this function only inspects the record ring that the background thread
+     * refills and therefore never blocks — a single reactor/executor thread can poll many open files
+     * round-robin (treating seqan3::record_availability::pending as "try another file") instead of
+     * dedicating one blocked iterator or thread per file. Without prefetch() the record is parsed
+     * synchronously on the calling thread and seqan3::record_availability::pending is never returned.
+     *
+     * The first call hands out the record already parsed on construction; records are consumed from
+     * the same stream as the iterator interface, so do not mix the two.
+     *
+     * Parse errors of the background thread surface here in file order, like in sequential mode.
+     */
+    record_availability try_next_record(record_type & rec)
+    {
+        if (!first_record_polled) // the first record was already parsed on construction
+        {
+            first_record_polled = true;
+
+            if (at_end)
+                return record_availability::at_end;
+
+            rec = std::move(record_buffer);
+            return record_availability::ready;
+        }
+
+        if (prefetcher != nullptr)
+            return prefetcher->try_pop(rec);
+
+        if (at_end || !read_next_record_sequential(rec))
+        {
+            at_end = true;
+            return record_availability::at_end;
+        }
+
+        return record_availability::ready;
+    }
+    //!\}
+
     //!\brief The options are public and its members can be set directly.
     sequence_file_input_options<typename traits_type::sequence_legal_alphabet,
                              selected_field_ids::contains(field::SEQ_QUAL)> options;
@@ -721,30 +1152,245 @@ protected:
     stream_ptr_t primary_stream{nullptr, stream_deleter_noop};
     //!\brief The secondary stream is a compression layer on the primary or just points to the primary (no compression).
     stream_ptr_t secondary_stream{nullptr, stream_deleter_noop};
+    //!\brief Storage for the enlarged I/O buffer of the primary stream (see seqan3::stream_buffer_size).
+    std::vector<char> stream_buffer{};
 
     //!\brief File is at position 1 behind the last record.
     bool at_end{false};
 
+    //!\brief Byte offset of the currently buffered record in the secondary stream (-1 if unknown).
+    std::streamoff raw_record_begin{-1};
+    //!\brief Byte offset of the first byte behind the currently buffered record (-1 if unknown).
+    std::streamoff raw_record_end{-1};
+    //!\brief The buffer that raw_record() extracts the record's bytes into.
+    std::basic_string<stream_char_type> raw_record_buffer{};
+
+    //!\brief The path the file was constructed from (empty for stream constructors); used by seek_to().
+    std::filesystem::path file_path{};
+
+    //!\brief The index used by seek_to(); empty until loaded or built on first use.
+    fai_index index{};
+
     //!\brief Type of the format, an std::variant over the `valid_formats`.
     using format_type = detail::transfer_template_args_onto_t<valid_formats, std::variant>;
     //!\brief The actual std::variant holding a pointer to the detected/selected format.
     format_type format;
     //!\}
 
+    /*!\name Parallel parsing state
+     * \{
+     */
+    //!\brief Whether parse_parallel() activated the pipeline.
+    bool parallel_parsing{false};
+    //!\brief The maximum number of parse jobs in flight.
+    size_t parallel_thread_count{0};
+    //!\brief The number of records per parse job.
+    size_t parallel_chunk_records{0};
+    //!\brief Whether the chunker consumed the entire stream.
+    bool chunker_at_end{false};
+    //!\brief The in-flight parse jobs; results are consumed front-to-back to preserve file order.
+    std::deque<std::future<std::vector<record_type>>> parse_jobs;
+    //!\brief The records of the chunk currently handed to the consumer.
+    std::vector<record_type> parsed_batch;
+    //!\brief The position of the next unconsumed record in \ref parsed_batch.
+    size_t parsed_batch_pos{0};
+
+    //!\brief The background-thread ring buffer created by prefetch() (`nullptr` while inactive).
+    std::unique_ptr<detail::record_prefetcher<record_type>> prefetcher{nullptr};
+
+    //!\brief Whether try_next_record() has handed out the record that was parsed on construction.
+    bool first_record_polled{false};
+    //!\}
+
+    //!\brief Read raw text of up to \ref parallel_chunk_records records, split at record boundaries.
+    std::basic_string<stream_char_type> read_chunk()
+    {
+        std::basic_string<stream_char_type> chunk;
+        std::basic_string<stream_char_type> line;
+
+        bool const is_fastq = std::visit([] (auto const & f)
+        {
+            return std::is_same_v<remove_cvref_t<decltype(f)>, sequence_file_format_fastq>;
+        }, format);
+
+        if (is_fastq) // canonical FASTQ: four lines per record
+        {
+            for (size_t i = 0; i < 4 * parallel_chunk_records && std::getline(*secondary_stream, line); ++i)
+            {
+                chunk += line;
+                chunk += '\n';
+            }
+        }
+        else // FASTA: records start at '>'/';' header lines
+        {
+            size_t records_seen = 0;
+            while (true)
+            {
+                auto const c = secondary_stream->peek();
+                if (c == std::char_traits<stream_char_type>::eof())
+                    break;
+
+                if (((c == '>') || (c == ';')) && (++records_seen > parallel_chunk_records))
+                    break; // leave the next record's header line in the stream
+
+                if (!std::getline(*secondary_stream, line))
+                    break;
+
+                chunk += line;
+                chunk += '\n';
+            }
+        }
+
+        return chunk;
+    }
+
+    //!\brief Parse one raw chunk with a thread-local format instance (runs inside a parse job).
+    std::vector<record_type> parse_chunk(std::basic_string<stream_char_type> const & chunk)
+    {
+        std::vector<record_type> records;
+        std::basic_istringstream<stream_char_type> stream{chunk};
+
+        std::visit([&] (auto const & f)
+        {
+            using format_t = remove_cvref_t<decltype(f)>;
+            format_t chunk_format{};
+
+            while (std::istreambuf_iterator<stream_char_type>{stream} !=
+                   std::istreambuf_iterator<stream_char_type>{})
+            {
+                record_type rec;
+
+                if (options.reserve_record_capacity > 0)
+                    reserve_record_fields(rec);
+
+                if constexpr (selected_field_ids::contains(field::SEQ_QUAL))
+                {
+                    chunk_format.read(stream,
+                                      options,
+                                      detail::get_or_ignore<field::SEQ_QUAL>(rec),
+                                      detail::get_or_ignore<field::ID>(rec),
+                                      detail::get_or_ignore<field::SEQ_QUAL>(rec));
+                }
+                else
+                {
+                    chunk_format.read(stream,
+                                      options,
+                                      detail::get_or_ignore<field::SEQ>(rec),
+                                      detail::get_or_ignore<field::ID>(rec),
+                                      detail::get_or_ignore<field::QUAL>(rec));
+                }
+
+                records.push_back(std::move(rec));
+            }
+        }, format);
+
+        return records;
+    }
+
+    //!\brief Launch parse jobs until the queue is full or the stream is exhausted.
+    void fill_parse_queue()
+    {
+        while (!chunker_at_end && (parse_jobs.size() < parallel_thread_count))
+        {
+            std::basic_string<stream_char_type> chunk = read_chunk();
+            if (chunk.empty())
+            {
+                chunker_at_end = true;
+                break;
+            }
+
+            parse_jobs.push_back(std::async(std::launch::async, [this, chunk = std::move(chunk)] ()
+            {
+                return parse_chunk(chunk);
+            }));
+        }
+    }
+
+    //!\brief Hand out the next record from the parallel pipeline, refilling the job queue.
+    void read_next_record_parallel()
+    {
+        record_buffer.clear();
+        raw_record_begin = raw_record_end = -1; // parallel records do not map to a contiguous stream span
+
+        while (parsed_batch_pos >= parsed_batch.size())
+        {
+            fill_parse_queue();
+
+            if (parse_jobs.empty())
+            {
+                at_end = true;
+                return;
+            }
+
+            parsed_batch = parse_jobs.front().get(); // rethrows parse errors in file order
+            parse_jobs.pop_front();
+            parsed_batch_pos = 0;
+
+            fill_parse_queue(); // keep the workers busy while we consume this batch
+        }
+
+        record_buffer = std::move(parsed_batch[parsed_batch_pos]);
+        ++parsed_batch_pos;
+    }
+
+    //!\brief Reserves seqan3::sequence_file_input_options::reserve_record_capacity in every reservable field buffer.
+    void reserve_record_fields(record_type & rec)
+    {
+        auto reserve_one = [this] (auto & buffer)
+        {
+            if constexpr (reservable_container_concept<remove_cvref_t<decltype(buffer)>>)
+                buffer.reserve(options.reserve_record_capacity);
+        };
+
+        reserve_one(detail::get_or_ignore<field::SEQ>(rec));
+        reserve_one(detail::get_or_ignore<field::ID>(rec));
+        reserve_one(detail::get_or_ignore<field::QUAL>(rec));
+        reserve_one(detail::get_or_ignore<field::SEQ_QUAL>(rec));
+    }
+
     //!\brief Tell the format to move to the next record and update the buffer.
     void read_next_record()
     {
-        // clear the record
-        record_buffer.clear();
+        if (prefetcher != nullptr)
+        {
+            at_end = !prefetcher->pop(record_buffer);
+            return;
+        }
+
+        if (parallel_parsing)
+        {
+            read_next_record_parallel();
+            return;
+        }
+
+        at_end = !read_next_record_sequential(record_buffer);
+    }
+
+    /*!\brief Parse the next record from the stream into `rec`.
+     * \returns `false` if the stream holds no further record, `true` otherwise.
+     *
+     * Called on the consuming thread in sequential mode and on the background thread when prefetch()
+     * is active (then `rec` is the prefetcher's scratch record, not \ref record_buffer).
+     */
+    bool read_next_record_sequential(record_type & rec)
+    {
+        // clear the record (field buffers keep their capacity)
+        rec.clear();
+
+        // pre-reserve the field buffers to the expected record size (no-op once the capacity is reached)
+        if (options.reserve_record_capacity > 0)
+            reserve_record_fields(rec);
 
         // at end if we could not read further
         if ((std::istreambuf_iterator<stream_char_type>{*secondary_stream} ==
              std::istreambuf_iterator<stream_char_type>{}))
         {
-            at_end = true;
-            return;
+            return false;
         }
 
+        if (prefetcher == nullptr) // raw spans are only tracked on the consuming thread
+            raw_record_begin = secondary_stream->tellg(); // -1 on non-seekable streams
+
         assert(!format.valueless_by_exception());
         std::visit([&] (SequenceFileInputFormat & f)
         {
@@ -753,19 +1399,54 @@ protected:
             {
                 f.read(*secondary_stream,
                        options,
-                       detail::get_or_ignore<field::SEQ_QUAL>(record_buffer),
-                       detail::get_or_ignore<field::ID>(record_buffer),
-                       detail::get_or_ignore<field::SEQ_QUAL>(record_buffer));
+                       detail::get_or_ignore<field::SEQ_QUAL>(rec),
+                       detail::get_or_ignore<field::ID>(rec),
+                       detail::get_or_ignore<field::SEQ_QUAL>(rec));
             }
             else
             {
                 f.read(*secondary_stream,
                        options,
-                       detail::get_or_ignore<field::SEQ>(record_buffer),
-                       detail::get_or_ignore<field::ID>(record_buffer),
-                       detail::get_or_ignore<field::QUAL>(record_buffer));
+                       detail::get_or_ignore<field::SEQ>(rec),
+                       detail::get_or_ignore<field::ID>(rec),
+                       detail::get_or_ignore<field::QUAL>(rec));
             }
         }, format);
+
+        if (prefetcher == nullptr)
+        {
+            raw_record_end = secondary_stream->tellg();
+            if ((raw_record_end == -1) && secondary_stream->eof()) // the final record ran into the end of the file
+            {
+                secondary_stream->clear();
+                raw_record_end = secondary_stream->tellg();
+                secondary_stream->setstate(std::ios::eofbit);
+            }
+        }
+
+        if constexpr (memory_stats::enabled)
+            count_record_bytes(rec);
+
+        return true;
+    }
+
+    //!\brief Adds the bytes buffered for the fields of `rec` to the io-record memory counters.
+    void count_record_bytes(record_type & rec)
+    {
+        size_t bytes = 0;
+        auto add_one = [&bytes] (auto & buffer)
+        {
+            using buffer_t = remove_cvref_t<decltype(buffer)>;
+            if constexpr (!std::Same<buffer_t, remove_cvref_t<decltype(std::ignore)>>)
+                bytes += std::ranges::size(buffer) * sizeof(value_type_t<buffer_t>);
+        };
+
+        add_one(detail::get_or_ignore<field::SEQ>(rec));
+        add_one(detail::get_or_ignore<field::ID>(rec));
+        add_one(detail::get_or_ignore<field::QUAL>(rec));
+        add_one(detail::get_or_ignore<field::SEQ_QUAL>(rec));
+
+        detail::record_memory_use(memory_stats::subsystem::io_record, bytes);
     }
 
     //!\brief Read the entire file into the internal column buffers.
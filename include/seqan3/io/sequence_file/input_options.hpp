@@ -12,6 +12,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include <seqan3/core/platform.hpp>
 
 namespace seqan3
@@ -28,6 +30,16 @@ struct sequence_file_input_options
     bool truncate_ids = false;
     //!\brief Read the complete header to id.
     bool embl_genbank_complete_header = false;
+    /*!\brief Reserve this many elements in every field buffer before reading a record (0 means no reservation).
+     *
+     * Field buffers keep their capacity across records, so after the first record that fits, the read loop
+     * performs no further allocations. Set this to the expected maximum record size to also avoid the
+     * initial growth reallocations.
+     *
+     * Note that the first record of a file is buffered on construction, i.e. before this option can be set;
+     * the reservation therefore takes effect from the second record onwards.
+     */
+    size_t reserve_record_capacity = 0;
 };
 
 } // namespace seqan3
@@ -15,6 +15,7 @@
 #include <cassert>
 #include <fstream>
 #include <string>
+#include <string_view>
 #include <variant>
 #include <vector>
 
@@ -24,6 +25,7 @@
 #include <seqan3/core/metafunction/basic.hpp>
 #include <seqan3/core/metafunction/template_inspection.hpp>
 #include <seqan3/core/concept/tuple.hpp>
+#include <seqan3/io/stream/buffer.hpp>
 #include <seqan3/io/stream/concept.hpp>
 #include <seqan3/io/exception.hpp>
 #include <seqan3/std/filesystem>
@@ -31,10 +33,12 @@
 #include <seqan3/io/detail/misc_output.hpp>
 #include <seqan3/io/detail/out_file_iterator.hpp>
 #include <seqan3/io/detail/record.hpp>
+#include <seqan3/io/sequence_file/format_binary.hpp>
 #include <seqan3/io/sequence_file/format_embl.hpp>
 #include <seqan3/io/sequence_file/format_fasta.hpp>
 #include <seqan3/io/sequence_file/format_fastq.hpp>
 #include <seqan3/io/sequence_file/format_sam.hpp>
+#include <seqan3/io/sequence_file/input.hpp>
 #include <seqan3/io/sequence_file/output_format_concept.hpp>
 #include <seqan3/io/sequence_file/output_options.hpp>
 #include <seqan3/range/view/convert.hpp>
@@ -160,8 +164,8 @@ namespace seqan3
 
 template <detail::fields_concept selected_field_ids_ = fields<field::SEQ, field::ID, field::QUAL>,
           detail::TypeListOfSequenceFileOutputFormats valid_formats_ =
-              type_list<sequence_file_format_embl, sequence_file_format_fasta, sequence_file_format_fastq,
-                        sequence_file_format_sam>,
+              type_list<sequence_file_format_binary, sequence_file_format_embl, sequence_file_format_fasta,
+                        sequence_file_format_fastq, sequence_file_format_sam>,
           char_concept stream_char_type_ = char>
 class sequence_file_output
 {
@@ -247,11 +251,24 @@ public:
      * This constructor transparently applies a compression stream on top of the file stream in case
      * the given file extension suggests the user wants this.
      * See the section on \link io_compression compression and decompression \endlink for more information.
+     *
+     * The file stream receives an enlarged I/O buffer whose size is controlled by seqan3::stream_buffer_size.
      */
     sequence_file_output(std::filesystem::path filename,
                          selected_field_ids const & SEQAN3_DOXYGEN_ONLY(fields_tag) = selected_field_ids{}) :
-        primary_stream{new std::ofstream{filename, std::ios_base::out | std::ios::binary}, stream_deleter_default}
+        primary_stream{new std::ofstream{}, stream_deleter_default}
     {
+        std::ofstream * fstream = static_cast<std::ofstream *>(primary_stream.get());
+
+        // the buffer must be installed before the first write, i.e. before the file is opened
+        if (stream_buffer_size > 0)
+        {
+            stream_buffer.resize(stream_buffer_size);
+            fstream->rdbuf()->pubsetbuf(stream_buffer.data(), stream_buffer.size());
+        }
+
+        fstream->open(filename, std::ios_base::out | std::ios::binary);
+
         if (!primary_stream->good())
             throw file_open_error{"Could not open file " + filename.string() + " for reading."};
 
@@ -441,6 +458,28 @@ public:
         push_back(std::tie(arg, args...));
     }
 
+    /*!\brief          Write a record's raw bytes to the file without formatting them.
+     * \param[in] raw  The bytes to write, e.g. obtained from seqan3::sequence_file_input::raw_record().
+     *
+     * \details
+     *
+     * The bytes are copied to the stream verbatim, no format is invoked. Use this only with data that already
+     * is in this file's format, e.g. to copy records between files of the same format without parsing and
+     * re-formatting them ("passthrough"). Note that none of the options are applied in this case.
+     *
+     * ### Complexity
+     *
+     * Linear in the size of `raw`.
+     *
+     * ### Exceptions
+     *
+     * Basic exception safety.
+     */
+    void push_back_raw(std::basic_string_view<stream_char_type> const raw)
+    {
+        secondary_stream->rdbuf()->sputn(raw.data(), raw.size());
+    }
+
     /*!\brief            Write a range of records (or tuples) to the file.
      * \tparam rng_t     Type of the range, must satisfy std::ranges::OutputRange and have a reference type that
      *                   satisfies seqan3::tuple_like_concept.
@@ -471,6 +510,60 @@ public:
         return *this;
     }
 
+    /*!\brief            Write all records of a seqan3::sequence_file_input to the file.
+     * \tparam traits_t      The input file's traits type.
+     * \tparam fields_t      The input file's selected fields.
+     * \tparam formats_t     The input file's valid formats.
+     * \tparam stream_char_t The input file's stream character type.
+     * \param[in] fin        The input file to copy the records from.
+     *
+     * \details
+     *
+     * If the input file's detected format is the same as this file's format, the stream character types match
+     * and no \link options \endlink have been changed from their defaults, the records are copied as raw bytes
+     * via seqan3::sequence_file_input::raw_record() and push_back_raw() — the validated input bytes reach
+     * the output stream without being converted to alphabets and re-formatted ("passthrough"). The output then
+     * preserves the input's exact formatting (line widths, ID markers ...).
+     *
+     * In all other cases (and for individual records whose raw bytes are not recoverable, e.g. on unseekable
+     * streams) this falls back to calling push_back() on each record.
+     *
+     * ### Complexity
+     *
+     * Linear in the number of records.
+     *
+     * ### Exceptions
+     *
+     * Basic exception safety.
+     */
+    template <typename traits_t, typename fields_t, typename formats_t, typename stream_char_t>
+    sequence_file_output & operator=(sequence_file_input<traits_t, fields_t, formats_t, stream_char_t> & fin)
+    {
+        if constexpr (std::is_same_v<stream_char_t, stream_char_type>)
+        {
+            bool const same_format = std::visit([&fin] (auto const & f)
+            {
+                return fin.template current_format_is<remove_cvref_t<decltype(f)>>();
+            }, format);
+
+            if (same_format && options_are_default())
+            {
+                for (auto it = fin.begin(); it != fin.end(); ++it)
+                {
+                    if (auto const raw = fin.raw_record(); !raw.empty())
+                        push_back_raw(raw);
+                    else                    // raw bytes not recoverable for this record
+                        push_back(*it);
+                }
+                return *this;
+            }
+        }
+
+        for (auto && record : fin)
+            push_back(std::forward<decltype(record)>(record));
+        return *this;
+    }
+
     /*!\brief            Write a range of records (or tuples) to the file.
      * \tparam rng_t     Type of the range, must satisfy std::ranges::InputRange and have a reference type that
      *                   satisfies seqan3::tuple_like_concept.
@@ -615,6 +708,8 @@ protected:
     stream_ptr_t primary_stream{nullptr, stream_deleter_noop};
     //!\brief The secondary stream is a compression layer on the primary or just points to the primary (no compression).
     stream_ptr_t secondary_stream{nullptr, stream_deleter_noop};
+    //!\brief Storage for the enlarged I/O buffer of the primary stream (see seqan3::stream_buffer_size).
+    std::vector<char> stream_buffer{};
 
     //!\brief Type of the format, an std::variant over the `valid_formats`.
     using format_type = detail::transfer_template_args_onto_t<valid_formats, std::variant>;
@@ -622,6 +717,18 @@ protected:
     format_type format;
     //!\}
 
+    //!\brief Whether all options still have their default values (a requirement for raw passthrough).
+    bool options_are_default() const noexcept
+    {
+        sequence_file_output_options constexpr defaults{};
+        return (options.fasta_legacy_id_marker        == defaults.fasta_legacy_id_marker)        &&
+               (options.fasta_blank_before_id         == defaults.fasta_blank_before_id)         &&
+               (options.fasta_letters_per_line        == defaults.fasta_letters_per_line)        &&
+               (options.fastq_double_id               == defaults.fastq_double_id)               &&
+               (options.add_carriage_return           == defaults.add_carriage_return)           &&
+               (options.embl_genbank_complete_header  == defaults.embl_genbank_complete_header);
+    }
+
     //!\brief Write record to format.
     template <typename seq_t, typename id_t, typename qual_t, typename seq_qual_t>
     void write_record(seq_t && seq, id_t && id, qual_t && qual, seq_qual_t && seq_qual)
@@ -0,0 +1,257 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::sequence_file_statistics.
+ * \author Hannes Hauswedell <hannes.hauswedell AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <seqan3/io/detail/mmap_istream.hpp>
+#include <seqan3/io/exception.hpp>
+#include <seqan3/io/stream/parse_condition.hpp>
+#include <seqan3/std/filesystem>
+
+namespace seqan3
+{
+
+/*!\brief Selects which accumulators seqan3::sequence_file_statistics fills.
+ * \ingroup sequence
+ *
+ * Every accumulator that is switched off is skipped entirely during the scan; record counting and
+ * the length extremes are always computed.
+ */
+struct sequence_file_statistics_options
+{
+    //!\brief Fill seqan3::sequence_file_statistics_result::length_histogram.
+    bool length_histogram = true;
+    //!\brief Fill seqan3::sequence_file_statistics_result::base_composition.
+    bool base_composition = true;
+    //!\brief Fill the per-position quality accumulators (FastQ only).
+    bool quality_sums = true;
+};
+
+/*!\brief The accumulators computed by seqan3::sequence_file_statistics.
+ * \ingroup sequence
+ */
+struct sequence_file_statistics_result
+{
+    //!\brief The number of records in the file.
+    size_t record_count = 0;
+    //!\brief The sum of all sequence lengths.
+    size_t total_length = 0;
+    //!\brief The shortest sequence length; meaningless if the file holds no records.
+    size_t min_length = 0;
+    //!\brief The longest sequence length.
+    size_t max_length = 0;
+
+    //!\brief `length_histogram[l]` is the number of records of length `l` (indexable up to max_length).
+    std::vector<size_t> length_histogram{};
+
+    //!\brief `base_composition[c]` is the number of sequence letters with the raw character value `c`.
+    std::array<size_t, 256> base_composition{};
+
+    //!\brief `quality_sums[p]` is the sum of the Phred scores at sequence position `p` over all records.
+    std::vector<uint64_t> quality_sums{};
+    //!\brief `quality_counts[p]` is the number of records that are at least `p + 1` letters long.
+    std::vector<size_t> quality_counts{};
+
+    //!\brief The mean sequence length.
+    double mean_length() const
+    {
+        return record_count == 0 ? 0.0 : static_cast<double>(total_length) / record_count;
+    }
+
+    //!\brief The fraction of sequence letters that are `G` or `C` (either case); requires base_composition.
+    double gc_content() const
+    {
+        size_t const gc = base_composition['G'] + base_composition['g'] +
+                          base_composition['C'] + base_composition['c'];
+        return total_length == 0 ? 0.0 : static_cast<double>(gc) / total_length;
+    }
+
+    //!\brief The mean Phred score at sequence position `pos`; requires quality_sums.
+    double mean_quality_at(size_t const pos) const
+    {
+        return quality_counts[pos] == 0 ? 0.0
+                                        : static_cast<double>(quality_sums[pos]) / quality_counts[pos];
+    }
+
+    //!\brief The mean Phred score over all positions of all records; requires quality_sums.
+    double mean_quality() const
+    {
+        uint64_t sum = 0;
+        for (uint64_t const s : quality_sums)
+            sum += s;
+        return total_length == 0 ? 0.0 : static_cast<double>(sum) / total_length;
+    }
+};
+
+/*!\brief Compute intake QC statistics over a FastA or FastQ file in one raw scan.
+ * \param[in] filename Path to the (uncompressed) file; the format is detected from the first character.
+ * \param[in] options  Which accumulators to fill, see seqan3::sequence_file_statistics_options.
+ * \returns The filled seqan3::sequence_file_statistics_result.
+ * \throws seqan3::file_open_error If the file could not be opened.
+ * \throws seqan3::parse_error     If the file violates the FastA/FastQ format.
+ * \ingroup sequence
+ *
+ * \details
+ *
+ * Going through seqan3::sequence_file_input constructs a sequence, an ID and a quality container per
+ * record only to immediately reduce them to a handful of counters. This function instead scans the raw
+ * file bytes (memory-mapped where possible, like seqan3::sequence_file_bulk_load) and feeds the
+ * accumulators directly, so the statistics are limited by I/O rather than by allocation.
+ *
+ * The base composition is tallied over the raw characters exactly as they appear in the file — no
+ * alphabet conversion or legality check is performed, so unexpected letters show up as their own
+ * histogram entries instead of aborting the scan. Whitespace and digits inside FastA sequences are
+ * ignored, as in the regular parser. Quality accumulators are only filled for FastQ input; Phred
+ * scores are taken as the raw character minus 33.
+ */
+inline sequence_file_statistics_result
+sequence_file_statistics(std::filesystem::path const & filename,
+                         sequence_file_statistics_options const options = {})
+{
+    sequence_file_statistics_result result{};
+
+    // the file's bytes, either the mapping itself or (fallback) a copy read in one go
+    char const * file_begin = nullptr;
+    char const * file_end   = nullptr;
+
+    detail::mmap_istreambuf<char> mapping{filename};
+    std::vector<char> fallback_buffer{};
+
+    if (mapping.is_open())
+    {
+        file_begin = mapping.data();
+        file_end   = mapping.data() + mapping.size();
+    }
+    else
+    {
+        std::ifstream stream{filename, std::ios_base::in | std::ios::binary};
+        if (!stream.is_open())
+            throw file_open_error{"Could not open file " + filename.string() + " for reading."};
+
+        fallback_buffer.assign(std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{});
+        file_begin = fallback_buffer.data();
+        file_end   = fallback_buffer.data() + fallback_buffer.size();
+    }
+
+    if (file_begin == file_end)
+        return result;
+
+    bool const fastq = is_char<'@'>(*file_begin);
+
+    auto constexpr is_fasta_id = is_char<'>'> || is_char<';'>;
+    auto constexpr is_newline  = is_char<'\n'> || is_char<'\r'>;
+
+    auto skip_line = [&] (char const * it)
+    {
+        while ((it != file_end) && !is_newline(*it))
+            ++it;
+        while ((it != file_end) && is_newline(*it))
+            ++it;
+        return it;
+    };
+
+    auto account_record = [&options, &result] (size_t const length)
+    {
+        if (result.record_count == 0 || length < result.min_length)
+            result.min_length = length;
+        if (length > result.max_length)
+            result.max_length = length;
+
+        ++result.record_count;
+        result.total_length += length;
+
+        if (options.length_histogram)
+        {
+            if (length >= result.length_histogram.size())
+                result.length_histogram.resize(length + 1);
+            ++result.length_histogram[length];
+        }
+    };
+
+    char const * it = file_begin;
+    while (it != file_end)
+    {
+        // ID line
+        if (fastq ? !is_char<'@'>(*it) : !is_fasta_id(*it))
+            throw parse_error{std::string{"Expected to be on beginning of ID, but "} +
+                              (fastq ? is_char<'@'>.msg.string() : is_fasta_id.msg.string()) +
+                              " evaluated to false on " + detail::make_printable(*it)};
+        it = skip_line(it);
+
+        // Sequence (FastA: until the next header; FastQ: until the + line)
+        size_t length = 0;
+        for (; it != file_end; ++it)
+        {
+            char const c = *it;
+
+            if (fastq ? is_char<'+'>(c) : is_fasta_id(c))
+                break;
+
+            if (is_space(c) || is_digit(c)) // ignore whitespace and numbers
+                continue;
+
+            if (options.base_composition)
+                ++result.base_composition[static_cast<uint8_t>(c)];
+            ++length;
+        }
+
+        if (fastq)
+        {
+            if (it == file_end)
+                throw parse_error{"Expected a + line before the qualities, but the file ended."};
+            it = skip_line(it); // the + line
+
+            // Qualities: exactly as many as there were sequence letters
+            size_t position = 0;
+            if (options.quality_sums && length > result.quality_sums.size())
+            {
+                result.quality_sums.resize(length);
+                result.quality_counts.resize(length);
+            }
+
+            for (; (it != file_end) && (position < length); ++it)
+            {
+                char const c = *it;
+
+                if (is_newline(c))
+                    continue;
+
+                if (options.quality_sums)
+                {
+                    result.quality_sums[position] += static_cast<uint8_t>(c) - 33u;
+                    ++result.quality_counts[position];
+                }
+                ++position;
+            }
+
+            if (position < length)
+                throw parse_error{"Expected " + std::to_string(length) + " qualities, but the file " +
+                                  "ended after " + std::to_string(position) + "."};
+
+            while ((it != file_end) && is_newline(*it)) // move onto the next record
+                ++it;
+        }
+
+        account_record(length);
+    }
+
+    return result;
+}
+
+} // namespace seqan3
@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <seqan3/io/stream/buffer.hpp>
 #include <seqan3/io/stream/concept.hpp>
 #include <seqan3/io/stream/debug_stream.hpp>
 #include <seqan3/io/stream/parse_condition.hpp>
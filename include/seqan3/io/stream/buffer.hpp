@@ -0,0 +1,56 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::stream_buffer_size and seqan3::stream_single_pass.
+ * \author Hannes Hauswedell <hannes.hauswedell AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3
+{
+
+/*!\brief The size in bytes of the I/O buffer installed on streams that a file object opens itself.
+ * \ingroup stream
+ *
+ * \details
+ *
+ * When a file object (e.g. seqan3::sequence_file_input or seqan3::sequence_file_output) is constructed from a
+ * filename, it replaces the stream's default buffer (usually a few kilobytes) with one of this size before the
+ * file is opened, so that data is moved between the application and the operating system in large chunks. The
+ * default of 1MiB makes a noticeable difference on high-latency filesystems (e.g. network mounts) where small
+ * reads and writes are expensive; assign to this variable **before opening the file** to change the size, or
+ * set it to `0` to keep the implementation-defined default buffer.
+ *
+ * Note that streams **passed into** a file object are left untouched, because their buffer can only be replaced
+ * before the first read or write; use `pubsetbuf()` on the stream yourself before handing it over if desired.
+ */
+inline size_t stream_buffer_size = 1u << 20;
+
+/*!\brief Whether files opened from now on are advised to the OS as single-pass sequential scans.
+ * \ingroup stream
+ *
+ * \details
+ *
+ * Set this to `true` **before opening the file** when you read a (large) file exactly once, e.g. in a
+ * batch job that scans a whole data set: the memory-mapped input path then tells the operating system to
+ * increase read-ahead (`POSIX_FADV_SEQUENTIAL`) and to evict the pages it has already consumed from the
+ * page cache (`POSIX_FADV_DONTNEED`), so the scan streams at device speed without displacing the cached
+ * working set of other processes. Seeking within the file remains possible, but re-reading evicted
+ * regions has to fetch them from the device again.
+ *
+ * The advice is applied where the platform supports it and silently ignored elsewhere; files that fall
+ * back to a regular (non-mapped) stream are read normally.
+ */
+inline bool stream_single_pass = false;
+
+} // namespace seqan3
@@ -13,7 +13,10 @@
 #pragma once
 
 #include <ios>
+#include <mutex>
 #include <ostream>
+#include <sstream>
+#include <string>
 #include <variant>
 
 #include <seqan3/alphabet/concept.hpp>
@@ -40,6 +43,9 @@ enum fmtflags2
     utf8                = 1,        //!< Enables use of non-ASCII UTF8 characters in formatted output.
     small_int_as_number = 1 << 1,   //!< `int8_t` and `uint8_t` are often aliases for `signed char` and `unsigned char`
                                     //!< resp. resulting in chars being printed; this options prints them as numbers.
+    buffered            = 1 << 2,   //!< Formats into per-thread buffers that are written to the underlying stream in
+                                    //!< blocks under a single lock, so output of concurrent threads does not
+                                    //!< interleave and formatting does not stall on the shared stream.
     default_            = small_int_as_number
 };
 
@@ -73,6 +79,17 @@ constexpr bool add_enum_bitwise_operators<fmtflags2> = true;
  *
  * See seqan3::fmtflags2 for more details.
  *
+ * # Buffered mode
+ *
+ * When seqan3::fmtflags2::buffered is set, all formatted output first goes to a buffer private to the
+ * calling thread; the buffer is written to the underlying stream in one block under a single lock once it
+ * exceeds an internal block size, when a stream manipulator (e.g. std::endl) is inserted, when flush() is
+ * called or when the thread ends. This keeps output of concurrent threads from interleaving and avoids
+ * stalling worker threads on the shared stream.
+ *
+ * \attention In buffered mode the underlying stream must outlive all threads that write to the debug
+ * stream (the default std::cerr always does); use flush() to publish buffered output eagerly.
+ *
  * \attention This class does not yet model seqan3::OStream fully, \todo implement.
  */
 class debug_stream_type
@@ -116,25 +133,46 @@ public:
      */
     void set_underlying_stream(std::ostream & out)
     {
+        if (is_buffered())
+            flush(); // publish this thread's output to the old stream before switching
         stream = &out;
     }
+
+    /*!\brief In buffered mode, writes the calling thread's buffered output to the underlying stream;
+     *        otherwise flushes the underlying stream.
+     */
+    void flush()
+    {
+        if (is_buffered())
+            buffer_for_this_stream().flush();
+        else
+            stream->flush();
+    }
     //!\}
 
     /*!\name Formatted output
      * \{
      */
-    //!\brief Forwards to the underlying stream object.
+    //!\brief Forwards to the underlying stream object (or the calling thread's buffer in buffered mode).
     template <typename t>
     debug_stream_type & operator<<(t && v)
     {
-        *stream << v;
+        print(v);
         return *this;
     }
 
     //!\brief This overloads enables forwarding std::endl and other manipulators.
     debug_stream_type & operator<<(std::ostream&(*fp)(std::ostream&))
     {
-        *stream << fp;
+        if (is_buffered())
+        {
+            buffer_for_this_stream().str << fp;
+            flush(); // manipulators like std::endl and std::flush expect their effect to be visible
+        }
+        else
+        {
+            *stream << fp;
+        }
         return *this;
     }
 
@@ -142,21 +180,40 @@ public:
     debug_stream_type & operator<<(int8_t const v)
     {
         if ((flags2() & fmtflags2::small_int_as_number) == fmtflags2::small_int_as_number)
-            *stream << static_cast<int>(v);
+            print(static_cast<int>(v));
         else
-            *stream << v;
+            print(v);
         return *this;
     }
 
     debug_stream_type & operator<<(uint8_t const v)
     {
         if ((flags2() & fmtflags2::small_int_as_number) == fmtflags2::small_int_as_number)
-            *stream << static_cast<unsigned>(v);
+            print(static_cast<unsigned>(v));
         else
-            *stream << v;
+            print(v);
         return *this;
     }
     //!\endcond
+
+    /*!\brief Writes a block of characters in one call, bypassing element-wise formatting.
+     * \param data  Pointer to the first character of the block.
+     * \param count Number of characters to write.
+     */
+    debug_stream_type & write(char const * data, size_t const count)
+    {
+        if (is_buffered())
+        {
+            thread_buffer & buf = buffer_for_this_stream();
+            buf.str.write(data, count);
+            buf.flush_if_full();
+        }
+        else
+        {
+            stream->write(data, count);
+        }
+        return *this;
+    }
     //!\}
 
     /*!\name Format flags (std::ios_base::fmtflags)
@@ -172,18 +229,24 @@ public:
     //!\brief Replace the current flags on the stream with the given argument.
     std::ios_base::fmtflags flags(std::ios_base::fmtflags const flgs)
     {
+        if (is_buffered()) // keep the calling thread's buffer in sync
+            buffer_for_this_stream().str.flags(flgs);
         return stream->flags(flgs);
     }
 
     //!\brief Set the format flag(s) on the stream (current flags are ORed with the argument).
     void setf(std::ios_base::fmtflags const flag)
     {
+        if (is_buffered()) // keep the calling thread's buffer in sync
+            buffer_for_this_stream().str.setf(flag);
         stream->setf(flag);
     }
 
     //!\brief Unset the format flag(s) on the stream.
     void unsetf(std::ios_base::fmtflags const flag)
     {
+        if (is_buffered()) // keep the calling thread's buffer in sync
+            buffer_for_this_stream().str.unsetf(flag);
         stream->unsetf(flag);
     }
 
@@ -233,6 +296,97 @@ public:
     //!\}
 
 private:
+    //!\brief Number of bytes after which a thread's buffer is written to the underlying stream (buffered mode).
+    static constexpr size_t block_size = 4096;
+
+    //!\brief The single lock under which all threads' buffers are written to the underlying stream.
+    static std::mutex & flush_mutex()
+    {
+        static std::mutex mutex{};
+        return mutex;
+    }
+
+    //!\brief The per-thread formatting buffer used in buffered mode (see seqan3::fmtflags2::buffered).
+    struct thread_buffer
+    {
+        //!\brief Receives all formatted output of the owning thread.
+        std::ostringstream str{};
+        //!\brief The underlying stream the buffered output belongs to.
+        std::ostream * target{nullptr};
+
+        //!\brief Flushes any remaining buffered output when the thread ends.
+        ~thread_buffer()
+        {
+            flush();
+        }
+
+        //!\brief Writes the buffer contents to the target in one block (under the flush lock) and clears it.
+        void flush()
+        {
+            if (target == nullptr)
+                return;
+
+            std::string const contents = str.str();
+            if (!contents.empty())
+            {
+                std::lock_guard<std::mutex> lock{flush_mutex()};
+                target->write(contents.data(), contents.size());
+                target->flush();
+            }
+            str.str(std::string{});
+            target = nullptr; // the next write re-adopts the format state of its stream
+        }
+
+        //!\brief Flushes the buffer once it holds at least one full block.
+        void flush_if_full()
+        {
+            if (str.tellp() >= static_cast<std::streamoff>(block_size))
+                flush();
+        }
+    };
+
+    //!\brief Returns the calling thread's buffer.
+    static thread_buffer & buffer()
+    {
+        static thread_local thread_buffer buf{};
+        return buf;
+    }
+
+    //!\brief Returns the calling thread's buffer retargeted to this stream (flushing output to a previous target).
+    thread_buffer & buffer_for_this_stream()
+    {
+        thread_buffer & buf = buffer();
+        if (buf.target != stream)
+        {
+            buf.flush();
+            buf.target = stream;
+            buf.str.copyfmt(*stream); // adopt the format state of the underlying stream
+        }
+        return buf;
+    }
+
+    //!\brief Whether this stream is in buffered mode (see seqan3::fmtflags2::buffered).
+    bool is_buffered() const
+    {
+        return (flgs2 & fmtflags2::buffered) == fmtflags2::buffered;
+    }
+
+    //!\brief Prints to the calling thread's buffer in buffered mode and directly to the stream otherwise.
+    template <typename t>
+    void print(t && v)
+    {
+        if (is_buffered())
+        {
+            thread_buffer & buf = buffer_for_this_stream();
+            buf.str << v;
+            buf.flush_if_full();
+        }
+        else
+        {
+            *stream << v;
+        }
+    }
+
     //!\brief Pointer to the output stream.
     std::ostream *stream = &std::cerr;
 
@@ -377,8 +531,16 @@ inline debug_stream_type & operator<<(debug_stream_type & s, rng_t && r)
     if constexpr (Alphabet<remove_cvref_t<reference_t<rng_t>>> &&
                   !detail::is_uint_adaptation_v<remove_cvref_t<reference_t<rng_t>>>)
     {
+        // convert the whole range in a single pass and write it as one block instead of
+        // formatting every letter through a separate stream insertion
+        std::string buffer{};
+        if constexpr (std::ranges::SizedRange<rng_t>)
+            buffer.reserve(size(r));
+
         for (auto && l : r)
-            s << l;
+            buffer.push_back(to_char(l));
+
+        s.write(buffer.data(), buffer.size());
     }
     else
     {
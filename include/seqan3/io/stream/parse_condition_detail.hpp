@@ -13,7 +13,9 @@
 
 #pragma once
 
+#include <array>
 #include <cctype>
+#include <cstring>
 #include <stdexcept>
 #include <string>
 
@@ -22,8 +24,10 @@
 #include <seqan3/alphabet/concept.hpp>
 #include <seqan3/core/detail/reflection.hpp>
 #include <seqan3/core/metafunction/basic.hpp>
+#include <seqan3/core/simd/detail/builtin_simd.hpp>
 #include <seqan3/io/exception.hpp>
 #include <seqan3/range/container/constexpr_string.hpp>
+#include <seqan3/std/span>
 
 namespace seqan3::detail
 {
@@ -249,6 +253,124 @@ struct parse_condition_base
     }
     //!\}
 
+    /*!\name Bulk classification
+     * \{
+     */
+    /*!\brief Returns a pointer to the first character in `[first, last)` that does **not** satisfy the condition.
+     * \param[in] first Pointer to the first character of the buffer.
+     * \param[in] last  Pointer behind the last character of the buffer.
+     * \returns `last` if all characters satisfy the condition.
+     *
+     * \details
+     *
+     * In contrast to calling operator() per character, whole chunks of 16 characters are classified
+     * before branching. Where vector extensions are available, the condition's look-up table is folded
+     * into nibble bitmask tables that are evaluated for 16 characters at once via byte shuffles, so
+     * validating a buffer costs a few instructions per chunk instead of one load and one branch per
+     * character.
+     */
+    char const * find_first_not_of(char const * first, char const * last) const noexcept
+    {
+        constexpr size_t chunk_size = 16;
+
+#if defined(__GNUC__) && !defined(__clang__) && defined(__SSSE3__)
+        using simd_t = typename builtin_simd<uint8_t, chunk_size>::type;
+
+        // one table for the lower and one for the upper half of the character range
+        static constexpr std::array<uint8_t, chunk_size> lo_table_arr = nibble_bitmask_table(false);
+        static constexpr std::array<uint8_t, chunk_size> hi_table_arr = nibble_bitmask_table(true);
+
+        simd_t lo_table;
+        simd_t hi_table;
+        std::memcpy(&lo_table, lo_table_arr.data(), chunk_size);
+        std::memcpy(&hi_table, hi_table_arr.data(), chunk_size);
+
+        while (last - first >= static_cast<std::ptrdiff_t>(chunk_size))
+        {
+            simd_t chars;
+            std::memcpy(&chars, first, chunk_size);
+
+            simd_t const rows     = chars & 0xF;
+            simd_t const hi_mask  = simd_t{} - (chars >> 7);                        // 0xFF iff char >= 128
+            simd_t const bitmasks = (__builtin_shuffle(lo_table, rows) & ~hi_mask) |
+                                    (__builtin_shuffle(hi_table, rows) &  hi_mask);
+            simd_t const bits     = (simd_t{} + 1) << ((chars >> 4) & 7);
+
+            auto const failed = ((bitmasks & bits) == simd_t{});
+
+            uint64_t failed_scalar[2];
+            std::memcpy(&failed_scalar, &failed, chunk_size);
+            if (failed_scalar[0] | failed_scalar[1])
+                break; // the loop below reports the exact position
+
+            first += chunk_size;
+        }
+#else
+        while (last - first >= static_cast<std::ptrdiff_t>(chunk_size))
+        {
+            bool any_invalid = false; // evaluate the whole chunk branch-free before deciding
+            for (size_t i = 0; i < chunk_size; ++i)
+                any_invalid |= !derived_t::data[static_cast<uint8_t>(first[i])];
+
+            if (any_invalid)
+                break;
+
+            first += chunk_size;
+        }
+#endif
+
+        while ((first != last) && derived_t::data[static_cast<uint8_t>(*first)])
+            ++first;
+
+        return first;
+    }
+
+    /*!\brief Returns a pointer to the first character in `[first, last)` that **does** satisfy the condition.
+     * \param[in] first Pointer to the first character of the buffer.
+     * \param[in] last  Pointer behind the last character of the buffer.
+     * \returns `last` if no character satisfies the condition.
+     *
+     * \details
+     *
+     * Conditions that hold for exactly one character delegate to std::memchr (vectorised in all major
+     * C libraries); all other conditions scan through the negated condition, i.e. with the same
+     * chunk-wise look-up table evaluation as find_first_not_of().
+     */
+    char const * find_first_of(char const * first, char const * last) const noexcept
+    {
+        if constexpr (matching_char_count() == 1u)
+        {
+            if (auto const * hit = static_cast<char const *>(std::memchr(first, matching_char(), last - first));
+                hit != nullptr)
+            {
+                return hit;
+            }
+
+            return last;
+        }
+        else
+        {
+            return parse_condition_negator<derived_t>{}.find_first_not_of(first, last);
+        }
+    }
+
+    /*!\brief Returns the index of the first character in `buffer` that does **not** satisfy the condition.
+     * \param[in] buffer The characters to validate.
+     * \returns The size of \p buffer if all characters satisfy the condition.
+     *
+     * \details
+     *
+     * This is the bulk counterpart of operator(): a whole line (or any other contiguous buffer) is
+     * classified chunk-wise via find_first_not_of(), so e.g. `is_in_alphabet<dna5>.validate(...)` checks
+     * the legality of a complete sequence line at close to memory speed instead of paying a table look-up
+     * and a branch per character.
+     */
+    size_t validate(std::span<char const> const buffer) const noexcept
+    {
+        return static_cast<size_t>(find_first_not_of(buffer.data(), buffer.data() + buffer.size()) - buffer.data());
+    }
+    //!\}
+
     /*!\name Output functions
      * \{
      */
@@ -258,6 +380,46 @@ struct parse_condition_base
         return derived_t::msg.string();
     }
     //!\}
+
+private:
+    /*!\brief Folds one half of the look-up table into a 16-entry nibble bitmask table.
+     * \param[in] upper_half Selects the characters >= 128 instead of those < 128.
+     *
+     * Entry `c & 0xF` of the returned table has bit `(c >> 4) & 7` set iff the condition holds for the
+     * character `c`; see find_first_not_of() for how it is evaluated.
+     */
+    static constexpr std::array<uint8_t, 16> nibble_bitmask_table(bool const upper_half) noexcept
+    {
+        std::array<uint8_t, 16> ret{};
+
+        for (size_t i = upper_half ? 128u : 0u; i < (upper_half ? 256u : 128u); ++i)
+            if (derived_t::data[i])
+                ret[i & 0xF] |= static_cast<uint8_t>(1u << ((i >> 4) & 7));
+
+        return ret;
+    }
+
+    //!\brief The number of characters (EOF excluded) that satisfy the condition.
+    static constexpr size_t matching_char_count() noexcept
+    {
+        size_t count = 0u;
+
+        for (size_t i = 0u; i < 256u; ++i)
+            if (derived_t::data[i])
+                ++count;
+
+        return count;
+    }
+
+    //!\brief The smallest character that satisfies the condition.
+    static constexpr char matching_char() noexcept
+    {
+        for (size_t i = 0u; i < 256u; ++i)
+            if (derived_t::data[i])
+                return static_cast<char>(i);
+
+        return '\0';
+    }
 };
 
 // ----------------------------------------------------------------------------
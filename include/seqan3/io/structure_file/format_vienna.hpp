@@ -29,6 +29,7 @@
 
 #include <seqan3/alphabet/structure/wuss.hpp>
 #include <seqan3/core/metafunction/range.hpp>
+#include <seqan3/io/detail/fast_istreambuf_iterator.hpp>
 #include <seqan3/io/detail/misc.hpp>
 #include <seqan3/io/stream/parse_condition.hpp>
 #include <seqan3/io/structure_file/detail.hpp>
@@ -129,8 +130,9 @@ public:
               comment_type & SEQAN3_DOXYGEN_ONLY(comment),
               offset_type & SEQAN3_DOXYGEN_ONLY(offset))
     {
-        using stream_it_t = std::istreambuf_iterator<typename stream_type::char_type>;
-        auto stream_view = std::ranges::subrange<stream_it_t, stream_it_t>{stream_it_t{stream}, stream_it_t{}};
+        using stream_it_t = detail::fast_istreambuf_iterator<typename stream_type::char_type>;
+        auto stream_view = std::ranges::subrange<stream_it_t, std::ranges::default_sentinel_t>
+                               {stream_it_t{*stream.rdbuf()}, std::ranges::default_sentinel};
 
         // READ ID (if present)
         auto constexpr is_id = is_char<'>'>;
@@ -202,7 +204,25 @@ public:
             {
                 assert(std::addressof(seq) == std::addressof(structure));
                 using alph_type = typename value_type_t<structure_type>::structure_alphabet_type;
-                std::ranges::copy(read_structure<alph_type>(stream_view), begin(structure));
+
+                if constexpr (std::Same<typename stream_type::char_type, char>)
+                {
+                    extract_structure_line<alph_type>(*stream.rdbuf());
+
+                    auto struct_it = begin(structure);
+                    for (char const c : structure_buffer)
+                    {
+                        if (struct_it == end(structure)) // more brackets than sequence characters
+                            throw parse_error{"Found sequence and associated structure of different length."};
+
+                        *struct_it = assign_char(alph_type{}, c);
+                        ++struct_it;
+                    }
+                }
+                else
+                {
+                    std::ranges::copy(read_structure<alph_type>(stream_view), begin(structure));
+                }
 
                 if constexpr (!detail::decays_to_ignore_v<bpp_type>)
                     detail::bpp_from_rna_structure<alph_type>(bpp, structure);
@@ -210,7 +230,18 @@ public:
             else
             {
                 using alph_type = value_type_t<structure_type>;
-                std::ranges::copy(read_structure<alph_type>(stream_view), std::back_inserter(structure));
+
+                if constexpr (std::Same<typename stream_type::char_type, char>)
+                {
+                    extract_structure_line<alph_type>(*stream.rdbuf());
+
+                    for (char const c : structure_buffer)
+                        structure.push_back(assign_char(alph_type{}, c));
+                }
+                else
+                {
+                    std::ranges::copy(read_structure<alph_type>(stream_view), std::back_inserter(structure));
+                }
 
                 if constexpr (!detail::decays_to_ignore_v<bpp_type>)
                     detail::bpp_from_rna_structure<alph_type>(bpp, structure);
@@ -221,7 +252,15 @@ public:
         }
         else if constexpr (!detail::decays_to_ignore_v<bpp_type>)
         {
-            detail::bpp_from_rna_structure<wuss51>(bpp, read_structure<wuss51>(stream_view));
+            if constexpr (std::Same<typename stream_type::char_type, char>)
+            {
+                extract_structure_line<wuss51>(*stream.rdbuf());
+                detail::bpp_from_rna_structure<wuss51>(bpp, structure_buffer | view::char_to<wuss51>);
+            }
+            else
+            {
+                detail::bpp_from_rna_structure<wuss51>(bpp, read_structure<wuss51>(stream_view));
+            }
 
             if constexpr (!detail::decays_to_ignore_v<seq_type>)
                 if (size(seq) != size(bpp))
@@ -276,46 +315,46 @@ public:
                comment_type && SEQAN3_DOXYGEN_ONLY(comment),
                offset_type && SEQAN3_DOXYGEN_ONLY(offset))
     {
-        std::ranges::ostreambuf_iterator stream_it{stream};
-
-        // WRITE ID (optional)
-        if constexpr (!detail::decays_to_ignore_v<id_type>)
+        auto write_impl = [&] (auto & stream_it)
         {
-            if (!empty(id))
+            // WRITE ID (optional)
+            if constexpr (!detail::decays_to_ignore_v<id_type>)
             {
-                stream_it = '>';
-                stream_it = ' ';
-                std::ranges::copy(id, stream_it);
-                detail::write_eol(stream_it, options.add_carriage_return);
+                if (!empty(id))
+                {
+                    stream_it = '>';
+                    stream_it = ' ';
+                    std::ranges::copy(id, stream_it);
+                    detail::write_eol(stream_it, options.add_carriage_return);
+                }
             }
-        }
 
-        // WRITE SEQUENCE
-        if constexpr (!detail::decays_to_ignore_v<seq_type>)
-        {
-            if (empty(seq)) //[[unlikely]]
-                throw std::runtime_error{"The SEQ field may not be empty when writing Vienna files."};
-
-            std::ranges::copy(seq | view::to_char, stream_it);
-            detail::write_eol(stream_it, options.add_carriage_return);
-        }
-        else
-        {
-            throw std::logic_error{"The SEQ and STRUCTURED_SEQ fields may not both be set to ignore "
-                                   "when writing Vienna files."};
-        }
+            // WRITE SEQUENCE
+            if constexpr (!detail::decays_to_ignore_v<seq_type>)
+            {
+                if (empty(seq)) //[[unlikely]]
+                    throw std::runtime_error{"The SEQ field may not be empty when writing Vienna files."};
 
-        // WRITE STRUCTURE (optional)
-        if constexpr (!detail::decays_to_ignore_v<structure_type>)
-        {
-            if (!empty(structure))
-                std::ranges::copy(structure | view::to_char, stream_it);
+                std::ranges::copy(seq | view::to_char, stream_it);
+                detail::write_eol(stream_it, options.add_carriage_return);
+            }
+            else
+            {
+                throw std::logic_error{"The SEQ and STRUCTURED_SEQ fields may not both be set to ignore "
+                                       "when writing Vienna files."};
+            }
 
-            // WRITE ENERGY (optional)
-            if constexpr (!detail::decays_to_ignore_v<energy_type>)
+            // WRITE STRUCTURE (optional)
+            if constexpr (!detail::decays_to_ignore_v<structure_type>)
             {
-                if (energy)
+                if (!empty(structure))
+                    std::ranges::copy(structure | view::to_char, stream_it);
+
+                // WRITE ENERGY (optional)
+                if constexpr (!detail::decays_to_ignore_v<energy_type>)
                 {
+                    if (energy)
+                    {
 // TODO(joergi-w) enable the following when std::to_chars is implemented for float types
 //                    auto [endptr, ec] = std::to_chars(str.data(),
 //                                                      str.data() + str.size(),
@@ -327,23 +366,40 @@ public:
 //                    else
 //                        throw std::runtime_error{"The energy could not be transformed into a string."};
 
-                    stream_it = ' ';
-                    stream_it = '(';
+                        stream_it = ' ';
+                        stream_it = '(';
 
-                    std::array<char, 100> str;
-                    int len = std::snprintf(str.data(), 100, "%.*f", options.precision, energy);
-                    if (len < 0 || len >= 100)
-                        throw std::runtime_error{"The energy could not be transformed into a string."};
-                    std::ranges::copy(str.data(), str.data() + len, stream_it);
+                        std::array<char, 100> str;
+                        int len = std::snprintf(str.data(), 100, "%.*f", options.precision, energy);
+                        if (len < 0 || len >= 100)
+                            throw std::runtime_error{"The energy could not be transformed into a string."};
+                        std::ranges::copy(str.data(), str.data() + len, stream_it);
 
-                    stream_it = ')';
+                        stream_it = ')';
+                    }
                 }
+                detail::write_eol(stream_it, options.add_carriage_return);
+            }
+            else if constexpr (!detail::decays_to_ignore_v<energy_type>)
+            {
+                throw std::logic_error{"The ENERGY field cannot be written to a Vienna file without "
+                                       "providing STRUCTURE."};
             }
-            detail::write_eol(stream_it, options.add_carriage_return);
+        };
+
+        if constexpr (sizeof(typename stream_type::char_type) == 1)
+        {
+            // Assemble the whole record in a reused scratch buffer and hand it to the stream buffer with a
+            // single sputn call; this is notably faster than pushing single characters through the iterator.
+            write_buffer.clear();
+            auto buffer_it = std::back_insert_iterator{write_buffer};
+            write_impl(buffer_it);
+            stream.rdbuf()->sputn(write_buffer.data(), write_buffer.size());
         }
-        else if constexpr (!detail::decays_to_ignore_v<energy_type>)
+        else // wide streams perform the character conversion inside the iterator
         {
-            throw std::logic_error{"The ENERGY field cannot be written to a Vienna file without providing STRUCTURE."};
+            std::ranges::ostreambuf_iterator stream_it{stream};
+            write_impl(stream_it);
         }
     }
 
@@ -373,6 +429,78 @@ private:
                              })                                  // enforce legal alphabet
                            | view::char_to<alph_type>;           // convert to actual target alphabet
     }
+
+    /*!\brief Extract the structure line from the stream into \ref structure_buffer and validate it.
+     * \tparam alph_type   The structure alphabet the characters must be valid for.
+     * \tparam streambuf_t The type of the stream buffer.
+     * \param[in,out] streambuf The stream buffer, positioned on the first structure character.
+     * \throws seqan3::parse_error if a character is not valid for `alph_type`.
+     *
+     * \details
+     *
+     * The line is copied out of the stream buffer's get area in whole chunks (instead of
+     * character-by-character through an iterator pipeline); it ends at the first whitespace, which is
+     * left in the stream. Validation runs separately over the extracted buffer in fixed-size blocks of
+     * branch-free table lookups — a form the compiler can turn into SIMD compares — and only a block
+     * that contains an invalid character is rescanned to report the exact position.
+     */
+    template <typename alph_type, typename streambuf_t>
+    void extract_structure_line(streambuf_t & streambuf)
+    {
+        auto * buf = reinterpret_cast<detail::stream_buffer_exposer<char> *>(&streambuf);
+
+        structure_buffer.clear();
+
+        while (true)
+        {
+            if (buf->gptr() == buf->egptr()) // get area exhausted, refill it
+            {
+                if (std::char_traits<char>::eq_int_type(buf->sgetc(), std::char_traits<char>::eof()))
+                    break; // the structure may be the last line of the file
+            }
+
+            char const * const first = buf->gptr();
+            char const * hit = first;
+            while ((hit != buf->egptr()) && !is_space(*hit))
+                ++hit;
+
+            structure_buffer.append(first, hit);
+            buf->gbump(hit - first);
+
+            if (hit != buf->egptr()) // the stream is now positioned on the terminating whitespace
+                break;
+        }
+
+        auto constexpr is_legal_structure = is_in_alphabet<alph_type>;
+        static constexpr size_t block_size = 64;
+
+        size_t pos = 0;
+        for (; pos + block_size <= structure_buffer.size(); pos += block_size)
+        {
+            uint8_t block_valid = 1u;
+            for (size_t i = 0; i < block_size; ++i) // fixed length and branch-free, so that it vectorises
+                block_valid &= static_cast<uint8_t>(is_legal_structure(structure_buffer[pos + i]));
+
+            if (!block_valid)
+                break; // the loop below pinpoints the offending character
+        }
+
+        for (; pos < structure_buffer.size(); ++pos)
+        {
+            if (!is_legal_structure(structure_buffer[pos]))
+            {
+                throw parse_error{std::string{"Encountered an unexpected letter: "} +
+                                  is_legal_structure.msg.string() +
+                                  " evaluated to false on " + detail::make_printable(structure_buffer[pos])};
+            }
+        }
+    }
+
+    //!\brief Scratch buffer for extract_structure_line(); reused across records.
+    std::string structure_buffer{};
+
+    //!\brief Scratch buffer that write() assembles one record in before flushing it; reused across records.
+    std::string write_buffer{};
 };
 
 } // namespace seqan3
@@ -15,6 +15,7 @@
 #include <cassert>
 #include <fstream>
 #include <limits>
+#include <memory>
 #include <optional>
 #include <string>
 #include <type_traits>
@@ -37,6 +38,7 @@
 #include <seqan3/io/detail/in_file_iterator.hpp>
 #include <seqan3/io/detail/misc_input.hpp>
 #include <seqan3/io/detail/record.hpp>
+#include <seqan3/io/detail/record_prefetcher.hpp>
 #include <seqan3/io/structure_file/input_format_concept.hpp>
 #include <seqan3/io/structure_file/input_options.hpp>
 #include <seqan3/io/structure_file/format_vienna.hpp>
@@ -925,6 +927,27 @@ public:
     }
     //!\}
 
+    /*!\brief Parse subsequent records on a background thread, keeping up to `depth` records ready.
+     * \param[in] depth The maximum number of records parsed ahead of the consumer.
+     *
+     * \details
+     *
+     * Record parsing then overlaps with the consumer's per-record work — the iterator interface is
+     * unchanged, operator++ hands out the next prefetched record (blocking only if the parser has not
+     * caught up yet).
+     *
+     * Parse errors surface on the consuming thread in file order, just like in sequential mode.
+     * Set all options before calling this — the stream belongs to the background thread from here on.
+     */
+    void prefetch(size_t const depth = 4)
+    {
+        if ((prefetcher != nullptr) || at_end)
+            return;
+
+        prefetcher = std::make_unique<detail::record_prefetcher<record_type>>(depth,
+            [this] (record_type & rec) { return read_next_record_sequential(rec); });
+    }
+
     //!\brief The options are public and its members can be set directly.
     structure_file_input_options<typename traits_type::seq_legal_alphabet,
                                  selected_field_ids::contains(field::STRUCTURED_SEQ)> options;
@@ -963,20 +986,41 @@ protected:
     using format_type = detail::transfer_template_args_onto_t<valid_formats, std::variant>;
     //!\brief The actual std::variant holding a pointer to the detected/selected format.
     format_type format;
+
+    /*!\brief The background-thread ring buffer created by prefetch() (`nullptr` while inactive).
+     * Declared after the stream members so that the thread is joined before the stream is destroyed.
+     */
+    std::unique_ptr<detail::record_prefetcher<record_type>> prefetcher{nullptr};
     //!\}
 
     //!\brief Tell the format to move to the next record and update the buffer.
     void read_next_record()
+    {
+        if (prefetcher != nullptr)
+        {
+            at_end = !prefetcher->pop(record_buffer);
+            return;
+        }
+
+        at_end = !read_next_record_sequential(record_buffer);
+    }
+
+    /*!\brief Parse the next record from the stream into `rec`.
+     * \returns `false` if the stream holds no further record, `true` otherwise.
+     *
+     * Called on the consuming thread in sequential mode and on the background thread when prefetch()
+     * is active (then `rec` is the prefetcher's scratch record, not \ref record_buffer).
+     */
+    bool read_next_record_sequential(record_type & rec)
     {
         // clear the record
-        record_buffer.clear();
+        rec.clear();
 
         // at end if we could not read further
         if ((std::istreambuf_iterator<stream_char_type>{*secondary_stream} ==
              std::istreambuf_iterator<stream_char_type>{}))
         {
-            at_end = true;
-            return;
+            return false;
         }
 
         assert(!format.valueless_by_exception());
@@ -991,31 +1035,33 @@ protected:
                               "You may not select field::STRUCTURED_SEQ and field::SEQ at the same time.");
                 f.read(*secondary_stream,
                        options,
-                       detail::get_or_ignore<field::STRUCTURED_SEQ>(record_buffer), // seq
-                       detail::get_or_ignore<field::ID>(record_buffer),
-                       detail::get_or_ignore<field::BPP>(record_buffer),
-                       detail::get_or_ignore<field::STRUCTURED_SEQ>(record_buffer), // structure
-                       detail::get_or_ignore<field::ENERGY>(record_buffer),
-                       detail::get_or_ignore<field::REACT>(record_buffer),
-                       detail::get_or_ignore<field::REACT_ERR>(record_buffer),
-                       detail::get_or_ignore<field::COMMENT>(record_buffer),
-                       detail::get_or_ignore<field::OFFSET>(record_buffer));
+                       detail::get_or_ignore<field::STRUCTURED_SEQ>(rec), // seq
+                       detail::get_or_ignore<field::ID>(rec),
+                       detail::get_or_ignore<field::BPP>(rec),
+                       detail::get_or_ignore<field::STRUCTURED_SEQ>(rec), // structure
+                       detail::get_or_ignore<field::ENERGY>(rec),
+                       detail::get_or_ignore<field::REACT>(rec),
+                       detail::get_or_ignore<field::REACT_ERR>(rec),
+                       detail::get_or_ignore<field::COMMENT>(rec),
+                       detail::get_or_ignore<field::OFFSET>(rec));
             }
             else
             {
                 f.read(*secondary_stream,
                        options,
-                       detail::get_or_ignore<field::SEQ>(record_buffer),
-                       detail::get_or_ignore<field::ID>(record_buffer),
-                       detail::get_or_ignore<field::BPP>(record_buffer),
-                       detail::get_or_ignore<field::STRUCTURE>(record_buffer),
-                       detail::get_or_ignore<field::ENERGY>(record_buffer),
-                       detail::get_or_ignore<field::REACT>(record_buffer),
-                       detail::get_or_ignore<field::REACT_ERR>(record_buffer),
-                       detail::get_or_ignore<field::COMMENT>(record_buffer),
-                       detail::get_or_ignore<field::OFFSET>(record_buffer));
+                       detail::get_or_ignore<field::SEQ>(rec),
+                       detail::get_or_ignore<field::ID>(rec),
+                       detail::get_or_ignore<field::BPP>(rec),
+                       detail::get_or_ignore<field::STRUCTURE>(rec),
+                       detail::get_or_ignore<field::ENERGY>(rec),
+                       detail::get_or_ignore<field::REACT>(rec),
+                       detail::get_or_ignore<field::REACT_ERR>(rec),
+                       detail::get_or_ignore<field::COMMENT>(rec),
+                       detail::get_or_ignore<field::OFFSET>(rec));
             }
         }, format);
+
+        return true;
     }
 
     //!\brief Read the entire file into the internal column buffers.
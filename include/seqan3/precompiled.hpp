@@ -0,0 +1,83 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Extern-template declarations for the pre-instantiation library (see SEQAN3_PRECOMPILED).
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_edit.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_unbanded.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/core/metafunction/basic.hpp>
+#include <seqan3/search/fm_index/all.hpp>
+
+/*!\def SEQAN3_PRECOMPILED
+ * \brief Whether the common template instantiations come from the pre-instantiation library (default: undefined).
+ * \ingroup core
+ *
+ * \details
+ *
+ * SeqAn3 is header-only, so every translation unit that uses e.g. seqan3::fm_index over `std::vector<dna4>`
+ * re-instantiates and re-optimises the same templates. Linking against the optional static library built by
+ * the `SEQAN3_PRECOMPILED_LIB` CMake option (which defines this macro on its interface) turns the
+ * instantiations listed in this header into extern-template declarations, so the compiler skips their
+ * codegen in your translation units and the linker provides the single copy from the library — reducing
+ * both compile times and the instruction-cache footprint of duplicated kernels.
+ *
+ * Do not define this macro manually without linking the library, otherwise the instantiations are missing
+ * at link time.
+ */
+
+#if defined(SEQAN3_PRECOMPILED) || defined(SEQAN3_PRECOMPILED_DEFINE)
+
+//!\cond
+// The same list serves as extern-template declarations in user code and as explicit instantiation
+// definitions in the library's translation unit (src/precompiled.cpp defines SEQAN3_PRECOMPILED_DEFINE).
+#if defined(SEQAN3_PRECOMPILED_DEFINE)
+#define SEQAN3_PRECOMPILED_TEMPLATE template
+#else
+#define SEQAN3_PRECOMPILED_TEMPLATE extern template
+#endif
+//!\endcond
+
+namespace seqan3::detail
+{
+//!\brief The configuration type of seqan3::align_cfg::edit, nameable for explicit instantiation.
+//!\ingroup core
+using precompiled_edit_config_t = remove_cvref_t<decltype(align_cfg::edit)>;
+} // namespace seqan3::detail
+
+// Indices over the common alphabets, as single texts and text collections.
+SEQAN3_PRECOMPILED_TEMPLATE class seqan3::fm_index<std::vector<seqan3::dna4>>;
+SEQAN3_PRECOMPILED_TEMPLATE class seqan3::fm_index<std::vector<seqan3::dna5>>;
+SEQAN3_PRECOMPILED_TEMPLATE class seqan3::fm_index<std::vector<seqan3::aa27>>;
+SEQAN3_PRECOMPILED_TEMPLATE class seqan3::fm_index<std::vector<std::vector<seqan3::dna4>>>;
+SEQAN3_PRECOMPILED_TEMPLATE class seqan3::fm_index<std::vector<std::vector<seqan3::dna5>>>;
+SEQAN3_PRECOMPILED_TEMPLATE class seqan3::bi_fm_index<std::vector<seqan3::dna4>>;
+SEQAN3_PRECOMPILED_TEMPLATE class seqan3::bi_fm_index<std::vector<seqan3::dna5>>;
+
+// The cursors driving the search traversal over those indices.
+SEQAN3_PRECOMPILED_TEMPLATE class seqan3::fm_index_cursor<seqan3::fm_index<std::vector<seqan3::dna4>>>;
+SEQAN3_PRECOMPILED_TEMPLATE class seqan3::fm_index_cursor<seqan3::fm_index<std::vector<seqan3::dna5>>>;
+SEQAN3_PRECOMPILED_TEMPLATE class seqan3::bi_fm_index_cursor<seqan3::bi_fm_index<std::vector<seqan3::dna4>>>;
+SEQAN3_PRECOMPILED_TEMPLATE class seqan3::bi_fm_index_cursor<seqan3::bi_fm_index<std::vector<seqan3::dna5>>>;
+
+// The edit distance kernel over the common nucleotide alphabets.
+SEQAN3_PRECOMPILED_TEMPLATE class seqan3::detail::pairwise_alignment_edit_distance_unbanded<
+    std::vector<seqan3::dna4> const &, std::vector<seqan3::dna4> const &, seqan3::detail::precompiled_edit_config_t>;
+SEQAN3_PRECOMPILED_TEMPLATE class seqan3::detail::pairwise_alignment_edit_distance_unbanded<
+    std::vector<seqan3::dna5> const &, std::vector<seqan3::dna5> const &, seqan3::detail::precompiled_edit_config_t>;
+
+#undef SEQAN3_PRECOMPILED_TEMPLATE
+
+#endif // defined(SEQAN3_PRECOMPILED) || defined(SEQAN3_PRECOMPILED_DEFINE)
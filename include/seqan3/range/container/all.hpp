@@ -14,9 +14,19 @@
 
 #include <seqan3/range/container/aligned_allocator.hpp>
 #include <seqan3/range/container/bitcompressed_vector.hpp>
+#include <seqan3/range/container/bitcompressed_vector_mmap.hpp>
 #include <seqan3/range/container/concatenated_sequences.hpp>
+#include <seqan3/range/container/concatenated_sequences_mmap.hpp>
 #include <seqan3/range/container/concept.hpp>
 #include <seqan3/range/container/constexpr_string.hpp>
+#include <seqan3/range/container/hugepage_allocator.hpp>
+#include <seqan3/range/container/interleaved_sequences.hpp>
+#include <seqan3/range/container/masked_vector.hpp>
+#include <seqan3/range/container/mmap_vector.hpp>
+#include <seqan3/range/container/pool_allocator.hpp>
+#include <seqan3/range/container/twobit_vector.hpp>
+#include <seqan3/range/container/qualified_vector.hpp>
+#include <seqan3/range/container/uint_vector.hpp>
 
 /*!\defgroup container Container
  * \brief The container submodule contains special SeqAn3 containers and generic container concepts.
@@ -12,6 +12,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
 #include <type_traits>
 
 #include <sdsl/int_vector.hpp>
@@ -75,12 +78,26 @@ private:
 
     static_assert(bits_per_letter <= 64, "Alphabet must be representable in at most 64bit.");
 
+    //!\brief The number of letters that fit into a single 64bit word of the underlying storage
+    //!       (0 if single letters straddle word boundaries, in which case bulk operations fall back to
+    //!       the element-wise path).
+    static constexpr size_t letters_per_word = (64 % bits_per_letter == 0) ? 64 / bits_per_letter : 0;
+
     //!\brief Type of the underlying SDSL vector.
     using data_type = sdsl::int_vector<bits_per_letter>;
 
     //!\brief The data storage.
     data_type data;
 
+    //!\brief Whether push_back() buffers letters uncompressed before packing them into #data; only worthwhile
+    //!       for sub-byte alphabets where storing a single letter means bit surgery on the containing word.
+    static constexpr bool has_tail_buffer = (letters_per_word > 0) && (bits_per_letter < 8);
+
+    //!\brief Letter ranks appended via push_back() but not yet packed into #data.
+    std::array<uint8_t, has_tail_buffer ? letters_per_word : 1> tail{};
+    //!\brief The number of valid letters in #tail.
+    size_type_t<data_type> tail_size{0};
+
     //!\brief Proxy data type returned by seqan3::bitcompressed_vector as reference to element unless the alphabet_type
     //!       is uint8_t, uint16_t, uint32_t or uint64_t (in which case a regular & is returned).
     class reference_proxy_type : public alphabet_proxy<reference_proxy_type, alphabet_type>
@@ -140,6 +157,112 @@ private:
     static constexpr bool has_same_value_type_v = true;
     //!\endcond
 
+    /*!\brief Append `count` letters read from `it` by packing #letters_per_word ranks into each 64bit word.
+     * \tparam begin_iterator_type Must satisfy std::ForwardIterator.
+     * \param[in] it    Iterator to the first letter to append.
+     * \param[in] count Number of letters to append.
+     *
+     * Instead of routing every letter through the sdsl-proxy (a masked read-modify-write on the containing
+     * word), this accumulates the ranks of #letters_per_word letters into a single 64bit word with shifts
+     * and stores the finished word with one write. Letters before the first and behind the last word
+     * boundary are written through the proxy as before.
+     *
+     * Only available if single letters do not straddle word boundaries (see #letters_per_word).
+     */
+    template <std::ForwardIterator begin_iterator_type>
+    void append_packed(begin_iterator_type it, size_type_t<data_type> const count)
+    //!\cond
+        requires letters_per_word > 0
+    //!\endcond
+    {
+        size_type const old_size = size();
+        size_type const new_size = old_size + count;
+        data.resize(new_size);
+
+        uint64_t * const words = data.data(); // only valid after the resize above
+        size_type i = old_size;
+
+        // proxy-writes until the next word boundary (also clears stale bits possibly left by resize())
+        for (; (i % letters_per_word != 0) && (i < new_size); ++i, ++it)
+            data[i] = to_rank(static_cast<value_type>(*it));
+
+        // pack letters_per_word ranks per word and store each finished word in one go
+        for (; i + letters_per_word <= new_size; i += letters_per_word)
+        {
+            uint64_t word = 0;
+            for (size_type l = 0; l < letters_per_word; ++l, ++it)
+                word |= static_cast<uint64_t>(to_rank(static_cast<value_type>(*it))) << (l * bits_per_letter);
+            words[i / letters_per_word] = word;
+        }
+
+        // trailing letters that do not fill a whole word
+        for (; i < new_size; ++i, ++it)
+            data[i] = to_rank(static_cast<value_type>(*it));
+    }
+
+    /*!\brief Pack the letters buffered in #tail into #data (no-op if the tail is empty).
+     *
+     * In the common streaming case #data ends at a word boundary and the tail is full, so the buffered
+     * ranks are combined into a single 64bit word and stored with one write; otherwise they are written
+     * through the proxy one-by-one.
+     */
+    void flush_tail()
+    {
+        if constexpr (has_tail_buffer)
+        {
+            if (tail_size == 0)
+                return;
+
+            size_type const old_size = data.size();
+
+            if (data.capacity() < old_size + tail_size) // grow geometrically like data.push_back() would
+                data.reserve(std::max<size_type>(old_size + tail_size, 2 * data.capacity()));
+            data.resize(old_size + tail_size);
+
+            if ((old_size % letters_per_word == 0) && (tail_size == letters_per_word))
+            {
+                uint64_t word = 0;
+                for (size_t l = 0; l < letters_per_word; ++l)
+                    word |= uint64_t{tail[l]} << (l * bits_per_letter);
+                data.data()[old_size / letters_per_word] = word;
+            }
+            else // partially filled tail or unaligned boundary, e.g. right after resize() or insert()
+            {
+                for (size_t l = 0; l < tail_size; ++l)
+                    data[old_size + l] = tail[l];
+            }
+
+            tail_size = 0;
+        }
+    }
+
+    //!\brief Return the rank of the i-th letter, also resolving letters still buffered in #tail.
+    uint64_t rank_at(size_type_t<data_type> const i) const noexcept
+    {
+        if constexpr (has_tail_buffer)
+            if (i >= data.size())
+                return tail[i - data.size()];
+        return data[i];
+    }
+
+    //!\brief Lexicographic three-way comparison on the letter ranks; used by the comparison operators
+    //!       whenever an unflushed #tail prevents comparing #data directly.
+    int compare_letter_wise(bitcompressed_vector const & rhs) const noexcept
+    {
+        size_type const common = std::min<size_type>(size(), rhs.size());
+        for (size_type i = 0; i < common; ++i)
+        {
+            uint64_t const l = rank_at(i);
+            uint64_t const r = rhs.rank_at(i);
+            if (l != r)
+                return l < r ? -1 : 1;
+        }
+
+        if (size() != rhs.size())
+            return size() < rhs.size() ? -1 : 1;
+        return 0;
+    }
+
 public:
     /*!\name Associated types
      * \{
@@ -167,6 +290,152 @@ public:
     using allocator_type    = void;
     //!\endcond
 
+    /*!\brief A read-only iterator that decodes the packed storage in blocks instead of letter-by-letter.
+     *
+     * Every dereference of #const_iterator performs a shift-and-mask extraction on the containing 64bit
+     * word; scanning a long sequence this way loads and masks the same word once per letter. This iterator
+     * instead unpacks up to 64 letters at a time into a small stack buffer — one word load plus
+     * #letters_per_word shifts per word — and serves subsequent dereferences straight from the buffer,
+     * which makes sequential scans severalfold faster.
+     *
+     * The iterator models std::ForwardIterator (copies are independent, multiple passes are fine), but not
+     * std::RandomAccessIterator — use #const_iterator when you need to jump. Like #const_iterator it reads
+     * letters still buffered by push_back() correctly, but it is invalidated by **any** call to a non-`const`
+     * member function of the container.
+     */
+    class block_iterator
+    {
+    private:
+        //!\brief The number of letters decoded per refill.
+        static constexpr size_type_t<data_type> block_size = 64;
+
+        //!\brief The container we iterate over (nullptr only for default-initialised iterators).
+        bitcompressed_vector const * host{nullptr};
+        //!\brief Index of the first buffered letter in the container.
+        size_type_t<data_type> pos{0};
+        //!\brief Index of the current letter within #buffer.
+        size_type_t<data_type> buf_pos{0};
+        //!\brief The number of valid letters in #buffer.
+        size_type_t<data_type> buf_len{0};
+        //!\brief The decoded letters.
+        std::array<alphabet_type, block_size> buffer{};
+
+        //!\brief Decode the next (up to) #block_size letters beginning at #pos into #buffer.
+        void refill() noexcept
+        {
+            buf_pos = 0;
+            buf_len = std::min<size_type_t<data_type>>(block_size, host->size() - pos);
+
+            size_type_t<data_type> i = 0;
+
+            if constexpr (letters_per_word > 1) // unpack whole words with one load + shifts per word
+            {
+                size_type_t<data_type> const packed_count = // letters in #data (as opposed to #tail)
+                    std::min<size_type_t<data_type>>(buf_len, host->data.size() - std::min(pos, host->data.size()));
+                uint64_t const * const words = host->data.data();
+                constexpr uint64_t mask = (uint64_t{1} << bits_per_letter) - 1;
+
+                // proxy-reads until the next word boundary
+                for (; (i < packed_count) && ((pos + i) % letters_per_word != 0); ++i)
+                    buffer[i] = assign_rank(alphabet_type{}, host->data[pos + i]);
+
+                for (; i + letters_per_word <= packed_count;)
+                {
+                    uint64_t word = words[(pos + i) / letters_per_word];
+                    for (size_type_t<data_type> l = 0; l < letters_per_word; ++l, ++i)
+                    {
+                        buffer[i] = assign_rank(alphabet_type{}, word & mask);
+                        word >>= bits_per_letter;
+                    }
+                }
+            }
+
+            // trailing letters that do not fill a whole word and letters buffered in #tail
+            for (; i < buf_len; ++i)
+                buffer[i] = assign_rank(alphabet_type{}, host->rank_at(pos + i));
+        }
+
+        //!\brief Befriend the container so that block_begin() and block_end() can use the private constructor.
+        friend bitcompressed_vector;
+
+        //!\brief Construct positioned at index `index` of `cont` (used by block_begin() and block_end()).
+        explicit block_iterator(bitcompressed_vector const & cont, size_type_t<data_type> const index = 0) noexcept :
+            host{&cont}, pos{index}
+        {
+            if (pos < host->size())
+                refill();
+        }
+
+    public:
+        /*!\name Associated types
+         * \{
+         */
+        //!\brief Equals the alphabet_type.
+        using value_type        = alphabet_type;
+        //!\brief Letters are returned by value from the decode buffer.
+        using reference         = alphabet_type;
+        //!\brief There is no operator->, the pointer type is void.
+        using pointer           = void;
+        //!\brief A signed integer type.
+        using difference_type   = difference_type_t<data_type>;
+        //!\brief The iterator is multi-pass, but cannot jump.
+        using iterator_category = std::forward_iterator_tag;
+        //!\}
+
+        /*!\name Constructors, destructor and assignment
+         * \brief All are explicitly defaulted; a default-initialised iterator may only be assigned to.
+         * \{
+         */
+        block_iterator() = default;
+        block_iterator(block_iterator const &) = default;
+        block_iterator(block_iterator &&) = default;
+        block_iterator & operator=(block_iterator const &) = default;
+        block_iterator & operator=(block_iterator &&) = default;
+        ~block_iterator() = default;
+        //!\}
+
+        //!\brief Return the current letter (from the decode buffer).
+        reference operator*() const noexcept
+        {
+            assert(buf_pos < buf_len);
+            return buffer[buf_pos];
+        }
+
+        //!\brief Advance to the next letter, refilling the decode buffer at block boundaries.
+        block_iterator & operator++() noexcept
+        {
+            if (++buf_pos == buf_len)
+            {
+                pos += buf_len;
+                if (pos < host->size())
+                    refill();
+                else
+                    buf_pos = buf_len = 0; // reached end()
+            }
+            return *this;
+        }
+
+        //!\brief Advance to the next letter (post-increment).
+        block_iterator operator++(int) noexcept
+        {
+            block_iterator tmp{*this};
+            ++*this;
+            return tmp;
+        }
+
+        //!\brief Checks whether `*this` and `rhs` point to the same letter.
+        bool operator==(block_iterator const & rhs) const noexcept
+        {
+            return (pos + buf_pos) == (rhs.pos + rhs.buf_pos);
+        }
+
+        //!\brief Checks whether `*this` and `rhs` point to different letters.
+        bool operator!=(block_iterator const & rhs) const noexcept
+        {
+            return !(*this == rhs);
+        }
+    };
+
     /*!\name Constructors, destructor and assignment
      * \{
      */
@@ -416,6 +685,46 @@ public:
     {
         return const_iterator{*this, size()};
     }
+
+    /*!\brief Returns a read-only, block-decoding iterator to the first element of the container.
+     * \returns Iterator to the first element, see #block_iterator.
+     *
+     * Prefer this iterator pair over begin()/end() for long sequential scans, e.g. k-mer extraction;
+     * it decodes 64 letters per step into a stack buffer instead of extracting every letter from its
+     * packed word individually.
+     *
+     * If the container is empty, the returned iterator will be equal to block_end().
+     *
+     * ### Complexity
+     *
+     * Constant (the first block is decoded on construction).
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    block_iterator block_begin() const noexcept
+    {
+        return block_iterator{*this};
+    }
+
+    /*!\brief Returns a read-only, block-decoding iterator to the element following the last element.
+     * \returns Iterator behind the last element, see #block_iterator.
+     *
+     * This element acts as a placeholder; attempting to dereference it results in undefined behaviour.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    block_iterator block_end() const noexcept
+    {
+        return block_iterator{*this, size()};
+    }
     //!\}
 
     /*!\name Element access
@@ -462,15 +771,18 @@ public:
      *
      * ### Complexity
      *
-     * Constant.
+     * Constant (amortised; letters buffered by push_back() may need to be packed into the underlying storage
+     * first).
      *
      * ### Exceptions
      *
-     * No-throw guarantee.
+     * Throws only if packing buffered letters requires an allocation and that allocation fails; the `const`
+     * overload never throws.
      */
-    reference operator[](size_type const i) noexcept
+    reference operator[](size_type const i)
     {
         assert(i < size());
+        flush_tail(); // we need to hand out a proxy into the packed storage
         return data[i];
     }
 
@@ -478,7 +790,7 @@ public:
     const_reference operator[](size_type const i) const noexcept
     {
         assert(i < size());
-        return assign_rank(const_reference{}, data[i]);
+        return assign_rank(const_reference{}, rank_at(i));
     }
 
     /*!\brief Return the first element. Calling front on an empty container is undefined.
@@ -492,9 +804,9 @@ public:
      *
      * ### Exceptions
      *
-     * No-throw guarantee.
+     * Same as operator[]() (the `const` overload never throws).
      */
-    reference front() noexcept
+    reference front()
     {
         assert(size() > 0);
         return (*this)[0];
@@ -518,9 +830,9 @@ public:
      *
      * ### Exceptions
      *
-     * No-throw guarantee.
+     * Same as operator[]() (the `const` overload never throws).
      */
-    reference back() noexcept
+    reference back()
     {
         assert(size() > 0);
         return (*this)[size()-1];
@@ -565,7 +877,7 @@ public:
      */
     size_type size() const noexcept
     {
-        return data.size();
+        return data.size() + tail_size;
     }
 
     /*!\brief Returns the maximum number of elements the container is able to hold due to system or library
@@ -604,7 +916,7 @@ public:
      */
     size_type capacity() const noexcept
     {
-        return data.capacity();
+        return std::max<size_type>(data.capacity(), size()); // letters may still be buffered in #tail
     }
 
     /*!\brief Increase the capacity to a value that's greater or equal to new_cap.
@@ -647,6 +959,7 @@ public:
      */
     void shrink_to_fit()
     {
+        flush_tail();
         data.shrink_to_fit();
     }
     //!\}
@@ -667,6 +980,7 @@ public:
      */
     void clear() noexcept
     {
+        tail_size = 0;
         data.clear();
     }
 
@@ -716,6 +1030,7 @@ public:
     {
         auto const pos_as_num = std::distance(cbegin(), pos); // we want to insert BEFORE this position
 
+        flush_tail();
         data.insert(data.begin() + pos_as_num, count, to_rank(value));
 
         return begin() + pos_as_num;
@@ -736,6 +1051,10 @@ public:
      * than capacity(), all iterators and references are invalidated. Otherwise, only the iterators and
      * references before the insertion point remain valid. The past-the-end iterator is also invalidated.
      *
+     * If `pos == cend()`, the distance between the iterators is computable and single letters do not straddle
+     * 64bit word boundaries, the letters are packed into whole words instead of being written one-by-one
+     * (the constructors and assign() delegate to this case).
+     *
      * ### Complexity
      *
      * Worst-case linear in size().
@@ -753,6 +1072,17 @@ public:
     {
         auto const pos_as_num = std::distance(cbegin(), pos);
 
+        flush_tail();
+
+        if constexpr ((letters_per_word > 0) && std::SizedSentinel<end_iterator_type, begin_iterator_type>)
+        {
+            if (pos == cend()) // appending at the end allows packing whole words instead of single letters
+            {
+                append_packed(begin_it, static_cast<size_type>(end_it - begin_it));
+                return begin() + pos_as_num;
+            }
+        }
+
         auto v = std::ranges::subrange<begin_iterator_type, end_iterator_type>{begin_it, end_it}
                | view::convert<value_type>
                | view::to_rank;
@@ -811,6 +1141,7 @@ public:
         auto const begin_it_pos = std::distance(cbegin(), begin_it);
         auto const end_it_pos = std::distance(cbegin(), end_it);
 
+        flush_tail();
         data.erase(data.cbegin() + begin_it_pos,
                    data.cbegin() + end_it_pos);
 
@@ -847,6 +1178,10 @@ public:
      * If the new size() is greater than capacity() then all iterators and references (including the past-the-end
      * iterator) are invalidated. Otherwise only the past-the-end iterator is invalidated.
      *
+     * For sub-byte alphabets the letter is first stored uncompressed in a small internal buffer which is
+     * packed into the bit-compressed storage one whole 64bit word at a time, so consecutive calls do not pay
+     * a read-modify-write on the containing word each.
+     *
      * ### Complexity
      *
      * Amortised constant, worst-case linear in size().
@@ -858,7 +1193,16 @@ public:
      */
     void push_back(value_type const value)
     {
-        data.push_back(to_rank(value));
+        if constexpr (has_tail_buffer)
+        {
+            tail[tail_size++] = to_rank(value);
+            if (tail_size == letters_per_word)
+                flush_tail();
+        }
+        else
+        {
+            data.push_back(to_rank(value));
+        }
     }
 
     /*!\brief Removes the last element of the container.
@@ -880,6 +1224,14 @@ public:
     void pop_back()
     {
         assert(size() > 0);
+        if constexpr (has_tail_buffer)
+        {
+            if (tail_size > 0)
+            {
+                --tail_size;
+                return;
+            }
+        }
         data.pop_back();
     }
 
@@ -912,6 +1264,7 @@ public:
     void resize(size_type const count)
     {
         assert(count < max_size());
+        flush_tail();
         data.resize(count);
     }
 
@@ -922,6 +1275,7 @@ public:
     void resize(size_type const count, value_type const value)
     {
         assert(count < max_size());
+        flush_tail();
         data.resize(count, to_rank(value));
     }
 
@@ -939,12 +1293,16 @@ public:
     constexpr void swap(bitcompressed_vector & rhs) noexcept
     {
         std::swap(data, rhs.data);
+        std::swap(tail, rhs.tail);
+        std::swap(tail_size, rhs.tail_size);
     }
 
     //!\copydoc swap()
     constexpr void swap(bitcompressed_vector && rhs) noexcept
     {
         std::swap(data, rhs.data);
+        std::swap(tail, rhs.tail);
+        std::swap(tail_size, rhs.tail_size);
     }
     //!\}
 
@@ -974,33 +1332,60 @@ public:
 
     //!\name Comparison operators
     //!\{
-    constexpr bool operator==(bitcompressed_vector const & rhs) const noexcept
+    //!\brief Compares the underlying storage one 64bit word at a time instead of letter-by-letter.
+    bool operator==(bitcompressed_vector const & rhs) const noexcept
     {
-        return data == rhs.data;
+        if (size() != rhs.size())
+            return false;
+
+        if (tail_size != 0 || rhs.tail_size != 0) // unflushed push_back() letters, compare letter-wise
+            return compare_letter_wise(rhs) == 0;
+
+        size_t const bits = size() * bits_per_letter;
+        uint64_t const * const lhs_words = data.data();
+        uint64_t const * const rhs_words = rhs.data.data();
+
+        for (size_t word = 0; word < bits / 64; ++word)
+            if (lhs_words[word] != rhs_words[word])
+                return false;
+
+        if (size_t const rest = bits % 64; rest != 0) // mask out the unused bits of the last word
+            return ((lhs_words[bits / 64] ^ rhs_words[bits / 64]) & ((uint64_t{1} << rest) - 1)) == 0;
+
+        return true;
     }
 
-    constexpr bool operator!=(bitcompressed_vector const & rhs) const noexcept
+    //!\copydoc operator==()
+    bool operator!=(bitcompressed_vector const & rhs) const noexcept
     {
-        return data != rhs.data;
+        return !(*this == rhs);
     }
 
-    constexpr bool operator<(bitcompressed_vector const & rhs) const noexcept
+    bool operator<(bitcompressed_vector const & rhs) const noexcept
     {
+        if (tail_size != 0 || rhs.tail_size != 0)
+            return compare_letter_wise(rhs) < 0;
         return data < rhs.data;
     }
 
-    constexpr bool operator>(bitcompressed_vector const & rhs) const noexcept
+    bool operator>(bitcompressed_vector const & rhs) const noexcept
     {
+        if (tail_size != 0 || rhs.tail_size != 0)
+            return compare_letter_wise(rhs) > 0;
         return data > rhs.data;
     }
 
-    constexpr bool operator<=(bitcompressed_vector const & rhs) const noexcept
+    bool operator<=(bitcompressed_vector const & rhs) const noexcept
     {
+        if (tail_size != 0 || rhs.tail_size != 0)
+            return compare_letter_wise(rhs) <= 0;
         return data <= rhs.data;
     }
 
-    constexpr bool operator>=(bitcompressed_vector const & rhs) const noexcept
+    bool operator>=(bitcompressed_vector const & rhs) const noexcept
     {
+        if (tail_size != 0 || rhs.tail_size != 0)
+            return compare_letter_wise(rhs) >= 0;
         return data >= rhs.data;
     }
     //!\}
@@ -1010,12 +1395,25 @@ public:
      * \tparam archive_t Type of `archive`; must satisfy seqan3::CerealArchive.
      * \param archive The archive being serialised from/to.
      *
+     * The packed payload of the underlying sdsl::int_vector is archived as one aligned binary blob
+     * (text archives base64-encode it), i.e. the letters are never unpacked. The words are stored in
+     * host byte order, so binary archives are not portable between platforms of different endianness.
+     *
      * \attention These functions are never called directly, see \ref serialisation for more details.
      */
     template <CerealArchive archive_t>
     void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
     {
-        archive(data); //TODO: data not yet serialisable
+#if SEQAN3_WITH_CEREAL
+        flush_tail();
+
+        uint64_t size = data.size();
+        archive(size);
+        data.resize(size); // no-op when storing, allocates the payload when loading
+
+        uint64_t const word_count = (size * bits_per_letter + 63) / 64;
+        archive(cereal::binary_data(data.data(), word_count * sizeof(uint64_t)));
+#endif
     }
     //!\endcond
 };
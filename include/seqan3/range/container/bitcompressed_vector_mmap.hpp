@@ -0,0 +1,304 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::bitcompressed_vector_mmap.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <type_traits>
+
+#include <seqan3/io/detail/mmap_istream.hpp>
+#include <seqan3/io/exception.hpp>
+#include <seqan3/range/container/bitcompressed_vector.hpp>
+#include <seqan3/range/detail/random_access_iterator.hpp>
+#include <seqan3/std/filesystem>
+
+namespace seqan3
+{
+
+/*!\brief A read-only, memory-mapped view over a stored seqan3::bitcompressed_vector.
+ * \tparam alphabet_type The value type of the container, must satisfy seqan3::Alphabet and not be `&`.
+ * \ingroup container
+ *
+ * \details
+ *
+ * seqan3::bitcompressed_vector can be stored to disk via store() in a flat binary layout (header plus
+ * the packed payload words). This class maps such a file into memory and extracts every letter straight
+ * from the mapping — the packed text is never unpacked, copied or re-encoded, so opening a multi-gigabyte
+ * genome is effectively instant and the mapped pages are shared between all processes that open the same
+ * file.
+ *
+ * The container is read-only and move-only (the mapping cannot be copied). For (de-)serialisation via
+ * cereal archives — which copies the payload into a mutable container — use the regular
+ * seqan3::bitcompressed_vector serialisation support instead.
+ *
+ * \attention The payload words are stored in host byte order, i.e. files are not portable between
+ * platforms of different endianness.
+ */
+template <Alphabet alphabet_type>
+//!\cond
+    requires std::is_same_v<alphabet_type, std::remove_reference_t<alphabet_type>>
+//!\endcond
+class bitcompressed_vector_mmap
+{
+private:
+    //!\brief The number of bits needed to represent a single letter of the alphabet_type.
+    static constexpr size_t bits_per_letter = std::ceil(std::log2(alphabet_size_v<alphabet_type>));
+
+    static_assert(bits_per_letter <= 64, "Alphabet must be representable in at most 64bit.");
+
+public:
+    /*!\name Member types
+     * \{
+     */
+    //!\brief The value type (a plain letter, extracted from the packed payload).
+    using value_type = alphabet_type;
+    //!\brief Same as value_type, the data cannot be modified.
+    using reference = value_type;
+    //!\brief Same as value_type, the data cannot be modified.
+    using const_reference = value_type;
+    //!\brief An unsigned integer type.
+    using size_type = size_t;
+    //!\brief A signed integer type.
+    using difference_type = ptrdiff_t;
+    //!\brief The iterator type of this container (a random access iterator).
+    using iterator = detail::random_access_iterator<bitcompressed_vector_mmap const>;
+    //!\brief The const_iterator equals the iterator type, the data cannot be modified.
+    using const_iterator = iterator;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    //!\brief Default constructor; all operations except assignment and open() are UB on an unopened container.
+    bitcompressed_vector_mmap() = default;
+    //!\brief Copying is not possible, the mapping is uniquely owned.
+    bitcompressed_vector_mmap(bitcompressed_vector_mmap const &) = delete;
+    //!\brief Copying is not possible, the mapping is uniquely owned.
+    bitcompressed_vector_mmap & operator=(bitcompressed_vector_mmap const &) = delete;
+    //!\brief Move constructor.
+    bitcompressed_vector_mmap(bitcompressed_vector_mmap &&) = default;
+    //!\brief Move assignment.
+    bitcompressed_vector_mmap & operator=(bitcompressed_vector_mmap &&) = default;
+    //!\brief Destructor; unmaps the file.
+    ~bitcompressed_vector_mmap() = default;
+
+    /*!\brief Map the given store file into memory.
+     * \param[in] filename Path to a file previously written by store().
+     * \throws seqan3::file_open_error if the file cannot be opened or mapped.
+     * \throws seqan3::format_error if the file does not have the expected layout.
+     *
+     * ### Complexity
+     *
+     * Constant (the file contents are paged in lazily by the OS).
+     */
+    explicit bitcompressed_vector_mmap(std::filesystem::path const & filename)
+    {
+        open(filename);
+    }
+    //!\}
+
+    /*!\brief Store a seqan3::bitcompressed_vector in the flat binary layout this class maps.
+     * \param[in] cont     The container to store.
+     * \param[in] filename Path to write to; an existing file is overwritten.
+     * \throws seqan3::file_open_error if the file cannot be opened or written.
+     *
+     * ### Complexity
+     *
+     * Linear in the size of \p cont.
+     */
+    static void store(bitcompressed_vector<alphabet_type> const & cont, std::filesystem::path const & filename)
+    {
+        std::ofstream stream{filename, std::ios::binary | std::ios::trunc};
+        if (!stream.is_open())
+            throw file_open_error{"Could not open file " + filename.string() + " for writing."};
+
+        // repack instead of reaching into the source container; this also picks up letters that
+        // are still sitting in its uncompressed push_back() buffer
+        sdsl::int_vector<bits_per_letter> packed(cont.size());
+        size_t i = 0;
+        for (alphabet_type const letter : cont)
+            packed[i++] = to_rank(letter);
+
+        uint64_t const header[3]{magic_number,
+                                 static_cast<uint64_t>(cont.size()),
+                                 static_cast<uint64_t>(bits_per_letter)};
+        stream.write(reinterpret_cast<char const *>(&header[0]), sizeof(header));
+
+        stream.write(reinterpret_cast<char const *>(packed.data()),
+                     word_count(cont.size()) * sizeof(uint64_t));
+
+        if (!stream)
+            throw file_open_error{"Could not write to file " + filename.string() + "."};
+    }
+
+    /*!\brief Map the given store file into memory, replacing the current mapping.
+     * \copydetails bitcompressed_vector_mmap(std::filesystem::path const &)
+     */
+    void open(std::filesystem::path const & filename)
+    {
+        auto buffer = std::make_unique<detail::mmap_istreambuf<char>>(filename);
+        if (!buffer->is_open())
+            throw file_open_error{"Could not memory-map file " + filename.string() + "."};
+
+        if (buffer->size() < 3 * sizeof(uint64_t))
+            throw format_error{"File " + filename.string() + " is too small to be a bitcompressed store."};
+
+        uint64_t header[3];
+        std::memcpy(&header[0], buffer->data(), sizeof(header));
+
+        if (header[0] != magic_number)
+            throw format_error{"File " + filename.string() + " is not a bitcompressed store."};
+
+        if (header[2] != bits_per_letter)
+            throw format_error{"File " + filename.string() + " was stored with a different alphabet (" +
+                               std::to_string(header[2]) + " bits per letter)."};
+
+        uint64_t const count = header[1];
+
+        if (buffer->size() != sizeof(header) + word_count(count) * sizeof(uint64_t))
+            throw format_error{"File " + filename.string() + " is truncated."};
+
+        mapping = std::move(buffer);
+        count_ = count;
+        words = reinterpret_cast<uint64_t const *>(mapping->data() + sizeof(header));
+    }
+
+    /*!\name Element access
+     * \{
+     */
+    /*!\brief Return the i-th letter, extracted from the packed payload.
+     * \param[in] i The element to retrieve.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    const_reference operator[](size_type const i) const noexcept
+    {
+        assert(i < size());
+
+        size_t const bit = i * bits_per_letter;
+        size_t const word = bit / 64;
+        size_t const offset = bit % 64;
+
+        uint64_t rank = words[word] >> offset;
+        if constexpr (64 % bits_per_letter != 0) // letters may straddle a word boundary
+        {
+            if (offset + bits_per_letter > 64)
+                rank |= words[word + 1] << (64 - offset);
+        }
+
+        if constexpr (bits_per_letter < 64)
+            rank &= (uint64_t{1} << bits_per_letter) - 1;
+
+        return assign_rank(alphabet_type{}, rank);
+    }
+
+    /*!\brief Return the i-th letter, extracted from the packed payload.
+     * \param[in] i The element to retrieve.
+     * \throws std::out_of_range if \p i is out of range.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     */
+    const_reference at(size_type const i) const
+    {
+        if (i >= size()) // [[unlikely]]
+            throw std::out_of_range{"Trying to access element behind the last in bitcompressed_vector_mmap."};
+        return (*this)[i];
+    }
+
+    //!\brief Return the first letter. Calling this on an empty container is undefined behaviour.
+    const_reference front() const noexcept
+    {
+        assert(size() > 0);
+        return (*this)[0];
+    }
+
+    //!\brief Return the last letter. Calling this on an empty container is undefined behaviour.
+    const_reference back() const noexcept
+    {
+        assert(size() > 0);
+        return (*this)[size() - 1];
+    }
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    //!\brief Returns an iterator to the first element of the container.
+    const_iterator begin() const noexcept
+    {
+        return const_iterator{*this};
+    }
+
+    //!\copydoc begin()
+    const_iterator cbegin() const noexcept
+    {
+        return const_iterator{*this};
+    }
+
+    //!\brief Returns an iterator to the element following the last element of the container.
+    const_iterator end() const noexcept
+    {
+        return const_iterator{*this, size()};
+    }
+
+    //!\copydoc end()
+    const_iterator cend() const noexcept
+    {
+        return const_iterator{*this, size()};
+    }
+    //!\}
+
+    /*!\name Capacity
+     * \{
+     */
+    //!\brief Returns the number of letters in the store.
+    size_type size() const noexcept
+    {
+        return count_;
+    }
+
+    //!\brief Checks whether the store is empty.
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+    //!\}
+
+private:
+    //!\brief Identifies the file format ("SEQBCV", format version 1).
+    static constexpr uint64_t magic_number = 0x0156'4342'5145'5301ull;
+
+    //!\brief The number of 64 bit words the packed payload of `count` letters occupies.
+    static constexpr uint64_t word_count(uint64_t const count) noexcept
+    {
+        return (count * bits_per_letter + 63) / 64;
+    }
+
+    //!\brief Keeps the mapping alive; indirection because stream buffers are not movable.
+    std::unique_ptr<detail::mmap_istreambuf<char>> mapping{};
+    //!\brief The number of letters in the store.
+    size_type count_{0};
+    //!\brief Pointer to the packed payload words inside the mapping.
+    uint64_t const * words{nullptr};
+};
+
+} // namespace seqan3
@@ -12,6 +12,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <thread>
 #include <type_traits>
 #include <vector>
 
@@ -38,7 +40,10 @@ namespace seqan3
 /*!\brief Container that stores sequences concatenated internally.
  * \tparam inner_type The type of sequences that will be stored. Must satisfy seqan3::reservable_container_concept.
  * \tparam data_delimiters_type A container that stores the begin/end positions in the inner_type. Must be
- * seqan3::reservable_container_concept and have inner_type's size_type as value_type.
+ * seqan3::reservable_container_concept and have inner_type's size_type as value_type. Defaults to
+ * `std::vector`; pass seqan3::uint_vector to cut the memory footprint of the delimiters, e.g.
+ * `concatenated_sequences<std::vector<dna4>, uint_vector<40>>` stores each delimiter in 40 instead of
+ * 64 bits.
  * \implements seqan3::reservable_container_concept
  * \ingroup container
  *
@@ -211,6 +216,118 @@ public:
         }
     }
 
+    /*!\brief Construct from a different range using multiple threads.
+     * \tparam rng_of_rng_type The type of range to be inserted; must satisfy std::ranges::RandomAccessRange,
+     *                         std::ranges::SizedRange and \ref is_compatible_this; the inner ranges must satisfy
+     *                         std::ranges::SizedRange.
+     * \param rng_of_rng The sequences to construct from.
+     * \param thread_count The number of threads to copy with; values below `2` fall back to the sequential
+     *                     constructor.
+     *
+     * \details
+     *
+     * The outer range is split into one contiguous chunk per thread. Every thread first computes the chunk-relative
+     * prefix sums of its sequence lengths; a single sequential scan over the per-chunk totals then yields the global
+     * offset of every chunk, after which all threads copy their payloads into the preallocated concatenation buffer
+     * concurrently. Since every thread writes a disjoint slice of the buffer, large inputs are copied at memory
+     * bandwidth instead of single-core copy speed. This overload is only available if the concatenation buffer is a
+     * contiguous range, because concurrent writes to adjacent positions of bit-packed containers would race on
+     * shared words; the same applies to the delimiters, which the workers also fill concurrently.
+     *
+     * \par Complexity
+     *
+     * Linear in the cumulative size of `rng_of_rng`, distributed over `thread_count` threads.
+     *
+     * \par Exceptions
+     *
+     * Basic exception guarantee.
+     */
+    template <std::ranges::RandomAccessRange rng_of_rng_type>
+    concatenated_sequences(rng_of_rng_type && rng_of_rng, size_t const thread_count)
+    //!\cond
+        requires is_compatible_this<rng_of_rng_type> &&
+                 std::ranges::SizedRange<rng_of_rng_type> &&
+                 std::ranges::SizedRange<value_type_t<remove_cvref_t<rng_of_rng_type>>> &&
+                 std::ranges::ContiguousRange<value_type> &&
+                 std::ranges::ContiguousRange<data_delimiters_type>
+    //!\endcond
+    {
+        size_type const count = seqan3::size(rng_of_rng);
+        size_t const worker_count = std::min<size_t>(std::max<size_t>(thread_count, 1), std::max<size_t>(count, 1));
+
+        if (worker_count < 2)
+        {
+            data_delimiters.reserve(count + 1);
+            for (auto && val : rng_of_rng)
+            {
+                data_values.insert(data_values.end(), val.begin(), val.end());
+                data_delimiters.push_back(data_delimiters.back() + val.size());
+            }
+            return;
+        }
+
+        data_delimiters.resize(count + 1); // data_delimiters[0] == 0 is preserved by the resize
+
+        auto outer_it = std::ranges::begin(rng_of_rng);
+
+        // The outer range is divided into one contiguous, evenly sized chunk per worker.
+        auto chunk_begin = [count, worker_count] (size_t const worker)
+        {
+            return static_cast<size_type>(count * worker / worker_count);
+        };
+
+        // Pass 1: every worker stores the chunk-relative length prefix sums and its chunk total.
+        std::vector<size_type> chunk_total(worker_count, 0);
+        auto sum_lengths = [&] (size_t const worker)
+        {
+            size_type sum = 0;
+            for (size_type i = chunk_begin(worker); i < chunk_begin(worker + 1); ++i)
+            {
+                sum += seqan3::size(outer_it[i]);
+                data_delimiters[i + 1] = sum;
+            }
+            chunk_total[worker] = sum;
+        };
+
+        {
+            std::vector<std::thread> workers{};
+            for (size_t worker = 1; worker < worker_count; ++worker)
+                workers.emplace_back(sum_lengths, worker);
+            sum_lengths(0);
+            for (std::thread & worker : workers)
+                worker.join();
+        }
+
+        // An exclusive scan over the chunk totals yields the global offset of every chunk.
+        std::vector<size_type> chunk_offset(worker_count, 0);
+        for (size_t worker = 1; worker < worker_count; ++worker)
+            chunk_offset[worker] = chunk_offset[worker - 1] + chunk_total[worker - 1];
+
+        data_values.resize(chunk_offset.back() + chunk_total.back());
+
+        // Pass 2: globalise the delimiters and copy the payloads; every worker writes a disjoint buffer slice.
+        auto copy_payloads = [&] (size_t const worker)
+        {
+            size_type const offset = chunk_offset[worker];
+            for (size_type i = chunk_begin(worker); i < chunk_begin(worker + 1); ++i)
+            {
+                data_delimiters[i + 1] += offset;
+                auto && val = outer_it[i];
+                std::copy(std::ranges::begin(val), std::ranges::end(val),
+                          data_values.begin() + (data_delimiters[i + 1] - seqan3::size(val)));
+            }
+        };
+
+        {
+            std::vector<std::thread> workers{};
+            for (size_t worker = 1; worker < worker_count; ++worker)
+                workers.emplace_back(copy_payloads, worker);
+            copy_payloads(0);
+            for (std::thread & worker : workers)
+                worker.join();
+        }
+    }
+
     /*!\brief Construct/assign with `count` times `value`.
      * \tparam rng_type The type of range to be inserted; must satisfy \ref is_compatible_value.
      * \param count Number of elements.
@@ -930,7 +1047,7 @@ public:
         // TODO parallel execution policy or vectorization?
         std::for_each(data_delimiters.begin() + pos_as_num + count + 1,
                       data_delimiters.end(),
-                      [full_len = value_len * count] (auto & d) { d += full_len; });
+                      [full_len = value_len * count] (auto && d) { d += full_len; });
 
         return begin() + pos_as_num;
     }
@@ -1012,7 +1129,7 @@ public:
         // TODO parallel execution policy or vectorization?
         std::for_each(data_delimiters.begin() + pos_as_num + ilist.size() + 1,
                       data_delimiters.end(),
-                      [full_len] (auto & d) { d += full_len; });
+                      [full_len] (auto && d) { d += full_len; });
 
         return begin() + pos_as_num;
     }
@@ -1085,7 +1202,7 @@ public:
         // TODO parallel execution policy or vectorization?
         std::for_each(data_delimiters.begin() + distf + 1,
                       data_delimiters.end(),
-                      [sum_size] (auto & d) { d -= sum_size; });
+                      [sum_size] (auto && d) { d -= sum_size; });
         return begin() + dist;
     }
 
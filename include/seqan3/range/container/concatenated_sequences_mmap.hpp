@@ -0,0 +1,290 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::concatenated_sequences_mmap.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <type_traits>
+
+#include <seqan3/io/detail/mmap_istream.hpp>
+#include <seqan3/io/exception.hpp>
+#include <seqan3/range/container/concatenated_sequences.hpp>
+#include <seqan3/range/detail/random_access_iterator.hpp>
+#include <seqan3/std/filesystem>
+#include <seqan3/std/span>
+
+namespace seqan3
+{
+
+/*!\brief A read-only, memory-mapped view over a stored seqan3::concatenated_sequences.
+ * \tparam value_t The element type of the inner sequences; must be trivially copyable.
+ * \ingroup container
+ *
+ * \details
+ *
+ * seqan3::concatenated_sequences can be stored to disk via store() in a flat binary layout
+ * (header, delimiters, concatenation buffer). This class maps such a file into memory and serves every
+ * access as a std::span pointing straight into the mapping — no parsing, no copy, no allocation
+ * proportional to the data. Opening a multi-gigabyte store is therefore effectively instant and the
+ * mapped pages are shared between all processes that open the same file.
+ *
+ * The container is read-only and move-only (the mapping cannot be copied). For (de-)serialisation via
+ * cereal archives — which copies the data into a mutable container — use the regular
+ * seqan3::concatenated_sequences serialisation support instead.
+ *
+ * \attention The file layout stores delimiters as 64 bit values and the concatenation buffer as raw
+ * element bytes, i.e. files are not portable between platforms of different endianness.
+ */
+template <typename value_t>
+//!\cond
+    requires std::is_trivially_copyable_v<value_t>
+//!\endcond
+class concatenated_sequences_mmap
+{
+    static_assert(alignof(value_t) <= alignof(uint64_t),
+                  "The concatenation buffer follows the 64 bit delimiters in the file layout.");
+
+public:
+    /*!\name Member types
+     * \{
+     */
+    //!\brief A span over one inner sequence; points directly into the mapping.
+    using value_type = std::span<value_t const>;
+    //!\brief Same as value_type, the data cannot be modified.
+    using reference = value_type;
+    //!\brief Same as value_type, the data cannot be modified.
+    using const_reference = value_type;
+    //!\brief An unsigned integer type.
+    using size_type = size_t;
+    //!\brief A signed integer type.
+    using difference_type = ptrdiff_t;
+    //!\brief The iterator type of this container (a random access iterator).
+    using iterator = detail::random_access_iterator<concatenated_sequences_mmap const>;
+    //!\brief The const_iterator equals the iterator type, the data cannot be modified.
+    using const_iterator = iterator;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    //!\brief Default constructor; all operations except assignment and open() are UB on an unopened container.
+    concatenated_sequences_mmap() = default;
+    //!\brief Copying is not possible, the mapping is uniquely owned.
+    concatenated_sequences_mmap(concatenated_sequences_mmap const &) = delete;
+    //!\brief Copying is not possible, the mapping is uniquely owned.
+    concatenated_sequences_mmap & operator=(concatenated_sequences_mmap const &) = delete;
+    //!\brief Move constructor.
+    concatenated_sequences_mmap(concatenated_sequences_mmap &&) = default;
+    //!\brief Move assignment.
+    concatenated_sequences_mmap & operator=(concatenated_sequences_mmap &&) = default;
+    //!\brief Destructor; unmaps the file.
+    ~concatenated_sequences_mmap() = default;
+
+    /*!\brief Map the given store file into memory.
+     * \param[in] filename Path to a file previously written by store().
+     * \throws seqan3::file_open_error if the file cannot be opened or mapped.
+     * \throws seqan3::format_error if the file does not have the expected layout.
+     *
+     * ### Complexity
+     *
+     * Constant (the file contents are paged in lazily by the OS).
+     */
+    explicit concatenated_sequences_mmap(std::filesystem::path const & filename)
+    {
+        open(filename);
+    }
+    //!\}
+
+    /*!\brief Store a seqan3::concatenated_sequences in the flat binary layout this class maps.
+     * \tparam inner_type            The inner sequence type of the container; its concatenation buffer must be
+     *                               contiguous and hold elements of type `value_t`.
+     * \tparam data_delimiters_type  The delimiter container type of the container.
+     * \param[in] cont     The container to store.
+     * \param[in] filename Path to write to; an existing file is overwritten.
+     * \throws seqan3::file_open_error if the file cannot be opened or written.
+     *
+     * ### Complexity
+     *
+     * Linear in the concatenated size of \p cont.
+     */
+    template <typename inner_type, typename data_delimiters_type>
+    //!\cond
+        requires std::ranges::ContiguousRange<std::decay_t<inner_type>> &&
+                 std::Same<value_type_t<std::decay_t<inner_type>>, value_t>
+    //!\endcond
+    static void store(concatenated_sequences<inner_type, data_delimiters_type> const & cont,
+                      std::filesystem::path const & filename)
+    {
+        std::ofstream stream{filename, std::ios::binary | std::ios::trunc};
+        if (!stream.is_open())
+            throw file_open_error{"Could not open file " + filename.string() + " for writing."};
+
+        auto && [values, delimiters] = cont.data();
+
+        uint64_t const header[3]{magic_number,
+                                 static_cast<uint64_t>(cont.size()),
+                                 static_cast<uint64_t>(cont.concat_size())};
+        stream.write(reinterpret_cast<char const *>(&header[0]), sizeof(header));
+
+        for (auto const delimiter : delimiters) // the in-memory delimiter type may be narrower than 64 bit
+        {
+            uint64_t const value = delimiter;
+            stream.write(reinterpret_cast<char const *>(&value), sizeof(value));
+        }
+
+        stream.write(reinterpret_cast<char const *>(std::ranges::data(values)),
+                     cont.concat_size() * sizeof(value_t));
+
+        if (!stream)
+            throw file_open_error{"Could not write to file " + filename.string() + "."};
+    }
+
+    /*!\brief Map the given store file into memory, replacing the current mapping.
+     * \copydetails concatenated_sequences_mmap(std::filesystem::path const &)
+     */
+    void open(std::filesystem::path const & filename)
+    {
+        auto buffer = std::make_unique<detail::mmap_istreambuf<char>>(filename);
+        if (!buffer->is_open())
+            throw file_open_error{"Could not memory-map file " + filename.string() + "."};
+
+        if (buffer->size() < 4 * sizeof(uint64_t)) // header plus at least one delimiter
+            throw format_error{"File " + filename.string() + " is too small to be a sequence store."};
+
+        uint64_t header[3];
+        std::memcpy(&header[0], buffer->data(), sizeof(header));
+
+        if (header[0] != magic_number)
+            throw format_error{"File " + filename.string() + " is not a sequence store."};
+
+        uint64_t const count = header[1];
+        uint64_t const concat_size = header[2];
+
+        if (buffer->size() != sizeof(header) + (count + 1) * sizeof(uint64_t) + concat_size * sizeof(value_t))
+            throw format_error{"File " + filename.string() + " is truncated."};
+
+        mapping = std::move(buffer);
+        count_ = count;
+        delimiters = reinterpret_cast<uint64_t const *>(mapping->data() + sizeof(header));
+        values = reinterpret_cast<value_t const *>(mapping->data() + sizeof(header) +
+                                                   (count + 1) * sizeof(uint64_t));
+    }
+
+    /*!\name Element access
+     * \{
+     */
+    /*!\brief Return a span over the i-th sequence; the span points into the mapping.
+     * \param[in] i The element to retrieve.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    const_reference operator[](size_type const i) const noexcept
+    {
+        assert(i < size());
+        return const_reference{values + delimiters[i], values + delimiters[i + 1]};
+    }
+
+    /*!\brief Return a span over the i-th sequence; the span points into the mapping.
+     * \param[in] i The element to retrieve.
+     * \throws std::out_of_range if \p i is out of range.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     */
+    const_reference at(size_type const i) const
+    {
+        if (i >= size()) // [[unlikely]]
+            throw std::out_of_range{"Trying to access element behind the last in concatenated_sequences_mmap."};
+        return (*this)[i];
+    }
+
+    //!\brief Return a span over the concatenation of all sequences.
+    const_reference concat() const noexcept
+    {
+        return const_reference{values, values + concat_size()};
+    }
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    //!\brief Returns an iterator to the first element of the container.
+    const_iterator begin() const noexcept
+    {
+        return const_iterator{*this};
+    }
+
+    //!\copydoc begin()
+    const_iterator cbegin() const noexcept
+    {
+        return const_iterator{*this};
+    }
+
+    //!\brief Returns an iterator to the element following the last element of the container.
+    const_iterator end() const noexcept
+    {
+        return const_iterator{*this, size()};
+    }
+
+    //!\copydoc end()
+    const_iterator cend() const noexcept
+    {
+        return const_iterator{*this, size()};
+    }
+    //!\}
+
+    /*!\name Capacity
+     * \{
+     */
+    //!\brief Returns the number of sequences in the store.
+    size_type size() const noexcept
+    {
+        return count_;
+    }
+
+    //!\brief Returns the cumulative size of all sequences in the store.
+    size_type concat_size() const noexcept
+    {
+        return (delimiters != nullptr) ? delimiters[count_] : 0u;
+    }
+
+    //!\brief Checks whether the store is empty.
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+    //!\}
+
+private:
+    //!\brief Identifies the file format ("SEQCAT", format version 1).
+    static constexpr uint64_t magic_number = 0x0154'4143'5145'5301ull;
+
+    //!\brief Keeps the mapping alive; indirection because stream buffers are not movable.
+    std::unique_ptr<detail::mmap_istreambuf<char>> mapping{};
+    //!\brief The number of sequences in the store.
+    size_type count_{0};
+    //!\brief Pointer to the `count_ + 1` delimiters inside the mapping.
+    uint64_t const * delimiters{nullptr};
+    //!\brief Pointer to the concatenation buffer inside the mapping.
+    value_t const * values{nullptr};
+};
+
+} // namespace seqan3
@@ -0,0 +1,198 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Contains seqan3::hugepage_allocator.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+#include <seqan3/core/platform.hpp>
+#include <seqan3/range/container/aligned_allocator.hpp>
+
+#if defined(__unix__) || (defined(__APPLE__) && defined(__MACH__))
+    #define SEQAN3_HAS_MMAP_ALLOC 1
+    #include <sys/mman.h>
+#endif
+
+namespace seqan3
+{
+
+/*!\brief Allocates aligned storage and backs large allocations with (transparent) huge pages.
+ * \tparam value_t     \copydoc hugepage_allocator::value_type
+ * \tparam alignment_v \copydoc hugepage_allocator::alignment
+ * \ingroup container
+ *
+ * \details
+ *
+ * Large containers (DP matrices, index payloads, concatenated sequence stores) touch so many 4 KiB
+ * pages that TLB misses become measurable. This allocator behaves like seqan3::aligned_allocator for
+ * small requests, but serves every allocation of at least 2 MiB from an anonymous memory mapping that
+ * is aligned to and rounded up to the huge-page size and advised with `MADV_HUGEPAGE`, so the kernel
+ * can back it with 2 MiB transparent huge pages.
+ *
+ * The fallback is graceful on every level: if the kernel ignores the advice (transparent huge pages
+ * disabled), the mapping is simply backed by regular pages; on platforms without `mmap` all requests
+ * go through seqan3::aligned_allocator. Whether an allocation came from a mapping is decided by its
+ * size alone, so deallocation never needs per-pointer bookkeeping and the allocator remains stateless.
+ *
+ * \see seqan3::aligned_allocator
+ */
+template <typename value_t, size_t alignment_v = __STDCPP_DEFAULT_NEW_ALIGNMENT__>
+class hugepage_allocator
+{
+public:
+    //!\brief The memory-alignment of the allocation
+    static constexpr size_t alignment = alignment_v;
+
+    //!\brief The size of a huge page; allocations of at least this many bytes are served from a mapping.
+    static constexpr size_t huge_page_size = size_t{1} << 21; // 2MiB
+
+    static_assert(alignment <= huge_page_size, "The mapping start cannot be aligned beyond the huge-page size.");
+
+    //!\brief The value type of the allocation
+    using value_type = value_t;
+    //!\brief The pointer type of the allocation
+    using pointer = value_type*;
+    //!\brief The difference type of the allocation
+    using difference_type = typename std::pointer_traits<pointer>::difference_type;
+    //!\brief The size type of the allocation
+    using size_type = std::make_unsigned_t<difference_type>;
+
+    //!\brief Are any two allocators of the same hugepage_allocator type always compare equal?
+    using is_always_equal = std::true_type;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    hugepage_allocator() = default;
+    hugepage_allocator(hugepage_allocator const &) = default;
+    hugepage_allocator(hugepage_allocator &&) = default;
+    hugepage_allocator& operator=(hugepage_allocator const &) = default;
+    hugepage_allocator& operator=(hugepage_allocator &&) = default;
+    ~hugepage_allocator() = default;
+
+    template <class other_value_type>
+    constexpr hugepage_allocator(hugepage_allocator<other_value_type, alignment> const &) noexcept
+    {}
+    //!\}
+
+    /*!\brief Allocates `n * sizeof(T)` bytes of uninitialized storage.
+     * \throws Throws std::bad_alloc if allocation fails.
+     *
+     * \details
+     *
+     * Requests of at least \ref huge_page_size bytes are served from an anonymous memory mapping that
+     * starts on a huge-page boundary and is advised with `MADV_HUGEPAGE`; smaller requests delegate to
+     * seqan3::aligned_allocator.
+     *
+     * \sa https://en.cppreference.com/w/cpp/memory/allocator/allocate
+     */
+    [[nodiscard]]
+    pointer allocate(size_type n)
+    {
+        constexpr size_type max_size = std::numeric_limits<size_type>::max() / sizeof(value_type);
+        if (n > max_size)
+            throw std::bad_alloc();
+
+#ifdef SEQAN3_HAS_MMAP_ALLOC
+        if (size_type const bytes = n * sizeof(value_type); bytes >= huge_page_size)
+        {
+            size_type const map_bytes = round_to_huge_pages(bytes);
+
+            // Over-map by one huge page so a huge-page aligned window of map_bytes always fits,
+            // then trim the misaligned head and the tail back off.
+            void * const raw = ::mmap(nullptr, map_bytes + huge_page_size, PROT_READ | PROT_WRITE,
+                                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (raw == MAP_FAILED)
+                throw std::bad_alloc();
+
+            uintptr_t const raw_address = reinterpret_cast<uintptr_t>(raw);
+            uintptr_t const aligned_address = (raw_address + huge_page_size - 1) & ~(huge_page_size - 1);
+
+            if (size_t const head = aligned_address - raw_address; head > 0)
+                ::munmap(raw, head);
+            if (size_t const tail = huge_page_size - (aligned_address - raw_address); tail > 0)
+                ::munmap(reinterpret_cast<char *>(aligned_address) + map_bytes, tail);
+
+#ifdef MADV_HUGEPAGE
+            // Advisory only: if transparent huge pages are disabled the mapping stays 4KiB-backed.
+            ::madvise(reinterpret_cast<void *>(aligned_address), map_bytes, MADV_HUGEPAGE);
+#endif
+
+            return reinterpret_cast<pointer>(aligned_address);
+        }
+#endif // SEQAN3_HAS_MMAP_ALLOC
+
+        return aligned_allocator<value_type, alignment>{}.allocate(n);
+    }
+
+    /*!\brief Deallocates the storage referenced by the pointer p, which must be a pointer obtained by an earlier call
+     * to allocate().
+     * \details
+     *
+     * The argument n must be equal to the first argument of the call to allocate() that originally produced p;
+     * otherwise, the behavior is undefined. The size decides whether the storage is unmapped or freed.
+     *
+     * \sa https://en.cppreference.com/w/cpp/memory/allocator/deallocate
+     */
+    void deallocate(pointer p, size_type n) noexcept
+    {
+#ifdef SEQAN3_HAS_MMAP_ALLOC
+        if (size_type const bytes = n * sizeof(value_type); bytes >= huge_page_size)
+        {
+            ::munmap(p, round_to_huge_pages(bytes));
+            return;
+        }
+#endif // SEQAN3_HAS_MMAP_ALLOC
+
+        aligned_allocator<value_type, alignment>{}.deallocate(p, n);
+    }
+
+    /*!\brief The hugepage_allocator member template class hugepage_allocator::rebind provides a way to obtain an
+     * allocator for a different type.
+     * \tparam new_value_type The other value type.
+     */
+    template<typename new_value_type>
+    struct rebind
+    {
+        //!\brief The type of the allocator for a different value type.
+        using other = hugepage_allocator<new_value_type, alignment>;
+    };
+
+    /*!\name Comparison operators
+     * \{
+     */
+    //!\brief Returns true if the memory-alignment matches.
+    template <class value_type2, size_t alignment2>
+    constexpr bool operator==(hugepage_allocator<value_type2, alignment2> const &) noexcept
+    {
+        return alignment == alignment2;
+    }
+
+    //!\brief Returns false if the memory-alignment mismatches.
+    template <class value_type2, size_t alignment2>
+    constexpr bool operator!=(hugepage_allocator<value_type2, alignment2> const &) noexcept
+    {
+        return alignment != alignment2;
+    }
+    //!\}
+
+private:
+    //!\brief Rounds \p bytes up to the next multiple of the huge-page size.
+    static constexpr size_type round_to_huge_pages(size_type const bytes) noexcept
+    {
+        return (bytes + huge_page_size - 1) & ~(huge_page_size - 1);
+    }
+};
+
+} // namespace seqan3
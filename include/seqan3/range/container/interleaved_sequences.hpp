@@ -0,0 +1,319 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::interleaved_sequences.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/metafunction/range.hpp>
+#include <seqan3/range/container/aligned_allocator.hpp>
+#include <seqan3/std/ranges>
+#include <seqan3/std/span>
+
+namespace seqan3
+{
+
+/*!\brief A batch of sequences stored lane-major for inter-sequence SIMD computations.
+ * \tparam alphabet_t   The alphabet type of the stored sequences; must satisfy seqan3::Semialphabet.
+ * \tparam lane_count_v The number of sequence lanes, i.e. the lane count of the target SIMD vector;
+ *                      must be a power of two.
+ * \tparam rank_t       The integral type one rank is stored in; defaults to the rank type of `alphabet_t`.
+ * \ingroup container
+ *
+ * \details
+ *
+ * Inter-sequence SIMD kernels process one position of many sequences at once and therefore need the ranks of
+ * position `i` of all sequences of a batch adjacent in memory, whereas sequences are produced one after another.
+ * This container performs the transposition once on load: position `i` of lane `l` is stored at index
+ * `i * lane_count + l`, such that every position forms one contiguous block that a kernel can load with a single
+ * aligned SIMD instruction (the storage is allocated with seqan3::aligned_allocator at the block size).
+ *
+ * Sequences of a batch may differ in length. Positions behind the end of a shorter sequence are filled with
+ * #padding_rank, a rank no letter of `alphabet_t` can assume, such that padded lanes can never produce a match
+ * when two batches are compared position-wise. The original length of every sequence remains available via
+ * sequence_size().
+ *
+ * The container is loaded in bulk from a range of sequences and is read-only afterwards; refilling it with the
+ * next batch via load() reuses the allocated storage.
+ *
+ * ### Example
+ *
+ * \snippet test/snippet/range/container/interleaved_sequences.cpp usage
+ *
+ * ### Thread safety
+ *
+ * This container provides no thread-safety beyond the promise given also by the STL that all
+ * calls to `const` member function are safe from multiple threads (as long as no thread calls
+ * a non-`const` member function at the same time).
+ */
+template <Semialphabet alphabet_t, size_t lane_count_v, typename rank_t = underlying_rank_t<alphabet_t>>
+//!\cond
+    requires std::is_integral_v<rank_t>
+//!\endcond
+class interleaved_sequences
+{
+    static_assert(lane_count_v > 0 && (lane_count_v & (lane_count_v - 1)) == 0,
+                  "The lane count must be a power of two to serve as a valid memory-alignment.");
+    static_assert(static_cast<size_t>(alphabet_size_v<alphabet_t>) <= std::numeric_limits<rank_t>::max(),
+                  "The rank type must be able to hold every rank of the alphabet plus the padding rank.");
+
+public:
+    /*!\name Associated types
+     * \{
+     */
+    //!\brief The integral type one rank is stored in.
+    using rank_type = rank_t;
+    //!\brief An unsigned integer type (usually std::size_t).
+    using size_type = size_t;
+    //!\}
+
+    //!\brief The number of sequence lanes.
+    static constexpr size_type lane_count = lane_count_v;
+    //!\brief The memory-alignment of the storage; one position block equals one aligned SIMD vector.
+    static constexpr size_type alignment = lane_count_v * sizeof(rank_t);
+    //!\brief The rank used to pad the lanes of shorter sequences; never assumed by a letter of `alphabet_t`.
+    static constexpr rank_type padding_rank = static_cast<rank_type>(alphabet_size_v<alphabet_t>);
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    interleaved_sequences() = default;                                          //!< Defaulted
+    interleaved_sequences(interleaved_sequences const &) = default;             //!< Defaulted
+    interleaved_sequences(interleaved_sequences &&) = default;                  //!< Defaulted
+    interleaved_sequences & operator=(interleaved_sequences const &) = default; //!< Defaulted
+    interleaved_sequences & operator=(interleaved_sequences &&) = default;      //!< Defaulted
+    ~interleaved_sequences() = default;                                         //!< Defaulted
+
+    /*!\brief Construct from a range of sequences.
+     * \copydetails load()
+     */
+    template <std::ranges::ForwardRange sequence_range_t>
+    //!\cond
+        requires std::ranges::ForwardRange<value_type_t<sequence_range_t>>
+    //!\endcond
+    explicit interleaved_sequences(sequence_range_t && sequences)
+    {
+        load(std::forward<sequence_range_t>(sequences));
+    }
+    //!\}
+
+    /*!\brief Loads a batch of sequences, replacing the previous contents.
+     * \tparam sequence_range_t The range type over the sequences; must model std::ranges::ForwardRange over
+     *                          std::ranges::ForwardRange whose value type is convertible to `alphabet_t`.
+     * \param[in] sequences     The sequences to interleave; at most #lane_count many.
+     * \throws std::invalid_argument If `sequences` contains more than #lane_count sequences.
+     *
+     * \details
+     *
+     * The sequences are transposed into the lane-major layout in one pass per sequence; lanes without a
+     * sequence and the positions behind the end of shorter sequences are filled with #padding_rank.
+     * The allocated storage is reused, such that streaming batches through one instance does not allocate
+     * once the longest batch has been seen.
+     *
+     * ### Complexity
+     *
+     * Linear in the combined length of the sequences.
+     *
+     * ### Exceptions
+     *
+     * Basic exception guarantee.
+     */
+    template <std::ranges::ForwardRange sequence_range_t>
+    //!\cond
+        requires std::ranges::ForwardRange<value_type_t<sequence_range_t>>
+    //!\endcond
+    void load(sequence_range_t && sequences)
+    {
+        size_type count = 0;
+        size_type max_size = 0;
+        for (auto && sequence : sequences)
+        {
+            if (count == lane_count) // [[unlikely]]
+                throw std::invalid_argument{"Trying to load more sequences than lanes into interleaved_sequences."};
+
+            sequence_sizes[count] =
+                std::ranges::distance(std::ranges::begin(sequence), std::ranges::end(sequence));
+            max_size = std::max(max_size, sequence_sizes[count]);
+            ++count;
+        }
+
+        for (size_type lane = count; lane < lane_count; ++lane)
+            sequence_sizes[lane] = 0;
+
+        number_of_sequences = count;
+        storage.assign(max_size * lane_count, padding_rank);
+
+        size_type lane = 0;
+        for (auto && sequence : sequences)
+        {
+            size_type position = 0;
+            for (auto && letter : sequence)
+            {
+                storage[position * lane_count + lane] =
+                    static_cast<rank_type>(to_rank(static_cast<alphabet_t>(letter)));
+                ++position;
+            }
+            ++lane;
+        }
+    }
+
+    /*!\name Element access
+     * \{
+     */
+    /*!\brief Returns the ranks of position `i` of all lanes as one contiguous block.
+     * \param[in] i The position to access; must be smaller than size().
+     * \returns A std::span of static extent #lane_count over the position block.
+     *
+     * The returned block is aligned to #alignment bytes, i.e. it can be loaded with a single aligned SIMD
+     * instruction. Lanes whose sequence ends before position `i` hold #padding_rank.
+     *
+     * Accessing a position behind the last causes undefined behaviour. In debug mode an assertion checks the
+     * size of the container.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    std::span<rank_type const, lane_count> position(size_type const i) const noexcept
+    {
+        assert(i < size());
+        return std::span<rank_type const, lane_count>{storage.data() + i * lane_count, lane_count};
+    }
+
+    /*!\brief Returns a pointer to the lane-major storage (position blocks of #lane_count ranks each).
+     * \returns A pointer to the first rank; aligned to #alignment bytes.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    rank_type const * data() const noexcept
+    {
+        return storage.data();
+    }
+    //!\}
+
+    /*!\name Capacity
+     * \{
+     */
+    /*!\brief Checks whether the container holds no sequences.
+     * \returns `true` if the container holds no sequences, `false` otherwise.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    bool empty() const noexcept
+    {
+        return number_of_sequences == 0;
+    }
+
+    /*!\brief Returns the number of interleaved positions, i.e. the length of the longest loaded sequence.
+     * \returns The number of position blocks.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    size_type size() const noexcept
+    {
+        return storage.size() / lane_count;
+    }
+
+    /*!\brief Returns the number of loaded sequences.
+     * \returns The number of occupied lanes.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    size_type sequence_count() const noexcept
+    {
+        return number_of_sequences;
+    }
+
+    /*!\brief Returns the original length of the sequence in the given lane.
+     * \param[in] lane The lane to query; must be smaller than #lane_count.
+     * \returns The length of the sequence loaded into `lane`, or `0` for an unoccupied lane.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    size_type sequence_size(size_type const lane) const noexcept
+    {
+        assert(lane < lane_count);
+        return sequence_sizes[lane];
+    }
+    //!\}
+
+    /*!\name Modifiers
+     * \{
+     */
+    /*!\brief Removes all sequences from the container; the allocated storage is kept for the next load().
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    void clear() noexcept
+    {
+        storage.clear();
+        sequence_sizes.fill(0);
+        number_of_sequences = 0;
+    }
+    //!\}
+
+private:
+    //!\brief The lane-major rank storage; aligned such that every position block starts on a SIMD boundary.
+    std::vector<rank_type, aligned_allocator<rank_type, alignment>> storage{};
+    //!\brief The original length of the sequence per lane; `0` for unoccupied lanes.
+    std::array<size_type, lane_count> sequence_sizes{};
+    //!\brief The number of occupied lanes.
+    size_type number_of_sequences{0};
+};
+
+} // namespace seqan3
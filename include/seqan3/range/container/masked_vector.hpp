@@ -0,0 +1,699 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::masked_vector.
+ */
+
+#pragma once
+
+#include <utility>
+
+#include <sdsl/int_vector.hpp>
+
+#include <seqan3/alphabet/detail/alphabet_proxy.hpp>
+#include <seqan3/alphabet/mask/masked.hpp>
+#include <seqan3/core/concept/cereal.hpp>
+#include <seqan3/core/metafunction/all.hpp>
+#include <seqan3/range/shortcuts.hpp>
+#include <seqan3/range/container/bitcompressed_vector.hpp>
+#include <seqan3/range/detail/random_access_iterator.hpp>
+#include <seqan3/std/concepts>
+#include <seqan3/std/iterator>
+#include <seqan3/std/ranges>
+
+namespace seqan3
+{
+
+/*!\brief A vector of seqan3::masked letters that stores the base letters bit-packed and the mask as a separate
+ *        bit-plane.
+ * \tparam sequence_alphabet_t The base part of the element type; must satisfy seqan3::Alphabet.
+ * \implements seqan3::reservable_container_concept
+ * \implements seqan3::Cerealisable
+ * \ingroup container
+ *
+ * \details
+ *
+ * This class template behaves like `std::vector<seqan3::masked<sequence_alphabet_t>>`, but instead of storing
+ * one byte per element (of which one bit carries the soft-mask state) it keeps the base letters in a
+ * seqan3::bitcompressed_vector and the mask in an sdsl::bit_vector with one bit per position. For
+ * `masked<dna5>` this reduces the memory footprint from 8 bits per position to 4 (3 for the base letter, 1 for
+ * the mask bit); a masked human genome shrinks from 3GiB to 1.5GiB.
+ *
+ * Element access returns a proxy that models the full seqan3::masked interface, so mask-aware code sees
+ * unified letters. In addition, the separate bit-plane makes "is anything masked in `[i,j)`?" a word-wise scan
+ * (64 positions per machine word, see any_masked() and masked_count()) instead of a letter-wise loop —
+ * repeat-aware seeding can skip over unmasked stretches at memory speed. The plane itself is exposed via
+ * mask_plane(), e.g. for attaching an `sdsl::rank_support_v` once the sequence is frozen.
+ *
+ * ### Thread safety
+ *
+ * This container provides no thread-safety beyond the promise given also by the STL that all
+ * calls to `const` member function are safe from multiple threads (as long as no thread calls
+ * a non-`const` member function at the same time).
+ */
+template <Alphabet sequence_alphabet_t>
+class masked_vector
+{
+public:
+    /*!\name Associated types
+     * \{
+     */
+    //!\brief Equals seqan3::masked over the base alphabet type.
+    using value_type        = masked<sequence_alphabet_t>;
+
+private:
+    //!\brief The bit-packed base letters of all elements.
+    bitcompressed_vector<sequence_alphabet_t> base_data;
+    //!\brief The mask bits of all elements; always of the same size as #base_data.
+    sdsl::bit_vector mask_data;
+
+    //!\brief Proxy data type returned by seqan3::masked_vector as reference to an element; reads combine the
+    //!       base letter and the mask bit into a seqan3::masked, writes split it up again.
+    class reference_proxy_type : public alphabet_proxy<reference_proxy_type, value_type>
+    {
+    private:
+        //!\brief The base type.
+        using base_t = alphabet_proxy<reference_proxy_type, value_type>;
+        //!\brief Befriend the base type so it can call our #on_update().
+        friend base_t;
+
+        //!\brief Pointer to the container the proxied element lives in.
+        masked_vector * host{nullptr};
+        //!\brief Position of the proxied element.
+        size_t pos{0};
+
+        //!\brief Split the new value into base letter and mask bit and store them in the two planes.
+        void on_update() noexcept
+        {
+            value_type const tmp = static_cast<base_t const &>(*this);
+            host->base_data[pos] = get<0>(tmp);
+            host->mask_data[pos] = seqan3::to_rank(get<1>(tmp));
+        }
+
+    public:
+        // Import from base:
+        using base_t::operator=;
+
+        /*!\name Constructors, destructor and assignment
+         * \brief All are explicitly defaulted.
+         * \{
+         */
+        constexpr reference_proxy_type() noexcept : base_t{} {}
+        constexpr reference_proxy_type(reference_proxy_type const &) = default;
+        constexpr reference_proxy_type(reference_proxy_type &&) = default;
+        constexpr reference_proxy_type & operator=(reference_proxy_type const &) = default;
+        constexpr reference_proxy_type & operator=(reference_proxy_type &&) = default;
+        ~reference_proxy_type() = default;
+
+        //!\brief Initialise from the container and the position of the element.
+        reference_proxy_type(masked_vector & host_, size_t const pos_) noexcept :
+            host{&host_}, pos{pos_}
+        {
+            static_cast<base_t &>(*this).assign_rank(to_rank(host_.element_at(pos_)));
+        }
+        //!\}
+    };
+
+    static_assert(Alphabet<reference_proxy_type>);
+    //!\cond
+    template <typename t>
+        requires std::is_same_v<value_type_t<remove_cvref_t<t>>, value_type>
+    static constexpr bool has_same_value_type_v = true;
+    //!\endcond
+
+    //!\brief Combine base letter and mask bit of position `i` into a seqan3::masked value.
+    value_type element_at(size_t const i) const noexcept
+    {
+        return value_type{base_data[i], mask_data[i] ? mask::MASKED : mask::UNMASKED};
+    }
+
+public:
+    //!\brief A proxy type that presents the base letter and the mask bit as one seqan3::masked.
+    using reference         = reference_proxy_type;
+    //!\brief Equals the value_type.
+    using const_reference   = value_type;
+    //!\brief The iterator type of this container (a random access iterator).
+    using iterator          = detail::random_access_iterator<masked_vector>;
+    //!\brief The const_iterator type of this container (a random access iterator).
+    using const_iterator    = detail::random_access_iterator<masked_vector const>;
+    //!\brief A signed integer type (usually std::ptrdiff_t)
+    using difference_type   = std::ptrdiff_t;
+    //!\brief An unsigned integer type (usually std::size_t)
+    using size_type         = size_t;
+    //!\}
+
+    //!\cond
+    // this signals to range-v3 that something is a container :|
+    using allocator_type    = void;
+    //!\endcond
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    masked_vector() = default;
+    masked_vector(masked_vector const &) = default;
+    masked_vector(masked_vector &&) = default;
+    masked_vector & operator=(masked_vector const &) = default;
+    masked_vector & operator=(masked_vector &&) = default;
+    ~masked_vector() = default;
+
+    //!\brief Construct from a range of seqan3::masked values.
+    template <std::ranges::InputRange other_range_t>
+    //!\cond
+        requires has_same_value_type_v<other_range_t>
+    //!\endcond
+    explicit masked_vector(other_range_t && range) :
+        masked_vector{seqan3::begin(range), seqan3::end(range)}
+    {}
+
+    //!\brief Construct with `count` copies of `value`.
+    masked_vector(size_type const count, value_type const value) :
+        base_data(count, get<0>(std::as_const(value))),
+        mask_data(count, seqan3::to_rank(get<1>(std::as_const(value))))
+    {}
+
+    //!\brief Construct from a pair of iterators.
+    template <std::ForwardIterator begin_iterator_type, std::Sentinel<begin_iterator_type> end_iterator_type>
+    masked_vector(begin_iterator_type begin_it, end_iterator_type end_it)
+    //!\cond
+        requires std::CommonReference<value_type_t<begin_iterator_type>, value_type>
+    //!\endcond
+    {
+        insert(cend(), begin_it, end_it);
+    }
+
+    //!\brief Construct from an initialiser list.
+    masked_vector(std::initializer_list<value_type> ilist) :
+        masked_vector(std::begin(ilist), std::end(ilist))
+    {}
+
+    //!\brief Assign from an initialiser list.
+    masked_vector & operator=(std::initializer_list<value_type> ilist)
+    {
+        assign(std::begin(ilist), std::end(ilist));
+        return *this;
+    }
+
+    //!\brief Assign from a range of seqan3::masked values.
+    template <std::ranges::InputRange other_range_t>
+    void assign(other_range_t && range)
+    //!\cond
+        requires std::CommonReference<value_type_t<other_range_t>, value_type>
+    //!\endcond
+    {
+        masked_vector rhs{std::forward<other_range_t>(range)};
+        swap(rhs);
+    }
+
+    //!\brief Assign `count` copies of `value`.
+    void assign(size_type const count, value_type const value)
+    {
+        masked_vector rhs{count, value};
+        swap(rhs);
+    }
+
+    //!\brief Assign from a pair of iterators.
+    template <std::ForwardIterator begin_iterator_type, std::Sentinel<begin_iterator_type> end_iterator_type>
+    void assign(begin_iterator_type begin_it, end_iterator_type end_it)
+    //!\cond
+        requires std::CommonReference<value_type_t<begin_iterator_type>, value_type>
+    //!\endcond
+    {
+        masked_vector rhs{begin_it, end_it};
+        swap(rhs);
+    }
+
+    //!\brief Assign from an initialiser list.
+    void assign(std::initializer_list<value_type> ilist)
+    {
+        assign(std::begin(ilist), std::end(ilist));
+    }
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    //!\brief Returns an iterator to the first element of the container.
+    iterator begin() noexcept
+    {
+        return iterator{*this};
+    }
+
+    //!\copydoc begin()
+    const_iterator begin() const noexcept
+    {
+        return const_iterator{*this};
+    }
+
+    //!\copydoc begin()
+    const_iterator cbegin() const noexcept
+    {
+        return const_iterator{*this};
+    }
+
+    //!\brief Returns an iterator to the element following the last element of the container.
+    iterator end() noexcept
+    {
+        return iterator{*this, size()};
+    }
+
+    //!\copydoc end()
+    const_iterator end() const noexcept
+    {
+        return const_iterator{*this, size()};
+    }
+
+    //!\copydoc end()
+    const_iterator cend() const noexcept
+    {
+        return const_iterator{*this, size()};
+    }
+    //!\}
+
+    /*!\name Bit-plane access
+     * \{
+     */
+    /*!\brief Returns the bit-packed base letters of all elements (without the mask bits).
+     * \returns A reference to the internal seqan3::bitcompressed_vector.
+     *
+     * Algorithms that ignore the soft-mask state (e.g. alignment or index construction) can operate on the
+     * returned container directly, without the mask bits taking up space in between the letters and without a
+     * conversion step.
+     */
+    bitcompressed_vector<sequence_alphabet_t> const & bases() const noexcept
+    {
+        return base_data;
+    }
+
+    /*!\brief Returns the mask bits of all elements (without the base letters).
+     * \returns A reference to the internal sdsl::bit_vector; bit `i` is set iff element `i` is masked.
+     *
+     * The plane can be fed to the SDSL's succinct helpers, e.g. attach an `sdsl::rank_support_v` to answer
+     * "how many masked positions before `i`?" in constant time once the sequence is frozen (such a structure
+     * is not maintained here, because it would have to be rebuilt after every write).
+     */
+    sdsl::bit_vector const & mask_plane() const noexcept
+    {
+        return mask_data;
+    }
+
+    /*!\brief Whether any element in the range `[first, last)` is masked.
+     * \param[in] first Begin of the queried range.
+     * \param[in]  last Behind the end of the queried range; must be `>= first` and `<= size()`.
+     * \returns `true` iff at least one mask bit in the range is set.
+     *
+     * The mask plane is scanned one machine word (64 positions) at a time, i.e. a repeat-aware seeding loop
+     * can test a whole seed window against the soft-mask with a handful of loads.
+     *
+     * ### Complexity
+     *
+     * Linear in `(last - first) / 64`.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    bool any_masked(size_type const first, size_type const last) const noexcept
+    {
+        assert(first <= last && last <= size());
+
+        size_type i = first;
+        for (; i + 64 <= last; i += 64)
+            if (mask_data.get_int(i, 64) != 0u)
+                return true;
+
+        return (i < last) && (mask_data.get_int(i, last - i) != 0u);
+    }
+
+    /*!\brief The number of masked elements in the range `[first, last)`.
+     * \param[in] first Begin of the queried range.
+     * \param[in]  last Behind the end of the queried range; must be `>= first` and `<= size()`.
+     * \returns The number of set mask bits in the range.
+     * \copydetails any_masked()
+     */
+    size_type masked_count(size_type const first, size_type const last) const noexcept
+    {
+        assert(first <= last && last <= size());
+
+        size_type count = 0;
+        size_type i = first;
+        for (; i + 64 <= last; i += 64)
+            count += sdsl::bits::cnt(mask_data.get_int(i, 64));
+
+        if (i < last)
+            count += sdsl::bits::cnt(mask_data.get_int(i, last - i));
+
+        return count;
+    }
+    //!\}
+
+    /*!\name Element access
+     * \{
+     */
+    //!\brief Return the i-th element; writing through the returned proxy updates both planes.
+    reference operator[](size_type const i) noexcept
+    {
+        assert(i < size());
+        return {*this, i};
+    }
+
+    //!\brief Return the i-th element.
+    const_reference operator[](size_type const i) const noexcept
+    {
+        assert(i < size());
+        return element_at(i);
+    }
+
+    //!\brief Return the i-th element; throws std::out_of_range if `i >= size()`.
+    reference at(size_type const i)
+    {
+        if (i >= size()) // [[unlikely]]
+            throw std::out_of_range{"Trying to access element behind the last in masked_vector."};
+        return (*this)[i];
+    }
+
+    //!\copydoc at()
+    const_reference at(size_type const i) const
+    {
+        if (i >= size()) // [[unlikely]]
+            throw std::out_of_range{"Trying to access element behind the last in masked_vector."};
+        return (*this)[i];
+    }
+
+    //!\brief Return the first element. Calling this on an empty container is undefined behaviour.
+    reference front() noexcept
+    {
+        assert(size() > 0);
+        return (*this)[0];
+    }
+
+    //!\copydoc front()
+    const_reference front() const noexcept
+    {
+        assert(size() > 0);
+        return (*this)[0];
+    }
+
+    //!\brief Return the last element. Calling this on an empty container is undefined behaviour.
+    reference back() noexcept
+    {
+        assert(size() > 0);
+        return (*this)[size() - 1];
+    }
+
+    //!\copydoc back()
+    const_reference back() const noexcept
+    {
+        assert(size() > 0);
+        return (*this)[size() - 1];
+    }
+    //!\}
+
+    /*!\name Capacity
+     * \{
+     */
+    //!\brief Checks whether the container is empty.
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    //!\brief Returns the number of elements in the container.
+    size_type size() const noexcept
+    {
+        assert(base_data.size() == mask_data.size());
+        return base_data.size();
+    }
+
+    //!\brief Returns the maximum number of elements the container is able to hold.
+    size_type max_size() const noexcept
+    {
+        return std::min<size_type>(base_data.max_size(), mask_data.max_size());
+    }
+
+    //!\brief Returns the number of elements that the container has currently allocated space for.
+    size_type capacity() const noexcept
+    {
+        return std::min<size_type>(base_data.capacity(), mask_data.capacity());
+    }
+
+    //!\brief Increase the capacity to a value that's greater or equal to new_cap.
+    void reserve(size_type const new_cap)
+    {
+        base_data.reserve(new_cap);
+        mask_data.reserve(new_cap);
+    }
+
+    //!\brief Requests the removal of unused capacity.
+    void shrink_to_fit()
+    {
+        base_data.shrink_to_fit();
+        mask_data.shrink_to_fit();
+    }
+    //!\}
+
+    /*!\name Modifiers
+     * \{
+     */
+    //!\brief Removes all elements from the container.
+    void clear() noexcept
+    {
+        base_data.clear();
+        mask_data.clear();
+    }
+
+    //!\brief Inserts `value` before position in the container.
+    iterator insert(const_iterator pos, value_type const value)
+    {
+        return insert(pos, 1, value);
+    }
+
+    //!\brief Inserts `count` copies of `value` before position in the container.
+    iterator insert(const_iterator pos, size_type const count, value_type const value)
+    {
+        auto const pos_as_num = std::distance(cbegin(), pos); // we want to insert BEFORE this position
+
+        base_data.insert(base_data.cbegin() + pos_as_num, count, get<0>(std::as_const(value)));
+        mask_data.insert(mask_data.begin() + pos_as_num, count, seqan3::to_rank(get<1>(std::as_const(value))));
+
+        return begin() + pos_as_num;
+    }
+
+    /*!\brief Inserts elements from range `[begin_it, end_it)` before position in the container.
+     *
+     * The behaviour is undefined if begin_it and end_it are iterators into `*this`. The range is traversed
+     * twice (it is a forward range), once per plane.
+     */
+    template <std::ForwardIterator begin_iterator_type, std::Sentinel<begin_iterator_type> end_iterator_type>
+    iterator insert(const_iterator pos, begin_iterator_type begin_it, end_iterator_type end_it)
+    //!\cond
+        requires std::CommonReference<value_type_t<begin_iterator_type>, value_type>
+    //!\endcond
+    {
+        auto const pos_as_num = std::distance(cbegin(), pos);
+
+        auto v = std::ranges::subrange<begin_iterator_type, end_iterator_type>{begin_it, end_it};
+        auto v_base = v | std::view::transform([] (auto const & in)
+                          { return get<0>(std::as_const(static_cast<value_type const>(in))); });
+        auto v_mask = v | std::view::transform([] (auto const & in) -> uint64_t
+                          { return seqan3::to_rank(get<1>(std::as_const(static_cast<value_type const>(in)))); });
+
+        base_data.insert(base_data.cbegin() + pos_as_num, seqan3::begin(v_base), seqan3::end(v_base));
+        mask_data.insert(mask_data.begin() + pos_as_num, seqan3::begin(v_mask), seqan3::end(v_mask));
+
+        return begin() + pos_as_num;
+    }
+
+    //!\brief Inserts elements from an initialiser list before position in the container.
+    iterator insert(const_iterator pos, std::initializer_list<value_type> const & ilist)
+    {
+        return insert(pos, ilist.begin(), ilist.end());
+    }
+
+    //!\brief Removes the elements in the range `[begin_it, end_it)` from the container.
+    iterator erase(const_iterator begin_it, const_iterator end_it)
+    {
+        if (begin_it >= end_it) // [[unlikely]]
+            return begin() + std::distance(cbegin(), end_it);
+
+        auto const begin_it_pos = std::distance(cbegin(), begin_it);
+        auto const end_it_pos = std::distance(cbegin(), end_it);
+
+        base_data.erase(base_data.cbegin() + begin_it_pos,
+                        base_data.cbegin() + end_it_pos);
+        mask_data.erase(mask_data.begin() + begin_it_pos,
+                        mask_data.begin() + end_it_pos);
+
+        return begin() + begin_it_pos;
+    }
+
+    //!\brief Removes the element at `pos` from the container.
+    iterator erase(const_iterator pos)
+    {
+        return erase(pos, pos + 1);
+    }
+
+    //!\brief Appends the given element value to the end of the container.
+    void push_back(value_type const value)
+    {
+        push_back(get<0>(std::as_const(value)), get<1>(std::as_const(value)));
+    }
+
+    /*!\brief Appends an element given as its base letter and mask letter to the end of the container.
+     * \param base The base letter of the new element.
+     * \param    m The mask letter of the new element.
+     *
+     * Convenience overload for producers (e.g. file parsers) that have the two parts at hand separately, so
+     * they do not need to combine them into a seqan3::masked only for it to be split up again.
+     */
+    void push_back(sequence_alphabet_t const base, mask const m)
+    {
+        base_data.push_back(base);
+        mask_data.push_back(seqan3::to_rank(m));
+    }
+
+    //!\brief Removes the last element of the container. Calling this on an empty container is undefined behaviour.
+    void pop_back()
+    {
+        assert(size() > 0);
+        base_data.pop_back();
+        mask_data.pop_back();
+    }
+
+    //!\brief Resizes the container to contain `count` elements (new elements are value-initialised).
+    void resize(size_type const count)
+    {
+        assert(count < max_size());
+        base_data.resize(count);
+        mask_data.resize(count);
+    }
+
+    //!\copybrief resize()
+    //!\param value Append copies of `value` when resizing.
+    void resize(size_type const count, value_type const value)
+    {
+        assert(count < max_size());
+        base_data.resize(count, get<0>(std::as_const(value)));
+        mask_data.resize(count, seqan3::to_rank(get<1>(std::as_const(value))));
+    }
+
+    //!\brief Swap contents with another instance.
+    void swap(masked_vector & rhs) noexcept
+    {
+        std::swap(base_data, rhs.base_data);
+        std::swap(mask_data, rhs.mask_data);
+    }
+
+    //!\copydoc swap()
+    void swap(masked_vector && rhs) noexcept
+    {
+        std::swap(base_data, rhs.base_data);
+        std::swap(mask_data, rhs.mask_data);
+    }
+    //!\}
+
+    //!\brief Swap contents of two instances.
+    friend void swap(masked_vector & lhs, masked_vector & rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+
+    //!\overload
+    friend void swap(masked_vector && lhs, masked_vector && rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+
+    /*!\name Comparison operators
+     * \{
+     */
+    //!\brief Checks whether `*this` is equal to `rhs`.
+    bool operator==(masked_vector const & rhs) const noexcept
+    {
+        return base_data == rhs.base_data && mask_data == rhs.mask_data;
+    }
+
+    //!\brief Checks whether `*this` is not equal to `rhs`.
+    bool operator!=(masked_vector const & rhs) const noexcept
+    {
+        return !(*this == rhs);
+    }
+
+    //!\brief Checks whether `*this` is less than `rhs` (element-wise lexicographically; the base letter is the
+    //!       most significant component of the rank of seqan3::masked).
+    bool operator<(masked_vector const & rhs) const noexcept
+    {
+        return compare_element_wise(rhs) < 0;
+    }
+
+    //!\copydoc operator<()
+    bool operator>(masked_vector const & rhs) const noexcept
+    {
+        return compare_element_wise(rhs) > 0;
+    }
+
+    //!\copydoc operator<()
+    bool operator<=(masked_vector const & rhs) const noexcept
+    {
+        return compare_element_wise(rhs) <= 0;
+    }
+
+    //!\copydoc operator<()
+    bool operator>=(masked_vector const & rhs) const noexcept
+    {
+        return compare_element_wise(rhs) >= 0;
+    }
+    //!\}
+
+    /*!\cond DEV
+     * \brief Serialisation support function.
+     * \tparam archive_t Type of `archive`; must satisfy seqan3::CerealArchive.
+     * \param archive The archive being serialised from/to.
+     *
+     * The mask plane is archived as one aligned binary blob in host byte order, like for
+     * seqan3::bitcompressed_vector.
+     *
+     * \attention These functions are never called directly, see \ref serialisation for more details.
+     */
+    template <CerealArchive archive_t>
+    void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+    {
+#if SEQAN3_WITH_CEREAL
+        archive(base_data);
+
+        uint64_t size = mask_data.size();
+        archive(size);
+        mask_data.resize(size); // no-op when storing, allocates the plane when loading
+
+        uint64_t const word_count = (size + 63) / 64;
+        archive(cereal::binary_data(mask_data.data(), word_count * sizeof(uint64_t)));
+#endif
+    }
+    //!\endcond
+
+private:
+    //!\brief Lexicographic three-way comparison on the element values (base letter before mask bit, matching
+    //!       the rank order of seqan3::masked); used by the comparison operators.
+    int compare_element_wise(masked_vector const & rhs) const noexcept
+    {
+        size_type const common = std::min(size(), rhs.size());
+        for (size_type i = 0; i < common; ++i)
+        {
+            if (sequence_alphabet_t const l = base_data[i], r = rhs.base_data[i]; l != r)
+                return l < r ? -1 : 1;
+            if (mask_data[i] != rhs.mask_data[i])
+                return mask_data[i] < rhs.mask_data[i] ? -1 : 1;
+        }
+
+        if (size() != rhs.size())
+            return size() < rhs.size() ? -1 : 1;
+        return 0;
+    }
+};
+
+} // namespace seqan3
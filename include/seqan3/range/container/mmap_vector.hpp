@@ -0,0 +1,436 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::mmap_vector.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <seqan3/io/detail/mmap_istream.hpp> // defines SEQAN3_HAS_MMAP on supported platforms
+
+namespace seqan3
+{
+
+#ifdef SEQAN3_HAS_MMAP
+
+/*!\brief A contiguous, growable container backed by an anonymous memory mapping; elements never move.
+ * \tparam value_t The value type; must be trivially copyable and trivially destructible.
+ * \ingroup container
+ *
+ * \details
+ *
+ * A reallocating vector doubles its allocation when it grows and copies every element across, so the
+ * peak memory of filling it is up to three times the final size. This container instead reserves a
+ * large stretch of inaccessible address space up front (which is free on 64-bit platforms) and merely
+ * makes pages accessible as the size grows: growth never copies, `data()` never changes, iterators are
+ * never invalidated by push_back(), and the physical memory curve follows the number of elements
+ * actually written. This makes it suitable for accumulating very large result sets, e.g. the text
+ * positions of locate-heavy index searches.
+ *
+ * The capacity is fixed at the address space reservation (see the constructor taking a capacity);
+ * exceeding it throws std::length_error. Physical pages are only allocated by the operating system
+ * when an element is first written, committing ahead of the size costs nothing but bookkeeping.
+ *
+ * On platforms without memory mapping the container falls back to a plain std::vector, i.e. it stays
+ * usable but growth reallocates and the reservation is only a hint.
+ */
+template <typename value_t>
+//!\cond
+    requires std::is_trivially_copyable_v<value_t> && std::is_trivially_destructible_v<value_t>
+//!\endcond
+class mmap_vector
+{
+public:
+    /*!\name Member types
+     * \{
+     */
+    //!\brief The value type.
+    using value_type = value_t;
+    //!\brief The reference type.
+    using reference = value_type &;
+    //!\brief The const reference type.
+    using const_reference = value_type const &;
+    //!\brief The iterator type (a plain pointer, the storage is contiguous).
+    using iterator = value_type *;
+    //!\brief The const iterator type (a plain pointer, the storage is contiguous).
+    using const_iterator = value_type const *;
+    //!\brief An unsigned integer type.
+    using size_type = size_t;
+    //!\brief A signed integer type.
+    using difference_type = ptrdiff_t;
+    //!\}
+
+    //!\brief The default address space reservation in bytes (1 TiB; halved until the reservation succeeds).
+    static constexpr size_type default_reserve_bytes = size_type{1} << 40;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    //!\brief Default constructor; the address space is reserved lazily on first growth.
+    mmap_vector() = default;
+
+    /*!\brief Construct with an explicit address space reservation.
+     * \param[in] capacity The maximum number of elements the container shall ever hold.
+     * \throws std::bad_alloc if the address space cannot be reserved.
+     *
+     * Reserving address space allocates no memory; generous values are cheap.
+     */
+    explicit mmap_vector(size_type const capacity)
+    {
+        reserve_address_space(capacity * sizeof(value_type));
+    }
+
+    //!\brief Copy constructor (copies the elements into a reservation of the same extent).
+    mmap_vector(mmap_vector const & other)
+    {
+        if (other.storage == nullptr)
+            return;
+
+        reserve_address_space(other.reserved_bytes);
+        commit(other.element_count * sizeof(value_type));
+        std::memcpy(storage, other.storage, other.element_count * sizeof(value_type));
+        element_count = other.element_count;
+    }
+
+    //!\brief Move constructor; the stolen-from container is empty and unreserved afterwards.
+    mmap_vector(mmap_vector && other) noexcept :
+        storage{std::exchange(other.storage, nullptr)},
+        element_count{std::exchange(other.element_count, 0)},
+        committed_bytes{std::exchange(other.committed_bytes, 0)},
+        reserved_bytes{std::exchange(other.reserved_bytes, 0)}
+    {}
+
+    //!\brief Copy assignment.
+    mmap_vector & operator=(mmap_vector const & other)
+    {
+        if (this != &other)
+        {
+            mmap_vector tmp{other};
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    //!\brief Move assignment; the stolen-from container is empty and unreserved afterwards.
+    mmap_vector & operator=(mmap_vector && other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            storage = std::exchange(other.storage, nullptr);
+            element_count = std::exchange(other.element_count, 0);
+            committed_bytes = std::exchange(other.committed_bytes, 0);
+            reserved_bytes = std::exchange(other.reserved_bytes, 0);
+        }
+        return *this;
+    }
+
+    //!\brief Destructor; returns the address space to the operating system.
+    ~mmap_vector()
+    {
+        release();
+    }
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    //!\brief Returns an iterator to the first element.
+    iterator begin() noexcept { return storage; }
+    //!\copydoc begin()
+    const_iterator begin() const noexcept { return storage; }
+    //!\copydoc begin()
+    const_iterator cbegin() const noexcept { return storage; }
+    //!\brief Returns an iterator behind the last element.
+    iterator end() noexcept { return storage + element_count; }
+    //!\copydoc end()
+    const_iterator end() const noexcept { return storage + element_count; }
+    //!\copydoc end()
+    const_iterator cend() const noexcept { return storage + element_count; }
+    //!\}
+
+    /*!\name Element access
+     * \{
+     */
+    //!\brief Returns the i-th element (no bounds checking).
+    reference operator[](size_type const i) noexcept { return storage[i]; }
+    //!\copydoc operator[]
+    const_reference operator[](size_type const i) const noexcept { return storage[i]; }
+
+    /*!\brief Returns the i-th element.
+     * \throws std::out_of_range if `i >= size()`.
+     */
+    reference at(size_type const i)
+    {
+        if (i >= element_count)
+            throw std::out_of_range{"Trying to access an element behind the last one."};
+        return storage[i];
+    }
+
+    //!\copydoc at()
+    const_reference at(size_type const i) const
+    {
+        if (i >= element_count)
+            throw std::out_of_range{"Trying to access an element behind the last one."};
+        return storage[i];
+    }
+
+    //!\brief Returns the first element.
+    reference front() noexcept { return storage[0]; }
+    //!\copydoc front()
+    const_reference front() const noexcept { return storage[0]; }
+    //!\brief Returns the last element.
+    reference back() noexcept { return storage[element_count - 1]; }
+    //!\copydoc back()
+    const_reference back() const noexcept { return storage[element_count - 1]; }
+    //!\brief Returns a pointer to the underlying contiguous storage; stable across growth.
+    value_type * data() noexcept { return storage; }
+    //!\copydoc data()
+    value_type const * data() const noexcept { return storage; }
+    //!\}
+
+    /*!\name Capacity
+     * \{
+     */
+    //!\brief Whether the container holds no elements.
+    bool empty() const noexcept { return element_count == 0; }
+    //!\brief The number of elements.
+    size_type size() const noexcept { return element_count; }
+    //!\brief The number of elements the reserved address space can hold (0 before the first growth).
+    size_type capacity() const noexcept { return reserved_bytes / sizeof(value_type); }
+    //!\copydoc capacity()
+    size_type max_size() const noexcept { return capacity(); }
+
+    /*!\brief Make at least the given number of elements accessible ahead of time.
+     * \throws std::length_error if \p new_capacity exceeds the reserved address space.
+     * \throws std::bad_alloc if reserving or committing fails.
+     *
+     * Unlike a reallocating vector this never moves elements; it only commits pages of the existing
+     * reservation (physical memory is still only allocated when the pages are first written).
+     */
+    void reserve(size_type const new_capacity)
+    {
+        if (storage == nullptr)
+            reserve_address_space(std::max(new_capacity * sizeof(value_type), default_reserve_bytes));
+        commit(new_capacity * sizeof(value_type));
+    }
+
+    /*!\brief Return the physical memory of pages behind the current size to the operating system.
+     *
+     * The address space reservation (and thereby capacity()) is unchanged.
+     */
+    void shrink_to_fit()
+    {
+        if (storage == nullptr)
+            return;
+
+        size_type const used = round_up_to_page(element_count * sizeof(value_type));
+        if (used < committed_bytes)
+        {
+            ::mprotect(reinterpret_cast<char *>(storage) + used, committed_bytes - used, PROT_NONE);
+            ::madvise(reinterpret_cast<char *>(storage) + used, committed_bytes - used, MADV_DONTNEED);
+            committed_bytes = used;
+        }
+    }
+    //!\}
+
+    /*!\name Modifiers
+     * \{
+     */
+    //!\brief Removes all elements (pages stay committed; see shrink_to_fit()).
+    void clear() noexcept { element_count = 0; }
+
+    /*!\brief Appends an element.
+     * \throws std::length_error if the reserved address space is exhausted.
+     * \throws std::bad_alloc if reserving or committing fails.
+     *
+     * Amortised constant; never moves existing elements and never invalidates iterators or data().
+     */
+    void push_back(value_type const & value)
+    {
+        grow_to_hold(element_count + 1);
+        storage[element_count] = value;
+        ++element_count;
+    }
+
+    //!\copydoc push_back()
+    template <typename ...args_t>
+    reference emplace_back(args_t && ...args)
+    {
+        grow_to_hold(element_count + 1);
+        storage[element_count] = value_type(std::forward<args_t>(args)...);
+        return storage[element_count++];
+    }
+
+    //!\brief Removes the last element.
+    void pop_back() noexcept { --element_count; }
+
+    /*!\brief Resizes the container to hold `new_size` elements.
+     * \throws std::length_error if \p new_size exceeds the reserved address space.
+     * \throws std::bad_alloc if reserving or committing fails.
+     *
+     * New elements are value-initialised (respectively copies of \p value).
+     */
+    void resize(size_type const new_size)
+    {
+        resize(new_size, value_type{});
+    }
+
+    //!\copydoc resize()
+    void resize(size_type const new_size, value_type const & value)
+    {
+        if (new_size > element_count)
+        {
+            grow_to_hold(new_size);
+            std::fill(storage + element_count, storage + new_size, value);
+        }
+        element_count = new_size;
+    }
+
+    //!\brief Swaps the contents with another container.
+    void swap(mmap_vector & other) noexcept
+    {
+        std::swap(storage, other.storage);
+        std::swap(element_count, other.element_count);
+        std::swap(committed_bytes, other.committed_bytes);
+        std::swap(reserved_bytes, other.reserved_bytes);
+    }
+    //!\}
+
+    /*!\name Comparison operators
+     * \{
+     */
+    //!\brief Whether both containers hold the same elements.
+    friend bool operator==(mmap_vector const & lhs, mmap_vector const & rhs) noexcept
+    {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    //!\brief Whether the containers hold different elements.
+    friend bool operator!=(mmap_vector const & lhs, mmap_vector const & rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+    //!\}
+
+private:
+    //!\brief Rounds a byte count up to a multiple of the page size.
+    static size_type round_up_to_page(size_type const bytes) noexcept
+    {
+        static size_type const page_size = ::sysconf(_SC_PAGESIZE);
+        return (bytes + page_size - 1) / page_size * page_size;
+    }
+
+    /*!\brief Reserve (inaccessible) address space of at least the given number of bytes.
+     * \throws std::bad_alloc if no reservation of at least one page succeeds.
+     *
+     * The requested extent is halved until the kernel grants it, so the default reservation also works
+     * under tight address space limits.
+     */
+    void reserve_address_space(size_type bytes)
+    {
+        bytes = round_up_to_page(std::max<size_type>(bytes, 1u));
+
+        while (true)
+        {
+            void * const mapping = ::mmap(nullptr, bytes, PROT_NONE,
+                                          MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+            if (mapping != MAP_FAILED)
+            {
+                storage = reinterpret_cast<value_type *>(mapping);
+                reserved_bytes = bytes;
+                return;
+            }
+
+            if (bytes <= round_up_to_page(1u))
+                throw std::bad_alloc{};
+            bytes /= 2;
+        }
+    }
+
+    /*!\brief Make the first `bytes` bytes of the reservation readable and writable.
+     * \throws std::length_error if \p bytes exceeds the reservation.
+     * \throws std::bad_alloc if the kernel refuses the protection change.
+     */
+    void commit(size_type const bytes)
+    {
+        if (bytes <= committed_bytes)
+            return;
+
+        if (bytes > reserved_bytes)
+            throw std::length_error{"The reserved address space of this mmap_vector is exhausted."};
+
+        // committing doubles to keep the number of mprotect calls logarithmic; untouched pages cost nothing
+        size_type const target = std::min(reserved_bytes,
+                                          std::max(round_up_to_page(bytes),
+                                                   std::min(committed_bytes * 2, reserved_bytes)));
+
+        if (::mprotect(storage, target, PROT_READ | PROT_WRITE) != 0)
+            throw std::bad_alloc{};
+
+        committed_bytes = target;
+    }
+
+    //!\brief Reserve (if still unreserved) and commit storage for the given number of elements.
+    void grow_to_hold(size_type const count)
+    {
+        if (storage == nullptr)
+            reserve_address_space(std::max(count * sizeof(value_type), default_reserve_bytes));
+        commit(count * sizeof(value_type));
+    }
+
+    //!\brief Unmap the reservation (no-op on a default constructed or moved-from container).
+    void release() noexcept
+    {
+        if (storage != nullptr)
+        {
+            ::munmap(storage, reserved_bytes);
+            storage = nullptr;
+            element_count = 0;
+            committed_bytes = 0;
+            reserved_bytes = 0;
+        }
+    }
+
+    //!\brief The start of the address space reservation.
+    value_type * storage{nullptr};
+    //!\brief The number of elements.
+    size_type element_count{0};
+    //!\brief The number of bytes currently accessible.
+    size_type committed_bytes{0};
+    //!\brief The extent of the address space reservation in bytes.
+    size_type reserved_bytes{0};
+};
+
+#else // no memory mapping: fall back to a reallocating vector with the same interface
+
+//!\cond
+template <typename value_t>
+    requires std::is_trivially_copyable_v<value_t> && std::is_trivially_destructible_v<value_t>
+class mmap_vector : public std::vector<value_t>
+{
+public:
+    using size_type = typename std::vector<value_t>::size_type;
+
+    mmap_vector() = default;
+    explicit mmap_vector(size_type const) {} // the address space reservation is only a hint here
+};
+//!\endcond
+
+#endif // SEQAN3_HAS_MMAP
+
+} // namespace seqan3
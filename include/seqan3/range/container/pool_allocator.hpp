@@ -0,0 +1,292 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Contains seqan3::pool_allocator.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include <seqan3/core/bit_manipulation.hpp>
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief The shared backend of seqan3::pool_allocator: thread-local free lists over process-owned slabs.
+ * \ingroup container
+ *
+ * \details
+ *
+ * The state deliberately lives outside the allocator class template, such that all instantiations of
+ * seqan3::pool_allocator (including rebound ones) draw from the same per-thread pools and a block freed
+ * through a differently typed allocator handle still lands in the free list of its size class.
+ */
+struct pool_memory
+{
+    //!\brief The smallest pooled block size; also the guaranteed alignment of pooled blocks.
+    static constexpr size_t min_block_size = 16;
+    //!\brief The largest pooled request in bytes; larger requests go to the global heap.
+    static constexpr size_t max_pooled_size = 4096;
+    //!\brief The number of bytes carved out of the heap per slab.
+    static constexpr size_t slab_size = size_t{1} << 16; // 64KiB
+    //!\brief The number of power-of-two size classes between min_block_size and max_pooled_size.
+    static constexpr size_t class_count = floor_log2(max_pooled_size) - floor_log2(min_block_size) + 1;
+
+    //!\brief Returns the size class index of a request of the given number of bytes.
+    static constexpr size_t class_of(size_t const bytes) noexcept
+    {
+        return floor_log2(next_power_of_two(std::max(bytes, min_block_size))) - floor_log2(min_block_size);
+    }
+
+    /*!\brief Takes a block of the size class of `bytes` from the pools of the calling thread.
+     * \throws std::bad_alloc if a new slab is needed and cannot be allocated.
+     */
+    static void * allocate_block(size_t const bytes)
+    {
+        size_t const class_index = class_of(bytes);
+        thread_state & state = local_state();
+
+        if (void * const head = state.free_heads[class_index]; head != nullptr)
+        {
+            state.free_heads[class_index] = *static_cast<void **>(head); // pop the block off the free list
+            return head;
+        }
+
+        size_t const block_size = min_block_size << class_index;
+        if (state.bump[class_index] + block_size > state.end[class_index])
+        {
+            // The current slab of this class is exhausted; carve the next one and register it globally.
+            char * const slab = static_cast<char *>(::operator new(slab_size));
+            {
+                slab_registry & registry = global_registry();
+                std::unique_lock<std::mutex> lock{registry.mutex};
+                registry.slabs.push_back(slab);
+            }
+            state.bump[class_index] = slab;
+            state.end[class_index] = slab + slab_size;
+        }
+
+        char * const block = state.bump[class_index];
+        state.bump[class_index] += block_size;
+        return block;
+    }
+
+    //!\brief Pushes a block of the size class of `bytes` onto the free list of the calling thread.
+    static void deallocate_block(void * const block, size_t const bytes) noexcept
+    {
+        thread_state & state = local_state();
+        size_t const class_index = class_of(bytes);
+        *static_cast<void **>(block) = state.free_heads[class_index]; // push the block onto the free list
+        state.free_heads[class_index] = block;
+    }
+
+private:
+    //!\brief The free lists and slab cursors of one thread, one entry per size class.
+    struct thread_state
+    {
+        //!\brief The head of the free list of each size class; the blocks link through their first bytes.
+        std::array<void *, class_count> free_heads{};
+        //!\brief The bump pointer into the current slab of each size class.
+        std::array<char *, class_count> bump{};
+        //!\brief The end of the current slab of each size class.
+        std::array<char *, class_count> end{};
+    };
+
+    //!\brief Owns all slabs ever carved; freed at program termination.
+    struct slab_registry
+    {
+        //!\brief The mutex protecting #slabs.
+        std::mutex mutex{};
+        //!\brief All slabs carved by any thread.
+        std::vector<char *> slabs{};
+
+        //!\brief Returns the slab memory to the heap.
+        ~slab_registry()
+        {
+            for (char * const slab : slabs)
+                ::operator delete(slab);
+        }
+    };
+
+    //!\brief Returns the pools of the calling thread.
+    static thread_state & local_state() noexcept
+    {
+        static thread_local thread_state state{};
+        return state;
+    }
+
+    //!\brief Returns the process-wide slab registry.
+    static slab_registry & global_registry() noexcept
+    {
+        static slab_registry registry{};
+        return registry;
+    }
+};
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+/*!\brief Serves small allocations from thread-local slabs of pooled blocks.
+ * \tparam value_t \copydoc pool_allocator::value_type
+ * \ingroup container
+ *
+ * \details
+ *
+ * Record parsing, per-query hit collection and result assembly make many small, short-lived heap
+ * allocations; going through the general-purpose heap for each of them costs a significant share of the
+ * per-record time. This allocator rounds every request of at most \ref max_pooled_size bytes up to a
+ * power-of-two size class and serves it from a thread-local pool: freed blocks are kept in a per-class
+ * free list and reused directly, and when a free list runs empty, blocks are carved out of a slab with a
+ * plain pointer bump. Larger requests are passed through to the global heap unchanged, and whether an
+ * allocation was pooled is decided by its size alone, so the allocator itself remains a stateless handle.
+ *
+ * Since the free lists are thread local, the steady-state allocate/deallocate pair is free of any
+ * synchronisation; only carving a new slab takes a lock to register it. Blocks may be freed by a different
+ * thread than the one that allocated them (they then continue their life in the free list of the freeing
+ * thread); this is safe because the slabs are owned by a process-wide registry and live until program
+ * termination — the memory held by the pools is therefore never returned to the operating system, which
+ * is the intended trade-off for allocation patterns that reach a steady state quickly.
+ *
+ * The pooled block sizes are multiples of \ref min_block_size bytes carved from `operator new`ed slabs,
+ * hence every block is suitably aligned for types with fundamental alignment; over-aligned value types are
+ * rejected at compile time (use seqan3::aligned_allocator for those).
+ *
+ * \see seqan3::aligned_allocator
+ * \see seqan3::hugepage_allocator
+ */
+template <typename value_t>
+class pool_allocator
+{
+public:
+    //!\brief The smallest pooled block size; also the guaranteed alignment of pooled blocks.
+    static constexpr size_t min_block_size = detail::pool_memory::min_block_size;
+    //!\brief The largest pooled request in bytes; larger requests go to the global heap.
+    static constexpr size_t max_pooled_size = detail::pool_memory::max_pooled_size;
+
+    static_assert(alignof(value_t) <= alignof(std::max_align_t),
+                  "The pool_allocator does not support over-aligned value types.");
+
+    //!\brief The value type of the allocation
+    using value_type = value_t;
+    //!\brief The pointer type of the allocation
+    using pointer = value_type *;
+    //!\brief The difference type of the allocation
+    using difference_type = typename std::pointer_traits<pointer>::difference_type;
+    //!\brief The size type of the allocation
+    using size_type = std::make_unsigned_t<difference_type>;
+
+    //!\brief Are any two allocators of the same pool_allocator type always compare equal?
+    using is_always_equal = std::true_type;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    pool_allocator() = default;
+    pool_allocator(pool_allocator const &) = default;
+    pool_allocator(pool_allocator &&) = default;
+    pool_allocator & operator=(pool_allocator const &) = default;
+    pool_allocator & operator=(pool_allocator &&) = default;
+    ~pool_allocator() = default;
+
+    template <class other_value_type>
+    constexpr pool_allocator(pool_allocator<other_value_type> const &) noexcept
+    {}
+    //!\}
+
+    /*!\brief Allocates `n * sizeof(T)` bytes of uninitialized storage.
+     * \throws Throws std::bad_alloc if allocation fails.
+     *
+     * \details
+     *
+     * Requests of at most \ref max_pooled_size bytes are served from the thread-local pool of the rounded-up
+     * power-of-two size class — from its free list if possible, by bumping the slab pointer otherwise.
+     * Larger requests delegate to the global `operator new`.
+     *
+     * \sa https://en.cppreference.com/w/cpp/memory/allocator/allocate
+     */
+    [[nodiscard]]
+    pointer allocate(size_type const n)
+    {
+        constexpr size_type max_size = std::numeric_limits<size_type>::max() / sizeof(value_type);
+        if (n > max_size)
+            throw std::bad_alloc();
+
+        size_t const bytes = n * sizeof(value_type);
+        if (bytes > max_pooled_size)
+            return static_cast<pointer>(::operator new(bytes));
+
+        return static_cast<pointer>(detail::pool_memory::allocate_block(bytes));
+    }
+
+    /*!\brief Deallocates the storage referenced by the pointer p, which must be a pointer obtained by an earlier call
+     * to allocate().
+     * \details
+     *
+     * The argument n must be equal to the first argument of the call to allocate() that originally produced p;
+     * otherwise, the behavior is undefined. The size decides whether the block is pushed onto the free list of
+     * its size class (of the calling thread) or returned to the global heap.
+     *
+     * \sa https://en.cppreference.com/w/cpp/memory/allocator/deallocate
+     */
+    void deallocate(pointer const p, size_type const n) noexcept
+    {
+        size_t const bytes = n * sizeof(value_type);
+        if (bytes > max_pooled_size)
+        {
+            ::operator delete(p);
+            return;
+        }
+
+        detail::pool_memory::deallocate_block(p, bytes);
+    }
+
+    /*!\brief The pool_allocator member template class pool_allocator::rebind provides a way to obtain an
+     * allocator for a different type.
+     * \tparam new_value_type The other value type.
+     */
+    template <typename new_value_type>
+    struct rebind
+    {
+        //!\brief The type of the allocator for a different value type.
+        using other = pool_allocator<new_value_type>;
+    };
+
+    /*!\name Comparison operators
+     * \{
+     */
+    //!\brief Always returns true; all pool allocators share the thread-local pools.
+    template <class value_type2>
+    constexpr bool operator==(pool_allocator<value_type2> const &) noexcept
+    {
+        return true;
+    }
+
+    //!\brief Always returns false; all pool allocators share the thread-local pools.
+    template <class value_type2>
+    constexpr bool operator!=(pool_allocator<value_type2> const &) noexcept
+    {
+        return false;
+    }
+    //!\}
+
+};
+
+} // namespace seqan3
@@ -0,0 +1,1107 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::qualified_vector.
+ * \author Hannes Hauswedell <hannes.hauswedell AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include <seqan3/alphabet/detail/alphabet_proxy.hpp>
+#include <seqan3/alphabet/detail/member_exposure.hpp>
+#include <seqan3/alphabet/quality/qualified.hpp>
+#include <seqan3/core/concept/cereal.hpp>
+#include <seqan3/core/metafunction/all.hpp>
+#include <seqan3/range/shortcuts.hpp>
+#include <seqan3/range/detail/random_access_iterator.hpp>
+#include <seqan3/std/concepts>
+#include <seqan3/std/iterator>
+#include <seqan3/std/ranges>
+#include <seqan3/std/span>
+
+namespace seqan3
+{
+
+/*!\brief A vector of seqan3::qualified letters that stores the sequence letters and the quality letters in two
+ *        separate contiguous arrays ("structure of arrays").
+ * \tparam sequence_alphabet_t The sequence part of the element type; must satisfy seqan3::Alphabet.
+ * \tparam  quality_alphabet_t The quality part of the element type; must satisfy seqan3::QualityAlphabet.
+ * \implements seqan3::reservable_container_concept
+ * \implements seqan3::Cerealisable
+ * \ingroup container
+ *
+ * This class template behaves like `std::vector<seqan3::qualified<sequence_alphabet_t, quality_alphabet_t>>`, but
+ * instead of interleaving sequence letter and quality score per element it keeps all sequence letters in one
+ * contiguous array and all quality scores in another. Element access returns a proxy that still models the full
+ * seqan3::qualified interface, so quality-aware code sees unified records, while algorithms that only touch the
+ * sequence (e.g. alignment or search kernels) can operate on the dense sequence array via sequence() at twice the
+ * cache density of the interleaved layout — without a conversion step and without the qualities polluting the cache.
+ *
+ * ### Example
+ *
+ * \snippet test/snippet/range/container/qualified_vector.cpp usage
+ *
+ * ### Thread safety
+ *
+ * This container provides no thread-safety beyond the promise given also by the STL that all
+ * calls to `const` member function are safe from multiple threads (as long as no thread calls
+ * a non-`const` member function at the same time).
+ */
+template <Alphabet sequence_alphabet_t, QualityAlphabet quality_alphabet_t>
+class qualified_vector
+{
+public:
+    /*!\name Associated types
+     * \{
+     */
+    //!\brief Equals seqan3::qualified over the two alphabet types.
+    using value_type        = qualified<sequence_alphabet_t, quality_alphabet_t>;
+
+private:
+    //!\brief The sequence letters of all elements.
+    std::vector<sequence_alphabet_t> sequence_data;
+    //!\brief The quality letters of all elements; always of the same size as #sequence_data.
+    std::vector<quality_alphabet_t>  quality_data;
+
+    //!\brief Proxy data type returned by seqan3::qualified_vector as reference to an element; reads combine the
+    //!       two stored letters into a seqan3::qualified, writes split it up again.
+    class reference_proxy_type : public alphabet_proxy<reference_proxy_type, value_type>
+    {
+    private:
+        //!\brief The base type.
+        using base_t = alphabet_proxy<reference_proxy_type, value_type>;
+        //!\brief Befriend the base type so it can call our #on_update().
+        friend base_t;
+
+        //!\brief Pointer to the sequence letter of the element this proxy refers to.
+        sequence_alphabet_t * seq_ptr{nullptr};
+        //!\brief Pointer to the quality letter of the element this proxy refers to.
+        quality_alphabet_t  * qual_ptr{nullptr};
+
+        //!\brief Split the new value into its components and store them in the two arrays.
+        constexpr void on_update() noexcept
+        {
+            value_type const tmp = static_cast<base_t const &>(*this);
+            *seq_ptr  = get<0>(tmp);
+            *qual_ptr = get<1>(tmp);
+        }
+
+    public:
+        // Import from base:
+        using base_t::operator=;
+
+        /*!\name Constructors, destructor and assignment
+         * \brief All are explicitly defaulted.
+         * \{
+         */
+        constexpr reference_proxy_type() noexcept : base_t{} {}
+        constexpr reference_proxy_type(reference_proxy_type const &) = default;
+        constexpr reference_proxy_type(reference_proxy_type &&) = default;
+        constexpr reference_proxy_type & operator=(reference_proxy_type const &) = default;
+        constexpr reference_proxy_type & operator=(reference_proxy_type &&) = default;
+        ~reference_proxy_type() = default;
+
+        //!\brief Initialise from the two letters of an element.
+        reference_proxy_type(sequence_alphabet_t & seq, quality_alphabet_t & qual) noexcept :
+            seq_ptr{&seq}, qual_ptr{&qual}
+        {
+            static_cast<base_t &>(*this).assign_rank(to_rank(value_type{seq, qual}));
+        }
+        //!\}
+    };
+
+    static_assert(Alphabet<reference_proxy_type>);
+    static_assert(QualityAlphabet<reference_proxy_type>);
+    //!\cond
+    template <typename t>
+        requires std::is_same_v<value_type_t<remove_cvref_t<t>>, value_type>
+    static constexpr bool has_same_value_type_v = true;
+    //!\endcond
+
+    //!\brief Lexicographic three-way comparison on the element values (sequence letter before quality letter,
+    //!       matching the rank order of seqan3::qualified); used by the comparison operators.
+    int compare_letter_wise(qualified_vector const & rhs) const noexcept
+    {
+        size_t const common = std::min(size(), rhs.size());
+        for (size_t i = 0; i < common; ++i)
+        {
+            if (sequence_data[i] != rhs.sequence_data[i])
+                return sequence_data[i] < rhs.sequence_data[i] ? -1 : 1;
+            if (quality_data[i] != rhs.quality_data[i])
+                return quality_data[i] < rhs.quality_data[i] ? -1 : 1;
+        }
+
+        if (size() != rhs.size())
+            return size() < rhs.size() ? -1 : 1;
+        return 0;
+    }
+
+public:
+    //!\brief A proxy type that presents the two stored letters as one seqan3::qualified.
+    using reference         = reference_proxy_type;
+    //!\brief Equals the value_type.
+    using const_reference   = value_type;
+    //!\brief The iterator type of this container (a random access iterator).
+    using iterator          = detail::random_access_iterator<qualified_vector>;
+    //!\brief The const_iterator type of this container (a random access iterator).
+    using const_iterator    = detail::random_access_iterator<qualified_vector const>;
+    //!\brief A signed integer type (usually std::ptrdiff_t)
+    using difference_type   = std::ptrdiff_t;
+    //!\brief An unsigned integer type (usually std::size_t)
+    using size_type         = size_t;
+    //!\}
+
+    //!\cond
+    // this signals to range-v3 that something is a container :|
+    using allocator_type    = void;
+    //!\endcond
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    qualified_vector() = default;
+    constexpr qualified_vector(qualified_vector const &) = default;
+    constexpr qualified_vector(qualified_vector &&) = default;
+    constexpr qualified_vector & operator=(qualified_vector const &) = default;
+    constexpr qualified_vector & operator=(qualified_vector &&) = default;
+    ~qualified_vector() = default;
+
+    /*!\brief Construct from a different range.
+     * \tparam other_range_t The type of range to construct from; must satisfy std::ranges::InputRange and
+     *                       std::CommonReference<value_type_t<other_range_t>, value_type>.
+     * \param[in]      range The sequences to construct/assign from.
+     *
+     * ### Complexity
+     *
+     * Linear in the size of `range`.
+     *
+     * ### Exceptions
+     *
+     * Strong exception guarantee (no data is modified in case an exception is thrown).
+     */
+    template <std::ranges::InputRange other_range_t>
+    //!\cond
+        requires has_same_value_type_v<other_range_t>
+    //!\endcond
+    explicit qualified_vector(other_range_t && range) :
+        qualified_vector{seqan3::begin(range), seqan3::end(range)}
+    {}
+
+    /*!\brief Construct with `count` times `value`.
+     * \param[in] count Number of elements.
+     * \param[in] value The initial value to be assigned.
+     *
+     * ### Complexity
+     *
+     * In \f$O(count)\f$.
+     *
+     * ### Exceptions
+     *
+     * Strong exception guarantee (no data is modified in case an exception is thrown).
+     */
+    qualified_vector(size_type const count, value_type const value) :
+        sequence_data(count, get<0>(std::as_const(value))),
+        quality_data(count, get<1>(std::as_const(value)))
+    {}
+
+    /*!\brief Construct from pair of iterators.
+     * \tparam begin_iterator_type Must model std::ForwardIterator and
+     *                             std::CommonReference<value_type_t<begin_iterator_type>, value_type>.
+     * \tparam   end_iterator_type Must model std::Sentinel.
+     * \param[in]         begin_it Begin of range to construct/assign from.
+     * \param[in]           end_it End of range to construct/assign from.
+     *
+     * ### Complexity
+     *
+     * Linear in the distance between `begin_it` and `end_it`.
+     *
+     * ### Exceptions
+     *
+     * Strong exception guarantee (no data is modified in case an exception is thrown).
+     */
+    template <std::ForwardIterator begin_iterator_type, std::Sentinel<begin_iterator_type> end_iterator_type>
+    qualified_vector(begin_iterator_type begin_it, end_iterator_type end_it)
+    //!\cond
+        requires std::CommonReference<value_type_t<begin_iterator_type>, value_type>
+    //!\endcond
+    {
+        insert(cend(), begin_it, end_it);
+    }
+
+    /*!\brief Construct from `std::initializer_list`.
+     * \param[in] ilist A `std::initializer_list` of value_type.
+     *
+     * ### Complexity
+     *
+     * Linear in the size of `ilist`.
+     *
+     * ### Exceptions
+     *
+     * Strong exception guarantee (no data is modified in case an exception is thrown).
+     */
+    qualified_vector(std::initializer_list<value_type> ilist) :
+        qualified_vector(std::begin(ilist), std::end(ilist))
+    {}
+
+    /*!\brief Assign from `std::initializer_list`.
+     * \param[in] ilist A `std::initializer_list` of value_type.
+     *
+     * ### Complexity
+     *
+     * Linear in the size of `ilist`.
+     *
+     * ### Exceptions
+     *
+     * Strong exception guarantee (no data is modified in case an exception is thrown).
+     */
+    qualified_vector & operator=(std::initializer_list<value_type> ilist)
+    {
+        assign(std::begin(ilist), std::end(ilist));
+        return *this;
+    }
+
+    /*!\brief Assign from a different range.
+     * \tparam other_range_t The type of range to be inserted; must satisfy std::ranges::InputRange and
+     *                       std::CommonReference<value_type_t<other_range_t>, value_type>.
+     * \param[in]      range The sequences to construct/assign from.
+     *
+     * ### Complexity
+     *
+     * Linear in the size of `range`.
+     *
+     * ### Exceptions
+     *
+     * Strong exception guarantee (no data is modified in case an exception is thrown).
+     */
+    template <std::ranges::InputRange other_range_t>
+    void assign(other_range_t && range)
+    //!\cond
+        requires std::CommonReference<value_type_t<other_range_t>, value_type>
+    //!\endcond
+    {
+        qualified_vector rhs{std::forward<other_range_t>(range)};
+        swap(rhs);
+    }
+
+    /*!\brief Assign with `count` times `value`.
+     * \param[in] count Number of elements.
+     * \param[in] value The initial value to be assigned.
+     *
+     * ### Complexity
+     *
+     * In \f$O(count)\f$.
+     *
+     * ### Exceptions
+     *
+     * Strong exception guarantee (no data is modified in case an exception is thrown).
+     */
+    void assign(size_type const count, value_type const value)
+    {
+        qualified_vector rhs{count, value};
+        swap(rhs);
+    }
+
+    /*!\brief Assign from pair of iterators.
+     * \tparam begin_iterator_type Must satisfy std::ForwardIterator and
+     *                             std::CommonReference<value_type_t<begin_iterator_type>, value_type>.
+     * \tparam   end_iterator_type Must satisfy std::Sentinel.
+     * \param[in]         begin_it Begin of range to construct/assign from.
+     * \param[in]           end_it End of range to construct/assign from.
+     *
+     * ### Complexity
+     *
+     * Linear in the distance between `begin_it` and `end_it`.
+     *
+     * ### Exceptions
+     *
+     * Strong exception guarantee (no data is modified in case an exception is thrown).
+     */
+    template <std::ForwardIterator begin_iterator_type, std::Sentinel<begin_iterator_type> end_iterator_type>
+    void assign(begin_iterator_type begin_it, end_iterator_type end_it)
+    //!\cond
+        requires std::CommonReference<value_type_t<begin_iterator_type>, value_type>
+    //!\endcond
+    {
+        qualified_vector rhs{begin_it, end_it};
+        swap(rhs);
+    }
+
+    /*!\brief Assign from `std::initializer_list`.
+     * \param[in] ilist A `std::initializer_list` of value_type.
+     *
+     * ### Complexity
+     *
+     * Linear in the size of `ilist`.
+     *
+     * ### Exceptions
+     *
+     * Strong exception guarantee (no data is modified in case an exception is thrown).
+     */
+    void assign(std::initializer_list<value_type> ilist)
+    {
+        assign(std::begin(ilist), std::end(ilist));
+    }
+
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    /*!\brief Returns an iterator to the first element of the container.
+     * \returns Iterator to the first element.
+     *
+     * If the container is empty, the returned iterator will be equal to end().
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    iterator begin() noexcept
+    {
+        return iterator{*this};
+    }
+
+    //!\copydoc begin()
+    const_iterator begin() const noexcept
+    {
+        return const_iterator{*this};
+    }
+
+    //!\copydoc begin()
+    const_iterator cbegin() const noexcept
+    {
+        return const_iterator{*this};
+    }
+
+    /*!\brief Returns an iterator to the element following the last element of the container.
+     * \returns Iterator to the first element.
+     *
+     * This element acts as a placeholder; attempting to dereference it results in undefined behaviour.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    iterator end() noexcept
+    {
+        return iterator{*this, size()};
+    }
+
+    //!\copydoc end()
+    const_iterator end() const noexcept
+    {
+        return const_iterator{*this, size()};
+    }
+
+    //!\copydoc end()
+    const_iterator cend() const noexcept
+    {
+        return const_iterator{*this, size()};
+    }
+    //!\}
+
+    /*!\name Structure-of-arrays access
+     * \{
+     */
+    /*!\brief Returns a contiguous view over the sequence letters of all elements (without the qualities).
+     * \returns A std::span over the internal sequence array.
+     *
+     * The sequence letters of all elements lie contiguously in memory, i.e. sequence-only algorithms can
+     * iterate the returned span at full cache density. The letters may be modified through the (non-`const`)
+     * span; the span itself cannot change the number of elements, so the correspondence to the qualities is
+     * preserved.
+     *
+     * The span is invalidated by any operation that invalidates iterators of the container.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    std::span<sequence_alphabet_t> sequence() noexcept
+    {
+        return {sequence_data.data(), sequence_data.size()};
+    }
+
+    //!\copydoc sequence()
+    std::span<sequence_alphabet_t const> sequence() const noexcept
+    {
+        return {sequence_data.data(), sequence_data.size()};
+    }
+
+    /*!\brief Returns a contiguous view over the quality letters of all elements (without the sequence).
+     * \returns A std::span over the internal quality array.
+     * \copydetails sequence()
+     */
+    std::span<quality_alphabet_t> qualities() noexcept
+    {
+        return {quality_data.data(), quality_data.size()};
+    }
+
+    //!\copydoc qualities()
+    std::span<quality_alphabet_t const> qualities() const noexcept
+    {
+        return {quality_data.data(), quality_data.size()};
+    }
+    //!\}
+
+    /*!\name Element access
+     * \{
+     */
+    /*!\brief Return the i-th element.
+     * \param[in]              i Index of the element to retrieve.
+     * \throws std::out_of_range If you access an element behind the last.
+     * \returns                  Either a writable proxy to the element or a copy (if called in const context).
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * Throws std::out_of_range if `i >= size()`.
+     */
+    reference at(size_type const i)
+    {
+        if (i >= size()) // [[unlikely]]
+        {
+            throw std::out_of_range{"Trying to access element behind the last in qualified_vector."};
+        }
+        return (*this)[i];
+    }
+
+    //!\copydoc at()
+    const_reference at(size_type const i) const
+    {
+        if (i >= size()) // [[unlikely]]
+        {
+            throw std::out_of_range{"Trying to access element behind the last in qualified_vector."};
+        }
+        return (*this)[i];
+    }
+
+    /*!\brief Return the i-th element.
+     * \param i The element to retrieve.
+     * \returns Either a writable proxy to the element or a copy (if called in const context).
+     *
+     * Accessing an element behind the last causes undefined behaviour. In debug mode an assertion checks the size of
+     * the container.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    reference operator[](size_type const i) noexcept
+    {
+        assert(i < size());
+        return {sequence_data[i], quality_data[i]};
+    }
+
+    //!\copydoc operator[]()
+    const_reference operator[](size_type const i) const noexcept
+    {
+        assert(i < size());
+        return value_type{sequence_data[i], quality_data[i]};
+    }
+
+    /*!\brief Return the first element. Calling front on an empty container is undefined.
+     * \returns Either a writable proxy to the element or a copy (if called in const context).
+     *
+     * Calling front on an empty container is undefined. In debug mode an assertion checks the size of the container.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    reference front() noexcept
+    {
+        assert(size() > 0);
+        return (*this)[0];
+    }
+
+    //!\copydoc front()
+    const_reference front() const noexcept
+    {
+        assert(size() > 0);
+        return (*this)[0];
+    }
+
+    /*!\brief Return the last element.
+     * \returns Either a writable proxy to the element or a copy (if called in const context).
+     *
+     * Calling back on an empty container is undefined. In debug mode an assertion checks the size of the container.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    reference back() noexcept
+    {
+        assert(size() > 0);
+        return (*this)[size()-1];
+    }
+
+    //!\copydoc back()
+    const_reference back() const noexcept
+    {
+        assert(size() > 0);
+        return (*this)[size()-1];
+    }
+    //!\}
+
+    /*!\name Capacity
+     * \{
+     */
+    /*!\brief Checks whether the container is empty.
+     * \returns `true` if the container is empty, `false` otherwise.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    /*!\brief Returns the number of elements in the container, i.e. std::distance(begin(), end()).
+     * \returns The number of elements in the container.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    size_type size() const noexcept
+    {
+        assert(sequence_data.size() == quality_data.size());
+        return sequence_data.size();
+    }
+
+    /*!\brief Returns the maximum number of elements the container is able to hold due to system or library
+     * implementation limitations, i.e. std::distance(begin(), end()) for the largest container.
+     * \returns The number of elements in the container.
+     *
+     * This value typically reflects the theoretical limit on the size of the container. At runtime, the size
+     * of the container may be limited to a value smaller than max_size() by the amount of RAM available.
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    size_type max_size() const noexcept
+    {
+        return std::min<size_type>(sequence_data.max_size(), quality_data.max_size());
+    }
+
+    /*!\brief Returns the number of elements that the container has currently allocated space for.
+     * \returns The capacity of the currently allocated storage.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    size_type capacity() const noexcept
+    {
+        return std::min<size_type>(sequence_data.capacity(), quality_data.capacity());
+    }
+
+    /*!\brief Increase the capacity to a value that's greater or equal to new_cap.
+     * \param            new_cap The new capacity.
+     * \throws std::length_error If new_cap > max_size().
+     * \throws    std::exception Any exception thrown by `Allocator::allocate()` (typically `std::bad_alloc`).
+     *
+     * Increase the capacity of the vector to a value that's greater or equal to new_cap.
+     * If new_cap is greater than the current capacity(), new storage is allocated, otherwise the method does nothing.
+     * If new_cap is greater than capacity(), all iterators, including the past-the-end iterator, and all references
+     * to the elements are invalidated. Otherwise, no iterators or references are invalidated.
+     *
+     * ### Complexity
+     *
+     * At most linear in the size() of the container.
+     *
+     * ### Exceptions
+     *
+     * Strong exception guarantee (no data is modified in case an exception is thrown).
+     */
+    void reserve(size_type const new_cap)
+    {
+        sequence_data.reserve(new_cap);
+        quality_data.reserve(new_cap);
+    }
+
+    /*!\brief Requests the removal of unused capacity.
+     *
+     * It is a non-binding request to reduce capacity() to size().
+     * It depends on the implementation if the request is fulfilled.
+     * If reallocation occurs, all iterators, including the past the end iterator, and all references to the elements
+     * are invalidated. If no reallocation takes place, no iterators or references are invalidated.
+     *
+     * ### Complexity
+     *
+     * At most linear in the size() of the container.
+     *
+     * ### Exceptions
+     *
+     * Strong exception guarantee (no data is modified in case an exception is thrown).
+     */
+    void shrink_to_fit()
+    {
+        sequence_data.shrink_to_fit();
+        quality_data.shrink_to_fit();
+    }
+    //!\}
+
+    /*!\name Modifiers
+     * \{
+     */
+    /*!\brief Removes all elements from the container.
+     * \returns The number of elements in the container.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    void clear() noexcept
+    {
+        sequence_data.clear();
+        quality_data.clear();
+    }
+
+    /*!\brief Inserts value before position in the container.
+     * \param   pos Iterator before which the content will be inserted. `pos` may be the end() iterator.
+     * \param value Element value to insert.
+     * \returns     Iterator pointing to the inserted value.
+     *
+     * Causes reallocation if the new size() is greater than the old capacity(). If the new size() is greater
+     * than capacity(), all iterators and references are invalidated. Otherwise, only the iterators and
+     * references before the insertion point remain valid. The past-the-end iterator is also invalidated.
+     *
+     * ### Complexity
+     *
+     * Worst-case linear in size().
+     *
+     * ### Exceptions
+     *
+     * Basic exception guarantee, i.e. guaranteed not to leak, but container may contain invalid data after exception is
+     * thrown.
+     */
+    iterator insert(const_iterator pos, value_type const value)
+    {
+        return insert(pos, 1, value);
+    }
+
+    /*!\brief Inserts count copies of value before position in the container.
+     * \param   pos Iterator before which the content will be inserted. `pos` may be the end() iterator.
+     * \param count Number of copies.
+     * \param value Element value to insert.
+     * \returns     Iterator pointing to the first element inserted, or `pos` if `count==0`.
+     *
+     * Causes reallocation if the new size() is greater than the old capacity(). If the new size() is greater
+     * than capacity(), all iterators and references are invalidated. Otherwise, only the iterators and
+     * references before the insertion point remain valid. The past-the-end iterator is also invalidated.
+     *
+     * ### Complexity
+     *
+     * Worst-case linear in size().
+     *
+     * ### Exceptions
+     *
+     * Basic exception guarantee, i.e. guaranteed not to leak, but container may contain invalid data after exception is
+     * thrown.
+     */
+    iterator insert(const_iterator pos, size_type const count, value_type const value)
+    {
+        auto const pos_as_num = std::distance(cbegin(), pos); // we want to insert BEFORE this position
+
+        sequence_data.insert(sequence_data.begin() + pos_as_num, count, get<0>(std::as_const(value)));
+        quality_data.insert(quality_data.begin() + pos_as_num, count, get<1>(std::as_const(value)));
+
+        return begin() + pos_as_num;
+    }
+
+    /*!\brief Inserts elements from range `[begin_it, end_it)` before position in the container.
+     * \tparam begin_iterator_type Must satisfy std::ForwardIterator and
+     *                             std::CommonReference<value_type_t<begin_iterator_type>, value_type>.
+     * \tparam   end_iterator_type Must satisfy std::Sentinel.
+     * \param[in]              pos Iterator before which the content will be inserted. `pos` may be the end() iterator.
+     * \param[in]         begin_it Begin of range to construct/assign from.
+     * \param[in]           end_it End of range to construct/assign from.
+     * \returns                    Iterator pointing to the first element inserted, or `pos` if `begin_it==end_it`.
+     *
+     * The behaviour is undefined if begin_it and end_it are iterators into `*this`.
+     *
+     * Causes reallocation if the new size() is greater than the old capacity(). If the new size() is greater
+     * than capacity(), all iterators and references are invalidated. Otherwise, only the iterators and
+     * references before the insertion point remain valid. The past-the-end iterator is also invalidated.
+     *
+     * The range is traversed twice (it is a forward range), once per component array.
+     *
+     * ### Complexity
+     *
+     * Worst-case linear in size().
+     *
+     * ### Exceptions
+     *
+     * Basic exception guarantee, i.e. guaranteed not to leak, but container may contain invalid data after exception is
+     * thrown.
+     */
+    template <std::ForwardIterator begin_iterator_type, std::Sentinel<begin_iterator_type> end_iterator_type>
+    iterator insert(const_iterator pos, begin_iterator_type begin_it, end_iterator_type end_it)
+    //!\cond
+        requires std::CommonReference<value_type_t<begin_iterator_type>, value_type>
+    //!\endcond
+    {
+        auto const pos_as_num = std::distance(cbegin(), pos);
+
+        auto v = std::ranges::subrange<begin_iterator_type, end_iterator_type>{begin_it, end_it};
+        auto v_seq  = v | std::view::transform([] (auto const & in)
+                          { return get<0>(std::as_const(static_cast<value_type const>(in))); });
+        auto v_qual = v | std::view::transform([] (auto const & in)
+                          { return get<1>(std::as_const(static_cast<value_type const>(in))); });
+
+        sequence_data.insert(sequence_data.begin() + pos_as_num, seqan3::begin(v_seq), seqan3::end(v_seq));
+        quality_data.insert(quality_data.begin() + pos_as_num, seqan3::begin(v_qual), seqan3::end(v_qual));
+
+        return begin() + pos_as_num;
+    }
+
+    /*!\brief Inserts elements from initializer list before position in the container.
+     * \param   pos Iterator before which the content will be inserted. `pos` may be the end() iterator.
+     * \param ilist Initializer list with values to insert.
+     * \returns     Iterator pointing to the first element inserted, or `pos` if `ilist` is empty.
+     *
+     * Causes reallocation if the new size() is greater than the old capacity(). If the new size() is greater
+     * than capacity(), all iterators and references are invalidated. Otherwise, only the iterators and
+     * references before the insertion point remain valid. The past-the-end iterator is also invalidated.
+     *
+     * ### Complexity
+     *
+     * Worst-case linear in size().
+     *
+     * ### Exceptions
+     *
+     * Basic exception guarantee, i.e. guaranteed not to leak, but container may contain invalid data after exception is
+     * thrown.
+     */
+    iterator insert(const_iterator pos, std::initializer_list<value_type> const & ilist)
+    {
+        return insert(pos, ilist.begin(), ilist.end());
+    }
+
+    /*!\brief Removes specified elements from the container.
+     * \param begin_it Begin of range to erase.
+     * \param   end_it Behind the end of range to erase.
+     * \returns        Iterator following the last element removed. If the iterator `pos` refers to the last element,
+     *                 the end() iterator is returned.
+     *
+     * Invalidates iterators and references at or after the point of the erase, including the end() iterator.
+     *
+     * The iterator first does not need to be dereferenceable if first==end_it: erasing an empty range is a no-op.
+     *
+     * ### Complexity
+     *
+     * Linear in size().
+     *
+     * ### Exceptions
+     *
+     * Basic exception guarantee, i.e. guaranteed not to leak, but container may contain invalid data after exception is
+     * thrown.
+     */
+    iterator erase(const_iterator begin_it, const_iterator end_it)
+    {
+        if (begin_it >= end_it) // [[unlikely]]
+            return begin() + std::distance(cbegin(), end_it);
+
+        auto const begin_it_pos = std::distance(cbegin(), begin_it);
+        auto const end_it_pos = std::distance(cbegin(), end_it);
+
+        sequence_data.erase(sequence_data.cbegin() + begin_it_pos,
+                            sequence_data.cbegin() + end_it_pos);
+        quality_data.erase(quality_data.cbegin() + begin_it_pos,
+                           quality_data.cbegin() + end_it_pos);
+
+        return begin() + begin_it_pos;
+    }
+
+    /*!\brief Removes specified elements from the container.
+     * \param   pos Remove the element at pos.
+     * \returns     Iterator following the last element removed. If the iterator `pos` refers to the last element,
+     *              the end() iterator is returned.
+     *
+     * Invalidates iterators and references at or after the point of the erase, including the end() iterator.
+     *
+     * The iterator `pos` must be valid and dereferenceable. Thus the end() iterator (which is valid, but is not
+     * dereferencable) cannot be used as a value for pos.
+     *
+     * ### Complexity
+     *
+     * Linear in size().
+     *
+     * ### Exceptions
+     *
+     * Basic exception guarantee, i.e. guaranteed not to leak, but container may contain invalid data after exception is
+     * thrown.
+     */
+    iterator erase(const_iterator pos)
+    {
+       return erase(pos, pos + 1);
+    }
+
+    /*!\brief Appends the given element value to the end of the container.
+     * \param value The value to append.
+     *
+     * If the new size() is greater than capacity() then all iterators and references (including the past-the-end
+     * iterator) are invalidated. Otherwise only the past-the-end iterator is invalidated.
+     *
+     * ### Complexity
+     *
+     * Amortised constant, worst-case linear in size().
+     *
+     * ### Exceptions
+     *
+     * Basic exception guarantee, i.e. guaranteed not to leak, but container may contain invalid data after exception is
+     * thrown.
+     */
+    void push_back(value_type const value)
+    {
+        push_back(get<0>(std::as_const(value)), get<1>(std::as_const(value)));
+    }
+
+    /*!\brief Appends an element given as its two letters to the end of the container.
+     * \param  seq The sequence letter of the new element.
+     * \param qual The quality letter of the new element.
+     *
+     * Convenience overload for producers (e.g. file parsers) that have the two letters at hand separately, so
+     * they do not need to combine them into a seqan3::qualified only for it to be split up again.
+     *
+     * \copydetails push_back(value_type const value)
+     */
+    void push_back(sequence_alphabet_t const seq, quality_alphabet_t const qual)
+    {
+        sequence_data.push_back(seq);
+        quality_data.push_back(qual);
+    }
+
+    /*!\brief Removes the last element of the container.
+     *
+     * Calling pop_back() on an empty container is undefined. In debug mode an assertion will be thrown.
+     *
+     * No iterators or references except for back() and end() are invalidated.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No exception is thrown in release mode.
+     *
+     * Strong exception guarantee (no data is modified in case an exception is thrown).
+     */
+    void pop_back()
+    {
+        assert(size() > 0);
+        sequence_data.pop_back();
+        quality_data.pop_back();
+    }
+
+    /*!\brief Resizes the container to contain count elements.
+     * \param              count The new size.
+     * \throws std::length_error If count > max_size().
+     * \throws    std::exception Any exception thrown by `Allocator::allocate()` (typically `std::bad_alloc`).
+     *
+     * Increase the size() of the vector to count.
+     *
+     * If the current capacity() is smaller than count, new storage is allocated and all iterators, including
+     * the past-the-end iterator, and all references to the elements are invalidated.
+     * Otherwise only the past-the-end iterator is invalidated.
+     *
+     * If the current size is greater than count, the container is reduced to its first count elements.
+     * Capacity is never reduced when resizing to smaller size because that would invalidate all iterators, rather
+     * than only the ones that would be invalidated by the equivalent sequence of pop_back() calls.
+     *
+     * ### Complexity
+     *
+     * At most linear in the size() of the container.
+     *
+     * ### Exceptions
+     *
+     * Only new size: Strong exception guarantee (no data is modified in case an exception is thrown).
+     *
+     * New default value: Basic exception guarantee, i.e. guaranteed not to leak, but container my contain bogus data
+     * after exceptions is thrown.
+     */
+    void resize(size_type const count)
+    {
+        assert(count < max_size());
+        sequence_data.resize(count);
+        quality_data.resize(count);
+    }
+
+    /*!\copybrief resize()
+     * \param value Append copies of value when resizing.
+     * \copydetails resize()
+     */
+    void resize(size_type const count, value_type const value)
+    {
+        assert(count < max_size());
+        sequence_data.resize(count, get<0>(std::as_const(value)));
+        quality_data.resize(count, get<1>(std::as_const(value)));
+    }
+
+    /*!\brief Swap contents with another instance.
+     * \param rhs The other instance to swap with.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    constexpr void swap(qualified_vector & rhs) noexcept
+    {
+        std::swap(sequence_data, rhs.sequence_data);
+        std::swap(quality_data, rhs.quality_data);
+    }
+
+    //!\copydoc swap()
+    constexpr void swap(qualified_vector && rhs) noexcept
+    {
+        std::swap(sequence_data, rhs.sequence_data);
+        std::swap(quality_data, rhs.quality_data);
+    }
+    //!\}
+
+    /*!\brief Swap contents with another instance.
+     * \param lhs The first instance.
+     * \param rhs The other instance to swap with.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    friend constexpr void swap(qualified_vector & lhs, qualified_vector & rhs) noexcept
+    {
+        std::swap(lhs, rhs);
+    }
+
+    //!\overload
+    friend constexpr void swap(qualified_vector && lhs, qualified_vector && rhs) noexcept
+    {
+        std::swap(lhs, rhs);
+    }
+    //!\}
+
+    //!\name Comparison operators
+    //!\{
+    //!\brief Element-wise comparison; the order is the same as for `std::vector<value_type>`, because the
+    //!       sequence letter is the most significant component of the rank of seqan3::qualified.
+    bool operator==(qualified_vector const & rhs) const noexcept
+    {
+        return sequence_data == rhs.sequence_data && quality_data == rhs.quality_data;
+    }
+
+    //!\copydoc operator==()
+    bool operator!=(qualified_vector const & rhs) const noexcept
+    {
+        return !(*this == rhs);
+    }
+
+    //!\copydoc operator==()
+    bool operator<(qualified_vector const & rhs) const noexcept
+    {
+        return compare_letter_wise(rhs) < 0;
+    }
+
+    //!\copydoc operator==()
+    bool operator>(qualified_vector const & rhs) const noexcept
+    {
+        return compare_letter_wise(rhs) > 0;
+    }
+
+    //!\copydoc operator==()
+    bool operator<=(qualified_vector const & rhs) const noexcept
+    {
+        return compare_letter_wise(rhs) <= 0;
+    }
+
+    //!\copydoc operator==()
+    bool operator>=(qualified_vector const & rhs) const noexcept
+    {
+        return compare_letter_wise(rhs) >= 0;
+    }
+    //!\}
+
+    /*!\cond DEV
+     * \brief Serialisation support function.
+     * \tparam archive_t Type of `archive`; must satisfy seqan3::CerealArchive.
+     * \param archive The archive being serialised from/to.
+     *
+     * \attention These functions are never called directly, see \ref serialisation for more details.
+     */
+    template <CerealArchive archive_t>
+    void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+    {
+        archive(sequence_data);
+        archive(quality_data);
+    }
+    //!\endcond
+};
+
+} // namespace seqan3
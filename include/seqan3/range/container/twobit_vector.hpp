@@ -0,0 +1,795 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::twobit_vector.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alphabet/detail/alphabet_proxy.hpp>
+#include <seqan3/alphabet/nucleotide/concept.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/concept/cereal.hpp>
+#include <seqan3/core/metafunction/all.hpp>
+#include <seqan3/range/shortcuts.hpp>
+#include <seqan3/range/container/bitcompressed_vector.hpp>
+#include <seqan3/range/detail/random_access_iterator.hpp>
+#include <seqan3/std/concepts>
+#include <seqan3/std/iterator>
+#include <seqan3/std/ranges>
+
+namespace seqan3
+{
+
+/*!\brief A vector that stores nucleotides 2-bit-packed and keeps rare non-ACGT letters in a sparse
+ *        exception dictionary.
+ * \tparam alphabet_t The element type; must satisfy seqan3::NucleotideAlphabet.
+ * \implements seqan3::reservable_container_concept
+ * \implements seqan3::Cerealisable
+ * \ingroup container
+ *
+ * \details
+ *
+ * This class template behaves like `std::vector<alphabet_t>` for e.g. `alphabet_t = seqan3::dna5`, but
+ * exploits that in real read and genome data almost every base is one of ACGT: all letters are stored in
+ * a 2-bit seqan3::bitcompressed_vector over seqan3::dna4, and only the positions whose letter does not
+ * survive the round trip through seqan3::dna4 (i.e. `N` and friends) are recorded in a position-sorted
+ * exception dictionary. For `dna5` this reduces the footprint from 3 bits to 2 bits per position plus
+ * ~9 bytes per exception — a 33% cut as long as non-ACGT letters stay rare (a human genome with 0.1% `N`
+ * costs ≈2.07 bits per base).
+ *
+ * Element access returns a proxy presenting the full `alphabet_t` interface; reads check the dictionary
+ * with a binary search over only the exceptional positions, so the common case costs a 2-bit extract plus
+ * a search in a tiny array. The dictionary is rank/select addressable via exception_rank() and
+ * exception_select(), and the planes are exposed via bases() and exception_positions() — e.g. to bulk
+ * process the 2-bit payload ignoring the exceptions, or to freeze the positions into an
+ * `sdsl::sd_vector` once the sequence no longer changes (not maintained here, because it would have to
+ * be rebuilt after every write).
+ *
+ * \attention Writing a non-ACGT letter into the middle costs a shift of the exception dictionary; this
+ *            container is designed for data where such letters are rare (it degrades towards quadratic
+ *            filling when they are not — use seqan3::bitcompressed_vector then).
+ *
+ * ### Thread safety
+ *
+ * This container provides no thread-safety beyond the promise given also by the STL that all
+ * calls to `const` member function are safe from multiple threads (as long as no thread calls
+ * a non-`const` member function at the same time).
+ */
+template <NucleotideAlphabet alphabet_t>
+class twobit_vector
+{
+public:
+    /*!\name Associated types
+     * \{
+     */
+    //!\brief Equals the alphabet type.
+    using value_type        = alphabet_t;
+
+private:
+    //!\brief The 2-bit payload of all elements (non-ACGT letters collapse onto one of the four).
+    bitcompressed_vector<dna4> base_data;
+    //!\brief The positions of all elements whose letter is not representable in 2 bits; sorted ascending.
+    std::vector<size_t> except_positions;
+    //!\brief The original letters of the exceptional positions; parallel to #except_positions.
+    std::vector<alphabet_t> except_letters;
+
+    //!\brief Sentinel index returned by exception_index() for non-exceptional positions.
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+    //!\brief The 2-bit representation of a letter (via the character representation, like `dna4{letter}`).
+    static dna4 to_base(value_type const letter) noexcept
+    {
+        return dna4{letter};
+    }
+
+    //!\brief Whether a letter does not survive the round trip through seqan3::dna4, i.e. needs an
+    //!       exception entry.
+    static bool needs_exception(value_type const letter) noexcept
+    {
+        return value_type{to_base(letter)} != letter;
+    }
+
+    //!\brief The index of position `i` in the exception dictionary, or #npos if `i` is not exceptional.
+    size_t exception_index(size_t const i) const noexcept
+    {
+        auto const it = std::lower_bound(except_positions.begin(), except_positions.end(), i);
+        if (it != except_positions.end() && *it == i)
+            return it - except_positions.begin();
+        return npos;
+    }
+
+    //!\brief The letter at position `i`, resolved against the exception dictionary.
+    value_type element_at(size_t const i) const noexcept
+    {
+        if (size_t const idx = exception_index(i); idx != npos)
+            return except_letters[idx];
+        return value_type{base_data[i]};
+    }
+
+    //!\brief Store `value` at position `pos`, updating the exception dictionary as needed.
+    void set_element(size_t const pos, value_type const value)
+    {
+        base_data[pos] = to_base(value);
+
+        auto const it = std::lower_bound(except_positions.begin(), except_positions.end(), pos);
+        bool const present = (it != except_positions.end()) && (*it == pos);
+        size_t const idx = it - except_positions.begin();
+
+        if (needs_exception(value))
+        {
+            if (present)
+            {
+                except_letters[idx] = value;
+            }
+            else
+            {
+                except_positions.insert(it, pos);
+                except_letters.insert(except_letters.begin() + idx, value);
+            }
+        }
+        else if (present)
+        {
+            except_positions.erase(it);
+            except_letters.erase(except_letters.begin() + idx);
+        }
+    }
+
+    //!\brief Proxy data type returned by seqan3::twobit_vector as reference to an element; reads resolve
+    //!       the exception dictionary, writes update it.
+    class reference_proxy_type : public alphabet_proxy<reference_proxy_type, value_type>
+    {
+    private:
+        //!\brief The base type.
+        using base_t = alphabet_proxy<reference_proxy_type, value_type>;
+        //!\brief Befriend the base type so it can call our #on_update().
+        friend base_t;
+
+        //!\brief Pointer to the container the proxied element lives in.
+        twobit_vector * host{nullptr};
+        //!\brief Position of the proxied element.
+        size_t pos{0};
+
+        //!\brief Store the new value in the payload and the exception dictionary.
+        void on_update() noexcept
+        {
+            value_type const tmp = static_cast<base_t const &>(*this);
+            host->set_element(pos, tmp);
+        }
+
+    public:
+        // Import from base:
+        using base_t::operator=;
+
+        /*!\name Constructors, destructor and assignment
+         * \brief All are explicitly defaulted.
+         * \{
+         */
+        constexpr reference_proxy_type() noexcept : base_t{} {}
+        constexpr reference_proxy_type(reference_proxy_type const &) = default;
+        constexpr reference_proxy_type(reference_proxy_type &&) = default;
+        constexpr reference_proxy_type & operator=(reference_proxy_type const &) = default;
+        constexpr reference_proxy_type & operator=(reference_proxy_type &&) = default;
+        ~reference_proxy_type() = default;
+
+        //!\brief Initialise from the container and the position of the element.
+        reference_proxy_type(twobit_vector & host_, size_t const pos_) noexcept :
+            host{&host_}, pos{pos_}
+        {
+            static_cast<base_t &>(*this).assign_rank(to_rank(host_.element_at(pos_)));
+        }
+        //!\}
+    };
+
+    static_assert(Alphabet<reference_proxy_type>);
+    //!\cond
+    template <typename t>
+        requires std::is_same_v<value_type_t<remove_cvref_t<t>>, value_type>
+    static constexpr bool has_same_value_type_v = true;
+    //!\endcond
+
+public:
+    //!\brief A proxy type that resolves reads and writes against the exception dictionary.
+    using reference         = reference_proxy_type;
+    //!\brief Equals the value_type.
+    using const_reference   = value_type;
+    //!\brief The iterator type of this container (a random access iterator).
+    using iterator          = detail::random_access_iterator<twobit_vector>;
+    //!\brief The const_iterator type of this container (a random access iterator).
+    using const_iterator    = detail::random_access_iterator<twobit_vector const>;
+    //!\brief A signed integer type (usually std::ptrdiff_t)
+    using difference_type   = std::ptrdiff_t;
+    //!\brief An unsigned integer type (usually std::size_t)
+    using size_type         = size_t;
+    //!\}
+
+    //!\cond
+    // this signals to range-v3 that something is a container :|
+    using allocator_type    = void;
+    //!\endcond
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    twobit_vector() = default;
+    twobit_vector(twobit_vector const &) = default;
+    twobit_vector(twobit_vector &&) = default;
+    twobit_vector & operator=(twobit_vector const &) = default;
+    twobit_vector & operator=(twobit_vector &&) = default;
+    ~twobit_vector() = default;
+
+    //!\brief Construct from a range of letters.
+    template <std::ranges::InputRange other_range_t>
+    //!\cond
+        requires has_same_value_type_v<other_range_t>
+    //!\endcond
+    explicit twobit_vector(other_range_t && range) :
+        twobit_vector{seqan3::begin(range), seqan3::end(range)}
+    {}
+
+    //!\brief Construct with `count` copies of `value`.
+    twobit_vector(size_type const count, value_type const value)
+    {
+        insert(cend(), count, value);
+    }
+
+    //!\brief Construct from a pair of iterators.
+    template <std::ForwardIterator begin_iterator_type, std::Sentinel<begin_iterator_type> end_iterator_type>
+    twobit_vector(begin_iterator_type begin_it, end_iterator_type end_it)
+    //!\cond
+        requires std::CommonReference<value_type_t<begin_iterator_type>, value_type>
+    //!\endcond
+    {
+        insert(cend(), begin_it, end_it);
+    }
+
+    //!\brief Construct from an initialiser list.
+    twobit_vector(std::initializer_list<value_type> ilist) :
+        twobit_vector(std::begin(ilist), std::end(ilist))
+    {}
+
+    //!\brief Assign from an initialiser list.
+    twobit_vector & operator=(std::initializer_list<value_type> ilist)
+    {
+        assign(std::begin(ilist), std::end(ilist));
+        return *this;
+    }
+
+    //!\brief Assign from a range of letters.
+    template <std::ranges::InputRange other_range_t>
+    void assign(other_range_t && range)
+    //!\cond
+        requires std::CommonReference<value_type_t<other_range_t>, value_type>
+    //!\endcond
+    {
+        twobit_vector rhs{std::forward<other_range_t>(range)};
+        swap(rhs);
+    }
+
+    //!\brief Assign `count` copies of `value`.
+    void assign(size_type const count, value_type const value)
+    {
+        twobit_vector rhs{count, value};
+        swap(rhs);
+    }
+
+    //!\brief Assign from a pair of iterators.
+    template <std::ForwardIterator begin_iterator_type, std::Sentinel<begin_iterator_type> end_iterator_type>
+    void assign(begin_iterator_type begin_it, end_iterator_type end_it)
+    //!\cond
+        requires std::CommonReference<value_type_t<begin_iterator_type>, value_type>
+    //!\endcond
+    {
+        twobit_vector rhs{begin_it, end_it};
+        swap(rhs);
+    }
+
+    //!\brief Assign from an initialiser list.
+    void assign(std::initializer_list<value_type> ilist)
+    {
+        assign(std::begin(ilist), std::end(ilist));
+    }
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    //!\brief Returns an iterator to the first element of the container.
+    iterator begin() noexcept
+    {
+        return iterator{*this};
+    }
+
+    //!\copydoc begin()
+    const_iterator begin() const noexcept
+    {
+        return const_iterator{*this};
+    }
+
+    //!\copydoc begin()
+    const_iterator cbegin() const noexcept
+    {
+        return const_iterator{*this};
+    }
+
+    //!\brief Returns an iterator to the element following the last element of the container.
+    iterator end() noexcept
+    {
+        return iterator{*this, size()};
+    }
+
+    //!\copydoc end()
+    const_iterator end() const noexcept
+    {
+        return const_iterator{*this, size()};
+    }
+
+    //!\copydoc end()
+    const_iterator cend() const noexcept
+    {
+        return const_iterator{*this, size()};
+    }
+    //!\}
+
+    /*!\name Exception dictionary access
+     * \{
+     */
+    /*!\brief Returns the 2-bit payload of all elements (exceptional positions hold their collapsed letter).
+     * \returns A reference to the internal seqan3::bitcompressed_vector over seqan3::dna4.
+     *
+     * Algorithms that may treat rare non-ACGT letters as an arbitrary base (e.g. k-mer counting and many
+     * seeding schemes) can operate on the returned container directly, in 2 bits per position.
+     */
+    bitcompressed_vector<dna4> const & bases() const noexcept
+    {
+        return base_data;
+    }
+
+    //!\brief Returns the sorted positions of all elements whose letter is not representable in 2 bits.
+    std::vector<size_t> const & exception_positions() const noexcept
+    {
+        return except_positions;
+    }
+
+    //!\brief The total number of exceptional positions.
+    size_type exception_count() const noexcept
+    {
+        return except_positions.size();
+    }
+
+    /*!\brief The number of exceptional positions in `[0, i)` (the dictionary's rank operation).
+     * \param[in] i The queried position; must be `<= size()`.
+     *
+     * ### Complexity
+     *
+     * Logarithmic in the number of exceptions.
+     */
+    size_type exception_rank(size_type const i) const noexcept
+    {
+        assert(i <= size());
+        return std::lower_bound(except_positions.begin(), except_positions.end(), i) -
+               except_positions.begin();
+    }
+
+    /*!\brief The position of the `k`-th (0-based, in position order) exceptional element (the dictionary's
+     *        select operation).
+     * \param[in] k The index of the queried exception; must be `< exception_count()`.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     */
+    size_type exception_select(size_type const k) const noexcept
+    {
+        assert(k < except_positions.size());
+        return except_positions[k];
+    }
+    //!\}
+
+    /*!\name Element access
+     * \{
+     */
+    //!\brief Return the i-th element; writing through the returned proxy updates payload and dictionary.
+    reference operator[](size_type const i) noexcept
+    {
+        assert(i < size());
+        return {*this, i};
+    }
+
+    //!\brief Return the i-th element.
+    const_reference operator[](size_type const i) const noexcept
+    {
+        assert(i < size());
+        return element_at(i);
+    }
+
+    //!\brief Return the i-th element; throws std::out_of_range if `i >= size()`.
+    reference at(size_type const i)
+    {
+        if (i >= size()) // [[unlikely]]
+            throw std::out_of_range{"Trying to access element behind the last in twobit_vector."};
+        return (*this)[i];
+    }
+
+    //!\copydoc at()
+    const_reference at(size_type const i) const
+    {
+        if (i >= size()) // [[unlikely]]
+            throw std::out_of_range{"Trying to access element behind the last in twobit_vector."};
+        return (*this)[i];
+    }
+
+    //!\brief Return the first element. Calling this on an empty container is undefined behaviour.
+    reference front() noexcept
+    {
+        assert(size() > 0);
+        return (*this)[0];
+    }
+
+    //!\copydoc front()
+    const_reference front() const noexcept
+    {
+        assert(size() > 0);
+        return (*this)[0];
+    }
+
+    //!\brief Return the last element. Calling this on an empty container is undefined behaviour.
+    reference back() noexcept
+    {
+        assert(size() > 0);
+        return (*this)[size() - 1];
+    }
+
+    //!\copydoc back()
+    const_reference back() const noexcept
+    {
+        assert(size() > 0);
+        return (*this)[size() - 1];
+    }
+    //!\}
+
+    /*!\name Capacity
+     * \{
+     */
+    //!\brief Checks whether the container is empty.
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    //!\brief Returns the number of elements in the container.
+    size_type size() const noexcept
+    {
+        return base_data.size();
+    }
+
+    //!\brief Returns the maximum number of elements the container is able to hold.
+    size_type max_size() const noexcept
+    {
+        return base_data.max_size();
+    }
+
+    //!\brief Returns the number of elements that the container has currently allocated space for.
+    size_type capacity() const noexcept
+    {
+        return base_data.capacity();
+    }
+
+    //!\brief Increase the capacity of the payload to a value that's greater or equal to new_cap.
+    //!       (The exception dictionary grows on demand.)
+    void reserve(size_type const new_cap)
+    {
+        base_data.reserve(new_cap);
+    }
+
+    //!\brief Requests the removal of unused capacity.
+    void shrink_to_fit()
+    {
+        base_data.shrink_to_fit();
+        except_positions.shrink_to_fit();
+        except_letters.shrink_to_fit();
+    }
+    //!\}
+
+    /*!\name Modifiers
+     * \{
+     */
+    //!\brief Removes all elements from the container.
+    void clear() noexcept
+    {
+        base_data.clear();
+        except_positions.clear();
+        except_letters.clear();
+    }
+
+    //!\brief Inserts `value` before position in the container.
+    iterator insert(const_iterator pos, value_type const value)
+    {
+        return insert(pos, 1, value);
+    }
+
+    //!\brief Inserts `count` copies of `value` before position in the container.
+    iterator insert(const_iterator pos, size_type const count, value_type const value)
+    {
+        auto const pos_as_num = std::distance(cbegin(), pos); // we want to insert BEFORE this position
+
+        auto const split = std::lower_bound(except_positions.begin(), except_positions.end(),
+                                            static_cast<size_t>(pos_as_num));
+        size_t const split_idx = split - except_positions.begin();
+
+        for (auto it = split; it != except_positions.end(); ++it)
+            *it += count;
+
+        if (needs_exception(value))
+        {
+            std::vector<size_t> new_positions(count);
+            std::iota(new_positions.begin(), new_positions.end(), static_cast<size_t>(pos_as_num));
+            except_positions.insert(except_positions.begin() + split_idx,
+                                    new_positions.begin(), new_positions.end());
+            except_letters.insert(except_letters.begin() + split_idx, count, value);
+        }
+
+        base_data.insert(base_data.cbegin() + pos_as_num, count, to_base(value));
+
+        return begin() + pos_as_num;
+    }
+
+    /*!\brief Inserts elements from range `[begin_it, end_it)` before position in the container.
+     *
+     * The behaviour is undefined if begin_it and end_it are iterators into `*this`. The range is traversed
+     * twice (it is a forward range), once per plane.
+     */
+    template <std::ForwardIterator begin_iterator_type, std::Sentinel<begin_iterator_type> end_iterator_type>
+    iterator insert(const_iterator pos, begin_iterator_type begin_it, end_iterator_type end_it)
+    //!\cond
+        requires std::CommonReference<value_type_t<begin_iterator_type>, value_type>
+    //!\endcond
+    {
+        auto const pos_as_num = std::distance(cbegin(), pos);
+
+        std::vector<size_t> new_positions{};
+        std::vector<value_type> new_letters{};
+        size_t count = 0;
+        for (auto it = begin_it; it != end_it; ++it, ++count)
+        {
+            value_type const letter{*it};
+            if (needs_exception(letter))
+            {
+                new_positions.push_back(pos_as_num + count);
+                new_letters.push_back(letter);
+            }
+        }
+
+        auto const split = std::lower_bound(except_positions.begin(), except_positions.end(),
+                                            static_cast<size_t>(pos_as_num));
+        size_t const split_idx = split - except_positions.begin();
+
+        for (auto it = split; it != except_positions.end(); ++it)
+            *it += count;
+
+        except_positions.insert(except_positions.begin() + split_idx,
+                                new_positions.begin(), new_positions.end());
+        except_letters.insert(except_letters.begin() + split_idx, new_letters.begin(), new_letters.end());
+
+        auto v = std::ranges::subrange<begin_iterator_type, end_iterator_type>{begin_it, end_it}
+               | std::view::transform([] (auto const & in) { return to_base(static_cast<value_type>(in)); });
+        base_data.insert(base_data.cbegin() + pos_as_num, seqan3::begin(v), seqan3::end(v));
+
+        return begin() + pos_as_num;
+    }
+
+    //!\brief Inserts elements from an initialiser list before position in the container.
+    iterator insert(const_iterator pos, std::initializer_list<value_type> const & ilist)
+    {
+        return insert(pos, ilist.begin(), ilist.end());
+    }
+
+    //!\brief Removes the elements in the range `[begin_it, end_it)` from the container.
+    iterator erase(const_iterator begin_it, const_iterator end_it)
+    {
+        if (begin_it >= end_it) // [[unlikely]]
+            return begin() + std::distance(cbegin(), end_it);
+
+        auto const begin_it_pos = std::distance(cbegin(), begin_it);
+        auto const end_it_pos = std::distance(cbegin(), end_it);
+
+        auto const lo = std::lower_bound(except_positions.begin(), except_positions.end(),
+                                         static_cast<size_t>(begin_it_pos));
+        auto const hi = std::lower_bound(except_positions.begin(), except_positions.end(),
+                                         static_cast<size_t>(end_it_pos));
+        size_t const lo_idx = lo - except_positions.begin();
+        size_t const hi_idx = hi - except_positions.begin();
+
+        except_letters.erase(except_letters.begin() + lo_idx, except_letters.begin() + hi_idx);
+        except_positions.erase(lo, hi);
+
+        for (size_t i = lo_idx; i < except_positions.size(); ++i)
+            except_positions[i] -= (end_it_pos - begin_it_pos);
+
+        base_data.erase(base_data.cbegin() + begin_it_pos, base_data.cbegin() + end_it_pos);
+
+        return begin() + begin_it_pos;
+    }
+
+    //!\brief Removes the element at `pos` from the container.
+    iterator erase(const_iterator pos)
+    {
+        return erase(pos, pos + 1);
+    }
+
+    //!\brief Appends the given element value to the end of the container.
+    void push_back(value_type const value)
+    {
+        if (needs_exception(value)) // appended positions keep the dictionary sorted
+        {
+            except_positions.push_back(size());
+            except_letters.push_back(value);
+        }
+
+        base_data.push_back(to_base(value));
+    }
+
+    //!\brief Removes the last element of the container. Calling this on an empty container is undefined behaviour.
+    void pop_back()
+    {
+        assert(size() > 0);
+
+        if (!except_positions.empty() && except_positions.back() == size() - 1)
+        {
+            except_positions.pop_back();
+            except_letters.pop_back();
+        }
+
+        base_data.pop_back();
+    }
+
+    //!\brief Resizes the container to contain `count` elements (new elements are value-initialised).
+    void resize(size_type const count)
+    {
+        resize(count, value_type{});
+    }
+
+    //!\copybrief resize()
+    //!\param value Append copies of `value` when resizing.
+    void resize(size_type const count, value_type const value)
+    {
+        assert(count < max_size());
+
+        if (count < size())
+        {
+            erase(cbegin() + count, cend());
+        }
+        else if (count > size())
+        {
+            insert(cend(), count - size(), value);
+        }
+    }
+
+    //!\brief Swap contents with another instance.
+    void swap(twobit_vector & rhs) noexcept
+    {
+        std::swap(base_data, rhs.base_data);
+        std::swap(except_positions, rhs.except_positions);
+        std::swap(except_letters, rhs.except_letters);
+    }
+
+    //!\copydoc swap()
+    void swap(twobit_vector && rhs) noexcept
+    {
+        swap(rhs);
+    }
+    //!\}
+
+    //!\brief Swap contents of two instances.
+    friend void swap(twobit_vector & lhs, twobit_vector & rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+
+    //!\overload
+    friend void swap(twobit_vector && lhs, twobit_vector && rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+
+    /*!\name Comparison operators
+     * \{
+     */
+    //!\brief Checks whether `*this` is equal to `rhs`.
+    bool operator==(twobit_vector const & rhs) const noexcept
+    {
+        return base_data == rhs.base_data &&
+               except_positions == rhs.except_positions &&
+               except_letters == rhs.except_letters;
+    }
+
+    //!\brief Checks whether `*this` is not equal to `rhs`.
+    bool operator!=(twobit_vector const & rhs) const noexcept
+    {
+        return !(*this == rhs);
+    }
+
+    //!\brief Checks whether `*this` is less than `rhs` (lexicographically on the letter values).
+    bool operator<(twobit_vector const & rhs) const noexcept
+    {
+        return compare_element_wise(rhs) < 0;
+    }
+
+    //!\copydoc operator<()
+    bool operator>(twobit_vector const & rhs) const noexcept
+    {
+        return compare_element_wise(rhs) > 0;
+    }
+
+    //!\copydoc operator<()
+    bool operator<=(twobit_vector const & rhs) const noexcept
+    {
+        return compare_element_wise(rhs) <= 0;
+    }
+
+    //!\copydoc operator<()
+    bool operator>=(twobit_vector const & rhs) const noexcept
+    {
+        return compare_element_wise(rhs) >= 0;
+    }
+    //!\}
+
+    /*!\cond DEV
+     * \brief Serialisation support function.
+     * \tparam archive_t Type of `archive`; must satisfy seqan3::CerealArchive.
+     * \param archive The archive being serialised from/to.
+     *
+     * The exception letters are archived as their ranks, one byte each; they are few by design.
+     *
+     * \attention These functions are never called directly, see \ref serialisation for more details.
+     */
+    template <CerealArchive archive_t>
+    void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+    {
+#if SEQAN3_WITH_CEREAL
+        archive(base_data);
+        archive(except_positions);
+
+        uint64_t letter_count = except_letters.size();
+        archive(letter_count);
+        except_letters.resize(letter_count); // no-op when storing
+
+        for (auto & letter : except_letters)
+        {
+            uint8_t rank = to_rank(letter);
+            archive(rank);
+            letter.assign_rank(rank);
+        }
+#endif
+    }
+    //!\endcond
+
+private:
+    //!\brief Lexicographic three-way comparison on the letter values; used by the comparison operators.
+    int compare_element_wise(twobit_vector const & rhs) const noexcept
+    {
+        size_type const common = std::min(size(), rhs.size());
+        for (size_type i = 0; i < common; ++i)
+        {
+            if (value_type const l = element_at(i), r = rhs.element_at(i); l != r)
+                return l < r ? -1 : 1;
+        }
+
+        if (size() != rhs.size())
+            return size() < rhs.size() ? -1 : 1;
+        return 0;
+    }
+};
+
+} // namespace seqan3
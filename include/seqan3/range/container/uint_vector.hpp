@@ -0,0 +1,578 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::uint_vector.
+ */
+
+#pragma once
+
+#include <type_traits>
+
+#include <sdsl/int_vector.hpp>
+
+#include <seqan3/core/concept/cereal.hpp>
+#include <seqan3/core/metafunction/all.hpp>
+#include <seqan3/range/shortcuts.hpp>
+#include <seqan3/range/detail/random_access_iterator.hpp>
+#include <seqan3/std/concepts>
+#include <seqan3/std/iterator>
+#include <seqan3/std/ranges>
+
+namespace seqan3
+{
+
+/*!\brief A space-optimised version of std::vector<uint64_t> that stores every value in a fixed number of bits.
+ * \tparam bit_width The number of bits per value; must be in the range [1, 64].
+ * \implements seqan3::reservable_container_concept
+ * \implements seqan3::Cerealisable
+ * \ingroup container
+ *
+ * \details
+ *
+ * This class template behaves like std::vector<uint64_t>, but packs every value into `bit_width` bits of the
+ * underlying storage, i.e. it uses `bit_width / 64` of the memory that std::vector<uint64_t> uses. Values
+ * must be representable in `bit_width` bits; storing a larger value is undefined behaviour (in debug mode an
+ * assertion checks every write).
+ *
+ * The main use case are large arrays of offsets whose maximum is known (or can be bounded) in advance, e.g.
+ * the delimiters of seqan3::concatenated_sequences: for 10<sup>8</sup> sequences the default
+ * std::vector<size_t> delimiters occupy 800MiB, while `uint_vector<40>` — sufficient for a terabyte of
+ * payload — occupies 500MiB and `uint_vector<32>` half that. Pass the type as the second template
+ * parameter of seqan3::concatenated_sequences to select it as the delimiter policy.
+ *
+ * Like all bit-packed containers, accessing an element costs a few cycles more than a plain memory access
+ * (shift and mask, possibly across a word boundary) and `vec[i] = value;` from two different threads at the
+ * same time **is not safe** if both values are stored in the same 64bit-block.
+ */
+template <size_t bit_width>
+//!\cond
+    requires (bit_width >= 1) && (bit_width <= 64)
+//!\endcond
+class uint_vector
+{
+private:
+    //!\brief Type of the underlying SDSL vector.
+    using data_type = sdsl::int_vector<bit_width>;
+
+    //!\brief The data storage.
+    data_type data;
+
+    //!\brief Proxy type returned as reference; reads and writes resolve to the packed storage.
+    class reference_proxy_type
+    {
+    private:
+        //!\brief The proxy of the underlying data type; wrapped in semiregular_t, because it isn't semiregular itself.
+        ranges::semiregular_t<typename data_type::reference> internal_proxy;
+
+    public:
+        /*!\name Constructors, destructor and assignment
+         * \{
+         */
+        reference_proxy_type() = default;
+        constexpr reference_proxy_type(reference_proxy_type const &) = default;
+        constexpr reference_proxy_type(reference_proxy_type &&) = default;
+        ~reference_proxy_type() = default;
+
+        //!\brief Assignment from another proxy assigns the **value**, like for std::vector<bool>::reference.
+        reference_proxy_type & operator=(reference_proxy_type const & rhs)
+        {
+            return *this = static_cast<uint64_t>(rhs);
+        }
+
+        //!\brief Construct from the proxy of the underlying data type.
+        reference_proxy_type(typename data_type::reference const internal) :
+            internal_proxy{internal}
+        {}
+
+        //!\brief Assign a value; it must be representable in `bit_width` bits.
+        reference_proxy_type & operator=(uint64_t const value)
+        {
+            assert(bit_width == 64 || value < (uint64_t{1} << bit_width));
+            internal_proxy.get() = value;
+            return *this;
+        }
+        //!\}
+
+        //!\brief Implicit conversion to the value.
+        operator uint64_t() const
+        {
+            return internal_proxy.get();
+        }
+
+        /*!\name Compound assignment
+         * \brief Read-modify-write on the packed storage.
+         * \{
+         */
+        //!\brief Add to the referenced value.
+        reference_proxy_type & operator+=(uint64_t const value)
+        {
+            return *this = static_cast<uint64_t>(*this) + value;
+        }
+
+        //!\brief Subtract from the referenced value.
+        reference_proxy_type & operator-=(uint64_t const value)
+        {
+            return *this = static_cast<uint64_t>(*this) - value;
+        }
+
+        //!\brief Increment the referenced value.
+        reference_proxy_type & operator++()
+        {
+            return *this += 1;
+        }
+
+        //!\brief Decrement the referenced value.
+        reference_proxy_type & operator--()
+        {
+            return *this -= 1;
+        }
+        //!\}
+    };
+
+    //!\cond
+    //!\brief Whether a range type has a value type assignable to ours (similar to bitcompressed_vector).
+    template <typename other_range_t>
+    static constexpr bool has_compatible_value_type_v =
+        std::ConvertibleTo<value_type_t<remove_cvref_t<other_range_t>>, uint64_t>;
+    //!\endcond
+
+public:
+    /*!\name Associated types
+     * \{
+     */
+    //!\brief Equals uint64_t; values are widened on read and narrowed (checked) on write.
+    using value_type        = uint64_t;
+    //!\brief A proxy type that resolves reads and writes to the packed storage.
+    using reference         = reference_proxy_type;
+    //!\brief Equals the value_type, because the underlying storage hands out packed values.
+    using const_reference   = value_type;
+    //!\brief The iterator type of this container (a random access iterator).
+    using iterator          = detail::random_access_iterator<uint_vector>;
+    //!\brief The const iterator type of this container (a random access iterator).
+    using const_iterator    = detail::random_access_iterator<uint_vector const>;
+    //!\brief A signed integer type (usually std::ptrdiff_t).
+    using difference_type   = ptrdiff_t;
+    //!\brief An unsigned integer type (usually std::size_t).
+    using size_type         = size_t;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    uint_vector() = default;
+    constexpr uint_vector(uint_vector const &) = default;
+    constexpr uint_vector(uint_vector &&) = default;
+    constexpr uint_vector & operator=(uint_vector const &) = default;
+    constexpr uint_vector & operator=(uint_vector &&) = default;
+    ~uint_vector() = default;
+
+    //!\brief Construct from a range of values convertible to uint64_t.
+    template <std::ranges::InputRange other_range_t>
+    //!\cond
+        requires has_compatible_value_type_v<other_range_t>
+    //!\endcond
+    explicit uint_vector(other_range_t && range) :
+        uint_vector{seqan3::begin(range), seqan3::end(range)}
+    {}
+
+    //!\brief Construct with `count` copies of `value`.
+    uint_vector(size_type const count, value_type const value)
+    {
+        assign(count, value);
+    }
+
+    //!\brief Construct from a pair of iterators.
+    template <std::ForwardIterator begin_iterator_type, std::Sentinel<begin_iterator_type> end_iterator_type>
+    uint_vector(begin_iterator_type begin_it, end_iterator_type end_it)
+    //!\cond
+        requires std::ConvertibleTo<value_type_t<begin_iterator_type>, value_type>
+    //!\endcond
+    {
+        insert(cend(), begin_it, end_it);
+    }
+
+    //!\brief Construct from an initialiser list.
+    uint_vector(std::initializer_list<value_type> ilist) :
+        uint_vector(std::begin(ilist), std::end(ilist))
+    {}
+
+    //!\brief Assign from an initialiser list.
+    uint_vector & operator=(std::initializer_list<value_type> ilist)
+    {
+        assign(std::begin(ilist), std::end(ilist));
+        return *this;
+    }
+
+    //!\brief Assign from a range of values convertible to uint64_t.
+    template <std::ranges::InputRange other_range_t>
+    //!\cond
+        requires has_compatible_value_type_v<other_range_t>
+    //!\endcond
+    void assign(other_range_t && range)
+    {
+        uint_vector rhs{std::forward<other_range_t>(range)};
+        swap(rhs);
+    }
+
+    //!\brief Assign `count` copies of `value`.
+    void assign(size_type const count, value_type const value)
+    {
+        assert(bit_width == 64 || value < (uint64_t{1} << bit_width));
+        data = data_type(count, value);
+    }
+
+    //!\brief Assign from a pair of iterators.
+    template <std::ForwardIterator begin_iterator_type, std::Sentinel<begin_iterator_type> end_iterator_type>
+    //!\cond
+        requires std::ConvertibleTo<value_type_t<begin_iterator_type>, value_type>
+    //!\endcond
+    void assign(begin_iterator_type begin_it, end_iterator_type end_it)
+    {
+        uint_vector rhs{begin_it, end_it};
+        swap(rhs);
+    }
+
+    //!\brief Assign from an initialiser list.
+    void assign(std::initializer_list<value_type> ilist)
+    {
+        assign(std::begin(ilist), std::end(ilist));
+    }
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    //!\brief Returns an iterator to the first element of the container.
+    iterator begin() noexcept
+    {
+        return iterator{*this};
+    }
+
+    //!\copydoc begin()
+    const_iterator begin() const noexcept
+    {
+        return const_iterator{*this};
+    }
+
+    //!\copydoc begin()
+    const_iterator cbegin() const noexcept
+    {
+        return const_iterator{*this};
+    }
+
+    //!\brief Returns an iterator to the element following the last element of the container.
+    iterator end() noexcept
+    {
+        return iterator{*this, size()};
+    }
+
+    //!\copydoc end()
+    const_iterator end() const noexcept
+    {
+        return const_iterator{*this, size()};
+    }
+
+    //!\copydoc end()
+    const_iterator cend() const noexcept
+    {
+        return const_iterator{*this, size()};
+    }
+    //!\}
+
+    /*!\name Element access
+     * \{
+     */
+    //!\brief Return the i-th element; writing through the returned proxy updates the packed storage.
+    reference operator[](size_type const i) noexcept
+    {
+        assert(i < size());
+        return {data[i]};
+    }
+
+    //!\brief Return the i-th element.
+    const_reference operator[](size_type const i) const noexcept
+    {
+        assert(i < size());
+        return data[i];
+    }
+
+    //!\brief Return the i-th element; throws std::out_of_range if `i >= size()`.
+    reference at(size_type const i)
+    {
+        if (i >= size()) // [[unlikely]]
+            throw std::out_of_range{"Trying to access element behind the last in uint_vector."};
+        return (*this)[i];
+    }
+
+    //!\copydoc at()
+    const_reference at(size_type const i) const
+    {
+        if (i >= size()) // [[unlikely]]
+            throw std::out_of_range{"Trying to access element behind the last in uint_vector."};
+        return (*this)[i];
+    }
+
+    //!\brief Return the first element. Calling this on an empty container is undefined behaviour.
+    reference front() noexcept
+    {
+        assert(size() > 0);
+        return (*this)[0];
+    }
+
+    //!\copydoc front()
+    const_reference front() const noexcept
+    {
+        assert(size() > 0);
+        return (*this)[0];
+    }
+
+    //!\brief Return the last element. Calling this on an empty container is undefined behaviour.
+    reference back() noexcept
+    {
+        assert(size() > 0);
+        return (*this)[size() - 1];
+    }
+
+    //!\copydoc back()
+    const_reference back() const noexcept
+    {
+        assert(size() > 0);
+        return (*this)[size() - 1];
+    }
+    //!\}
+
+    /*!\name Capacity
+     * \{
+     */
+    //!\brief Checks whether the container is empty.
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    //!\brief Returns the number of elements in the container.
+    size_type size() const noexcept
+    {
+        return data.size();
+    }
+
+    //!\brief Returns the maximum number of elements the container is able to hold.
+    size_type max_size() const noexcept
+    {
+        return data.max_size();
+    }
+
+    //!\brief Returns the number of elements that the container has currently allocated space for.
+    size_type capacity() const noexcept
+    {
+        return data.capacity();
+    }
+
+    //!\brief Increase the capacity to a value that's greater or equal to new_cap.
+    void reserve(size_type const new_cap)
+    {
+        data.reserve(new_cap);
+    }
+
+    //!\brief Requests the removal of unused capacity.
+    void shrink_to_fit()
+    {
+        data.shrink_to_fit();
+    }
+    //!\}
+
+    /*!\name Modifiers
+     * \{
+     */
+    //!\brief Removes all elements from the container.
+    void clear() noexcept
+    {
+        data.clear();
+    }
+
+    //!\brief Inserts `value` before position in the container.
+    iterator insert(const_iterator pos, value_type const value)
+    {
+        return insert(pos, 1, value);
+    }
+
+    //!\brief Inserts `count` copies of `value` before position in the container.
+    iterator insert(const_iterator pos, size_type const count, value_type const value)
+    {
+        assert(bit_width == 64 || value < (uint64_t{1} << bit_width));
+        auto const pos_as_num = std::distance(cbegin(), pos);
+        data.insert(data.cbegin() + pos_as_num, count, value);
+        return begin() + pos_as_num;
+    }
+
+    //!\brief Inserts elements from range `[begin_it, end_it)` before position in the container.
+    template <std::ForwardIterator begin_iterator_type, std::Sentinel<begin_iterator_type> end_iterator_type>
+    //!\cond
+        requires std::ConvertibleTo<value_type_t<begin_iterator_type>, value_type>
+    //!\endcond
+    iterator insert(const_iterator pos, begin_iterator_type begin_it, end_iterator_type end_it)
+    {
+        auto const pos_as_num = std::distance(cbegin(), pos);
+
+        auto const size_before = size();
+        for (auto it = begin_it; it != end_it; ++it)
+            push_back(*it);
+
+        // rotate the appended elements to their target position
+        std::rotate(begin() + pos_as_num, begin() + size_before, end());
+        return begin() + pos_as_num;
+    }
+
+    //!\brief Inserts elements from an initialiser list before position in the container.
+    iterator insert(const_iterator pos, std::initializer_list<value_type> const & ilist)
+    {
+        return insert(pos, ilist.begin(), ilist.end());
+    }
+
+    //!\brief Removes the elements in the range `[begin_it, end_it)` from the container.
+    iterator erase(const_iterator begin_it, const_iterator end_it)
+    {
+        if (begin_it >= end_it) // [[unlikely]]
+            return begin() + std::distance(cbegin(), end_it);
+
+        auto const begin_it_pos = std::distance(cbegin(), begin_it);
+        auto const end_it_pos = std::distance(cbegin(), end_it);
+
+        data.erase(data.cbegin() + begin_it_pos,
+                   data.cbegin() + end_it_pos);
+
+        return begin() + begin_it_pos;
+    }
+
+    //!\brief Removes the element at `pos` from the container.
+    iterator erase(const_iterator pos)
+    {
+        return erase(pos, pos + 1);
+    }
+
+    //!\brief Appends the given element value to the end of the container.
+    void push_back(value_type const value)
+    {
+        assert(bit_width == 64 || value < (uint64_t{1} << bit_width));
+        data.push_back(value);
+    }
+
+    //!\brief Removes the last element of the container. Calling this on an empty container is undefined behaviour.
+    void pop_back()
+    {
+        assert(size() > 0);
+        data.pop_back();
+    }
+
+    //!\brief Resizes the container to contain `count` elements (new elements are value-initialised).
+    void resize(size_type const count)
+    {
+        assert(count < max_size());
+        data.resize(count);
+    }
+
+    //!\copybrief resize()
+    //!\param value Append copies of `value` when resizing.
+    void resize(size_type const count, value_type const value)
+    {
+        assert(count < max_size());
+        assert(bit_width == 64 || value < (uint64_t{1} << bit_width));
+        data.resize(count, value);
+    }
+
+    //!\brief Swap contents with another instance.
+    constexpr void swap(uint_vector & rhs) noexcept
+    {
+        std::swap(data, rhs.data);
+    }
+
+    //!\copydoc swap()
+    constexpr void swap(uint_vector && rhs) noexcept
+    {
+        std::swap(data, rhs.data);
+    }
+    //!\}
+
+    //!\brief Swap contents of two instances.
+    friend constexpr void swap(uint_vector & lhs, uint_vector & rhs) noexcept
+    {
+        std::swap(lhs.data, rhs.data);
+    }
+
+    //!\overload
+    friend constexpr void swap(uint_vector && lhs, uint_vector && rhs) noexcept
+    {
+        std::swap(lhs.data, rhs.data);
+    }
+
+    /*!\name Comparison operators
+     * \{
+     */
+    //!\brief Checks whether `*this` is equal to `rhs`.
+    bool operator==(uint_vector const & rhs) const noexcept
+    {
+        return data == rhs.data;
+    }
+
+    //!\brief Checks whether `*this` is not equal to `rhs`.
+    bool operator!=(uint_vector const & rhs) const noexcept
+    {
+        return data != rhs.data;
+    }
+
+    //!\brief Checks whether `*this` is less than `rhs` (lexicographically).
+    bool operator<(uint_vector const & rhs) const noexcept
+    {
+        return data < rhs.data;
+    }
+
+    //!\brief Checks whether `*this` is greater than `rhs` (lexicographically).
+    bool operator>(uint_vector const & rhs) const noexcept
+    {
+        return data > rhs.data;
+    }
+
+    //!\brief Checks whether `*this` is less than or equal to `rhs` (lexicographically).
+    bool operator<=(uint_vector const & rhs) const noexcept
+    {
+        return data <= rhs.data;
+    }
+
+    //!\brief Checks whether `*this` is greater than or equal to `rhs` (lexicographically).
+    bool operator>=(uint_vector const & rhs) const noexcept
+    {
+        return data >= rhs.data;
+    }
+    //!\}
+
+    /*!\cond DEV
+     * \brief Serialisation support function.
+     * \tparam archive_t Type of `archive`; must satisfy seqan3::CerealArchive.
+     * \param archive The archive being serialised from/to.
+     *
+     * The packed payload is archived as one aligned binary blob in host byte order, like for
+     * seqan3::bitcompressed_vector.
+     *
+     * \attention These functions are never called directly, see \ref serialisation for more details.
+     */
+    template <CerealArchive archive_t>
+    void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+    {
+#if SEQAN3_WITH_CEREAL
+        uint64_t size = data.size();
+        archive(size);
+        data.resize(size); // no-op when storing, allocates the payload when loading
+
+        uint64_t const word_count = (size * bit_width + 63) / 64;
+        archive(cereal::binary_data(data.data(), word_count * sizeof(uint64_t)));
+#endif
+    }
+    //!\endcond
+};
+
+} // namespace seqan3
@@ -14,6 +14,7 @@
 
 #include <seqan3/core/platform.hpp>
 #include <seqan3/range/decorator/gap_decorator_anchor_set.hpp>
+#include <seqan3/range/decorator/gap_decorator_rank_select.hpp>
 
 /*!\defgroup decorator Decorator
  * \brief The decorator submodule contains special SeqAn3 decorators and generic decorator concepts.
@@ -20,6 +20,7 @@
 
 #include <seqan3/alignment/exception.hpp>
 #include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/concept/tuple.hpp>
 #include <seqan3/alphabet/gap/gap.hpp>
 #include <seqan3/alphabet/gap/gapped.hpp>
 #include <seqan3/range/container/concept.hpp>
@@ -452,6 +453,66 @@ public:
         return iterator{*this, pos};
     }
 
+    /*!\brief Insert multiple gap runs in one pass.
+     * \tparam gap_runs_t    Type of the gap run description; must model std::ranges::ForwardRange over a tuple-like
+     *                       type holding (position, length) pairs.
+     * \param[in] gap_runs   The gap runs to insert; positions refer to the *final* aligned sequence (i.e. they
+     *                       include all preceding runs of the description) and must be ascending.
+     *
+     * \details
+     *
+     * Inserting a gap run with insert_gap() updates the cumulative sizes of all succeeding anchors, so building a
+     * gapped sequence from a traceback run by run is quadratic in the number of runs. This function appends the
+     * anchors of an ascending run description directly, which costs constant time per run. If the decorator already
+     * contains gaps, it falls back to run-wise insertion.
+     *
+     * ### Complexity
+     *
+     * Linear in the number of runs if the decorator contains no gaps yet, \f$O(runs \cdot k)\f$ otherwise.
+     */
+    template <std::ranges::ForwardRange gap_runs_t>
+    //!\cond
+        requires tuple_like_concept<value_type_t<remove_cvref_t<gap_runs_t>>>
+    //!\endcond
+    void insert_gaps(gap_runs_t && gap_runs)
+    {
+        if (!anchors.empty()) // cannot append directly; delegate to run-wise insertion
+        {
+            for (auto && run : gap_runs)
+                insert_gap(iterator{*this, std::get<0>(run)}, std::get<1>(run));
+            return;
+        }
+
+        size_type accumulated{0};
+        size_type last_end{0}; // aligned end position of the previously inserted run
+        for (auto && run : gap_runs)
+        {
+            size_type const pos = std::get<0>(run);
+            size_type const count = std::get<1>(run);
+
+            if (!count) // [[unlikely]]
+                continue;
+
+            accumulated += count;
+
+            if (pos <= last_end && !anchors.empty()) // extends the previous run; keep runs maximal
+            {
+                auto last = std::prev(anchors.end());
+                anchor_gap_t gap{last->first, accumulated};
+                anchors.erase(last);
+                anchors.insert(anchors.end(), gap);
+                last_end += count;
+            }
+            else
+            {
+                assert(pos >= last_end); // runs must be ascending
+                anchors.emplace_hint(anchors.end(), anchor_gap_t{pos, accumulated});
+                last_end = pos + count;
+            }
+        }
+        assert(size() >= accumulated);
+    }
+
    /*!\brief Erase one gap symbol at the indicated iterator postion.
     * \param it     Iterator indicating the gap to be erased.
     * \returns      Iterator following the last removed element.
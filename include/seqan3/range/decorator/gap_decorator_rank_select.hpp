@@ -0,0 +1,605 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::gap_decorator_rank_select.
+ * \author Marie Hoffmann <marie.hoffmann AT fu-berlin.de>
+ * \author Svenja Mehringer <svenja.mehringer AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <cassert>
+#include <type_traits>
+
+#include <sdsl/int_vector.hpp>
+#include <sdsl/rank_support.hpp>
+#include <sdsl/util.hpp>
+
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/alphabet/gap/gap.hpp>
+#include <seqan3/alphabet/gap/gapped.hpp>
+#include <seqan3/core/concept/tuple.hpp>
+#include <seqan3/core/metafunction/range.hpp>
+#include <seqan3/range/container/concept.hpp>
+#include <seqan3/range/detail/random_access_iterator.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3
+{
+
+/*!\brief A gap decorator allows the annotation of sequences with gap symbols
+ *        while leaving the underlying sequence unmodified.
+ * \tparam inner_type The type of range that will be decorated with gaps; must model std::ranges::RandomAccessRange
+ *                    and std::ranges::SizedRange.
+ * \implements seqan3::aligned_sequence_concept
+ * \ingroup decorator
+ *
+ * \details
+ *
+ * This class is an alternative to seqan3::gap_decorator_anchor_set that is optimised for **read-mostly** workloads.
+ * It stores one bit per aligned position (1 = gap, 0 = sequence symbol) in a bitvector augmented with a constant-time
+ * rank support structure. Resolving a (virtual) aligned position to the underlying (ungapped) position is a single
+ * rank query, so random access is \f$O(1)\f$ and the iterator models std::RandomAccessIterator.
+ * The price is paid on modification: inserting or erasing gaps rewrites the bitvector and rebuilds the rank support,
+ * both linear in the length of the aligned sequence. Use seqan3::gap_decorator_anchor_set instead if gaps are
+ * inserted and erased frequently.
+ *
+ * ### Performance
+ *
+ * **n** The length of the underlying sequence.
+ * **k** The number of contiguous gaps (not gap symbols).
+ * **l** The total number of gap symbols.
+ *
+ * |            | access next | random access    | gap insert/erase at end | gap insert/erase random | size overhead    |
+ * |------------|-------------|----------------- |-------------------------|-------------------------|------------------|
+ * | decorator  | \f$O(1)\f$  | \f$O(1)\f$       | \f$O(n + l)\f$          | \f$O(n + l)\f$          | \f$O(n)\f$ bits  |
+ * | anchor set | \f$O(1)\f$  | \f$O(\log(k))\f$ | \f$O(\log(k))\f$        | \f$O(k)\f$              | \f$O(k)\f$ words |
+ *
+ * The *size overhead* refers to the space that is needed when using each of the data structures in addition to an
+ * already existing ungapped sequence. The bitvector costs one bit per aligned position plus circa 6% for the
+ * rank support, independent of the number of gaps.
+ *
+ * ### Implementation details
+ *
+ * The decorator stores an sdsl::bit_vector of the aligned length where bit `i` is set iff the aligned position `i`
+ * is a gap. The underlying position of a non-gap position `i` is `i` minus the number of set bits before `i`, which
+ * an sdsl::rank_support_v5 answers in constant time with low memory overhead. Every modifying operation rewrites the
+ * bitvector and reinitialises the rank support so that read accesses never pay for deferred bookkeeping.
+ *
+ * A decorator can also be bulk-constructed from an existing gap pattern (any forward range convertible to `bool`,
+ * e.g. one extracted from another aligned sequence), which costs a single linear pass instead of repeated
+ * insert_gap() calls.
+ */
+template <std::ranges::ViewableRange inner_type>
+//!\cond
+    requires std::ranges::RandomAccessRange<inner_type> && std::ranges::SizedRange<inner_type> &&
+             (std::is_const_v<std::remove_reference_t<inner_type>> || std::ranges::View<inner_type>)
+//!\endcond
+class gap_decorator_rank_select
+{
+public:
+    /*!\name Range-associated member types
+     * \{
+     */
+    //!\brief The union type of the alphabet type and gap symbol type (see seqan3::gapped).
+    using value_type = gapped<value_type_t<inner_type>>;
+    //!\brief Use the value type as reference type because the underlying sequence must not be modified.
+    using reference = value_type;
+    //!\brief const_reference type equals reference type equals value type because the underlying sequence must not
+    //!       be modified.
+    using const_reference = reference;
+    //!\brief The size_type of the underlying sequence.
+    using size_type = size_type_t<inner_type>;
+    //!\brief The difference type of the underlying sequence.
+    using difference_type = difference_type_t<inner_type>;
+    //!\brief The iterator type of this container (a random access iterator).
+    using iterator = detail::random_access_iterator<gap_decorator_rank_select const>;
+    //!\brief The const_iterator equals the iterator type. Since no references are ever returned and thus the underlying
+    //!        sequence cannot be modified through the iterator there is no need for const.
+    using const_iterator = iterator;
+    //!\}
+
+    //!\brief The underlying ungapped range type.
+    using unaligned_seq_type = inner_type;
+
+    /*!\name Constructors, destructor and assignment.
+     * \{
+     */
+    //!\brief Default constructor. Attention: all operations on a solely default constructed decorator,
+    //!       except assigning a new range, are UB.
+    gap_decorator_rank_select() = default;
+
+    //!\brief Copy constructor. Reseats the rank support onto the copied bitvector.
+    gap_decorator_rank_select(gap_decorator_rank_select const & rhs) :
+        ungapped_view{rhs.ungapped_view}, gaps{rhs.gaps}, gap_rank{rhs.gap_rank}
+    {
+        gap_rank.set_vector(&gaps);
+    }
+
+    //!\brief Copy construction via assignment.
+    gap_decorator_rank_select & operator=(gap_decorator_rank_select const & rhs)
+    {
+        ungapped_view = rhs.ungapped_view;
+        gaps = rhs.gaps;
+        gap_rank = rhs.gap_rank;
+        gap_rank.set_vector(&gaps);
+        return *this;
+    }
+
+    //!\brief Move constructor. Reseats the rank support onto the moved bitvector.
+    gap_decorator_rank_select(gap_decorator_rank_select && rhs) :
+        ungapped_view{std::move(rhs.ungapped_view)}, gaps{std::move(rhs.gaps)}, gap_rank{std::move(rhs.gap_rank)}
+    {
+        gap_rank.set_vector(&gaps);
+    }
+
+    //!\brief Move assignment.
+    gap_decorator_rank_select & operator=(gap_decorator_rank_select && rhs)
+    {
+        ungapped_view = std::move(rhs.ungapped_view);
+        gaps = std::move(rhs.gaps);
+        gap_rank = std::move(rhs.gap_rank);
+        gap_rank.set_vector(&gaps);
+        return *this;
+    }
+
+    //!\brief Use default deconstructor.
+    ~gap_decorator_rank_select() = default;
+
+    //!\brief Construct with the ungapped range type.
+    template <typename other_range_t>
+    //!\cond
+         requires !std::Same<other_range_t, gap_decorator_rank_select> &&
+                  std::Same<remove_cvref_t<other_range_t>, remove_cvref_t<inner_type>> &&
+                  std::ranges::ViewableRange<other_range_t> // at end, otherwise it competes with the move ctor
+    //!\endcond
+    gap_decorator_rank_select(other_range_t && range) :
+        ungapped_view{std::view::all(std::forward<inner_type>(range))},
+        gaps(std::ranges::size(ungapped_view), 0u)
+    {
+        sdsl::util::init_support(gap_rank, &gaps);
+    } // TODO (@smehringer) only works for copyable views. Has to be changed once views are not required to be copyable anymore.
+
+    /*!\brief Bulk-construct from the ungapped range type and an existing gap pattern.
+     * \tparam other_range_t   The type of the ungapped range; must be (reference-)identical to `inner_type`.
+     * \tparam gap_pattern_t   The type of the gap pattern; must model std::ranges::ForwardRange over a type
+     *                         convertible to `bool`.
+     * \param[in] range        The ungapped range to decorate.
+     * \param[in] gap_pattern  One entry per *aligned* position; `true` marks a gap.
+     *
+     * The number of `false` entries in \p gap_pattern must equal the length of \p range.
+     *
+     * ### Complexity
+     *
+     * Linear in the length of the gap pattern; no per-gap overhead.
+     */
+    template <typename other_range_t, std::ranges::ForwardRange gap_pattern_t>
+    //!\cond
+         requires !std::Same<other_range_t, gap_decorator_rank_select> &&
+                  std::Same<remove_cvref_t<other_range_t>, remove_cvref_t<inner_type>> &&
+                  std::ranges::ViewableRange<other_range_t> &&
+                  std::ConvertibleTo<reference_t<gap_pattern_t>, bool>
+    //!\endcond
+    gap_decorator_rank_select(other_range_t && range, gap_pattern_t && gap_pattern) :
+        ungapped_view{std::view::all(std::forward<inner_type>(range))},
+        gaps(std::ranges::distance(gap_pattern), 0u)
+    {
+        size_type i = 0;
+        for (auto && is_gap : gap_pattern)
+            gaps[i++] = static_cast<bool>(is_gap);
+
+        assert(gaps.size() - sdsl::util::cnt_one_bits(gaps) == std::ranges::size(ungapped_view));
+
+        sdsl::util::init_support(gap_rank, &gaps);
+    }
+    //!\}
+
+    /*!\brief Returns the total length of the aligned sequence.
+     * \returns The total length of the aligned sequence (gaps included).
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    size_type size() const noexcept
+    {
+        return gaps.size();
+    }
+
+    /*!\name Aligned sequence modifications
+     * \{
+     */
+    /*!\brief Insert a gap of length count at the aligned sequence iterator position.
+     * \param it     Iterator indicating the gap start position in the aligned sequence.
+     * \param count  Number of gap symbols to be inserted.
+     * \returns      An iterator pointing to the start position of the insertion.
+     *
+     * ### Complexity
+     *
+     * Linear in the length of the aligned sequence (the bitvector is rewritten and the rank support rebuilt).
+     */
+    iterator insert_gap(iterator const it, size_type const count = 1)
+    {
+        assert(ungapped_view.size());
+
+        size_type const pos = it - begin();
+        assert(pos <= size());
+
+        if (!count) // [[unlikely]]
+            return it;
+
+        sdsl::bit_vector new_gaps(gaps.size() + count, 0u);
+
+        for (size_type i = 0; i < pos; ++i)
+            new_gaps[i] = gaps[i];
+        for (size_type i = 0; i < count; ++i)
+            new_gaps[pos + i] = true;
+        for (size_type i = pos; i < gaps.size(); ++i)
+            new_gaps[i + count] = gaps[i];
+
+        gaps = std::move(new_gaps);
+        sdsl::util::init_support(gap_rank, &gaps);
+
+        return iterator{*this, pos};
+    }
+
+    /*!\brief Insert multiple gap runs in one pass.
+     * \tparam gap_runs_t    Type of the gap run description; must model std::ranges::ForwardRange over a tuple-like
+     *                       type holding (position, length) pairs.
+     * \param[in] gap_runs   The gap runs to insert; positions refer to the *final* aligned sequence (i.e. they
+     *                       include all preceding runs of the description) and must be ascending.
+     *
+     * \details
+     *
+     * The bitvector is rewritten and the rank support rebuilt exactly once, independent of the number of runs.
+     *
+     * ### Complexity
+     *
+     * Linear in the length of the resulting aligned sequence.
+     */
+    template <std::ranges::ForwardRange gap_runs_t>
+    //!\cond
+        requires tuple_like_concept<value_type_t<remove_cvref_t<gap_runs_t>>>
+    //!\endcond
+    void insert_gaps(gap_runs_t && gap_runs)
+    {
+        size_type total{0};
+        for (auto && run : gap_runs)
+            total += std::get<1>(run);
+
+        if (!total) // [[unlikely]]
+            return;
+
+        sdsl::bit_vector new_gaps(gaps.size() + total, 0u);
+
+        size_type src{0}; // position in the old bitvector
+        size_type dst{0}; // position in the new bitvector
+        for (auto && run : gap_runs)
+        {
+            size_type const pos = std::get<0>(run);
+            size_type const count = std::get<1>(run);
+            assert(pos >= dst); // runs must be ascending
+
+            for (; dst < pos; ++src, ++dst)
+            {
+                assert(src < gaps.size()); // a run position must not exceed the end of the aligned sequence
+                new_gaps[dst] = gaps[src];
+            }
+            for (size_type i = 0; i < count; ++i)
+                new_gaps[dst++] = true;
+        }
+        for (; src < gaps.size(); ++src, ++dst)
+            new_gaps[dst] = gaps[src];
+
+        gaps = std::move(new_gaps);
+        sdsl::util::init_support(gap_rank, &gaps);
+    }
+
+   /*!\brief Erase one gap symbol at the indicated iterator postion.
+    * \param it     Iterator indicating the gap to be erased.
+    * \returns      Iterator following the last removed element.
+    * \throws seqan3::gap_erase_failure if character is no seqan3::gap.
+    *
+    * \details
+    *
+    * ### Complexity
+    *
+    * Linear in the length of the aligned sequence.
+    */
+    iterator erase_gap(iterator const it)
+    {
+        assert(ungapped_view.size());
+
+        if ((*it) != gap{}) // [[unlikely]]
+            throw gap_erase_failure("The range to be erased does not correspond to a consecutive gap.");
+
+        return erase_gap(it, std::next(it));
+    }
+
+    /*!\brief Erase gap symbols at the iterator postions [first, last[.
+     * \param[in]   first    The iterator pointing to the position where to start inserting gaps.
+     * \param[in]   last     The iterator pointing to the position where to stop erasing gaps.
+     * \returns     Iterator following the last removed element.
+     * \throws seqan3::gap_erase_failure if [\p first, \p last[ does not correspond
+     * to a consecutive range of seqan3::gap 's.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * Linear in the length of the aligned sequence.
+     */
+    iterator erase_gap(iterator const first, iterator const last)
+    {
+        assert(ungapped_view.size());
+
+        size_type const pos1 = first - begin();
+        size_type const pos2 = last - begin();
+        assert(pos1 <= pos2 && pos2 <= size());
+
+        for (size_type i = pos1; i < pos2; ++i)
+            if (!gaps[i]) // [[unlikely]]
+                throw gap_erase_failure{"The range to be erased does not correspond to a consecutive gap."};
+
+        sdsl::bit_vector new_gaps(gaps.size() - (pos2 - pos1), 0u);
+
+        for (size_type i = 0; i < pos1; ++i)
+            new_gaps[i] = gaps[i];
+        for (size_type i = pos2; i < gaps.size(); ++i)
+            new_gaps[i - (pos2 - pos1)] = gaps[i];
+
+        gaps = std::move(new_gaps);
+        sdsl::util::init_support(gap_rank, &gaps);
+
+        return iterator{*this, pos1};
+    }
+
+    /*!\brief Assigns a new sequence of type seqan3::gap_decorator_rank_select::unaligned_seq_type to the decorator.
+     * \param[in,out] dec       The decorator to modify.
+     * \param[in]     unaligned The unaligned sequence to assign.
+     */
+    template <typename unaligned_seq_t> // generic template to use forwarding reference
+    //!\cond
+        requires std::Constructible<gap_decorator_rank_select, unaligned_seq_t>
+    //!\endcond
+    friend void assign_unaligned(gap_decorator_rank_select & dec, unaligned_seq_t && unaligned)
+    {
+        dec = unaligned;
+    }
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    /*!\brief Returns an iterator to the first element of the container.
+     * \returns Iterator to the first element.
+     *
+     * If the container is empty, the returned iterator will be equal to end().
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    iterator begin() const noexcept
+    {
+        return iterator{*this};
+    }
+
+    //!\copydoc begin()
+    const_iterator cbegin() const noexcept
+    {
+        return const_iterator{*this};
+    }
+
+    /*!\brief Returns an iterator to the element following the last element of the decorator.
+     * \returns Iterator to the behind last element.
+     *
+     * \attention This element acts as a placeholder; attempting to dereference it results in undefined behaviour.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    iterator end() const noexcept
+    {
+        return iterator{*this, size()};
+    }
+
+    //!\copydoc end()
+    const_iterator cend() const noexcept
+    {
+        return const_iterator{*this, size()};
+    }
+    //!\}
+
+    /*!\name Element access
+     * \{
+     */
+    /*!\brief Return the i-th element as a reference.
+     * \param i     The element to retrieve.
+     * \returns     A reference of the gapped alphabet type.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * Throws std::out_of_range exception if \p i is out of range.
+     */
+    reference at(size_type const i)
+    {
+        if (i >= size()) // [[unlikely]]
+            throw std::out_of_range{"Trying to access element behind the last in gap_decorator."};
+        return (*this)[i];
+    }
+
+    //!\copydoc at()
+    const_reference at(size_type const i) const
+    {
+        if (i >= size()) // [[unlikely]]
+            throw std::out_of_range{"Trying to access element behind the last in gap_decorator."};
+        return (*this)[i];
+    }
+
+    /*!\brief Return the i-th element as a reference.
+     * \param i     The element to retrieve.
+     * \returns     A reference of the gapped alphabet type.
+     *
+     * A gap position is detected by a single bit test; a non-gap position is mapped into the underlying sequence
+     * with one rank query.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     */
+    reference operator[](size_type const i) const noexcept
+    {
+        assert(i < size());
+
+        if (gaps[i])
+            return reference{gap{}};
+
+        return reference{ungapped_view[i - gap_rank(i)]};
+    }
+    //!\}
+
+    /*!\name Comparison operators
+     * \{
+     */
+    /*!\brief Compares two seqan3::gap_decorator_rank_select 's by underlying sequence and gaps.
+     * \param[in] lhs The left-hand side gap decorator to compare.
+     * \param[in] rhs The right-hand side gap decorator to compare.
+     * \returns A boolean flag indicating (in)equality of the aligned sequences.
+     *
+     * ### Complexity
+     * Linear in the length of the aligned sequence (the bitvectors are compared word-wise).
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee. Does not modify the aligned sequences.
+     */
+    friend bool operator==(gap_decorator_rank_select const & lhs, gap_decorator_rank_select const & rhs) noexcept
+    {
+        if (lhs.size() == rhs.size()  &&
+            lhs.gaps  == rhs.gaps     &&
+            std::ranges::equal(lhs.ungapped_view, rhs.ungapped_view))
+        {
+            return true;
+        }
+
+        return false;
+    }
+
+    //!\copydoc operator==
+    friend bool operator!=(gap_decorator_rank_select const & lhs, gap_decorator_rank_select const & rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator<(gap_decorator_rank_select const & lhs, gap_decorator_rank_select const & rhs) noexcept
+    {
+        auto lit = lhs.begin();
+        auto rit = rhs.begin();
+
+        while (lit != lhs.end() && rit != rhs.end() && *lit == *rit)
+            ++lit, ++rit;
+
+        if (rit == rhs.end())
+            return false;           //  lhs == rhs, or rhs prefix of lhs
+        else if (lit == lhs.end())
+            return true;            // lhs prefix of rhs
+
+        return *lit < *rit;
+    }
+
+    friend bool operator<=(gap_decorator_rank_select const & lhs, gap_decorator_rank_select const & rhs) noexcept
+    {
+        auto lit = lhs.begin();
+        auto rit = rhs.begin();
+
+        while (lit != lhs.end() && rit != rhs.end() && *lit == *rit)
+            ++lit, ++rit;
+
+        if (lit == lhs.end())
+            return true;            // lhs == rhs, or lhs prefix of rhs
+        else if (rit == rhs.end())
+            return false;           // rhs prefix of lhs
+
+        return *lit < *rit;
+    }
+
+    friend bool operator>(gap_decorator_rank_select const & lhs, gap_decorator_rank_select const & rhs) noexcept
+    {
+        return !(lhs <= rhs);
+    }
+
+    friend bool operator>=(gap_decorator_rank_select const & lhs, gap_decorator_rank_select const & rhs) noexcept
+    {
+        return !(lhs < rhs);
+    }
+    //!\}
+
+private:
+    //!\brief Stores a (copy of a) view to the ungapped, underlying sequence.
+    decltype(std::view::all(std::declval<inner_type &&>())) ungapped_view{};
+
+    //!\brief One bit per aligned position; a set bit marks a gap.
+    sdsl::bit_vector gaps{};
+
+    //!\brief Constant-time rank support over the set bits of `gaps`.
+    sdsl::rank_support_v5<1> gap_rank{};
+};
+
+/*!\name Type deduction guides
+ * \{
+ */
+//!\brief Ranges (not views!) always deduce to `const & range_type` since they are access-only anyway.
+template <std::ranges::ViewableRange urng_t>
+gap_decorator_rank_select(urng_t && range) -> gap_decorator_rank_select<std::remove_reference_t<urng_t> const &>;
+
+//!\brief Views always deduce to their respective type because they are copied.
+template <std::ranges::View urng_t>
+gap_decorator_rank_select(urng_t range) -> gap_decorator_rank_select<urng_t>;
+
+//!\brief The gap pattern does not participate in deduction of the decorated range type.
+template <std::ranges::ViewableRange urng_t, typename gap_pattern_t>
+gap_decorator_rank_select(urng_t && range, gap_pattern_t &&)
+    -> gap_decorator_rank_select<std::remove_reference_t<urng_t> const &>;
+
+//!\copydoc gap_decorator_rank_select(urng_t && range, gap_pattern_t &&)
+template <std::ranges::View urng_t, typename gap_pattern_t>
+gap_decorator_rank_select(urng_t range, gap_pattern_t &&) -> gap_decorator_rank_select<urng_t>;
+//!\}
+
+} // namespace seqan3
+
+namespace seqan3::detail
+{
+
+//!\brief Type trait that declares any seqan3::gap_decorator_rank_select to be **NOT a view**.
+template <typename type>
+constexpr int enable_view<seqan3::gap_decorator_rank_select<type>> = 0;
+
+template <typename type>
+constexpr int enable_view<seqan3::gap_decorator_rank_select<type> const> = 0;
+
+} // namespace seqan3::detail
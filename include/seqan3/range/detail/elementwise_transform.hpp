@@ -0,0 +1,487 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::elementwise_transform and the fusing seqan3::detail::elementwise_transform_view.
+ * \author Hannes Hauswedell <hannes.hauswedell AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <range/v3/algorithm/copy.hpp>
+
+#include <seqan3/core/metafunction/basic.hpp>
+#include <seqan3/core/metafunction/iterator.hpp>
+#include <seqan3/core/metafunction/range.hpp>
+#include <seqan3/core/metafunction/transformation_trait_or.hpp>
+#include <seqan3/range/concept.hpp>
+#include <seqan3/range/container/concept.hpp>
+#include <seqan3/range/shortcuts.hpp>
+#include <seqan3/range/detail/inherited_iterator_base.hpp>
+#include <seqan3/std/concepts>
+#include <seqan3/std/iterator>
+#include <seqan3/std/ranges>
+#include <seqan3/std/type_traits>
+
+namespace seqan3::detail
+{
+
+// ============================================================================
+//  fused_fn
+// ============================================================================
+
+/*!\brief A functor that is the composition of two functors (the first one is applied first).
+ * \tparam  first_fn_t Type of the functor applied first.
+ * \tparam second_fn_t Type of the functor applied to the result of the first.
+ * \ingroup range
+ *
+ * \details
+ *
+ * Created by seqan3::detail::elementwise_transform when two elementwise transformations are stacked on top of
+ * each other; fusing chains of more than two transformations nests seqan3::detail::fused_fn on the left, i.e.
+ * the result is always a single flat functor object.
+ */
+template <typename first_fn_t, typename second_fn_t>
+struct fused_fn
+{
+    //!\brief The functor applied first.
+    first_fn_t  first_fn;
+    //!\brief The functor applied to the result of #first_fn.
+    second_fn_t second_fn;
+
+    //!\brief Apply both functors, innermost first.
+    template <typename arg_t>
+    constexpr decltype(auto) operator()(arg_t && arg) const
+        noexcept(std::is_nothrow_invocable_v<first_fn_t const &, arg_t> &&
+                 std::is_nothrow_invocable_v<second_fn_t const &, std::invoke_result_t<first_fn_t const &, arg_t>>)
+    {
+        return second_fn(first_fn(std::forward<arg_t>(arg)));
+    }
+};
+
+/*!\name Template argument deduction guides.
+ * \{
+ */
+//!\brief Deduce both functor types from the constructor arguments.
+//!\relates seqan3::detail::fused_fn
+template <typename first_fn_t, typename second_fn_t>
+fused_fn(first_fn_t, second_fn_t) -> fused_fn<first_fn_t, second_fn_t>;
+//!\}
+
+// ============================================================================
+//  elementwise_transform_view
+// ============================================================================
+
+/*!\brief The type returned by seqan3::detail::elementwise_transform.
+ * \tparam urng_t The type of the underlying range, must model std::ranges::View.
+ * \tparam fn_t   Type of the callable applied to every element; must model std::Invocable with
+ *                seqan3::reference_t<urng_t> as argument.
+ * \implements std::ranges::View
+ * \ingroup range
+ *
+ * \details
+ *
+ * Behaves like the view returned by std::view::transform, but is *recognisable*: when another elementwise
+ * transformation is applied on top of this view (via seqan3::detail::elementwise_transform), the functors are
+ * combined into a single seqan3::detail::fused_fn over the original underlying range instead of nesting a second
+ * view. A stack of n adjacent elementwise transformations thus costs one iterator indirection plus one (inlined)
+ * composed function call per element access, not n nested `operator*` calls.
+ *
+ * Note that most members of this class are generated by ranges::view_interface which is not yet documented here.
+ */
+template <std::ranges::View urng_t, typename fn_t>
+class elementwise_transform_view : public ranges::view_interface<elementwise_transform_view<urng_t, fn_t>>
+{
+private:
+
+    static_assert(std::Invocable<fn_t &, reference_t<urng_t>>,
+                  "The functor type for detail::elementwise_transform must model "
+                  "std::Invocable<fn_t, reference_t<urng_t>>.");
+
+    //!\brief The underlying range.
+    urng_t urange;
+
+    //!\brief The functor.
+    ranges::semiregular_t<fn_t> fn;
+
+    //!\brief Whether this view is const_iterable or not.
+    static constexpr bool const_iterable = const_iterable_concept<urng_t> &&
+                                           std::RegularInvocable<fn_t const &, reference_t<urng_t>>;
+
+    //!\brief The iterator type inherits from the underlying type, but overwrites the dereference operator.
+    //!\tparam rng_t Should be `urng_t` for defining #iterator and `urng_t const` for defining #const_iterator.
+    template <typename rng_t>
+    class iterator_type : public inherited_iterator_base<iterator_type<rng_t>, std::ranges::iterator_t<rng_t>>
+    {
+    private:
+        //!\brief The iterator type of the underlying range.
+        using base_base_t = std::ranges::iterator_t<rng_t>;
+        //!\brief The CRTP wrapper type.
+        using base_t      = inherited_iterator_base<iterator_type, std::ranges::iterator_t<rng_t>>;
+        //!\brief The sentinel type of the underlying range.
+        using sentinel_type = std::ranges::sentinel_t<rng_t>;
+
+        //!\brief Auxiliary type.
+        using fn_ref_t = std::conditional_t<std::is_const_v<rng_t>,
+                                            std::remove_reference_t<fn_t> const &,
+                                            std::remove_reference_t<fn_t> &>;
+        //!\brief Reference to the functor stored in the view.
+        ranges::semiregular_t<fn_ref_t> fn;
+
+    public:
+        /*!\name Constructors, destructor and assignment
+         * \{
+         */
+        iterator_type() = default;
+        constexpr iterator_type(iterator_type const & rhs) = default;
+        constexpr iterator_type(iterator_type && rhs) = default;
+        constexpr iterator_type & operator=(iterator_type const & rhs) = default;
+        constexpr iterator_type & operator=(iterator_type && rhs) = default;
+        ~iterator_type() = default;
+
+        //!\brief Constructor that delegates to the CRTP layer and initialises the callable.
+        iterator_type(base_base_t it, fn_ref_t _fn) :
+            base_t{it}, fn{_fn} {}
+        //!\}
+
+        /*!\name Associated types
+         * \brief reference/value_type reflect the functor's result, the rest is derived from the base_base_t.
+         * \{
+         */
+        using difference_type       = typename std::iterator_traits<base_base_t>::difference_type;
+        using reference             = std::result_of_t<fn_ref_t(reference_t<rng_t>)>;
+        using value_type            = remove_cvref_t<reference>;
+        using pointer               = void;
+        using iterator_category     = iterator_tag_t<base_base_t>;
+        //!\}
+
+        //!\brief Dereference returns the functor applied to the underlying range's element.
+        constexpr reference operator*() const
+        {
+            return fn(*static_cast<base_base_t const &>(*this));
+        }
+
+        /*!\name Comparison operators
+         * \brief Comparison against self is inherited; we additionally define comparison against the sentinel.
+         * \{
+         */
+        bool operator==(sentinel_type const & rhs) const
+        //!\cond
+            requires !std::ranges::CommonRange<rng_t>
+        //!\endcond
+        {
+            return static_cast<base_base_t const &>(*this) == rhs;
+        }
+
+        friend bool operator==(sentinel_type const & lhs, iterator_type const & rhs)
+        //!\cond
+            requires !std::ranges::CommonRange<rng_t>
+        //!\endcond
+        {
+            return rhs == lhs;
+        }
+
+        bool operator!=(sentinel_type const & rhs) const
+        //!\cond
+            requires !std::ranges::CommonRange<rng_t>
+        //!\endcond
+        {
+            return !(*this == rhs);
+        }
+
+        friend bool operator!=(sentinel_type const & lhs, iterator_type const & rhs)
+        //!\cond
+            requires !std::ranges::CommonRange<rng_t>
+        //!\endcond
+        {
+            return rhs != lhs;
+        }
+        //!\}
+    }; // class iterator_type
+
+public:
+    /*!\name Associated types
+     * \{
+     */
+    //!\brief The reference_type (the result of the functor).
+    using reference         = typename iterator_type<urng_t>::reference;
+    //!\brief The const_reference type equals the reference type if the view is const-iterable.
+    using const_reference   = std::conditional_t<const_iterable, reference, void>;
+    //!\brief The value_type (which equals the reference_type with any references removed).
+    using value_type        = typename iterator_type<urng_t>::value_type;
+    //!\brief The size_type of the underlying range (`void` if the underlying range is not sized).
+    using size_type         = detail::transformation_trait_or_t<seqan3::size_type<urng_t>, void>;
+    //!\brief A signed integer type, usually std::ptrdiff_t.
+    using difference_type   = difference_type_t<urng_t>;
+    //!\brief The iterator type of this view.
+    using iterator          = iterator_type<urng_t>;
+    //!\brief The const_iterator type only exists if the view is const-iterable.
+    using const_iterator    = detail::transformation_trait_or_t<std::type_identity<iterator_type<urng_t const>>, void>;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    elementwise_transform_view() = default;
+    constexpr elementwise_transform_view(elementwise_transform_view const & rhs) = default;
+    constexpr elementwise_transform_view(elementwise_transform_view && rhs) = default;
+    constexpr elementwise_transform_view & operator=(elementwise_transform_view const & rhs) = default;
+    constexpr elementwise_transform_view & operator=(elementwise_transform_view && rhs) = default;
+    ~elementwise_transform_view() = default;
+
+    /*!\brief Construct from another range.
+     * \param[in] _urange The underlying range.
+     * \param[in] _fn     The functor applied to every element.
+     */
+    elementwise_transform_view(urng_t _urange, fn_t _fn)
+        : urange{std::move(_urange)}, fn{std::move(_fn)}
+    {}
+    //!\}
+
+    /*!\name Parts (used for fusion)
+     * \{
+     */
+    //!\brief Returns a copy of the underlying range (so that another transformation can be applied to it directly).
+    constexpr urng_t underlying_range() const
+    {
+        return urange;
+    }
+
+    //!\brief Returns a copy of the functor (so that it can be composed with another functor).
+    constexpr fn_t functor() const
+    {
+        return static_cast<fn_t const &>(fn);
+    }
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    /*!\brief Returns an iterator to the first element of the view.
+     * \returns Iterator to the first element.
+     *
+     * If the view is empty, the returned iterator will be equal to end().
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    iterator begin() noexcept
+    {
+        return {seqan3::begin(urange), static_cast<fn_t &>(fn)};
+    }
+
+    //!\copydoc begin()
+    const_iterator begin() const noexcept
+        requires const_iterable
+    {
+        return {seqan3::cbegin(urange), static_cast<fn_t const &>(fn)};
+    }
+
+    //!\copydoc begin()
+    const_iterator cbegin() const noexcept
+        requires const_iterable
+    {
+        return {seqan3::cbegin(urange), static_cast<fn_t const &>(fn)};
+    }
+
+    /*!\brief Returns an iterator (or sentinel) to the element following the last element of the view.
+     * \returns Iterator to the end.
+     *
+     * This element acts as a placeholder; attempting to dereference it results in undefined behaviour.
+     * If the underlying range is a common range, an #iterator is returned, otherwise the underlying
+     * range's sentinel.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    iterator end() noexcept
+        requires std::ranges::CommonRange<urng_t>
+    {
+        return {seqan3::end(urange), static_cast<fn_t &>(fn)};
+    }
+
+    //!\copydoc end()
+    auto end() noexcept
+        requires !std::ranges::CommonRange<urng_t>
+    {
+        return seqan3::end(urange);
+    }
+
+    //!\copydoc end()
+    const_iterator end() const noexcept
+        requires const_iterable && std::ranges::CommonRange<urng_t const>
+    {
+        return {seqan3::cend(urange), static_cast<fn_t const &>(fn)};
+    }
+
+    //!\copydoc end()
+    auto end() const noexcept
+        requires const_iterable && !std::ranges::CommonRange<urng_t const>
+    {
+        return seqan3::cend(urange);
+    }
+
+    //!\copydoc end()
+    auto cend() const noexcept
+        requires const_iterable
+    {
+        return end();
+    }
+    //!\}
+
+    /*!\brief Returns the number of elements in the view.
+     * \returns The number of elements.
+     *
+     * Only available if the underlying range is sized.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    auto size() noexcept
+        requires std::ranges::SizedRange<urng_t>
+    {
+        return std::ranges::size(urange);
+    }
+
+    //!\copydoc size()
+    auto size() const noexcept
+        requires std::ranges::SizedRange<urng_t const>
+    {
+        return std::ranges::size(urange);
+    }
+
+    /*!\brief Convert this view into a container implicitly.
+     * \tparam container_t Type of the container to convert to; must model seqan3::sequence_container_concept and it's
+     *                     seqan3::reference_t must model std::CommonReference with `reference`.
+     * \returns This view converted to container_t.
+     */
+    template <sequence_container_concept container_t>
+    operator container_t()
+    //!\cond
+        requires std::CommonReference<reference_t<container_t>, reference>
+    //!\endcond
+    {
+        container_t ret;
+        std::ranges::copy(begin(), end(), std::back_inserter(ret));
+        return ret;
+    }
+
+    //!\overload
+    template <sequence_container_concept container_t>
+    operator container_t() const
+    //!\cond
+        requires const_iterable && std::CommonReference<reference_t<container_t>, reference>
+    //!\endcond
+    {
+        container_t ret;
+        std::ranges::copy(cbegin(), cend(), std::back_inserter(ret));
+        return ret;
+    }
+};
+
+/*!\name Template argument deduction guides.
+ * \{
+ */
+//!\brief Type deduction guide that strips references.
+//!\relates seqan3::detail::elementwise_transform_view
+template <typename urng_t, typename fn_t>
+elementwise_transform_view(urng_t, fn_t) -> elementwise_transform_view<std::remove_reference_t<urng_t>, fn_t>;
+//!\}
+
+//!\brief Customisation point: whether a type is a specialisation of seqan3::detail::elementwise_transform_view.
+//!\ingroup range
+template <typename t>
+inline constexpr bool is_elementwise_transform_view_v = false;
+
+//!\cond
+template <typename urng_t, typename fn_t>
+inline constexpr bool is_elementwise_transform_view_v<elementwise_transform_view<urng_t, fn_t>> = true;
+//!\endcond
+
+// ============================================================================
+//  elementwise_transform_fn (adaptor definition)
+// ============================================================================
+
+/*!\brief The adaptor returned by seqan3::detail::elementwise_transform (usually wrapped in seqan3::view::deep).
+ * \tparam fn_t The type of the stored functor.
+ * \ingroup range
+ */
+template <typename fn_t>
+struct elementwise_transform_fn
+{
+    //!\brief The functor applied to every element.
+    fn_t fn;
+
+    /*!\brief Apply the transformation to a range, fusing with the range's own transformation if possible.
+     * \tparam    urng_t The underlying range type; must model std::ranges::ViewableRange.
+     * \param[in] urange The underlying range.
+     * \returns An instance of seqan3::detail::elementwise_transform_view.
+     *
+     * \details
+     *
+     * If the underlying range is itself a seqan3::detail::elementwise_transform_view, no second view is
+     * stacked on top of it; instead a new view over *that view's* underlying range is returned whose functor
+     * is the composition of both functors (seqan3::detail::fused_fn). The decision is made at compile time,
+     * so a pipe of adjacent elementwise transformations always collapses into a single transformation node.
+     */
+    template <std::ranges::ViewableRange urng_t>
+    constexpr auto operator()(urng_t && urange) const
+    {
+        if constexpr (is_elementwise_transform_view_v<remove_cvref_t<urng_t>>)
+        {
+            return elementwise_transform_view{urange.underlying_range(),
+                                              fused_fn{urange.functor(), fn}};
+        }
+        else
+        {
+            return elementwise_transform_view{std::view::all(std::forward<urng_t>(urange)), fn};
+        }
+    }
+};
+
+// ============================================================================
+//  elementwise_transform (adaptor maker)
+// ============================================================================
+
+/*!\brief Create a view adaptor that applies `fn` to every element of the underlying range (like
+ *        std::view::transform), but that **fuses** with adjacent elementwise transformations.
+ * \tparam    fn_t The type of the functor; must model std::Invocable with the element type of the ranges
+ *                 the adaptor is applied to.
+ * \param[in] fn   The functor applied to every element.
+ * \returns An adaptor object to be wrapped in seqan3::view::deep (or invoked with a range directly).
+ * \ingroup range
+ *
+ * \details
+ *
+ * SeqAn's elementwise views (e.g. seqan3::view::char_to, seqan3::view::complement, seqan3::view::to_char ...)
+ * are defined via this facility, so a typical ingest stack of several such views in a row walks **one**
+ * iterator and applies **one** composed functor per element, instead of a tower of nested `operator*` calls
+ * that the optimiser may fail to collapse. Views that are not purely elementwise (e.g. seqan3::view::trim)
+ * terminate a fusion chain; transformations stacked on top of them start a new chain.
+ */
+template <typename fn_t>
+constexpr auto elementwise_transform(fn_t fn)
+{
+    return elementwise_transform_fn<fn_t>{std::move(fn)};
+}
+
+} // namespace seqan3::detail
@@ -15,11 +15,14 @@
 #include <seqan3/range/view/char_to.hpp>
 #include <seqan3/range/view/complement.hpp>
 #include <seqan3/range/view/convert.hpp>
+#include <seqan3/range/view/convert_copy.hpp>
 #include <seqan3/range/view/deep.hpp>
 #include <seqan3/range/view/get.hpp>
 #include <seqan3/range/view/pairwise_combine.hpp>
+#include <seqan3/range/view/materialise.hpp>
 #include <seqan3/range/view/persist.hpp>
 #include <seqan3/range/view/rank_to.hpp>
+#include <seqan3/range/view/reverse_complement.hpp>
 #include <seqan3/range/view/single_pass_input.hpp>
 #include <seqan3/range/view/take.hpp>
 #include <seqan3/range/view/take_exactly.hpp>
@@ -27,6 +30,7 @@
 #include <seqan3/range/view/take_until.hpp>
 #include <seqan3/range/view/to_char.hpp>
 #include <seqan3/range/view/to_rank.hpp>
+#include <seqan3/range/view/translate_copy.hpp>
 #include <seqan3/range/view/translation.hpp>
 #include <seqan3/range/view/trim.hpp>
 
@@ -14,6 +14,7 @@
 
 #include <seqan3/alphabet/concept.hpp>
 #include <seqan3/core/metafunction/basic.hpp>
+#include <seqan3/range/detail/elementwise_transform.hpp>
 #include <seqan3/range/view/deep.hpp>
 #include <seqan3/std/ranges>
 
@@ -59,10 +60,11 @@ namespace seqan3::view
  * ### Example
  *
  * \snippet test/snippet/range/view/rank_char.cpp char_to
+ * \sa seqan3::convert_copy for an eager, chunk-wise variant of this conversion.
  * \hideinitializer
  */
 template <Alphabet alphabet_type>
-inline auto const char_to = deep{std::view::transform([] (auto && in)
+inline auto const char_to = deep{detail::elementwise_transform([] (auto && in)
 {
     static_assert(std::CommonReference<decltype(in), underlying_char_t<alphabet_type>>,
                   "The innermost value type must have a common reference to underlying char type of alphabet_type.");
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <seqan3/alphabet/nucleotide/concept.hpp>
+#include <seqan3/range/detail/elementwise_transform.hpp>
 #include <seqan3/range/view/deep.hpp>
 #include <seqan3/std/ranges>
 
@@ -62,7 +63,7 @@ namespace seqan3::view
  * \hideinitializer
  */
 
-inline auto const complement = deep{std::view::transform([] (auto && in)
+inline auto const complement = deep{detail::elementwise_transform([] (auto && in)
 {
     static_assert(NucleotideAlphabet<delete_const_t<decltype(in)>>,
                   "The innermost value type must satisfy the NucleotideAlphabet.");
@@ -56,6 +56,8 @@ namespace seqan3::view
  *
  * Convert from seqan3::dna15 to seqan3::dna5:
  * \snippet test/snippet/range/view/convert.cpp 15_to_5
+ *
+ * \sa seqan3::convert_copy for an eager, chunk-wise variant of alphabet-to-alphabet conversion.
  * \hideinitializer
  */
 template <typename out_t>
@@ -0,0 +1,524 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::convert_copy.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstring>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/concept/core_language.hpp>
+#include <seqan3/core/metafunction/basic.hpp>
+#include <seqan3/core/metafunction/range.hpp>
+#include <seqan3/core/simd/simd.hpp>
+#include <seqan3/core/simd/simd_algorithm.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief A byte-wise translation, stored as a full lookup table plus the entries deviating from the most
+ *        frequent output byte.
+ * \ingroup view
+ *
+ * \details
+ *
+ * The alphabet conversions behind seqan3::view::char_to, seqan3::view::rank_to, seqan3::view::to_char and
+ * seqan3::view::to_rank are pure byte-to-byte functions for all single-byte alphabets. Such a function is
+ * fully described by a 256-entry table; for the biological alphabets almost all entries additionally map to
+ * the same output (the rank respectively object byte of the default value), so the table can be condensed
+ * into that default plus a handful of deviating entries, which is the form the chunked kernel of
+ * seqan3::detail::translate_bytes consumes.
+ */
+struct byte_translation
+{
+    //!\brief The maximum number of deviating entries the chunked kernel handles.
+    static constexpr size_t max_deviating = 16;
+
+    //!\brief The translation of every possible input byte.
+    std::array<uint8_t, 256> table{};
+    //!\brief The most frequent output byte of the translation.
+    uint8_t default_value{};
+    //!\brief The input bytes whose translation deviates from byte_translation::default_value.
+    std::array<uint8_t, max_deviating> deviating_input{};
+    //!\brief The translations of the deviating input bytes.
+    std::array<uint8_t, max_deviating> deviating_output{};
+    //!\brief The number of deviating entries; exceeding byte_translation::max_deviating disables the chunked kernel.
+    size_t deviating_count{};
+
+    /*!\brief Whether the translation is the saturating affine map
+     *        `out = clamp(in - affine_delta, affine_min, affine_max)` on signed bytes.
+     *
+     * The quality alphabets are of this form: their char-to-rank conversion subtracts the phred offset and
+     * clamps out-of-range characters to the closest valid rank. Such translations have far more than
+     * byte_translation::max_deviating deviating entries, but can be applied with three vector instructions
+     * per chunk instead.
+     */
+    bool is_affine{};
+    //!\brief The value subtracted from the input byte if byte_translation::is_affine is set.
+    int8_t affine_delta{};
+    //!\brief The lower clamping bound if byte_translation::is_affine is set.
+    int8_t affine_min{};
+    //!\brief The upper clamping bound if byte_translation::is_affine is set.
+    int8_t affine_max{};
+};
+
+/*!\brief Condenses a full 256-entry translation table into a seqan3::detail::byte_translation.
+ * \ingroup view
+ * \param[in] table The translation of every possible input byte.
+ */
+inline byte_translation make_byte_translation(std::array<uint8_t, 256> const & table)
+{
+    byte_translation translation{};
+    translation.table = table;
+
+    std::array<size_t, 256> frequency{};
+    for (uint8_t const output : table)
+        ++frequency[output];
+
+    translation.default_value =
+        static_cast<uint8_t>(std::max_element(frequency.begin(), frequency.end()) - frequency.begin());
+
+    for (size_t input = 0; input < table.size(); ++input)
+    {
+        if (table[input] == translation.default_value)
+            continue;
+
+        if (translation.deviating_count < byte_translation::max_deviating)
+        {
+            translation.deviating_input[translation.deviating_count] = static_cast<uint8_t>(input);
+            translation.deviating_output[translation.deviating_count] = table[input];
+        }
+        ++translation.deviating_count;
+    }
+
+    // Detect the saturating affine form (e.g. the char-to-rank conversion of the quality alphabets): all
+    // output bytes must be non-negative as signed bytes and some input must map strictly between the
+    // extremes, from which the delta follows; the whole table is then verified against the candidate map.
+    uint8_t const min_output = *std::min_element(table.begin(), table.end());
+    uint8_t const max_output = *std::max_element(table.begin(), table.end());
+
+    if (max_output <= 127u)
+    {
+        for (size_t input = 0; input < table.size(); ++input)
+        {
+            if (table[input] > min_output && table[input] < max_output)
+            {
+                int const delta = static_cast<int8_t>(input) - static_cast<int>(table[input]);
+
+                translation.is_affine =
+                    (delta >= -128 && delta <= 127) &&
+                    std::all_of(table.begin(), table.end(), [&, i = size_t{0}] (uint8_t const output) mutable
+                    {
+                        int const mapped = std::clamp(static_cast<int8_t>(i++) - delta,
+                                                      static_cast<int>(min_output),
+                                                      static_cast<int>(max_output));
+                        return mapped == static_cast<int>(output);
+                    });
+
+                if (translation.is_affine)
+                {
+                    translation.affine_delta = static_cast<int8_t>(delta);
+                    translation.affine_min = static_cast<int8_t>(min_output);
+                    translation.affine_max = static_cast<int8_t>(max_output);
+                }
+                break;
+            }
+        }
+    }
+
+    return translation;
+}
+
+/*!\brief Returns the object representation of a single-byte value.
+ * \ingroup view
+ */
+template <typename value_t>
+//!\cond
+    requires sizeof(value_t) == 1 && std::is_trivially_copyable_v<value_t>
+//!\endcond
+inline uint8_t byte_of(value_t const value)
+{
+    uint8_t byte{};
+    std::memcpy(&byte, std::addressof(value), 1u);
+    return byte;
+}
+
+/*!\brief The byte translation performed by seqan3::view::char_to, i.e. character byte to object byte.
+ * \ingroup view
+ * \tparam alphabet_t The alphabet to convert to; must satisfy seqan3::Alphabet.
+ */
+template <Alphabet alphabet_t>
+inline byte_translation const & char_to_translation()
+{
+    static byte_translation const translation = [] ()
+    {
+        std::array<uint8_t, 256> table{};
+        for (size_t chr = 0; chr < table.size(); ++chr)
+            table[chr] = byte_of(assign_char(alphabet_t{}, static_cast<underlying_char_t<alphabet_t>>(chr)));
+        return make_byte_translation(table);
+    }();
+    return translation;
+}
+
+/*!\brief The byte translation performed by seqan3::view::rank_to, i.e. rank byte to object byte.
+ * \ingroup view
+ * \tparam alphabet_t The alphabet to convert to; must satisfy seqan3::Alphabet.
+ *
+ * Input bytes that are not a valid rank are translated as rank 0 (calling the conversion on them violates
+ * the precondition of seqan3::assign_rank either way).
+ */
+template <Alphabet alphabet_t>
+inline byte_translation const & rank_to_translation()
+{
+    static byte_translation const translation = [] ()
+    {
+        std::array<uint8_t, 256> table{};
+        table.fill(byte_of(assign_rank(alphabet_t{}, 0)));
+        for (size_t rank = 0; rank < alphabet_size_v<alphabet_t>; ++rank)
+            table[rank] = byte_of(assign_rank(alphabet_t{}, rank));
+        return make_byte_translation(table);
+    }();
+    return translation;
+}
+
+/*!\brief The byte translation performed by seqan3::view::to_char, i.e. object byte to character byte.
+ * \ingroup view
+ * \tparam alphabet_t The alphabet to convert from; must satisfy seqan3::Alphabet.
+ *
+ * Input bytes that are not the object representation of a valid value are translated like rank 0.
+ */
+template <Alphabet alphabet_t>
+inline byte_translation const & to_char_translation()
+{
+    static byte_translation const translation = [] ()
+    {
+        std::array<uint8_t, 256> table{};
+        table.fill(static_cast<uint8_t>(to_char(assign_rank(alphabet_t{}, 0))));
+        for (size_t rank = 0; rank < alphabet_size_v<alphabet_t>; ++rank)
+            table[byte_of(assign_rank(alphabet_t{}, rank))] =
+                static_cast<uint8_t>(to_char(assign_rank(alphabet_t{}, rank)));
+        return make_byte_translation(table);
+    }();
+    return translation;
+}
+
+/*!\brief The byte translation performed by seqan3::view::to_rank, i.e. object byte to rank byte.
+ * \ingroup view
+ * \tparam alphabet_t The alphabet to convert from; must satisfy seqan3::Alphabet.
+ *
+ * Input bytes that are not the object representation of a valid value are translated like rank 0.
+ */
+template <Alphabet alphabet_t>
+inline byte_translation const & to_rank_translation()
+{
+    static byte_translation const translation = [] ()
+    {
+        std::array<uint8_t, 256> table{};
+        for (size_t rank = 0; rank < alphabet_size_v<alphabet_t>; ++rank)
+            table[byte_of(assign_rank(alphabet_t{}, rank))] = static_cast<uint8_t>(rank);
+        return make_byte_translation(table);
+    }();
+    return translation;
+}
+
+/*!\brief The constexpr rank-to-rank conversion table between two alphabets.
+ * \ingroup view
+ * \tparam in_t  The alphabet to convert from; must satisfy seqan3::Alphabet.
+ * \tparam out_t The alphabet to convert to; must satisfy seqan3::Alphabet and be constructible from `in_t`.
+ *
+ * Entry `r` holds the rank of the `out_t` value that an `in_t` value of rank `r` converts to, e.g. the
+ * dna5→dna4 table maps the rank of `'N'` to the rank of `'A'`. Deriving the table once at compile time
+ * replaces the per-element char round-trip of the converting constructor.
+ */
+template <Alphabet in_t, Alphabet out_t>
+//!\cond
+    requires ExplicitlyConvertibleTo<in_t, out_t>
+//!\endcond
+inline constexpr std::array<underlying_rank_t<out_t>, alphabet_size_v<in_t>> rank_conversion_table
+    = [] () constexpr
+{
+    std::array<underlying_rank_t<out_t>, alphabet_size_v<in_t>> table{};
+    for (size_t rank = 0; rank < alphabet_size_v<in_t>; ++rank)
+        table[rank] = to_rank(static_cast<out_t>(assign_rank(in_t{}, rank)));
+    return table;
+}();
+
+/*!\brief The byte translation of an alphabet-to-alphabet conversion, i.e. object byte to object byte.
+ * \ingroup view
+ * \tparam in_t  The alphabet to convert from; must satisfy seqan3::Alphabet.
+ * \tparam out_t The alphabet to convert to; must satisfy seqan3::Alphabet and be constructible from `in_t`.
+ *
+ * Input bytes that are not the object representation of a valid value are translated like rank 0.
+ */
+template <Alphabet in_t, Alphabet out_t>
+//!\cond
+    requires ExplicitlyConvertibleTo<in_t, out_t>
+//!\endcond
+inline byte_translation const & alphabet_to_translation()
+{
+    static byte_translation const translation = [] ()
+    {
+        std::array<uint8_t, 256> table{};
+        table.fill(byte_of(assign_rank(out_t{}, rank_conversion_table<in_t, out_t>[0])));
+        for (size_t rank = 0; rank < alphabet_size_v<in_t>; ++rank)
+            table[byte_of(assign_rank(in_t{}, rank))] =
+                byte_of(assign_rank(out_t{}, rank_conversion_table<in_t, out_t>[rank]));
+        return make_byte_translation(table);
+    }();
+    return translation;
+}
+
+/*!\brief Applies a byte translation to a contiguous buffer, chunk-wise where profitable.
+ * \ingroup view
+ * \param[in]  in          Pointer to the input bytes.
+ * \param[out] out         Pointer to the output bytes; must provide space for \p count bytes.
+ * \param[in]  count       The number of bytes to translate.
+ * \param[in]  translation The translation to apply.
+ *
+ * \details
+ *
+ * If the translation is a saturating affine map (see seqan3::detail::byte_translation::is_affine), whole
+ * chunks of seqan3::simd::simd_type_t<int8_t> width are translated with one saturating subtract and two
+ * clamping instructions — this covers the char-to-rank conversion of the quality alphabets, i.e. decoding
+ * a FASTQ quality line. Else, if the translation has at most
+ * seqan3::detail::byte_translation::max_deviating deviating entries, chunks are translated by initialising
+ * them with the default output byte and then applying one compare-and-select per deviating entry — on x86
+ * the compiler lowers this to `PCMPEQB`/`PBLENDVB` sequences. Otherwise (and for the remaining tail) the
+ * full lookup table is applied byte by byte. All paths implement the exact same function.
+ *
+ * Note that without simd build flags (e.g. `-march=native`) seqan3::simd::simd_type_t degrades to scalar
+ * width and only the table path remains.
+ */
+inline void translate_bytes(uint8_t const * const in,
+                            uint8_t * const out,
+                            size_t const count,
+                            byte_translation const & translation)
+{
+    size_t i = 0;
+
+    using simd_t = simd_type_t<int8_t>;
+    constexpr size_t chunk_size = simd_traits<simd_t>::length;
+
+    if constexpr (chunk_size > 1)
+    {
+        if (translation.is_affine)
+        {
+            simd_t const delta_chunk = fill<simd_t>(translation.affine_delta);
+            simd_t const min_chunk = fill<simd_t>(translation.affine_min);
+            simd_t const max_chunk = fill<simd_t>(translation.affine_max);
+
+            for (; i + chunk_size <= count; i += chunk_size)
+            {
+                simd_t in_chunk;
+                std::memcpy(&in_chunk, in + i, chunk_size);
+
+                // saturating subtract plus clamping, i.e. `PSUBSB`/`PMAXSB`/`PMINSB` on x86; saturation
+                // cannot produce wrong results because the clamping bounds are valid signed bytes
+                simd_t const out_chunk = min(max(saturated_sub(in_chunk, delta_chunk), min_chunk), max_chunk);
+
+                std::memcpy(out + i, &out_chunk, chunk_size);
+            }
+        }
+        else if (translation.deviating_count <= byte_translation::max_deviating)
+        {
+            simd_t const default_chunk = fill<simd_t>(static_cast<int8_t>(translation.default_value));
+
+            for (; i + chunk_size <= count; i += chunk_size)
+            {
+                simd_t in_chunk;
+                std::memcpy(&in_chunk, in + i, chunk_size);
+
+                simd_t out_chunk = default_chunk;
+                for (size_t entry = 0; entry < translation.deviating_count; ++entry)
+                {
+                    simd_t const mask =
+                        (in_chunk == fill<simd_t>(static_cast<int8_t>(translation.deviating_input[entry])));
+                    out_chunk = (out_chunk & ~mask) |
+                                (fill<simd_t>(static_cast<int8_t>(translation.deviating_output[entry])) & mask);
+                }
+
+                std::memcpy(out + i, &out_chunk, chunk_size);
+            }
+        }
+    }
+
+    for (; i < count; ++i)
+        out[i] = translation.table[in[i]];
+}
+
+/*!\brief Backend of seqan3::convert_copy that runs either the byte kernel or the element-wise loop.
+ * \ingroup view
+ * \param[in]  source             The range to convert from.
+ * \param[out] target             The range to convert into.
+ * \param[in]  translation_getter Invocable returning the seqan3::detail::byte_translation of the conversion.
+ * \param[in]  convert_element    Invocable performing the conversion on a single element.
+ */
+template <typename source_rng_t, typename target_rng_t, typename translation_getter_t, typename convert_element_t>
+inline void convert_copy_impl(source_rng_t & source,
+                              target_rng_t & target,
+                              translation_getter_t && translation_getter,
+                              convert_element_t && convert_element)
+{
+    using in_t = value_type_t<remove_cvref_t<source_rng_t>>;
+    using out_t = value_type_t<remove_cvref_t<target_rng_t>>;
+
+    constexpr bool bytewise = std::ranges::ContiguousRange<std::remove_reference_t<source_rng_t>> &&
+                              std::ranges::ContiguousRange<std::remove_reference_t<target_rng_t>> &&
+                              std::ranges::SizedRange<std::remove_reference_t<source_rng_t>> &&
+                              std::ranges::SizedRange<std::remove_reference_t<target_rng_t>> &&
+                              sizeof(in_t) == 1 && sizeof(out_t) == 1 &&
+                              std::is_trivially_copyable_v<in_t> && std::is_trivially_copyable_v<out_t>;
+
+    if constexpr (bytewise)
+    {
+        assert(std::ranges::size(source) == std::ranges::size(target));
+        translate_bytes(reinterpret_cast<uint8_t const *>(std::ranges::data(source)),
+                        reinterpret_cast<uint8_t *>(std::ranges::data(target)),
+                        std::ranges::size(source),
+                        translation_getter());
+    }
+    else
+    {
+        auto target_it = std::ranges::begin(target);
+        for (auto && element : source)
+        {
+            assert(target_it != std::ranges::end(target));
+            *target_it = convert_element(element);
+            ++target_it;
+        }
+    }
+}
+
+/*!\interface seqan3::detail::BulkToCharConvertible <>
+ * \brief Whether seqan3::convert_copy can decode a range of letters to `char`s with the chunked byte kernel.
+ * \ingroup view
+ *
+ * Satisfied by contiguous, sized ranges over a single-byte alphabet whose character type is `char`;
+ * the output formats use this to decide between bulk decoding into a scratch buffer and the generic
+ * element-wise path.
+ */
+//!\cond
+template <typename rng_t>
+SEQAN3_CONCEPT BulkToCharConvertible =
+    std::ranges::ContiguousRange<std::remove_reference_t<rng_t>> &&
+    std::ranges::SizedRange<std::remove_reference_t<rng_t>> &&
+    Alphabet<value_type_t<remove_cvref_t<rng_t>>> &&
+    sizeof(value_type_t<remove_cvref_t<rng_t>>) == 1 &&
+    std::is_trivially_copyable_v<value_type_t<remove_cvref_t<rng_t>>> &&
+    std::Same<underlying_char_t<value_type_t<remove_cvref_t<rng_t>>>, char>;
+//!\endcond
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+/*!\brief Eagerly converts a whole sequence between its character, rank and alphabet representation or
+ *        between two alphabets.
+ * \tparam source_rng_t The type of the range to convert from; must satisfy std::ranges::InputRange.
+ * \tparam target_rng_t The type of the range to convert into; must satisfy std::ranges::ForwardRange.
+ * \param[in]  source The range to convert from.
+ * \param[out] target The range to convert into; must already hold the same number of elements as \p source.
+ * \ingroup view
+ *
+ * \details
+ *
+ * This is the eager, bulk counterpart of seqan3::view::char_to, seqan3::view::rank_to, seqan3::view::to_char,
+ * seqan3::view::to_rank and — for two alphabet value types — seqan3::view::convert. Which conversion is
+ * performed is deduced from the value types: if exactly one of the two ranges is over a type that satisfies
+ * seqan3::Alphabet, the other range's value type must be that alphabet's underlying char or rank type; if
+ * both are alphabets (e.g. normalising dna5 reads to dna4), the conversion of the target alphabet's
+ * converting constructor is applied via a precomputed rank-to-rank table
+ * (seqan3::detail::rank_conversion_table).
+ *
+ * The views convert one element per iteration; for contiguous ranges over single-byte value types this
+ * function instead translates whole chunks at a time (see seqan3::detail::translate_bytes), so converting
+ * entire reads runs close to memory bandwidth. The result is element-wise identical to what the respective
+ * view produces — also for characters that are not part of the target alphabet. For all other ranges an
+ * element-wise loop with the same semantics is used.
+ *
+ * ### Complexity
+ *
+ * Linear in the length of \p source.
+ *
+ * ### Exceptions
+ *
+ * No-throw guarantee.
+ *
+ * ### Example
+ *
+ * \include test/snippet/range/view/convert_copy.cpp
+ *
+ * \sa seqan3::view::char_to
+ * \sa seqan3::view::rank_to
+ * \sa seqan3::view::to_char
+ * \sa seqan3::view::to_rank
+ * \sa seqan3::view::convert
+ */
+template <std::ranges::InputRange source_rng_t, std::ranges::ForwardRange target_rng_t>
+inline void convert_copy(source_rng_t && source, target_rng_t && target)
+{
+    using in_t = value_type_t<remove_cvref_t<source_rng_t>>;
+    using out_t = value_type_t<remove_cvref_t<target_rng_t>>;
+
+    if constexpr (Alphabet<out_t> && !Alphabet<in_t>) // char_to respectively rank_to
+    {
+        if constexpr (std::Same<in_t, underlying_char_t<out_t>>)
+        {
+            detail::convert_copy_impl(source, target,
+                                      [] () -> auto const & { return detail::char_to_translation<out_t>(); },
+                                      [] (in_t const in) { return assign_char(out_t{}, in); });
+        }
+        else
+        {
+            static_assert(std::Same<in_t, underlying_rank_t<out_t>>,
+                          "The source value type must be the underlying char or rank type of the target alphabet.");
+            detail::convert_copy_impl(source, target,
+                                      [] () -> auto const & { return detail::rank_to_translation<out_t>(); },
+                                      [] (in_t const in) { return assign_rank(out_t{}, in); });
+        }
+    }
+    else if constexpr (Alphabet<in_t> && !Alphabet<out_t>) // to_char respectively to_rank
+    {
+        if constexpr (std::Same<out_t, underlying_char_t<in_t>>)
+        {
+            detail::convert_copy_impl(source, target,
+                                      [] () -> auto const & { return detail::to_char_translation<in_t>(); },
+                                      [] (in_t const in) { return to_char(in); });
+        }
+        else
+        {
+            static_assert(std::Same<out_t, underlying_rank_t<in_t>>,
+                          "The target value type must be the underlying char or rank type of the source alphabet.");
+            detail::convert_copy_impl(source, target,
+                                      [] () -> auto const & { return detail::to_rank_translation<in_t>(); },
+                                      [] (in_t const in) { return to_rank(in); });
+        }
+    }
+    else if constexpr (Alphabet<in_t> && Alphabet<out_t>) // alphabet to alphabet, e.g. dna5 to dna4
+    {
+        static_assert(ExplicitlyConvertibleTo<in_t, out_t>,
+                      "The target alphabet must be constructible from the source alphabet.");
+        detail::convert_copy_impl(source, target,
+                                  [] () -> auto const & { return detail::alphabet_to_translation<in_t, out_t>(); },
+                                  [] (in_t const in) { return static_cast<out_t>(in); });
+    }
+    else
+    {
+        static_assert(Alphabet<in_t> || Alphabet<out_t>,
+                      "At least one of the two ranges must be over a type that satisfies seqan3::Alphabet.");
+    }
+}
+
+} // namespace seqan3
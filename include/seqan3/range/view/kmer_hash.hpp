@@ -12,15 +12,412 @@
 
 #pragma once
 
-#include <range/v3/view/sliding.hpp>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
 
 #include <seqan3/alphabet/concept.hpp>
-#include <seqan3/core/metafunction/range.hpp>
+#include <seqan3/alphabet/nucleotide/concept.hpp>
+#include <seqan3/core/metafunction/all.hpp>
+#include <seqan3/range/shortcuts.hpp>
 #include <seqan3/range/view/detail.hpp>
+#include <seqan3/std/concepts>
+#include <seqan3/std/iterator>
 #include <seqan3/std/ranges>
 
 namespace seqan3::detail
 {
+
+//!\brief Forward declaration.
+template <typename view_t>
+class kmer_hash_iterator;
+
+// ============================================================================
+//  kmer_hash_view
+// ============================================================================
+
+/*!\brief The return type of seqan3::view::kmer_hash; computes all k-mer hashes with a rolling update.
+ * \tparam urng_t The underlying range type; must model std::ranges::View and its reference type must model
+ *                seqan3::Semialphabet.
+ * \implements std::ranges::ForwardRange
+ * \ingroup view
+ *
+ * The hash of a k-mer is its rank-based positional encoding \f$\sum_i \sigma^{k-1-i} \cdot rank_i\f$
+ * (modulo \f$2^{64}\f$), i.e. the same value that std::hash yields for a range of semialphabet letters.
+ * Instead of recomputing it from all k letters per window, each window hash is derived from its
+ * predecessor in constant time by removing the contribution of the letter that leaves the window and
+ * adding the letter that enters it.
+ */
+template <std::ranges::View urng_t>
+//!\cond
+    requires Semialphabet<delete_const_t<reference_t<urng_t>>>
+//!\endcond
+class kmer_hash_view : public ranges::view_interface<kmer_hash_view<urng_t>>
+{
+private:
+    //!\brief The underlying range type (needed by the iterator to restore constness).
+    using urng_type = urng_t;
+    //!\brief The alphabet type of the underlying range.
+    using alphabet_t = value_type_t<urng_t>;
+
+    //!\brief The alphabet size, i.e. the base of the positional encoding.
+    static constexpr uint64_t sigma = alphabet_size_v<alphabet_t>;
+    //!\brief Whether the alphabet size is a power of two, i.e. the rolling update can use shifts and masks.
+    static constexpr bool sigma_is_power_of_two = (sigma & (sigma - 1)) == 0;
+    //!\brief The number of bits of one letter if the alphabet size is a power of two.
+    static constexpr uint64_t bits_per_letter = std::ceil(std::log2(sigma));
+
+    //!\brief The underlying range.
+    urng_t urng;
+    //!\brief The k-mer size.
+    size_t k_{};
+    //!\brief Whether to return the minimum of the hashes of each k-mer and its reverse complement.
+    bool canonical_{};
+    //!\brief \f$\sigma^{k-1}\f$ (modulo \f$2^{64}\f$), the weight of the first letter of a window.
+    uint64_t sigma_pow_k_1{1};
+
+    //!\brief Befriend the iterator so it can read the precomputed constants.
+    template <typename view_t>
+    friend class kmer_hash_iterator;
+
+public:
+    /*!\name Member types
+     * \{
+     */
+    //!\brief Iterator type.
+    using iterator       = kmer_hash_iterator<kmer_hash_view>;
+    //!\brief Const iterator type.
+    using const_iterator = kmer_hash_iterator<kmer_hash_view const>;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr kmer_hash_view() = default;
+    constexpr kmer_hash_view(kmer_hash_view const &) = default;
+    constexpr kmer_hash_view(kmer_hash_view &&) = default;
+    constexpr kmer_hash_view & operator=(kmer_hash_view const &) = default;
+    constexpr kmer_hash_view & operator=(kmer_hash_view &&) = default;
+    ~kmer_hash_view() = default;
+
+    /*!\brief Construct from the underlying view.
+     * \param[in] _urng     The underlying range.
+     * \param[in] k         The k-mer size.
+     * \param[in] canonical Whether to return the minimum of the hashes of each k-mer and its reverse
+     *                      complement (requires a seqan3::NucleotideAlphabet).
+     * \throws std::invalid_argument If `k == 0`; or if `canonical` was requested for a non-nucleotide
+     *                               alphabet or a `k` whose windows are not exactly representable in 64bit.
+     */
+    kmer_hash_view(urng_t _urng, size_t const k, bool const canonical = false) :
+        urng{std::move(_urng)}, k_{k}, canonical_{canonical}
+    {
+        if (k_ == 0)
+            throw std::invalid_argument{"The k-mer size must be at least 1."};
+
+        for (size_t i = 1; i < k_; ++i)
+            sigma_pow_k_1 *= sigma; // wrap-around at 2^64 is deliberate; the hash is defined modulo 2^64
+
+        if (canonical_)
+        {
+            if constexpr (!NucleotideAlphabet<alphabet_t>)
+            {
+                throw std::invalid_argument{"Canonical k-mer hashes require a nucleotide alphabet."};
+            }
+            else
+            {
+                // the rolling reverse complement update divides by sigma which is only exact if every
+                // window value fits into 64bit without wrap-around
+                if constexpr (sigma_is_power_of_two)
+                {
+                    if (bits_per_letter * k_ > 64)
+                        throw std::invalid_argument{"The k-mer size is too large for canonical hashing "
+                                                    "on this alphabet."};
+                }
+                else
+                {
+                    uint64_t acc = 1;
+                    for (size_t i = 0; i < k_; ++i)
+                    {
+                        if (acc > std::numeric_limits<uint64_t>::max() / sigma)
+                            throw std::invalid_argument{"The k-mer size is too large for canonical hashing "
+                                                        "on this alphabet."};
+                        acc *= sigma;
+                    }
+                }
+            }
+        }
+    }
+
+    //!\brief Construction from std::ranges::ViewableRange.
+    template <typename other_urng_t>
+    //!\cond
+    requires !std::Same<remove_cvref_t<other_urng_t>, kmer_hash_view> &&
+             std::ranges::ViewableRange<other_urng_t> &&
+             std::Constructible<urng_t, ranges::ref_view<std::remove_reference_t<other_urng_t>>>
+    //!\endcond
+    explicit kmer_hash_view(other_urng_t && _urng, size_t const k, bool const canonical = false) :
+        kmer_hash_view{std::view::all(std::forward<other_urng_t>(_urng)), k, canonical}
+    {}
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    //!\brief Returns an iterator to the hash of the first window.
+    iterator begin()
+    {
+        return iterator{*this};
+    }
+
+    //!\copydoc begin()
+    const_iterator begin() const
+    {
+        return const_iterator{*this};
+    }
+
+    //!\copydoc begin()
+    const_iterator cbegin() const
+    {
+        return begin();
+    }
+
+    //!\brief Returns an iterator behind the hash of the last window.
+    iterator end()
+    {
+        return iterator{*this, true};
+    }
+
+    //!\copydoc end()
+    const_iterator end() const
+    {
+        return const_iterator{*this, true};
+    }
+
+    //!\copydoc end()
+    const_iterator cend() const
+    {
+        return end();
+    }
+    //!\}
+
+    //!\brief Returns the number of k-mers in the underlying range.
+    auto size() const
+    //!\cond
+        requires std::ranges::SizedRange<urng_t>
+    //!\endcond
+    {
+        auto const n = seqan3::size(urng);
+        return n >= k_ ? n - k_ + 1 : 0u;
+    }
+};
+
+/*!\name Deduction guide.
+ * \relates seqan3::detail::kmer_hash_view
+ * \{
+ */
+//!\brief Deduces the kmer_hash_view from the underlying range if it is a std::ranges::ViewableRange.
+template <std::ranges::ViewableRange urng_t>
+kmer_hash_view(urng_t &&, size_t const, bool const) ->
+    kmer_hash_view<std::ranges::all_view<urng_t>>;
+//!\}
+
+// ============================================================================
+//  kmer_hash_iterator
+// ============================================================================
+
+/*!\brief Iterator of seqan3::detail::kmer_hash_view that maintains the window hash as rolling state.
+ * \implements std::ForwardIterator
+ * \ingroup view
+ * \tparam view_t The (possibly const-qualified) type of the associated view.
+ */
+template <typename view_t>
+class kmer_hash_iterator
+{
+private:
+    //!\brief The underlying range type with constness matching the view's.
+    using urng_t = std::conditional_t<std::is_const_v<view_t>,
+                                      typename view_t::urng_type const,
+                                      typename view_t::urng_type>;
+    //!\brief The iterator type of the underlying range.
+    using urng_iterator_type = std::ranges::iterator_t<urng_t>;
+    //!\brief The alphabet type of the underlying range.
+    using alphabet_t = typename view_t::alphabet_t;
+
+    //!\brief Shortcut for the alphabet size stored in the view type.
+    static constexpr uint64_t sigma = view_t::sigma;
+
+    //!\brief The associated view.
+    view_t * view_ptr{nullptr};
+    //!\brief Iterator to the first letter of the current window.
+    urng_iterator_type window_first{};
+    //!\brief Iterator to the letter that enters the window on the next increment.
+    urng_iterator_type next_in{};
+    //!\brief The hash of the current window.
+    uint64_t fwd_hash{0};
+    //!\brief The hash of the reverse complement of the current window (only maintained in canonical mode).
+    uint64_t rc_hash{0};
+    //!\brief Whether this iterator is behind the last window.
+    bool at_end{true};
+
+    //!\brief Befriend the iterator over the other constness so the converting constructor can copy state.
+    template <typename other_view_t>
+    friend class kmer_hash_iterator;
+
+public:
+    /*!\name Associated types
+     * \{
+     */
+    //!\brief Difference type.
+    using difference_type   = difference_type_t<urng_iterator_type>;
+    //!\brief Value type.
+    using value_type        = size_t;
+    //!\brief Pointer type.
+    using pointer           = void;
+    //!\brief The hashes are computed on the fly, so only values are returned.
+    using reference         = size_t;
+    //!\brief Iterator category.
+    using iterator_category = std::forward_iterator_tag;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    kmer_hash_iterator() = default;
+    constexpr kmer_hash_iterator(kmer_hash_iterator const &) = default;
+    constexpr kmer_hash_iterator(kmer_hash_iterator &&) = default;
+    constexpr kmer_hash_iterator & operator=(kmer_hash_iterator const &) = default;
+    constexpr kmer_hash_iterator & operator=(kmer_hash_iterator &&) = default;
+    ~kmer_hash_iterator() = default;
+
+    //!\brief Construct the begin iterator; reads the first window and computes its hash letter-by-letter.
+    explicit kmer_hash_iterator(view_t & view) : view_ptr{&view}, at_end{false}
+    {
+        auto const last = seqan3::end(view_ptr->urng);
+        next_in = seqan3::begin(view_ptr->urng);
+        window_first = next_in;
+
+        uint64_t pow = 1; // σ^i, the weight of the i-th letter in the reverse complement hash
+        for (size_t i = 0; i < view_ptr->k_; ++i, ++next_in)
+        {
+            if (next_in == last) // the underlying range is shorter than k
+            {
+                at_end = true;
+                return;
+            }
+
+            fwd_hash = fwd_hash * sigma + to_rank(*next_in);
+
+            if constexpr (NucleotideAlphabet<alphabet_t>)
+                if (view_ptr->canonical_)
+                    rc_hash += to_rank(complement(*next_in)) * pow;
+
+            pow *= sigma;
+        }
+    }
+
+    //!\brief Construct an end iterator.
+    kmer_hash_iterator(view_t & view, bool) noexcept : view_ptr{&view}, at_end{true}
+    {}
+
+    //!\brief Allow the construction of a const iterator from the mutable one.
+    template <typename other_view_t>
+    //!\cond
+        requires std::is_const_v<view_t> && std::Same<other_view_t, std::remove_const_t<view_t>>
+    //!\endcond
+    kmer_hash_iterator(kmer_hash_iterator<other_view_t> const & rhs) :
+        view_ptr{rhs.view_ptr},
+        window_first{rhs.window_first},
+        next_in{rhs.next_in},
+        fwd_hash{rhs.fwd_hash},
+        rc_hash{rhs.rc_hash},
+        at_end{rhs.at_end}
+    {}
+    //!\}
+
+    /*!\name Access operations
+     * \{
+     */
+    //!\brief Returns the hash of the current window (minimum of forward and reverse complement hash in
+    //!       canonical mode).
+    reference operator*() const noexcept
+    {
+        if constexpr (NucleotideAlphabet<alphabet_t>)
+            if (view_ptr->canonical_)
+                return std::min(fwd_hash, rc_hash);
+        return fwd_hash;
+    }
+    //!\}
+
+    /*!\name Iterator operations
+     * \{
+     */
+    //!\brief Advance to the next window by rolling in the next letter (constant time).
+    kmer_hash_iterator & operator++()
+    {
+        if (next_in == seqan3::end(view_ptr->urng)) // the last window has been consumed
+        {
+            at_end = true;
+            return *this;
+        }
+
+        uint64_t const out_rank = to_rank(*window_first);
+        uint64_t const in_rank  = to_rank(*next_in);
+
+        fwd_hash = (fwd_hash - out_rank * view_ptr->sigma_pow_k_1) * sigma + in_rank;
+
+        if constexpr (NucleotideAlphabet<alphabet_t>)
+        {
+            if (view_ptr->canonical_)
+            {
+                uint64_t const in_comp = to_rank(complement(*next_in));
+
+                // the letter that leaves the window holds the lowest digit of the reverse complement hash
+                if constexpr (view_t::sigma_is_power_of_two)
+                {
+                    rc_hash = (rc_hash >> view_t::bits_per_letter) |
+                              (in_comp << (view_t::bits_per_letter * (view_ptr->k_ - 1)));
+                }
+                else
+                {
+                    uint64_t const out_comp = to_rank(complement(*window_first));
+                    rc_hash = (rc_hash - out_comp) / sigma + in_comp * view_ptr->sigma_pow_k_1;
+                }
+            }
+        }
+
+        ++window_first;
+        ++next_in;
+        return *this;
+    }
+
+    //!\brief Post-increment.
+    kmer_hash_iterator operator++(int)
+    {
+        kmer_hash_iterator tmp{*this};
+        ++(*this);
+        return tmp;
+    }
+    //!\}
+
+    /*!\name Comparison operators
+     * \{
+     */
+    //!\brief Compares for equality (all end iterators compare equal).
+    bool operator==(kmer_hash_iterator const & rhs) const noexcept
+    {
+        if (at_end || rhs.at_end)
+            return at_end == rhs.at_end;
+        return window_first == rhs.window_first;
+    }
+
+    //!\brief Compares for inequality.
+    bool operator!=(kmer_hash_iterator const & rhs) const noexcept
+    {
+        return !(*this == rhs);
+    }
+    //!\}
+};
+
 // ============================================================================
 //  kmer_hash_fn (adaptor definition)
 // ============================================================================
@@ -35,24 +432,20 @@ private:
     //!\brief Befriend the base class so it can call impl().
     friend base_t;
 
-    /*!\brief            Call the view's constructor with the underlying view as argument.
-     * \param[in] urange The input range to process. Must model std::ranges::ViewableRange and the reference type of the
-     *                   range of the range must model seqan3::Semialphabet.
-     * \param[in] k      The k-mer size to construct hashes for.
-     * \returns          A range of converted elements.
+    /*!\brief               Call the view's constructor with the underlying view as argument.
+     * \param[in] urange    The input range to process. Must model std::ranges::ViewableRange and the reference type of
+     *                      the range of the range must model seqan3::Semialphabet.
+     * \param[in] k         The k-mer size to construct hashes for.
+     * \param[in] canonical Whether to return the minimum of the hashes of each k-mer and its reverse complement.
+     * \returns             A range of hash values.
      */
     template <std::ranges::ViewableRange urng_t>
     //!\cond
         requires Semialphabet<delete_const_t<reference_t<urng_t>>>
     //!\endcond
-    static auto impl(urng_t && urange, size_t const k)
+    static auto impl(urng_t && urange, size_t const k, bool const canonical = false)
     {
-        return std::forward<urng_t>(urange) | ranges::view::sliding(k) | std::view::transform(
-        [] (auto const in)
-        {
-            std::hash<decltype(in)> h{};
-            return h(in);
-        });
+        return kmer_hash_view{std::view::all(std::forward<urng_t>(urange)), k, canonical};
     }
 
 public:
@@ -68,28 +461,41 @@ namespace seqan3::view
      * \{
      */
 
-    /*!\brief               A view that calls std::hash on each substring of length k in the input range.
+    /*!\brief               A view that computes the hash of each substring of length k in the input range.
      * \tparam urng_t       The type of the range being processed. See below for requirements. [template parameter is
      *                      omitted in pipe notation]
      * \param[in] urange    The range being processed. [parameter is omitted in pipe notation]
+     * \param[in] k         The k-mer size to construct hashes for.
+     * \param[in] canonical Whether to return the minimum of the hashes of each k-mer and its reverse complement
+     *                      (defaults to `false`; requires a seqan3::NucleotideAlphabet).
      * \returns             A range of unsigned integral values where each value is the hash of the resp. k-mer.
      *                      See below for the properties of the returned range.
      * \ingroup view
      *
+     * The hash of a k-mer is its rank-based positional encoding modulo \f$2^{64}\f$, i.e. the same value that
+     * std::hash yields for a range of semialphabet letters. The hashes are computed with a rolling update that
+     * derives each window hash from its predecessor in constant time, so hashing all k-mers of a text is
+     * \f$O(n)\f$ instead of \f$O(k \cdot n)\f$.
+     *
+     * If `canonical` is set, the minimum of the hash of the k-mer and the hash of its reverse complement is
+     * returned, making the value independent of the strand the k-mer was read from. This requires a
+     * seqan3::NucleotideAlphabet and a `k` small enough that every window value is exactly representable in
+     * 64bit (e.g. k ≤ 32 for seqan3::dna4); otherwise a std::invalid_argument is thrown.
+     *
      * ### View properties
      *
      * | range concepts and reference_t  | `urng_t` (underlying range type)      | `rrng_t` (returned range type)                     |
      * |---------------------------------|:-------------------------------------:|:--------------------------------------------------:|
      * | std::ranges::InputRange         | *required*                            | *preserved*                                        |
      * | std::ranges::ForwardRange       | *required*                            | *preserved*                                        |
-     * | std::ranges::BidirectionalRange |                                       | *preserved*                                        |
-     * | std::ranges::RandomAccessRange  |                                       | *preserved*                                        |
+     * | std::ranges::BidirectionalRange |                                       | *lost*                                             |
+     * | std::ranges::RandomAccessRange  |                                       | *lost*                                             |
      * | std::ranges::ContiguousRange    |                                       | *lost*                                             |
      * |                                 |                                       |                                                    |
      * | std::ranges::ViewableRange      | *required*                            | *guaranteed*                                       |
      * | std::ranges::View               |                                       | *guaranteed*                                       |
      * | std::ranges::SizedRange         |                                       | *preserved*                                        |
-     * | std::ranges::CommonRange        |                                       | *preserved*                                        |
+     * | std::ranges::CommonRange        |                                       | *guaranteed*                                       |
      * | std::ranges::OutputRange        |                                       | *lost*                                             |
      * | seqan3::const_iterable_concept  |                                       | *preserved*                                        |
      * |                                 |                                       |                                                    |
@@ -0,0 +1,410 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::view::materialise.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <range/v3/algorithm/copy.hpp>
+
+#include <seqan3/core/metafunction/basic.hpp>
+#include <seqan3/core/metafunction/range.hpp>
+#include <seqan3/range/concept.hpp>
+#include <seqan3/range/container/concept.hpp>
+#include <seqan3/range/shortcuts.hpp>
+#include <seqan3/range/view/detail.hpp>
+#include <seqan3/std/concepts>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+// ============================================================================
+//  materialise_pool
+// ============================================================================
+
+/*!\brief A thread-local pool of recyclable buffers, used by seqan3::view::materialise.
+ * \tparam value_t The element type of the pooled buffers.
+ * \ingroup view
+ *
+ * \details
+ *
+ * Buffers are handed out as `std::shared_ptr<std::vector<value_t>>`; when the last owner releases a buffer, it is
+ * cleared (its capacity is retained!) and returned to the free-list of the releasing thread. This turns the
+ * allocate/copy/free cycle of repeated materialisations into plain buffer reuse — after a warm-up phase no further
+ * element storage is allocated.
+ *
+ * Buffers released after their thread's pool has already been destructed (e.g. from a static object's destructor,
+ * or on a different thread than they were acquired on after that thread exited) are simply freed.
+ */
+template <typename value_t>
+class materialise_pool
+{
+private:
+    //!\brief The thread's free-list; registers itself on construction so release() can detect thread tear-down.
+    struct storage_type
+    {
+        //!\brief Buffers currently not in use (empty, but with their capacity intact).
+        std::vector<std::unique_ptr<std::vector<value_t>>> free_buffers;
+
+        //!\brief Register this storage with the given registry slot.
+        explicit storage_type(storage_type * & registry_slot) noexcept : registry{registry_slot}
+        {
+            registry = this;
+        }
+
+        //!\brief Deregister so that late calls to release() do not touch the dead free-list.
+        ~storage_type()
+        {
+            registry = nullptr;
+        }
+
+        //!\brief The registry slot this storage is registered with.
+        storage_type * & registry;
+    };
+
+    //!\brief The registry slot of the current thread; trivially destructible, i.e. safe to read during tear-down.
+    static storage_type * & registry() noexcept
+    {
+        static thread_local storage_type * slot = nullptr;
+        return slot;
+    }
+
+    //!\brief The storage of the current thread (created on first use).
+    static storage_type & storage()
+    {
+        static thread_local storage_type stor{registry()};
+        return stor;
+    }
+
+    /*!\brief Return a buffer to the pool of the current thread; frees it instead if the pool is already gone.
+     * \param[in] raw_buffer The buffer to recycle; ownership is taken over.
+     */
+    static void release(std::vector<value_t> * const raw_buffer) noexcept
+    {
+        std::unique_ptr<std::vector<value_t>> buffer{raw_buffer};
+
+        if (storage_type * const stor = registry(); stor != nullptr)
+        {
+            buffer->clear(); // keeps the capacity
+
+            try
+            {
+                stor->free_buffers.push_back(std::move(buffer));
+            }
+            catch (...) // could not grow the free-list; just drop the buffer
+            {}
+        }
+    }
+
+public:
+    /*!\brief Get an empty buffer, recycled from the pool if one is available.
+     * \returns A shared pointer whose deleter returns the buffer to the pool.
+     */
+    static std::shared_ptr<std::vector<value_t>> acquire()
+    {
+        std::unique_ptr<std::vector<value_t>> buffer{};
+
+        if (auto & free_buffers = storage().free_buffers; !free_buffers.empty())
+        {
+            buffer = std::move(free_buffers.back());
+            free_buffers.pop_back();
+        }
+        else
+        {
+            buffer = std::make_unique<std::vector<value_t>>();
+        }
+
+        return {buffer.release(), [] (std::vector<value_t> * const ptr) { release(ptr); }};
+    }
+};
+
+// ============================================================================
+//  view_materialise
+// ============================================================================
+
+/*!\brief The type returned by seqan3::view::materialise.
+ * \tparam value_t The element type; equals the value type of the range that was materialised.
+ * \implements std::ranges::View
+ * \implements std::ranges::ContiguousRange
+ * \implements std::ranges::SizedRange
+ * \ingroup view
+ *
+ * \details
+ *
+ * Presents a fully materialised copy of the original range. The elements live in a pooled buffer that is shared
+ * between copies of this view and returned to the pool of seqan3::detail::materialise_pool when the last copy
+ * is destroyed.
+ */
+template <typename value_t>
+class view_materialise : public ranges::view_interface<view_materialise<value_t>>
+{
+private:
+    //!\brief Shared storage of the materialised elements (recycled via seqan3::detail::materialise_pool).
+    std::shared_ptr<std::vector<value_t>> buffer;
+
+public:
+    /*!\name Associated types
+     * \{
+     */
+    //!\brief The value_type.
+    using value_type        = value_t;
+    //!\brief The reference_type.
+    using reference         = value_t &;
+    //!\brief The const_reference type.
+    using const_reference   = value_t const &;
+    //!\brief The size_type.
+    using size_type         = typename std::vector<value_t>::size_type;
+    //!\brief A signed integer type, usually std::ptrdiff_t.
+    using difference_type   = typename std::vector<value_t>::difference_type;
+    //!\brief The iterator type of this view (a contiguous random access iterator).
+    using iterator          = typename std::vector<value_t>::iterator;
+    //!\brief The const_iterator type.
+    using const_iterator    = typename std::vector<value_t>::const_iterator;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    view_materialise() = default;
+    constexpr view_materialise(view_materialise const & rhs) = default;
+    constexpr view_materialise(view_materialise && rhs) = default;
+    constexpr view_materialise & operator=(view_materialise const & rhs) = default;
+    constexpr view_materialise & operator=(view_materialise && rhs) = default;
+    ~view_materialise() = default;
+
+    /*!\brief Construct from a (pooled) buffer holding the materialised elements.
+     * \param[in] _buffer The buffer.
+     */
+    explicit view_materialise(std::shared_ptr<std::vector<value_t>> _buffer) noexcept :
+        buffer{std::move(_buffer)}
+    {}
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    /*!\brief Returns an iterator to the first element of the range.
+     * \returns Iterator to the first element.
+     *
+     * If the range is empty, the returned iterator will be equal to end().
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    iterator begin() noexcept
+    {
+        return buffer->begin();
+    }
+
+    //!\copydoc begin()
+    const_iterator begin() const noexcept
+    {
+        return buffer->begin();
+    }
+
+    //!\copydoc begin()
+    const_iterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    /*!\brief Returns an iterator to the element following the last element of the range.
+     * \returns Iterator to the end.
+     *
+     * This element acts as a placeholder; attempting to dereference it results in undefined behaviour.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    iterator end() noexcept
+    {
+        return buffer->end();
+    }
+
+    //!\copydoc end()
+    const_iterator end() const noexcept
+    {
+        return buffer->end();
+    }
+
+    //!\copydoc end()
+    const_iterator cend() const noexcept
+    {
+        return end();
+    }
+    //!\}
+
+    /*!\brief Returns the number of elements in the range.
+     * \returns The number of elements.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    size_type size() const noexcept
+    {
+        return buffer->size();
+    }
+
+    /*!\brief Direct access to the underlying contiguous storage.
+     * \returns Pointer to the first element.
+     */
+    value_t * data() noexcept
+    {
+        return buffer->data();
+    }
+
+    //!\copydoc data()
+    value_t const * data() const noexcept
+    {
+        return buffer->data();
+    }
+
+    /*!\brief Convert this view into a container implicitly.
+     * \tparam container_t Type of the container to convert to; must satisfy seqan3::sequence_container_concept and the
+     *                     seqan3::reference_t of both must model std::CommonReference.
+     * \returns This view converted to container_t.
+     */
+    template <sequence_container_concept container_t>
+    operator container_t() const
+    //!\cond
+        requires std::CommonReference<reference_t<std::remove_reference_t<container_t>>, const_reference>
+    //!\endcond
+    {
+        container_t ret;
+        std::ranges::copy(begin(), end(), std::back_inserter(ret));
+        return ret;
+    }
+};
+
+// ============================================================================
+//  materialise_fn (adaptor definition)
+// ============================================================================
+
+/*!\brief View adaptor definition for view::materialise.
+ */
+class materialise_fn : public pipable_adaptor_base<materialise_fn>
+{
+private:
+    //!\brief Type of the CRTP-base.
+    using base_t = pipable_adaptor_base<materialise_fn>;
+
+public:
+    //!\brief Inherit the base class's Constructors.
+    using base_t::base_t;
+
+private:
+    //!\brief Befriend the base class so it can call impl().
+    friend base_t;
+
+    /*!\brief       Copy the range's elements into a pooled buffer and wrap that in a view.
+     * \returns     An instance of seqan3::detail::view_materialise.
+     */
+    template <std::ranges::InputRange urng_t>
+    static auto impl(urng_t && urange)
+    {
+        using value_t = value_type_t<remove_cvref_t<urng_t>>;
+
+        std::shared_ptr<std::vector<value_t>> buffer = materialise_pool<value_t>::acquire();
+
+        if constexpr (std::ranges::SizedRange<urng_t>)
+            buffer->reserve(std::ranges::size(urange));
+
+        for (auto && elem : urange)
+            buffer->push_back(std::forward<decltype(elem)>(elem));
+
+        return view_materialise<value_t>{std::move(buffer)};
+    }
+};
+
+} // namespace seqan3::detail
+
+// ============================================================================
+//  view::materialise (adaptor instance definition)
+// ============================================================================
+
+namespace seqan3::view
+{
+
+/*!\name General purpose views
+ * \{
+ */
+
+/*!\brief               A view adaptor that eagerly copies its input into a pooled, recycled buffer and presents
+ *                      a contiguous random access range over the copy.
+ * \tparam urng_t       The type of the range being processed. See below for requirements. [template parameter is
+ *                      omitted in pipe notation]
+ * \param[in] urange    The range being processed; the elements are **copied immediately**. [parameter is omitted in
+ *                      pipe notation]
+ * \returns             A contiguous random access range over a copy of the elements.
+ * \ingroup view
+ *
+ * \details
+ *
+ * Unlike seqan3::view::persist, which merely extends the lifetime of a temporary, this adaptor *materialises* the
+ * elements: the input is traversed once up-front and copied into a buffer, so the result can be traversed any number
+ * of times — also when the input was single-pass (e.g. a seqan3::view::single_pass_input over a stream).
+ *
+ * The buffers come from a thread-local pool and are recycled (with their capacity intact) when the view and all its
+ * copies have been destroyed. Materialising one record per iteration of a loop therefore does not allocate element
+ * storage after the first few iterations; only a small shared-pointer control block is allocated per call.
+ *
+ * ### View properties
+ *
+ * This view is **eager**, i.e. the full costs of traversing and copying the underlying range are incurred on
+ * construction.
+ *
+ * | range concepts and reference_t  | `urng_t` (underlying range type)      | `rrng_t` (returned range type)                     |
+ * |---------------------------------|:-------------------------------------:|:--------------------------------------------------:|
+ * | std::ranges::InputRange         | *required*                            | *guaranteed*                                       |
+ * | std::ranges::ForwardRange       |                                       | *guaranteed*                                       |
+ * | std::ranges::BidirectionalRange |                                       | *guaranteed*                                       |
+ * | std::ranges::RandomAccessRange  |                                       | *guaranteed*                                       |
+ * | std::ranges::ContiguousRange    |                                       | *guaranteed*                                       |
+ * |                                 |                                       |                                                    |
+ * | std::ranges::ViewableRange      | ***not required***                    | *guaranteed*                                       |
+ * | std::ranges::View               |                                       | *guaranteed*                                       |
+ * | std::ranges::SizedRange         |                                       | *guaranteed*                                       |
+ * | std::ranges::CommonRange        |                                       | *guaranteed*                                       |
+ * | std::ranges::OutputRange        |                                       | *guaranteed*                                       |
+ * | seqan3::const_iterable_concept  |                                       | *guaranteed*                                       |
+ * |                                 |                                       |                                                    |
+ * | seqan3::reference_t             |                                       | seqan3::value_type_t<urng_t> &                     |
+ *
+ * See the \link view view submodule documentation \endlink for detailed descriptions of the view properties.
+ *
+ * ### Example
+ *
+ * \snippet test/snippet/range/view/materialise.cpp usage
+ *
+ * \hideinitializer
+ */
+inline auto constexpr materialise = detail::materialise_fn{};
+
+//!\}
+
+} // namespace seqan3::view
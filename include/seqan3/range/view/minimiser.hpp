@@ -0,0 +1,455 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \author Enrico Seiler <enrico.seiler AT fu-berlin.de>
+ * \brief Provides seqan3::view::minimiser.
+ */
+
+#pragma once
+
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <seqan3/core/metafunction/all.hpp>
+#include <seqan3/range/shortcuts.hpp>
+#include <seqan3/range/view/detail.hpp>
+#include <seqan3/std/concepts>
+#include <seqan3/std/iterator>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+//!\brief Forward declaration.
+template <typename view_t>
+class minimiser_iterator;
+
+// ============================================================================
+//  minimiser_view
+// ============================================================================
+
+/*!\brief The return type of seqan3::view::minimiser; yields the minimum value of every window of w values.
+ * \tparam urng_t The underlying range type; must model std::ranges::View and its value type must model
+ *                std::StrictTotallyOrdered.
+ * \implements std::ranges::ForwardRange
+ * \ingroup view
+ *
+ * For every window of `w` consecutive values of the underlying range, the smallest value together with its
+ * position in the underlying range is reported (the leftmost one if the minimum occurs multiple times).
+ * The iterator maintains a monotonic double-ended queue over the current window, so that producing all
+ * \f$n - w + 1\f$ minima costs \f$O(n)\f$ overall instead of \f$O(n \cdot w)\f$.
+ */
+template <std::ranges::View urng_t>
+//!\cond
+    requires std::StrictTotallyOrdered<value_type_t<urng_t>>
+//!\endcond
+class minimiser_view : public ranges::view_interface<minimiser_view<urng_t>>
+{
+private:
+    //!\brief The underlying range type (needed by the iterator to restore constness).
+    using urng_type = urng_t;
+    //!\brief The value type of the underlying range.
+    using urng_value_type = value_type_t<urng_t>;
+
+    //!\brief The underlying range.
+    urng_t urng;
+    //!\brief The window size.
+    size_t w_{};
+
+    //!\brief Befriend the iterator so it can read the window size.
+    template <typename view_t>
+    friend class minimiser_iterator;
+
+public:
+    /*!\name Member types
+     * \{
+     */
+    //!\brief Iterator type.
+    using iterator       = minimiser_iterator<minimiser_view>;
+    //!\brief Const iterator type.
+    using const_iterator = minimiser_iterator<minimiser_view const>;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr minimiser_view() = default;
+    constexpr minimiser_view(minimiser_view const &) = default;
+    constexpr minimiser_view(minimiser_view &&) = default;
+    constexpr minimiser_view & operator=(minimiser_view const &) = default;
+    constexpr minimiser_view & operator=(minimiser_view &&) = default;
+    ~minimiser_view() = default;
+
+    /*!\brief Construct from the underlying view.
+     * \param[in] _urng The underlying range.
+     * \param[in] w     The window size.
+     * \throws std::invalid_argument If `w == 0`.
+     */
+    minimiser_view(urng_t _urng, size_t const w) :
+        urng{std::move(_urng)}, w_{w}
+    {
+        if (w_ == 0)
+            throw std::invalid_argument{"The window size must be at least 1."};
+    }
+
+    //!\brief Construction from std::ranges::ViewableRange.
+    template <typename other_urng_t>
+    //!\cond
+    requires !std::Same<remove_cvref_t<other_urng_t>, minimiser_view> &&
+             std::ranges::ViewableRange<other_urng_t> &&
+             std::Constructible<urng_t, ranges::ref_view<std::remove_reference_t<other_urng_t>>>
+    //!\endcond
+    explicit minimiser_view(other_urng_t && _urng, size_t const w) :
+        minimiser_view{std::view::all(std::forward<other_urng_t>(_urng)), w}
+    {}
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    //!\brief Returns an iterator to the minimiser of the first window.
+    iterator begin()
+    {
+        return iterator{*this};
+    }
+
+    //!\copydoc begin()
+    const_iterator begin() const
+    {
+        return const_iterator{*this};
+    }
+
+    //!\copydoc begin()
+    const_iterator cbegin() const
+    {
+        return begin();
+    }
+
+    //!\brief Returns an iterator behind the minimiser of the last window.
+    iterator end()
+    {
+        return iterator{*this, true};
+    }
+
+    //!\copydoc end()
+    const_iterator end() const
+    {
+        return const_iterator{*this, true};
+    }
+
+    //!\copydoc end()
+    const_iterator cend() const
+    {
+        return end();
+    }
+    //!\}
+
+    //!\brief Returns the number of windows in the underlying range.
+    auto size() const
+    //!\cond
+        requires std::ranges::SizedRange<urng_t>
+    //!\endcond
+    {
+        auto const n = seqan3::size(urng);
+        return n >= w_ ? n - w_ + 1 : 0u;
+    }
+};
+
+/*!\name Deduction guide.
+ * \relates seqan3::detail::minimiser_view
+ * \{
+ */
+//!\brief Deduces the minimiser_view from the underlying range if it is a std::ranges::ViewableRange.
+template <std::ranges::ViewableRange urng_t>
+minimiser_view(urng_t &&, size_t const) ->
+    minimiser_view<std::ranges::all_view<urng_t>>;
+//!\}
+
+// ============================================================================
+//  minimiser_iterator
+// ============================================================================
+
+/*!\brief Iterator of seqan3::detail::minimiser_view that maintains a monotonic deque over the current window.
+ * \implements std::ForwardIterator
+ * \ingroup view
+ * \tparam view_t The (possibly const-qualified) type of the associated view.
+ *
+ * The deque (stored in a ring buffer of `w` slots that is allocated once per iterator) holds candidate
+ * minima in increasing value order; its front is always the minimiser of the current window. Every value of
+ * the underlying range is pushed and popped at most once, so iterating all windows is \f$O(n)\f$.
+ */
+template <typename view_t>
+class minimiser_iterator
+{
+private:
+    //!\brief The underlying range type with constness matching the view's.
+    using urng_t = std::conditional_t<std::is_const_v<view_t>,
+                                      typename view_t::urng_type const,
+                                      typename view_t::urng_type>;
+    //!\brief The iterator type of the underlying range.
+    using urng_iterator_type = std::ranges::iterator_t<urng_t>;
+    //!\brief The value type of the underlying range.
+    using urng_value_type = typename view_t::urng_value_type;
+    //!\brief A position annotated value of the underlying range.
+    using annotated_value_type = std::pair<size_t, urng_value_type>;
+
+    //!\brief The associated view.
+    view_t * view_ptr{nullptr};
+    //!\brief Iterator to the value that enters the window on the next increment.
+    urng_iterator_type next_in{};
+    //!\brief The position in the underlying range of the value behind the current window.
+    size_t next_pos{0};
+    //!\brief Ring buffer of w slots holding the monotonic deque (increasing values, front is the minimum).
+    std::vector<annotated_value_type> ring{};
+    //!\brief Index of the deque's front inside #ring.
+    size_t head{0};
+    //!\brief Number of values currently held by the deque.
+    size_t count{0};
+    //!\brief Whether this iterator is behind the last window.
+    bool at_end{true};
+
+    //!\brief Befriend the iterator over the other constness so the converting constructor can copy state.
+    template <typename other_view_t>
+    friend class minimiser_iterator;
+
+    //!\brief The first element of the deque (the minimiser of the current window).
+    annotated_value_type const & front() const noexcept
+    {
+        return ring[head];
+    }
+
+    //!\brief Add a value to the deque, evicting all larger values from its back.
+    void push(size_t const pos, urng_value_type const value)
+    {
+        // '>' (not '>=') keeps earlier values on equality, so the front is always the leftmost minimum
+        while (count > 0 && ring[(head + count - 1) % ring.size()].second > value)
+            --count;
+        ring[(head + count) % ring.size()] = annotated_value_type{pos, value};
+        ++count;
+    }
+
+    //!\brief Remove values from the deque's front that drop out of the window when it moves one to the right.
+    //!       Must be called before push() so that the deque never exceeds its w slots.
+    void pop_expired() noexcept
+    {
+        while (count > 0 && front().first + view_ptr->w_ <= next_pos)
+        {
+            head = (head + 1) % ring.size();
+            --count;
+        }
+    }
+
+public:
+    /*!\name Associated types
+     * \{
+     */
+    //!\brief Difference type.
+    using difference_type   = difference_type_t<urng_iterator_type>;
+    //!\brief Value type; a pair of the position of the minimiser in the underlying range and its value.
+    using value_type        = annotated_value_type;
+    //!\brief Pointer type.
+    using pointer           = void;
+    //!\brief The minima are computed on the fly, so only values are returned.
+    using reference         = annotated_value_type;
+    //!\brief Iterator category.
+    using iterator_category = std::forward_iterator_tag;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    minimiser_iterator() = default;
+    minimiser_iterator(minimiser_iterator const &) = default;
+    minimiser_iterator(minimiser_iterator &&) = default;
+    minimiser_iterator & operator=(minimiser_iterator const &) = default;
+    minimiser_iterator & operator=(minimiser_iterator &&) = default;
+    ~minimiser_iterator() = default;
+
+    //!\brief Construct the begin iterator; consumes the first window of the underlying range.
+    explicit minimiser_iterator(view_t & view) : view_ptr{&view}, at_end{false}
+    {
+        auto const last = seqan3::end(view_ptr->urng);
+        next_in = seqan3::begin(view_ptr->urng);
+
+        ring.resize(view_ptr->w_);
+        for (size_t i = 0; i < view_ptr->w_; ++i, ++next_in)
+        {
+            if (next_in == last) // the underlying range is shorter than w
+            {
+                at_end = true;
+                return;
+            }
+            push(i, *next_in);
+        }
+        next_pos = view_ptr->w_;
+    }
+
+    //!\brief Construct an end iterator.
+    minimiser_iterator(view_t & view, bool) noexcept : view_ptr{&view}, at_end{true}
+    {}
+
+    //!\brief Allow the construction of a const iterator from the mutable one.
+    template <typename other_view_t>
+    //!\cond
+        requires std::is_const_v<view_t> && std::Same<other_view_t, std::remove_const_t<view_t>>
+    //!\endcond
+    minimiser_iterator(minimiser_iterator<other_view_t> const & rhs) :
+        view_ptr{rhs.view_ptr},
+        next_in{rhs.next_in},
+        next_pos{rhs.next_pos},
+        ring{rhs.ring},
+        head{rhs.head},
+        count{rhs.count},
+        at_end{rhs.at_end}
+    {}
+    //!\}
+
+    /*!\name Access operations
+     * \{
+     */
+    //!\brief Returns the minimiser of the current window as (position, value) pair.
+    reference operator*() const noexcept
+    {
+        return front();
+    }
+    //!\}
+
+    /*!\name Iterator operations
+     * \{
+     */
+    //!\brief Advance to the next window (amortised constant time).
+    minimiser_iterator & operator++()
+    {
+        if (next_in == seqan3::end(view_ptr->urng)) // the last window has been consumed
+        {
+            at_end = true;
+            return *this;
+        }
+
+        pop_expired();
+        push(next_pos, *next_in);
+        ++next_pos;
+        ++next_in;
+        return *this;
+    }
+
+    //!\brief Post-increment.
+    minimiser_iterator operator++(int)
+    {
+        minimiser_iterator tmp{*this};
+        ++(*this);
+        return tmp;
+    }
+    //!\}
+
+    /*!\name Comparison operators
+     * \{
+     */
+    //!\brief Compares for equality (all end iterators compare equal).
+    bool operator==(minimiser_iterator const & rhs) const noexcept
+    {
+        if (at_end || rhs.at_end)
+            return at_end == rhs.at_end;
+        return next_pos == rhs.next_pos;
+    }
+
+    //!\brief Compares for inequality.
+    bool operator!=(minimiser_iterator const & rhs) const noexcept
+    {
+        return !(*this == rhs);
+    }
+    //!\}
+};
+
+// ============================================================================
+//  minimiser_fn (adaptor definition)
+// ============================================================================
+
+//!\brief View adaptor definition for view::minimiser.
+class minimiser_fn : public pipable_adaptor_base<minimiser_fn>
+{
+private:
+    //!\brief Type of the CRTP-base.
+    using base_t = pipable_adaptor_base<minimiser_fn>;
+
+    //!\brief Befriend the base class so it can call impl().
+    friend base_t;
+
+    /*!\brief            Call the view's constructor with the underlying view as argument.
+     * \param[in] urange The input range to process. Must model std::ranges::ViewableRange and its value type
+     *                   must model std::StrictTotallyOrdered.
+     * \param[in] w      The window size.
+     * \returns          A range of (position, value) pairs, one per window.
+     */
+    template <std::ranges::ViewableRange urng_t>
+    //!\cond
+        requires std::StrictTotallyOrdered<value_type_t<remove_cvref_t<urng_t>>>
+    //!\endcond
+    static auto impl(urng_t && urange, size_t const w)
+    {
+        return minimiser_view{std::view::all(std::forward<urng_t>(urange)), w};
+    }
+
+public:
+    //!\brief Inherit the base class's Constructors.
+    using base_t::base_t;
+};
+
+} // namespace seqan3::detail
+
+namespace seqan3::view
+{
+    /*!\name Alphabet related views
+     * \{
+     */
+
+    /*!\brief            A view that yields the minimum value of every window of w values in the input range.
+     * \tparam urng_t    The type of the range being processed. See below for requirements. [template parameter
+     *                   is omitted in pipe notation]
+     * \param[in] urange The range being processed. [parameter is omitted in pipe notation]
+     * \param[in] w      The window size.
+     * \returns          A range of (position, value) pairs where each pair holds the position (in the
+     *                   underlying range) and the value of the smallest element of the resp. window. See
+     *                   below for the properties of the returned range.
+     * \ingroup view
+     *
+     * Typically applied on top of seqan3::view::kmer_hash to generate minimizer seeds: every window of `w`
+     * consecutive k-mer hashes is represented by its smallest hash (the leftmost one on ties). The view
+     * computes all minima lazily in \f$O(n)\f$ overall by maintaining a monotonic deque over the current
+     * window; the deque lives in a ring buffer of `w` slots that is allocated once when iteration starts.
+     *
+     * Throws std::invalid_argument if `w == 0`.
+     *
+     * ### View properties
+     *
+     * | range concepts and reference_t  | `urng_t` (underlying range type)      | `rrng_t` (returned range type)                     |
+     * |---------------------------------|:-------------------------------------:|:--------------------------------------------------:|
+     * | std::ranges::InputRange         | *required*                            | *preserved*                                        |
+     * | std::ranges::ForwardRange       | *required*                            | *preserved*                                        |
+     * | std::ranges::BidirectionalRange |                                       | *lost*                                             |
+     * | std::ranges::RandomAccessRange  |                                       | *lost*                                             |
+     * | std::ranges::ContiguousRange    |                                       | *lost*                                             |
+     * |                                 |                                       |                                                    |
+     * | std::ranges::ViewableRange      | *required*                            | *guaranteed*                                       |
+     * | std::ranges::View               |                                       | *guaranteed*                                       |
+     * | std::ranges::SizedRange         |                                       | *preserved*                                        |
+     * | std::ranges::CommonRange        |                                       | *guaranteed*                                       |
+     * | std::ranges::OutputRange        |                                       | *lost*                                             |
+     * | seqan3::const_iterable_concept  |                                       | *preserved*                                        |
+     * |                                 |                                       |                                                    |
+     * | seqan3::reference_t             | std::StrictTotallyOrdered             | std::pair<std::size_t, seqan3::value_type_t<urng_t>> |
+     *
+     * See the \link view view submodule documentation \endlink for detailed descriptions of the view properties.
+     *
+     * ### Example
+     * \snippet test/snippet/range/view/minimiser.cpp usage
+     * \hideinitializer
+     */
+    inline auto constexpr minimiser = detail::minimiser_fn{};
+} // namespace seqan3::view
@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 
 #include <seqan3/range/concept.hpp>
@@ -20,6 +21,52 @@
 
 namespace seqan3::detail
 {
+
+/*!\brief A fixed-size tile of the upper triangle of pairwise combinations.
+ * \ingroup view
+ *
+ * \details
+ *
+ * A tile represents the index pairs `(i, j)` with `first_begin <= i < first_end`,
+ * `second_begin <= j < second_end` and `i < j`. It is produced by
+ * seqan3::detail::pairwise_combine_view::tile and allows a parallel consumer to process a whole
+ * cache-friendly block of combinations with two plain index loops — the triangular-root arithmetic of
+ * the view's random-access iterator is only needed once per tile, not once per pair.
+ */
+struct combination_tile
+{
+    //!\brief The first index of the first element of a pair.
+    size_t first_begin{};
+    //!\brief The index behind the last first element of a pair.
+    size_t first_end{};
+    //!\brief The first index of the second element of a pair.
+    size_t second_begin{};
+    //!\brief The index behind the last second element of a pair.
+    size_t second_end{};
+
+    /*!\brief Invokes a callable with the indices of every pair of the tile.
+     * \tparam    fn_t The type of the callable; must be invocable with two `size_t` arguments.
+     * \param[in] fn   The callable to invoke with the indices `(i, j)` of each pair, where `i < j`.
+     */
+    template <typename fn_t>
+    constexpr void for_each(fn_t && fn) const
+    {
+        for (size_t first = first_begin; first < first_end; ++first)
+            for (size_t second = std::max(second_begin, first + 1); second < second_end; ++second)
+                fn(first, second);
+    }
+
+    //!\brief Returns the number of pairs contained in the tile.
+    constexpr size_t size() const noexcept
+    {
+        if (first_begin == second_begin) // tile on the diagonal: upper triangle of the block
+        {
+            size_t const extent = first_end - first_begin;
+            return extent * (extent - 1) / 2;
+        }
+        return (first_end - first_begin) * (second_end - second_begin);
+    }
+};
 /*!\brief Generates all pairwise combinations of the elements in the underlying range.
  * \ingroup view
  * \tparam underlying_range_type The type of the underlying range; must model std::ranges::View,
@@ -624,6 +671,90 @@ public:
     }
     //!\}
 
+    /*!\name Tiled access
+     * \{
+     */
+    /*!\brief Returns the number of tiles the upper triangle of combinations decomposes into.
+     * \param[in] tile_extent The number of elements per tile dimension; must be greater than `0`.
+     *
+     * \details
+     *
+     * The indices of the underlying range are cut into `ceil(n / tile_extent)` blocks and every unordered
+     * pair of blocks (including each block with itself) forms one tile, so the combinations of a tile fit
+     * into a `tile_extent` x `tile_extent` square of the triangular iteration space. Tiles on the diagonal
+     * contain fewer pairs than the off-diagonal tiles (see seqan3::detail::combination_tile::size) and may
+     * be empty.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    constexpr size_type tile_count(size_t const tile_extent) const noexcept
+    //!\cond
+        requires std::ranges::SizedRange<underlying_range_type>
+    //!\endcond
+    {
+        assert(tile_extent > 0u);
+        size_t const block_count = (std::ranges::size(u_range) + tile_extent - 1) / tile_extent;
+        return block_count * (block_count + 1) / 2;
+    }
+
+    /*!\brief Returns the tile with the given index.
+     * \param[in] tile_index  The index of the tile; must be smaller than tile_count().
+     * \param[in] tile_extent The number of elements per tile dimension; must be greater than `0`.
+     *
+     * \details
+     *
+     * The tiles of the upper triangle are enumerated row-wise; processing every tile index in
+     * `[0, tile_count())` exactly once visits every combination of the view exactly once. The pair
+     * coordinates within a tile are plain incremental indices (see seqan3::detail::combination_tile), so a
+     * parallel consumer can distribute tile indices over workers and only pays the triangular index
+     * arithmetic once per tile.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    constexpr combination_tile tile(size_t const tile_index, size_t const tile_extent) const noexcept
+    //!\cond
+        requires std::ranges::SizedRange<underlying_range_type>
+    //!\endcond
+    {
+        assert(tile_extent > 0u);
+        assert(tile_index < tile_count(tile_extent));
+
+        size_t const source_size = std::ranges::size(u_range);
+        size_t const block_count = (source_size + tile_extent - 1) / tile_extent;
+
+        // Solve `block_row * (2 * block_count - block_row + 1) / 2 <= tile_index` for the largest block_row
+        // (row-wise enumeration of the upper triangle including the diagonal), then guard the floating point
+        // result against rounding.
+        double const discriminant = (2.0 * block_count + 1.0) * (2.0 * block_count + 1.0) - 8.0 * tile_index;
+        size_t block_row = static_cast<size_t>((2.0 * block_count + 1.0 - std::sqrt(discriminant)) / 2.0);
+        while (block_row > 0u && block_row * (2 * block_count - block_row + 1) / 2 > tile_index)
+            --block_row;
+        while ((block_row + 1) * (2 * block_count - block_row) / 2 <= tile_index)
+            ++block_row;
+
+        size_t const block_column = block_row + (tile_index - block_row * (2 * block_count - block_row + 1) / 2);
+
+        combination_tile tile{};
+        tile.first_begin = block_row * tile_extent;
+        tile.first_end = std::min(source_size, tile.first_begin + tile_extent);
+        tile.second_begin = block_column * tile_extent;
+        tile.second_end = std::min(source_size, tile.second_begin + tile_extent);
+        return tile;
+    }
+    //!\}
+
 private:
 
     //!\brief The underling range.
@@ -229,6 +229,9 @@ namespace seqan3::view
  * internally so all view requirements like constant copy are satisfied. However construction and copying might be
  * slightly slower, because of reference counting.
  *
+ * Note that this adaptor only extends the lifetime of the range, it does not change its traversal properties;
+ * if you need to traverse a single-pass range multiple times, use seqan3::view::materialise instead.
+ *
  * ### View properties
  *
  * | range concepts and reference_t  | `urng_t` (underlying range type)      | `rrng_t` (returned range type)                     |
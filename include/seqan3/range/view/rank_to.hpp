@@ -13,6 +13,7 @@
 #pragma once
 
 #include <seqan3/alphabet/concept.hpp>
+#include <seqan3/range/detail/elementwise_transform.hpp>
 #include <seqan3/range/view/deep.hpp>
 #include <seqan3/std/ranges>
 
@@ -57,13 +58,14 @@ namespace seqan3::view
  *
  * \par Example
  * \snippet test/snippet/range/view/rank_char.cpp rank_to
+ * \sa seqan3::convert_copy for an eager, chunk-wise variant of this conversion.
  * \hideinitializer
  */
 template <typename alphabet_type>
 //!\cond
     requires Alphabet<alphabet_type>
 //!\endcond
-inline auto const rank_to = deep{std::view::transform(
+inline auto const rank_to = deep{detail::elementwise_transform(
 [] (underlying_rank_t<alphabet_type> const in) -> alphabet_type
 {
     return assign_rank(alphabet_type{}, in);
@@ -0,0 +1,228 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::view::reverse_complement, seqan3::reverse_complement_copy and
+ *        seqan3::complement_inplace.
+ */
+
+#pragma once
+
+#include <algorithm>
+
+#include <seqan3/alphabet/nucleotide/concept.hpp>
+#include <seqan3/range/view/convert_copy.hpp>
+#include <seqan3/range/view/deep.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief The byte translation performed by seqan3::complement, i.e. object byte to object byte.
+ * \ingroup view
+ * \tparam alphabet_t The nucleotide alphabet; must satisfy seqan3::NucleotideAlphabet.
+ *
+ * Input bytes that are not the object representation of a valid value are translated like rank 0.
+ */
+template <NucleotideAlphabet alphabet_t>
+inline byte_translation const & complement_translation()
+{
+    static byte_translation const translation = [] ()
+    {
+        std::array<uint8_t, 256> table{};
+        table.fill(byte_of(complement(assign_rank(alphabet_t{}, 0))));
+        for (size_t rank = 0; rank < alphabet_size_v<alphabet_t>; ++rank)
+            table[byte_of(assign_rank(alphabet_t{}, rank))] = byte_of(complement(assign_rank(alphabet_t{}, rank)));
+        return make_byte_translation(table);
+    }();
+    return translation;
+}
+
+} // namespace seqan3::detail
+
+namespace seqan3::view
+{
+
+/*!\name Alphabet related views
+ * \{
+ */
+
+/*!\brief               A view that presents a range of nucleotides as its reverse complement.
+ * \tparam urng_t       The type of the range being processed. See below for requirements. [template parameter is
+ *                      omitted in pipe notation]
+ * \param[in] urange    The range being processed. [parameter is omitted in pipe notation]
+ * \returns             A range of converted elements in reverse order. See below for the properties of the returned
+ *                      range.
+ * \ingroup view
+ *
+ * Equivalent to `std::view::reverse` composed with seqan3::view::complement, fused into a single adaptor so that
+ * the ubiquitous "map the reverse strand" pattern is a single pipe step.
+ *
+ * ### View properties
+ *
+ * This view is a **deep view:** Given a range-of-range as input (as opposed to just a range), it will apply
+ * the transformation on the innermost range (instead of the outermost range).
+ *
+ * | range concepts and reference_t  | `urng_t` (underlying range type)      | `rrng_t` (returned range type)                     |
+ * |---------------------------------|:-------------------------------------:|:--------------------------------------------------:|
+ * | std::ranges::InputRange         | *required*                            | *preserved*                                        |
+ * | std::ranges::ForwardRange       |                                       | *preserved*                                        |
+ * | std::ranges::BidirectionalRange | *required*                            | *preserved*                                        |
+ * | std::ranges::RandomAccessRange  |                                       | *preserved*                                        |
+ * | std::ranges::ContiguousRange    |                                       | *lost*                                             |
+ * |                                 |                                       |                                                    |
+ * | std::ranges::ViewableRange      | *required*                            | *guaranteed*                                       |
+ * | std::ranges::View               |                                       | *guaranteed*                                       |
+ * | std::ranges::SizedRange         |                                       | *preserved*                                        |
+ * | std::ranges::CommonRange        |                                       | *preserved*                                        |
+ * | std::ranges::OutputRange        |                                       | *lost*                                             |
+ * | seqan3::const_iterable_concept  |                                       | *preserved*                                        |
+ * |                                 |                                       |                                                    |
+ * | seqan3::reference_t             | seqan3::NucleotideAlphabet            | std::remove_reference_t<seqan3::reference_t<urng_t>> |
+ *
+ * See the \link view view submodule documentation \endlink for detailed descriptions of the view properties.
+ *
+ * ### Example
+ *
+ * \snippet test/snippet/range/view/reverse_complement.cpp usage
+ * \sa seqan3::reverse_complement_copy for an eager, chunk-wise variant.
+ * \hideinitializer
+ */
+inline auto const reverse_complement = deep{std::view::reverse | std::view::transform([] (auto && in)
+{
+    static_assert(NucleotideAlphabet<delete_const_t<decltype(in)>>,
+                  "The innermost value type must satisfy the NucleotideAlphabet.");
+    // call element-wise complement from the NucleotideAlphabet
+    using seqan3::complement;
+    return complement(in);
+})};
+
+//!\}
+
+} // namespace seqan3::view
+
+namespace seqan3
+{
+
+/*!\brief Eagerly materialises the reverse complement of a nucleotide sequence.
+ * \tparam source_rng_t The type of the range to convert from; must satisfy std::ranges::BidirectionalRange.
+ * \tparam target_rng_t The type of the range to convert into; must satisfy std::ranges::ForwardRange.
+ * \param[in]  source The range to convert from.
+ * \param[out] target The range to convert into; must already hold the same number of elements as \p source and
+ *                    must not overlap it.
+ * \ingroup view
+ *
+ * \details
+ *
+ * This is the eager, bulk counterpart of seqan3::view::reverse_complement. For contiguous ranges over
+ * single-byte nucleotide types the complement is applied chunk-wise with the kernel of
+ * seqan3::detail::translate_bytes and the buffer is then reversed in place, so materialising the reverse
+ * strand of whole reads runs close to memory bandwidth. For all other ranges an element-wise loop with the
+ * same semantics is used.
+ *
+ * ### Complexity
+ *
+ * Linear in the length of \p source.
+ *
+ * ### Exceptions
+ *
+ * No-throw guarantee.
+ *
+ * \sa seqan3::view::reverse_complement
+ * \sa seqan3::convert_copy
+ */
+template <std::ranges::BidirectionalRange source_rng_t, std::ranges::ForwardRange target_rng_t>
+inline void reverse_complement_copy(source_rng_t && source, target_rng_t && target)
+{
+    using in_t = value_type_t<remove_cvref_t<source_rng_t>>;
+    using out_t = value_type_t<remove_cvref_t<target_rng_t>>;
+
+    static_assert(NucleotideAlphabet<in_t>, "The source value type must satisfy the NucleotideAlphabet.");
+    static_assert(std::Same<in_t, out_t>, "The two ranges must be over the same alphabet.");
+
+    constexpr bool bytewise = std::ranges::ContiguousRange<std::remove_reference_t<source_rng_t>> &&
+                              std::ranges::ContiguousRange<std::remove_reference_t<target_rng_t>> &&
+                              std::ranges::SizedRange<std::remove_reference_t<source_rng_t>> &&
+                              std::ranges::SizedRange<std::remove_reference_t<target_rng_t>> &&
+                              sizeof(in_t) == 1 && std::is_trivially_copyable_v<in_t>;
+
+    if constexpr (bytewise)
+    {
+        assert(std::ranges::size(source) == std::ranges::size(target));
+        uint8_t * const target_bytes = reinterpret_cast<uint8_t *>(std::ranges::data(target));
+        detail::translate_bytes(reinterpret_cast<uint8_t const *>(std::ranges::data(source)),
+                                target_bytes,
+                                std::ranges::size(source),
+                                detail::complement_translation<in_t>());
+        std::reverse(target_bytes, target_bytes + std::ranges::size(target));
+    }
+    else
+    {
+        auto target_it = std::ranges::begin(target);
+        for (auto && element : source | std::view::reverse)
+        {
+            assert(target_it != std::ranges::end(target));
+            *target_it = complement(element);
+            ++target_it;
+        }
+    }
+}
+
+/*!\brief Replaces every letter of a nucleotide sequence by its complement, in place.
+ * \tparam rng_t The type of the range to complement; must satisfy std::ranges::ForwardRange and
+ *               std::ranges::OutputRange over its own value type.
+ * \param[in,out] rng The range to complement.
+ * \ingroup view
+ *
+ * \details
+ *
+ * For contiguous ranges over single-byte nucleotide types the complement is applied chunk-wise with the
+ * kernel of seqan3::detail::translate_bytes (reading and writing the same buffer), so complementing a whole
+ * read or chromosome runs close to memory bandwidth. For all other ranges an element-wise loop with the same
+ * semantics is used.
+ *
+ * Note that for seqan3::dna4 and seqan3::rna4 the element-wise loop is already branchless
+ * (seqan3::dna4::complement is a single XOR), so both paths vectorise for these alphabets.
+ *
+ * ### Complexity
+ *
+ * Linear in the length of \p rng.
+ *
+ * ### Exceptions
+ *
+ * No-throw guarantee.
+ *
+ * \sa seqan3::reverse_complement_copy
+ * \sa seqan3::view::complement for the lazy, element-wise variant.
+ */
+template <std::ranges::ForwardRange rng_t>
+//!\cond
+    requires std::ranges::OutputRange<rng_t, value_type_t<remove_cvref_t<rng_t>>>
+//!\endcond
+inline void complement_inplace(rng_t && rng)
+{
+    using alph_t = value_type_t<remove_cvref_t<rng_t>>;
+
+    static_assert(NucleotideAlphabet<alph_t>, "The value type must satisfy the NucleotideAlphabet.");
+
+    constexpr bool bytewise = std::ranges::ContiguousRange<std::remove_reference_t<rng_t>> &&
+                              std::ranges::SizedRange<std::remove_reference_t<rng_t>> &&
+                              sizeof(alph_t) == 1 && std::is_trivially_copyable_v<alph_t>;
+
+    if constexpr (bytewise)
+    {
+        uint8_t * const bytes = reinterpret_cast<uint8_t *>(std::ranges::data(rng));
+        detail::translate_bytes(bytes, bytes, std::ranges::size(rng), detail::complement_translation<alph_t>());
+    }
+    else
+    {
+        for (auto && element : rng)
+            element = complement(element);
+    }
+}
+
+} // namespace seqan3
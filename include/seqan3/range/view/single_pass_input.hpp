@@ -18,6 +18,7 @@
 #include <seqan3/std/concepts>
 #include <seqan3/std/iterator>
 #include <seqan3/std/ranges>
+#include <seqan3/std/span>
 
 //-----------------------------------------------------------------------------
 // Implementation of single pass input view.
@@ -144,6 +145,64 @@ public:
     //!\copydoc single_pass_input_view::end() const
     sentinel cend() const = delete;
     //!\}
+
+    /*!\name Buffered chunk access
+     * \{
+     */
+    /*!\brief Exposes the not-yet-consumed part of the underlying range as a contiguous segment.
+     * \returns A std::span over the remaining elements, respectively the underlying iterator's chunk.
+     *
+     * \details
+     *
+     * This primitive allows aware consumers to collapse per-element call chains into block operations:
+     * instead of calling `operator++` per character, they process the returned segment directly and then
+     * mark it as consumed via chunk_advance(). It is available if the underlying range is contiguous —
+     * the segment is then simply the range between the cached iterator and the end — or if the underlying
+     * iterator itself exposes a `chunk()` member, like seqan3::detail::fast_istreambuf_iterator which
+     * surfaces the stream buffer's get area (in that case the segment is only the currently buffered part
+     * and a subsequent call after consumption may return new data).
+     *
+     * The returned segment is invalidated by any operation that advances the view.
+     */
+    auto chunk()
+    //!\cond
+        requires std::ranges::ContiguousRange<urng_t> ||
+                 requires (urng_iterator_type it) { it.chunk(); }
+    //!\endcond
+    {
+        if constexpr (requires (urng_iterator_type it) { it.chunk(); })
+        {
+            return state_ptr->cached_urng_iter.chunk();
+        }
+        else
+        {
+            using chunk_type = std::span<std::remove_reference_t<reference>>;
+
+            auto & cached_iter = state_ptr->cached_urng_iter;
+            auto const last = seqan3::end(state_ptr->urng);
+
+            if (cached_iter == last)
+                return chunk_type{};
+
+            return chunk_type{std::addressof(*cached_iter), static_cast<size_t>(last - cached_iter)};
+        }
+    }
+
+    /*!\brief Marks the given number of elements of the current chunk as consumed.
+     * \param[in] count The number of elements to consume; must not be greater than the size of chunk().
+     */
+    void chunk_advance(size_t const count)
+    //!\cond
+        requires std::ranges::ContiguousRange<urng_t> ||
+                 requires (urng_iterator_type it) { it.chunk(); }
+    //!\endcond
+    {
+        if constexpr (requires (urng_iterator_type it, size_t const c) { it.chunk_advance(c); })
+            state_ptr->cached_urng_iter.chunk_advance(count);
+        else
+            std::ranges::advance(state_ptr->cached_urng_iter, static_cast<std::ptrdiff_t>(count));
+    }
+    //!\}
 };
 
 /*!\name Deduction guide.
@@ -365,6 +424,14 @@ namespace seqan3::view
  *
  * Concurrent access to this view, e.g. while iterating over it, is not thread-safe and must be protected externally.
  *
+ * ### Buffered chunk access
+ *
+ * If the underlying range is contiguous, or its iterator exposes the stream buffer's get area (see
+ * seqan3::detail::fast_istreambuf_iterator), the returned view additionally offers
+ * seqan3::detail::single_pass_input_view::chunk and
+ * seqan3::detail::single_pass_input_view::chunk_advance, with which aware consumers can process whole
+ * contiguous segments at once instead of advancing element by element.
+ *
  * ### Example
  *
  * \snippet test/snippet/range/view/single_pass_input.cpp usage
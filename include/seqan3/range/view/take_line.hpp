@@ -12,6 +12,8 @@
 
 #pragma once
 
+#include <cstring>
+
 #include <range/v3/view/take_while.hpp>
 #include <range/v3/algorithm/copy.hpp>
 
@@ -352,12 +354,45 @@ private:
     friend base_t;
 
     /*!\brief       Call the view's constructor with the underlying view as argument.
-     * \returns     An instance of seqan3::detail::view_take_line.
+     * \returns     An instance of seqan3::detail::view_take_line or a std::ranges::subrange (see below).
+     *
+     * \details
+     *
+     * If the underlying range is contiguous over `char`, the end of the line is located **eagerly** via
+     * std::memchr and a bounded view over the line is returned, instead of testing every character
+     * during iteration. The returned range then also models std::ranges::SizedRange and
+     * std::ranges::CommonRange.
      */
     template <std::ranges::View urng_t>
     static auto impl(urng_t urange)
     {
-        return view_take_line<urng_t, require_eol>{std::move(urange)};
+        if constexpr (std::ranges::ContiguousRange<urng_t> &&
+                      std::ranges::SizedRange<urng_t> &&
+                      std::Same<std::remove_cv_t<value_type_t<urng_t>>, char>)
+        {
+            char const * const first = std::ranges::data(urange);
+            char const * const last  = first + std::ranges::size(urange);
+            char const * hit         = static_cast<char const *>(std::memchr(first, '\n', last - first));
+
+            if (hit == nullptr)
+            {
+                if constexpr (require_eol)
+                    throw unexpected_end_of_input{"Reached end of input before end-of-line."};
+
+                hit = last;
+            }
+            else if ((hit != first) && (*(hit - 1) == '\r')) // windows eol
+            {
+                --hit;
+            }
+
+            return std::ranges::subrange{std::ranges::begin(urange),
+                                         std::ranges::begin(urange) + (hit - first)};
+        }
+        else
+        {
+            return view_take_line<urng_t, require_eol>{std::move(urange)};
+        }
     }
 
     /*!\brief       Call the view's constructor with the underlying range wrapped in seqan3::view::all as argument.
@@ -420,6 +455,10 @@ namespace seqan3::view
  *
  * See the \link view view submodule documentation \endlink for detailed descriptions of the view properties.
  *
+ * If the underlying range is contiguous over `char`, the end of the line is instead located eagerly via
+ * std::memchr and a bounded view over the line is returned that additionally models std::ranges::SizedRange
+ * and std::ranges::CommonRange.
+ *
  * ### Example
  *
  * Behaviour on std::ranges::ForwardRange:
@@ -19,6 +19,7 @@
 #include <seqan3/core/metafunction/range.hpp>
 #include <seqan3/core/metafunction/transformation_trait_or.hpp>
 #include <seqan3/io/exception.hpp>
+#include <seqan3/io/stream/parse_condition_detail.hpp>
 #include <seqan3/range/concept.hpp>
 #include <seqan3/range/shortcuts.hpp>
 #include <seqan3/range/view/detail.hpp>
@@ -338,12 +339,39 @@ private:
      * \tparam    fun_t  The type of the callable; concept checks done in class.
      * \param[in] urange The underlying range.
      * \param[in] fun    The callable that will be evaluated on every element.
-     * \returns An instance of seqan3::detail::view_take_until.
+     * \returns An instance of seqan3::detail::view_take_until or a std::ranges::subrange (see below).
+     *
+     * \details
+     *
+     * If the underlying range is contiguous over `char` and the functor is a parse condition (e.g.
+     * seqan3::is_char), the position of the delimiter is computed **eagerly** via the condition's bulk
+     * scan (std::memchr / chunk-wise look-up tables) and a bounded view over the prefix is returned,
+     * instead of evaluating the functor once per element during iteration. The returned range then also
+     * models std::ranges::SizedRange and std::ranges::CommonRange.
      */
     template <std::ranges::View urng_t, typename fun_t>
     static auto impl(urng_t urange, fun_t && fun)
     {
-        return view_take_until<urng_t, fun_t, or_throw>{std::move(urange), std::forward<fun_t>(fun)};
+        if constexpr (std::ranges::ContiguousRange<urng_t> &&
+                      std::ranges::SizedRange<urng_t> &&
+                      std::Same<std::remove_cv_t<value_type_t<urng_t>>, char> &&
+                      ParseCondition<remove_cvref_t<fun_t>>)
+        {
+            char const * const first = std::ranges::data(urange);
+            char const * const last  = first + std::ranges::size(urange);
+            char const * const hit   = fun.find_first_of(first, last);
+
+            if constexpr (or_throw)
+                if (hit == last)
+                    throw unexpected_end_of_input{"Reached end of input before functor evaluated to true."};
+
+            return std::ranges::subrange{std::ranges::begin(urange),
+                                         std::ranges::begin(urange) + (hit - first)};
+        }
+        else
+        {
+            return view_take_until<urng_t, fun_t, or_throw>{std::move(urange), std::forward<fun_t>(fun)};
+        }
     }
 
     /*!\brief Wraps the range argument in seqan3::view::all and forwards to the other overload.
@@ -414,6 +442,11 @@ namespace seqan3::view
  * applying the functor doesn't change the functor. If the functor only models std::Invocable and not
  * std::RegularInvocable these concepts are *lost*.
  *
+ * If the underlying range is contiguous over `char` and the functor is a parse condition (e.g.
+ * seqan3::is_char), the delimiter is instead located eagerly in bulk (std::memchr / chunk-wise look-up
+ * tables) and a bounded view over the prefix is returned that additionally models std::ranges::SizedRange
+ * and std::ranges::CommonRange.
+ *
  * ### Example
  *
  * \snippet test/snippet/range/view/take_until.cpp usage
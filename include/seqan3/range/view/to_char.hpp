@@ -13,6 +13,7 @@
 #pragma once
 
 #include <seqan3/alphabet/concept.hpp>
+#include <seqan3/range/detail/elementwise_transform.hpp>
 #include <seqan3/range/view/deep.hpp>
 #include <seqan3/std/ranges>
 
@@ -56,9 +57,10 @@ namespace seqan3::view
  *
  * ### Example
  * \snippet test/snippet/range/view/rank_char.cpp to_char
+ * \sa seqan3::convert_copy for an eager, chunk-wise variant of this conversion.
  * \hideinitializer
  */
-inline auto const to_char = deep{std::view::transform([] (auto const in) noexcept
+inline auto const to_char = deep{detail::elementwise_transform([] (auto const in) noexcept
 {
     static_assert(Alphabet<remove_cvref_t<decltype(in)>>, "The value type of seqan3::view::to_char must model the seqan3::Alphabet.");
     return seqan3::to_char(in);
@@ -14,6 +14,7 @@
 
 #include <seqan3/alphabet/concept.hpp>
 #include <seqan3/io/stream/char_operations.hpp>
+#include <seqan3/range/detail/elementwise_transform.hpp>
 #include <seqan3/range/view/deep.hpp>
 #include <seqan3/std/ranges>
 
@@ -59,7 +60,7 @@ namespace seqan3::view
  * \snippet test/snippet/range/view/to_case.cpp to_lower
  * \hideinitializer
  */
-inline auto const to_lower = deep{std::view::transform([] (auto const in) noexcept
+inline auto const to_lower = deep{detail::elementwise_transform([] (auto const in) noexcept
 {
     static_assert(char_concept<remove_cvref_t<decltype(in)>>, 
                   "The value type of seqan3::view::to_lower must model the seqan3::char_concept.");
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <seqan3/alphabet/concept.hpp>
+#include <seqan3/range/detail/elementwise_transform.hpp>
 #include <seqan3/range/view/deep.hpp>
 #include <seqan3/std/ranges>
 
@@ -58,9 +59,10 @@ namespace seqan3::view
  * \snippet test/snippet/range/view/rank_char.cpp to_rank
  * We also convert to unsigned here, because the seqan3::underlying_rank_t is often `uint8_t` which is
  * often implemented as `unsigned char` and thus will not be printed as a number by default.
+ * \sa seqan3::convert_copy for an eager, chunk-wise variant of this conversion.
  * \hideinitializer
  */
-inline auto const to_rank = deep{std::view::transform([] (auto const in) noexcept
+inline auto const to_rank = deep{detail::elementwise_transform([] (auto const in) noexcept
 {
     static_assert(Alphabet<remove_cvref_t<decltype(in)>>, "The value type of seqan3::view::to_rank must model the seqan3::Alphabet.");
     return seqan3::to_rank(in);
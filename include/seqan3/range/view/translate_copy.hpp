@@ -0,0 +1,198 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::translate_copy.
+ */
+
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/aminoacid/translation.hpp>
+#include <seqan3/alphabet/aminoacid/translation_details.hpp>
+#include <seqan3/alphabet/nucleotide/concept.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/rna4.hpp>
+#include <seqan3/core/metafunction/range.hpp>
+#include <seqan3/range/view/translation.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+//!\brief The six single frames in the order produced by seqan3::detail::view_translate.
+//!\ingroup view
+inline constexpr std::array<translation_frames, 6> single_translation_frames
+{
+    translation_frames::FWD_FRAME_0,
+    translation_frames::FWD_FRAME_1,
+    translation_frames::FWD_FRAME_2,
+    translation_frames::REV_FRAME_0,
+    translation_frames::REV_FRAME_1,
+    translation_frames::REV_FRAME_2
+};
+
+//!\brief The number of amino acids a frame with the given offset yields for a sequence of length `n`.
+//!\ingroup view
+constexpr size_t translation_frame_length(size_t const n, size_t const frame_offset) noexcept
+{
+    return n >= frame_offset ? (n - frame_offset) / 3 : 0;
+}
+
+/*!\brief A flat codon table for seqan3::dna4 and seqan3::rna4, indexed by the 6-bit triplet encoding
+ *        `rank(n1) << 4 | rank(n2) << 2 | rank(n3)`.
+ * \tparam gc The genetic code to use.
+ * \ingroup view
+ *
+ * \details
+ *
+ * Unlike the three-dimensional seqan3::detail::translation_table this table is consumed with a single
+ * indexed load, and the 6-bit index can be maintained incrementally while streaming over a sequence
+ * (shift in two bits per nucleotide).
+ */
+template <genetic_code gc = genetic_code::CANONICAL>
+struct flat_codon_table
+{
+    //!\brief Holds the flat codon table.
+    static constexpr std::array<aa27, 64> VALUE
+    {
+        [] () constexpr
+        {
+            std::array<aa27, 64> table{};
+
+            for (size_t i = 0; i < 4; ++i)
+                for (size_t j = 0; j < 4; ++j)
+                    for (size_t k = 0; k < 4; ++k)
+                        table[(i << 4) | (j << 2) | k] = translation_table<dna4, gc>::VALUE[i][j][k];
+
+            return table;
+        } ()
+    };
+};
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+/*!\brief Eagerly translates a nucleotide sequence in 1, 2, 3 or 6 frames.
+ * \tparam gc     The genetic code to use.
+ * \tparam urng_t The type of the range to translate; must satisfy std::ranges::RandomAccessRange and
+ *                std::ranges::SizedRange over a seqan3::NucleotideAlphabet.
+ * \param[in] sequence The range to translate.
+ * \param[in] tf       A value of seqan3::translation_frames that indicates the desired frames.
+ * \returns One seqan3::aa27_vector per selected frame, in the same order as seqan3::view::translate.
+ * \ingroup view
+ *
+ * \details
+ *
+ * This is the eager, bulk counterpart of seqan3::view::translate. The lazy view computes every amino acid
+ * on demand via seqan3::translate_triplet, fetching the three nucleotides separately, and traverses the
+ * source once per frame. This function instead makes a single streaming pass over the input and fills all
+ * selected frames during that pass.
+ *
+ * For seqan3::dna4 and seqan3::rna4 the pass maintains a rolling 6-bit codon index (two bits shifted in
+ * per nucleotide, once for the forward and once for the reverse complement strand, where complementing is
+ * a bitwise rank inversion) and resolves each codon with a single load from the flat 64-entry
+ * seqan3::detail::flat_codon_table. For all other nucleotide alphabets an element-wise loop over
+ * seqan3::translate_triplet with the exact same semantics as the view is used.
+ *
+ * ### Complexity
+ *
+ * Linear in the length of \p sequence, independent of the number of selected frames.
+ *
+ * ### Exceptions
+ *
+ * Basic exception guarantee (allocation of the result may throw).
+ *
+ * ### Example
+ *
+ * \include test/snippet/range/view/translate_copy.cpp
+ *
+ * \sa seqan3::view::translate
+ * \sa seqan3::view::translate_single
+ */
+template <genetic_code gc = genetic_code::CANONICAL, std::ranges::ForwardRange urng_t>
+//!\cond
+    requires std::ranges::SizedRange<urng_t> &&
+             std::ranges::RandomAccessRange<urng_t> &&
+             NucleotideAlphabet<std::decay_t<reference_t<std::decay_t<urng_t>>>>
+//!\endcond
+std::vector<aa27_vector> translate_copy(urng_t && sequence,
+                                        translation_frames const tf = translation_frames::SIX_FRAME)
+{
+    using nucl_t = std::decay_t<reference_t<std::decay_t<urng_t>>>;
+
+    size_t const n = std::ranges::size(sequence);
+
+    std::vector<aa27_vector> result;
+    // per-frame output positions; forward frames at [0..2], reverse frames at [3..5], nullptr if unselected
+    std::array<aa27 *, 6> frame_data{};
+
+    for (size_t frame = 0; frame < 6; ++frame)
+    {
+        if ((tf & detail::single_translation_frames[frame]) == detail::single_translation_frames[frame])
+        {
+            result.emplace_back(detail::translation_frame_length(n, frame % 3));
+            frame_data[frame] = result.back().data();
+        }
+    }
+
+    if constexpr (std::Same<nucl_t, dna4> || std::Same<nucl_t, rna4>)
+    {
+        auto const & table = detail::flat_codon_table<gc>::VALUE;
+
+        uint8_t fwd_state{};
+        uint8_t rev_state{};
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            uint8_t const rank = to_rank(sequence[i]);
+
+            fwd_state = ((fwd_state << 2) | rank) & 0b111111;
+            rev_state = (rev_state >> 2) | ((rank ^ 3u) << 4); // complementing inverts the two rank bits
+
+            if (i < 2) // no complete codon yet
+                continue;
+
+            size_t const fwd_start = i - 2;     // start of the codon on the forward strand
+            if (aa27 * const frame = frame_data[fwd_start % 3]; frame != nullptr)
+                frame[fwd_start / 3] = table[fwd_state];
+
+            size_t const rev_start = n - 1 - i; // start of the codon on the reverse complement strand
+            if (aa27 * const frame = frame_data[3 + rev_start % 3]; frame != nullptr)
+                frame[rev_start / 3] = table[rev_state];
+        }
+    }
+    else
+    {
+        for (size_t offset = 0; offset < 3; ++offset)
+        {
+            if (aa27 * const frame = frame_data[offset]; frame != nullptr)
+                for (size_t k = 0; k < detail::translation_frame_length(n, offset); ++k)
+                    frame[k] = translate_triplet<gc>(sequence[3 * k + offset],
+                                                     sequence[3 * k + offset + 1],
+                                                     sequence[3 * k + offset + 2]);
+        }
+
+        for (size_t offset = 0; offset < 3; ++offset)
+        {
+            if (aa27 * const frame = frame_data[3 + offset]; frame != nullptr)
+                for (size_t k = 0; k < detail::translation_frame_length(n, offset); ++k)
+                    frame[k] = translate_triplet<gc>(complement(sequence[n - 3 * k - offset - 1]),
+                                                     complement(sequence[n - 3 * k - offset - 2]),
+                                                     complement(sequence[n - 3 * k - offset - 3]));
+        }
+    }
+
+    return result;
+}
+
+} // namespace seqan3
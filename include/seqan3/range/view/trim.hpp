@@ -16,8 +16,10 @@
 
 #include <seqan3/alphabet/quality/qualified.hpp>
 #include <seqan3/core/metafunction/all.hpp>
+#include <seqan3/range/view/convert_copy.hpp>
 #include <seqan3/range/view/deep.hpp>
 #include <seqan3/std/ranges>
+#include <seqan3/std/span>
 
 namespace seqan3::detail
 {
@@ -135,8 +137,175 @@ struct trim_fn
     }
 };
 
+/*!\brief How the ranks and phred scores of a quality alphabet relate to its object bytes.
+ * \ingroup view
+ * \tparam alphabet_t The quality alphabet; must satisfy seqan3::QualityAlphabet.
+ *
+ * \details
+ *
+ * The chunked scan of seqan3::trim_eager compares raw object bytes against a threshold byte, which is only
+ * correct if the object byte of a value equals its rank and the phred scores ascend with the rank (both hold
+ * for seqan3::phred42, seqan3::phred63 and seqan3::phred68legacy, but e.g. not for seqan3::qualified whose
+ * rank interleaves the sequence letter). This is verified once per alphabet when the layout is built.
+ */
+template <typename alphabet_t>
+//!\cond
+    requires QualityAlphabet<alphabet_t> && (sizeof(alphabet_t) == 1) && std::is_trivially_copyable_v<alphabet_t>
+//!\endcond
+struct quality_byte_layout
+{
+    //!\brief Whether object bytes can be compared directly (see class documentation).
+    bool byte_comparable{};
+    //!\brief The phred score of every rank, ascending iff quality_byte_layout::byte_comparable.
+    std::array<underlying_phred_t<alphabet_t>, alphabet_size_v<alphabet_t>> phred_of_rank{};
+
+    //!\brief Builds and verifies the layout.
+    quality_byte_layout()
+    {
+        byte_comparable = alphabet_size_v<alphabet_t> <= 128; // signed byte compares must not wrap
+        for (size_t rank = 0; rank < alphabet_size_v<alphabet_t>; ++rank)
+        {
+            phred_of_rank[rank] = to_phred(assign_rank(alphabet_t{}, rank));
+            byte_comparable = byte_comparable && (byte_of(assign_rank(alphabet_t{}, rank)) == rank) &&
+                              (rank == 0 || phred_of_rank[rank - 1] <= phred_of_rank[rank]);
+        }
+    }
+};
+
+/*!\brief Returns the index of the first byte that compares less than the threshold, scanning chunk-wise.
+ * \ingroup view
+ * \param[in] in        Pointer to the bytes to scan; all values must be smaller than 128.
+ * \param[in] count     The number of bytes to scan.
+ * \param[in] threshold The threshold byte; must be smaller than 128.
+ * \returns The index of the first byte smaller than \p threshold, or \p count if there is none.
+ */
+inline size_t find_first_below(uint8_t const * const in, size_t const count, uint8_t const threshold)
+{
+    size_t i = 0;
+
+    using simd_t = simd_type_t<int8_t>;
+    constexpr size_t chunk_size = simd_traits<simd_t>::length;
+
+    if constexpr (chunk_size >= 8)
+    {
+        simd_t const threshold_chunk = fill<simd_t>(static_cast<int8_t>(threshold));
+
+        for (; i + chunk_size <= count; i += chunk_size)
+        {
+            simd_t in_chunk;
+            std::memcpy(&in_chunk, in + i, chunk_size);
+
+            simd_t const mask = in_chunk < threshold_chunk;
+
+            std::array<uint64_t, chunk_size / 8> mask_words;
+            std::memcpy(mask_words.data(), &mask, chunk_size);
+
+            uint64_t any_below = 0;
+            for (uint64_t const word : mask_words)
+                any_below |= word;
+
+            if (any_below != 0) // the exact position is determined by the scalar loop below
+                break;
+        }
+    }
+
+    for (; i < count; ++i)
+        if (in[i] < threshold)
+            return i;
+
+    return count;
+}
+
 } // namespace seqan3::detail
 
+namespace seqan3
+{
+
+/*!\brief Eagerly computes the quality-trimmed prefix of a contiguous range.
+ * \tparam rng_t The type of the range being processed; must satisfy std::ranges::ContiguousRange and
+ *               std::ranges::SizedRange and be over a seqan3::QualityAlphabet.
+ * \param[in] range     The range being processed.
+ * \param[in] threshold The minimum quality as a phred score.
+ * \returns A std::span over the prefix of \p range before the first element whose quality is below
+ *          \p threshold.
+ * \ingroup view
+ *
+ * \details
+ *
+ * This is the eager counterpart of seqan3::view::trim: instead of comparing one quality per iteration it
+ * locates the trim point up front — for single-byte quality alphabets whose object bytes ascend with the
+ * phred score (see seqan3::detail::quality_byte_layout) via the chunk-wise scan of
+ * seqan3::detail::find_first_below — and returns a sized, random-access, contiguous subrange, so downstream
+ * stages do not degrade to single-pass iteration. Note that in contrast to the view the trim point is fixed
+ * at the time of the call and does not react to later changes of the underlying range.
+ *
+ * ### Complexity
+ *
+ * Linear in the length of the returned prefix.
+ *
+ * ### Exceptions
+ *
+ * No-throw guarantee.
+ *
+ * \sa seqan3::view::trim
+ */
+template <std::ranges::ContiguousRange rng_t>
+//!\cond
+    requires std::ranges::SizedRange<std::remove_reference_t<rng_t>> &&
+             QualityAlphabet<value_type_t<remove_cvref_t<rng_t>>>
+//!\endcond
+inline auto trim_eager(rng_t && range,
+                       underlying_phred_t<value_type_t<remove_cvref_t<rng_t>>> const threshold)
+{
+    using alphabet_t = value_type_t<remove_cvref_t<rng_t>>;
+
+    size_t cut = 0;
+
+    if constexpr (sizeof(alphabet_t) == 1 && std::is_trivially_copyable_v<alphabet_t>)
+    {
+        static detail::quality_byte_layout<alphabet_t> const layout{};
+
+        if (layout.byte_comparable)
+        {
+            // the smallest rank whose score satisfies the threshold; scores below rank 0 trim everything
+            auto const rank_it = std::lower_bound(layout.phred_of_rank.begin(), layout.phred_of_rank.end(),
+                                                  threshold);
+            if (rank_it != layout.phred_of_rank.end())
+            {
+                uint8_t const threshold_byte = static_cast<uint8_t>(rank_it - layout.phred_of_rank.begin());
+                cut = detail::find_first_below(reinterpret_cast<uint8_t const *>(std::ranges::data(range)),
+                                               std::ranges::size(range),
+                                               threshold_byte);
+            }
+
+            return std::span{std::ranges::data(range), cut};
+        }
+    }
+
+    for (; cut < std::ranges::size(range); ++cut)
+        if (to_phred(std::ranges::data(range)[cut]) < threshold)
+            break;
+
+    return std::span{std::ranges::data(range), cut};
+}
+
+/*!\brief Eagerly computes the quality-trimmed prefix of a contiguous range.
+ * \copydetails seqan3::trim_eager
+ * \param[in] range     The range being processed.
+ * \param[in] threshold The minimum quality given by a value of the range's type.
+ */
+template <std::ranges::ContiguousRange rng_t>
+//!\cond
+    requires std::ranges::SizedRange<std::remove_reference_t<rng_t>> &&
+             QualityAlphabet<value_type_t<remove_cvref_t<rng_t>>>
+//!\endcond
+inline auto trim_eager(rng_t && range, std::decay_t<value_type_t<remove_cvref_t<rng_t>>> const threshold)
+{
+    return trim_eager(std::forward<rng_t>(range), to_phred(threshold));
+}
+
+} // namespace seqan3
+
 namespace seqan3::view
 {
 
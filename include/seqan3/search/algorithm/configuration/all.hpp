@@ -19,11 +19,15 @@
  * \todo Write detailed landing page.
  */
 
+#include <seqan3/search/algorithm/configuration/both_strands.hpp>
 #include <seqan3/search/algorithm/configuration/detail.hpp>
+#include <seqan3/search/algorithm/configuration/in_text_verification.hpp>
 #include <seqan3/search/algorithm/configuration/max_error.hpp>
 #include <seqan3/search/algorithm/configuration/max_error_rate.hpp>
 #include <seqan3/search/algorithm/configuration/mode.hpp>
+#include <seqan3/search/algorithm/configuration/on_hit.hpp>
 #include <seqan3/search/algorithm/configuration/output.hpp>
+#include <seqan3/search/algorithm/configuration/parallel.hpp>
 
 /*!\namespace seqan3::search_cfg
  * \brief A special sub namespace for the search configurations.
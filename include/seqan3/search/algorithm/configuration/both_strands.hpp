@@ -0,0 +1,44 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides the configuration to search both strands of a nucleotide text.
+ * \author Christopher Pockrandt <christopher.pockrandt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+#include <seqan3/core/metafunction/basic.hpp>
+#include <seqan3/search/algorithm/configuration/detail.hpp>
+
+namespace seqan3::search_cfg
+{
+
+/*!\brief Configuration element to search the reverse complement strand in addition to the query itself.
+ * \ingroup search_configuration
+ *
+ * \details
+ *
+ * When this element is present, seqan3::search additionally reports the occurrences of the reverse complement
+ * of every query. The index must be built over a nucleotide alphabet. The reverse complement is searched as a
+ * lazy rank remapping view on the query (seqan3::view::reverse_complement), i.e. no reversed copy of the query
+ * is materialized.
+ *
+ * The hits of both strands are reported together: counts are summed and text positions denote the begin of the
+ * occurrence on the forward strand regardless of which strand matched (a palindromic query reports such a
+ * position only once). The configured mode is applied to each strand individually, e.g.
+ * seqan3::search_cfg::mode of seqan3::search_cfg::best reports up to one best hit per strand.
+ */
+struct both_strands : public pipeable_config_element<both_strands, ignore_t>
+{
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::search_config_id id{detail::search_config_id::both_strands};
+};
+
+} // namespace seqan3::search_cfg
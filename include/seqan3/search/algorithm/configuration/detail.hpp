@@ -44,6 +44,10 @@ enum struct search_config_id : uint8_t
     max_error_rate,
     output,
     mode,
+    parallel,
+    in_text_verification,
+    on_hit,
+    both_strands,
     //!\cond
     // ATTENTION: Must always be the last item; will be used to determine the number of ids.
     SIZE
@@ -69,11 +73,15 @@ inline constexpr std::array<std::array<bool, static_cast<uint8_t>(search_config_
                             static_cast<uint8_t>(search_config_id::SIZE)> compatibility_table<search_config_id> =
 {
     {
-        // max_error, max_error_rate, output, mode
-        { 0, 0, 1, 1 },
-        { 0, 0, 1, 1 },
-        { 1, 1, 0, 1 },
-        { 1, 1, 1, 0 }
+        // max_error, max_error_rate, output, mode, parallel, in_text_verification, on_hit, both_strands
+        { 0, 0, 1, 1, 1, 1, 1, 1 },
+        { 0, 0, 1, 1, 1, 1, 1, 1 },
+        { 1, 1, 0, 1, 1, 1, 1, 1 },
+        { 1, 1, 1, 0, 1, 1, 1, 1 },
+        { 1, 1, 1, 1, 0, 1, 1, 1 },
+        { 1, 1, 1, 1, 1, 0, 1, 1 },
+        { 1, 1, 1, 1, 1, 1, 0, 1 },
+        { 1, 1, 1, 1, 1, 1, 1, 0 }
     }
 };
 
@@ -0,0 +1,44 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides the configuration for the in-text verification cutover of the search.
+ * \author Christopher Pockrandt <christopher.pockrandt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+#include <seqan3/search/algorithm/configuration/detail.hpp>
+
+namespace seqan3::search_cfg
+{
+
+/*!\brief Enables the in-text verification cutover of the search scheme algorithm.
+ * \ingroup search_configuration
+ *
+ * \details
+ *
+ * When the suffix array interval of the search drops to at most the stored number of candidates, the
+ * candidates are located and the match is finished directly in the text with a bit-parallel edit distance
+ * computation instead of continuing the index traversal (see seqan3::detail::in_text_verification).
+ *
+ * The cutover verifies the whole query with plain edit distance against a single text. It is therefore only
+ * applied when no error type is restricted below the total number of errors, when the index is not built
+ * over a collection and when hits are reported as text positions; in all other cases the index is traversed
+ * to the end of the query as usual. A value of `0` disables the cutover.
+ */
+struct in_text_verification : public pipeable_config_element<in_text_verification, uint32_t>
+{
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::search_config_id id{detail::search_config_id::in_text_verification};
+};
+
+} // namespace seqan3::search_cfg
@@ -0,0 +1,59 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides the configuration for a per-hit delegate of the search.
+ * \author Christopher Pockrandt <christopher.pockrandt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+#include <seqan3/core/metafunction/basic.hpp>
+#include <seqan3/search/algorithm/configuration/detail.hpp>
+
+namespace seqan3::search_cfg
+{
+
+/*!\brief Configuration element to stream the hits into a delegate instead of returning them.
+ * \tparam fn_t The type of the delegate.
+ * \ingroup search_configuration
+ *
+ * \details
+ *
+ * When this element is present, seqan3::search invokes the given delegate for every hit during the index
+ * traversal and returns `void`: no hit vector is materialized, i.e. the memory consumption stays constant no
+ * matter how many occurrences a query has. The delegate receives the configured output per hit, i.e. a cursor
+ * for seqan3::search_cfg::index_cursor and a text position (or a (text id, position) pair for collections)
+ * otherwise; the count output cannot be streamed.
+ *
+ * A delegate returning `bool` can additionally terminate the search of the current query early by returning
+ * `true`, e.g. to stop at the first acceptable hit. Delegates returning `void` never terminate early.
+ *
+ * In contrast to the returning interface the streamed hits are not deduplicated: positions reachable through
+ * several suffix array ranges (or through the in-text verification cutover) may be reported more than once.
+ * The queries are searched sequentially, i.e. seqan3::search_cfg::parallel has no effect in this mode.
+ */
+template <typename fn_t>
+struct on_hit : public pipeable_config_element<on_hit<fn_t>, fn_t>
+{
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::search_config_id id{detail::search_config_id::on_hit};
+};
+
+/*!\name Type deduction guides
+ * \relates seqan3::search_cfg::on_hit
+ * \{
+ */
+
+//!\brief Deduces the delegate type from the constructor argument.
+template <typename fn_t>
+on_hit(fn_t) -> on_hit<remove_cvref_t<fn_t>>;
+//!\}
+
+} // namespace seqan3::search_cfg
@@ -29,6 +29,8 @@ namespace seqan3::detail
 struct search_output_index_cursor {};
 //!\brief Type for the "text_position" value for the configuration element "output".
 struct search_output_text_position {};
+//!\brief Type for the "count" value for the configuration element "output".
+struct search_output_count {};
 
 } // namespace seqan3::detail
 
@@ -39,6 +41,11 @@ namespace seqan3::search_cfg
 inline detail::search_output_index_cursor constexpr index_cursor;
 //!\brief Configuration element to receive all hits within the lowest number of errors.
 inline detail::search_output_text_position constexpr text_position;
+/*!\brief Configuration element to receive the number of hits only. The counts are computed from the sizes of the
+ *        suffix array intervals without locating any hit, which is considerably faster when hits are numerous.
+ *        Note that a text position reached by different alignments of the query is counted once per alignment.
+ */
+inline detail::search_output_count constexpr count;
 
 /*!\brief Configuration element to determine the output type of hits.
  * \ingroup search_configuration
@@ -46,7 +53,8 @@ inline detail::search_output_text_position constexpr text_position;
 template <typename output_t>
 //!\cond
     requires std::Same<remove_cvref_t<output_t>, detail::search_output_text_position> ||
-             std::Same<remove_cvref_t<output_t>, detail::search_output_index_cursor>
+             std::Same<remove_cvref_t<output_t>, detail::search_output_index_cursor> ||
+             std::Same<remove_cvref_t<output_t>, detail::search_output_count>
 //!\endcond
 struct output : public pipeable_config_element<output<output_t>, output_t>
 {
@@ -0,0 +1,42 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides the configuration to enable parallel execution of the search over multiple queries.
+ * \author Christopher Pockrandt <christopher.pockrandt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+#include <seqan3/search/algorithm/configuration/detail.hpp>
+
+namespace seqan3::search_cfg
+{
+
+/*!\brief Enables the parallel execution of the search over a range of queries.
+ * \ingroup search_configuration
+ *
+ * \details
+ *
+ * If this configuration element is set, a range of queries is distributed over the given number of threads,
+ * each of which searches its share of the queries in the shared (read-only) index. The hits are still
+ * reported per query in the order of the input range. Searching a single query is not affected by this
+ * configuration element.
+ *
+ * The stored value is the number of threads to use. Note that one thread is always used if `0` is given.
+ */
+struct parallel : public pipeable_config_element<parallel, uint32_t>
+{
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::search_config_id id{detail::search_config_id::parallel};
+};
+
+} // namespace seqan3::search_cfg
@@ -0,0 +1,190 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides in-text verification for index based approximate search.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <vector>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/metafunction/range.hpp>
+#include <seqan3/search/algorithm/detail/search_common.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\addtogroup submodule_search_algorithm
+ * \{
+ */
+
+//!\brief Grants the search algorithms access to the text of an index; befriended by the index classes.
+struct in_text_verification_access
+{
+    //!\brief Returns the text the given index was built on.
+    template <typename index_t>
+    static auto const & text(index_t const & index) noexcept
+    {
+        return *index.text;
+    }
+};
+
+//!\brief Tag type that disables the in-text verification cutover.
+struct search_itv_off {};
+
+/*!\brief Parameters of the in-text verification cutover.
+ * \tparam text_t The type of the indexed text.
+ */
+template <typename text_t>
+struct search_itv
+{
+    //!\brief The text the index was built on.
+    text_t const & text;
+    //!\brief Suffix array interval size at which the search switches to in-text verification (0 disables it).
+    size_t threshold{};
+};
+
+/*!\name Type deduction guides
+ * \relates seqan3::detail::search_itv
+ * \{
+ */
+//!\brief Deduces the text type from the constructor argument.
+template <typename text_t>
+search_itv(text_t const &, size_t) -> search_itv<text_t>;
+//!\}
+
+/*!\brief Verifies the candidates of a suffix array interval directly against the text.
+ * \tparam abort_on_hit  If the flag is set, the verification aborts on the first hit.
+ * \tparam cursor_t      Must model seqan3::FmIndexCursor or seqan3::BiFmIndexCursor.
+ * \tparam query_t       Must be a std::ranges::RandomAccessRange over the index's alphabet.
+ * \tparam text_t        Must be a std::ranges::RandomAccessRange over the index's alphabet.
+ * \tparam delegate_t    Takes a text position (`size_t`) as argument.
+ * \param[in] cur        Cursor whose interval holds the candidates; the matched infix of `query` starts at
+ *                       `query_lb`.
+ * \param[in] query      Query sequence to be searched.
+ * \param[in] query_lb   Position in `query` where the infix matched by `cur` begins.
+ * \param[in] max_total  Total number of errors allowed for the whole query (Levenshtein distance).
+ * \param[in] text       The text the index was built on.
+ * \param[in] delegate   Function that is called with the begin position of every verified occurrence.
+ * \returns `true` if at least one hit has been found.
+ *
+ * \details
+ *
+ * Every candidate position is located once; around the expected begin of the full occurrence a window of
+ * `max_total` extra characters on both sides is verified with the bit-parallel edit distance recurrence of
+ * Myers (running over the reversed query and window, such that the scan reports occurrence *begin* positions
+ * as the index based search does). Queries longer than one machine word fall back to a plain dynamic
+ * programming column.
+ *
+ * Begin positions may be reported more than once when candidates share a window; the caller is expected to
+ * remove duplicates as it already does for positions located from cursors.
+ *
+ * ### Complexity
+ *
+ * \f$count() * O(SAMPLING\_RATE + |query| + max\_total)\f$ for queries up to 64 characters.
+ *
+ * ### Exceptions
+ *
+ * Strong exception guarantee if invoking the delegate also has a strong exception guarantee.
+ */
+template <bool abort_on_hit, typename cursor_t, typename query_t, typename text_t, typename delegate_t>
+inline bool in_text_verification(cursor_t const & cur, query_t & query, size_t const query_lb,
+                                 uint8_t const max_total, text_t const & text, delegate_t && delegate)
+{
+    using alphabet_t = value_type_t<std::remove_reference_t<text_t>>;
+
+    size_t const query_length = std::ranges::size(query);
+    size_t const text_length = std::ranges::size(text);
+    bool hit = false;
+
+    // Reports a verified begin position; returns true if and only if the scan shall abort.
+    auto report = [&] (size_t const begin)
+    {
+        bool const abort = delegate_requests_abort(delegate, begin);
+        hit = true;
+        return abort_on_hit && abort;
+    };
+
+    // Scans the window from right to left with the reversed query, such that positions with an edit distance
+    // of at most max_total are begin positions of occurrences of the (unreversed) query.
+    auto scan = [&] (size_t const window_begin, size_t const window_end)
+    {
+        if (query_length <= 64u) // bit-parallel scores, one word per window character (Myers)
+        {
+            std::array<uint64_t, alphabet_size_v<alphabet_t>> peq{};
+            for (size_t i = 0; i < query_length; ++i)
+                peq[to_rank(static_cast<alphabet_t>(query[query_length - 1 - i]))] |= uint64_t{1} << i;
+
+            uint64_t const mask = uint64_t{1} << (query_length - 1);
+            uint64_t vp = ~uint64_t{0}, vn = 0;
+            size_t score = query_length;
+
+            for (size_t j = window_end; j > window_begin; --j)
+            {
+                uint64_t const eq = peq[to_rank(text[j - 1])];
+                uint64_t const x = eq | vn;
+                uint64_t const d0 = ((vp + (x & vp)) ^ vp) | x;
+                uint64_t const hn = vp & d0;
+                uint64_t const hp = vn | ~(vp | d0);
+                score += (hp & mask) != 0;
+                score -= (hn & mask) != 0;
+                uint64_t const x2 = (hp << 1) | 1;
+                vn = x2 & d0;
+                vp = (hn << 1) | ~(x2 | d0);
+
+                if (score <= max_total && report(j - 1))
+                    return true;
+            }
+        }
+        else // plain dynamic programming column for queries longer than one machine word
+        {
+            std::vector<size_t> column(query_length + 1), column2(query_length + 1);
+            std::iota(column.begin(), column.end(), size_t{0});
+
+            for (size_t j = window_end; j > window_begin; --j)
+            {
+                column2[0] = 0;
+                for (size_t i = 1; i <= query_length; ++i)
+                {
+                    size_t const diagonal = column[i - 1] + !(query[query_length - i] == text[j - 1]);
+                    column2[i] = std::min({diagonal, column[i] + 1, column2[i - 1] + 1});
+                }
+                column.swap(column2);
+
+                if (column[query_length] <= max_total && report(j - 1))
+                    return true;
+            }
+        }
+        return false;
+    };
+
+    for (size_t const occ : cur.locate())
+    {
+        // The full occurrence is expected to begin query_lb characters before the matched infix, shifted by
+        // at most max_total characters through insertions and deletions; an occurrence spans at most
+        // query_length + max_total characters of the text.
+        size_t const expected_begin = occ >= query_lb ? occ - query_lb : 0;
+        size_t const window_begin = expected_begin >= max_total ? expected_begin - max_total : 0;
+        size_t const window_end = std::min(text_length, expected_begin + query_length + 2 * size_t{max_total});
+
+        if (scan(window_begin, window_end))
+            return true;
+    }
+
+    // Reaching this point means no abort was requested; only abort agnostic callers read the hit flag.
+    return !abort_on_hit && hit;
+}
+
+//!\}
+
+} // namespace seqan3::detail
@@ -12,7 +12,16 @@
 
 #pragma once
 
+#include <algorithm>
+#include <thread>
+#include <unordered_set>
+
+#include <seqan3/alphabet/nucleotide/concept.hpp>
 #include <seqan3/core/metafunction/pre.hpp>
+#include <seqan3/core/radix_sort.hpp>
+#include <seqan3/range/container/mmap_vector.hpp>
+#include <seqan3/range/view/reverse_complement.hpp>
+#include <seqan3/std/concepts>
 #include <seqan3/search/algorithm/configuration/all.hpp>
 #include <seqan3/search/algorithm/detail/search_scheme_algorithm.hpp>
 #include <seqan3/search/algorithm/detail/search_trivial.hpp>
@@ -25,7 +34,28 @@ namespace seqan3::detail
  * \{
  */
 
-/*!\brief Search a single query in an index.
+/*!\brief Hash for text positions as reported by seqan3::detail::search_single, i.e. plain positions for single
+ *        texts and (text id, position) pairs for collections.
+ */
+struct search_hit_hash
+{
+    //!\brief Hashes a position in a single text.
+    template <std::UnsignedIntegral position_t>
+    size_t operator()(position_t const position) const noexcept
+    {
+        return std::hash<position_t>{}(position);
+    }
+
+    //!\brief Hashes a (text id, position) pair of a text collection.
+    template <typename first_t, typename second_t>
+    size_t operator()(std::pair<first_t, second_t> const & position) const noexcept
+    {
+        // multiplication with a large odd constant spreads the text ids over the hash range
+        return std::hash<first_t>{}(position.first) * 0x9e3779b97f4a7c15u ^ std::hash<second_t>{}(position.second);
+    }
+};
+
+/*!\brief Search a single query in an index, as given, i.e. without considering the opposite strand.
  * \tparam index_t   Must model seqan3::FmIndex.
  * \tparam queries_t Must be a std::ranges::RandomAccessRange over the index's alphabet.
  * \param[in] index  String index to be searched.
@@ -43,7 +73,7 @@ namespace seqan3::detail
  * specified in `cfg` also has a strong exception guarantee; basic exception guarantee otherwise.
  */
 template <typename index_t, typename query_t, typename configuration_t>
-inline auto search_single(index_t const & index, query_t & query, configuration_t const & cfg)
+inline auto search_single_strand(index_t const & index, query_t & query, configuration_t const & cfg)
 {
     using cfg_t = remove_cvref_t<configuration_t>;
 
@@ -71,11 +101,129 @@ inline auto search_single(index_t const & index, query_t & query, configuration_
     // throw std::invalid_argument("The total number of errors is set to zero while there is a positive number"
     //                             " of errors for a specific error type.");
 
-    // construct internal delegate for collecting hits for later filtering (if necessary)
+    if constexpr (cfg_t::template exists<search_cfg::in_text_verification>())
+    {
+        // The in-text verification cutover matches the whole query with plain edit distance and reports begin
+        // positions in a single text. It can only replace the index traversal when no error type is restricted
+        // below the total, the index is not built over a collection and hits are output as text positions.
+        if constexpr (cfg_t::template exists<search_cfg::output<detail::search_output_text_position>>() &&
+                      !index_t::is_collection)
+        {
+            if (max_error.substitution >= max_error.total && max_error.insertion >= max_error.total &&
+                max_error.deletion >= max_error.total)
+            {
+                max_error.itv_threshold = get<search_cfg::in_text_verification>(cfg).value;
+            }
+        }
+    }
+
+    // streaming mode: hand every hit to the user delegate during the traversal instead of materializing a
+    // hit vector; a delegate returning `true` terminates the search of this query early
+    if constexpr (cfg_t::template exists<search_cfg::on_hit>())
+    {
+        static_assert(!cfg_t::template exists<search_cfg::output<detail::search_output_count>>(),
+                      "The count output cannot be streamed; use the returning search interface instead.");
+
+        constexpr bool output_cursor = cfg_t::template exists<search_cfg::output<detail::search_output_index_cursor>>();
+        constexpr bool single_hit = cfg_t::template exists<search_cfg::mode<detail::search_mode_best>>();
+
+        auto const & on_hit_delegate = get<search_cfg::on_hit>(cfg).value;
+
+        bool stop = false;    // the user delegate requested termination
+        bool any_hit = false; // steers the mode loops below, as the hit vectors do in the returning interface
+
+        // Invokes the user delegate with one output value; delegates returning `void` never request a stop.
+        auto invoke_user_delegate = [&] (auto const & value)
+        {
+            if constexpr (std::is_same_v<decltype(on_hit_delegate(value)), bool>)
+                return on_hit_delegate(value);
+            else
+            {
+                on_hit_delegate(value);
+                return false;
+            }
+        };
+
+        // Translates an internal hit (a cursor, or a text position from the in-text verification) into the
+        // configured output values; returning `true` aborts the index traversal.
+        auto streaming_delegate = [&] (auto const & hit)
+        {
+            if (stop)
+                return true;
+
+            any_hit = true;
+            if constexpr (std::Integral<remove_cvref_t<decltype(hit)>>) // in-text verified text position
+            {
+                if constexpr (!output_cursor) // the verification only runs for the text position output
+                    stop = invoke_user_delegate(hit) || single_hit;
+            }
+            else if constexpr (output_cursor)
+            {
+                stop = invoke_user_delegate(hit) || single_hit;
+            }
+            else
+            {
+                for (auto const & text_pos : hit.locate())
+                {
+                    if (invoke_user_delegate(text_pos) || single_hit)
+                    {
+                        stop = true;
+                        break;
+                    }
+                }
+            }
+            return stop;
+        };
+
+        // The traversal always runs with the abort flag: whether it actually aborts is decided per hit by the
+        // delegate's return value, such that `void` delegates enumerate all hits as the plain modes do.
+        if constexpr (cfg_t::template exists<search_cfg::mode<detail::search_mode_best>>() ||
+                      cfg_t::template exists<search_cfg::mode<detail::search_mode_all_best>>())
+        {
+            detail::search_param max_error2{max_error};
+            max_error2.total = 0;
+            while (!any_hit && max_error2.total <= max_error.total)
+            {
+                detail::search_algo<true>(index, query, max_error2, streaming_delegate);
+                max_error2.total++;
+            }
+        }
+        else if constexpr (cfg_t::template exists<search_cfg::mode<search_cfg::strata>>())
+        {
+            detail::search_param max_error2{max_error};
+            uint8_t const s = get<search_cfg::mode>(cfg).value;
+            uint8_t last_stratum = max_error.total;
+            bool best_stratum_found = false;
+            for (uint8_t total = 0; total <= last_stratum && !stop; ++total)
+            {
+                max_error2.total = total;
+                detail::search_algo_stratum<true>(index, query, max_error2, streaming_delegate);
+                if (!best_stratum_found && any_hit)
+                {
+                    best_stratum_found = true;
+                    last_stratum = total + s;
+                }
+            }
+        }
+        else // detail::search_mode_all
+        {
+            detail::search_algo<true>(index, query, max_error, streaming_delegate);
+        }
+        return;
+    }
+
+    // construct internal delegate for collecting hits for later filtering (if necessary);
+    // in-text verified hits arrive as text positions, all others as cursors.
+    // The text positions can number in the billions on repetitive data, so they are accumulated in a
+    // mapping-backed vector whose growth never reallocates (flat memory curve instead of a 2x spike).
     std::vector<typename index_t::cursor_type> internal_hits;
-    auto internal_delegate = [&internal_hits, &max_error] (auto const & it)
+    mmap_vector<typename index_t::size_type> internal_position_hits;
+    auto internal_delegate = [&internal_hits, &internal_position_hits] (auto const & hit)
     {
-        internal_hits.push_back(it);
+        if constexpr (std::Integral<remove_cvref_t<decltype(hit)>>)
+            internal_position_hits.push_back(hit);
+        else
+            internal_hits.push_back(hit);
     };
 
     // choose mode
@@ -83,7 +231,7 @@ inline auto search_single(index_t const & index, query_t & query, configuration_
     {
         detail::search_param max_error2{max_error};
         max_error2.total = 0;
-        while (internal_hits.empty() && max_error2.total <= max_error.total)
+        while (internal_hits.empty() && internal_position_hits.empty() && max_error2.total <= max_error.total)
         {
             detail::search_algo<true>(index, query, max_error2, internal_delegate);
             max_error2.total++;
@@ -93,7 +241,7 @@ inline auto search_single(index_t const & index, query_t & query, configuration_
     {
         detail::search_param max_error2{max_error};
         max_error2.total = 0;
-        while (internal_hits.empty() && max_error2.total <= max_error.total)
+        while (internal_hits.empty() && internal_position_hits.empty() && max_error2.total <= max_error.total)
         {
             detail::search_algo<false>(index, query, max_error2, internal_delegate);
             max_error2.total++;
@@ -101,19 +249,22 @@ inline auto search_single(index_t const & index, query_t & query, configuration_
     }
     else if constexpr (cfg_t::template exists<search_cfg::mode<search_cfg::strata>>())
     {
+        // The strata are collected in a single sweep over the error counts: every pass only enumerates hits
+        // with exactly `total` errors (using search schemes with matching lower error bounds), i.e. hits of
+        // earlier passes are kept and do not have to be searched again with a higher error bound.
         detail::search_param max_error2{max_error};
-        max_error2.total = 0;
-        while (internal_hits.empty() && max_error2.total <= max_error.total)
-        {
-            detail::search_algo<true>(index, query, max_error2, internal_delegate);
-            max_error2.total++;
-        }
-        if (!internal_hits.empty())
+        uint8_t const s = get<search_cfg::mode>(cfg).value;
+        uint8_t last_stratum = max_error.total; // tightened to `best + s` once the best stratum is known
+        bool best_stratum_found = false;
+        for (uint8_t total = 0; total <= last_stratum; ++total)
         {
-            internal_hits.clear(); // TODO: don't clear when using Optimum Search Schemes with lower error bounds
-            uint8_t const s = get<search_cfg::mode>(cfg).value;
-            max_error2.total += s - 1;
-            detail::search_algo<false>(index, query, max_error2, internal_delegate);
+            max_error2.total = total;
+            detail::search_algo_stratum<false>(index, query, max_error2, internal_delegate);
+            if (!best_stratum_found && (!internal_hits.empty() || !internal_position_hits.empty()))
+            {
+                best_stratum_found = true;
+                last_stratum = total + s; // the strata may exceed the configured total number of errors
+            }
         }
     }
     else // detail::search_mode_all
@@ -123,11 +274,28 @@ inline auto search_single(index_t const & index, query_t & query, configuration_
 
     // TODO: filter hits and only do it when necessary (depending on error types)
 
-    // output cursors or text_positions
+    // output cursors, counts or text_positions
     if constexpr (cfg_t::template exists<search_cfg::output<detail::search_output_index_cursor>>())
     {
         return internal_hits;
     }
+    else if constexpr (cfg_t::template exists<search_cfg::output<detail::search_output_count>>())
+    {
+        typename index_t::size_type count = 0;
+
+        if constexpr (cfg_t::template exists<search_cfg::mode<detail::search_mode_best>>())
+        {
+            // only one hit is reported even if the cursor contains more than one text position
+            count = internal_hits.empty() ? 0 : 1;
+        }
+        else
+        {
+            // the size of a suffix array interval is available without locating any of its text positions
+            for (auto const & cur : internal_hits)
+                count += cur.count();
+        }
+        return count;
+    }
     else
     {
         using hit_t = std::conditional_t<index_t::is_collection,
@@ -143,21 +311,127 @@ inline auto search_single(index_t const & index, query_t & query, configuration_
                 auto text_pos = internal_hits[0].lazy_locate();
                 hits.push_back(text_pos[0]);
             }
+            else if constexpr (!index_t::is_collection)
+            {
+                if (!internal_position_hits.empty())
+                    hits.push_back(internal_position_hits[0]);
+            }
         }
         else
         {
+            // streaming deduplication of text positions: small hit sets are filtered with a linear scan over
+            // the hit vector, beyond that the positions are tracked in a hash set
+            size_t constexpr small_hit_threshold = 16;
+            std::unordered_set<hit_t, search_hit_hash> unique_positions;
+            auto emplace_hit = [&hits, &unique_positions] (hit_t const & text_pos)
+            {
+                if (unique_positions.empty() && hits.size() < small_hit_threshold)
+                {
+                    if (std::find(hits.begin(), hits.end(), text_pos) == hits.end())
+                        hits.push_back(text_pos);
+                    return;
+                }
+
+                if (unique_positions.empty()) // the hit vector outgrew the fast path
+                    unique_positions.insert(hits.begin(), hits.end());
+                if (unique_positions.insert(text_pos).second)
+                    hits.push_back(text_pos);
+            };
+
+            // identical cursors, i.e. redundant suffix array ranges, are suppressed before locating them;
+            // the hash is coarse, equality compares the exact suffix tree node
+            auto cursor_hash = [] (typename index_t::cursor_type const & cur)
+            {
+                return std::hash<size_t>{}((cur.count() << 8) + cur.query_length());
+            };
+            std::unordered_set<typename index_t::cursor_type, decltype(cursor_hash)>
+                unique_cursors{internal_hits.size(), cursor_hash};
+
             for (auto const & cur : internal_hits)
             {
+                if (!unique_cursors.insert(cur).second)
+                    continue;
                 for (auto const & text_pos : cur.locate())
-                    hits.push_back(text_pos);
-                std::sort(hits.begin(), hits.end());
-                hits.erase(std::unique(hits.begin(), hits.end()), hits.end());
+                    emplace_hit(text_pos);
+            }
+            if constexpr (!index_t::is_collection)
+            {
+                // in-text verified hits are already text positions; they may duplicate located ones
+                for (auto const & text_pos : internal_position_hits)
+                    emplace_hit(text_pos);
             }
+            radix_sort(hits); // text positions are (pairs of) unsigned integers; counting passes beat comparisons
         }
         return hits;
     }
 }
 
+/*!\brief Search a single query in an index, on both strands if seqan3::search_cfg::both_strands is present.
+ * \tparam index_t   Must model seqan3::FmIndex.
+ * \tparam queries_t Must be a std::ranges::RandomAccessRange over the index's alphabet.
+ * \param[in] index  String index to be searched.
+ * \param[in] query  A single query.
+ * \param[in] cfg    A configuration object specifying the search parameters.
+ * \returns `True` if and only if `abort_on_hit` is `true` and a hit has been found.
+ *
+ * \details
+ *
+ * The reverse complement strand is covered by a second traversal with the reverse complement of the query,
+ * which is searched as a lazy rank remapping view on the query, i.e. without materializing a reversed copy.
+ * Its hits are begin positions of occurrences of the reverse complement in the indexed text and are reported
+ * together with the hits of the query itself.
+ *
+ * ### Complexity
+ *
+ * \f$O(|query|^e)\f$ where \f$e\f$ is the maximum number of errors.
+ *
+ * ### Exceptions
+ *
+ * Strong exception guarantee if iterating the query does not change its state and if invoking a possible delegate
+ * specified in `cfg` also has a strong exception guarantee; basic exception guarantee otherwise.
+ */
+template <typename index_t, typename query_t, typename configuration_t>
+inline auto search_single(index_t const & index, query_t & query, configuration_t const & cfg)
+{
+    using cfg_t = remove_cvref_t<configuration_t>;
+
+    if constexpr (cfg_t::template exists<search_cfg::both_strands>())
+    {
+        static_assert(NucleotideAlphabet<typename index_t::char_type>,
+                      "Searching both strands requires an index over a nucleotide alphabet.");
+
+        auto rc_query = query | view::reverse_complement;
+
+        if constexpr (cfg_t::template exists<search_cfg::on_hit>()) // streaming mode returns void
+        {
+            search_single_strand(index, query, cfg);
+            search_single_strand(index, rc_query, cfg);
+        }
+        else if constexpr (cfg_t::template exists<search_cfg::output<detail::search_output_count>>())
+        {
+            return search_single_strand(index, query, cfg) + search_single_strand(index, rc_query, cfg);
+        }
+        else
+        {
+            auto hits = search_single_strand(index, query, cfg);
+            auto rc_hits = search_single_strand(index, rc_query, cfg);
+            hits.insert(hits.end(), rc_hits.begin(), rc_hits.end());
+            if constexpr (!cfg_t::template exists<search_cfg::output<detail::search_output_index_cursor>>())
+            {
+                // a palindromic query finds every occurrence on both strands; such text positions are
+                // deduplicated (both per strand vectors are already sorted and duplicate free)
+                radix_sort(hits);
+                hits.erase(std::unique(hits.begin(), hits.end()), hits.end());
+            }
+            return hits;
+        }
+    }
+    else
+    {
+        return search_single_strand(index, query, cfg);
+    }
+}
+
 /*!\brief Search a query or a range of queries in an index.
  * \tparam index_t    Must model seqan3::FmIndex.
  * \tparam queries_t  Must be a std::ranges::RandomAccessRange over the index's alphabet.
@@ -167,6 +441,11 @@ inline auto search_single(index_t const & index, query_t & query, configuration_
  * \param[in] cfg     A configuration object specifying the search parameters.
  * \returns `True` if and only if `abort_on_hit` is `true` and a hit has been found.
  *
+ * \details
+ *
+ * If the configuration contains seqan3::search_cfg::parallel, a random access range of queries is distributed
+ * over the specified number of threads, all of which search the shared (read-only) index concurrently.
+ *
  * ### Complexity
  *
  * Each query takes \f$O(|query|^e)\f$ where \f$e\f$ is the maximum number of errors.
@@ -180,7 +459,7 @@ template <typename index_t, typename queries_t, typename configuration_t>
 inline auto search_all(index_t const & index, queries_t & queries, configuration_t const & cfg)
 {
     using cfg_t = remove_cvref_t<configuration_t>;
-    // return type: for each query: a vector of text_positions (or cursors)
+    // return type: for each query: a vector of text_positions (or cursors) or a single hit count
     // delegate params: text_position (or cursor). we will withhold all hits of one query anyway to filter
     //                  duplicates. more efficient to call delegate once with one vector instead of calling
     //                  delegate for each hit separately at once.
@@ -190,21 +469,62 @@ inline auto search_all(index_t const & index, queries_t & queries, configuration
     using hit_t = std::conditional_t<cfg_t::template exists<search_cfg::output<detail::search_output_index_cursor>>(),
                                      typename index_t::cursor_type,
                                      text_pos_t>;
+    // for the count output a single number is reported per query instead of a vector of hits
+    using query_result_t = std::conditional_t<cfg_t::template exists<search_cfg::output<detail::search_output_count>>(),
+                                              typename index_t::size_type,
+                                              std::vector<hit_t>>;
 
     if constexpr (std::ranges::ForwardRange<queries_t> && std::ranges::RandomAccessRange<value_type_t<queries_t>>)
     {
-        // TODO: if constexpr (contains<search_cfg::id::on_hit>(cfg))
-        std::vector<std::vector<hit_t>> hits;
-        hits.reserve(std::distance(queries.begin(), queries.end()));
-        for (auto const query : queries)
+        // streaming mode returns void: the queries are searched one after another and the hits are handed to
+        // the delegate during the traversal (see search_single)
+        if constexpr (cfg_t::template exists<search_cfg::on_hit>())
         {
-            hits.push_back(search_single(index, query, cfg));
+            for (auto const query : queries)
+                search_single(index, query, cfg);
+            return;
+        }
+        else if constexpr (cfg_t::template exists<search_cfg::parallel>() && std::ranges::RandomAccessRange<queries_t>)
+        {
+            // The queries are embarrassingly parallel: the index is shared read-only and every thread writes
+            // the hits of its queries into preallocated slots of the result vector, hence no synchronisation
+            // is needed.
+            size_t const query_count = std::ranges::size(queries);
+            size_t const thread_count = std::min<size_t>(std::max<uint32_t>(get<search_cfg::parallel>(cfg).value, 1u),
+                                                         std::max<size_t>(query_count, 1u));
+            std::vector<query_result_t> hits(query_count);
+
+            auto search_slice = [&] (size_t const first, size_t const last)
+            {
+                for (size_t i = first; i < last; ++i)
+                    hits[i] = search_single(index, queries[i], cfg);
+            };
+
+            size_t const queries_per_thread = (query_count + thread_count - 1) / thread_count;
+            std::vector<std::thread> threads;
+            threads.reserve(thread_count - 1);
+            for (size_t t = 1; t < thread_count; ++t)
+                threads.emplace_back(search_slice, t * queries_per_thread,
+                                     std::min((t + 1) * queries_per_thread, query_count));
+            search_slice(0, std::min(queries_per_thread, query_count)); // the calling thread handles the first slice
+            for (std::thread & thread : threads)
+                thread.join();
+            return hits;
+        }
+        else
+        {
+            std::vector<query_result_t> hits;
+            hits.reserve(std::distance(queries.begin(), queries.end()));
+            for (auto const query : queries)
+            {
+                hits.push_back(search_single(index, query, cfg));
+            }
+            return hits;
         }
-        return hits;
     }
     else // std::ranges::RandomAccessRange<queries_t>
     {
-        // TODO: if constexpr (contains<search_cfg::id::on_hit>(cfg))
+        // search_single handles a possible on_hit delegate itself and returns void in that case
         return search_single(index, queries, cfg);
     }
 }
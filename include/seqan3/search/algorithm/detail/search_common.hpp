@@ -13,10 +13,33 @@
 #pragma once
 
 #include <type_traits>
+#include <utility>
 
 namespace seqan3::detail
 {
 
+/*!\brief Invokes a hit delegate and translates its result into the abort signal of the search algorithms.
+ * \tparam delegate_t The type of the delegate.
+ * \tparam hit_t      The type of the reported hit (a cursor or a text position).
+ * \param[in] delegate The delegate to invoke.
+ * \param[in] hit      The hit to report.
+ * \returns Whether an abort flagged traversal shall abort: the result of a `bool` returning delegate, `true`
+ *          for all other delegates (i.e. such traversals abort on the first hit as before).
+ */
+template <typename delegate_t, typename hit_t>
+constexpr bool delegate_requests_abort(delegate_t && delegate, hit_t && hit)
+{
+    if constexpr (std::is_same_v<decltype(delegate(std::forward<hit_t>(hit))), bool>)
+    {
+        return delegate(std::forward<hit_t>(hit));
+    }
+    else
+    {
+        delegate(std::forward<hit_t>(hit));
+        return true;
+    }
+}
+
 //!\brief Object grouping numbers of errors for different kind of error types.
 struct search_param
 {
@@ -28,6 +51,10 @@ struct search_param
     uint8_t insertion;
     //!\brief Total number of deletion errors.
     uint8_t deletion;
+    /*!\brief Suffix array interval size at which the search scheme algorithm switches to in-text verification.
+     *        A value of 0 disables the cutover (see seqan3::detail::in_text_verification).
+     */
+    size_t itv_threshold = 0;
 };
 
 } // namespace seqan3::detail
@@ -15,7 +15,9 @@
 #include <type_traits>
 
 #include <seqan3/core/metafunction/transformation_trait_or.hpp>
+#include <seqan3/core/tracing.hpp>
 #include <seqan3/range/view/slice.hpp>
+#include <seqan3/search/algorithm/detail/in_text_verification.hpp>
 #include <seqan3/search/algorithm/detail/search_common.hpp>
 #include <seqan3/search/algorithm/detail/search_scheme_precomputed.hpp>
 #include <seqan3/search/algorithm/detail/search_trivial.hpp>
@@ -125,11 +127,12 @@ inline auto search_scheme_block_info(search_scheme_t const & search_scheme, size
 //!\cond
 // forward declaration
 template <bool abort_on_hit, typename cursor_t, typename query_t, typename search_t, typename blocks_length_t,
-          typename delegate_t>
-inline bool search_ss(cursor_t cur, query_t & query,
+          typename itv_t, typename delegate_t>
+inline bool search_ss(cursor_t const & cur, query_t & query,
                       typename cursor_t::size_type const lb, typename cursor_t::size_type const rb,
                       uint8_t const errors_spent, uint8_t const block_id, bool const go_right, search_t const & search,
-                      blocks_length_t const & blocks_length, search_param const error_left, delegate_t && delegate);
+                      blocks_length_t const & blocks_length, search_param const error_left, itv_t const & itv,
+                      delegate_t && delegate);
 //!\endcond
 
 /*!\brief Searches a query sequence in a bidirectional index using a single search of a search scheme.
@@ -139,8 +142,11 @@ inline bool search_ss(cursor_t cur, query_t & query,
  * \tparam query_t          Must be a std::ranges::RandomAccessRange over the index's alphabet of the cursor.
  * \tparam search_t         Is of type `seqan3::detail::search<>` or `seqan3::detail::search_dyn<>`.
  * \tparam blocks_length_t  Is of type `std::array` or `std::vector` of unsigned integers.
+ * \tparam itv_t            Is of type `seqan3::detail::search_itv<>` or `seqan3::detail::search_itv_off`.
  * \tparam delegate_t       Takes `cursor_t` as argument.
- * \param[in] cur           Cursor of a string index built on the text that will be searched.
+ * \param[in] cur           Cursor of a string index built on the text that will be searched. The cursors are
+ *                          passed by reference along the recursion and copied exactly once per branching
+ *                          point, right before the copy is modified.
  * \param[in] query         Query sequence to be searched.
  * \param[in] lb            Left bound of the infix of `query` already searched (exclusive).
  * \param[in] rb            Right bound of the infix of `query` already searched (exclusive).
@@ -150,6 +156,7 @@ inline bool search_ss(cursor_t cur, query_t & query,
  * \param[in] search        Search of a search scheme to be used for searching.
  * \param[in] blocks_length Cumulative block lengths of the search.
  * \param[in] error_left    Number of errors left for matching the remaining suffix of the query sequence.
+ * \param[in] itv           Parameters of the in-text verification cutover.
  * \param[in] delegate      Function that is called on every hit.
  * \returns `True` if and only if `abort_on_hit` is true and a hit has been found.
  *
@@ -163,28 +170,29 @@ inline bool search_ss(cursor_t cur, query_t & query,
  * strong exception guarantee; basic exception guarantee otherwise.
  */
 template <bool abort_on_hit, typename cursor_t, typename query_t, typename search_t, typename blocks_length_t,
-          typename delegate_t>
-inline bool search_ss_exact(cursor_t cur, query_t & query,
+          typename itv_t, typename delegate_t>
+inline bool search_ss_exact(cursor_t const & cur, query_t & query,
                             typename cursor_t::size_type const lb, typename cursor_t::size_type const rb,
                             uint8_t const errors_spent, uint8_t const block_id, bool const go_right,
                             search_t const & search, blocks_length_t const & blocks_length,
-                            search_param const error_left, delegate_t && delegate)
+                            search_param const error_left, itv_t const & itv, delegate_t && delegate)
 {
     using size_type = typename cursor_t::size_type;
 
     uint8_t const block_id2 = std::min<uint8_t>(block_id + 1, search.blocks() - 1);
     bool const go_right2 = (block_id < search.blocks() - 1) && (search.pi[block_id + 1] > search.pi[block_id]);
 
+    cursor_t extended_cur{cur};
     if (go_right)
     {
         size_type const infix_lb = rb - 1; // inclusive
         size_type const infix_rb = lb + blocks_length[block_id] - 1; // exclusive
 
-        if (!cur.extend_right(query | view::slice(infix_lb, infix_rb + 1)))
+        if (!extended_cur.extend_right(query | view::slice(infix_lb, infix_rb + 1)))
             return false;
 
-        if (search_ss<abort_on_hit>(cur, query, lb, infix_rb + 2, errors_spent, block_id2, go_right2, search,
-                                    blocks_length, error_left, delegate) && abort_on_hit)
+        if (search_ss<abort_on_hit>(extended_cur, query, lb, infix_rb + 2, errors_spent, block_id2, go_right2, search,
+                                    blocks_length, error_left, itv, delegate) && abort_on_hit)
         {
             return true;
         }
@@ -194,11 +202,11 @@ inline bool search_ss_exact(cursor_t cur, query_t & query,
         size_type const infix_lb = rb - blocks_length[block_id] - 1; // inclusive
         size_type const infix_rb = lb - 1; // inclusive
 
-        if (!cur.extend_left(query | view::slice(infix_lb, infix_rb + 1)))
+        if (!extended_cur.extend_left(query | view::slice(infix_lb, infix_rb + 1)))
             return false;
 
-        if (search_ss<abort_on_hit>(cur, query, infix_lb, rb, errors_spent, block_id2, go_right2, search, blocks_length,
-                                    error_left, delegate) && abort_on_hit)
+        if (search_ss<abort_on_hit>(extended_cur, query, infix_lb, rb, errors_spent, block_id2, go_right2, search,
+                                    blocks_length, error_left, itv, delegate) && abort_on_hit)
         {
             return true;
         }
@@ -212,12 +220,12 @@ inline bool search_ss_exact(cursor_t cur, query_t & query,
  * \copydetails search_ss_exact
  */
 template <bool abort_on_hit, typename cursor_t, typename query_t, typename search_t, typename blocks_length_t,
-          typename delegate_t>
-inline bool search_ss_deletion(cursor_t cur, query_t & query,
+          typename itv_t, typename delegate_t>
+inline bool search_ss_deletion(cursor_t const & cur, query_t & query,
                                typename cursor_t::size_type const lb, typename cursor_t::size_type const rb,
                                uint8_t const errors_spent, uint8_t const block_id, bool const go_right,
                                search_t const & search, blocks_length_t const & blocks_length,
-                               search_param const error_left, delegate_t && delegate)
+                               search_param const error_left, itv_t const & itv, delegate_t && delegate)
 {
     uint8_t const max_error_left_in_block = search.u[block_id] - errors_spent;
     uint8_t const min_error_left_in_block = std::max(search.l[block_id] - errors_spent, 0);
@@ -229,7 +237,7 @@ inline bool search_ss_deletion(cursor_t cur, query_t & query,
         bool const go_right2 = search.pi[block_id2] > search.pi[block_id2 - 1];
 
         if (search_ss<abort_on_hit>(cur, query, lb, rb, errors_spent, block_id2, go_right2, search, blocks_length,
-                                    error_left, delegate) && abort_on_hit)
+                                    error_left, itv, delegate) && abort_on_hit)
         {
             return true;
         }
@@ -240,20 +248,24 @@ inline bool search_ss_deletion(cursor_t cur, query_t & query,
     // Do not allow deletions at the end of the rightmost block
     if (!(search.pi[block_id] == 1 && !go_right) &&
         !(search.pi[block_id] == search.blocks() && go_right) &&
-        max_error_left_in_block > 0 && error_left.total > 0 && error_left.deletion > 0 &&
-        ((go_right && cur.extend_right()) || (!go_right && cur.extend_left())))
+        max_error_left_in_block > 0 && error_left.total > 0 && error_left.deletion > 0)
     {
-        search_param error_left2{error_left};
-        error_left2.total--;
-        error_left2.deletion--;
-        do
+        cursor_t child_cur{cur};
+        if ((go_right && child_cur.extend_right()) || (!go_right && child_cur.extend_left()))
         {
-            if (search_ss_deletion<abort_on_hit>(cur, query, lb, rb, errors_spent + 1, block_id, go_right, search,
-                                                 blocks_length, error_left2, delegate) && abort_on_hit)
+            search_param error_left2{error_left};
+            error_left2.total--;
+            error_left2.deletion--;
+            do
             {
-                return true;
-            }
-        } while ((go_right && cur.cycle_back()) || (!go_right && cur.cycle_front()));
+                if (search_ss_deletion<abort_on_hit>(child_cur, query, lb, rb, errors_spent + 1, block_id, go_right,
+                                                     search, blocks_length, error_left2, itv, delegate) &&
+                    abort_on_hit)
+                {
+                    return true;
+                }
+            } while ((go_right && child_cur.cycle_back()) || (!go_right && child_cur.cycle_front()));
+        }
     }
     return false;
 }
@@ -266,16 +278,17 @@ inline bool search_ss_deletion(cursor_t cur, query_t & query,
  * \param[in] min_error_left_in_block Number of remaining errors that need to be spent in the current block.
  */
 template <bool abort_on_hit, typename cursor_t, typename query_t, typename search_t, typename blocks_length_t,
-          typename delegate_t>
-inline bool search_ss_children(cursor_t cur, query_t & query,
+          typename itv_t, typename delegate_t>
+inline bool search_ss_children(cursor_t const & cur, query_t & query,
                                typename cursor_t::size_type const lb, typename cursor_t::size_type const rb,
                                uint8_t const errors_spent, uint8_t const block_id, bool const go_right,
                                uint8_t const min_error_left_in_block, search_t const & search,
                                blocks_length_t const & blocks_length, search_param const error_left,
-                               delegate_t && delegate)
+                               itv_t const & itv, delegate_t && delegate)
 {
     using size_type = typename cursor_t::size_type;
-    if ((go_right && cur.extend_right()) || (!go_right && cur.extend_left()))
+    cursor_t child_cur{cur};
+    if ((go_right && child_cur.extend_right()) || (!go_right && child_cur.extend_left()))
     {
         size_type const chars_left = blocks_length[block_id] - (rb - lb - 1);
 
@@ -284,7 +297,7 @@ inline bool search_ss_children(cursor_t cur, query_t & query,
 
         do
         {
-            bool const delta = cur.last_char() != query[(go_right ? rb : lb) - 1];
+            bool const delta = child_cur.last_char() != query[(go_right ? rb : lb) - 1];
 
             // skip if there are more min errors left in the current block than characters in the block
             // i.e. chars_left - 1 < min_error_left_in_block - delta
@@ -306,8 +319,9 @@ inline bool search_ss_children(cursor_t cur, query_t & query,
                     // Thus do not change the direction (go_right) yet.
                     if (error_left.deletion > 0)
                     {
-                        if (search_ss_deletion<abort_on_hit>(cur, query, lb2, rb2, errors_spent + delta, block_id,
-                                                             go_right, search, blocks_length, error_left2, delegate) &&
+                        if (search_ss_deletion<abort_on_hit>(child_cur, query, lb2, rb2, errors_spent + delta, block_id,
+                                                             go_right, search, blocks_length, error_left2, itv,
+                                                             delegate) &&
                             abort_on_hit)
                         {
                             return true;
@@ -318,8 +332,8 @@ inline bool search_ss_children(cursor_t cur, query_t & query,
                         uint8_t const block_id2 = std::min<uint8_t>(block_id + 1, search.blocks() - 1);
                         bool const go_right2 = search.pi[block_id2] > search.pi[block_id2 - 1];
 
-                        if (search_ss<abort_on_hit>(cur, query, lb2, rb2, errors_spent + delta, block_id2, go_right2,
-                                                    search, blocks_length, error_left2, delegate) &&
+                        if (search_ss<abort_on_hit>(child_cur, query, lb2, rb2, errors_spent + delta, block_id2,
+                                                    go_right2, search, blocks_length, error_left2, itv, delegate) &&
                             abort_on_hit)
                         {
                             return true;
@@ -328,8 +342,8 @@ inline bool search_ss_children(cursor_t cur, query_t & query,
                 }
                 else
                 {
-                    if (search_ss<abort_on_hit>(cur, query, lb2, rb2, errors_spent + delta, block_id, go_right, search,
-                                                blocks_length, error_left2, delegate) && abort_on_hit)
+                    if (search_ss<abort_on_hit>(child_cur, query, lb2, rb2, errors_spent + delta, block_id, go_right,
+                                                search, blocks_length, error_left2, itv, delegate) && abort_on_hit)
                     {
                         return true;
                     }
@@ -347,10 +361,10 @@ inline bool search_ss_children(cursor_t cur, query_t & query,
                 search_param error_left3{error_left};
                 error_left3.total--;
                 error_left3.deletion--;
-                search_ss<abort_on_hit>(cur, query, lb, rb, errors_spent + 1, block_id, go_right, search, blocks_length,
-                                        error_left3, delegate);
+                search_ss<abort_on_hit>(child_cur, query, lb, rb, errors_spent + 1, block_id, go_right, search,
+                                        blocks_length, error_left3, itv, delegate);
             }
-        } while ((go_right && cur.cycle_back()) || (!go_right && cur.cycle_front()));
+        } while ((go_right && child_cur.cycle_back()) || (!go_right && child_cur.cycle_front()));
     }
     return false;
 }
@@ -360,27 +374,38 @@ inline bool search_ss_children(cursor_t cur, query_t & query,
  * \copydetails search_ss_exact
  */
 template <bool abort_on_hit, typename cursor_t, typename query_t, typename search_t,
-          typename blocks_length_t, typename delegate_t>
-inline bool search_ss(cursor_t cur, query_t & query,
+          typename blocks_length_t, typename itv_t, typename delegate_t>
+inline bool search_ss(cursor_t const & cur, query_t & query,
                       typename cursor_t::size_type const lb, typename cursor_t::size_type const rb,
                       uint8_t const errors_spent, uint8_t const block_id, bool const go_right, search_t const & search,
-                      blocks_length_t const & blocks_length, search_param const error_left, delegate_t && delegate)
+                      blocks_length_t const & blocks_length, search_param const error_left, itv_t const & itv,
+                      delegate_t && delegate)
 {
     uint8_t const max_error_left_in_block = search.u[block_id] - errors_spent;
     uint8_t const min_error_left_in_block = std::max(search.l[block_id] - errors_spent, 0); // NOTE: changed
 
     // Done.
     if (min_error_left_in_block == 0 && lb == 0 && rb == std::ranges::size(query) + 1)
+        return delegate_requests_abort(delegate, cur);
+
+    // In-text verification: few enough candidates left that locating them and finishing the match directly
+    // in the text is cheaper than continuing the index traversal. The hits are reported as text positions.
+    if constexpr (!std::Same<itv_t, search_itv_off>)
     {
-        delegate(cur);
-        return true;
+        if (cur.count() <= itv.threshold)
+        {
+            return in_text_verification<abort_on_hit>(cur, query, lb,
+                                                      static_cast<uint8_t>(errors_spent + error_left.total),
+                                                      itv.text, delegate);
+        }
     }
+
     // Exact search in current block.
-    else if (((max_error_left_in_block == 0) && (rb - lb - 1 != blocks_length[block_id])) ||
-             (error_left.total == 0 && min_error_left_in_block == 0))
+    if (((max_error_left_in_block == 0) && (rb - lb - 1 != blocks_length[block_id])) ||
+        (error_left.total == 0 && min_error_left_in_block == 0))
     {
         if (search_ss_exact<abort_on_hit>(cur, query, lb, rb, errors_spent, block_id, go_right, search, blocks_length,
-                                          error_left, delegate) && abort_on_hit)
+                                          error_left, itv, delegate) && abort_on_hit)
         {
             return true;
         }
@@ -409,7 +434,7 @@ inline bool search_ss(cursor_t cur, query_t & query,
                 // it pay off the additional complexity and documentation for the user? (Note that the user might only
                 // allow for insertions and deletion and not for mismatches).
                 if (search_ss_deletion<abort_on_hit>(cur, query, lb2, rb2, errors_spent + 1, block_id, go_right, search,
-                                                     blocks_length, error_left2, delegate) && abort_on_hit)
+                                                     blocks_length, error_left2, itv, delegate) && abort_on_hit)
                 {
                     return true;
                 }
@@ -417,14 +442,15 @@ inline bool search_ss(cursor_t cur, query_t & query,
             else
             {
                 if (search_ss<abort_on_hit>(cur, query, lb2, rb2, errors_spent + 1, block_id, go_right, search,
-                                            blocks_length, error_left2, delegate) && abort_on_hit)
+                                            blocks_length, error_left2, itv, delegate) && abort_on_hit)
                 {
                     return true;
                 }
             }
         }
         if (search_ss_children<abort_on_hit>(cur, query, lb, rb, errors_spent, block_id, go_right,
-                                             min_error_left_in_block, search, blocks_length, error_left, delegate) &&
+                                             min_error_left_in_block, search, blocks_length, error_left, itv,
+                                             delegate) &&
             abort_on_hit)
         {
             return true;
@@ -458,9 +484,21 @@ template <bool abort_on_hit, typename index_t, typename query_t, typename search
 inline void search_ss(index_t const & index, query_t & query, search_param const error_left,
                       search_scheme_t const & search_scheme, delegate_t && delegate)
 {
+    SEQAN3_TRACE_SCOPE("search::search_scheme");
+
     // retrieve cumulative block lengths and starting position
     auto const block_info = search_scheme_block_info(search_scheme, std::ranges::size(query));
 
+    // the in-text verification cutover reports begin positions in a single text; collections always
+    // traverse the index to the end of the query
+    auto const itv = [&] ()
+    {
+        if constexpr (index_t::is_collection)
+            return search_itv_off{};
+        else
+            return search_itv{in_text_verification_access::text(index), error_left.itv_threshold};
+    }();
+
     for (uint8_t search_id = 0; search_id < search_scheme.size(); ++search_id)
     {
         auto const & search = search_scheme[search_id];
@@ -476,6 +514,7 @@ inline void search_ss(index_t const & index, query_t & query, search_param const
                              true,                     // search the first block from left to right
                              search, blocks_length,     // search scheme information
                              error_left,               // errors left (broken down by error types)
+                             itv,                      // in-text verification cutover parameters
                              delegate                  // delegate function called on hit
                          );
 
@@ -484,6 +523,87 @@ inline void search_ss(index_t const & index, query_t & query, search_param const
     }
 }
 
+/*!\brief Searches a query sequence in a bidirectional index using search schemes, starting from a
+ *        precomputed k-mer table where possible.
+ * \tparam abort_on_hit     If the flag is set, the search aborts on the first hit.
+ * \tparam index_t          Must model seqan3::BiFmIndex.
+ * \tparam query_t          Must be a std::ranges::RandomAccessRange over the index's alphabet.
+ * \tparam search_scheme_t  Is of type `seqan3::detail::search_scheme_type` or `seqan3::detail::search_scheme_dyn_type`.
+ * \tparam delegate_t       Takes `typename index_t::cursor_type` as argument.
+ * \param[in] index         String index built on the text that will be searched.
+ * \param[in] table         K-mer table precomputed for `index`.
+ * \param[in] query         Query sequence to be searched in the index.
+ * \param[in] error_left    Number of errors left for matching the remaining suffix of the query sequence.
+ * \param[in] search_scheme Search scheme to be used for searching.
+ * \param[in] delegate      Function that is called on every hit.
+ *
+ * \details
+ *
+ * Every search of a scheme extends its first block to the right. If that block must match exactly
+ * (`u[0] == 0`) and is longer than the stored k-mers, the cursor is initialised at depth k via the table
+ * instead of extending character by character from the root; searches allowing errors in the first block
+ * start at the root as before.
+ *
+ * ### Complexity
+ *
+ * \f$O(|query|^e)\f$ where \f$e\f$ is the total number of maximum errors.
+ *
+ * ### Exceptions
+ *
+ * Strong exception guarantee if iterating the query does not change its state and if invoking the delegate also has a
+ * strong exception guarantee; basic exception guarantee otherwise.
+ */
+template <bool abort_on_hit, typename index_t, typename query_t, typename search_scheme_t, typename delegate_t>
+inline void search_ss(index_t const & index, fm_index_kmer_table<index_t> const & table, query_t & query,
+                      search_param const error_left, search_scheme_t const & search_scheme, delegate_t && delegate)
+{
+    SEQAN3_TRACE_SCOPE("search::search_scheme");
+
+    using size_type = typename index_t::size_type;
+
+    // retrieve cumulative block lengths and starting position
+    auto const block_info = search_scheme_block_info(search_scheme, std::ranges::size(query));
+
+    size_type const kmer_size = table.kmer_size();
+
+    auto const itv = [&] ()
+    {
+        if constexpr (index_t::is_collection)
+            return search_itv_off{};
+        else
+            return search_itv{in_text_verification_access::text(index), error_left.itv_threshold};
+    }();
+
+    for (uint8_t search_id = 0; search_id < search_scheme.size(); ++search_id)
+    {
+        auto const & search = search_scheme[search_id];
+        auto const & [blocks_length, start_pos] = block_info[search_id];
+
+        bool hit = false;
+
+        if (search.u[0] == 0 && kmer_size < blocks_length[0])
+        {
+            // The first k characters of the first block must match exactly; jump to depth k via the table.
+            // Note that the cursor remains inside of the first block, such that the recursion continues with
+            // the same block id and direction as after k single character extensions.
+            auto cur = table.cursor(query | view::slice(start_pos, start_pos + kmer_size));
+            if (!cur.has_value()) // The k-mer does not occur in the text; this search cannot find anything.
+                continue;
+
+            hit = search_ss<abort_on_hit>(*cur, query, start_pos, start_pos + kmer_size + 1, 0, 0, true,
+                                          search, blocks_length, error_left, itv, delegate);
+        }
+        else
+        {
+            hit = search_ss<abort_on_hit>(index.begin(), query, start_pos, start_pos + 1, 0, 0, true,
+                                          search, blocks_length, error_left, itv, delegate);
+        }
+
+        if (abort_on_hit && hit)
+            return;
+    }
+}
+
 /*!\brief Searches a query sequence in a bidirectional index.
  * \tparam abort_on_hit    If the flag is set, the search aborts on the first hit.
  * \tparam index_t         Must model seqan3::BiFmIndex.
@@ -521,6 +641,12 @@ inline void search_algo_bi(index_t const & index, query_t & query, search_param
         case 3:
             search_ss<abort_on_hit>(index, query, error_left, optimum_search_scheme<0, 3>, delegate);
             break;
+        case 4:
+            search_ss<abort_on_hit>(index, query, error_left, optimum_search_scheme<0, 4>, delegate);
+            break;
+        case 5:
+            search_ss<abort_on_hit>(index, query, error_left, optimum_search_scheme<0, 5>, delegate);
+            break;
         default:
             auto const & search_scheme{compute_ss(0, error_left.total)};
             search_ss<abort_on_hit>(index, query, error_left, search_scheme, delegate);
@@ -528,6 +654,42 @@ inline void search_algo_bi(index_t const & index, query_t & query, search_param
     }
 }
 
+/*!\brief Searches a query sequence in a bidirectional index, only reporting hits with exactly `error_left.total`
+ *        errors.
+ *
+ * \copydetails search_algo_bi
+ *
+ * \details
+ *
+ * Uses search schemes whose lower error bound equals the upper bound, i.e. hits with fewer errors are not
+ * enumerated again. The strata mode builds on this to collect the strata of a query in a single sweep over
+ * the error counts instead of rerunning the search with a higher error bound from scratch.
+ */
+template <bool abort_on_hit, typename index_t, typename query_t, typename delegate_t>
+inline void search_algo_bi_stratum(index_t const & index, query_t & query, search_param const error_left,
+                                   delegate_t && delegate)
+{
+    switch (error_left.total)
+    {
+        case 0:
+            search_ss<abort_on_hit>(index, query, error_left, optimum_search_scheme<0, 0>, delegate);
+            break;
+        case 1:
+            search_ss<abort_on_hit>(index, query, error_left, optimum_search_scheme<1, 1>, delegate);
+            break;
+        case 2:
+            search_ss<abort_on_hit>(index, query, error_left, optimum_search_scheme<2, 2>, delegate);
+            break;
+        case 3:
+            search_ss<abort_on_hit>(index, query, error_left, optimum_search_scheme<3, 3>, delegate);
+            break;
+        default:
+            auto const & search_scheme{compute_ss(error_left.total, error_left.total)};
+            search_ss<abort_on_hit>(index, query, error_left, search_scheme, delegate);
+            break;
+    }
+}
+
 /*!\brief Searches a query sequence in a unidirectional index.
  *
  * \copydetails search_algo_bi
@@ -552,6 +714,26 @@ inline void search_algo(index_t const & index, query_t & query, search_param con
         search_algo_uni<abort_on_hit>(index, query, error_left, delegate);
 }
 
+/*!\brief Searches a query sequence in an index, only reporting hits with exactly `error_left.total` errors.
+ *
+ * \copydetails search_algo_bi_stratum
+ *
+ * \details
+ *
+ * On a unidirectional index the lower error bound cannot be enforced by the trivial backtracking, i.e. hits of
+ * lower strata are reported again. Callers have to be able to cope with these duplicates (e.g. by filtering
+ * text positions).
+ */
+template <bool abort_on_hit, typename index_t, typename query_t, typename delegate_t>
+inline void search_algo_stratum(index_t const & index, query_t & query, search_param const error_left,
+                                delegate_t && delegate)
+{
+    if constexpr (BiFmIndex<index_t>)
+        search_algo_bi_stratum<abort_on_hit>(index, query, error_left, delegate);
+    else
+        search_trivial<abort_on_hit>(index, query, error_left, delegate);
+}
+
 //!\}
 
 } // namespace seqan3::detail
@@ -163,8 +163,36 @@ inline search_scheme_type<4, 5> constexpr optimum_search_scheme<3, 3>
     {{1, 2, 3, 4, 5}, {0, 0, 0, 0, 3}, {0, 2, 2, 3, 3}}
 }};
 
+// The schemes for 4 and 5 errors have not been proven to be optimal (the computation has not finished yet).
+// They are complete and disjoint (i.e. every error distribution is covered by exactly one search, see the
+// corresponding unit tests) and have been computed with a greedy set cover over all error distributions,
+// restricting each search to an exact first block. They are to be replaced as soon as the computation of the
+// optimum search schemes has finished.
+
+template <>
+inline search_scheme_type<5, 5> constexpr optimum_search_scheme<0, 4>
+{{
+    {{5, 4, 3, 2, 1}, {0, 0, 0, 3, 4}, {0, 1, 2, 3, 4}},
+    {{4, 3, 2, 1, 5}, {0, 0, 2, 3, 3}, {0, 1, 2, 4, 4}},
+    {{3, 2, 1, 4, 5}, {0, 1, 2, 2, 2}, {0, 1, 4, 4, 4}},
+    {{1, 2, 3, 4, 5}, {0, 0, 0, 0, 0}, {0, 4, 4, 4, 4}},
+    {{2, 1, 3, 4, 5}, {0, 1, 1, 1, 1}, {0, 4, 4, 4, 4}}
+}};
+
+template <>
+inline search_scheme_type<6, 6> constexpr optimum_search_scheme<0, 5>
+{{
+    {{6, 5, 4, 3, 2, 1}, {0, 0, 0, 0, 4, 5}, {0, 1, 2, 3, 4, 5}},
+    {{5, 4, 3, 2, 1, 6}, {0, 0, 0, 3, 4, 4}, {0, 1, 2, 3, 5, 5}},
+    {{4, 3, 2, 1, 5, 6}, {0, 0, 2, 3, 3, 3}, {0, 1, 2, 5, 5, 5}},
+    {{3, 2, 1, 4, 5, 6}, {0, 1, 2, 2, 2, 2}, {0, 1, 5, 5, 5, 5}},
+    {{1, 2, 3, 4, 5, 6}, {0, 0, 0, 0, 0, 0}, {0, 5, 5, 5, 5, 5}},
+    {{2, 1, 3, 4, 5, 6}, {0, 1, 1, 1, 1, 1}, {0, 5, 5, 5, 5, 5}}
+}};
+
 // TODO: add the following missing optimum search schemes (computation has not finished yet)
 // optimum_search_scheme<i, 4>, 0 < i <= 4
+// optimum_search_scheme<i, 5>, 0 < i <= 5
 
 //!\endcond
 
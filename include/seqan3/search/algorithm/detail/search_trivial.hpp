@@ -17,6 +17,7 @@
 
 #include <seqan3/range/concept.hpp>
 #include <seqan3/search/algorithm/detail/search_common.hpp>
+#include <seqan3/search/fm_index/fm_index_kmer_table.hpp>
 #include <seqan3/std/ranges>
 
 namespace seqan3::detail
@@ -31,7 +32,9 @@ namespace seqan3::detail
  * \tparam cursor_t      Must model seqan3::FmIndexCursor.
  * \tparam query_t       Must be a std::ranges::InputRange over the index's alphabet.
  * \tparam delegate_t    Takes `index::cursor_type` as argument.
- * \param[in] cur        Cursor of atring index built on the text that will be searched.
+ * \param[in] cur        Cursor of a string index built on the text that will be searched. The cursor is passed
+ *                       by reference along the recursion and copied exactly once per branching point, right
+ *                       before the copy is modified.
  * \param[in] query      Query sequence to be searched with the cursor.
  * \param[in] query_pos  Position in the query sequence indicating the prefix that has already been searched.
  * \param[in] error_left Number of errors left for matching the remaining suffix of the query sequence.
@@ -47,18 +50,19 @@ namespace seqan3::detail
  * No-throw guarantee if invoking the delegate also guarantees no-throw.
  */
 template <bool abort_on_hit, typename query_t, typename cursor_t, typename delegate_t>
-inline bool search_trivial(cursor_t cur, query_t & query, typename cursor_t::size_type const query_pos,
+inline bool search_trivial(cursor_t const & cur, query_t & query, typename cursor_t::size_type const query_pos,
                            search_param const error_left, delegate_t && delegate) noexcept(noexcept(delegate))
 {
     // Exact case (end of query sequence or no errors left)
     if (query_pos == std::ranges::size(query) || error_left.total == 0)
     {
+        if (query_pos == std::ranges::size(query))
+            return delegate_requests_abort(delegate, cur);
+
         // If not at end of query sequence, try searching the remaining suffix without any errors.
-        if (query_pos == std::ranges::size(query) || cur.extend_right(std::view::drop(query, query_pos)))
-        {
-            delegate(cur);
-            return true;
-        }
+        cursor_t suffix_cur{cur};
+        if (suffix_cur.extend_right(std::view::drop(query, query_pos)))
+            return delegate_requests_abort(delegate, suffix_cur);
     }
     // Approximate case
     else
@@ -76,30 +80,34 @@ inline bool search_trivial(cursor_t cur, query_t & query, typename cursor_t::siz
                 return true;
         }
 
+        cursor_t child_cur{cur};
         // Do not allow deletions at the beginning of the query sequence
-        if (((query_pos > 0 && error_left.deletion > 0) || error_left.substitution > 0) && cur.extend_right())
+        if (((query_pos > 0 && error_left.deletion > 0) || error_left.substitution > 0) && child_cur.extend_right())
         {
             do
             {
                 // Match (when error_left.substitution > 0) and Mismatch
                 if (error_left.substitution > 0)
                 {
-                    bool delta = cur.last_char() != query[query_pos];
+                    bool delta = child_cur.last_char() != query[query_pos];
                     search_param error_left2{error_left};
                     error_left2.total -= delta;
                     error_left2.substitution -= delta;
 
-                    if (search_trivial<abort_on_hit>(cur, query, query_pos + 1, error_left2, delegate) && abort_on_hit)
+                    if (search_trivial<abort_on_hit>(child_cur, query, query_pos + 1, error_left2, delegate) &&
+                        abort_on_hit)
+                    {
                         return true;
+                    }
                 }
 
                 // Deletion (Do not allow deletions at the beginning of the query sequence.)
                 if (query_pos > 0)
                 {
                     // Match (when error_left.substitution == 0)
-                    if (error_left.substitution == 0 && cur.last_char() == query[query_pos])
+                    if (error_left.substitution == 0 && child_cur.last_char() == query[query_pos])
                     {
-                        if (search_trivial<abort_on_hit>(cur, query, query_pos + 1, error_left, delegate) &&
+                        if (search_trivial<abort_on_hit>(child_cur, query, query_pos + 1, error_left, delegate) &&
                             abort_on_hit)
                         {
                             return true;
@@ -115,18 +123,21 @@ inline bool search_trivial(cursor_t cur, query_t & query, typename cursor_t::siz
                         error_left2.total--;
                         error_left2.deletion--;
 
-                        if (search_trivial<abort_on_hit>(cur, query, query_pos, error_left2, delegate) && abort_on_hit)
+                        if (search_trivial<abort_on_hit>(child_cur, query, query_pos, error_left2, delegate) &&
+                            abort_on_hit)
+                        {
                             return true;
+                        }
                     }
                 }
-            } while (cur.cycle_back());
+            } while (child_cur.cycle_back());
         }
         else
         {
             // Match (when error_left.substitution == 0)
-            if (cur.extend_right(query[query_pos]))
+            if (child_cur.extend_right(query[query_pos]))
             {
-                if (search_trivial<abort_on_hit>(cur, query, query_pos + 1, error_left, delegate) && abort_on_hit)
+                if (search_trivial<abort_on_hit>(child_cur, query, query_pos + 1, error_left, delegate) && abort_on_hit)
                     return true;
             }
         }
@@ -160,6 +171,46 @@ inline void search_trivial(index_t const & index, query_t & query, search_param
     search_trivial<abort_on_hit>(index.begin(), query, 0, error_left, delegate);
 }
 
+/*!\brief Searches a query sequence in an index using trivial backtracking, starting from a precomputed
+ *        k-mer table.
+ * \tparam abort_on_hit  If the flag is set, the search algorithm aborts on the first hit.
+ * \tparam index_t       Must model seqan3::FmIndex.
+ * \tparam query_t       Must be a std::ranges::InputRange over the index's alphabet.
+ * \tparam delegate_t    Takes `index::cursor_type` as argument.
+ * \param[in] index      String index built on the text that will be searched.
+ * \param[in] table      K-mer table precomputed for `index`.
+ * \param[in] query      Query sequence to be searched in the index.
+ * \param[in] error_left Number of errors left for matching the remaining suffix of the query sequence.
+ * \param[in] delegate   Function that is called on every hit.
+ *
+ * \details
+ *
+ * For exact searches the cursor is initialised at depth k via the table, skipping the backward searches for
+ * the first k characters. Approximate searches may spend errors inside the first k characters and therefore
+ * fall back to starting at the root.
+ *
+ * ### Complexity
+ *
+ * \f$O(|query|^e)\f$ where \f$e\f$ is the maximum number of errors.
+ *
+ * ### Exceptions
+ *
+ * No-throw guarantee if invoking the delegate also guarantees no-throw.
+ */
+template <bool abort_on_hit, typename index_t, typename query_t, typename delegate_t>
+inline void search_trivial(index_t const & index, fm_index_kmer_table<index_t> const & table, query_t & query,
+                           search_param const error_left, delegate_t && delegate) noexcept(noexcept(delegate))
+{
+    if (error_left.total == 0 && std::ranges::size(query) >= table.kmer_size())
+    {
+        if (auto cur = table.cursor(query); cur.has_value())
+            search_trivial<abort_on_hit>(*cur, query, table.kmer_size(), error_left, delegate);
+        return; // The k-mer prefix of the query does not occur in the text at all.
+    }
+
+    search_trivial<abort_on_hit>(index.begin(), query, 0, error_left, delegate);
+}
+
 //!\}
 
 } // namespace seqan3::detail
@@ -25,13 +25,14 @@
  * predefined wildcard positions that do not have to match. FM indices on the other hand are more versatile and work
  * with arbitrary pattern lengths and error numbers / positions.
  *
- * SeqAn3 currently supports very fast FM indices. For more details visit the \ref submodule_fm_index
- * "FM Index submodule".
- *
- * \todo k-mer indices are coming soon. Stay tuned!
+ * SeqAn3 currently supports very fast FM indices (see the \ref submodule_fm_index "FM Index submodule")
+ * as well as direct addressing q-gram indices with optional minimizer subsampling (see the
+ * \ref submodule_qgram_index "Q-Gram Index submodule").
  */
 
 #pragma once
 
 #include <seqan3/search/algorithm/all.hpp>
 #include <seqan3/search/fm_index/all.hpp>
+#include <seqan3/search/kmer_count/all.hpp>
+#include <seqan3/search/qgram_index/all.hpp>
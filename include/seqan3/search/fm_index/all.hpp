@@ -45,3 +45,6 @@
 
 #include <seqan3/search/fm_index/bi_fm_index.hpp>
 #include <seqan3/search/fm_index/fm_index.hpp>
+#include <seqan3/search/fm_index/fm_index_kmer_table.hpp>
+#include <seqan3/search/fm_index/partitioned_fm_index.hpp>
+#include <seqan3/search/fm_index/translated_fm_index.hpp>
@@ -12,6 +12,9 @@
 
 #pragma once
 
+#include <exception>
+#include <string>
+#include <thread>
 #include <utility>
 
 #include <seqan3/core/metafunction/range.hpp>
@@ -44,6 +47,23 @@ struct bi_fm_index_default_traits
     using rev_fm_index_traits = fm_index_default_traits; // TODO: trait object without sampling.
 };
 
+/*!\brief A Bidirectional FM Index Configuration that uses EPR dictionaries as occurrence tables.
+ *
+ * \details
+ *
+ * Uses seqan3::fm_index_epr_traits for both directions; see there for the alphabet restriction and the
+ * time/space trade-off. Every bidirectional step additionally profits from the dictionary's cache line
+ * hints: the rank queries at the two interval endpoints are fetched concurrently.
+ */
+struct bi_fm_index_epr_traits
+{
+    //!\brief Type of the underlying forward SDSL index.
+    using fm_index_traits = fm_index_epr_traits;
+
+    //!\brief Type of the underlying reverse SDSL index.
+    using rev_fm_index_traits = fm_index_epr_traits;
+};
+
 /*!\brief The SeqAn Bidirectional FM Index
  * \implements seqan3::BiFmIndex
  * \tparam text_t The type of the text to be indexed; must model std::ranges::RandomAccessRange.
@@ -154,6 +174,8 @@ public:
     template <typename fm_index_t>
     friend class fm_index_cursor;
 
+    friend struct detail::in_text_verification_access;
+
     /*!\name Constructors, destructor and assignment
      * \{
      */
@@ -168,14 +190,15 @@ public:
      *        The range cannot be an rvalue (i.e. a temporary object) and has to be non-empty.
      * \tparam text_t The type of range to construct from; must model std::ranges::RandomAccessRange.
      * \param[in] text The text to construct from.
+     * \param[in] thread_count The number of threads to construct with (see seqan3::bi_fm_index::construct).
      *
      * ### Complexity
      *
      * \todo At least linear.
      */
-    bi_fm_index(text_t const & text)
+    bi_fm_index(text_t const & text, size_t const thread_count = 1)
     {
-        construct(text);
+        construct(text, thread_count);
     }
 
     //!\overload
@@ -189,6 +212,11 @@ public:
      *        The range cannot be an rvalue (i.e. a temporary object) and has to be non-empty.
      * \tparam text_t The type of range to construct from; must model std::ranges::RandomAccessRange.
      * \param[in] text The text to construct from.
+     * \param[in] thread_count The number of threads to construct with. With more than one thread the indices of the
+     *                         original and the reversed text are built concurrently, each with half of the threads
+     *                         (see seqan3::fm_index::construct); the resulting index is identical to a
+     *                         single-threaded construction. The reversed text is a view on the original text, i.e.
+     *                         it is never stored explicitly.
      *
      * \details \todo This has to be better implemented with regard to the memory peak due to not matching interfaces
      *                with the SDSL.
@@ -201,7 +229,7 @@ public:
      *
      * No guarantee. \todo Ensure strong exception guarantee.
      */
-    void construct(text_t const & text)
+    void construct(text_t const & text, size_t const thread_count = 1)
     {
          // text must not be empty
         if (std::ranges::begin(text) == std::ranges::end(text))
@@ -212,8 +240,43 @@ public:
             rev_text = text | view::deep{std::view::reverse} | view::deep{view::persist} | std::view::reverse;
         else
             rev_text = std::view::reverse(text);
-        fwd_fm.construct(text);
-        rev_fm.construct(rev_text);
+
+        if (thread_count <= 1)
+        {
+            fwd_fm.construct(text);
+            rev_fm.construct(rev_text);
+        }
+        else
+        {
+            size_t const rev_thread_count = thread_count / 2;
+
+            std::exception_ptr rev_exception{};
+            std::thread rev_thread{[&] ()
+            {
+                try
+                {
+                    rev_fm.construct(rev_text, rev_thread_count);
+                }
+                catch (...)
+                {
+                    rev_exception = std::current_exception();
+                }
+            }};
+
+            try
+            {
+                fwd_fm.construct(text, thread_count - rev_thread_count);
+            }
+            catch (...)
+            {
+                rev_thread.join();
+                throw;
+            }
+
+            rev_thread.join();
+            if (rev_exception)
+                std::rethrow_exception(rev_exception);
+        }
 
         // does not work yet. segmentation fault in bi_fm_index_cursor snippet
         // bi_fm_index tmp;
@@ -373,6 +436,92 @@ public:
         return fwd_fm.store(path_fwd) && rev_fm.store(path_rev);
     }
 
+    /*!\brief Stores the index as two versioned container files (suffixed `.fwd` and `.rev`).
+     * \returns `true` if both containers were successfully written.
+     *
+     * \details
+     *
+     * Writes the forward and the reverse index in the validated container format of
+     * seqan3::fm_index::store_container; load_container() checks the alphabet, the text dimension and the
+     * index type fingerprint of both files before loading.
+     *
+     * ### Complexity
+     *
+     * Linear.
+     *
+     * ### Exceptions
+     *
+     * Strong exception guarantee.
+     */
+    bool store_container(std::filesystem::path const & path) const
+    {
+        std::filesystem::path path_fwd{path};
+        std::filesystem::path path_rev{path};
+        path_fwd += std::filesystem::path{".fwd"};
+        path_rev += std::filesystem::path{".rev"};
+        return fwd_fm.store_container(path_fwd) && rev_fm.store_container(path_rev);
+    }
+
+    /*!\brief Loads the index from two versioned container files written by store_container().
+     * \returns `true` if both containers were successfully validated and loaded.
+     *
+     * ### Complexity
+     *
+     * Linear.
+     *
+     * ### Exceptions
+     *
+     * Strong exception guarantee.
+     */
+    bool load_container(std::filesystem::path const & path)
+    {
+        std::filesystem::path path_fwd{path};
+        std::filesystem::path path_rev{path};
+        path_fwd += std::filesystem::path{".fwd"};
+        path_rev += std::filesystem::path{".rev"};
+        return fwd_fm.load_container(path_fwd) && rev_fm.load_container(path_rev);
+    }
+
+    /*!\brief Places the serialized index into two named shared-memory segments (suffixed `.fwd` and `.rev`).
+     * \param[in] name The segment name prefix; must start with a slash and contain no further slashes.
+     * \returns `true` if the segments were successfully created and filled.
+     *
+     * \details
+     *
+     * \copydetails seqan3::fm_index::store_shm
+     */
+    bool store_shm(std::string const & name) const
+    {
+        return fwd_fm.store_shm(name + ".fwd") && rev_fm.store_shm(name + ".rev");
+    }
+
+    /*!\brief Loads the index from the shared-memory segments previously filled by store_shm().
+     * \param[in] name The segment name prefix; must start with a slash and contain no further slashes.
+     * \returns `true` if the index was successfully loaded from the segments.
+     *
+     * \details
+     *
+     * \copydetails seqan3::fm_index::load_shm
+     */
+    bool load_shm(std::string const & name)
+    {
+        return fwd_fm.load_shm(name + ".fwd") && rev_fm.load_shm(name + ".rev");
+    }
+
+    /*!\brief Removes the shared-memory segments created by store_shm().
+     * \param[in] name The segment name prefix; must start with a slash and contain no further slashes.
+     * \returns `true` if both segments were successfully removed.
+     *
+     * \details
+     *
+     * \copydetails seqan3::fm_index::unlink_shm
+     */
+    static bool unlink_shm(std::string const & name)
+    {
+        // Use & so that both segments are unlinked even if the first unlink fails.
+        return fm_index_type::unlink_shm(name + ".fwd") & fm_index_type::unlink_shm(name + ".rev");
+    }
+
 };
 
 //!\}
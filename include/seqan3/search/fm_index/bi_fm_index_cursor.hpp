@@ -21,6 +21,7 @@
 #include <seqan3/alphabet/all.hpp>
 #include <seqan3/core/metafunction/range.hpp>
 #include <seqan3/search/fm_index/bi_fm_index.hpp>
+#include <seqan3/search/fm_index/detail/batch_locate.hpp>
 #include <seqan3/std/ranges>
 
 namespace seqan3
@@ -152,6 +153,15 @@ protected:
         assert(r_fwd + 1 >= l_fwd);
         assert(r_bwd + 1 - l_bwd == r_fwd + 1 - l_fwd);
 
+        if constexpr (detail::EprDictionaryIndex<csa_t>)
+        {
+            // The rank queries at the two interval endpoints access independent blocks of the dictionary;
+            // hinting both cache lines before the C array loads below lets their fetches overlap instead of
+            // running one dependent miss chain after the other.
+            csa.wavelet_tree.prefetch(l_fwd);
+            csa.wavelet_tree.prefetch(r_fwd + 1);
+        }
+
         size_type _l_fwd, _r_fwd, _l_bwd, _r_bwd;
 
         size_type cc = c;
@@ -205,6 +215,13 @@ protected:
     {
         assert((l_parent <= r_parent) && (r_parent < csa.size()));
 
+        if constexpr (detail::EprDictionaryIndex<csa_t>)
+        {
+            // see bidirectional_search(): overlap the fetches of the two endpoint rank queries
+            csa.wavelet_tree.prefetch(l_parent);
+            csa.wavelet_tree.prefetch(r_parent + 1);
+        }
+
         size_type c_begin;
         if constexpr(std::Same<typename csa_t::alphabet_type, sdsl::plain_byte_alphabet>)
             c_begin = csa.C[c]; // TODO: check whether this can be removed
@@ -328,25 +345,58 @@ public:
 
         size_type new_parent_lb = fwd_lb, new_parent_rb = fwd_rb;
 
-        sdsl_char_type c = 1; // NOTE: start with 0 or 1 depending on implicit_sentintel
-        while (c < sigma &&
-               !bidirectional_search(index->fwd_fm.index, index->fwd_fm.index.comp2char[c],
-                                     fwd_lb, fwd_rb, rev_lb, rev_rb))
+        if constexpr (detail::EprDictionaryIndex<typename index_type::sdsl_index_type>)
         {
-            ++c;
+            // Two bulk rank queries retrieve the intervals of all characters at once (see
+            // seqan3::fm_index_cursor::extend_right()); the reverse interval is derived from the running
+            // prefix counts, starting with the sentinels which precede every character.
+            auto const & csa = index->fwd_fm.index;
+            auto const ranks_lb = csa.wavelet_tree.all_ranks(fwd_lb);
+            auto const ranks_rb = csa.wavelet_tree.all_ranks(fwd_rb + 1);
+            size_type const window = fwd_rb + 1 - fwd_lb;
+
+            size_type smaller = ranks_rb[0] - ranks_lb[0];
+            for (sdsl_char_type c = 1; c < sigma; ++c)
+            {
+                size_type const count = ranks_rb[c] - ranks_lb[c];
+                if (count > 0)
+                {
+                    parent_lb = new_parent_lb;
+                    parent_rb = new_parent_rb;
+                    fwd_lb = csa.C[c] + ranks_lb[c];
+                    fwd_rb = fwd_lb + count - 1;
+                    rev_lb += smaller;
+                    rev_rb -= window - smaller - count;
+                    _last_char = c;
+                    ++depth;
+                    return true;
+                }
+                smaller += count;
+            }
+            return false;
         }
-
-        if (c != sigma)
+        else
         {
-            parent_lb = new_parent_lb;
-            parent_rb = new_parent_rb;
-
-            _last_char = c;
-            ++depth;
-
-            return true;
+            sdsl_char_type c = 1; // NOTE: start with 0 or 1 depending on implicit_sentintel
+            while (c < sigma &&
+                   !bidirectional_search(index->fwd_fm.index, index->fwd_fm.index.comp2char[c],
+                                         fwd_lb, fwd_rb, rev_lb, rev_rb))
+            {
+                ++c;
+            }
+
+            if (c != sigma)
+            {
+                parent_lb = new_parent_lb;
+                parent_rb = new_parent_rb;
+
+                _last_char = c;
+                ++depth;
+
+                return true;
+            }
+            return false;
         }
-        return false;
     }
 
     /*!\brief Tries to extend the query by the smallest possible character to the left such that the query is found in
@@ -376,25 +426,56 @@ public:
 
         size_type new_parent_lb = rev_lb, new_parent_rb = rev_rb;
 
-        sdsl_char_type c = 1; // NOTE: start with 0 or 1 depending on implicit_sentintel
-        while (c < sigma &&
-               !bidirectional_search(index->rev_fm.index, index->rev_fm.index.comp2char[c],
-                                     rev_lb, rev_rb, fwd_lb, fwd_rb))
+        if constexpr (detail::EprDictionaryIndex<typename index_type::rev_sdsl_index_type>)
         {
-            ++c;
+            // see extend_right(): bulk rank queries on the reverse index, co-interval on the forward one
+            auto const & csa = index->rev_fm.index;
+            auto const ranks_lb = csa.wavelet_tree.all_ranks(rev_lb);
+            auto const ranks_rb = csa.wavelet_tree.all_ranks(rev_rb + 1);
+            size_type const window = rev_rb + 1 - rev_lb;
+
+            size_type smaller = ranks_rb[0] - ranks_lb[0];
+            for (sdsl_char_type c = 1; c < sigma; ++c)
+            {
+                size_type const count = ranks_rb[c] - ranks_lb[c];
+                if (count > 0)
+                {
+                    parent_lb = new_parent_lb;
+                    parent_rb = new_parent_rb;
+                    rev_lb = csa.C[c] + ranks_lb[c];
+                    rev_rb = rev_lb + count - 1;
+                    fwd_lb += smaller;
+                    fwd_rb -= window - smaller - count;
+                    _last_char = c;
+                    ++depth;
+                    return true;
+                }
+                smaller += count;
+            }
+            return false;
         }
-
-        if (c != sigma)
+        else
         {
-            parent_lb = new_parent_lb;
-            parent_rb = new_parent_rb;
-
-            _last_char = c;
-            ++depth;
-
-            return true;
+            sdsl_char_type c = 1; // NOTE: start with 0 or 1 depending on implicit_sentintel
+            while (c < sigma &&
+                   !bidirectional_search(index->rev_fm.index, index->rev_fm.index.comp2char[c],
+                                         rev_lb, rev_rb, fwd_lb, fwd_rb))
+            {
+                ++c;
+            }
+
+            if (c != sigma)
+            {
+                parent_lb = new_parent_lb;
+                parent_rb = new_parent_rb;
+
+                _last_char = c;
+                ++depth;
+
+                return true;
+            }
+            return false;
         }
-        return false;
     }
 
     /*!\brief Tries to extend the query by the character `c` to the right.
@@ -912,6 +993,11 @@ public:
     /*!\brief Locates the occurrences of the searched query in the text.
      * \returns Positions in the text.
      *
+     * \details
+     *
+     * The suffix array values of the whole interval are resolved in bulk with their LF walks interleaved
+     * (see seqan3::detail::batch_locate), which overlaps the memory latencies of the walks.
+     *
      * ### Complexity
      *
      * \f$count() * O(T_{BACKWARD\_SEARCH} * SAMPLING\_RATE)\f$
@@ -927,10 +1013,11 @@ public:
     {
         assert(index != nullptr);
 
+        auto const sa_values = detail::batch_locate(index->fwd_fm.index, fwd_lb, fwd_rb);
         std::vector<size_type> occ(count());
         for (size_type i = 0; i < occ.size(); ++i)
         {
-            occ[i] = offset() - index->fwd_fm.index[fwd_lb + i];
+            occ[i] = offset() - sa_values[i];
         }
         return occ;
     }
@@ -943,11 +1030,12 @@ public:
     {
         assert(index != nullptr);
 
+        auto const sa_values = detail::batch_locate(index->fwd_fm.index, fwd_lb, fwd_rb);
         std::vector<std::pair<size_type, size_type>> occ;
         occ.reserve(count());
         for (size_type i = 0; i < count(); ++i)
         {
-            size_type loc = offset() - index->fwd_fm.index[fwd_lb + i];
+            size_type loc = offset() - sa_values[i];
             size_type sequence_rank = index->fwd_fm.text_begin_rs.rank(loc + 1);
             size_type sequence_position = loc - index->fwd_fm.text_begin_ss.select(sequence_rank);
             occ.emplace_back(sequence_rank - 1, sequence_position);
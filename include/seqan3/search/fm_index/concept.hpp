@@ -19,6 +19,7 @@
 #include <seqan3/core/metafunction/range.hpp>
 #include <seqan3/range/concept.hpp>
 #include <seqan3/range/container/concept.hpp>
+#include <seqan3/search/fm_index/detail/csa_alphabet_strategy.hpp>
 
 namespace seqan3::detail
 {
@@ -69,6 +70,29 @@ SEQAN3_CONCEPT SdslIndex = requires (t sdsl_index)
  * \}
  */
 
+ // ============================================================================
+ //  EprDictionaryIndex
+ // ============================================================================
+
+/*!\interface seqan3::detail::EprDictionaryIndex <>
+ * \extends seqan3::detail::SdslIndex
+ * \brief Concept for SDSL FM indices whose occurrence table is an EPR dictionary with bulk rank support
+ *        (see sdsl::wt_epr) over an identity alphabet mapping.
+ *
+ * The seqan3::fm_index_cursor dispatches to specialised implementations of extend_right() and cycle_back()
+ * for indices satisfying this concept.
+ */
+//!\cond
+template <typename t>
+SEQAN3_CONCEPT EprDictionaryIndex = SdslIndex<t> &&
+    std::Same<typename t::alphabet_type, sdsl::plain_byte_alphabet> &&
+    requires (t sdsl_index, typename t::size_type const pos)
+    {
+        { sdsl_index.wavelet_tree.all_ranks(pos) };
+        { sdsl_index.wavelet_tree.prefetch(pos) };
+    };
+//!\endcond
+
 //!\}
 
 } // namespace seqan3::detail
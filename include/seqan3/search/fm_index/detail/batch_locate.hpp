@@ -0,0 +1,112 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::batch_locate.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <sdsl/suffix_trees.hpp>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\interface seqan3::detail::PrefetchableDictionary <>
+ * \brief Whether the wavelet tree of the SDSL index offers a prefetch hint for rank queries.
+ * \ingroup submodule_fm_index
+ */
+//!\cond
+template <typename csa_t>
+SEQAN3_CONCEPT PrefetchableDictionary = requires (csa_t const csa, typename csa_t::size_type const pos)
+{
+    { csa.wavelet_tree.prefetch(pos) };
+};
+//!\endcond
+
+/*!\brief Resolves all suffix array values of the interval `[lb, rb]` in bulk.
+ * \ingroup submodule_fm_index
+ * \tparam csa_t  Type of the underlying SDSL index.
+ * \param[in] csa The SDSL index.
+ * \param[in] lb  Inclusive left bound of the suffix array interval.
+ * \param[in] rb  Inclusive right bound of the suffix array interval.
+ * \returns The suffix array values `csa[lb] .. csa[rb]` in interval order.
+ *
+ * \details
+ *
+ * Resolving a single suffix array position follows LF-mapping pointers until a sampled entry is reached and
+ * every step is a data dependent memory access, i.e. typically a cache miss. Instead of finishing one walk
+ * after the other, this function advances all unresolved walks of the interval round-robin: the accesses of
+ * different walks are independent, so the memory system can overlap their misses. If the wavelet tree of the
+ * index offers a `prefetch(position)` hint (see sdsl::wt_epr), the blocks accessed in the upcoming round are
+ * additionally prefetched before the walks are advanced.
+ *
+ * ### Complexity
+ *
+ * \f$(rb - lb + 1) * O(SAMPLING\_RATE)\f$ LF steps, the same as resolving each position individually, but
+ * with the memory latencies of the walks overlapped.
+ *
+ * ### Exceptions
+ *
+ * Strong exception guarantee (no data is modified in case an exception is thrown).
+ */
+template <typename csa_t>
+inline std::vector<typename csa_t::size_type> batch_locate(csa_t const & csa,
+                                                           typename csa_t::size_type const lb,
+                                                           typename csa_t::size_type const rb)
+{
+    using size_type = typename csa_t::size_type;
+
+    size_type const count = rb + 1 - lb;
+    std::vector<size_type> result(count);
+
+    // One LF walk per interval position: its current suffix array position, the number of LF steps taken so
+    // far, and the slot of the result vector it resolves. Finished walks are compacted out after every round.
+    std::vector<size_type> position(count), steps(count), slot(count);
+    for (size_type i = 0; i < count; ++i)
+    {
+        position[i] = lb + i;
+        steps[i] = 0;
+        slot[i] = i;
+    }
+
+    size_type active = count;
+    while (active > 0)
+    {
+        if constexpr (PrefetchableDictionary<csa_t>)
+        {
+            for (size_type i = 0; i < active; ++i)
+                csa.wavelet_tree.prefetch(position[i]);
+        }
+
+        size_type kept = 0;
+        for (size_type i = 0; i < active; ++i)
+        {
+            if (csa.sa_sample.is_sampled(position[i]))
+            {
+                size_type const value = csa.sa_sample.sa_value(position[i]) + steps[i];
+                result[slot[i]] = (value < csa.size()) ? value : value - csa.size();
+            }
+            else
+            {
+                position[kept] = csa.lf[position[i]];
+                steps[kept] = steps[i] + 1;
+                slot[kept] = slot[i];
+                ++kept;
+            }
+        }
+        active = kept;
+    }
+
+    return result;
+}
+
+} // namespace seqan3::detail
@@ -0,0 +1,150 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides the versioned on-disk container format for the FM indices.
+ * \author Christopher Pockrandt <christopher.pockrandt AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes a compile time FNV-1a fingerprint of the given type.
+ * \ingroup submodule_fm_index
+ * \tparam type_t The type to fingerprint.
+ *
+ * \details
+ *
+ * The fingerprint hashes the pretty printed signature of this function instantiation and therefore changes
+ * whenever the template argument, e.g. the full sdsl index type with all its configuration parameters, changes.
+ * It is stored in the container header such that loading an index into a differently configured index type is
+ * detected up front instead of failing deep inside the sdsl deserialisation.
+ */
+template <typename type_t>
+constexpr uint64_t index_traits_fingerprint() noexcept
+{
+    uint64_t hash = 14695981039346656037ull;
+    for (char const * it = __PRETTY_FUNCTION__; *it != '\0'; ++it)
+    {
+        hash ^= static_cast<uint64_t>(static_cast<unsigned char>(*it));
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+/*!\brief The header of the versioned index container format.
+ * \ingroup submodule_fm_index
+ *
+ * \details
+ *
+ * A container file starts with the magic bytes and the format version, followed by the alphabet size of the
+ * indexed alphabet, the dimension of the indexed text (1 for a single text, 2 for a collection), the fingerprint
+ * of the index type (see seqan3::detail::index_traits_fingerprint) and the payload size in bytes. The header
+ * block is zero padded to seqan3::detail::index_container_header::payload_offset such that the payload starts
+ * page aligned, which allows memory mapped loading to map the payload directly. All fields are stored in the
+ * native byte order; the format is an interchange format between machines of the same architecture, not across
+ * architectures (the underlying sdsl serialisation is not either).
+ */
+struct index_container_header
+{
+    //!\brief The magic bytes identifying an index container file.
+    static constexpr std::array<char, 8> magic{{'S', 'E', 'Q', 'A', 'N', '3', 'I', 'X'}};
+    //!\brief The version of the container format; bump when the layout changes.
+    static constexpr uint32_t version{1u};
+    //!\brief The offset of the payload behind the zero padded header block.
+    static constexpr uint64_t payload_offset{4096u};
+
+    //!\brief The alphabet size of the indexed alphabet (seqan3::alphabet_size_v).
+    uint32_t alphabet_id{};
+    //!\brief The dimension of the indexed text; 1 for a single text, 2 for a collection.
+    uint8_t text_dimension{};
+    //!\brief The fingerprint of the index type the container was written with.
+    uint64_t traits_fingerprint{};
+    //!\brief The size of the serialized payload in bytes.
+    uint64_t payload_size{};
+};
+
+/*!\brief Writes the container header including the alignment padding to the given stream.
+ * \ingroup submodule_fm_index
+ * \param[in,out] out    The output stream positioned at the beginning of the file.
+ * \param[in]     header The header to write.
+ * \returns `true` if the header was successfully written.
+ */
+inline bool write_index_container_header(std::ostream & out, index_container_header const & header)
+{
+    auto write_field = [&out] (auto const & field)
+    {
+        out.write(reinterpret_cast<char const *>(&field), sizeof(field));
+    };
+
+    out.write(index_container_header::magic.data(), index_container_header::magic.size());
+    write_field(index_container_header::version);
+    write_field(header.alphabet_id);
+    write_field(header.text_dimension);
+    write_field(header.traits_fingerprint);
+    write_field(header.payload_size);
+
+    // Zero pad the header block such that the payload starts at the aligned offset.
+    size_t written = index_container_header::magic.size() + sizeof(index_container_header::version) +
+                     sizeof(header.alphabet_id) + sizeof(header.text_dimension) +
+                     sizeof(header.traits_fingerprint) + sizeof(header.payload_size);
+    std::array<char, 256> const zeroes{};
+    while (written < index_container_header::payload_offset && out)
+    {
+        size_t const chunk = std::min(zeroes.size(), index_container_header::payload_offset - written);
+        out.write(zeroes.data(), chunk);
+        written += chunk;
+    }
+
+    return static_cast<bool>(out);
+}
+
+/*!\brief Reads and validates the magic bytes and the version and extracts the header fields.
+ * \ingroup submodule_fm_index
+ * \param[in,out] in     The input stream positioned at the beginning of the file.
+ * \param[out]    header The extracted header.
+ * \returns `true` if the stream contains an index container of the supported version; the stream is then
+ *          positioned at the payload. The semantic fields (alphabet, dimension, fingerprint) are left to the
+ *          caller to validate against its own type.
+ */
+inline bool read_index_container_header(std::istream & in, index_container_header & header)
+{
+    auto read_field = [&in] (auto & field)
+    {
+        in.read(reinterpret_cast<char *>(&field), sizeof(field));
+    };
+
+    std::array<char, 8> magic_buffer{};
+    in.read(magic_buffer.data(), magic_buffer.size());
+    if (!in || magic_buffer != index_container_header::magic)
+        return false;
+
+    uint32_t version{};
+    read_field(version);
+    if (!in || version != index_container_header::version)
+        return false;
+
+    read_field(header.alphabet_id);
+    read_field(header.text_dimension);
+    read_field(header.traits_fingerprint);
+    read_field(header.payload_size);
+
+    in.seekg(index_container_header::payload_offset);
+    return static_cast<bool>(in);
+}
+
+} // namespace seqan3::detail
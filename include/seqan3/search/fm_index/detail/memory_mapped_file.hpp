@@ -0,0 +1,164 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::memory_mapped_file and seqan3::detail::memory_mapped_streambuf.
+ */
+
+#pragma once
+
+#include <streambuf>
+#include <utility>
+
+#include <seqan3/core/platform.hpp>
+#include <seqan3/std/filesystem>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace seqan3::detail
+{
+
+/*!\brief A read-only, shared memory mapping of a file.
+ * \ingroup submodule_fm_index
+ *
+ * \details
+ *
+ * The file is mapped with `PROT_READ` and `MAP_SHARED`, i.e. the mapped pages are backed directly by the page
+ * cache: concurrent processes mapping the same file share one physical copy and no data is read until the pages
+ * are touched. The file descriptor is closed right after mapping; the mapping remains valid until destruction.
+ *
+ * On platforms without POSIX memory mapping (see seqan3::detail::memory_mapped_file::supported) objects of this
+ * class never open.
+ */
+class memory_mapped_file
+{
+public:
+    //!\brief Whether memory mapping is available on this platform.
+#if defined(__unix__) || defined(__APPLE__)
+    static constexpr bool supported = true;
+#else
+    static constexpr bool supported = false;
+#endif
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    memory_mapped_file() = default;                                    //!< Defaulted.
+    memory_mapped_file(memory_mapped_file const &) = delete;           //!< Deleted; the mapping is exclusively owned.
+    memory_mapped_file & operator=(memory_mapped_file const &) = delete; //!< Deleted.
+
+    //!\brief Move constructs from `other`, which is left closed.
+    memory_mapped_file(memory_mapped_file && other) noexcept
+    {
+        std::swap(mapped_data, other.mapped_data);
+        std::swap(mapped_size, other.mapped_size);
+    }
+
+    //!\brief Move assigns from `other`, which is left closed.
+    memory_mapped_file & operator=(memory_mapped_file && other) noexcept
+    {
+        std::swap(mapped_data, other.mapped_data);
+        std::swap(mapped_size, other.mapped_size);
+        return *this;
+    }
+
+    /*!\brief Maps the given file; on failure the object is left closed (see is_open()).
+     * \param[in] path The file to map.
+     */
+    explicit memory_mapped_file([[maybe_unused]] std::filesystem::path const & path) noexcept
+    {
+#if defined(__unix__) || defined(__APPLE__)
+        int const fd = ::open(path.c_str(), O_RDONLY);
+        if (fd == -1)
+            return;
+
+        struct stat file_status{};
+        if (::fstat(fd, &file_status) == -1 || file_status.st_size <= 0)
+        {
+            ::close(fd);
+            return;
+        }
+
+        void * const mapped = ::mmap(nullptr, static_cast<size_t>(file_status.st_size),
+                                     PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd); // The mapping stays valid after closing the descriptor.
+
+        if (mapped == MAP_FAILED)
+            return;
+
+        mapped_data = static_cast<char const *>(mapped);
+        mapped_size = static_cast<size_t>(file_status.st_size);
+#endif
+    }
+
+    //!\brief Unmaps the file.
+    ~memory_mapped_file()
+    {
+#if defined(__unix__) || defined(__APPLE__)
+        if (mapped_data != nullptr)
+            ::munmap(const_cast<char *>(mapped_data), mapped_size);
+#endif
+    }
+    //!\}
+
+    //!\brief Whether the file was successfully mapped.
+    bool is_open() const noexcept
+    {
+        return mapped_data != nullptr;
+    }
+
+    //!\brief Returns a pointer to the mapped file content.
+    char const * data() const noexcept
+    {
+        return mapped_data;
+    }
+
+    //!\brief Returns the size of the mapped file in bytes.
+    size_t size() const noexcept
+    {
+        return mapped_size;
+    }
+
+private:
+    //!\brief The begin of the mapping; `nullptr` if no file is mapped.
+    char const * mapped_data{nullptr};
+    //!\brief The length of the mapping in bytes.
+    size_t mapped_size{0};
+};
+
+/*!\brief A read-only std::streambuf over a seqan3::detail::memory_mapped_file.
+ * \ingroup submodule_fm_index
+ *
+ * \details
+ *
+ * Exposes the mapped pages directly as the get area of the stream buffer, such that deserialising through a
+ * std::istream on top of this buffer reads straight from the page cache without any intermediate buffering or
+ * read system calls. The mapped memory must outlive the stream buffer.
+ */
+class memory_mapped_streambuf : public std::streambuf
+{
+public:
+    //!\brief Constructs the get area over the mapping of `file`.
+    explicit memory_mapped_streambuf(memory_mapped_file const & file)
+        : memory_mapped_streambuf{file.data(), file.size()}
+    {}
+
+    //!\brief Constructs the get area over an arbitrary mapped memory region.
+    memory_mapped_streambuf(char const * data, size_t const size)
+    {
+        // The get area is never written through; the const_cast only satisfies the std::streambuf interface.
+        char * const begin = const_cast<char *>(data);
+        setg(begin, begin, begin + size);
+    }
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,143 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::parallel_suffix_array.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <sdsl/int_vector.hpp>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Constructs the suffix array of a text of byte-ranged symbols using multiple threads.
+ * \ingroup submodule_fm_index
+ * \tparam text_t          The type of the text; must provide random access via `operator[]` and a `size()` member
+ *                         and yield integral symbols smaller than 256, e.g. sdsl::int_vector<8> or a read-only view
+ *                         over bit-packed ranks.
+ * \param[in] text         The zero-terminated text to process, i.e. the last symbol is the sentinel `0` and `0` does
+ *                         not occur anywhere else in the text.
+ * \param[in] thread_count The number of threads to sort with; values below `2` fall back to a sequential sort.
+ * \returns The suffix array of `text` as bit-compressed sdsl::int_vector<>, with the sentinel suffix at position `0`.
+ * \throws std::bad_alloc if the working arrays cannot be allocated.
+ *
+ * \details
+ *
+ * Implements prefix doubling (Manber & Myers): the suffixes are first bucketed by their initial symbol; in every
+ * following round the suffixes inside one rank group are ordered by the rank of the suffix `k` positions further
+ * right, which doubles the sorted prefix length per round. Since the groups of one round are independent of each
+ * other, they are distributed over the given number of threads and sorted concurrently; the rank update between two
+ * rounds is a single linear scan. The algorithm hence runs \f$O(\frac{n \log n}{t} \log n)\f$ work distributed over
+ * `t` threads and terminates early once all ranks are unique.
+ *
+ * The layout of the result matches what sdsl::construct produces for the cached suffix array
+ * (`sdsl::conf::KEY_SA`), so the returned vector can be fed directly into the SDSL index assembly.
+ */
+template <typename text_t>
+sdsl::int_vector<> parallel_suffix_array(text_t const & text, size_t const thread_count)
+{
+    size_t const n = text.size();
+
+    std::vector<size_t> sa(n);
+    std::vector<size_t> rank(n);      // The rank of a suffix is the index of the first entry of its group in sa.
+    std::vector<size_t> next_rank(n);
+
+    // Bucket the suffixes by their first symbol (counting sort) and derive the initial ranks.
+    {
+        std::array<size_t, 257> bucket{};
+        for (size_t position = 0; position < n; ++position)
+            ++bucket[static_cast<uint8_t>(text[position]) + 1];
+        for (size_t symbol = 1; symbol < bucket.size(); ++symbol)
+            bucket[symbol] += bucket[symbol - 1];
+        for (size_t position = 0; position < n; ++position)
+            sa[bucket[text[position]]++] = position;
+
+        rank[sa[0]] = 0;
+        for (size_t i = 1; i < n; ++i)
+            rank[sa[i]] = (text[sa[i]] != text[sa[i - 1]]) ? i : rank[sa[i - 1]];
+    }
+
+    // Rank of the suffix k positions to the right; suffixes running over the end compare smallest.
+    auto rank_at_offset = [&] (size_t const position, size_t const k) -> size_t
+    {
+        return (position + k < n) ? rank[position + k] + 1 : 0;
+    };
+
+    for (size_t k = 1; k < n; k <<= 1)
+    {
+        // Collect the groups of suffixes that still share their rank, i.e. their first k symbols.
+        std::vector<std::pair<size_t, size_t>> groups{};
+        for (size_t i = 0; i < n;)
+        {
+            size_t j = i + 1;
+            while (j < n && rank[sa[j]] == rank[sa[i]])
+                ++j;
+            if (j - i > 1)
+                groups.emplace_back(i, j);
+            i = j;
+        }
+
+        if (groups.empty()) // All ranks are unique; the suffix array is sorted.
+            break;
+
+        // Sort the groups concurrently; inside one group only the rank at offset k decides the order.
+        auto sort_groups = [&] (size_t const first_group, size_t const stride)
+        {
+            for (size_t g = first_group; g < groups.size(); g += stride)
+            {
+                auto [group_begin, group_end] = groups[g];
+                std::sort(sa.begin() + group_begin, sa.begin() + group_end,
+                          [&] (size_t const lhs, size_t const rhs)
+                          {
+                              return rank_at_offset(lhs, k) < rank_at_offset(rhs, k);
+                          });
+            }
+        };
+
+        size_t const worker_count = std::min(std::max<size_t>(thread_count, 1), groups.size());
+        if (worker_count > 1)
+        {
+            std::vector<std::thread> workers{};
+            for (size_t worker = 1; worker < worker_count; ++worker)
+                workers.emplace_back(sort_groups, worker, worker_count);
+            sort_groups(0, worker_count);
+            for (std::thread & worker : workers)
+                worker.join();
+        }
+        else
+        {
+            sort_groups(0, 1);
+        }
+
+        // Refine the ranks: suffixes that still compare equal keep the group begin index as their rank.
+        next_rank[sa[0]] = 0;
+        for (size_t i = 1; i < n; ++i)
+        {
+            bool const differs = rank[sa[i]] != rank[sa[i - 1]] ||
+                                 rank_at_offset(sa[i], k) != rank_at_offset(sa[i - 1], k);
+            next_rank[sa[i]] = differs ? i : next_rank[sa[i - 1]];
+        }
+        std::swap(rank, next_rank);
+    }
+
+    sdsl::int_vector<> result(n, 0, sdsl::bits::hi(std::max<size_t>(n, 1)) + 1);
+    std::copy(sa.begin(), sa.end(), result.begin());
+    return result;
+}
+
+} // namespace seqan3::detail
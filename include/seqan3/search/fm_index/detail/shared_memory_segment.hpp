@@ -0,0 +1,192 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::shared_memory_segment.
+ */
+
+#pragma once
+
+#include <string>
+#include <utility>
+
+#include <seqan3/core/platform.hpp>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace seqan3::detail
+{
+
+/*!\brief A named POSIX shared-memory segment.
+ * \ingroup submodule_fm_index
+ *
+ * \details
+ *
+ * Wraps `shm_open`/`mmap` analogously to seqan3::detail::memory_mapped_file: a segment created by one
+ * process can be attached read-only by any other process on the same host and all attachments share one
+ * physical copy of the pages. The segment persists independently of the creating process until it is
+ * unlink()ed (or the host reboots).
+ *
+ * Segment names must start with a slash and contain no further slashes (e.g. `"/seqan3_hg38_index"`).
+ *
+ * On platforms without POSIX shared memory (see seqan3::detail::shared_memory_segment::supported) objects
+ * of this class never open.
+ */
+class shared_memory_segment
+{
+public:
+    //!\brief Whether POSIX shared memory is available on this platform.
+#if defined(__unix__) || defined(__APPLE__)
+    static constexpr bool supported = true;
+#else
+    static constexpr bool supported = false;
+#endif
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    shared_memory_segment() = default;                                       //!< Defaulted.
+    shared_memory_segment(shared_memory_segment const &) = delete;           //!< Deleted; the mapping is exclusively owned.
+    shared_memory_segment & operator=(shared_memory_segment const &) = delete; //!< Deleted.
+
+    //!\brief Move constructs from `other`, which is left closed.
+    shared_memory_segment(shared_memory_segment && other) noexcept
+    {
+        std::swap(mapped_data, other.mapped_data);
+        std::swap(mapped_size, other.mapped_size);
+    }
+
+    //!\brief Move assigns from `other`, which is left closed.
+    shared_memory_segment & operator=(shared_memory_segment && other) noexcept
+    {
+        std::swap(mapped_data, other.mapped_data);
+        std::swap(mapped_size, other.mapped_size);
+        return *this;
+    }
+
+    //!\brief Unmaps the segment (the segment itself persists until unlink()).
+    ~shared_memory_segment()
+    {
+#if defined(__unix__) || defined(__APPLE__)
+        if (mapped_data != nullptr)
+            ::munmap(mapped_data, mapped_size);
+#endif
+    }
+    //!\}
+
+    /*!\brief Creates (or truncates) a segment of the given size and maps it writable.
+     * \param[in] name The segment name.
+     * \param[in] size The segment size in bytes; must be greater than 0.
+     * \returns The mapped segment; closed (see is_open()) on failure.
+     */
+    static shared_memory_segment create([[maybe_unused]] std::string const & name,
+                                        [[maybe_unused]] size_t const size) noexcept
+    {
+        shared_memory_segment segment{};
+#if defined(__unix__) || defined(__APPLE__)
+        int const fd = ::shm_open(name.c_str(), O_CREAT | O_TRUNC | O_RDWR, S_IRUSR | S_IWUSR);
+        if (fd == -1)
+            return segment;
+
+        if (size == 0 || ::ftruncate(fd, static_cast<off_t>(size)) == -1)
+        {
+            ::close(fd);
+            ::shm_unlink(name.c_str());
+            return segment;
+        }
+
+        void * const mapped = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd); // The mapping stays valid after closing the descriptor.
+
+        if (mapped == MAP_FAILED)
+        {
+            ::shm_unlink(name.c_str());
+            return segment;
+        }
+
+        segment.mapped_data = static_cast<char *>(mapped);
+        segment.mapped_size = size;
+#endif
+        return segment;
+    }
+
+    /*!\brief Attaches an existing segment read-only; writing through data() is undefined behaviour.
+     * \param[in] name The segment name.
+     * \returns The mapped segment; closed (see is_open()) on failure.
+     */
+    static shared_memory_segment attach([[maybe_unused]] std::string const & name) noexcept
+    {
+        shared_memory_segment segment{};
+#if defined(__unix__) || defined(__APPLE__)
+        int const fd = ::shm_open(name.c_str(), O_RDONLY, 0);
+        if (fd == -1)
+            return segment;
+
+        struct stat segment_status{};
+        if (::fstat(fd, &segment_status) == -1 || segment_status.st_size <= 0)
+        {
+            ::close(fd);
+            return segment;
+        }
+
+        void * const mapped = ::mmap(nullptr, static_cast<size_t>(segment_status.st_size),
+                                     PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+
+        if (mapped == MAP_FAILED)
+            return segment;
+
+        segment.mapped_data = static_cast<char *>(mapped);
+        segment.mapped_size = static_cast<size_t>(segment_status.st_size);
+#endif
+        return segment;
+    }
+
+    /*!\brief Removes the name of a segment; the pages are freed once the last attachment unmaps.
+     * \param[in] name The segment name.
+     * \returns `true` if the segment was successfully unlinked.
+     */
+    static bool unlink([[maybe_unused]] std::string const & name) noexcept
+    {
+#if defined(__unix__) || defined(__APPLE__)
+        return ::shm_unlink(name.c_str()) == 0;
+#else
+        return false;
+#endif
+    }
+
+    //!\brief Whether the segment was successfully mapped.
+    bool is_open() const noexcept
+    {
+        return mapped_data != nullptr;
+    }
+
+    //!\brief Returns a pointer to the mapped segment (read-only for attached segments).
+    char * data() const noexcept
+    {
+        return mapped_data;
+    }
+
+    //!\brief Returns the size of the mapped segment in bytes.
+    size_t size() const noexcept
+    {
+        return mapped_size;
+    }
+
+private:
+    //!\brief The begin of the mapping; `nullptr` if no segment is mapped.
+    char * mapped_data{nullptr};
+    //!\brief The length of the mapping in bytes.
+    size_t mapped_size{0};
+};
+
+} // namespace seqan3::detail
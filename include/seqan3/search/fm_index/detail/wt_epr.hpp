@@ -0,0 +1,350 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides an EPR-dictionary (enhanced prefixsum rank) occurrence table usable as wavelet tree
+ *        replacement inside sdsl::csa_wt.
+ * \details The class follows the interface of the SDSL wavelet trees and therefore lives in namespace sdsl,
+ *          like the alphabet strategy in seqan3/search/fm_index/detail/csa_alphabet_strategy.hpp.
+ */
+
+#pragma once
+
+#include <array>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include <sdsl/bits.hpp>
+#include <sdsl/int_vector.hpp>
+#include <sdsl/int_vector_buffer.hpp>
+#include <sdsl/sdsl_concepts.hpp>
+#include <sdsl/util.hpp>
+
+namespace sdsl
+{
+
+/*!\brief An EPR-dictionary over small alphabets with constant-time, cache-local rank support.
+ * \tparam t_width The number of bits per symbol; the dictionary supports symbols `0 .. 2^t_width - 1`.
+ *
+ * \details
+ *
+ * The symbols are stored bit-plane interleaved in blocks of 64 positions: plane `p` of block `b` is one
+ * 64 bit word holding bit `p` of the 64 symbol codes, and the `t_width` plane words of a block are adjacent
+ * in memory. A rank query therefore reads the (pre-accumulated) block and superblock counters plus the plane
+ * words of a single block — independent of the alphabet size and without the \f$\log \sigma\f$ cascade of
+ * rank queries a wavelet tree performs per character.
+ *
+ * Since all symbol codes of a block come from the same few words, the ranks of *all* symbols at one position
+ * are available nearly for the price of one (see all_ranks()), which the seqan3::fm_index_cursor exploits to
+ * enumerate the children of a suffix tree node in a single pass.
+ *
+ * select() is implemented as a binary search over rank() and hence costs \f$O(\log n)\f$; it only backs the
+ * \f$\Psi\f$ access of sdsl::csa_wt and does not occur on the search path.
+ *
+ * The memory consumption is `t_width` bits per position plus `2^t_width * 16` bits per block and
+ * `2^t_width * 64` bits per superblock of 65536 positions for the counters.
+ */
+template <uint8_t t_width = 3>
+class wt_epr
+{
+    static_assert(t_width >= 1 && t_width <= 8, "The symbol width must be in [1, 8].");
+
+    //!\cond
+public:
+    typedef int_vector<>::size_type size_type;
+    typedef uint8_t value_type;
+    typedef wt_tag index_category;
+    typedef byte_alphabet_tag alphabet_category;
+    enum { lex_ordered = 1 }; // The symbol codes are the symbols themselves.
+
+    //!\brief The number of representable symbols.
+    static constexpr size_type max_sigma = size_type{1} << t_width;
+
+private:
+    //!\brief The number of positions covered by one block (one 64 bit word per plane).
+    static constexpr size_type block_size = 64;
+    //!\brief The number of positions covered by one superblock; block counters are relative to it.
+    static constexpr size_type superblock_size = 65536;
+
+    size_type m_size = 0;   // The number of stored symbols.
+    uint16_t m_sigma = 0;   // Effective alphabet size, i.e. largest occurring symbol + 1.
+    int_vector<64> m_planes;             // t_width interleaved plane words per block.
+    int_vector<64> m_superblock_counts; // Cumulative symbol counts before each superblock.
+    int_vector<16> m_block_counts;       // Symbol counts between superblock begin and block begin.
+
+    //!\brief Returns the word marking the positions of block `block` that hold symbol `c`.
+    uint64_t match_word(size_type const block, value_type const c) const
+    {
+        uint64_t match = ~uint64_t{0};
+        for (uint8_t plane = 0; plane < t_width; ++plane)
+        {
+            uint64_t const word = m_planes[block * t_width + plane];
+            match &= ((c >> plane) & 1u) ? word : ~word;
+        }
+        return match;
+    }
+
+public:
+    const uint16_t & sigma;
+
+    //! Default constructor
+    wt_epr() : sigma(m_sigma)
+    {}
+
+    /*! Construct from a byte-stream (e.g. the Burrows-Wheeler transform during sdsl::csa_wt assembly).
+     *  \param text_buf Byte stream.
+     *  \param size     Length of the byte stream.
+     */
+    wt_epr(int_vector_buffer<8> & text_buf, size_type const size) : m_size(size), sigma(m_sigma)
+    {
+        if (size == 0)
+            return;
+
+        size_type const block_count = (size + block_size - 1) / block_size;
+        m_planes = int_vector<64>(block_count * t_width, 0);
+        m_superblock_counts = int_vector<64>((size / superblock_size + 1) * max_sigma, 0);
+        m_block_counts = int_vector<16>((block_count + 1) * max_sigma, 0);
+
+        std::array<size_type, max_sigma> total_counts{};      // Counts since the begin of the text.
+        std::array<size_type, max_sigma> superblock_counts{}; // Counts since the begin of the superblock.
+
+        // Stores the counters of the (super)block beginning at the given position.
+        auto store_counts = [&] (size_type const position)
+        {
+            if (position % superblock_size == 0)
+            {
+                for (size_type c = 0; c < max_sigma; ++c)
+                    m_superblock_counts[(position / superblock_size) * max_sigma + c] = total_counts[c];
+                superblock_counts.fill(0);
+            }
+            for (size_type c = 0; c < max_sigma; ++c)
+                m_block_counts[(position / block_size) * max_sigma + c] = superblock_counts[c];
+        };
+
+        for (size_type i = 0; i < size; ++i)
+        {
+            if (i % block_size == 0)
+                store_counts(i);
+
+            uint8_t const symbol = text_buf[i];
+            if (symbol >= max_sigma)
+                throw std::invalid_argument("The EPR dictionary cannot represent symbol " +
+                                            std::to_string(symbol) + " with " + std::to_string(t_width) +
+                                            " bits per symbol.");
+
+            for (uint8_t plane = 0; plane < t_width; ++plane)
+                if ((symbol >> plane) & 1u)
+                    m_planes[(i / block_size) * t_width + plane] |= uint64_t{1} << (i % block_size);
+
+            ++total_counts[symbol];
+            ++superblock_counts[symbol];
+            m_sigma = std::max<uint16_t>(m_sigma, symbol + 1);
+        }
+
+        if (size % block_size == 0) // Counters one past the last full block back rank(size(), c).
+            store_counts(size);
+    }
+
+    wt_epr(wt_epr const & other) : m_size(other.m_size),
+                                   m_sigma(other.m_sigma),
+                                   m_planes(other.m_planes),
+                                   m_superblock_counts(other.m_superblock_counts),
+                                   m_block_counts(other.m_block_counts),
+                                   sigma(m_sigma)
+    {}
+
+    wt_epr(wt_epr && other) : m_size(other.m_size),
+                              m_sigma(other.m_sigma),
+                              m_planes(std::move(other.m_planes)),
+                              m_superblock_counts(std::move(other.m_superblock_counts)),
+                              m_block_counts(std::move(other.m_block_counts)),
+                              sigma(m_sigma)
+    {}
+
+    wt_epr & operator=(wt_epr const & other)
+    {
+        if (this != &other)
+        {
+            wt_epr tmp(other);
+            *this = std::move(tmp);
+        }
+        return *this;
+    }
+
+    wt_epr & operator=(wt_epr && other)
+    {
+        if (this != &other)
+        {
+            m_size = other.m_size;
+            m_sigma = other.m_sigma;
+            m_planes = std::move(other.m_planes);
+            m_superblock_counts = std::move(other.m_superblock_counts);
+            m_block_counts = std::move(other.m_block_counts);
+        }
+        return *this;
+    }
+
+    void swap(wt_epr & other)
+    {
+        std::swap(m_size, other.m_size);
+        std::swap(m_sigma, other.m_sigma);
+        m_planes.swap(other.m_planes);
+        m_superblock_counts.swap(other.m_superblock_counts);
+        m_block_counts.swap(other.m_block_counts);
+    }
+
+    //! Returns the number of stored symbols.
+    size_type size() const
+    {
+        return m_size;
+    }
+
+    //! Returns the symbol at position `i`.
+    value_type operator[](size_type const i) const
+    {
+        assert(i < m_size);
+        value_type symbol = 0;
+        for (uint8_t plane = 0; plane < t_width; ++plane)
+            symbol |= ((m_planes[(i / block_size) * t_width + plane] >> (i % block_size)) & 1u) << plane;
+        return symbol;
+    }
+
+    /*! Returns the number of occurrences of symbol `c` in the prefix [0..i-1].
+     *  \param i Exclusive right bound of the prefix; `i <= size()`.
+     *  \param c The symbol.
+     */
+    size_type rank(size_type const i, value_type const c) const
+    {
+        assert(i <= m_size);
+        assert(c < max_sigma);
+
+        size_type result = m_superblock_counts[(i / superblock_size) * max_sigma + c]
+                         + m_block_counts[(i / block_size) * max_sigma + c];
+        if (size_type const offset = i % block_size; offset != 0)
+            result += bits::cnt(match_word(i / block_size, c) & bits::lo_set[offset]);
+        return result;
+    }
+
+    /*! Returns the ranks of all symbols at position `i` at once.
+     *  \param i Exclusive right bound of the prefix; `i <= size()`.
+     *
+     *  All ranks share the block and plane words, such that the bulk query costs barely more than a single
+     *  rank query.
+     */
+    std::array<size_type, max_sigma> all_ranks(size_type const i) const
+    {
+        assert(i <= m_size);
+
+        size_type const block = i / block_size;
+        size_type const offset = i % block_size;
+
+        std::array<uint64_t, t_width> planes{};
+        if (offset != 0)
+            for (uint8_t plane = 0; plane < t_width; ++plane)
+                planes[plane] = m_planes[block * t_width + plane];
+
+        std::array<size_type, max_sigma> result{};
+        for (size_type c = 0; c < max_sigma; ++c)
+        {
+            result[c] = m_superblock_counts[(i / superblock_size) * max_sigma + c]
+                      + m_block_counts[block * max_sigma + c];
+            if (offset != 0)
+            {
+                uint64_t match = ~uint64_t{0};
+                for (uint8_t plane = 0; plane < t_width; ++plane)
+                    match &= ((c >> plane) & 1u) ? planes[plane] : ~planes[plane];
+                result[c] += bits::cnt(match & bits::lo_set[offset]);
+            }
+        }
+        return result;
+    }
+
+    //! Returns the pair (rank(i, T[i]), T[i]).
+    std::pair<size_type, value_type> inverse_select(size_type const i) const
+    {
+        assert(i < m_size);
+        value_type const c = (*this)[i];
+        return {rank(i, c), c};
+    }
+
+    /*! Prefetches the block that a rank or inverse_select query for position `i` will access.
+     *
+     *  Only issues non-binding cache line hints; the dictionary is not modified.
+     */
+    void prefetch(size_type const i) const
+    {
+        assert(i <= m_size);
+        __builtin_prefetch(m_planes.data() + (i / block_size) * t_width);
+        __builtin_prefetch(m_block_counts.data() + (i / block_size) * max_sigma / 4);
+    }
+
+    /*! Returns the position of the `i`-th occurrence (1-based) of symbol `c`.
+     *
+     *  Binary search over rank(), i.e. \f$O(\log n)\f$; only used for \f$\Psi\f$ access.
+     */
+    size_type select(size_type const i, value_type const c) const
+    {
+        assert(1 <= i && i <= rank(m_size, c));
+
+        size_type lb = 0, rb = m_size - 1;
+        while (lb < rb)
+        {
+            size_type const mid = lb + (rb - lb) / 2;
+            if (rank(mid + 1, c) < i)
+                lb = mid + 1;
+            else
+                rb = mid;
+        }
+        return lb;
+    }
+
+    /*! Returns the triple (rank(i, c), #symbols smaller than `c` in [i..j-1], #symbols greater than `c`
+     *  in [i..j-1]).
+     */
+    std::tuple<size_type, size_type, size_type> lex_count(size_type const i, size_type const j,
+                                                          value_type const c) const
+    {
+        assert(i <= j && j <= m_size);
+
+        std::array<size_type, max_sigma> const ranks_i = all_ranks(i);
+        std::array<size_type, max_sigma> const ranks_j = all_ranks(j);
+
+        size_type smaller = 0, greater = 0;
+        for (size_type d = 0; d < c; ++d)
+            smaller += ranks_j[d] - ranks_i[d];
+        for (size_type d = c + 1; d < max_sigma; ++d)
+            greater += ranks_j[d] - ranks_i[d];
+        return {ranks_i[c], smaller, greater};
+    }
+
+    size_type serialize(std::ostream & out, structure_tree_node * v = nullptr, std::string name = "") const
+    {
+        structure_tree_node * child = structure_tree::add_child(v, name, util::class_name(*this));
+        size_type written_bytes = 0;
+        written_bytes += write_member(m_size, out, child, "m_size");
+        written_bytes += write_member(m_sigma, out, child, "m_sigma");
+        written_bytes += m_planes.serialize(out, child, "m_planes");
+        written_bytes += m_superblock_counts.serialize(out, child, "m_superblock_counts");
+        written_bytes += m_block_counts.serialize(out, child, "m_block_counts");
+        structure_tree::add_size(child, written_bytes);
+        return written_bytes;
+    }
+
+    void load(std::istream & in)
+    {
+        read_member(m_size, in);
+        read_member(m_sigma, in);
+        m_planes.load(in);
+        m_superblock_counts.load(in);
+        m_block_counts.load(in);
+    }
+    //!\endcond
+};
+
+} // namespace sdsl
@@ -12,15 +12,30 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+
 #include <sdsl/suffix_trees.hpp>
 
+#include <seqan3/core/memory_stats.hpp>
 #include <seqan3/core/metafunction/range.hpp>
+#include <seqan3/core/metafunction/template_inspection.hpp>
 #include <seqan3/std/filesystem>
+#include <seqan3/range/container/bitcompressed_vector.hpp>
+#include <seqan3/range/container/concatenated_sequences.hpp>
 #include <seqan3/range/shortcuts.hpp>
 #include <seqan3/range/view/to_rank.hpp>
 #include <seqan3/search/fm_index/concept.hpp>
 #include <seqan3/search/fm_index/detail/csa_alphabet_strategy.hpp>
 #include <seqan3/search/fm_index/detail/fm_index_cursor.hpp>
+#include <seqan3/search/fm_index/detail/index_container_format.hpp>
+#include <seqan3/search/fm_index/detail/memory_mapped_file.hpp>
+#include <seqan3/search/fm_index/detail/parallel_suffix_array.hpp>
+#include <seqan3/search/fm_index/detail/shared_memory_segment.hpp>
+#include <seqan3/search/fm_index/detail/wt_epr.hpp>
 #include <seqan3/search/fm_index/fm_index_cursor.hpp>
 #include <seqan3/std/ranges>
 
@@ -34,6 +49,11 @@ class fm_index_cursor;
 
 template <typename index_t>
 class bi_fm_index_cursor;
+
+namespace detail
+{
+struct in_text_verification_access;
+}
 //!\endcond
 
 /*!\addtogroup submodule_fm_index
@@ -88,6 +108,73 @@ struct fm_index_default_traits
     >;
 };
 
+/*!\brief An FM Index Configuration with configurable suffix array sampling density.
+ * \tparam sa_sampling_rate  Every `sa_sampling_rate`-th suffix array entry is stored explicitly; all other
+ *                           entries are resolved by up to `sa_sampling_rate - 1` LF steps. A smaller rate
+ *                           makes seqan3::fm_index_cursor::locate() faster at the cost of
+ *                           \f$\frac{n \cdot 64}{sa\_sampling\_rate}\f$ bits of additional memory.
+ * \tparam isa_sampling_rate Sampling rate of the inverse suffix array, analogously.
+ *
+ * \details
+ *
+ * Identical to seqan3::fm_index_default_traits except for the sampling rates, which allow trading memory for
+ * locate latency: locate-heavy workloads benefit from dense sampling (e.g. seqan3::fm_index_fast_locate_traits),
+ * workloads that only count or that never locate can use sparse sampling (e.g.
+ * seqan3::fm_index_small_memory_traits). The defaults are the values of seqan3::fm_index_default_traits.
+ */
+template <uint32_t sa_sampling_rate = 16, uint32_t isa_sampling_rate = 10000000>
+struct fm_index_sampling_traits
+{
+    //!\brief Type of the underlying SDSL index.
+    using sdsl_index_type = sdsl::csa_wt<
+        sdsl::wt_blcd<
+            sdsl::bit_vector,
+            sdsl::rank_support_v<>,
+            sdsl::select_support_scan<>,
+            sdsl::select_support_scan<0>
+        >,
+        sa_sampling_rate,
+        isa_sampling_rate,
+        sdsl::sa_order_sa_sampling<>,
+        sdsl::isa_sampling<>,
+        sdsl::plain_byte_alphabet
+    >;
+};
+
+//!\brief An FM Index Configuration with dense suffix array sampling for locate-heavy workloads.
+using fm_index_fast_locate_traits = fm_index_sampling_traits<4>;
+
+//!\brief An FM Index Configuration with sparse suffix array sampling for workloads that rarely locate.
+using fm_index_small_memory_traits = fm_index_sampling_traits<64>;
+
+/*!\brief An FM Index Configuration that uses an EPR dictionary as occurrence table.
+ *
+ * \details
+ *
+ * Replaces the wavelet tree of seqan3::fm_index_default_traits with an EPR dictionary (sdsl::wt_epr):
+ * a single backward search step then costs one cache-local, constant-time rank query instead of a cascade of
+ * \f$\log \Sigma\f$ rank queries, and seqan3::fm_index_cursor::extend_right() /
+ * seqan3::fm_index_cursor::cycle_back() enumerate all children of a suffix tree node with two bulk rank
+ * queries instead of one backward search per character. This trades a moderately larger index for
+ * considerably faster searches.
+ *
+ * \attention The EPR dictionary stores three bits per symbol, i.e. it supports alphabets with up to eight
+ *            symbols including the sentinel and the collection delimiter — e.g. seqan3::dna4, seqan3::dna5
+ *            and other nucleotide alphabets, but not seqan3::aa27.
+ */
+struct fm_index_epr_traits
+{
+    //!\brief Type of the underlying SDSL index.
+    using sdsl_index_type = sdsl::csa_wt<
+        sdsl::wt_epr<3>,
+        16,
+        10000000,
+        sdsl::sa_order_sa_sampling<>,
+        sdsl::isa_sampling<>,
+        sdsl::plain_byte_alphabet
+    >;
+};
+
 /*!\brief The SeqAn FM Index.
  * \implements seqan3::FmIndex
  * \tparam text_t The type of the text to be indexed; must model std::ranges::ForwardRange.
@@ -116,7 +203,10 @@ struct fm_index_default_traits
  *
  * ### Choosing an index implementation
  *
- * \todo The underlying implementation of the FM Index (Rank data structure, sampling rates, etc.) can be specified ...
+ * The underlying implementation of the FM Index (rank data structure, sampling rates, etc.) is specified by the
+ * traits object: seqan3::fm_index_default_traits is a good general purpose choice, seqan3::fm_index_epr_traits
+ * trades memory for faster searches on small alphabets, and seqan3::fm_index_sampling_traits exposes the suffix
+ * array sampling density to trade memory for locate latency.
  */
 template <std::ranges::RandomAccessRange text_t, FmIndexTraits fm_index_traits = fm_index_default_traits>
 //!\cond
@@ -153,6 +243,113 @@ protected:
     //!\brief Rank support for text_begin.
     sdsl::rank_support_sd<1> text_begin_rs;
 
+    /*!\brief Assembles the underlying SDSL index from the prepared rank sequence.
+     * \param[in,out] tmp_text     The reversed text with all ranks increased by one; consumed by the construction.
+     * \param[in]     thread_count The number of threads to construct with.
+     *
+     * \details
+     *
+     * With more than one thread the suffix array is precomputed via seqan3::detail::parallel_suffix_array and
+     * placed in the construction cache, such that the remaining index assembly (BWT, wavelet tree and samplings)
+     * reuses it instead of running the sequential suffix array construction of the SDSL. The cache directory `"@"`
+     * keeps all intermediate files in memory (sdsl ram files), mirroring the behaviour of sdsl::construct_im.
+     * The cache ids are generated from an own atomic counter, because the id generation of the SDSL is not thread
+     * safe and multiple indices may be constructed concurrently (see seqan3::bi_fm_index::construct).
+     */
+    void construct_sdsl_index(sdsl::int_vector<8> & tmp_text, size_t const thread_count)
+    {
+        sdsl::cache_config config{make_cache_config()};
+
+        sdsl::append_zero_symbol(tmp_text);
+        sdsl::store_to_cache(tmp_text, sdsl::conf::KEY_TEXT, config);
+        sdsl::register_cache_file(sdsl::conf::KEY_TEXT, config);
+
+        if (thread_count > 1)
+        {
+            sdsl::int_vector<> suffix_array = detail::parallel_suffix_array(tmp_text, thread_count);
+            sdsl::store_to_cache(suffix_array, sdsl::conf::KEY_SA, config);
+            sdsl::register_cache_file(sdsl::conf::KEY_SA, config);
+        }
+
+        sdsl::construct(index, sdsl::cache_file_name(sdsl::conf::KEY_TEXT, config), config, 0);
+
+        detail::record_memory_use(memory_stats::subsystem::index, sdsl::size_in_bytes(index));
+    }
+
+    //!\brief Creates a fresh construction cache configuration with a process-unique id (see
+    //!       construct_sdsl_index for why the ids come from an own atomic counter).
+    static sdsl::cache_config make_cache_config()
+    {
+        static std::atomic<uint64_t> id_count{0};
+        return sdsl::cache_config{true, "@", sdsl::util::to_string(sdsl::util::pid()) + "_seqan3_"
+                                             + sdsl::util::to_string(id_count++)};
+    }
+
+    /*!\brief A read-only random access view of the construction text of a bit-packed input, i.e. the reversed
+     *        text with all ranks increased by one followed by the sentinel `0`, read straight from the packed
+     *        storage. Only used when `text_t` is a seqan3::bitcompressed_vector
+     *        (see construct_sdsl_index_packed).
+     */
+    struct packed_construction_text
+    {
+        //!\brief The packed text the view reads from.
+        text_t const * packed_text;
+
+        //!\brief Returns the construction symbol at `position`; position `size() - 1` is the sentinel.
+        uint8_t operator[](size_t const position) const noexcept
+        {
+            size_t const text_size = packed_text->size();
+            return (position < text_size) ? static_cast<uint8_t>(to_rank((*packed_text)[text_size - 1 - position]) + 1)
+                                          : uint8_t{0};
+        }
+
+        //!\brief Returns the length of the construction text (the text length plus the sentinel).
+        size_t size() const noexcept
+        {
+            return packed_text->size() + 1;
+        }
+    };
+
+    /*!\brief Assembles the underlying SDSL index from a bit-packed text without widening it for the suffix
+     *        array construction.
+     * \param[in] packed_text  The bit-packed text to index.
+     * \param[in] thread_count The number of threads to construct with.
+     *
+     * \details
+     *
+     * Mirrors construct_sdsl_index(), but reorders the steps: with more than one thread the suffix array is
+     * built first, with seqan3::detail::parallel_suffix_array reading the construction symbols through
+     * packed_construction_text straight from the packed storage. The byte-wide copy of the text that the
+     * remaining SDSL assembly itself requires is materialised only afterwards and hence does not add to the
+     * memory peak of the suffix array construction — for a seqan3::dna4 text the suffix array stage reads
+     * 2 bits instead of 8 bits per symbol. With a single thread the SDSL's own suffix array construction
+     * runs on the byte-wide copy and the gain reduces to never expanding the input text on the caller's side.
+     */
+    void construct_sdsl_index_packed(text_t const & packed_text, size_t const thread_count)
+    {
+        sdsl::cache_config config{make_cache_config()};
+
+        packed_construction_text const construction_text{&packed_text};
+
+        if (thread_count > 1)
+        {
+            sdsl::int_vector<> suffix_array = detail::parallel_suffix_array(construction_text, thread_count);
+            sdsl::store_to_cache(suffix_array, sdsl::conf::KEY_SA, config);
+            sdsl::register_cache_file(sdsl::conf::KEY_SA, config);
+        }
+
+        sdsl::int_vector<8> tmp_text(construction_text.size()); // widened only for the remaining assembly
+        for (size_t position = 0; position < construction_text.size(); ++position)
+            tmp_text[position] = construction_text[position];
+
+        sdsl::store_to_cache(tmp_text, sdsl::conf::KEY_TEXT, config);
+        sdsl::register_cache_file(sdsl::conf::KEY_TEXT, config);
+
+        sdsl::construct(index, sdsl::cache_file_name(sdsl::conf::KEY_TEXT, config), config, 0);
+
+        detail::record_memory_use(memory_stats::subsystem::index, sdsl::size_in_bytes(index));
+    }
+
 public:
     /*!\name Member types
      * \{
@@ -182,6 +379,8 @@ public:
     template <typename fm_index_t>
     friend class detail::fm_index_cursor_node;
 
+    friend struct detail::in_text_verification_access;
+
     /*!\name Constructors, destructor and assignment
      * \{
      */
@@ -196,14 +395,15 @@ public:
               The range cannot be an rvalue (i.e. a temporary object) and has to be non-empty.
      * \tparam text_t The type of range to construct from; must model std::ranges::RandomAccessRange.
      * \param[in] text The text to construct from.
+     * \param[in] thread_count The number of threads to construct with (see seqan3::fm_index::construct).
      *
      * ### Complexity
      *
      * \todo At least linear.
      */
-    fm_index(text_t const & text)
+    fm_index(text_t const & text, size_t const thread_count = 1)
     {
-        construct(text);
+        construct(text, thread_count);
     }
 
     //!\overload
@@ -217,10 +417,18 @@ public:
               The range cannot be an rvalue (i.e. a temporary object) and has to be non-empty.
      * \tparam text_t The type of range to construct from; must model std::ranges::RandomAccessRange.
      * \param[in] text The text to construct from.
+     * \param[in] thread_count The number of threads to construct with. With more than one thread the suffix array
+     *                         is built in parallel (see seqan3::detail::parallel_suffix_array) before the remaining
+     *                         index structures are assembled; the resulting index is identical to a single-threaded
+     *                         construction.
      *
      * \details \todo This has to be better implemented with regard to the memory peak due to not matching interfaces
      *                with the SDSL.
      *
+     * If the text is a seqan3::bitcompressed_vector, the construction reads the packed ranks directly and — when
+     * constructing with more than one thread — builds the suffix array before the byte-wide working copy of the
+     * text is materialised, lowering the memory peak of the construction (see construct_sdsl_index_packed).
+     *
      * ### Complexity
      *
      * \todo At least linear.
@@ -229,7 +437,7 @@ public:
      *
      * No guarantees.
      */
-    void construct(text_t const & text)
+    void construct(text_t const & text, size_t const thread_count = 1)
         //!\cond
         requires !is_collection
         //!\endcond
@@ -239,6 +447,16 @@ public:
             throw std::invalid_argument("The text that is indexed cannot be empty.");
 
         this->text = &text;
+
+        if constexpr (detail::is_type_specialisation_of_v<text_t, bitcompressed_vector> &&
+                      alphabet_size_v<char_type> < 256)
+        {
+            // The text is already rank-packed; feed it into the construction directly instead of widening it
+            // to one byte per symbol before the suffix array is built (see construct_sdsl_index_packed).
+            construct_sdsl_index_packed(text, thread_count);
+            return;
+        }
+
         // TODO:
         // * check what happens in sdsl when constructed twice!
         // * choose between in-memory/external and construction algorithms
@@ -262,7 +480,7 @@ public:
                           | std::view::reverse,
                           seqan3::begin(tmp_text)); // reverse and increase rank by one
 
-        sdsl::construct_im(index, tmp_text, 0);
+        construct_sdsl_index(tmp_text, thread_count);
 
         // TODO: would be nice but doesn't work since it's private and the public member references are const
         // index.m_C.resize(largest_char);
@@ -271,7 +489,7 @@ public:
     }
 
     //!\overload
-    void construct(text_t const & text)
+    void construct(text_t const & text, size_t const thread_count = 1)
         //!\cond
         requires is_collection
         //!\endcond
@@ -317,37 +535,55 @@ public:
 
         uint8_t delimiter = alphabet_size_v<char_type> >= 255 ? 255 : alphabet_size_v<char_type> + 1;
 
-        std::vector<uint8_t> tmp = text
-                                   | view::deep{view::to_rank}
-                                   | view::deep
-                                   {
-                                       std::view::transform([] (uint8_t const r)
-                                       {
-                                           if constexpr (alphabet_size_v<char_type> >= 255)
-                                           {
-                                               if (r >= 254)
-                                                   throw std::out_of_range("The input text cannot be indexed, because"
-                                                                           " for full character alphabets the last one/"
-                                                                           "two values are reserved (single sequence/"
-                                                                           "collection).");
-                                           }
-                                           return r + 1;
-                                       })
-                                   }
-                                   | std::view::join(delimiter);
-
-        std::ranges::copy((tmp | std::view::reverse), seqan3::begin(tmp_text));
-
-        //!\todo Replace with this once this does not cause debug builds to exceed max memory on travis
-        // std::ranges::copy(text
-        //                   | view::deep{view::to_rank}
-        //                   | view::deep{std::view::transform([] (uint8_t const r) { return r + 1; })} // increase rank
-        //                   | view::deep{std::view::reverse}
-        //                   | std::view::reverse
-        //                   | std::view::join(delimiter), // join with delimiter
-        //                   seqan3::begin(tmp_text));
-
-        sdsl::construct_im(index, tmp_text, 0);
+        auto checked_rank = [] (uint8_t const r)
+        {
+            if constexpr (alphabet_size_v<char_type> >= 255)
+            {
+                if (r >= 254)
+                    throw std::out_of_range("The input text cannot be indexed, because"
+                                            " for full character alphabets the last one/"
+                                            "two values are reserved (single sequence/"
+                                            "collection).");
+            }
+            return r + 1;
+        };
+
+        if constexpr (detail::is_type_specialisation_of_v<text_t, concatenated_sequences>)
+        {
+            // The concatenation is already stored contiguously: read it through concat() and the delimiter
+            // positions instead of materializing the joined rank sequence a second time before reversing.
+            auto && concatenation = text.concat();
+            auto const & delimiters = text.data().second; // begin positions of the sequences in the concatenation
+
+            size_t out_pos = tmp_text.size(); // filled from the back, i.e. the copy reverses
+            for (size_t sequence_id = 0; sequence_id < text.size(); ++sequence_id)
+            {
+                if (sequence_id > 0)
+                    tmp_text[--out_pos] = delimiter;
+                for (size_t i = delimiters[sequence_id]; i < delimiters[sequence_id + 1]; ++i)
+                    tmp_text[--out_pos] = checked_rank(to_rank(concatenation[i]));
+            }
+        }
+        else
+        {
+            std::vector<uint8_t> tmp = text
+                                       | view::deep{view::to_rank}
+                                       | view::deep{std::view::transform(checked_rank)}
+                                       | std::view::join(delimiter);
+
+            std::ranges::copy((tmp | std::view::reverse), seqan3::begin(tmp_text));
+
+            //!\todo Replace with this once this does not cause debug builds to exceed max memory on travis
+            // std::ranges::copy(text
+            //                   | view::deep{view::to_rank}
+            //                   | view::deep{std::view::transform([] (uint8_t const r) { return r + 1; })} // increase rank
+            //                   | view::deep{std::view::reverse}
+            //                   | std::view::reverse
+            //                   | std::view::join(delimiter), // join with delimiter
+            //                   seqan3::begin(tmp_text));
+        }
+
+        construct_sdsl_index(tmp_text, thread_count);
     }
 
     //!\overload
@@ -461,6 +697,72 @@ public:
         return false;
     }
 
+    /*!\brief Loads the index from disk through read-only, shared memory mappings of the serialized files.
+     * \returns `true` if the index was successfully loaded from disk.
+     *
+     * \details
+     *
+     * Uses the same on-disk layout as load() and store(), but maps the files with `MAP_SHARED` instead of
+     * streaming them: deserialisation reads straight from the page cache, so concurrent jobs on one host that
+     * load the same index share the file pages and a warm cache makes loading close to a page-table operation.
+     * The index structures themselves maintain their own memory after loading, since the sdsl_index_type
+     * containers cannot operate in place on a mapping; only the input path is mapped.
+     *
+     * On platforms without memory mapping this falls back to load().
+     *
+     * ### Complexity
+     *
+     * Linear.
+     *
+     * ### Exceptions
+     *
+     * Strong exception guarantee.
+     */
+    bool load_mmap(std::filesystem::path const & path)
+    {
+        if constexpr (!detail::memory_mapped_file::supported)
+            return load(path);
+
+        std::filesystem::path tb_path{path};
+        std::filesystem::path tb_ss_path{path};
+        std::filesystem::path tb_rs_path{path};
+        tb_path += ".tb";
+        tb_ss_path += ".tbss";
+        tb_rs_path += ".tbrs";
+
+        auto load_mapped = [] (auto & component, std::filesystem::path const & component_path)
+        {
+            detail::memory_mapped_file file{component_path};
+            if (!file.is_open())
+                return false;
+
+            detail::memory_mapped_streambuf buffer{file};
+            std::istream stream{&buffer};
+            component.load(stream);
+            return true;
+        };
+
+        sdsl_index_type tmp_index;
+        sdsl::sd_vector<> tmp_text_begin;
+        sdsl::select_support_sd<1> tmp_text_begin_ss;
+        sdsl::rank_support_sd<1> tmp_text_begin_rs;
+
+        if (load_mapped(tmp_index, path) &&
+            load_mapped(tmp_text_begin, tb_path) &&
+            load_mapped(tmp_text_begin_ss, tb_ss_path) &&
+            load_mapped(tmp_text_begin_rs, tb_rs_path))
+        {
+            std::swap(this->index, tmp_index);
+            std::swap(this->text_begin, tmp_text_begin);
+            std::swap(this->text_begin_ss, tmp_text_begin_ss);
+            std::swap(this->text_begin_rs, tmp_text_begin_rs);
+            text_begin_ss.set_vector(&text_begin);
+            text_begin_rs.set_vector(&text_begin);
+            return true;
+        }
+        return false;
+    }
+
     /*!\brief Stores the index to disk. Temporary function until cereal is supported.
      *        \todo cereal
      * \returns `true` if the index was successfully stored to disk.
@@ -488,6 +790,252 @@ public:
                sdsl::store_to_file(text_begin_rs, tb_rs_path);
     }
 
+    /*!\brief Stores the index as a single versioned container file.
+     * \returns `true` if the container was successfully written.
+     *
+     * \details
+     *
+     * Unlike store(), which writes one bespoke file per component, this writes a single file in the container
+     * format described by seqan3::detail::index_container_header: magic bytes, format version, the alphabet
+     * size, the text dimension and a fingerprint of the index type, followed by the serialized components
+     * behind page aligned padding. load_container() validates all header fields before touching the payload,
+     * so loading a container written for a different alphabet or a differently configured index fails up front
+     * with a clean `false` instead of deep inside the deserialisation.
+     *
+     * ### Complexity
+     *
+     * Linear.
+     *
+     * ### Exceptions
+     *
+     * Strong exception guarantee.
+     */
+    bool store_container(std::filesystem::path const & path) const
+    {
+        std::ofstream out{path, std::ios::binary};
+        if (!out.good())
+            return false;
+
+        detail::index_container_header header{};
+        header.alphabet_id = alphabet_size_v<char_type>;
+        header.text_dimension = dimension_v<text_t>;
+        header.traits_fingerprint = detail::index_traits_fingerprint<sdsl_index_type>();
+
+        // Reserve the header block; the payload size is patched in after serialisation.
+        if (!detail::write_index_container_header(out, header))
+            return false;
+
+        uint64_t payload_size = index.serialize(out);
+        payload_size += text_begin.serialize(out);
+        payload_size += text_begin_ss.serialize(out);
+        payload_size += text_begin_rs.serialize(out);
+        if (!out.good())
+            return false;
+
+        header.payload_size = payload_size;
+        out.seekp(0);
+        return detail::write_index_container_header(out, header) && out.good();
+    }
+
+    /*!\brief Loads the index from a versioned container file written by store_container().
+     * \returns `true` if the container was successfully validated and loaded.
+     *
+     * \details
+     *
+     * The magic bytes, the format version, the alphabet size, the text dimension and the index type fingerprint
+     * of the container are validated against this index type before any payload is deserialized; any mismatch
+     * returns `false` without modifying the index.
+     *
+     * ### Complexity
+     *
+     * Linear.
+     *
+     * ### Exceptions
+     *
+     * Strong exception guarantee.
+     */
+    bool load_container(std::filesystem::path const & path)
+    {
+        std::ifstream in{path, std::ios::binary};
+        if (!in.good())
+            return false;
+
+        detail::index_container_header header{};
+        if (!detail::read_index_container_header(in, header))
+            return false;
+
+        if (header.alphabet_id != alphabet_size_v<char_type> ||
+            header.text_dimension != dimension_v<text_t> ||
+            header.traits_fingerprint != detail::index_traits_fingerprint<sdsl_index_type>())
+        {
+            return false;
+        }
+
+        sdsl_index_type tmp_index;
+        sdsl::sd_vector<> tmp_text_begin;
+        sdsl::select_support_sd<1> tmp_text_begin_ss;
+        sdsl::rank_support_sd<1> tmp_text_begin_rs;
+
+        tmp_index.load(in);
+        tmp_text_begin.load(in);
+        tmp_text_begin_ss.load(in);
+        tmp_text_begin_rs.load(in);
+        if (!in.good())
+            return false;
+
+        std::swap(this->index, tmp_index);
+        std::swap(this->text_begin, tmp_text_begin);
+        std::swap(this->text_begin_ss, tmp_text_begin_ss);
+        std::swap(this->text_begin_rs, tmp_text_begin_rs);
+        text_begin_ss.set_vector(&text_begin);
+        text_begin_rs.set_vector(&text_begin);
+        return true;
+    }
+
+    /*!\brief Places the serialized index into a named shared-memory segment.
+     * \param[in] name The segment name; must start with a slash and contain no further slashes.
+     * \returns `true` if the segment was successfully created and filled.
+     *
+     * \details
+     *
+     * The segment holds the same four components as the on-disk layout of store(), concatenated behind a small
+     * header of component sizes. It persists independently of the creating process until unlink_shm() is called
+     * (or the host reboots), so one process can construct and publish the index and any number of processes on
+     * the same host can subsequently attach it via load_shm() without a second physical copy of the serialized
+     * data ever existing.
+     *
+     * Returns `false` on platforms without POSIX shared memory
+     * (see seqan3::detail::shared_memory_segment::supported).
+     *
+     * ### Complexity
+     *
+     * Linear.
+     *
+     * ### Exceptions
+     *
+     * Strong exception guarantee.
+     */
+    bool store_shm(std::string const & name) const
+    {
+        if constexpr (!detail::shared_memory_segment::supported)
+            return false;
+
+        auto serialize = [] (auto const & component)
+        {
+            std::ostringstream stream{};
+            component.serialize(stream);
+            return stream.str();
+        };
+
+        std::string const components[4]{serialize(index), serialize(text_begin),
+                                        serialize(text_begin_ss), serialize(text_begin_rs)};
+
+        uint64_t component_sizes[4]{};
+        size_t total_size = sizeof(component_sizes);
+        for (size_t i = 0; i < 4; ++i)
+        {
+            component_sizes[i] = components[i].size();
+            total_size += components[i].size();
+        }
+
+        detail::shared_memory_segment segment{detail::shared_memory_segment::create(name, total_size)};
+        if (!segment.is_open())
+            return false;
+
+        char * out = segment.data();
+        std::memcpy(out, component_sizes, sizeof(component_sizes));
+        out += sizeof(component_sizes);
+        for (std::string const & component : components)
+        {
+            std::memcpy(out, component.data(), component.size());
+            out += component.size();
+        }
+        return true;
+    }
+
+    /*!\brief Loads the index from a named shared-memory segment previously filled by store_shm().
+     * \param[in] name The segment name; must start with a slash and contain no further slashes.
+     * \returns `true` if the index was successfully loaded from the segment.
+     *
+     * \details
+     *
+     * The segment is attached read-only with `MAP_SHARED`, i.e. all attaching processes on the host share one
+     * physical copy of the serialized index and deserialisation reads straight from the shared pages. As with
+     * load_mmap(), the index structures maintain their own memory after loading, since the sdsl_index_type
+     * containers cannot operate in place on a mapping; it is the serialized form that is shared.
+     *
+     * Returns `false` on platforms without POSIX shared memory
+     * (see seqan3::detail::shared_memory_segment::supported).
+     *
+     * ### Complexity
+     *
+     * Linear.
+     *
+     * ### Exceptions
+     *
+     * Strong exception guarantee.
+     */
+    bool load_shm(std::string const & name)
+    {
+        if constexpr (!detail::shared_memory_segment::supported)
+            return false;
+
+        detail::shared_memory_segment const segment{detail::shared_memory_segment::attach(name)};
+
+        uint64_t component_sizes[4]{};
+        if (!segment.is_open() || segment.size() < sizeof(component_sizes))
+            return false;
+
+        std::memcpy(component_sizes, segment.data(), sizeof(component_sizes));
+
+        size_t total_size = sizeof(component_sizes);
+        for (uint64_t const component_size : component_sizes)
+            total_size += component_size;
+        if (segment.size() < total_size) // the segment does not hold what the header promises
+            return false;
+
+        char const * in = segment.data() + sizeof(component_sizes);
+        auto load_component = [&] (auto & component, uint64_t const component_size)
+        {
+            detail::memory_mapped_streambuf buffer{in, component_size};
+            std::istream stream{&buffer};
+            component.load(stream);
+            in += component_size;
+        };
+
+        sdsl_index_type tmp_index;
+        sdsl::sd_vector<> tmp_text_begin;
+        sdsl::select_support_sd<1> tmp_text_begin_ss;
+        sdsl::rank_support_sd<1> tmp_text_begin_rs;
+
+        load_component(tmp_index, component_sizes[0]);
+        load_component(tmp_text_begin, component_sizes[1]);
+        load_component(tmp_text_begin_ss, component_sizes[2]);
+        load_component(tmp_text_begin_rs, component_sizes[3]);
+
+        std::swap(this->index, tmp_index);
+        std::swap(this->text_begin, tmp_text_begin);
+        std::swap(this->text_begin_ss, tmp_text_begin_ss);
+        std::swap(this->text_begin_rs, tmp_text_begin_rs);
+        text_begin_ss.set_vector(&text_begin);
+        text_begin_rs.set_vector(&text_begin);
+        return true;
+    }
+
+    /*!\brief Removes the shared-memory segment created by store_shm().
+     * \param[in] name The segment name; must start with a slash and contain no further slashes.
+     * \returns `true` if the segment was successfully removed.
+     *
+     * \details
+     *
+     * The underlying pages are freed once the last attached process unmaps them; indices already loaded from
+     * the segment remain valid.
+     */
+    static bool unlink_shm(std::string const & name)
+    {
+        return detail::shared_memory_segment::unlink(name);
+    }
+
 };
 
 //!\}
@@ -21,6 +21,7 @@
 
 #include <seqan3/alphabet/all.hpp>
 #include <seqan3/core/metafunction/range.hpp>
+#include <seqan3/search/fm_index/detail/batch_locate.hpp>
 #include <seqan3/search/fm_index/detail/csa_alphabet_strategy.hpp>
 #include <seqan3/search/fm_index/detail/fm_index_cursor.hpp>
 #include <seqan3/search/fm_index/fm_index.hpp>
@@ -227,6 +228,8 @@ public:
      * \f$O(\Sigma) * O(T_{BACKWARD\_SEARCH})\f$
      *
      * It scans linearly over the alphabet until it finds the smallest character that is represented by an edge.
+     * For EPR dictionaries (see seqan3::fm_index_epr_traits) the intervals of all characters are retrieved with
+     * two bulk rank queries instead of one backward search per character.
      *
      * ### Exceptions
      *
@@ -234,25 +237,47 @@ public:
      */
     bool extend_right() noexcept
     {
-        // TODO: specialize extend_right() and cycle_back() for EPR-dictionaries
-        // store all cursors at once in a private std::array of cursors
+        // TODO: store all cursors at once in a private std::array of cursors
         assert(index != nullptr);
 
-        sdsl_char_type c = 1; // NOTE: start with 0 or 1 depending on implicit_sentintel
-        size_type _lb = node.lb, _rb = node.rb;
-        while (c < sigma && !backward_search(index->index, index->index.comp2char[c], _lb, _rb))
+        if constexpr (detail::EprDictionaryIndex<typename index_type::sdsl_index_type>)
         {
-            ++c;
+            auto const & csa = index->index;
+            auto const ranks_lb = csa.wavelet_tree.all_ranks(node.lb);
+            auto const ranks_rb = csa.wavelet_tree.all_ranks(node.rb + 1);
+
+            for (sdsl_char_type c = 1; c < sigma; ++c) // NOTE: start with 0 or 1 depending on implicit_sentintel
+            {
+                size_type const _lb = csa.C[c] + ranks_lb[c];
+                size_type const _rb = csa.C[c] + ranks_rb[c];
+                if (_lb < _rb)
+                {
+                    parent_lb = node.lb;
+                    parent_rb = node.rb;
+                    node = {_lb, _rb - 1, node.depth + 1, c};
+                    return true;
+                }
+            }
+            return false;
         }
-
-        if (c != sigma)
+        else
         {
-            parent_lb = node.lb;
-            parent_rb = node.rb;
-            node = {_lb, _rb, node.depth + 1, c};
-            return true;
+            sdsl_char_type c = 1; // NOTE: start with 0 or 1 depending on implicit_sentintel
+            size_type _lb = node.lb, _rb = node.rb;
+            while (c < sigma && !backward_search(index->index, index->index.comp2char[c], _lb, _rb))
+            {
+                ++c;
+            }
+
+            if (c != sigma)
+            {
+                parent_lb = node.lb;
+                parent_rb = node.rb;
+                node = {_lb, _rb, node.depth + 1, c};
+                return true;
+            }
+            return false;
         }
-        return false;
     }
 
     /*!\brief Tries to extend the query by the character `c` to the right.
@@ -358,7 +383,8 @@ public:
      * \f$O(\Sigma) * O(T_{BACKWARD\_SEARCH})\f$
      *
      * It scans linearly over the alphabet starting from the rightmost character until it finds the query with a larger
-     * rightmost character.
+     * rightmost character. For EPR dictionaries (see seqan3::fm_index_epr_traits) the intervals of all characters are
+     * retrieved with two bulk rank queries instead of one backward search per character.
      *
      * ### Exceptions
      *
@@ -370,20 +396,41 @@ public:
         // parent_lb > parent_rb --> invalid interval
         assert(parent_lb <= parent_rb);
 
-        sdsl_char_type c = node.last_char + 1;
-        size_type _lb = parent_lb, _rb = parent_rb;
-
-        while (c < sigma && !backward_search(index->index, index->index.comp2char[c], _lb, _rb))
+        if constexpr (detail::EprDictionaryIndex<typename index_type::sdsl_index_type>)
         {
-            ++c;
+            auto const & csa = index->index;
+            auto const ranks_lb = csa.wavelet_tree.all_ranks(parent_lb);
+            auto const ranks_rb = csa.wavelet_tree.all_ranks(parent_rb + 1);
+
+            for (sdsl_char_type c = node.last_char + 1; c < sigma; ++c)
+            {
+                size_type const _lb = csa.C[c] + ranks_lb[c];
+                size_type const _rb = csa.C[c] + ranks_rb[c];
+                if (_lb < _rb) // Collection has additional sentinel as delimiter
+                {
+                    node = {_lb, _rb - 1, node.depth, c};
+                    return true;
+                }
+            }
+            return false;
         }
-
-        if (c != sigma) // Collection has additional sentinel as delimiter
+        else
         {
-            node = {_lb, _rb, node.depth, c};
-            return true;
+            sdsl_char_type c = node.last_char + 1;
+            size_type _lb = parent_lb, _rb = parent_rb;
+
+            while (c < sigma && !backward_search(index->index, index->index.comp2char[c], _lb, _rb))
+            {
+                ++c;
+            }
+
+            if (c != sigma) // Collection has additional sentinel as delimiter
+            {
+                node = {_lb, _rb, node.depth, c};
+                return true;
+            }
+            return false;
         }
-        return false;
     }
 
     /*!\brief Outputs the rightmost character.
@@ -500,6 +547,11 @@ public:
     /*!\brief Locates the occurrences of the searched query in the text.
      * \returns Positions in the text.
      *
+     * \details
+     *
+     * The suffix array values of the whole interval are resolved in bulk with their LF walks interleaved
+     * (see seqan3::detail::batch_locate), which overlaps the memory latencies of the walks.
+     *
      * ### Complexity
      *
      * \f$count() * O(T_{BACKWARD\_SEARCH} * SAMPLING\_RATE)\f$
@@ -515,10 +567,11 @@ public:
     {
         assert(index != nullptr);
 
+        auto const sa_values = detail::batch_locate(index->index, node.lb, node.rb);
         std::vector<size_type> occ(count());
         for (size_type i = 0; i < occ.size(); ++i)
         {
-            occ[i] = offset() - index->index[node.lb + i];
+            occ[i] = offset() - sa_values[i];
         }
         return occ;
     }
@@ -531,11 +584,12 @@ public:
     {
         assert(index != nullptr);
 
+        auto const sa_values = detail::batch_locate(index->index, node.lb, node.rb);
         std::vector<std::pair<size_type, size_type>> occ;
         occ.reserve(count());
         for (size_type i = 0; i < count(); ++i)
         {
-            size_type loc = offset() - index->index[node.lb + i];
+            size_type loc = offset() - sa_values[i];
             size_type sequence_rank = index->text_begin_rs.rank(loc + 1);
             size_type sequence_position = loc - index->text_begin_ss.select(sequence_rank);
             occ.emplace_back(sequence_rank - 1, sequence_position);
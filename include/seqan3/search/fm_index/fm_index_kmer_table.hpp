@@ -0,0 +1,191 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides the seqan3::fm_index_kmer_table.
+ */
+
+#pragma once
+
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/concept/core_language.hpp>
+#include <seqan3/core/metafunction/range.hpp>
+#include <seqan3/search/fm_index/concept.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3
+{
+
+/*!\addtogroup submodule_fm_index
+ * \{
+ */
+
+/*!\brief A precomputed k-mer to suffix array interval table for an FM index.
+ * \tparam index_t The type of the underlying index; must model seqan3::FmIndex.
+ *
+ * \details
+ *
+ * Every search starts its cursor at the root of the implicit suffix tree, so the first k extension steps
+ * repeat the same backward searches across all queries sharing a k-mer prefix. This table enumerates the
+ * entire suffix tree down to depth k once and stores the resulting cursors, such that a search can start
+ * directly at depth k with a single table lookup (see cursor()).
+ *
+ * The table works for unidirectional as well as bidirectional indices, since it stores the index's own
+ * cursor type: a cursor retrieved from the table behaves exactly as if it had been extended character by
+ * character from the root, including cycle_back() (and extend_left()/cycle_front() for bidirectional
+ * cursors). seqan3::detail::search_trivial and seqan3::detail::search_ss use the table for query prefixes
+ * that have to match exactly.
+ *
+ * The table holds \f$\Sigma^k\f$ entries, so the k-mer size should be chosen such that the table fits the
+ * cache budget (e.g. \f$k \le 12\f$ for seqan3::dna4). The table references the index like a cursor does and
+ * must not outlive it; it has to be rebuilt when the index is re-constructed or loaded.
+ */
+template <FmIndex index_t>
+class fm_index_kmer_table
+{
+public:
+    /*!\name Member types
+     * \{
+     */
+    //!\brief Type of the index.
+    using index_type = index_t;
+    //!\brief Type of the cursors stored in and returned by the table.
+    using cursor_type = typename index_t::cursor_type;
+    //!\brief The type of the underlying character of the indexed text.
+    using char_type = typename index_t::char_type;
+    //!\brief Type for representing positions in the indexed text.
+    using size_type = typename index_t::size_type;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    fm_index_kmer_table() = default;                                       //!< Default constructor.
+    fm_index_kmer_table(fm_index_kmer_table const &) = default;            //!< Copy constructor.
+    fm_index_kmer_table & operator=(fm_index_kmer_table const &) = default;//!< Copy assignment.
+    fm_index_kmer_table(fm_index_kmer_table &&) = default;                 //!< Move constructor.
+    fm_index_kmer_table & operator=(fm_index_kmer_table &&) = default;     //!< Move assignment.
+    ~fm_index_kmer_table() = default;                                      //!< Destructor.
+
+    /*!\brief Constructs the table for the given index by enumerating the suffix tree down to depth k.
+     * \param[in] index The index to precompute the table for; must outlive the table.
+     * \param[in] kmer_size The depth of the stored cursors; must be at least 1.
+     * \throws std::invalid_argument if `kmer_size` is 0 or the table would exceed the addressable size.
+     *
+     * ### Complexity
+     *
+     * \f$O(\min(\Sigma^k, |text|) \cdot k)\f$ backward searches; the enumeration shares the work of common
+     * prefixes, i.e. it performs one backward search per visited suffix tree node.
+     */
+    fm_index_kmer_table(index_t const & index, uint8_t const kmer_size) : kmer_length{kmer_size}
+    {
+        if (kmer_size == 0)
+            throw std::invalid_argument("The k-mer size must be at least 1.");
+
+        size_type entry_count = 1;
+        for (uint8_t i = 0; i < kmer_size; ++i)
+        {
+            if (entry_count > std::numeric_limits<size_type>::max() / sigma)
+                throw std::invalid_argument("The k-mer table with " + std::to_string(kmer_size) +
+                                            "-mers would exceed the addressable size.");
+            entry_count *= sigma;
+        }
+
+        cursors.resize(entry_count);
+        present.resize(entry_count, false);
+        fill(index.begin(), 0, 0);
+    }
+    //!\}
+
+    //!\brief Returns the length of the stored k-mers.
+    uint8_t kmer_size() const noexcept
+    {
+        return kmer_length;
+    }
+
+    //!\brief Returns the number of k-mers that occur in the indexed text.
+    size_type size() const noexcept
+    {
+        return kmer_count;
+    }
+
+    /*!\brief Returns a cursor at depth k for the first k characters of the given sequence.
+     * \tparam seq_t The type of the sequence; must model std::ranges::RandomAccessRange over the index's
+     *               alphabet.
+     * \param[in] seq The sequence whose first kmer_size() characters select the cursor.
+     * \returns The cursor positioned as if extended from the root with the k-mer, or std::nullopt if the
+     *          k-mer does not occur in the indexed text.
+     *
+     * ### Complexity
+     *
+     * \f$O(k)\f$ — independent of the text size; no rank queries are performed.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    template <std::ranges::RandomAccessRange seq_t>
+    //!\cond
+        requires ImplicitlyConvertibleTo<innermost_value_type_t<seq_t>, char_type>
+    //!\endcond
+    std::optional<cursor_type> cursor(seq_t && seq) const noexcept
+    {
+        assert(std::ranges::size(seq) >= kmer_length);
+
+        size_type code = 0;
+        for (uint8_t i = 0; i < kmer_length; ++i)
+            code = code * sigma + to_rank(seq[i]);
+
+        if (!present[code])
+            return std::nullopt;
+        return cursors[code];
+    }
+
+private:
+    //!\brief The alphabet size of the indexed text.
+    static constexpr size_type sigma = alphabet_size_v<char_type>;
+
+    //!\brief Enumerates the suffix tree below `cur` and stores all cursors at depth kmer_length.
+    void fill(cursor_type const & cur, uint8_t const depth, size_type const code)
+    {
+        if (depth == kmer_length)
+        {
+            cursors[code] = cur;
+            present[code] = true;
+            ++kmer_count;
+            return;
+        }
+
+        for (size_type rank = 0; rank < sigma; ++rank)
+        {
+            char_type c;
+            assign_rank(c, rank);
+
+            cursor_type child{cur};
+            if (child.extend_right(c))
+                fill(child, depth + 1, code * sigma + rank);
+        }
+    }
+
+    //!\brief The length of the stored k-mers.
+    uint8_t kmer_length{0};
+    //!\brief One cursor per possible k-mer, addressed by the base sigma encoding of the k-mer ranks.
+    std::vector<cursor_type> cursors{};
+    //!\brief Marks the k-mers that occur in the indexed text.
+    std::vector<bool> present{};
+    //!\brief The number of k-mers that occur in the indexed text.
+    size_type kmer_count{0};
+};
+
+//!\}
+
+} // namespace seqan3
@@ -0,0 +1,230 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides the seqan3::partitioned_fm_index.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <seqan3/search/algorithm/search.hpp>
+#include <seqan3/search/fm_index/fm_index.hpp>
+
+namespace seqan3
+{
+
+/*!\addtogroup submodule_fm_index
+ * \{
+ */
+
+/*!\brief An FM index that shards the text into partitions with their own indices.
+ * \tparam text_t          The type of the text to be indexed; must model std::ranges::RandomAccessRange.
+ * \tparam fm_index_traits The traits of the partition indices; must model seqan3::FmIndexTraits.
+ *
+ * \details
+ *
+ * Large texts inflate every structure of a monolithic FM index: the bit-compressed integer vectors of the
+ * SDSL grow with \f$\log n\f$ bits per entry and the suffix array samples leave the cache. This index splits
+ * the text into partitions of a configurable maximum size (by default \f$2^{32} - 1\f$ characters, such that
+ * all internal offsets of a partition fit into 32 bits) and builds an ordinary seqan3::fm_index per
+ * partition. Searches run on all partitions concurrently and the partition-local hits are translated back to
+ * positions in the original text.
+ *
+ * Consecutive partitions overlap by a configurable number of characters, because a match crossing a
+ * partition boundary is only visible to a partition that fully contains it. The overlap must therefore be at
+ * least the maximum query length plus the error budget minus 1; matches longer than that may be missed.
+ * Hits lying completely inside an overlap are found by both adjacent partitions and are deduplicated.
+ *
+ * In contrast to seqan3::fm_index the partition texts are owned by the index, i.e. the indexed text does not
+ * have to outlive it. Only searches with the (default) text position output are supported, since cursors and
+ * counts of different partitions cannot be merged across the overlaps.
+ */
+template <std::ranges::RandomAccessRange text_t, FmIndexTraits fm_index_traits = fm_index_default_traits>
+//!\cond
+    requires Alphabet<innermost_value_type_t<text_t>> &&
+             alphabet_size_v<innermost_value_type_t<text_t>> <= 256
+//!\endcond
+class partitioned_fm_index
+{
+public:
+    /*!\name Member types
+     * \{
+     */
+    //!\brief The type of the indexed text.
+    using text_type = text_t;
+    //!\brief The type of the underlying character of text_type.
+    using char_type = innermost_value_type_t<text_t>;
+    //!\brief Type for representing positions in the indexed text.
+    using size_type = uint64_t;
+    //!\brief The type of the index built over a single partition.
+    using partition_index_type = fm_index<std::vector<char_type>, fm_index_traits>;
+    //!\}
+
+    static_assert(dimension_v<text_t> == 1, "Only single texts can be partitioned; index the concatenation "
+                                            "of a collection instead.");
+
+    //!\brief The default maximum partition size: all offsets within a partition fit into 32 bits.
+    static size_type constexpr default_partition_size = (size_type{1} << 32) - 1;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    partitioned_fm_index() = default;                                        //!< Default constructor.
+    //!\brief Copy construction is not supported: the partition indices reference the owned partition texts.
+    partitioned_fm_index(partitioned_fm_index const &) = delete;
+    //!\brief Copy assignment is not supported: the partition indices reference the owned partition texts.
+    partitioned_fm_index & operator=(partitioned_fm_index const &) = delete;
+    partitioned_fm_index(partitioned_fm_index &&) = default;                 //!< Move constructor.
+    partitioned_fm_index & operator=(partitioned_fm_index &&) = default;     //!< Move assignment.
+    ~partitioned_fm_index() = default;                                       //!< Destructor.
+
+    /*!\brief Constructor that immediately constructs the index given a range.
+              The range cannot be an rvalue (i.e. a temporary object) and has to be non-empty.
+     * \param[in] text           The text to construct from.
+     * \param[in] overlap        The number of characters consecutive partitions share; must be at least the
+     *                           maximum query length plus the error budget minus 1.
+     * \param[in] partition_size The maximum number of characters per partition.
+     *
+     * ### Complexity
+     *
+     * The sum of the partition index constructions.
+     */
+    partitioned_fm_index(text_t const & text, size_type const overlap,
+                         size_type const partition_size = default_partition_size)
+    {
+        construct(text, overlap, partition_size);
+    }
+
+    //!\overload
+    partitioned_fm_index(text_t &&, size_type const, size_type const partition_size = default_partition_size)
+        = delete;
+
+    //!\overload
+    partitioned_fm_index(text_t const &&, size_type const,
+                         size_type const partition_size = default_partition_size) = delete;
+    //!\}
+
+    /*!\brief Constructs the index given a range.
+              The range cannot be an rvalue (i.e. a temporary object) and has to be non-empty.
+     * \param[in] text           The text to construct from.
+     * \param[in] overlap        The number of characters consecutive partitions share; must be at least the
+     *                           maximum query length plus the error budget minus 1.
+     * \param[in] partition_size The maximum number of characters per partition.
+     * \throws std::invalid_argument if the text is empty or `partition_size` is not greater than `overlap`.
+     *
+     * ### Exceptions
+     *
+     * Basic exception guarantee.
+     */
+    void construct(text_t const & text, size_type const overlap,
+                   size_type const partition_size = default_partition_size)
+    {
+        if (std::ranges::begin(text) == std::ranges::end(text))
+            throw std::invalid_argument("The text that is indexed cannot be empty.");
+        if (partition_size <= overlap)
+            throw std::invalid_argument("The partition size must be greater than the overlap.");
+
+        text_length = std::ranges::size(text);
+        partition_begins.clear();
+        partition_texts.clear();
+        partition_indices.clear();
+
+        size_type const step = partition_size - overlap;
+        for (size_type begin = 0; ; begin += step)
+        {
+            size_type const end = std::min<size_type>(begin + partition_size, text_length);
+            partition_begins.push_back(begin);
+            partition_texts.emplace_back(std::ranges::begin(text) + begin, std::ranges::begin(text) + end);
+            if (end == text_length)
+                break;
+        }
+
+        // the indices are constructed after all partition texts are in place, since growing the text vector
+        // would invalidate the text references held by already constructed indices
+        partition_indices.resize(partition_texts.size());
+        for (size_type i = 0; i < partition_texts.size(); ++i)
+            partition_indices[i].construct(partition_texts[i]);
+    }
+
+    //!\brief Returns the length of the indexed text.
+    size_type size() const noexcept
+    {
+        return text_length;
+    }
+
+    //!\brief Returns the number of partitions.
+    size_type partition_count() const noexcept
+    {
+        return partition_indices.size();
+    }
+
+    /*!\brief Searches a query in all partitions concurrently and merges the hits.
+     * \tparam query_t         Must model std::ranges::RandomAccessRange over the index's alphabet.
+     * \tparam configuration_t The type of the search configuration.
+     * \param[in] query The query to search.
+     * \param[in] cfg   A configuration object specifying the search parameters; the output must be (the
+     *                  default) text positions. Modes that depend on the best hit (best, all_best, strata)
+     *                  are evaluated per partition.
+     * \returns A sorted std::vector of positions in the original text without duplicates.
+     *
+     * ### Exceptions
+     *
+     * Basic exception guarantee.
+     */
+    template <std::ranges::RandomAccessRange query_t, typename configuration_t = decltype(configuration{})>
+    std::vector<size_type> search(query_t const & query, configuration_t const & cfg = configuration{}) const
+    {
+        using cfg_t = remove_cvref_t<configuration_t>;
+        static_assert(!cfg_t::template exists<search_cfg::output<detail::search_output_index_cursor>>() &&
+                      !cfg_t::template exists<search_cfg::output<detail::search_output_count>>(),
+                      "A partitioned index can only report text positions, since cursors and counts of "
+                      "different partitions cannot be merged.");
+
+        std::vector<std::vector<size_type>> partition_hits(partition_indices.size());
+
+        auto search_partition = [&] (size_type const i)
+        {
+            for (size_type const local_position : seqan3::search(partition_indices[i], query, cfg))
+                partition_hits[i].push_back(partition_begins[i] + local_position);
+        };
+
+        std::vector<std::thread> threads{};
+        threads.reserve(partition_indices.size() - 1);
+        for (size_type i = 1; i < partition_indices.size(); ++i)
+            threads.emplace_back(search_partition, i);
+        search_partition(0); // the calling thread handles the first partition
+        for (std::thread & thread : threads)
+            thread.join();
+
+        // hits inside an overlap are reported by both adjacent partitions
+        std::vector<size_type> hits{};
+        for (std::vector<size_type> const & local_hits : partition_hits)
+            hits.insert(hits.end(), local_hits.begin(), local_hits.end());
+        std::sort(hits.begin(), hits.end());
+        hits.erase(std::unique(hits.begin(), hits.end()), hits.end());
+        return hits;
+    }
+
+private:
+    //!\brief The length of the indexed text.
+    size_type text_length{0};
+    //!\brief The begin position of every partition in the original text.
+    std::vector<size_type> partition_begins{};
+    //!\brief The owned partition texts (including the overlaps).
+    std::vector<std::vector<char_type>> partition_texts{};
+    //!\brief One index per partition.
+    std::vector<partition_index_type> partition_indices{};
+};
+
+//!\}
+
+} // namespace seqan3
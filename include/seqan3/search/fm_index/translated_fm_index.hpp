@@ -0,0 +1,269 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides the seqan3::translated_fm_index.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/concept.hpp>
+#include <seqan3/range/container/concatenated_sequences.hpp>
+#include <seqan3/range/view/translation.hpp>
+#include <seqan3/search/algorithm/search.hpp>
+#include <seqan3/search/fm_index/fm_index.hpp>
+
+namespace seqan3
+{
+
+/*!\addtogroup submodule_fm_index
+ * \{
+ */
+
+/*!\brief A protein FM index over the six-frame translation of a nucleotide text collection.
+ * \tparam fm_index_traits The traits of the underlying protein index; must model seqan3::FmIndexTraits.
+ *
+ * \details
+ *
+ * Protein-vs-genome searches translate the genome in all six reading frames and index the result. Doing
+ * this by materializing every frame through seqan3::view::translate first keeps six amino acid copies of
+ * the genome alive at once before the index construction even starts. This index instead streams each
+ * frame's lazy seqan3::view::translate_single view directly into one pre-reserved
+ * seqan3::concatenated_sequences — at no point does a translated frame exist outside the final
+ * concatenation — and builds a single seqan3::fm_index over it.
+ *
+ * The frames of every input sequence become six consecutive sequences of the indexed collection, so
+ * locate results can be mapped back: search() reports for every hit the input sequence, the reading
+ * frame, the position in the translated frame and the begin position of the matched codons on the
+ * forward strand of the original nucleotide sequence.
+ *
+ * In contrast to seqan3::fm_index the translated frames are owned by the index, i.e. the nucleotide text
+ * does not have to outlive it. Only searches with the (default) text position output are supported,
+ * since cursors and counts know nothing about the frame layout.
+ */
+template <FmIndexTraits fm_index_traits = fm_index_default_traits>
+class translated_fm_index
+{
+public:
+    /*!\name Member types
+     * \{
+     */
+    //!\brief The alphabet the translated frames (and hence the queries) are over.
+    using protein_alphabet_type = aa27;
+    //!\brief The type of the indexed frame collection.
+    using text_type = concatenated_sequences<aa27_vector>;
+    //!\brief Type for representing positions.
+    using size_type = uint64_t;
+    //!\brief The type of the underlying protein index.
+    using protein_index_type = fm_index<text_type, fm_index_traits>;
+    //!\}
+
+    //!\brief The number of reading frames per input sequence.
+    static size_type constexpr frame_count = 6;
+
+    //!\brief The reading frames in the order their translations appear in the indexed collection.
+    static std::array<translation_frames, frame_count> constexpr frames
+    {
+        translation_frames::FWD_FRAME_0, translation_frames::FWD_FRAME_1, translation_frames::FWD_FRAME_2,
+        translation_frames::REV_FRAME_0, translation_frames::REV_FRAME_1, translation_frames::REV_FRAME_2
+    };
+
+    //!\brief A single search hit with its coordinates mapped back to the nucleotide input.
+    struct hit_type
+    {
+        //!\brief The index of the input sequence the hit lies in.
+        size_type reference_id;
+        //!\brief The reading frame the hit was found in.
+        translation_frames frame;
+        //!\brief The begin position of the hit in the translated frame.
+        size_type aa_position;
+        //!\brief The begin position of the matched codons on the forward strand of the input sequence.
+        size_type position;
+
+        //!\brief Test for equality.
+        friend bool operator==(hit_type const & lhs, hit_type const & rhs) noexcept
+        {
+            return std::tie(lhs.reference_id, lhs.frame, lhs.aa_position, lhs.position) ==
+                   std::tie(rhs.reference_id, rhs.frame, rhs.aa_position, rhs.position);
+        }
+
+        //!\brief Test for inequality.
+        friend bool operator!=(hit_type const & lhs, hit_type const & rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+        //!\brief Orders hits by input sequence, then by forward strand position.
+        friend bool operator<(hit_type const & lhs, hit_type const & rhs) noexcept
+        {
+            return std::tie(lhs.reference_id, lhs.position, lhs.frame, lhs.aa_position) <
+                   std::tie(rhs.reference_id, rhs.position, rhs.frame, rhs.aa_position);
+        }
+    };
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    translated_fm_index() = default;                                       //!< Default constructor.
+    //!\brief Copy construction is not supported: the protein index references the owned frame collection.
+    translated_fm_index(translated_fm_index const &) = delete;
+    //!\brief Copy assignment is not supported: the protein index references the owned frame collection.
+    translated_fm_index & operator=(translated_fm_index const &) = delete;
+    translated_fm_index(translated_fm_index &&) = default;                 //!< Move constructor.
+    translated_fm_index & operator=(translated_fm_index &&) = default;     //!< Move assignment.
+    ~translated_fm_index() = default;                                      //!< Destructor.
+
+    /*!\brief Constructor that immediately constructs the index given a nucleotide text collection.
+     * \tparam text_t The type of the collection; see construct().
+     * \param[in] text         The nucleotide sequences to translate and index.
+     * \param[in] thread_count The number of threads to construct with (see seqan3::fm_index::construct).
+     */
+    template <std::ranges::RandomAccessRange text_t>
+    translated_fm_index(text_t const & text, size_t const thread_count = 1)
+    {
+        construct(text, thread_count);
+    }
+    //!\}
+
+    /*!\brief Constructs the index given a nucleotide text collection.
+     * \tparam text_t The type of the collection; must model std::ranges::RandomAccessRange over
+     *                std::ranges::RandomAccessRange over a seqan3::NucleotideAlphabet.
+     * \param[in] text         The nucleotide sequences to translate and index.
+     * \param[in] thread_count The number of threads to construct with (see seqan3::fm_index::construct).
+     * \throws std::invalid_argument if the collection is empty or no sequence is at least one codon long.
+     *
+     * \details
+     *
+     * The frame translations are streamed one frame at a time into the owned concatenation, whose final
+     * size is computed and reserved up front — the construction never holds a translated frame outside
+     * the concatenation and the nucleotide text itself is not retained.
+     *
+     * ### Exceptions
+     *
+     * Basic exception guarantee.
+     */
+    template <std::ranges::RandomAccessRange text_t>
+    //!\cond
+        requires NucleotideAlphabet<innermost_value_type_t<text_t>>
+    //!\endcond
+    void construct(text_t const & text, size_t const thread_count = 1)
+    {
+        static_assert(dimension_v<text_t> == 2, "Only collections of nucleotide sequences can be "
+                                                "translated; wrap a single sequence in a collection.");
+
+        if (std::ranges::begin(text) == std::ranges::end(text))
+            throw std::invalid_argument("The text that is indexed cannot be empty.");
+
+        sequence_lengths.clear();
+        frame_texts.clear();
+
+        size_type translated_size{0};
+        for (auto && sequence : text)
+        {
+            size_type const length = std::ranges::size(sequence);
+            sequence_lengths.push_back(length);
+            for (size_type offset = 0; offset < 3; ++offset)
+                translated_size += 2 * ((length >= offset) ? (length - offset) / 3 : 0);
+        }
+
+        frame_texts.concat_reserve(translated_size);
+
+        for (auto && sequence : text)
+            for (translation_frames const frame : frames)
+                frame_texts.push_back(view::translate_single(sequence, frame)); // lazy, no frame copy
+
+        protein_index.construct(frame_texts, thread_count);
+    }
+
+    //!\brief Returns the number of indexed nucleotide sequences.
+    size_type size() const noexcept
+    {
+        return sequence_lengths.size();
+    }
+
+    //!\brief Returns the indexed frame collection; frame `f` of sequence `i` is element `i * 6 + f`.
+    text_type const & frame_text() const noexcept
+    {
+        return frame_texts;
+    }
+
+    /*!\brief Searches a protein query in all frames and maps the hits back to nucleotide coordinates.
+     * \tparam query_t         Must model std::ranges::RandomAccessRange over an aminoacid alphabet.
+     * \tparam configuration_t The type of the search configuration.
+     * \param[in] query The protein query to search.
+     * \param[in] cfg   A configuration object specifying the search parameters; the output must be (the
+     *                  default) text positions.
+     * \returns A sorted std::vector of seqan3::translated_fm_index::hit_type.
+     *
+     * \details
+     *
+     * The forward strand position of a hit assumes that the match spans as many amino acids as the
+     * query is long; for searches whose error configuration permits insertions or deletions the frame
+     * and the amino acid position remain exact, but the mapped codon begin of a hit with indels may be
+     * off by the length difference.
+     *
+     * ### Exceptions
+     *
+     * Basic exception guarantee.
+     */
+    template <std::ranges::RandomAccessRange query_t, typename configuration_t = decltype(configuration{})>
+    std::vector<hit_type> search(query_t const & query, configuration_t const & cfg = configuration{}) const
+    {
+        using cfg_t = remove_cvref_t<configuration_t>;
+        static_assert(!cfg_t::template exists<search_cfg::output<detail::search_output_index_cursor>>() &&
+                      !cfg_t::template exists<search_cfg::output<detail::search_output_count>>(),
+                      "A translated index can only report text positions, since cursors and counts know "
+                      "nothing about the frame layout.");
+
+        size_type const query_length = std::ranges::size(query);
+
+        std::vector<hit_type> hits{};
+        for (auto const & [frame_text_id, aa_position] : seqan3::search(protein_index, query, cfg))
+        {
+            size_type const reference_id = frame_text_id / frame_count;
+            size_type const frame_index  = frame_text_id % frame_count;
+            size_type const frame_offset = frame_index % 3;
+
+            // forward frames read codons left to right from the offset, reverse frames right to left
+            size_type position;
+            if (frame_index < 3)
+            {
+                position = frame_offset + 3 * aa_position;
+            }
+            else
+            {
+                size_type const span_end = frame_offset + 3 * (aa_position + query_length);
+                size_type const length   = sequence_lengths[reference_id];
+                position = (span_end > length) ? 0 : length - span_end; // clamped for matches with indels
+            }
+
+            hits.push_back(hit_type{reference_id, frames[frame_index], aa_position, position});
+        }
+
+        std::sort(hits.begin(), hits.end());
+        return hits;
+    }
+
+private:
+    //!\brief The length of every indexed nucleotide sequence (needed to map reverse frame positions).
+    std::vector<size_type> sequence_lengths{};
+    //!\brief The translated frames, six consecutive sequences per input sequence.
+    text_type frame_texts{};
+    //!\brief The protein index over the frame collection.
+    protein_index_type protein_index{};
+};
+
+//!\}
+
+} // namespace seqan3
@@ -0,0 +1,26 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Meta-header for the k-mer counting module.
+ *
+ * \defgroup submodule_kmer_count K-Mer Counting
+ * \ingroup search
+ *
+ * # K-Mer Counting
+ *
+ * K-mer counting aggregates the multiplicities of all substrings of a fixed length k of a sequence set, e.g.
+ * for abundance estimation, error correction or spectrum comparison. At sequencing scale the counting must
+ * stream over the file input instead of materializing the sequences, so this module provides a dedicated
+ * parallel counting engine (seqan3::kmer_counter) that consumes file records in batches, rolling-hashes the
+ * k-mers and aggregates them into a sharded open-addressing table (seqan3::kmer_count_table) with one local
+ * table per thread, merged shard-parallel at the end.
+ */
+
+#pragma once
+
+#include <seqan3/search/kmer_count/kmer_counter.hpp>
@@ -0,0 +1,451 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::kmer_count_table and seqan3::kmer_counter.
+ */
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/metafunction/basic.hpp>
+#include <seqan3/core/metafunction/range.hpp>
+#include <seqan3/core/metafunction/template_inspection.hpp>
+#include <seqan3/io/record.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3
+{
+
+/*!\addtogroup submodule_kmer_count
+ * \{
+ */
+
+/*!\brief A sharded open-addressing hash table mapping k-mer hashes to their counts.
+ *
+ * \details
+ *
+ * The table is split into seqan3::kmer_count_table::shard_count shards addressed by the top bits of the mixed
+ * k-mer hash; every shard is an open-addressing table with linear probing over power-of-two capacities. The
+ * sharding makes merging two tables embarrassingly parallel, since the same k-mer lands in the same shard of
+ * every table (see merge_shard()); it is not a concurrency mechanism — one table must only be modified by one
+ * thread at a time, which is how seqan3::kmer_counter uses it (one local table per thread, merged at the end).
+ *
+ * The keys are the base \f$\Sigma\f$ encodings of the k-mers, i.e. the same values that seqan3::view::kmer_hash
+ * produces; the all-ones value is reserved as the empty bucket marker, which seqan3::kmer_counter guarantees to
+ * be unreachable by rejecting k-mer sizes whose encoding would not fit into 64 bits.
+ */
+class kmer_count_table
+{
+public:
+    //!\brief The number of shards the table is split into.
+    static constexpr size_t shard_count = 64;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    kmer_count_table() = default;                                    //!< Default constructor.
+    kmer_count_table(kmer_count_table const &) = default;            //!< Copy constructor.
+    kmer_count_table & operator=(kmer_count_table const &) = default;//!< Copy assignment.
+    kmer_count_table(kmer_count_table &&) = default;                 //!< Move constructor.
+    kmer_count_table & operator=(kmer_count_table &&) = default;     //!< Move assignment.
+    ~kmer_count_table() = default;                                   //!< Destructor.
+    //!\}
+
+    /*!\brief Increments the count of the given k-mer hash.
+     * \param[in] kmer   The k-mer hash; must not be the reserved all-ones value.
+     * \param[in] amount The amount to add to the count.
+     */
+    void increment(uint64_t const kmer, uint64_t const amount = 1)
+    {
+        assert(kmer != empty_key);
+        shards[shard_of(kmer)].increment(kmer, mix(kmer), amount);
+    }
+
+    //!\brief Returns the count of the given k-mer hash; `0` if the k-mer was never counted.
+    uint64_t count(uint64_t const kmer) const noexcept
+    {
+        return shards[shard_of(kmer)].count(kmer, mix(kmer));
+    }
+
+    //!\brief Returns the number of distinct k-mers in the table.
+    size_t unique_kmer_count() const noexcept
+    {
+        size_t result = 0;
+        for (shard_type const & shard : shards)
+            result += shard.filled;
+        return result;
+    }
+
+    //!\brief Returns the sum of all counts in the table.
+    uint64_t total_kmer_count() const noexcept
+    {
+        uint64_t result = 0;
+        for (shard_type const & shard : shards)
+            result += shard.total;
+        return result;
+    }
+
+    //!\brief Adds all counts of the given table to this table.
+    void merge(kmer_count_table const & other)
+    {
+        for (size_t shard = 0; shard < shard_count; ++shard)
+            merge_shard(shard, other);
+    }
+
+    /*!\brief Adds the counts of one shard of the given table to the corresponding shard of this table.
+     * \param[in] shard The shard index; must be smaller than shard_count.
+     * \param[in] other The table to merge from.
+     *
+     * \details
+     *
+     * A k-mer lands in the same shard of every table, hence merging distinct shards touches disjoint state and
+     * the shards of a merge can be distributed over threads.
+     */
+    void merge_shard(size_t const shard, kmer_count_table const & other)
+    {
+        assert(shard < shard_count);
+        other.shards[shard].for_each([this, shard] (uint64_t const kmer, uint64_t const kmer_count)
+        {
+            shards[shard].increment(kmer, mix(kmer), kmer_count);
+        });
+    }
+
+    /*!\brief Invokes the given callable with every (k-mer hash, count) pair of the table.
+     * \tparam fn_t The type of the callable; invoked as `fn(uint64_t, uint64_t)`.
+     * \param[in] fn The callable.
+     */
+    template <typename fn_t>
+    void for_each(fn_t && fn) const
+    {
+        for (shard_type const & shard : shards)
+            shard.for_each(fn);
+    }
+
+private:
+    //!\brief The reserved empty bucket marker.
+    static constexpr uint64_t empty_key = std::numeric_limits<uint64_t>::max();
+
+    //!\brief Finalising bit mixer (splitmix64); decorrelates the positional k-mer encoding from the bucket index.
+    static constexpr uint64_t mix(uint64_t value) noexcept
+    {
+        value ^= value >> 30;
+        value *= 0xbf58476d1ce4e5b9ull;
+        value ^= value >> 27;
+        value *= 0x94d049bb133111ebull;
+        value ^= value >> 31;
+        return value;
+    }
+
+    //!\brief Returns the shard a k-mer hash belongs to (top bits of the mixed hash).
+    static constexpr size_t shard_of(uint64_t const kmer) noexcept
+    {
+        static_assert(shard_count == 64, "The shift below assumes 64 shards.");
+        return mix(kmer) >> 58;
+    }
+
+    //!\brief One open-addressing shard with linear probing.
+    struct shard_type
+    {
+        //!\brief The keys of the buckets; empty buckets hold kmer_count_table::empty_key.
+        std::vector<uint64_t> keys{};
+        //!\brief The counts of the buckets, parallel to keys.
+        std::vector<uint64_t> counts{};
+        //!\brief The number of occupied buckets.
+        size_t filled{0};
+        //!\brief The sum of all counts of this shard.
+        uint64_t total{0};
+
+        //!\brief Adds `amount` to the bucket of `kmer`, growing the shard at 60% load.
+        void increment(uint64_t const kmer, uint64_t const hash, uint64_t const amount)
+        {
+            if (keys.empty() || filled * 5 >= keys.size() * 3)
+                grow();
+
+            size_t const mask = keys.size() - 1;
+            size_t position = hash & mask;
+            while (keys[position] != empty_key && keys[position] != kmer)
+                position = (position + 1) & mask;
+
+            if (keys[position] == empty_key)
+            {
+                keys[position] = kmer;
+                ++filled;
+            }
+            counts[position] += amount;
+            total += amount;
+        }
+
+        //!\brief Returns the count of `kmer`; `0` if absent.
+        uint64_t count(uint64_t const kmer, uint64_t const hash) const noexcept
+        {
+            if (keys.empty())
+                return 0;
+
+            size_t const mask = keys.size() - 1;
+            size_t position = hash & mask;
+            while (keys[position] != empty_key)
+            {
+                if (keys[position] == kmer)
+                    return counts[position];
+                position = (position + 1) & mask;
+            }
+            return 0;
+        }
+
+        //!\brief Invokes the given callable with every occupied (key, count) pair.
+        template <typename fn_t>
+        void for_each(fn_t && fn) const
+        {
+            for (size_t position = 0; position < keys.size(); ++position)
+                if (keys[position] != empty_key)
+                    fn(keys[position], counts[position]);
+        }
+
+        //!\brief Doubles the capacity (at least 64 buckets) and rehashes all entries.
+        void grow()
+        {
+            std::vector<uint64_t> old_keys = std::move(keys);
+            std::vector<uint64_t> old_counts = std::move(counts);
+
+            size_t const capacity = std::max<size_t>(64, old_keys.size() * 2);
+            keys.assign(capacity, empty_key);
+            counts.assign(capacity, 0);
+
+            size_t const mask = capacity - 1;
+            for (size_t old_position = 0; old_position < old_keys.size(); ++old_position)
+            {
+                if (old_keys[old_position] == empty_key)
+                    continue;
+
+                size_t position = mix(old_keys[old_position]) & mask;
+                while (keys[position] != empty_key)
+                    position = (position + 1) & mask;
+                keys[position] = old_keys[old_position];
+                counts[position] = old_counts[old_position];
+            }
+        }
+    };
+
+    //!\brief The shards of the table.
+    std::array<shard_type, shard_count> shards{};
+};
+
+/*!\brief A parallel streaming k-mer counting engine.
+ *
+ * \details
+ *
+ * Counts all overlapping k-mers of a stream of sequences into a seqan3::kmer_count_table. The input can be any
+ * input range of sequences or of seqan3::record elements (e.g. a seqan3::sequence_file_input), which makes the
+ * engine usable directly on file input without materializing the file: the single-pass input is consumed in
+ * batches of records under a lock, every worker thread counts its batches into a thread local table with a
+ * rolling hash (one multiplication and one subtraction per k-mer, as in seqan3::view::kmer_hash), and the local
+ * tables are merged shard-parallel at the end.
+ *
+ * The k-mer hashes are the base \f$\Sigma\f$ encodings of the k-mers, i.e. the counts can be looked up with the
+ * values produced by seqan3::view::kmer_hash over the same alphabet. Sequences shorter than the k-mer size
+ * contribute no k-mers.
+ *
+ * ### Example
+ *
+ * ```cpp
+ * sequence_file_input fin{"reads.fastq"};
+ * kmer_counter counter{5, 8}; // 5-mers, 8 threads
+ * kmer_count_table table = counter.count(fin);
+ * ```
+ *
+ * ### Exceptions
+ *
+ * Throws std::invalid_argument if the k-mer size is `0` or if the base \f$\Sigma\f$ encoding of a k-mer does
+ * not fit into 64 bits (e.g. \f$k > 31\f$ for seqan3::dna4).
+ */
+class kmer_counter
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    kmer_counter() = delete;                                 //!< Deleted; the k-mer size is required.
+    kmer_counter(kmer_counter const &) = default;            //!< Copy constructor.
+    kmer_counter & operator=(kmer_counter const &) = default;//!< Copy assignment.
+    kmer_counter(kmer_counter &&) = default;                 //!< Move constructor.
+    kmer_counter & operator=(kmer_counter &&) = default;     //!< Move assignment.
+    ~kmer_counter() = default;                               //!< Destructor.
+
+    /*!\brief Constructs the engine.
+     * \param[in] kmer_size    The k-mer size; must not be `0`.
+     * \param[in] thread_count The number of worker threads; values below `2` count sequentially.
+     * \param[in] batch_size   The number of sequences a worker fetches from the input per lock acquisition.
+     * \throws std::invalid_argument if `kmer_size` is `0`.
+     */
+    explicit kmer_counter(uint8_t const kmer_size,
+                          size_t const thread_count = std::thread::hardware_concurrency(),
+                          size_t const batch_size = 1024) :
+        kmer_size_{kmer_size}, thread_count_{std::max<size_t>(1, thread_count)},
+        batch_size_{std::max<size_t>(1, batch_size)}
+    {
+        if (kmer_size == 0)
+            throw std::invalid_argument{"The k-mer size must not be 0."};
+    }
+    //!\}
+
+    /*!\brief Counts all k-mers of the given input.
+     * \tparam input_t The type of the input; must model std::ranges::InputRange over sequences or over
+     *                 seqan3::record elements containing a seqan3::field::SEQ member.
+     * \param[in,out] input The input to consume; single-pass inputs (e.g. seqan3::sequence_file_input) are
+     *                      exhausted by the call.
+     * \returns A seqan3::kmer_count_table with the counts of all k-mers of all sequences.
+     * \throws std::invalid_argument if the base \f$\Sigma\f$ encoding of a k-mer does not fit into 64 bits.
+     *
+     * ### Complexity
+     *
+     * Linear in the total sequence length, distributed over the configured number of threads.
+     */
+    template <std::ranges::InputRange input_t>
+    kmer_count_table count(input_t && input) const
+    {
+        using item_type = value_type_t<std::remove_reference_t<input_t>>;
+        using sequence_ref_type = decltype(item_sequence(std::declval<item_type &>()));
+        using alphabet_type = innermost_value_type_t<remove_cvref_t<sequence_ref_type>>;
+
+        constexpr uint64_t sigma = alphabet_size_v<alphabet_type>;
+        uint64_t const leading_weight = validated_leading_weight(sigma); // sigma^(k-1)
+
+        // Counts all k-mers of one rank sequence with a rolling hash update.
+        auto count_sequence = [&] (std::vector<uint8_t> const & ranks, kmer_count_table & table)
+        {
+            if (ranks.size() < kmer_size_)
+                return;
+
+            uint64_t hash = 0;
+            for (size_t i = 0; i < kmer_size_; ++i)
+                hash = hash * sigma + ranks[i];
+            table.increment(hash);
+
+            for (size_t i = kmer_size_; i < ranks.size(); ++i)
+            {
+                hash = (hash - ranks[i - kmer_size_] * leading_weight) * sigma + ranks[i];
+                table.increment(hash);
+            }
+        };
+
+        auto input_it = std::ranges::begin(input);
+        auto input_end = std::ranges::end(input);
+        std::mutex input_mutex{};
+
+        std::vector<kmer_count_table> local_tables(thread_count_);
+
+        // Fetch batches of rank sequences from the single-pass input under the lock; count outside of it.
+        auto count_worker = [&] (kmer_count_table & local_table)
+        {
+            std::vector<std::vector<uint8_t>> batch{};
+            while (true)
+            {
+                batch.clear();
+                {
+                    std::lock_guard<std::mutex> guard{input_mutex};
+                    for (; input_it != input_end && batch.size() < batch_size_; ++input_it)
+                    {
+                        std::vector<uint8_t> ranks{};
+                        for (auto && letter : item_sequence(*input_it))
+                            ranks.push_back(to_rank(letter));
+                        batch.push_back(std::move(ranks));
+                    }
+                }
+
+                if (batch.empty())
+                    return;
+
+                for (std::vector<uint8_t> const & ranks : batch)
+                    count_sequence(ranks, local_table);
+            }
+        };
+
+        run_on_workers([&] (size_t const worker) { count_worker(local_tables[worker]); });
+
+        // Merge the local tables shard-parallel into the first one; a k-mer lands in the same shard of every
+        // table, hence distinct shards touch disjoint state.
+        run_on_workers([&] (size_t const worker)
+        {
+            for (size_t shard = worker; shard < kmer_count_table::shard_count; shard += thread_count_)
+                for (size_t other = 1; other < thread_count_; ++other)
+                    local_tables[0].merge_shard(shard, local_tables[other]);
+        });
+
+        return std::move(local_tables[0]);
+    }
+
+private:
+    /*!\brief Returns the sequence of an input element: the seqan3::field::SEQ member for records, the element
+     *        itself otherwise.
+     */
+    template <typename item_t>
+    static decltype(auto) item_sequence(item_t & item)
+    {
+        if constexpr (detail::is_type_specialisation_of_v<std::remove_const_t<item_t>, record>)
+            return get<field::SEQ>(item);
+        else
+            return (item);
+    }
+
+    /*!\brief Returns \f$\Sigma^{k-1}\f$, the weight of the leading letter of a window.
+     * \throws std::invalid_argument if \f$\Sigma^k\f$ exceeds 64 bits (the all-ones value is additionally
+     *         reserved as the empty bucket marker of the table).
+     */
+    uint64_t validated_leading_weight(uint64_t const sigma) const
+    {
+        uint64_t weight = 1;
+        for (uint8_t i = 1; i < kmer_size_; ++i)
+        {
+            if (weight > std::numeric_limits<uint64_t>::max() / sigma)
+                throw std::invalid_argument{"The encoding of a k-mer of this size does not fit into 64 bits."};
+            weight *= sigma;
+        }
+        if (weight > std::numeric_limits<uint64_t>::max() / sigma)
+            throw std::invalid_argument{"The encoding of a k-mer of this size does not fit into 64 bits."};
+        return weight;
+    }
+
+    //!\brief Invokes `fn(worker_index)` on every worker, using the calling thread for worker `0`.
+    template <typename fn_t>
+    void run_on_workers(fn_t && fn) const
+    {
+        if (thread_count_ == 1)
+        {
+            fn(0);
+            return;
+        }
+
+        std::vector<std::thread> workers{};
+        for (size_t worker = 1; worker < thread_count_; ++worker)
+            workers.emplace_back(fn, worker);
+        fn(0);
+        for (std::thread & worker : workers)
+            worker.join();
+    }
+
+    //!\brief The k-mer size.
+    uint8_t kmer_size_{};
+    //!\brief The number of worker threads.
+    size_t thread_count_{};
+    //!\brief The number of sequences fetched from the input per lock acquisition.
+    size_t batch_size_{};
+};
+
+//!\}
+
+} // namespace seqan3
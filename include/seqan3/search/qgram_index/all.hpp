@@ -0,0 +1,29 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Meta-header for the q-gram index module.
+ *
+ * \defgroup submodule_qgram_index Q-Gram Index
+ * \ingroup search
+ *
+ * # Q-Gram Indices
+ *
+ * Q-gram indices (also known as k-mer indices) store the text positions of all substrings of a fixed
+ * length q in a flat table that is addressed directly by the base \f$\Sigma\f$ encoding of the q-gram.
+ * Looking up all occurrences of a q-gram is a single table access, which makes them considerably faster
+ * than FM indices for fixed-length seed lookups (e.g. in seed-and-extend read mapping), at the cost of
+ * \f$\Sigma^q\f$ directory entries and the restriction to exact matches of a fixed length.
+ *
+ * The directory size grows exponentially in q, so q-gram indices are only feasible for small alphabets
+ * and moderate q (e.g. \f$q \le 15\f$ for seqan3::dna4). To reduce the position table, the index supports
+ * minimizer subsampling, storing only the smallest q-gram of every window of consecutive q-grams.
+ */
+
+#pragma once
+
+#include <seqan3/search/qgram_index/qgram_index.hpp>
@@ -0,0 +1,320 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides the seqan3::qgram_index.
+ */
+
+#pragma once
+
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/concept/core_language.hpp>
+#include <seqan3/core/metafunction/range.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3
+{
+
+/*!\addtogroup submodule_qgram_index
+ * \{
+ */
+
+/*!\brief A direct addressing q-gram index.
+ * \tparam text_t The type of the text to be indexed; must model std::ranges::RandomAccessRange.
+ *
+ * \details
+ *
+ * The index stores the text positions of all overlapping substrings of a fixed length q (the q-grams) in a
+ * flat position table, bucketed by the base \f$\Sigma\f$ encoding of the q-gram (the same encoding that
+ * seqan3::view::kmer_hash produces). A directory of \f$\Sigma^q + 1\f$ offsets addresses the buckets, such
+ * that all occurrences of a q-gram are retrieved with a single lookup and no comparisons — in contrast to an
+ * FM index, where every seed lookup costs q backward search steps. The q-gram size must therefore be chosen
+ * such that the directory fits into memory (e.g. \f$q \le 15\f$ for seqan3::dna4).
+ *
+ * Optionally, the indexed positions can be subsampled with minimizers: with a window size of \f$w > 1\f$ only
+ * the lexicographically smallest q-gram of every window of \f$w\f$ consecutive q-grams is stored (ties are
+ * broken towards the leftmost position). This reduces the index size roughly by a factor of
+ * \f$\frac{w + 1}{2}\f$ while any two overlapping occurrences of a common substring of length
+ * \f$q + w - 1\f$ still share a sampled q-gram. The query side has to sample its seeds with the same scheme.
+ *
+ * The index supports texts and collections of texts (e.g. seqan3::concatenated_sequences); for collections
+ * the reported positions are (text id, position) pairs, analogously to the FM index cursors. Unlike the FM
+ * index the q-gram index does not reference the text after construction.
+ */
+template <std::ranges::RandomAccessRange text_t>
+//!\cond
+    requires Semialphabet<innermost_value_type_t<text_t>>
+//!\endcond
+class qgram_index
+{
+public:
+    /*!\name Member types
+     * \{
+     */
+    //!\brief The type of the indexed text.
+    using text_type = text_t;
+    //!\brief The type of the underlying character of text_type.
+    using char_type = innermost_value_type_t<text_t>;
+    //!\brief Type for representing positions in the indexed text.
+    using size_type = uint64_t;
+    //!\}
+
+    static_assert(dimension_v<text_t> == 1 || dimension_v<text_t> == 2,
+                  "Only texts or collections of texts can be indexed.");
+
+    //!\brief Indicates whether index is built over a collection.
+    static bool constexpr is_collection = dimension_v<text_t> == 2;
+
+    //!\brief The type of the reported positions: a position for texts, a (text id, position) pair for
+    //!       collections.
+    using position_type = std::conditional_t<is_collection, std::pair<size_type, size_type>, size_type>;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    qgram_index() = default;                                //!< Default constructor.
+    qgram_index(qgram_index const &) = default;             //!< Copy constructor.
+    qgram_index & operator=(qgram_index const &) = default; //!< Copy assignment.
+    qgram_index(qgram_index &&) = default;                  //!< Move constructor.
+    qgram_index & operator=(qgram_index &&) = default;      //!< Move assignment.
+    ~qgram_index() = default;                               //!< Destructor.
+
+    /*!\brief Constructor that immediately constructs the index given a range.
+              The range cannot be an rvalue (i.e. a temporary object) and has to be non-empty.
+     * \param[in] text        The text to construct from.
+     * \param[in] qgram_size  The length q of the indexed substrings; must be at least 1.
+     * \param[in] window_size The number of consecutive q-grams of which only the minimizer is indexed;
+     *                        1 (the default) indexes every q-gram.
+     *
+     * ### Complexity
+     *
+     * Linear in the text size plus \f$\Sigma^q\f$ for the directory.
+     */
+    qgram_index(text_t const & text, uint8_t const qgram_size, uint32_t const window_size = 1)
+    {
+        construct(text, qgram_size, window_size);
+    }
+
+    //!\overload
+    qgram_index(text_t &&, uint8_t const, uint32_t const window_size = 1) = delete;
+
+    //!\overload
+    qgram_index(text_t const &&, uint8_t const, uint32_t const window_size = 1) = delete;
+    //!\}
+
+    /*!\brief Constructs the index given a range.
+              The range cannot be an rvalue (i.e. a temporary object) and has to be non-empty.
+     * \param[in] text        The text to construct from.
+     * \param[in] qgram_size  The length q of the indexed substrings; must be at least 1.
+     * \param[in] window_size The number of consecutive q-grams of which only the minimizer is indexed;
+     *                        1 (the default) indexes every q-gram.
+     * \throws std::invalid_argument if `qgram_size` or `window_size` is 0, the directory would exceed the
+     *         addressable size, or the text is empty.
+     *
+     * ### Complexity
+     *
+     * Linear in the text size plus \f$\Sigma^q\f$ for the directory.
+     *
+     * ### Exceptions
+     *
+     * Basic exception guarantee.
+     */
+    void construct(text_t const & text, uint8_t const qgram_size, uint32_t const window_size = 1)
+    {
+        if (qgram_size == 0)
+            throw std::invalid_argument("The q-gram size must be at least 1.");
+        if (window_size == 0)
+            throw std::invalid_argument("The window size must be at least 1.");
+
+        size_type bucket_count = 1;
+        for (uint8_t i = 0; i < qgram_size; ++i)
+        {
+            if (bucket_count > std::numeric_limits<size_type>::max() / sigma)
+                throw std::invalid_argument("The directory for " + std::to_string(qgram_size) +
+                                            "-grams would exceed the addressable size.");
+            bucket_count *= sigma;
+        }
+
+        // text must not be empty
+        if (std::ranges::begin(text) == std::ranges::end(text))
+            throw std::invalid_argument("The text that is indexed cannot be empty.");
+
+        qgram_length = qgram_size;
+        window_length = window_size;
+
+        // extract the (possibly subsampled) q-grams, then distribute them with a counting sort
+        std::vector<std::pair<size_type, position_type>> qgrams;
+        if constexpr (is_collection)
+        {
+            for (size_type text_id = 0; text_id < std::ranges::size(text); ++text_id)
+                extract_qgrams(text[text_id], text_id, qgrams);
+        }
+        else
+        {
+            extract_qgrams(text, 0, qgrams);
+        }
+
+        directory.assign(bucket_count + 1, 0);
+        for (auto const & [code, position] : qgrams)
+            ++directory[code + 1];
+        for (size_type code = 1; code <= bucket_count; ++code)
+            directory[code] += directory[code - 1];
+
+        positions.resize(qgrams.size());
+        std::vector<size_type> bucket_offset(directory.begin(), directory.end() - 1);
+        for (auto const & [code, position] : qgrams)
+            positions[bucket_offset[code]++] = position;
+    }
+
+    //!\brief Returns the length of the indexed q-grams.
+    uint8_t qgram_size() const noexcept
+    {
+        return qgram_length;
+    }
+
+    //!\brief Returns the size of the minimizer window (1 if every q-gram is indexed).
+    uint32_t window_size() const noexcept
+    {
+        return window_length;
+    }
+
+    //!\brief Returns the number of indexed text positions.
+    size_type size() const noexcept
+    {
+        return positions.size();
+    }
+
+    /*!\brief Returns all indexed positions of the q-gram at the begin of the given sequence.
+     * \tparam seq_t The type of the sequence; must model std::ranges::RandomAccessRange over the index's
+     *               alphabet.
+     * \param[in] seq The sequence whose first qgram_size() characters are looked up.
+     * \returns A (possibly empty) range of positions, sorted in ascending order.
+     *
+     * ### Complexity
+     *
+     * Constant — independent of the text size and the number of occurrences.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    template <std::ranges::RandomAccessRange seq_t>
+    //!\cond
+        requires ImplicitlyConvertibleTo<innermost_value_type_t<seq_t>, char_type>
+    //!\endcond
+    auto lookup(seq_t && seq) const noexcept
+    {
+        assert(std::ranges::size(seq) >= qgram_length);
+
+        size_type code = 0;
+        for (uint8_t i = 0; i < qgram_length; ++i)
+            code = code * sigma + to_rank(seq[i]);
+
+        return std::ranges::subrange{positions.begin() + directory[code], positions.begin() + directory[code + 1]};
+    }
+
+private:
+    //!\brief The alphabet size of the indexed text.
+    static constexpr size_type sigma = alphabet_size_v<char_type>;
+
+    /*!\brief Appends the (code, position) pairs of all q-grams of a single text, respecting the minimizer
+     *        window.
+     */
+    template <typename single_text_t>
+    void extract_qgrams(single_text_t const & text, size_type const text_id,
+                        std::vector<std::pair<size_type, position_type>> & qgrams) const
+    {
+        if (std::ranges::size(text) < qgram_length)
+            return;
+
+        auto emplace_qgram = [&] (size_type const code, size_type const text_pos)
+        {
+            if constexpr (is_collection)
+                qgrams.emplace_back(code, position_type{text_id, text_pos});
+            else
+                qgrams.emplace_back(code, text_pos);
+        };
+
+        size_type const qgram_count = std::ranges::size(text) - qgram_length + 1;
+        size_type const code_mod = bucket_count_of(qgram_length - 1); // drops the leftmost character
+
+        size_type code = 0;
+        for (uint8_t i = 0; i + 1 < qgram_length; ++i)
+            code = code * sigma + to_rank(text[i]);
+
+        if (window_length == 1)
+        {
+            for (size_type text_pos = 0; text_pos < qgram_count; ++text_pos)
+            {
+                code = (code % code_mod) * sigma + to_rank(text[text_pos + qgram_length - 1]);
+                emplace_qgram(code, text_pos);
+            }
+            return;
+        }
+
+        // window minimizers: a monotone queue of (code, position) candidates with the smallest code
+        // (leftmost on ties) at the front; a position is recorded when it first becomes a window minimizer
+        size_type const w = std::min<size_type>(window_length, qgram_count); // short texts form one window
+        std::vector<std::pair<size_type, size_type>> window{};
+        size_type window_begin = 0;
+        size_type last_recorded = std::numeric_limits<size_type>::max();
+
+        for (size_type text_pos = 0; text_pos < qgram_count; ++text_pos)
+        {
+            code = (code % code_mod) * sigma + to_rank(text[text_pos + qgram_length - 1]);
+
+            while (window.size() > window_begin && window.back().first > code)
+                window.pop_back();
+            window.emplace_back(code, text_pos);
+
+            if (text_pos + 1 < w)
+                continue; // the first window is not complete yet
+
+            if (window[window_begin].second + w <= text_pos) // the front fell out of the window
+                ++window_begin;
+            if (window_begin > w) // compact the queue, keeping the amortised cost constant
+            {
+                window.erase(window.begin(), window.begin() + window_begin);
+                window_begin = 0;
+            }
+
+            auto const & [minimizer_code, minimizer_pos] = window[window_begin];
+            if (minimizer_pos != last_recorded)
+            {
+                emplace_qgram(minimizer_code, minimizer_pos);
+                last_recorded = minimizer_pos;
+            }
+        }
+    }
+
+    //!\brief Returns \f$\Sigma^q\f$ for the given q (without overflow checks).
+    static size_type bucket_count_of(uint8_t const q) noexcept
+    {
+        size_type count = 1;
+        for (uint8_t i = 0; i < q; ++i)
+            count *= sigma;
+        return count;
+    }
+
+    //!\brief The length of the indexed q-grams.
+    uint8_t qgram_length{0};
+    //!\brief The size of the minimizer window (1 if every q-gram is indexed).
+    uint32_t window_length{1};
+    //!\brief For every q-gram code the offset of its bucket in the position table (plus a final sentinel).
+    std::vector<size_type> directory{};
+    //!\brief The indexed positions, bucketed by q-gram code, ascending within each bucket.
+    std::vector<position_type> positions{};
+};
+
+//!\}
+
+} // namespace seqan3
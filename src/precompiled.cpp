@@ -0,0 +1,15 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Translation unit of the pre-instantiation library; see seqan3/precompiled.hpp.
+ */
+
+// Turns the extern-template list of the header into explicit instantiation definitions.
+#define SEQAN3_PRECOMPILED_DEFINE 1
+
+#include <seqan3/precompiled.hpp>
@@ -0,0 +1,116 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Contains seqan3::test::memory_usage for peak-memory measurements in benchmarks.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdio>
+
+#include <benchmark/benchmark.h>
+
+#include <seqan3/core/platform.hpp>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#include <unistd.h>
+#define SEQAN3_HAS_RUSAGE 1
+#endif
+
+namespace seqan3::test
+{
+
+/*!\brief Reports the peak resident set size of a benchmark workload as google-benchmark counters.
+ *
+ * \details
+ *
+ * Construction workloads (FM-index construction, container bulk loads) are often limited by their peak
+ * memory rather than their runtime — it decides which machines can build which references. This fixture
+ * samples the process peak RSS via `getrusage` and reports two counters:
+ *
+ * - `peak_rss`: the absolute peak resident set size of the process in bytes.
+ * - `peak_rss_growth`: how much the peak grew between constructing the fixture and calling report(),
+ *   i.e. the additional memory the measured workload required.
+ *
+ * Usage:
+ *
+ * ```cpp
+ * test::memory_usage mem{}; // samples the baseline
+ * for (auto _ : state)
+ *     // ... allocating workload ...
+ * mem.report(state);
+ * ```
+ *
+ * \attention The kernel's peak-RSS watermark is monotonic for the process, so `peak_rss_growth` is only
+ * meaningful for the *largest* workload measured in a binary run; for a series of growing inputs (the
+ * usual `->Range(...)` setup) every size reports its own growth correctly because the peak rises with
+ * each larger input, but re-measuring a smaller input afterwards reports zero growth.
+ */
+class memory_usage
+{
+public:
+    //!\brief Samples the baseline peak RSS.
+    memory_usage() : baseline_bytes{peak_rss_bytes()}
+    {}
+
+    //!\brief Reports `peak_rss` and `peak_rss_growth` (in bytes) via `state.counters`.
+    void report(benchmark::State & state) const
+    {
+        size_t const peak = peak_rss_bytes();
+        state.counters["peak_rss"] = benchmark::Counter(static_cast<double>(peak),
+                                                        benchmark::Counter::kDefaults,
+                                                        benchmark::Counter::OneK::kIs1024);
+        state.counters["peak_rss_growth"] = benchmark::Counter(static_cast<double>(peak - baseline_bytes),
+                                                               benchmark::Counter::kDefaults,
+                                                               benchmark::Counter::OneK::kIs1024);
+    }
+
+    //!\brief Returns the peak resident set size of this process in bytes (0 if unavailable).
+    static size_t peak_rss_bytes()
+    {
+#if defined(SEQAN3_HAS_RUSAGE)
+        rusage usage{};
+        if (getrusage(RUSAGE_SELF, &usage) != 0)
+            return 0;
+#if defined(__APPLE__)
+        return static_cast<size_t>(usage.ru_maxrss); // bytes on macOS
+#else
+        return static_cast<size_t>(usage.ru_maxrss) * 1024; // kibibytes on Linux and the BSDs
+#endif
+#else
+        return 0;
+#endif
+    }
+
+    //!\brief Returns the current resident set size of this process in bytes (0 if unavailable).
+    static size_t current_rss_bytes()
+    {
+#if defined(__linux__)
+        long pages = 0;
+        if (std::FILE * statm = std::fopen("/proc/self/statm", "r"); statm != nullptr)
+        {
+            // second field of statm is the resident size in pages
+            long dummy = 0;
+            if (std::fscanf(statm, "%ld %ld", &dummy, &pages) != 2)
+                pages = 0;
+            std::fclose(statm);
+        }
+        return static_cast<size_t>(pages) * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#else
+        return 0;
+#endif
+    }
+
+private:
+    //!\brief The peak RSS when the fixture was constructed.
+    size_t baseline_bytes;
+};
+
+} // namespace seqan3::test
@@ -0,0 +1,193 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Contains seqan3::test::perf_counters for hardware counter measurements in benchmarks.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include <seqan3/core/platform.hpp>
+
+#if defined(__linux__)
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define SEQAN3_HAS_PERF_EVENTS 1
+#endif
+
+namespace seqan3::test
+{
+
+/*!\brief Measures hardware performance counters around a benchmark loop and reports them as
+ *        google-benchmark counters.
+ *
+ * \details
+ *
+ * Wall-clock numbers cannot distinguish "more instructions" from "more cache misses", which matters for
+ * layout-sensitive code like the trace matrix or the gap decorator. This helper opens perf events for
+ * cycles, instructions, L1 data-cache misses, last-level-cache misses and branch misses and reports the
+ * per-iteration averages via `state.counters` (plus instructions-per-cycle as `ipc`).
+ *
+ * Usage:
+ *
+ * ```cpp
+ * test::perf_counters counters{};
+ * counters.start();
+ * for (auto _ : state)
+ *     // ... code under measurement ...
+ * counters.stop();
+ * counters.report(state);
+ * ```
+ *
+ * The events are only available on Linux and only if the kernel grants access
+ * (see `/proc/sys/kernel/perf_event_paranoid`); unavailable counters are silently omitted from the
+ * report, so benchmarks using this helper still run everywhere.
+ */
+class perf_counters
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    //!\brief Opens the perf events; events the kernel refuses stay closed and are skipped.
+    perf_counters()
+    {
+#if defined(SEQAN3_HAS_PERF_EVENTS)
+        for (event & e : events)
+            e.fd = open_event(e.type, e.config);
+#endif
+    }
+
+    perf_counters(perf_counters const &) = delete;             //!< Deleted; owns file descriptors.
+    perf_counters(perf_counters &&) = delete;                  //!< Deleted; owns file descriptors.
+    perf_counters & operator=(perf_counters const &) = delete; //!< Deleted; owns file descriptors.
+    perf_counters & operator=(perf_counters &&) = delete;      //!< Deleted; owns file descriptors.
+
+    //!\brief Closes the perf events.
+    ~perf_counters()
+    {
+#if defined(SEQAN3_HAS_PERF_EVENTS)
+        for (event & e : events)
+            if (e.fd != -1)
+                close(e.fd);
+#endif
+    }
+    //!\}
+
+    //!\brief Resets and enables all available counters.
+    void start()
+    {
+#if defined(SEQAN3_HAS_PERF_EVENTS)
+        for (event & e : events)
+        {
+            if (e.fd != -1)
+            {
+                ioctl(e.fd, PERF_EVENT_IOC_RESET, 0);
+                ioctl(e.fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+#endif
+    }
+
+    //!\brief Disables all available counters.
+    void stop()
+    {
+#if defined(SEQAN3_HAS_PERF_EVENTS)
+        for (event & e : events)
+            if (e.fd != -1)
+                ioctl(e.fd, PERF_EVENT_IOC_DISABLE, 0);
+#endif
+    }
+
+    //!\brief Reports the per-iteration averages of all available counters via `state.counters`.
+    void report(benchmark::State & state) const
+    {
+#if defined(SEQAN3_HAS_PERF_EVENTS)
+        double const iterations = state.iterations() > 0 ? static_cast<double>(state.iterations()) : 1.0;
+
+        double cycles = 0.0;
+        double instructions = 0.0;
+
+        for (event const & e : events)
+        {
+            if (e.fd == -1)
+                continue;
+
+            uint64_t value = 0;
+            if (read(e.fd, &value, sizeof(value)) != sizeof(value))
+                continue;
+
+            state.counters[e.name] = benchmark::Counter(static_cast<double>(value) / iterations,
+                                                        benchmark::Counter::kAvgThreads);
+
+            if (std::strcmp(e.name, "cycles") == 0)
+                cycles = static_cast<double>(value);
+            else if (std::strcmp(e.name, "instructions") == 0)
+                instructions = static_cast<double>(value);
+        }
+
+        if (cycles > 0.0 && instructions > 0.0)
+            state.counters["ipc"] = benchmark::Counter(instructions / cycles, benchmark::Counter::kAvgThreads);
+#else
+        (void)state;
+#endif
+    }
+
+private:
+#if defined(SEQAN3_HAS_PERF_EVENTS)
+    //!\brief One perf event: its configuration, report name and file descriptor.
+    struct event
+    {
+        //!\brief The perf event type (PERF_TYPE_HARDWARE or PERF_TYPE_HW_CACHE).
+        uint32_t type;
+        //!\brief The type-specific event selector.
+        uint64_t config;
+        //!\brief The key under which the value is reported.
+        char const * name;
+        //!\brief The event's file descriptor; -1 if the kernel refused the event.
+        int fd{-1};
+    };
+
+    //!\brief The measured events.
+    std::array<event, 5> events
+    {{
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, "cycles"},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, "instructions"},
+        {PERF_TYPE_HW_CACHE,
+         PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+         "L1d_misses"},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, "LLC_misses"},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, "branch_misses"}
+    }};
+
+    //!\brief Opens one counting perf event for this process on any CPU; returns -1 on failure.
+    static int open_event(uint32_t const type, uint64_t const config)
+    {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+
+        return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0 /*this process*/, -1 /*any cpu*/,
+                                        -1 /*no group*/, 0));
+    }
+#endif
+};
+
+} // namespace seqan3::test
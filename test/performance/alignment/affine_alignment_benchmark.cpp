@@ -16,6 +16,7 @@
 #include <seqan3/alignment/pairwise/align_pairwise.hpp>
 #include <seqan3/alphabet/aminoacid/aa20.hpp>
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/performance/perf_counters.hpp>
 
 #if __has_include(<seqan/align.h>)
     #define SEQAN3_HAS_SEQAN2 1
@@ -80,11 +81,16 @@ void seqan3_affine_dna4(benchmark::State & state)
     auto seq1 = generate_sequence_seqan3<seqan3::dna4>(500, 0, 0);
     auto seq2 = generate_sequence_seqan3<seqan3::dna4>(500, 0, 1);
 
+    test::perf_counters counters{};
+
+    counters.start();
     for (auto _ : state)
     {
         auto rng = align_pairwise(std::tie(seq1, seq2), cfg);
         *seqan3::begin(rng);
     }
+    counters.stop();
+    counters.report(state);
 }
 
 BENCHMARK(seqan3_affine_dna4);
@@ -120,11 +126,16 @@ void seqan3_affine_dna4_trace(benchmark::State & state)
     auto seq1 = generate_sequence_seqan3<seqan3::dna4>(500, 0, 0);
     auto seq2 = generate_sequence_seqan3<seqan3::dna4>(500, 0, 1);
 
+    test::perf_counters counters{};
+
+    counters.start();
     for (auto _ : state)
     {
         auto rng = align_pairwise(std::tie(seq1, seq2), cfg);
         *seqan3::begin(rng);
     }
+    counters.stop();
+    counters.report(state);
 }
 
 BENCHMARK(seqan3_affine_dna4_trace);
@@ -169,11 +180,16 @@ void seqan3_affine_dna4_collection(benchmark::State & state)
         vec.push_back(std::pair{seq1, seq2});
     }
 
+    test::perf_counters counters{};
+
+    counters.start();
     for (auto _ : state)
     {
         for (auto && rng : align_pairwise(vec, cfg))
             rng.score();
     }
+    counters.stop();
+    counters.report(state);
 }
 
 BENCHMARK(seqan3_affine_dna4_collection);
@@ -225,11 +241,16 @@ void seqan3_affine_dna4_trace_collection(benchmark::State & state)
         vec.push_back(std::pair{seq1, seq2});
     }
 
+    test::perf_counters counters{};
+
+    counters.start();
     for (auto _ : state)
     {
         for (auto && rng : align_pairwise(vec, cfg))
             rng.score();
     }
+    counters.stop();
+    counters.report(state);
 }
 
 BENCHMARK(seqan3_affine_dna4_trace_collection);
@@ -0,0 +1,235 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+
+using namespace seqan3;
+
+template <typename alphabet_t>
+auto generate_sequence_seqan3(size_t const len = 500,
+                              size_t const variance = 0,
+                              size_t const seed = 0)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<uint8_t> dis_alpha(0, alphabet_size_v<alphabet_t> - 1);
+    std::uniform_int_distribution<size_t> dis_length(len - variance, len + variance);
+
+    std::vector<alphabet_t> sequence;
+
+    size_t length = dis_length(gen);
+    for (size_t l = 0; l < length; ++l)
+        sequence.push_back(alphabet_t{}.assign_rank(dis_alpha(gen)));
+
+    return sequence;
+}
+
+//!\brief The base configuration shared by the affine benchmarks.
+inline constexpr auto affine_cfg = align_cfg::mode{global_alignment} |
+                                   align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}} |
+                                   align_cfg::scoring{nucleotide_scoring_scheme{match_score{4},
+                                                                                mismatch_score{-5}}};
+
+// ============================================================================
+//  affine; banded; score and trace; dna4; single
+// ============================================================================
+
+void seqan3_affine_dna4_banded(benchmark::State & state)
+{
+    size_t const length = state.range(0);
+    auto cfg = affine_cfg |
+               align_cfg::band{static_band{lower_bound{-32}, upper_bound{32}}} |
+               align_cfg::result{with_score};
+
+    auto seq1 = generate_sequence_seqan3<seqan3::dna4>(length, 0, 0);
+    auto seq2 = generate_sequence_seqan3<seqan3::dna4>(length, 0, 1);
+
+    for (auto _ : state)
+    {
+        auto rng = align_pairwise(std::tie(seq1, seq2), cfg);
+        *seqan3::begin(rng);
+    }
+}
+
+BENCHMARK(seqan3_affine_dna4_banded)->RangeMultiplier(10)->Range(100, 100000);
+
+void seqan3_affine_dna4_banded_trace(benchmark::State & state)
+{
+    size_t const length = state.range(0);
+    auto cfg = affine_cfg |
+               align_cfg::band{static_band{lower_bound{-32}, upper_bound{32}}} |
+               align_cfg::result{with_alignment};
+
+    auto seq1 = generate_sequence_seqan3<seqan3::dna4>(length, 0, 0);
+    auto seq2 = generate_sequence_seqan3<seqan3::dna4>(length, 0, 1);
+
+    for (auto _ : state)
+    {
+        auto rng = align_pairwise(std::tie(seq1, seq2), cfg);
+        (*seqan3::begin(rng)).alignment();
+    }
+}
+
+BENCHMARK(seqan3_affine_dna4_banded_trace)->RangeMultiplier(10)->Range(100, 10000);
+
+// ============================================================================
+//  affine; unbanded; trace; dna4; single; scaling over the sequence length
+// ============================================================================
+
+void seqan3_affine_dna4_trace_length(benchmark::State & state)
+{
+    size_t const length = state.range(0);
+    auto cfg = affine_cfg | align_cfg::result{with_alignment};
+
+    auto seq1 = generate_sequence_seqan3<seqan3::dna4>(length, 0, 0);
+    auto seq2 = generate_sequence_seqan3<seqan3::dna4>(length, 0, 1);
+
+    for (auto _ : state)
+    {
+        auto rng = align_pairwise(std::tie(seq1, seq2), cfg);
+        (*seqan3::begin(rng)).alignment();
+    }
+}
+
+// The quadratic trace matrix limits the feasible lengths; 100 kb is covered by the banded benchmark.
+BENCHMARK(seqan3_affine_dna4_trace_length)->RangeMultiplier(10)->Range(100, 10000);
+
+// ============================================================================
+//  edit distance; score; dna4; single
+// ============================================================================
+
+void seqan3_edit_distance_dna4(benchmark::State & state)
+{
+    size_t const length = state.range(0);
+    auto cfg = align_cfg::edit | align_cfg::result{with_score};
+
+    auto seq1 = generate_sequence_seqan3<seqan3::dna4>(length, 0, 0);
+    auto seq2 = generate_sequence_seqan3<seqan3::dna4>(length, 0, 1);
+
+    for (auto _ : state)
+    {
+        auto rng = align_pairwise(std::tie(seq1, seq2), cfg);
+        *seqan3::begin(rng);
+    }
+}
+
+BENCHMARK(seqan3_edit_distance_dna4)->RangeMultiplier(10)->Range(100, 100000);
+
+void seqan3_edit_distance_dna4_max_error(benchmark::State & state)
+{
+    size_t const length = state.range(0);
+    auto cfg = align_cfg::edit | align_cfg::max_error{32u} | align_cfg::result{with_score};
+
+    auto seq1 = generate_sequence_seqan3<seqan3::dna4>(length, 0, 0);
+    auto seq2 = generate_sequence_seqan3<seqan3::dna4>(length, 0, 1);
+
+    for (auto _ : state)
+    {
+        auto rng = align_pairwise(std::tie(seq1, seq2), cfg);
+        *seqan3::begin(rng);
+    }
+}
+
+BENCHMARK(seqan3_edit_distance_dna4_max_error)->RangeMultiplier(10)->Range(100, 100000);
+
+// ============================================================================
+//  affine; semi-global (free end gaps); score; dna4; single
+// ============================================================================
+
+void seqan3_affine_dna4_semi_global(benchmark::State & state)
+{
+    size_t const length = state.range(0);
+    auto cfg = affine_cfg |
+               align_cfg::aligned_ends{free_ends_all} |
+               align_cfg::result{with_score};
+
+    auto seq1 = generate_sequence_seqan3<seqan3::dna4>(length, 0, 0);
+    auto seq2 = generate_sequence_seqan3<seqan3::dna4>(length, 0, 1);
+
+    for (auto _ : state)
+    {
+        auto rng = align_pairwise(std::tie(seq1, seq2), cfg);
+        *seqan3::begin(rng);
+    }
+}
+
+BENCHMARK(seqan3_affine_dna4_semi_global)->RangeMultiplier(10)->Range(100, 10000);
+
+// ============================================================================
+//  affine; score; dna4; collection; pairs per second over the sequence length
+// ============================================================================
+
+void seqan3_affine_dna4_batch(benchmark::State & state)
+{
+    size_t const length = state.range(0);
+    auto cfg = affine_cfg | align_cfg::result{with_score};
+
+    using sequence_t = decltype(generate_sequence_seqan3<seqan3::dna4>());
+
+    // Keep the total number of computed cells roughly constant over the lengths.
+    size_t const pair_count = std::max<size_t>(1, 100000000 / (length * length));
+
+    std::vector<std::pair<sequence_t, sequence_t>> vec;
+    for (unsigned i = 0; i < pair_count; ++i)
+    {
+        sequence_t seq1 = generate_sequence_seqan3<seqan3::dna4>(length, 0, i);
+        sequence_t seq2 = generate_sequence_seqan3<seqan3::dna4>(length, 0, i + pair_count);
+        vec.push_back(std::pair{seq1, seq2});
+    }
+
+    for (auto _ : state)
+    {
+        for (auto && rng : align_pairwise(vec, cfg))
+            rng.score();
+    }
+
+    // Reports the batch throughput in pairs per second.
+    state.SetItemsProcessed(state.iterations() * pair_count);
+}
+
+BENCHMARK(seqan3_affine_dna4_batch)->RangeMultiplier(10)->Range(100, 10000);
+
+void seqan3_edit_distance_dna4_batch(benchmark::State & state)
+{
+    size_t const length = state.range(0);
+    auto cfg = align_cfg::edit | align_cfg::result{with_score};
+
+    using sequence_t = decltype(generate_sequence_seqan3<seqan3::dna4>());
+
+    size_t const pair_count = std::max<size_t>(1, 100000000 / (length * length));
+
+    std::vector<std::pair<sequence_t, sequence_t>> vec;
+    for (unsigned i = 0; i < pair_count; ++i)
+    {
+        sequence_t seq1 = generate_sequence_seqan3<seqan3::dna4>(length, 0, i);
+        sequence_t seq2 = generate_sequence_seqan3<seqan3::dna4>(length, 0, i + pair_count);
+        vec.push_back(std::pair{seq1, seq2});
+    }
+
+    for (auto _ : state)
+    {
+        for (auto && rng : align_pairwise(vec, cfg))
+            rng.score();
+    }
+
+    state.SetItemsProcessed(state.iterations() * pair_count);
+}
+
+BENCHMARK(seqan3_edit_distance_dna4_batch)->RangeMultiplier(10)->Range(100, 100000);
+
+// ============================================================================
+//  instantiate tests
+// ============================================================================
+
+BENCHMARK_MAIN();
@@ -7,10 +7,15 @@
 
 #include <algorithm>
 #include <cstring>
+#include <vector>
 
 #include <benchmark/benchmark.h>
 
 #include <seqan3/alphabet/all.hpp>
+#include <seqan3/range/view/convert.hpp>
+#include <seqan3/range/view/convert_copy.hpp>
+#include <seqan3/range/view/reverse_complement.hpp>
+#include <seqan3/range/view/to_char.hpp>
 
 using namespace seqan3;
 
@@ -137,4 +142,171 @@ BENCHMARK_TEMPLATE(to_rank, gapped<dna4>);
 BENCHMARK_TEMPLATE(to_rank, union_composition<gap,dna4,dna5,dna15,rna15,rna4,rna5>);
 BENCHMARK_TEMPLATE(to_rank, union_composition<char, dna4, dna5, dna15>);
 
+// ============================================================================
+//  throughput over large buffers (items per second == elements per second)
+// ============================================================================
+
+inline constexpr size_t buffer_size = 1 << 16;
+
+//!\brief Generates a buffer of deterministic pseudo random letters of the given alphabet.
+template <Semialphabet alphabet_t>
+static std::vector<alphabet_t> random_buffer()
+{
+    std::vector<alphabet_t> buffer(buffer_size);
+    for (size_t i = 0; i < buffer_size; ++i)
+        assign_rank(buffer[i], (i * 7 + 3) % alphabet_size_v<alphabet_t>);
+    return buffer;
+}
+
+//!\brief Reads both components of every letter of a composition buffer (e.g. qualified sequences).
+template <typename composition_t>
+static void component_access(benchmark::State & state)
+{
+    std::vector<composition_t> const buffer = random_buffer<composition_t>();
+
+    for (auto _ : state)
+    {
+        size_t sum = 0;
+        for (composition_t const & letter : buffer)
+            sum += to_rank(get<0>(letter)) + to_rank(get<1>(letter));
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * buffer_size);
+}
+
+//!\brief Reassigns one component of every letter of a composition buffer (e.g. masking a sequence).
+template <typename composition_t, typename component_t>
+static void component_assign(benchmark::State & state)
+{
+    std::vector<composition_t> buffer = random_buffer<composition_t>();
+    std::vector<component_t> const components = random_buffer<component_t>();
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < buffer_size; ++i)
+            buffer[i] = components[i];
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetItemsProcessed(state.iterations() * buffer_size);
+}
+
+//!\brief Converts a whole buffer between two alphabets, one element at a time (the view path).
+template <typename in_t, typename out_t>
+static void convert_per_element(benchmark::State & state)
+{
+    std::vector<in_t> const buffer = random_buffer<in_t>();
+    std::vector<out_t> target(buffer_size);
+
+    for (auto _ : state)
+    {
+        std::ranges::copy(buffer | view::convert<out_t>, target.begin());
+        benchmark::DoNotOptimize(target.data());
+    }
+    state.SetItemsProcessed(state.iterations() * buffer_size);
+}
+
+//!\brief Converts a whole buffer between two alphabets with the chunk-wise bulk path.
+template <typename in_t, typename out_t>
+static void convert_bulk(benchmark::State & state)
+{
+    std::vector<in_t> const buffer = random_buffer<in_t>();
+    std::vector<out_t> target(buffer_size);
+
+    for (auto _ : state)
+    {
+        convert_copy(buffer, target);
+        benchmark::DoNotOptimize(target.data());
+    }
+    state.SetItemsProcessed(state.iterations() * buffer_size);
+}
+
+//!\brief Extracts the character representation of a whole buffer, one element at a time.
+template <typename alphabet_t>
+static void to_char_per_element(benchmark::State & state)
+{
+    std::vector<alphabet_t> const buffer = random_buffer<alphabet_t>();
+    std::vector<underlying_char_t<alphabet_t>> target(buffer_size);
+
+    for (auto _ : state)
+    {
+        std::ranges::copy(buffer | view::to_char, target.begin());
+        benchmark::DoNotOptimize(target.data());
+    }
+    state.SetItemsProcessed(state.iterations() * buffer_size);
+}
+
+//!\brief Extracts the character representation of a whole buffer with the chunk-wise bulk path.
+template <typename alphabet_t>
+static void to_char_bulk(benchmark::State & state)
+{
+    std::vector<alphabet_t> const buffer = random_buffer<alphabet_t>();
+    std::vector<underlying_char_t<alphabet_t>> target(buffer_size);
+
+    for (auto _ : state)
+    {
+        convert_copy(buffer, target);
+        benchmark::DoNotOptimize(target.data());
+    }
+    state.SetItemsProcessed(state.iterations() * buffer_size);
+}
+
+//!\brief Complements a whole nucleotide buffer, one element at a time.
+template <NucleotideAlphabet alphabet_t>
+static void complement_per_element(benchmark::State & state)
+{
+    std::vector<alphabet_t> buffer = random_buffer<alphabet_t>();
+
+    for (auto _ : state)
+    {
+        for (alphabet_t & letter : buffer)
+            letter = complement(letter);
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetItemsProcessed(state.iterations() * buffer_size);
+}
+
+//!\brief Complements a whole nucleotide buffer with the chunk-wise bulk path.
+template <NucleotideAlphabet alphabet_t>
+static void complement_bulk(benchmark::State & state)
+{
+    std::vector<alphabet_t> buffer = random_buffer<alphabet_t>();
+
+    for (auto _ : state)
+    {
+        complement_inplace(buffer);
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetItemsProcessed(state.iterations() * buffer_size);
+}
+
+BENCHMARK_TEMPLATE(component_access, qualified<dna4, phred42>);
+BENCHMARK_TEMPLATE(component_access, qualified<dna5, phred63>);
+BENCHMARK_TEMPLATE(component_access, masked<dna4>);
+
+BENCHMARK_TEMPLATE(component_assign, qualified<dna4, phred42>, dna4);
+BENCHMARK_TEMPLATE(component_assign, qualified<dna4, phred42>, phred42);
+BENCHMARK_TEMPLATE(component_assign, masked<dna4>, dna4);
+
+BENCHMARK_TEMPLATE(convert_per_element, dna5, dna4);
+BENCHMARK_TEMPLATE(convert_bulk, dna5, dna4);
+BENCHMARK_TEMPLATE(convert_per_element, dna15, dna4);
+BENCHMARK_TEMPLATE(convert_bulk, dna15, dna4);
+BENCHMARK_TEMPLATE(convert_per_element, dna4, rna4);
+BENCHMARK_TEMPLATE(convert_bulk, dna4, rna4);
+
+BENCHMARK_TEMPLATE(to_char_per_element, dna4);
+BENCHMARK_TEMPLATE(to_char_bulk, dna4);
+BENCHMARK_TEMPLATE(to_char_per_element, gapped<dna4>);
+BENCHMARK_TEMPLATE(to_char_bulk, gapped<dna4>);
+BENCHMARK_TEMPLATE(to_char_per_element, union_composition<gap, dna4, dna5, dna15, rna15, rna4, rna5>);
+BENCHMARK_TEMPLATE(to_char_bulk, union_composition<gap, dna4, dna5, dna15, rna15, rna4, rna5>);
+BENCHMARK_TEMPLATE(to_char_per_element, qualified<dna4, phred42>);
+
+BENCHMARK_TEMPLATE(complement_per_element, dna4);
+BENCHMARK_TEMPLATE(complement_bulk, dna4);
+BENCHMARK_TEMPLATE(complement_per_element, dna5);
+BENCHMARK_TEMPLATE(complement_bulk, dna5);
+BENCHMARK_TEMPLATE(complement_per_element, dna15);
+BENCHMARK_TEMPLATE(complement_bulk, dna15);
+
 BENCHMARK_MAIN();
@@ -0,0 +1,194 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Compares two google-benchmark JSON result files and fails on regressions above a threshold.
+ *
+ * Usage: benchmark_compare <baseline.json> <current.json> [--threshold <percent>]
+ *
+ * Both files are expected in the format written by `--benchmark_out=<file> --benchmark_out_format=json`.
+ * Benchmarks are matched by name; the relative change of `real_time` is reported per benchmark and the
+ * tool exits with status 1 if any benchmark slowed down by more than the threshold (default: 5%), so it
+ * can gate dependency updates in CI (see the `benchmark_compare_all` target).
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+//!\brief One benchmark entry extracted from the JSON report.
+struct benchmark_result
+{
+    double real_time{};
+    double cpu_time{};
+    std::string time_unit{};
+};
+
+//!\brief Returns the contents of the file at `path` or exits with an error.
+std::string read_file(std::string const & path)
+{
+    std::ifstream stream{path};
+    if (!stream.is_open())
+    {
+        std::fprintf(stderr, "benchmark_compare: cannot open %s\n", path.c_str());
+        std::exit(2);
+    }
+
+    std::ostringstream buffer;
+    buffer << stream.rdbuf();
+    return buffer.str();
+}
+
+//!\brief Extracts the string value of `"key": "..."` starting at `pos`; returns the empty string if absent.
+std::string extract_string(std::string const & json, std::string const & key, size_t const pos, size_t const end)
+{
+    size_t key_pos = json.find("\"" + key + "\"", pos);
+    if (key_pos == std::string::npos || key_pos >= end)
+        return {};
+
+    size_t const open_quote = json.find('"', json.find(':', key_pos));
+    size_t const close_quote = json.find('"', open_quote + 1);
+    return json.substr(open_quote + 1, close_quote - open_quote - 1);
+}
+
+//!\brief Extracts the numeric value of `"key": <number>` starting at `pos`; returns NaN if absent.
+double extract_number(std::string const & json, std::string const & key, size_t const pos, size_t const end)
+{
+    size_t key_pos = json.find("\"" + key + "\"", pos);
+    if (key_pos == std::string::npos || key_pos >= end)
+        return std::nan("");
+
+    return std::strtod(json.c_str() + json.find(':', key_pos) + 1, nullptr);
+}
+
+/*!\brief Parses the `"benchmarks"` array of a google-benchmark JSON report.
+ *
+ * Only the fields needed for the comparison (name, real_time, cpu_time, time_unit) are extracted;
+ * aggregate entries (mean/median/stddev of repetitions) are skipped so that plain runs and repetition
+ * runs compare on the same per-run timings.
+ */
+std::map<std::string, benchmark_result> parse_report(std::string const & path)
+{
+    std::string const json = read_file(path);
+    std::map<std::string, benchmark_result> results{};
+
+    size_t const array_pos = json.find("\"benchmarks\"");
+    if (array_pos == std::string::npos)
+    {
+        std::fprintf(stderr, "benchmark_compare: %s contains no \"benchmarks\" array\n", path.c_str());
+        std::exit(2);
+    }
+
+    // every entry of the array is one object; objects are not nested inside entries
+    for (size_t entry = json.find('{', array_pos); entry != std::string::npos; entry = json.find('{', entry + 1))
+    {
+        size_t const entry_end = json.find('}', entry);
+        if (entry_end == std::string::npos)
+            break;
+
+        std::string const name = extract_string(json, "name", entry, entry_end);
+        if (name.empty())
+            continue;
+
+        // skip aggregates of repetition runs; the individual repetitions carry the raw timings
+        auto const ends_with = [&name] (std::string const & suffix)
+        {
+            return name.size() >= suffix.size() && name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0;
+        };
+        if (ends_with("_mean") || ends_with("_median") || ends_with("_stddev"))
+            continue;
+
+        benchmark_result result{};
+        result.real_time = extract_number(json, "real_time", entry, entry_end);
+        result.cpu_time = extract_number(json, "cpu_time", entry, entry_end);
+        result.time_unit = extract_string(json, "time_unit", entry, entry_end);
+
+        if (!std::isnan(result.real_time))
+            results[name] = result;
+    }
+
+    return results;
+}
+
+} // namespace
+
+int main(int argc, char ** argv)
+{
+    double threshold = 5.0; // percent
+
+    std::vector<std::string> files{};
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string const arg{argv[i]};
+        if (arg == "--threshold" && i + 1 < argc)
+            threshold = std::strtod(argv[++i], nullptr);
+        else
+            files.push_back(arg);
+    }
+
+    if (files.size() != 2)
+    {
+        std::fprintf(stderr, "Usage: benchmark_compare <baseline.json> <current.json> [--threshold <percent>]\n");
+        return 2;
+    }
+
+    auto const baseline = parse_report(files[0]);
+    auto const current = parse_report(files[1]);
+
+    std::printf("%-60s %15s %15s %9s\n", "benchmark", "baseline", "current", "delta");
+
+    size_t regressions = 0;
+    for (auto const & [name, base] : baseline)
+    {
+        auto const current_it = current.find(name);
+        if (current_it == current.end())
+        {
+            std::printf("%-60s %15.0f %15s %9s\n", name.c_str(), base.real_time, "-", "missing");
+            continue;
+        }
+
+        double const delta = (current_it->second.real_time - base.real_time) / base.real_time * 100.0;
+
+        char const * verdict = "";
+        if (delta > threshold)
+        {
+            verdict = "  REGRESSED";
+            ++regressions;
+        }
+        else if (delta < -threshold)
+        {
+            verdict = "  improved";
+        }
+
+        std::printf("%-60s %15.0f %15.0f %+8.1f%%%s\n",
+                    name.c_str(), base.real_time, current_it->second.real_time, delta, verdict);
+    }
+
+    for (auto const & [name, result] : current)
+    {
+        if (baseline.count(name) == 0)
+            std::printf("%-60s %15s %15.0f %9s\n", name.c_str(), "-", result.real_time, "new");
+    }
+
+    if (regressions != 0)
+    {
+        std::printf("\n%zu benchmark(s) regressed by more than %.1f%%.\n", regressions, threshold);
+        return 1;
+    }
+
+    std::printf("\nNo benchmark regressed by more than %.1f%%.\n", threshold);
+    return 0;
+}
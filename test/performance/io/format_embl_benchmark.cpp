@@ -0,0 +1,85 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <sstream>
+
+#include <benchmark/benchmark.h>
+
+#include <seqan3/alphabet/quality/all.hpp>
+#include <seqan3/io/sequence_file/format_embl.hpp>
+#include <seqan3/io/sequence_file/input_format_concept.hpp>
+#include <seqan3/io/sequence_file/output_format_concept.hpp>
+#include <seqan3/test/performance/units.hpp>
+
+using namespace seqan3;
+using namespace seqan3::test;
+
+static constexpr size_t iterations_per_run = 4096;
+
+static std::string embl_record{"ID seq;\n"
+                               "SQ Sequence 36 BP; 9 A; 9 C; 9 G; 9 T; 0 other;\n"
+                               "  ACTAGACTAG CTACGATCAG CTACGATCAG CTACGA        36\n"
+                               "//\n"};
+
+static std::string embl_file = []()
+{
+    std::string file{};
+    for (size_t idx = 0; idx < iterations_per_run; idx++)
+        file += embl_record;
+    return file;
+}();
+
+void embl_write(benchmark::State & state)
+{
+    std::ostringstream ostream;
+    sequence_file_format_embl format;
+    sequence_file_output_options options;
+    std::string id{"seq"};
+    dna5_vector seq{"ACTAGACTAGCTACGATCAGCTACGATCAGCTACGA"_dna5};
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < iterations_per_run; ++i)
+            format.write(ostream, options, seq, id, std::ignore);
+    }
+
+    size_t bytes_per_run = embl_record.size() * iterations_per_run;
+    state.counters["iterations_per_run"] = iterations_per_run;
+    state.counters["bytes_per_run"] = bytes_per_run;
+    state.counters["bytes_per_second"] = bytes_per_second(bytes_per_run);
+}
+BENCHMARK(embl_write);
+
+void embl_read(benchmark::State & state)
+{
+    std::string id;
+    dna5_vector seq;
+
+    sequence_file_format_embl format;
+    sequence_file_input_options<dna5, false> options;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::istringstream istream{embl_file};
+        state.ResumeTiming();
+
+        for (size_t i = 0; i < iterations_per_run; ++i)
+        {
+            format.read(istream, options, seq, id, std::ignore);
+            id.clear();
+            seq.clear();
+        }
+    }
+
+    size_t bytes_per_run = embl_record.size() * iterations_per_run;
+    state.counters["iterations_per_run"] = iterations_per_run;
+    state.counters["bytes_per_run"] = bytes_per_run;
+    state.counters["bytes_per_second"] = bytes_per_second(bytes_per_run);
+}
+BENCHMARK(embl_read);
+
+BENCHMARK_MAIN();
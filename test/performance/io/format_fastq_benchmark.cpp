@@ -0,0 +1,170 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <iterator>
+#include <sstream>
+
+#include <benchmark/benchmark.h>
+
+#ifdef SEQAN3_HAS_ZLIB
+    #include <seqan3/contrib/stream/gz_istream.hpp>
+    #include <seqan3/contrib/stream/gz_ostream.hpp>
+#endif
+
+#include <seqan3/alphabet/quality/all.hpp>
+#include <seqan3/io/sequence_file/format_fastq.hpp>
+#include <seqan3/io/sequence_file/input_format_concept.hpp>
+#include <seqan3/io/sequence_file/output_format_concept.hpp>
+#include <seqan3/test/performance/units.hpp>
+
+using namespace seqan3;
+using namespace seqan3::test;
+
+static constexpr size_t iterations_per_run = 4096;
+
+static std::string fastq_record{"@seq\n"
+                                "ACTAGACTAGCTACGATCAGCTACGATCAGCTACGA\n"
+                                "+\n"
+                                "IIIIIHIIIIIIIIIIIIIIIIIIIIIIIIIIIIII\n"};
+
+static std::string fastq_file = []()
+{
+    std::string file{};
+    for (size_t idx = 0; idx < iterations_per_run; idx++)
+        file += fastq_record;
+    return file;
+}();
+
+void fastq_write(benchmark::State & state)
+{
+    std::ostringstream ostream;
+    sequence_file_format_fastq format;
+    sequence_file_output_options options;
+    std::string id{"seq"};
+    dna5_vector seq{"ACTAGACTAGCTACGATCAGCTACGATCAGCTACGA"_dna5};
+    std::vector<phred42> qual{"IIIIIHIIIIIIIIIIIIIIIIIIIIIIIIIIIIII"_phred42};
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < iterations_per_run; ++i)
+            format.write(ostream, options, seq, id, qual);
+    }
+
+    size_t bytes_per_run = fastq_record.size() * iterations_per_run;
+    state.counters["iterations_per_run"] = iterations_per_run;
+    state.counters["bytes_per_run"] = bytes_per_run;
+    state.counters["bytes_per_second"] = bytes_per_second(bytes_per_run);
+}
+BENCHMARK(fastq_write);
+
+void fastq_read(benchmark::State & state)
+{
+    std::string id;
+    dna5_vector seq;
+    std::vector<phred42> qual;
+
+    sequence_file_format_fastq format;
+    sequence_file_input_options<dna5, false> options;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::istringstream istream{fastq_file};
+        state.ResumeTiming();
+
+        for (size_t i = 0; i < iterations_per_run; ++i)
+        {
+            format.read(istream, options, seq, id, qual);
+            id.clear();
+            seq.clear();
+            qual.clear();
+        }
+    }
+
+    size_t bytes_per_run = fastq_record.size() * iterations_per_run;
+    state.counters["iterations_per_run"] = iterations_per_run;
+    state.counters["bytes_per_run"] = bytes_per_run;
+    state.counters["bytes_per_second"] = bytes_per_second(bytes_per_run);
+}
+BENCHMARK(fastq_read);
+
+//!\brief Like fastq_read, but the quality field is skipped instead of parsed.
+void fastq_read_ignore_quality(benchmark::State & state)
+{
+    std::string id;
+    dna5_vector seq;
+
+    sequence_file_format_fastq format;
+    sequence_file_input_options<dna5, false> options;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::istringstream istream{fastq_file};
+        state.ResumeTiming();
+
+        for (size_t i = 0; i < iterations_per_run; ++i)
+        {
+            format.read(istream, options, seq, id, std::ignore);
+            id.clear();
+            seq.clear();
+        }
+    }
+
+    size_t bytes_per_run = fastq_record.size() * iterations_per_run;
+    state.counters["iterations_per_run"] = iterations_per_run;
+    state.counters["bytes_per_run"] = bytes_per_run;
+    state.counters["bytes_per_second"] = bytes_per_second(bytes_per_run);
+}
+BENCHMARK(fastq_read_ignore_quality);
+
+#ifdef SEQAN3_HAS_ZLIB
+
+static std::string fastq_file_gz = []()
+{
+    std::ostringstream ret;
+    {
+        contrib::gz_ostream os{ret};
+        std::copy(fastq_file.begin(), fastq_file.end(), std::ostreambuf_iterator<char>(os));
+    }
+    return ret.str();
+}();
+
+//!\brief Like fastq_read, but through the gzip decompression stream (the hot path of .fastq.gz files).
+void fastq_read_gz(benchmark::State & state)
+{
+    std::string id;
+    dna5_vector seq;
+    std::vector<phred42> qual;
+
+    sequence_file_format_fastq format;
+    sequence_file_input_options<dna5, false> options;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::istringstream istream{fastq_file_gz};
+        contrib::gz_istream decompressed{istream};
+        state.ResumeTiming();
+
+        for (size_t i = 0; i < iterations_per_run; ++i)
+        {
+            format.read(decompressed, options, seq, id, qual);
+            id.clear();
+            seq.clear();
+            qual.clear();
+        }
+    }
+
+    size_t bytes_per_run = fastq_record.size() * iterations_per_run;
+    state.counters["iterations_per_run"] = iterations_per_run;
+    state.counters["bytes_per_run"] = bytes_per_run;
+    state.counters["bytes_per_second"] = bytes_per_second(bytes_per_run);
+}
+BENCHMARK(fastq_read_gz);
+
+#endif // SEQAN3_HAS_ZLIB
+
+BENCHMARK_MAIN();
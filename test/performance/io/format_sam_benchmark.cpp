@@ -0,0 +1,143 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <sstream>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <seqan3/alphabet/quality/all.hpp>
+#include <seqan3/io/alignment_file/format_sam.hpp>
+#include <seqan3/io/alignment_file/input_format_concept.hpp>
+#include <seqan3/io/alignment_file/output_format_concept.hpp>
+#include <seqan3/test/performance/units.hpp>
+
+using namespace seqan3;
+using namespace seqan3::test;
+
+static constexpr size_t iterations_per_run = 1024;
+
+//!\brief The tags appended to a record one by one to benchmark tag dictionary parsing.
+static std::vector<std::string> const available_tags
+{
+    "NM:i:3",
+    "AS:i:27",
+    "MD:Z:10A5T2",
+    "RG:Z:group1",
+    "xa:i:5",
+    "xb:f:3.71",
+    "xc:Z:comment with blanks",
+    "xd:B:f,3.5,0.1,43.8",
+};
+
+//!\brief Returns one unmapped SAM record with the requested number of optional tags.
+static std::string sam_record(size_t const n_tags)
+{
+    std::string record{"read1\t4\t*\t0\t0\t*\t*\t0\t0\t"
+                       "ACTAGACTAGCTACGATCAGCTACGATCAGCTACGA\t"
+                       "IIIIIHIIIIIIIIIIIIIIIIIIIIIIIIIIIIII"};
+
+    for (size_t i = 0; i < n_tags; ++i)
+    {
+        record += '\t';
+        record += available_tags[i % available_tags.size()];
+    }
+
+    record += '\n';
+    return record;
+}
+
+static std::string sam_file(size_t const n_tags)
+{
+    std::string file{};
+    for (size_t idx = 0; idx < iterations_per_run; idx++)
+        file += sam_record(n_tags);
+    return file;
+}
+
+//!\brief Parses records with state.range(0) many optional tags each.
+void sam_read(benchmark::State & state)
+{
+    size_t const n_tags = static_cast<size_t>(state.range(0));
+    std::string const file = sam_file(n_tags);
+
+    alignment_file_format_sam format;
+    alignment_file_input_options<dna5> options;
+    alignment_file_header header{};
+
+    dna5_vector seq;
+    std::string id;
+    std::vector<phred42> qual;
+    int32_t offset;
+    uint16_t flag;
+    uint8_t mapq;
+    std::tuple<std::optional<int32_t>, std::optional<int32_t>, int32_t> mate;
+    sam_tag_dictionary tag_dict;
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::istringstream istream{file};
+        state.ResumeTiming();
+
+        for (size_t i = 0; i < iterations_per_run; ++i)
+        {
+            format.read(istream, options, std::ignore, header, seq, qual, id, offset, std::ignore,
+                        std::ignore, std::ignore, std::ignore, flag, mapq, mate, tag_dict, std::ignore,
+                        std::ignore);
+            seq.clear();
+            id.clear();
+            qual.clear();
+            tag_dict.clear();
+        }
+    }
+
+    size_t bytes_per_run = sam_record(n_tags).size() * iterations_per_run;
+    state.counters["iterations_per_run"] = iterations_per_run;
+    state.counters["bytes_per_run"] = bytes_per_run;
+    state.counters["bytes_per_second"] = bytes_per_second(bytes_per_run);
+}
+BENCHMARK(sam_read)->Arg(0)->Arg(2)->Arg(8);
+
+//!\brief Writes records with state.range(0) many optional tags each.
+void sam_write(benchmark::State & state)
+{
+    size_t const n_tags = static_cast<size_t>(state.range(0));
+
+    alignment_file_format_sam format;
+    alignment_file_output_options options;
+    alignment_file_header header{};
+
+    dna5_vector seq{"ACTAGACTAGCTACGATCAGCTACGATCAGCTACGA"_dna5};
+    std::string id{"read1"};
+    std::vector<phred42> qual{"IIIIIHIIIIIIIIIIIIIIIIIIIIIIIIIIIIII"_phred42};
+    std::tuple<std::optional<int32_t>, std::optional<int32_t>, int32_t> mate;
+
+    sam_tag_dictionary tag_dict;
+    if (n_tags > 0)
+    {
+        tag_dict["NM"_tag] = 3;
+        if (n_tags > 1)
+            tag_dict["AS"_tag] = 27;
+    }
+    for (size_t i = 2; i < n_tags; ++i) // xa, xb, … hold one int each
+        tag_dict[static_cast<uint16_t>("xa"_tag + i - 2)] = static_cast<int32_t>(i);
+
+    std::ostringstream ostream;
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < iterations_per_run; ++i)
+            format.write(ostream, options, header, seq, qual, id, 0, std::ignore, std::ignore, std::nullopt,
+                         std::ignore, 4, 0, mate, tag_dict, 0, 0);
+    }
+
+    state.counters["iterations_per_run"] = iterations_per_run;
+}
+BENCHMARK(sam_write)->Arg(0)->Arg(2)->Arg(8);
+
+BENCHMARK_MAIN();
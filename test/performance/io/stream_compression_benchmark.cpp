@@ -0,0 +1,129 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+// Block-wise (sgetn/sputn) throughput of the contrib (de-)compression streams; complements the
+// character-wise numbers in stream_input_benchmark.cpp / stream_output_benchmark.cpp.
+
+#include <algorithm>
+#include <iterator>
+#include <sstream>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#ifdef SEQAN3_HAS_ZLIB
+    #include <seqan3/contrib/stream/bgzf_istream.hpp>
+    #include <seqan3/contrib/stream/bgzf_ostream.hpp>
+    #include <seqan3/contrib/stream/gz_istream.hpp>
+    #include <seqan3/contrib/stream/gz_ostream.hpp>
+#endif
+
+// only benchmark BZIP2 if explicitly requested, because slow setup
+#if !defined(SEQAN3_BENCH_BZIP2) && defined(SEQAN3_HAS_BZIP2)
+    #undef SEQAN3_HAS_BZIP2
+#endif
+
+#ifdef SEQAN3_HAS_BZIP2
+    #include <seqan3/contrib/stream/bz2_istream.hpp>
+    #include <seqan3/contrib/stream/bz2_ostream.hpp>
+#endif
+
+#include <seqan3/test/performance/units.hpp>
+
+using namespace seqan3;
+using namespace seqan3::test;
+
+static constexpr size_t block_size = 1u << 16;
+
+std::string input
+{
+    [] ()
+    {
+        std::string line{"The quick brown fox jumps over the lazy dog"};
+        std::string ret;
+        for (size_t i = 0; i < 1'000'000; ++i)
+            ret += line;
+        return ret;
+    } ()
+};
+
+template <typename ostream_t>
+std::string compress(std::string const & data)
+{
+    std::ostringstream ret;
+    {
+        ostream_t os{ret};
+        std::copy(data.begin(), data.end(), std::ostreambuf_iterator<char>(os));
+    }
+    return ret.str();
+}
+
+// ============================================================================
+//  block-wise decompression
+// ============================================================================
+
+template <typename istream_t, typename ostream_t>
+void decompress_blockwise(benchmark::State & state)
+{
+    std::string const compressed = compress<ostream_t>(input);
+    std::vector<char> block(block_size);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::istringstream s{compressed};
+        istream_t comp{s};
+        state.ResumeTiming();
+
+        size_t total = 0;
+        while (std::streamsize n = comp.rdbuf()->sgetn(block.data(), block.size()))
+            total += n;
+
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.counters["bytes_per_run"] = input.size();
+    state.counters["bytes_per_second"] = bytes_per_second(input.size());
+}
+
+#ifdef SEQAN3_HAS_ZLIB
+BENCHMARK_TEMPLATE(decompress_blockwise, contrib::gz_istream, contrib::gz_ostream);
+BENCHMARK_TEMPLATE(decompress_blockwise, contrib::bgzf_istream, contrib::bgzf_ostream);
+#endif
+#ifdef SEQAN3_HAS_BZIP2
+BENCHMARK_TEMPLATE(decompress_blockwise, contrib::bz2_istream, contrib::bz2_ostream);
+#endif
+
+// ============================================================================
+//  block-wise compression
+// ============================================================================
+
+template <typename ostream_t>
+void compress_blockwise(benchmark::State & state)
+{
+    for (auto _ : state)
+    {
+        std::ostringstream ret;
+        ostream_t os{ret};
+
+        for (size_t offset = 0; offset < input.size(); offset += block_size)
+            os.rdbuf()->sputn(input.data() + offset, std::min(block_size, input.size() - offset));
+    }
+
+    state.counters["bytes_per_run"] = input.size();
+    state.counters["bytes_per_second"] = bytes_per_second(input.size());
+}
+
+#ifdef SEQAN3_HAS_ZLIB
+BENCHMARK_TEMPLATE(compress_blockwise, contrib::gz_ostream);
+BENCHMARK_TEMPLATE(compress_blockwise, contrib::bgzf_ostream);
+#endif
+#ifdef SEQAN3_HAS_BZIP2
+BENCHMARK_TEMPLATE(compress_blockwise, contrib::bz2_ostream);
+#endif
+
+BENCHMARK_MAIN();
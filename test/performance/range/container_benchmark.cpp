@@ -13,6 +13,8 @@
 
 #include <seqan3/alphabet/all.hpp>
 #include <seqan3/range/container/all.hpp>
+#include <seqan3/test/performance/memory_usage.hpp>
+#include <seqan3/test/performance/perf_counters.hpp>
 
 using namespace seqan3;
 
@@ -31,10 +33,15 @@ static void push_back(benchmark::State& state)
     if constexpr(reserve)
         c.reserve(1 << 30);
 
+    test::perf_counters counters{};
+
+    counters.start();
     for (auto _ : state)
     {
         c.push_back(alphabet_t{});
     }
+    counters.stop();
+    counters.report(state);
 
     state.counters["sizeof"] = sizeof(alphabet_t);
     if constexpr (Alphabet<alphabet_t>)
@@ -253,6 +260,36 @@ BENCHMARK_TEMPLATE(sequential_write, seqan3::bitcompressed_vector, aa27);
 BENCHMARK_TEMPLATE(sequential_write, seqan3::bitcompressed_vector, char);
 BENCHMARK_TEMPLATE(sequential_write, seqan3::bitcompressed_vector, union_composition<char, dna4>);
 
+// ============================================================================
+//  bulk load
+// ============================================================================
+
+template <template <typename> typename container_t, typename alphabet_t>
+static void bulk_load(benchmark::State& state)
+{
+    std::vector<alphabet_t> const source(state.range(0), alphabet_t{});
+
+    test::memory_usage mem{}; // samples the baseline after the source, before the first load
+
+    for (auto _ : state)
+    {
+        container_t<alphabet_t> c;
+        c.assign(source.begin(), source.end());
+        benchmark::DoNotOptimize(c);
+    }
+
+    mem.report(state);
+    state.counters["sizeof"] = sizeof(alphabet_t);
+}
+
+BENCHMARK_TEMPLATE(bulk_load, std::vector, dna4)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(bulk_load, std::vector, aa27)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(bulk_load, std::vector, char)->Range(1 << 12, 1 << 24);
+
+BENCHMARK_TEMPLATE(bulk_load, seqan3::bitcompressed_vector, dna4)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(bulk_load, seqan3::bitcompressed_vector, aa27)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(bulk_load, seqan3::bitcompressed_vector, char)->Range(1 << 12, 1 << 24);
+
 // ============================================================================
 //  run
 // ============================================================================
@@ -0,0 +1,202 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/search/fm_index/all.hpp>
+#include <seqan3/std/filesystem>
+#include <seqan3/test/performance/memory_usage.hpp>
+#include <seqan3/test/tmp_filename.hpp>
+
+using namespace seqan3;
+
+//!\brief Generates a pseudo random dna4 text of the given length.
+static std::vector<dna4> generate_text(size_t const length, size_t const seed = 0)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<uint8_t> dis(0, 3);
+
+    std::vector<dna4> text(length);
+    for (dna4 & c : text)
+        c.assign_rank(dis(gen));
+    return text;
+}
+
+//!\brief Returns the serialized size of an index in bytes (the sum of both files for bidirectional indices).
+template <typename index_t>
+static size_t serialized_size(index_t const & index)
+{
+    test::tmp_filename filename{"index"};
+    index.store(filename.get_path());
+
+    if constexpr (BiFmIndex<index_t>)
+    {
+        std::filesystem::path fwd_path{filename.get_path()}, rev_path{filename.get_path()};
+        fwd_path += ".fwd";
+        rev_path += ".rev";
+        return std::filesystem::file_size(fwd_path) + std::filesystem::file_size(rev_path);
+    }
+    else
+    {
+        return std::filesystem::file_size(filename.get_path());
+    }
+}
+
+// ============================================================================
+//  construction time and serialized size
+// ============================================================================
+
+template <typename index_t>
+void construction(benchmark::State & state)
+{
+    std::vector<dna4> const text = generate_text(state.range(0));
+
+    for (auto _ : state)
+    {
+        index_t index{text};
+        benchmark::DoNotOptimize(index);
+    }
+
+    index_t const index{text};
+    state.counters["index_size_in_bytes"] = serialized_size(index);
+    state.SetBytesProcessed(state.iterations() * text.size());
+}
+
+BENCHMARK_TEMPLATE(construction, fm_index<std::vector<dna4>>)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(construction, bi_fm_index<std::vector<dna4>>)->RangeMultiplier(10)->Range(1000, 1000000);
+
+// ============================================================================
+//  construction peak memory
+// ============================================================================
+
+template <typename index_t>
+void construction_memory(benchmark::State & state)
+{
+    std::vector<dna4> const text = generate_text(state.range(0));
+
+    test::memory_usage mem{}; // samples the baseline before the first construction
+
+    for (auto _ : state)
+    {
+        index_t index{text};
+        benchmark::DoNotOptimize(index);
+    }
+
+    mem.report(state);
+    state.SetBytesProcessed(state.iterations() * text.size());
+}
+
+// ascending text sizes, so every size reports its own peak-RSS growth (see seqan3::test::memory_usage)
+BENCHMARK_TEMPLATE(construction_memory, fm_index<std::vector<dna4>>)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(construction_memory, bi_fm_index<std::vector<dna4>>)->RangeMultiplier(10)->Range(1000, 1000000);
+
+// ============================================================================
+//  cursor micro operations
+// ============================================================================
+
+template <typename index_t>
+void cursor_extend_right(benchmark::State & state)
+{
+    std::vector<dna4> const text = generate_text(1000000);
+    index_t const index{text};
+    std::vector<dna4> const walk = generate_text(10000, 1);
+
+    for (auto _ : state)
+    {
+        auto cur = index.begin();
+        for (dna4 const c : walk)
+            if (!cur.extend_right(c)) // restart from the root once the random walk leaves the text
+                cur = index.begin();
+        benchmark::DoNotOptimize(cur);
+    }
+
+    state.SetItemsProcessed(state.iterations() * walk.size());
+}
+
+BENCHMARK_TEMPLATE(cursor_extend_right, fm_index<std::vector<dna4>>);
+BENCHMARK_TEMPLATE(cursor_extend_right, bi_fm_index<std::vector<dna4>>);
+
+template <typename index_t>
+void cursor_cycle_back(benchmark::State & state)
+{
+    std::vector<dna4> const text = generate_text(1000000);
+    index_t const index{text};
+    std::vector<dna4> const walk = generate_text(10000, 2);
+
+    size_t operations = 0;
+    for (auto _ : state)
+    {
+        operations = 0;
+        auto cur = index.begin();
+        for (dna4 const c : walk)
+        {
+            auto sibling = cur; // cycle through all siblings of the visited node
+            if (sibling.extend_right(c))
+                while (sibling.cycle_back())
+                    ++operations;
+            if (!cur.extend_right(c))
+                cur = index.begin();
+        }
+        benchmark::DoNotOptimize(cur);
+    }
+
+    state.SetItemsProcessed(state.iterations() * operations);
+}
+
+BENCHMARK_TEMPLATE(cursor_cycle_back, fm_index<std::vector<dna4>>);
+BENCHMARK_TEMPLATE(cursor_cycle_back, bi_fm_index<std::vector<dna4>>);
+
+// ============================================================================
+//  locate cost versus occurrence count
+// ============================================================================
+
+//!\brief Locates all sampled substrings of the length given as benchmark argument; shorter substrings
+//!       occur more often, i.e. the argument controls the occurrence count per locate() call.
+template <typename index_t>
+void cursor_locate(benchmark::State & state)
+{
+    std::vector<dna4> const text = generate_text(1000000);
+    index_t const index{text};
+
+    std::mt19937 gen(3);
+    size_t const query_length = state.range(0);
+    std::uniform_int_distribution<size_t> dis(0, text.size() - query_length);
+
+    std::vector<typename index_t::cursor_type> cursors{};
+    for (size_t i = 0; i < 100u; ++i)
+    {
+        size_t const pos = dis(gen);
+        std::vector<dna4> const query(text.begin() + pos, text.begin() + pos + query_length);
+        auto cur = index.begin();
+        if (cur.extend_right(query))
+            cursors.push_back(cur);
+    }
+
+    size_t occurrences = 0;
+    for (auto _ : state)
+    {
+        occurrences = 0;
+        for (auto const & cur : cursors)
+        {
+            auto const positions = cur.locate();
+            occurrences += positions.size();
+            benchmark::DoNotOptimize(positions);
+        }
+    }
+
+    state.counters["occurrences_per_locate"] = occurrences / std::max<size_t>(cursors.size(), 1u);
+    state.SetItemsProcessed(state.iterations() * occurrences);
+}
+
+BENCHMARK_TEMPLATE(cursor_locate, fm_index<std::vector<dna4>>)->RangeMultiplier(2)->Range(4, 32);
+BENCHMARK_TEMPLATE(cursor_locate, bi_fm_index<std::vector<dna4>>)->RangeMultiplier(2)->Range(4, 32);
+
+BENCHMARK_MAIN();
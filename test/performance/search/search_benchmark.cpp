@@ -0,0 +1,130 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/search/algorithm/all.hpp>
+#include <seqan3/search/fm_index/all.hpp>
+
+using namespace seqan3;
+using namespace seqan3::search_cfg;
+
+//!\brief Generates a pseudo random dna4 text of the given length.
+static std::vector<dna4> generate_text(size_t const length, size_t const seed = 0)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<uint8_t> dis(0, 3);
+
+    std::vector<dna4> text(length);
+    for (dna4 & c : text)
+        c.assign_rank(dis(gen));
+    return text;
+}
+
+/*!\brief Samples queries from the text and mutates each with the given number of substitutions, such that
+ *        approximate searches have to use their error budget.
+ */
+static std::vector<std::vector<dna4>> sample_queries(std::vector<dna4> const & text, size_t const query_count,
+                                                     size_t const query_length, uint8_t const substitutions)
+{
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<size_t> dis_pos(0, text.size() - query_length);
+    std::uniform_int_distribution<size_t> dis_query_pos(0, query_length - 1);
+    std::uniform_int_distribution<uint8_t> dis_rank(0, 3);
+
+    std::vector<std::vector<dna4>> queries(query_count);
+    for (std::vector<dna4> & query : queries)
+    {
+        size_t const pos = dis_pos(gen);
+        query.assign(text.begin() + pos, text.begin() + pos + query_length);
+        for (uint8_t i = 0; i < substitutions; ++i)
+            query[dis_query_pos(gen)].assign_rank(dis_rank(gen));
+    }
+    return queries;
+}
+
+// ============================================================================
+//  exact search throughput
+// ============================================================================
+
+template <typename index_t>
+void exact_search(benchmark::State & state)
+{
+    std::vector<dna4> const text = generate_text(1000000);
+    index_t const index{text};
+    std::vector<std::vector<dna4>> const queries = sample_queries(text, 1000, 50, 0);
+
+    for (auto _ : state)
+    {
+        auto const hits = search(index, queries);
+        benchmark::DoNotOptimize(hits);
+    }
+
+    state.SetItemsProcessed(state.iterations() * queries.size());
+}
+
+BENCHMARK_TEMPLATE(exact_search, fm_index<std::vector<dna4>>);
+BENCHMARK_TEMPLATE(exact_search, bi_fm_index<std::vector<dna4>>);
+
+// ============================================================================
+//  scheme-based approximate search at 1-3 errors
+// ============================================================================
+
+//!\brief Searches mutated queries with the number of errors given as benchmark argument; on the
+//!       bidirectional index this exercises the precomputed search schemes.
+template <typename index_t>
+void approximate_search(benchmark::State & state)
+{
+    std::vector<dna4> const text = generate_text(1000000);
+    index_t const index{text};
+    uint8_t const errors = state.range(0);
+    std::vector<std::vector<dna4>> const queries = sample_queries(text, 100, 50, errors);
+
+    configuration const cfg = max_error{total{errors}, substitution{errors}};
+
+    for (auto _ : state)
+    {
+        auto const hits = search(index, queries, cfg);
+        benchmark::DoNotOptimize(hits);
+    }
+
+    state.SetItemsProcessed(state.iterations() * queries.size());
+}
+
+BENCHMARK_TEMPLATE(approximate_search, fm_index<std::vector<dna4>>)->DenseRange(1, 3);
+BENCHMARK_TEMPLATE(approximate_search, bi_fm_index<std::vector<dna4>>)->DenseRange(1, 3);
+
+// ============================================================================
+//  scheme-based approximate search with indels
+// ============================================================================
+
+template <typename index_t>
+void approximate_search_levenshtein(benchmark::State & state)
+{
+    std::vector<dna4> const text = generate_text(1000000);
+    index_t const index{text};
+    uint8_t const errors = state.range(0);
+    std::vector<std::vector<dna4>> const queries = sample_queries(text, 100, 50, errors);
+
+    configuration const cfg = max_error{total{errors}};
+
+    for (auto _ : state)
+    {
+        auto const hits = search(index, queries, cfg);
+        benchmark::DoNotOptimize(hits);
+    }
+
+    state.SetItemsProcessed(state.iterations() * queries.size());
+}
+
+BENCHMARK_TEMPLATE(approximate_search_levenshtein, bi_fm_index<std::vector<dna4>>)->DenseRange(1, 3);
+
+BENCHMARK_MAIN();
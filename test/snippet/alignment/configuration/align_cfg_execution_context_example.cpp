@@ -0,0 +1,19 @@
+#include <seqan3/alignment/configuration/align_config_execution_context.hpp>
+#include <seqan3/core/parallel/thread_pool.hpp>
+
+int main()
+{
+//! [example]
+    using namespace seqan3;
+
+    // Run the alignments on the process-wide shared thread pool.
+    align_cfg::execution_context shared_cfg{};
+
+    // Run the alignments on an explicitly constructed pool with four workers.
+    thread_pool pool{4};
+    align_cfg::execution_context injected_cfg{&pool};
+//! [example]
+
+    (void) shared_cfg;
+    (void) injected_cfg;
+}
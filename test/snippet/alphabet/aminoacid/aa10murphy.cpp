@@ -0,0 +1,48 @@
+#include <seqan3/alphabet/aminoacid/aa10murphy.hpp>
+#include <seqan3/io/stream/debug_stream.hpp>
+
+using namespace seqan3;
+
+int main()
+{
+
+{
+//! [construction]
+aa10murphy my_letter{'A'_aa10murphy};
+// doesn't work:
+// aa10murphy my_letter{'A'};
+
+my_letter.assign_char('C'); // <- this does!
+
+my_letter.assign_char('L'); // letters are folded into their class, here 'I'_aa10murphy
+
+if (my_letter.to_char() == 'I')
+    debug_stream << "yeah\n"; // "yeah";
+//! [construction]
+}
+
+{
+//! [char_literal]
+// doesn't work:
+// aa10murphy acid{'A'};
+
+// this does:
+aa10murphy acid1{'A'_aa10murphy};
+auto acid2 = 'F'_aa10murphy; // type = aa10murphy
+//! [char_literal]
+}
+
+{
+//! [literal]
+// these don't work:
+// aa10murphy_vector foo{"ABFUYR"};
+// aa10murphy_vector bar = "ABFUYR";
+
+// but these do:
+aa10murphy_vector foo{"ABFUYR"_aa10murphy};
+aa10murphy_vector bar = "ABFUYR"_aa10murphy;
+auto bax = "ABFUYR"_aa10murphy;
+//! [literal]
+}
+
+}
@@ -73,7 +73,7 @@ alignment_file_input fin{"/tmp/my.sam"};
 
 // access the header information
 debug_stream << fin.header().format_version << std::endl; // 1.6
-debug_stream << fin.header().ref_dict << std::endl;       // [(ref,(45,))] (this only works with our debug_stream!)
+debug_stream << fin.header().ref_dict() << std::endl;       // [(ref,(45,))] (this only works with our debug_stream!)
 //![get_header]
 }
 
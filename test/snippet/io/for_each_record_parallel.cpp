@@ -0,0 +1,38 @@
+#include <filesystem>
+
+#include <seqan3/io/for_each_record_parallel.hpp>
+#include <seqan3/io/sequence_file/input.hpp>
+#include <seqan3/io/sequence_file/output.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/alphabet/quality/phred42.hpp>
+
+using namespace seqan3;
+
+int main()
+{
+
+auto tmp_dir = std::filesystem::temp_directory_path();
+
+// Create a /tmp/my.fastq for the snippet below
+{
+    sequence_file_output fout{tmp_dir/"my.fastq"};
+    fout.emplace_back("ACGT"_dna5, "read1", "!!!!"_phred42);
+    fout.emplace_back("AGGCTGA"_dna5, "read2", "&&&&&&&"_phred42);
+    fout.emplace_back("ACTGA"_dna5, "read3", "#####"_phred42);
+}
+
+//! [usage]
+sequence_file_input fin{tmp_dir/"my.fastq"};
+
+// run the per-record function on four threads; the returned GC counts are in file order
+std::vector<size_t> gc_counts = for_each_record_parallel(fin, [] (auto & record)
+{
+    size_t gc = 0;
+    for (auto const nucl : get<field::SEQ>(record))
+        gc += (nucl == 'C'_dna5) || (nucl == 'G'_dna5);
+    return gc;
+}, 4u);
+//! [usage]
+(void) gc_counts;
+
+}
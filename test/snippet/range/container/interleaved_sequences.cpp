@@ -0,0 +1,18 @@
+#include <seqan3/range/container/interleaved_sequences.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+
+using namespace seqan3;
+
+int main()
+{
+//! [usage]
+std::vector<std::vector<dna4>> reads{"ACGT"_dna4, "AC"_dna4, "ACGTA"_dna4};
+
+interleaved_sequences<dna4, 8> batch{reads};   // transpose once into the lane-major layout
+
+auto block = batch.position(1);                // the ranks of position 1 of all 8 lanes,
+                                               // contiguous and SIMD-aligned
+// block[0..2] hold 'C'; the unoccupied lanes hold batch.padding_rank
+//! [usage]
+(void) block;
+}
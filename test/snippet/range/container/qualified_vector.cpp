@@ -0,0 +1,21 @@
+#include <seqan3/range/container/qualified_vector.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/alphabet/quality/phred42.hpp>
+
+using namespace seqan3;
+
+int main()
+{
+//! [usage]
+qualified_vector<dna5, phred42> v{};
+v.push_back({'A'_dna5, phred42{7}});
+v.push_back('C'_dna5, phred42{40});       // letters need not be combined first
+
+auto record = v[0];                       // a proxy modelling seqan3::qualified
+record.assign_phred(38);                  // writes through to the quality array
+
+auto bases = v.sequence();                // contiguous view of the bases only
+// e.g. pass `bases` to an alignment — no quality letters in between
+//! [usage]
+(void) bases;
+}
@@ -0,0 +1,20 @@
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/io/stream/debug_stream.hpp>
+#include <seqan3/range/view/convert_copy.hpp>
+
+using namespace seqan3;
+
+int main()
+{
+    std::string read{"ACGTACGTACGTNNNN"};
+
+    std::vector<dna5> sequence(read.size());
+    convert_copy(read, sequence);          // same elements as read | view::char_to<dna5>
+
+    std::string back(sequence.size(), '\0');
+    convert_copy(sequence, back);          // same elements as sequence | view::to_char
+    debug_stream << back << '\n';          // prints "ACGTACGTACGTNNNN"
+}
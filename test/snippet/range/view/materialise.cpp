@@ -0,0 +1,29 @@
+#include <sstream>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/view/char_to.hpp>
+#include <seqan3/range/view/materialise.hpp>
+#include <seqan3/range/view/single_pass_input.hpp>
+
+using namespace seqan3;
+
+int main()
+{
+//! [usage]
+std::istringstream stream{"ACGTACGT"};
+
+// single-pass views can only be traversed once ...
+auto sp = view::single_pass_input(stream) | view::char_to<dna4>;
+
+// ... but after materialising, the data can be sized, indexed and traversed repeatedly:
+auto v = sp | view::materialise;
+auto n = v.size();   // 8
+auto l = v[3];       // 'T'_dna4
+
+// the buffer behind v is recycled once v goes out of scope, so materialising
+// one record per loop iteration does not allocate fresh storage every time
+//! [usage]
+
+(void)n;
+(void)l;
+}
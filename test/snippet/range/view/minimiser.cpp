@@ -0,0 +1,17 @@
+//! [usage]
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/io/stream/debug_stream.hpp>
+#include <seqan3/range/view/kmer_hash.hpp>
+#include <seqan3/range/view/minimiser.hpp>
+
+using namespace seqan3;
+
+int main()
+{
+    std::vector<dna4> text{"ACGTAGC"_dna4};
+
+    // the hashes of the 3-mers are [6,27,44,50,9]
+    for (auto const & [position, hash] : text | view::kmer_hash(3) | view::minimiser(3))
+        debug_stream << position << " -> " << hash << '\n'; // 0 -> 6, 1 -> 27, 4 -> 9
+}
+//! [usage]
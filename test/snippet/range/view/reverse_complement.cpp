@@ -0,0 +1,24 @@
+#include <seqan3/range/view/reverse_complement.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/std/ranges>
+
+using namespace seqan3;
+
+int main()
+{
+//! [usage]
+dna5_vector foo{"ACGTA"_dna5};
+
+// pipe notation
+auto v = foo | view::reverse_complement;                          // == "TACGT"
+
+// function notation
+dna5_vector v2(view::reverse_complement(foo));                    // == "TACGT"
+
+// eager variant with a chunked kernel for contiguous ranges
+dna5_vector v3(foo.size());
+reverse_complement_copy(foo, v3);                                 // == "TACGT"
+//! [usage]
+(void) v;
+(void) v2;
+}
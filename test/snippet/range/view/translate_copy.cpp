@@ -0,0 +1,20 @@
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/view/translate_copy.hpp>
+
+using namespace seqan3;
+
+int main()
+{
+    dna4_vector vec = "ACGTACGTACGTA"_dna4;
+
+    // translate all six frames in one pass over vec
+    std::vector<aa27_vector> frames = translate_copy(vec);
+    // frames == [[T,Y,V,R], [R,T,Y,V], [V,R,T], [Y,V,R,T], [T,Y,V,R], [R,T,Y]]
+
+    // or only the frames you need
+    std::vector<aa27_vector> fwd = translate_copy(vec, translation_frames::FWD);
+    // fwd == [[T,Y,V,R], [R,T,Y,V], [V,R,T]]
+
+    (void)frames;
+    (void)fwd;
+}
@@ -41,6 +41,23 @@ using test_types = ::testing::Types<std::vector<gapped<dna4>>,
 
 INSTANTIATE_TYPED_TEST_CASE_P(container_of_gapped_alphabets, aligned_sequence, test_types);
 
+TEST(aligned_sequence_insert_gaps, container_of_gapped_alphabets)
+{
+    std::vector<gapped<dna4>> seq{'A'_dna4, 'C'_dna4, 'T'_dna4, 'G'_dna4};
+
+    // positions refer to the final aligned sequence: -AC--TG-
+    std::vector<std::pair<size_t, size_t>> const gap_runs{{0, 1}, {3, 2}, {7, 1}};
+    insert_gaps(seq, gap_runs);
+
+    std::vector<gapped<dna4>> const expected{gap{}, 'A'_dna4, 'C'_dna4, gap{}, gap{},
+                                             'T'_dna4, 'G'_dna4, gap{}};
+    EXPECT_EQ(seq, expected);
+
+    // an empty run description is a no-op
+    insert_gaps(seq, std::vector<std::pair<size_t, size_t>>{});
+    EXPECT_EQ(seq, expected);
+}
+
 TEST(aligned_sequence_debug_stream, multi_without_gaps)
 {
     std::string const expected
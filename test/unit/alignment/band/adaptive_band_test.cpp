@@ -0,0 +1,31 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/alignment/band/adaptive_band.hpp>
+
+using namespace seqan3;
+
+TEST(adaptive_band, default_construction)
+{
+    adaptive_band bs{};
+    EXPECT_EQ(bs.lower_bound, -1);
+    EXPECT_EQ(bs.upper_bound, 1);
+}
+
+TEST(adaptive_band, construction)
+{
+    adaptive_band bs{lower_bound{-2}, upper_bound{2}};
+    EXPECT_EQ(bs.lower_bound, -2);
+    EXPECT_EQ(bs.upper_bound, 2);
+}
+
+TEST(adaptive_band, wrong_boundary_args)
+{
+    EXPECT_THROW((adaptive_band{lower_bound{3}, upper_bound{2}}), std::invalid_argument);
+}
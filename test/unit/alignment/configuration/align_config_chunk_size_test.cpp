@@ -0,0 +1,41 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <type_traits>
+
+#include <seqan3/alignment/configuration/align_config_chunk_size.hpp>
+#include <seqan3/core/algorithm/configuration.hpp>
+
+using namespace seqan3;
+
+TEST(align_config_chunk_size, ConfigElement)
+{
+    EXPECT_TRUE((detail::ConfigElement<align_cfg::chunk_size>));
+}
+
+TEST(align_config_chunk_size, configuration)
+{
+    {
+        align_cfg::chunk_size elem{128};
+        configuration cfg{elem};
+        EXPECT_EQ((std::is_same_v<std::remove_reference_t<decltype(get<align_cfg::chunk_size>(cfg).value)>,
+                                  uint32_t>), true);
+
+        EXPECT_EQ(get<align_cfg::chunk_size>(cfg).value, 128u);
+    }
+
+    {
+        configuration cfg{align_cfg::chunk_size{128}};
+        EXPECT_EQ((std::is_same_v<std::remove_reference_t<decltype(get<align_cfg::chunk_size>(cfg).value)>,
+                                  uint32_t>), true);
+
+        EXPECT_EQ(get<align_cfg::chunk_size>(cfg).value, 128u);
+    }
+}
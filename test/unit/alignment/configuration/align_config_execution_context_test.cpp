@@ -0,0 +1,39 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <type_traits>
+
+#include <seqan3/alignment/configuration/align_config_execution_context.hpp>
+#include <seqan3/core/algorithm/configuration.hpp>
+
+using namespace seqan3;
+
+TEST(align_config_execution_context, ConfigElement)
+{
+    EXPECT_TRUE((detail::ConfigElement<align_cfg::execution_context>));
+}
+
+TEST(align_config_execution_context, configuration)
+{
+    { // default constructed: nullptr selects the process-wide shared pool
+        configuration cfg{align_cfg::execution_context{}};
+        EXPECT_EQ((std::is_same_v<std::remove_reference_t<decltype(get<align_cfg::execution_context>(cfg).value)>,
+                                  thread_pool *>), true);
+
+        EXPECT_EQ(get<align_cfg::execution_context>(cfg).value, nullptr);
+    }
+
+    { // injected pool
+        thread_pool pool{2};
+        configuration cfg{align_cfg::execution_context{&pool}};
+
+        EXPECT_EQ(get<align_cfg::execution_context>(cfg).value, &pool);
+    }
+}
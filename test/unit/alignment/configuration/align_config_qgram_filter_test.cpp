@@ -0,0 +1,45 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <type_traits>
+
+#include <seqan3/alignment/configuration/align_config_qgram_filter.hpp>
+#include <seqan3/core/algorithm/configuration.hpp>
+
+using namespace seqan3;
+
+TEST(align_config_qgram_filter, ConfigElement)
+{
+    EXPECT_TRUE((detail::ConfigElement<align_cfg::qgram_filter>));
+}
+
+TEST(align_config_qgram_filter, configuration)
+{
+    {
+        align_cfg::qgram_filter elem{qgram_filter_scheme{qgram_size{4u}, qgram_threshold{10u}}};
+        configuration cfg{elem};
+        EXPECT_EQ((std::is_same_v<std::remove_reference_t<decltype(get<align_cfg::qgram_filter>(cfg).value)>,
+                                  qgram_filter_scheme>), true);
+
+        EXPECT_EQ(get<align_cfg::qgram_filter>(cfg).value.size, 4u);
+        EXPECT_EQ(get<align_cfg::qgram_filter>(cfg).value.threshold, 10u);
+    }
+
+    {
+        configuration cfg{align_cfg::qgram_filter{qgram_filter_scheme{qgram_size{3u}, qgram_threshold{5u}}}};
+        EXPECT_EQ(get<align_cfg::qgram_filter>(cfg).value.size, 3u);
+        EXPECT_EQ(get<align_cfg::qgram_filter>(cfg).value.threshold, 5u);
+    }
+}
+
+TEST(align_config_qgram_filter, invalid_scheme)
+{
+    EXPECT_THROW((qgram_filter_scheme{qgram_size{0u}, qgram_threshold{1u}}), std::invalid_argument);
+}
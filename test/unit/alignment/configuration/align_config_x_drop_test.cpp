@@ -0,0 +1,41 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <type_traits>
+
+#include <seqan3/alignment/configuration/align_config_x_drop.hpp>
+#include <seqan3/core/algorithm/configuration.hpp>
+
+using namespace seqan3;
+
+TEST(align_config_x_drop, ConfigElement)
+{
+    EXPECT_TRUE((detail::ConfigElement<align_cfg::x_drop>));
+}
+
+TEST(align_config_x_drop, configuration)
+{
+    {
+        align_cfg::x_drop elem{10};
+        configuration cfg{elem};
+        EXPECT_EQ((std::is_same_v<std::remove_reference_t<decltype(get<align_cfg::x_drop>(cfg).value)>,
+                                  int32_t>), true);
+
+        EXPECT_EQ(get<align_cfg::x_drop>(cfg).value, 10);
+    }
+
+    {
+        configuration cfg{align_cfg::x_drop{10}};
+        EXPECT_EQ((std::is_same_v<std::remove_reference_t<decltype(get<align_cfg::x_drop>(cfg).value)>,
+                                  int32_t>), true);
+
+        EXPECT_EQ(get<align_cfg::x_drop>(cfg).value, 10);
+    }
+}
@@ -0,0 +1,83 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <seqan3/alignment/matrix/alignment_trace_algorithms.hpp>
+#include <seqan3/alignment/matrix/alignment_trace_matrix.hpp>
+#include <seqan3/alphabet/gap/gapped.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+
+using namespace seqan3;
+using namespace seqan3::detail;
+
+struct alignment_trace_algorithms_fixture : public ::testing::Test
+{
+    trace_directions N{},
+        D{trace_directions::diagonal},
+        L{trace_directions::left},
+        U{trace_directions::up},
+        DU{D|U};
+
+    std::vector<dna4> database = "ACGT"_dna4;
+    std::vector<dna4> query = "AGT"_dna4;
+
+    // The full trace matrix of the edit distance alignment of database and query.
+    std::vector<trace_directions> traces
+    {
+        N, L, L,  L,  L,
+        U, D, L,  L,  L,
+        U, U, D,  D,  L,
+        U, U, DU, DU, D
+    };
+
+    alignment_coordinate back_coordinate{column_index_type{3u}, row_index_type{2u}};
+};
+
+TEST_F(alignment_trace_algorithms_fixture, alignment_trace)
+{
+    alignment_trace_matrix matrix{traces, 4u, 5u};
+
+    auto [gapped_database, gapped_query] = alignment_trace(database, query, matrix, back_coordinate);
+
+    std::vector<gapped<dna4>> expected_database{'A'_dna4, 'C'_dna4, 'G'_dna4, 'T'_dna4};
+    std::vector<gapped<dna4>> expected_query{'A'_dna4, gap{}, 'G'_dna4, 'T'_dna4};
+    EXPECT_EQ(gapped_database, expected_database);
+    EXPECT_EQ(gapped_query, expected_query);
+}
+
+TEST_F(alignment_trace_algorithms_fixture, alignment_trace_into)
+{
+    alignment_trace_matrix matrix{traces, 4u, 5u};
+
+    std::vector<gapped<dna4>> gapped_database{};
+    std::vector<gapped<dna4>> gapped_query{};
+    alignment_trace_into(database, query, matrix, back_coordinate, gapped_database, gapped_query);
+
+    EXPECT_EQ(std::pair(gapped_database, gapped_query),
+              alignment_trace(database, query, matrix, back_coordinate));
+}
+
+TEST_F(alignment_trace_algorithms_fixture, alignment_trace_into_recycles_buffers)
+{
+    alignment_trace_matrix matrix{traces, 4u, 5u};
+
+    // stale content from a previous alignment is overwritten and the grown capacity is kept
+    std::vector<gapped<dna4>> gapped_database(100, gap{});
+    std::vector<gapped<dna4>> gapped_query(100, gap{});
+    size_t const database_capacity = gapped_database.capacity();
+    size_t const query_capacity = gapped_query.capacity();
+
+    alignment_trace_into(database, query, matrix, back_coordinate, gapped_database, gapped_query);
+
+    EXPECT_EQ(std::pair(gapped_database, gapped_query),
+              alignment_trace(database, query, matrix, back_coordinate));
+    EXPECT_EQ(gapped_database.capacity(), database_capacity);
+    EXPECT_EQ(gapped_query.capacity(), query_capacity);
+}
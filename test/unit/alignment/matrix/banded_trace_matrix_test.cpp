@@ -0,0 +1,106 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <seqan3/alignment/matrix/alignment_trace_algorithms.hpp>
+#include <seqan3/alignment/matrix/alignment_trace_matrix.hpp>
+#include <seqan3/alignment/matrix/banded_trace_matrix.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+
+using namespace seqan3;
+using namespace seqan3::detail;
+
+static_assert(matrix_concept<banded_trace_matrix>);
+
+struct banded_trace_matrix_fixture : public ::testing::Test
+{
+    trace_directions N{},
+        D{trace_directions::diagonal},
+        L{trace_directions::left},
+        U{trace_directions::up},
+        DU{D|U};
+
+    std::vector<dna4> database = "ACGT"_dna4;
+    std::vector<dna4> query = "AGT"_dna4;
+
+    // The full trace matrix of the edit distance alignment of database and query;
+    // the traced path only visits the diagonals 0 and 1.
+    std::vector<trace_directions> traces
+    {
+        N, L, L,  L,  L,
+        U, D, L,  L,  L,
+        U, U, D,  D,  L,
+        U, U, DU, DU, D
+    };
+};
+
+TEST_F(banded_trace_matrix_fixture, dimensions)
+{
+    banded_trace_matrix matrix{4u, 5u, -1, 2};
+
+    EXPECT_EQ(matrix.rows(), 4u);
+    EXPECT_EQ(matrix.cols(), 5u);
+    EXPECT_EQ(matrix.band_size(), 4u);
+}
+
+TEST_F(banded_trace_matrix_fixture, inside_band)
+{
+    banded_trace_matrix matrix{4u, 5u, -1, 2};
+
+    EXPECT_TRUE(matrix.inside_band(0u, 0u));
+    EXPECT_TRUE(matrix.inside_band(1u, 0u));  // lower diagonal
+    EXPECT_TRUE(matrix.inside_band(0u, 2u));  // upper diagonal
+    EXPECT_FALSE(matrix.inside_band(2u, 0u)); // below the band
+    EXPECT_FALSE(matrix.inside_band(0u, 3u)); // above the band
+    EXPECT_FALSE(matrix.inside_band(3u, 1u));
+}
+
+TEST_F(banded_trace_matrix_fixture, set_and_at)
+{
+    banded_trace_matrix matrix{4u, 5u, -1, 2};
+
+    matrix.set(2u, 3u, DU);
+    EXPECT_EQ(matrix.at(2u, 3u), DU);
+
+    // untouched cells inside of the band read as none
+    EXPECT_EQ(matrix.at(1u, 1u), N);
+
+    // cells outside of the band read as none
+    EXPECT_EQ(matrix.at(3u, 0u), N);
+    EXPECT_EQ(matrix.at(0u, 4u), N);
+}
+
+TEST_F(banded_trace_matrix_fixture, matches_full_matrix_inside_band)
+{
+    banded_trace_matrix banded_matrix{traces, 4u, 5u, -1, 2};
+    alignment_trace_matrix full_matrix{traces, 4u, 5u};
+
+    for (size_t row = 0u; row < banded_matrix.rows(); ++row)
+        for (size_t col = 0u; col < banded_matrix.cols(); ++col)
+            if (banded_matrix.inside_band(row, col))
+                EXPECT_EQ(banded_matrix.at(row, col), full_matrix.at(row, col));
+}
+
+TEST_F(banded_trace_matrix_fixture, trace_walk)
+{
+    banded_trace_matrix banded_matrix{traces, 4u, 5u, -1, 2};
+    alignment_trace_matrix full_matrix{traces, 4u, 5u};
+
+    alignment_coordinate back_coordinate{column_index_type{3u}, row_index_type{2u}};
+
+    alignment_coordinate front_full = alignment_front_coordinate(full_matrix, back_coordinate);
+    alignment_coordinate front_banded = alignment_front_coordinate(banded_matrix, back_coordinate);
+    EXPECT_EQ(front_banded.first, front_full.first);
+    EXPECT_EQ(front_banded.second, front_full.second);
+
+    auto alignment_full = alignment_trace(database, query, full_matrix, back_coordinate);
+    auto alignment_banded = alignment_trace(database, query, banded_matrix, back_coordinate);
+    EXPECT_EQ(alignment_banded, alignment_full);
+}
@@ -0,0 +1,116 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <seqan3/alignment/matrix/alignment_trace_algorithms.hpp>
+#include <seqan3/alignment/matrix/alignment_trace_matrix.hpp>
+#include <seqan3/alignment/matrix/packed_trace_matrix.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+
+using namespace seqan3;
+using namespace seqan3::detail;
+
+static_assert(matrix_concept<packed_trace_matrix>);
+
+struct packed_trace_matrix_fixture : public ::testing::Test
+{
+    trace_directions N{},
+        D{trace_directions::diagonal},
+        L{trace_directions::left},
+        U{trace_directions::up},
+        DL{D|L}, DU{D|U}, UL{U|L}, DUL{D|U|L};
+
+    std::vector<dna4> database = "AACACGTTAACCGGTT"_dna4;
+    std::vector<dna4> query = "ACGTACGT"_dna4;
+
+    std::vector<trace_directions> traces
+    {
+        N,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        U,  D,  DL, L,  DL, L,  L,  L,  L,  DL, DL, L,  L,  L,  L,  L,  L,
+        U,  U,  D,  D,  L,  DL, L,  L,  L,  L,  L,  DL, DL, L,  L,  L,  L,
+        U,  U,  DU, DU, D,  DL, D,  L,  L,  L,  L,  L,  L,  DL, DL, L,  L,
+        U,  U,  DU, DU, DU, D,  DUL,D,  DL, L,  L,  L,  L,  L,  L,  DL, DL,
+        U,  DU, D,  DUL,D,  DUL,D,  U,  D,  D,  DL, L,  L,  L,  L,  L,  L,
+        U,  U,  U,  D,  UL, D,  L,  DUL,DU, DU, D,  D,  DL, L,  L,  L,  L,
+        U,  U,  U,  U,  D,  U,  D,  L,  L,  DUL,DU, DU, D,  D,  DL, L,  L,
+        U,  U,  U,  U,  DU, DU, U,  D,  DL, L,  L,  DUL,DU, DU, D,  D,  DL
+    };
+};
+
+TEST_F(packed_trace_matrix_fixture, round_trip)
+{
+    std::vector<trace_directions> entries{N, D, L, U, DL, DU, UL, DUL};
+    packed_trace_matrix matrix{entries, 2u, 4u};
+
+    EXPECT_EQ(matrix.rows(), 2u);
+    EXPECT_EQ(matrix.cols(), 4u);
+
+    for (size_t row = 0u; row < matrix.rows(); ++row)
+        for (size_t col = 0u; col < matrix.cols(); ++col)
+            EXPECT_EQ(matrix.at(row, col), entries[row * matrix.cols() + col]);
+}
+
+TEST_F(packed_trace_matrix_fixture, gap_open_variants_are_folded)
+{
+    std::vector<trace_directions> entries
+    {
+        trace_directions::up_open,
+        trace_directions::left_open,
+        D | trace_directions::up_open | trace_directions::left_open,
+        trace_directions::up_open | L
+    };
+    packed_trace_matrix matrix{entries, 1u, 4u};
+
+    EXPECT_EQ(matrix.at(0u, 0u), U);
+    EXPECT_EQ(matrix.at(0u, 1u), L);
+    EXPECT_EQ(matrix.at(0u, 2u), DUL);
+    EXPECT_EQ(matrix.at(0u, 3u), UL);
+}
+
+TEST_F(packed_trace_matrix_fixture, word_wise_writer)
+{
+    // 35 cells cross two word boundaries and leave a partial word at the end.
+    std::vector<trace_directions> entries{};
+    std::vector<trace_directions> pattern{N, D, L, U, DL, DU, UL, DUL};
+    for (size_t i = 0u; i < 35u; ++i)
+        entries.push_back(pattern[i % pattern.size()]);
+
+    packed_trace_matrix matrix{5u, 7u};
+    for (trace_directions const dir : entries)
+        matrix.push_back(dir);
+
+    packed_trace_matrix expected{entries, 5u, 7u};
+    EXPECT_EQ(matrix, expected);
+}
+
+TEST_F(packed_trace_matrix_fixture, matches_byte_wide_matrix)
+{
+    alignment_trace_matrix byte_matrix{traces, 9u, 17u};
+    packed_trace_matrix packed_matrix{traces, 9u, 17u};
+
+    EXPECT_EQ(packed_matrix, byte_matrix);
+}
+
+TEST_F(packed_trace_matrix_fixture, trace_walk)
+{
+    alignment_trace_matrix byte_matrix{traces, 9u, 17u};
+    packed_trace_matrix packed_matrix{traces, 9u, 17u};
+
+    alignment_coordinate back_coordinate{column_index_type{15u}, row_index_type{7u}};
+
+    alignment_coordinate front_byte = alignment_front_coordinate(byte_matrix, back_coordinate);
+    alignment_coordinate front_packed = alignment_front_coordinate(packed_matrix, back_coordinate);
+    EXPECT_EQ(front_packed.first, front_byte.first);
+    EXPECT_EQ(front_packed.second, front_byte.second);
+
+    auto alignment_byte = alignment_trace(database, query, byte_matrix, back_coordinate);
+    auto alignment_packed = alignment_trace(database, query, packed_matrix, back_coordinate);
+    EXPECT_EQ(alignment_packed, alignment_byte);
+}
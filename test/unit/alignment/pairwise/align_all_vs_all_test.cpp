@@ -0,0 +1,122 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_all_vs_all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alphabet/nucleotide/all.hpp>
+#include <seqan3/range/view/pairwise_combine.hpp>
+
+using namespace seqan3;
+
+namespace
+{
+
+dna4_vector generate_sequence(size_t const length, size_t const seed)
+{
+    std::mt19937 engine(seed);
+    std::uniform_int_distribution<uint8_t> distribution{0, 3}; // dna4 ranks
+
+    dna4_vector sequence{};
+    sequence.reserve(length);
+    for (size_t i = 0; i < length; ++i)
+        sequence.push_back(assign_rank(dna4{}, distribution(engine)));
+
+    return sequence;
+}
+
+configuration base_config()
+{
+    return align_cfg::mode{global_alignment}
+         | align_cfg::scoring{nucleotide_scoring_scheme{match_score{4}, mismatch_score{-5}}}
+         | align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}}
+         | align_cfg::result{with_score};
+}
+
+} // anonymous namespace
+
+TEST(triangular_score_matrix, packed_layout)
+{
+    triangular_score_matrix<int> matrix{4u};
+
+    EXPECT_EQ(matrix.dimension(), 4u);
+    EXPECT_EQ(matrix.size(), 6u); // 4 choose 2
+
+    int value = 0;
+    for (size_t i = 0; i < 4u; ++i)
+        for (size_t j = i + 1; j < 4u; ++j)
+            matrix.at(i, j) = value++;
+
+    // symmetric access refers to the same element
+    EXPECT_EQ(matrix.at(2u, 0u), matrix.at(0u, 2u));
+    EXPECT_EQ(matrix.at(0u, 1u), 0);
+    EXPECT_EQ(matrix.at(2u, 3u), 5);
+
+    triangular_score_matrix<int> empty{};
+    EXPECT_EQ(empty.dimension(), 0u);
+    EXPECT_EQ(empty.size(), 0u);
+}
+
+TEST(align_all_vs_all, matches_align_pairwise)
+{
+    std::vector<dna4_vector> database{};
+    for (size_t seed = 0; seed < 20; ++seed)
+        database.push_back(generate_sequence(30 + seed * 3, seed));
+
+    triangular_score_matrix matrix = align_all_vs_all(database, base_config(), 4u);
+
+    EXPECT_EQ(matrix.dimension(), database.size());
+
+    auto pair_view = database | view::pairwise_combine;
+    auto result_range = align_pairwise(pair_view, base_config());
+    auto result_it = result_range.begin();
+
+    for (size_t first = 0; first < database.size(); ++first) // pairwise_combine order
+        for (size_t second = first + 1; second < database.size(); ++second, ++result_it)
+            EXPECT_EQ(matrix.at(first, second), (*result_it).score());
+}
+
+TEST(align_all_vs_all, small_and_empty_database)
+{
+    std::vector<dna4_vector> database{};
+    EXPECT_EQ(align_all_vs_all(database, base_config()).size(), 0u);
+
+    database.push_back(generate_sequence(25, 0));
+    EXPECT_EQ(align_all_vs_all(database, base_config()).size(), 0u);
+
+    database.push_back(generate_sequence(25, 1));
+    triangular_score_matrix matrix = align_all_vs_all(database, base_config(), 1u);
+    EXPECT_EQ(matrix.size(), 1u);
+
+    int expected{};
+    for (auto && res : align_pairwise(std::tie(database[0], database[1]), base_config()))
+        expected = res.score();
+    EXPECT_EQ(matrix.at(0u, 1u), expected);
+}
+
+TEST(align_all_vs_all, more_threads_than_tiles)
+{
+    std::vector<dna4_vector> database{};
+    for (size_t seed = 0; seed < 5; ++seed)
+        database.push_back(generate_sequence(20, seed));
+
+    // 5 sequences fit into one tile; surplus threads must not break the computation
+    triangular_score_matrix matrix = align_all_vs_all(database, base_config(), 16u);
+
+    auto pair_view = database | view::pairwise_combine;
+    auto result_range = align_pairwise(pair_view, base_config());
+    auto result_it = result_range.begin();
+
+    for (size_t first = 0; first < database.size(); ++first)
+        for (size_t second = first + 1; second < database.size(); ++second, ++result_it)
+            EXPECT_EQ(matrix.at(first, second), (*result_it).score());
+}
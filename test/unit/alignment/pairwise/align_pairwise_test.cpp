@@ -7,8 +7,12 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <execution>
+#include <mutex>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <meta/meta.hpp>
 
@@ -100,3 +104,308 @@ TEST(align_pairwise, multiple_rng_lvalue)
         EXPECT_EQ(std::string{gap2 | view::to_char}, "A-GTGATACT");
     }
 }
+
+TEST(align_pairwise, callback_sequential)
+{
+    std::vector<std::pair<dna4_vector, dna4_vector>> sequences{};
+    sequences.emplace_back("ACGTGATG"_dna4, "AGTGATACT"_dna4);
+    sequences.emplace_back("ACGT"_dna4, "AGTGATACT"_dna4);
+    sequences.emplace_back("TTTTTT"_dna4, "ACGTACGT"_dna4);
+
+    configuration cfg = align_cfg::edit | align_cfg::result{with_score};
+
+    std::vector<int> expected_scores{};
+    for (auto && res : align_pairwise(sequences, cfg))
+        expected_scores.push_back(res.score());
+
+    // Without the parallel configuration the results are reported in the order of the input range.
+    std::vector<int> scores{};
+    align_pairwise(sequences, cfg, [&](auto && res) { scores.push_back(res.score()); });
+    EXPECT_EQ(scores, expected_scores);
+}
+
+TEST(align_pairwise, callback_parallel)
+{
+    std::vector<std::pair<dna4_vector, dna4_vector>> sequences{};
+    for (unsigned i = 0; i < 50u; ++i)
+    {
+        sequences.emplace_back("ACGTGATGACGATACGT"_dna4, "AGTGATACTGATG"_dna4);
+        sequences.emplace_back("ACGT"_dna4, "AGTGATACT"_dna4);
+    }
+
+    configuration cfg = align_cfg::mode{global_alignment}
+                      | align_cfg::scoring{nucleotide_scoring_scheme{match_score{4}, mismatch_score{-5}}}
+                      | align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}}
+                      | align_cfg::result{with_score};
+
+    std::vector<int> expected_scores{};
+    for (auto && res : align_pairwise(sequences, cfg))
+        expected_scores.push_back(res.score());
+    std::sort(expected_scores.begin(), expected_scores.end());
+
+    // The results are reported unordered from the worker threads; the callback must be thread-safe.
+    std::mutex score_mutex{};
+    std::vector<int> scores{};
+    align_pairwise(sequences, cfg | align_cfg::parallel{2}, [&](auto && res)
+    {
+        std::lock_guard<std::mutex> lock{score_mutex};
+        scores.push_back(res.score());
+    });
+
+    std::sort(scores.begin(), scores.end());
+    EXPECT_EQ(scores, expected_scores);
+}
+
+TEST(align_pairwise, one_vs_many)
+{
+    // One query against a batch of database sequences; the initialisation column is reused for all pairs with
+    // the same query length and recomputed when the length changes.
+    auto query = "AGTGATACT"_dna4;
+    std::vector<std::pair<dna4_vector, dna4_vector>> sequences{};
+    sequences.emplace_back("ACGTGATG"_dna4, query);
+    sequences.emplace_back("TTTTTT"_dna4, query);
+    sequences.emplace_back("ACGTACGTACGT"_dna4, "ACGT"_dna4);  // Different query length invalidates the cache.
+    sequences.emplace_back("ACGTGCTG"_dna4, query);
+
+    configuration cfg = align_cfg::mode{global_alignment}
+                      | align_cfg::scoring{nucleotide_scoring_scheme{match_score{4}, mismatch_score{-5}}}
+                      | align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}}
+                      | align_cfg::result{with_score};
+
+    // Computing every pair with its own invocation must yield the same scores as the batch.
+    std::vector<int> expected_scores{};
+    for (auto const & sequence_pair : sequences)
+        for (auto && res : align_pairwise(std::tie(sequence_pair.first, sequence_pair.second), cfg))
+            expected_scores.push_back(res.score());
+
+    size_t count = 0;
+    for (auto && res : align_pairwise(sequences, cfg))
+        EXPECT_EQ(res.score(), expected_scores[count++]);
+    EXPECT_EQ(count, sequences.size());
+}
+
+TEST(align_pairwise, lazy_traceback)
+{
+    std::vector<std::pair<dna4_vector, dna4_vector>> sequences{};
+    sequences.emplace_back("ACGTGATG"_dna4, "ACGTGATG"_dna4);
+    sequences.emplace_back("AGTGATACT"_dna4, "AGTGATACT"_dna4);
+    sequences.emplace_back("ACGTGATG"_dna4, "ACGTGATG"_dna4);
+
+    configuration cfg = align_cfg::mode{global_alignment}
+                      | align_cfg::scoring{nucleotide_scoring_scheme{match_score{4}, mismatch_score{-5}}}
+                      | align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}}
+                      | align_cfg::result{with_alignment};
+
+    // Collect all results before accessing any alignment; the deferred traceback must remain valid although
+    // the kernel and its trace matrix buffer are reused for the subsequent pairs.
+    auto rng = align_pairwise(sequences, cfg);
+    auto it = rng.begin();
+    std::vector<std::remove_reference_t<decltype(*it)>> results{};
+    for (; it != rng.end(); ++it)
+        results.push_back(std::move(*it));
+
+    ASSERT_EQ(results.size(), 3u);
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        EXPECT_EQ(results[i].front_coordinate().first, 0u);
+        EXPECT_EQ(results[i].front_coordinate().second, 0u);
+        auto && [gap1, gap2] = results[i].alignment();
+        EXPECT_EQ(std::string{gap1 | view::to_char}, std::string{sequences[i].first | view::to_char});
+        EXPECT_EQ(std::string{gap2 | view::to_char}, std::string{sequences[i].second | view::to_char});
+    }
+}
+
+TEST(align_pairwise, adaptive_band)
+{
+    // The optimal alignment requires a gap of size 4, which does not fit into the initial band.
+    auto seq1 = "ACGTAAAACGT"_dna4;
+    auto seq2 = "ACGTCGT"_dna4;
+
+    auto p = std::tie(seq1, seq2);
+
+    configuration cfg = align_cfg::mode{global_alignment}
+                      | align_cfg::scoring{nucleotide_scoring_scheme{match_score{4}, mismatch_score{-5}}}
+                      | align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}}
+                      | align_cfg::result{with_score};
+
+    std::vector<int> expected_scores{};
+    for (auto && res : align_pairwise(p, cfg))
+        expected_scores.push_back(res.score());
+
+    // The band is widened until the optimum lies strictly inside of the band.
+    size_t count = 0;
+    for (auto && res : align_pairwise(p, cfg | align_cfg::band{adaptive_band{lower_bound{-1}, upper_bound{1}}}))
+        EXPECT_EQ(res.score(), expected_scores[count++]);
+}
+
+TEST(align_pairwise, tile)
+{
+    // The sequences span several blocks such that the boundary state is carried over multiple times.
+    auto seq1 = "ACGTGATGACGATACGTGATCCCGATGACGT"_dna4;
+    auto seq2 = "AGTGATACTGATGAAACGTGATCGACGT"_dna4;
+
+    auto p = std::tie(seq1, seq2);
+
+    configuration cfg = align_cfg::mode{global_alignment}
+                      | align_cfg::scoring{nucleotide_scoring_scheme{match_score{4}, mismatch_score{-5}}}
+                      | align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}}
+                      | align_cfg::result{with_back_coordinate};
+
+    std::vector<std::pair<int, std::pair<size_t, size_t>>> expected{};
+    for (auto && res : align_pairwise(p, cfg))
+        expected.emplace_back(res.score(), std::pair{res.back_coordinate().first, res.back_coordinate().second});
+
+    // The blocked computation must yield the same results for any block height.
+    for (uint32_t block_height : {1u, 4u, 1024u})
+    {
+        size_t count = 0;
+        for (auto && res : align_pairwise(p, cfg | align_cfg::tile{block_height}))
+        {
+            EXPECT_EQ(res.score(), expected[count].first);
+            EXPECT_EQ(res.back_coordinate().first, expected[count].second.first);
+            EXPECT_EQ(res.back_coordinate().second, expected[count].second.second);
+            ++count;
+        }
+    }
+}
+
+TEST(align_pairwise, x_drop)
+{
+    configuration cfg = align_cfg::mode{global_alignment}
+                      | align_cfg::scoring{nucleotide_scoring_scheme{match_score{4}, mismatch_score{-5}}}
+                      | align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}}
+                      | align_cfg::result{with_score};
+
+    {  // A similar pair is not dropped and yields the same score as without the x-drop termination.
+        auto seq1 = "ACGTGATG"_dna4;
+        auto seq2 = "ACGTGATG"_dna4;
+
+        auto p = std::tie(seq1, seq2);
+
+        for (auto && res : align_pairwise(p, cfg | align_cfg::x_drop{4}))
+        {
+            EXPECT_FALSE(res.is_filtered());
+            EXPECT_EQ(res.score(), 32);
+        }
+    }
+
+    {  // A dissimilar pair is aborted early and reported as filtered.
+        auto seq1 = "AAAAAAAAAAAAAAAA"_dna4;
+        auto seq2 = "TTTTTTTTTTTTTTTT"_dna4;
+
+        auto p = std::tie(seq1, seq2);
+
+        for (auto && res : align_pairwise(p, cfg | align_cfg::x_drop{4}))
+            EXPECT_TRUE(res.is_filtered());
+    }
+}
+
+TEST(align_pairwise, qgram_filter)
+{
+    std::vector<std::pair<dna4_vector, dna4_vector>> sequences{};
+    sequences.emplace_back("ACGTGATGACGTGATG"_dna4, "ACGTGATGACGTGATG"_dna4);  // shares every q-gram
+    sequences.emplace_back("AAAAAAAAAAAAAAAA"_dna4, "GTGTGTGTGTGTGTGT"_dna4);  // shares no q-gram
+    sequences.emplace_back("ACGTGATGACGTGATG"_dna4, "ACGTGATGTCGTGATG"_dna4);  // one substitution
+
+    configuration cfg = align_cfg::mode{global_alignment}
+                      | align_cfg::scoring{nucleotide_scoring_scheme{match_score{4}, mismatch_score{-5}}}
+                      | align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}}
+                      | align_cfg::result{with_score};
+
+    std::vector<int> expected_scores{};
+    for (auto && res : align_pairwise(sequences, cfg))
+        expected_scores.push_back(res.score());
+
+    // The pairs that pass the filter yield the same scores as without the filter.
+    auto filter_cfg = cfg | align_cfg::qgram_filter{qgram_filter_scheme{qgram_size{4u}, qgram_threshold{5u}}};
+
+    size_t count = 0;
+    for (auto && res : align_pairwise(sequences, filter_cfg))
+    {
+        if (count == 1u)
+        {
+            EXPECT_TRUE(res.is_filtered());
+        }
+        else
+        {
+            EXPECT_FALSE(res.is_filtered());
+            EXPECT_EQ(res.score(), expected_scores[count]);
+        }
+        ++count;
+    }
+
+    EXPECT_EQ(count, sequences.size());
+}
+
+TEST(align_pairwise, execution_policy_seq)
+{
+    std::vector<std::pair<dna4_vector, dna4_vector>> sequences{};
+    sequences.emplace_back("ACGTGATG"_dna4, "AGTGATACT"_dna4);
+    sequences.emplace_back("ACGT"_dna4, "AGTGATACT"_dna4);
+    sequences.emplace_back("TTTTTT"_dna4, "ACGTACGT"_dna4);
+
+    configuration cfg = align_cfg::edit | align_cfg::result{with_score};
+
+    std::vector<int> expected_scores{};
+    for (auto && res : align_pairwise(sequences, cfg))
+        expected_scores.push_back(res.score());
+
+    std::vector<int> scores{};
+    for (auto && res : align_pairwise(std::execution::seq, sequences, cfg))
+        scores.push_back(res.score());
+
+    EXPECT_EQ(scores, expected_scores);
+}
+
+TEST(align_pairwise, execution_policy_par)
+{
+    std::vector<std::pair<dna4_vector, dna4_vector>> sequences{};
+    for (unsigned i = 0; i < 50u; ++i)
+    {
+        sequences.emplace_back("ACGTGATG"_dna4, "AGTGATACT"_dna4);
+        sequences.emplace_back("TTTTTT"_dna4, "ACGTACGT"_dna4);
+    }
+
+    configuration cfg = align_cfg::edit | align_cfg::result{with_score};
+
+    std::vector<int> expected_scores{};
+    for (auto && res : align_pairwise(sequences, cfg))
+        expected_scores.push_back(res.score());
+
+    // The parallel policy must not change the results or their order.
+    std::vector<int> scores{};
+    for (auto && res : align_pairwise(std::execution::par, sequences, cfg))
+        scores.push_back(res.score());
+
+    EXPECT_EQ(scores, expected_scores);
+}
+
+TEST(align_pairwise, execution_policy_par_unseq)
+{
+    std::vector<std::pair<dna4_vector, dna4_vector>> sequences{};
+    for (unsigned i = 0; i < 50u; ++i)
+    {
+        sequences.emplace_back("ACGTGATG"_dna4, "AGTGATACT"_dna4);
+        sequences.emplace_back("TTTTTT"_dna4, "ACGTACGT"_dna4);
+    }
+
+    // The vectorised engine requires a simple scoring scheme.
+    configuration cfg = align_cfg::mode{global_alignment} |
+                        align_cfg::scoring{nucleotide_scoring_scheme{match_score{4}, mismatch_score{-5}}} |
+                        align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}} |
+                        align_cfg::result{with_score};
+
+    std::vector<int> expected_scores{};
+    for (auto && res : align_pairwise(sequences, cfg))
+        expected_scores.push_back(res.score());
+
+    // The parallel-unsequenced policy computes the results eagerly but keeps the input order.
+    auto results = align_pairwise(std::execution::par_unseq, sequences, cfg);
+    ASSERT_EQ(results.size(), sequences.size());
+
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        EXPECT_EQ(results[i].id(), static_cast<uint32_t>(i));
+        EXPECT_EQ(results[i].score(), expected_scores[i]);
+    }
+}
@@ -83,6 +83,28 @@ TEST(alignment_configurator, configure_affine_global_max_error)
                align_cfg::scoring{nucleotide_scoring_scheme{}} |
                align_cfg::max_error{5u};
 
+    EXPECT_TRUE(run_test(cfg));
+}
+
+TEST(alignment_configurator, configure_affine_global_max_error_trace)
+{
+    auto cfg = align_cfg::mode{global_alignment} |
+               align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}} |
+               align_cfg::scoring{nucleotide_scoring_scheme{}} |
+               align_cfg::max_error{5u} |
+               align_cfg::result{with_alignment};
+
+    EXPECT_THROW(run_test(cfg), invalid_alignment_configuration);
+}
+
+TEST(alignment_configurator, configure_affine_global_max_error_semi)
+{
+    auto cfg = align_cfg::mode{global_alignment} |
+               align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}} |
+               align_cfg::scoring{nucleotide_scoring_scheme{}} |
+               align_cfg::max_error{5u} |
+               align_cfg::aligned_ends{free_ends_first};
+
     EXPECT_THROW(run_test(cfg), invalid_alignment_configuration);
 }
 
@@ -164,3 +186,51 @@ TEST(alignment_configurator, configure_affine_global_semi)
 
     EXPECT_TRUE(run_test(cfg));
 }
+
+TEST(alignment_configurator, configure_affine_free_ends_static)
+{
+    // All four presets carry their values as std::integral_constant, i.e. each variant is dispatched at compile time
+    // into its own kernel.
+    auto cfg_base = align_cfg::mode{global_alignment} |
+                    align_cfg::scoring{nucleotide_scoring_scheme{}} |
+                    align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}};
+
+    EXPECT_TRUE(run_test(cfg_base | align_cfg::aligned_ends{free_ends_none}));
+    EXPECT_TRUE(run_test(cfg_base | align_cfg::aligned_ends{free_ends_first}));
+    EXPECT_TRUE(run_test(cfg_base | align_cfg::aligned_ends{free_ends_second}));
+    EXPECT_TRUE(run_test(cfg_base | align_cfg::aligned_ends{free_ends_all}));
+}
+
+TEST(alignment_configurator, configure_affine_free_ends_runtime)
+{
+    // Runtime specified end-gaps must select the same kernels as the static presets.
+    auto cfg_base = align_cfg::mode{global_alignment} |
+                    align_cfg::scoring{nucleotide_scoring_scheme{}} |
+                    align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}};
+
+    for (bool first : {true, false})
+    {
+        for (bool second : {true, false})
+        {
+            auto cfg = cfg_base | align_cfg::aligned_ends{end_gaps{front_end_first{first},
+                                                                   back_end_first{first},
+                                                                   front_end_second{second},
+                                                                   back_end_second{second}}};
+            EXPECT_TRUE(run_test(cfg));
+        }
+    }
+}
+
+TEST(alignment_configurator, configure_affine_free_ends_mixed)
+{
+    // Static and runtime specifiers can be mixed; the static part must not hinder the runtime resolution.
+    auto cfg = align_cfg::mode{global_alignment} |
+               align_cfg::scoring{nucleotide_scoring_scheme{}} |
+               align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}} |
+               align_cfg::aligned_ends{end_gaps{front_end_first{std::true_type{}},
+                                                back_end_first{true},
+                                                front_end_second{std::false_type{}},
+                                                back_end_second{false}}};
+
+    EXPECT_TRUE(run_test(cfg));
+}
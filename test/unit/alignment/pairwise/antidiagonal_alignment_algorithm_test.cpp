@@ -0,0 +1,77 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/all.hpp>
+
+using namespace seqan3;
+
+namespace
+{
+
+dna4_vector generate_sequence(size_t const length, unsigned const seed)
+{
+    std::mt19937 engine{seed};
+    std::uniform_int_distribution<uint8_t> distribution{0, 3};
+
+    dna4_vector sequence{};
+    sequence.reserve(length);
+    for (size_t i = 0; i < length; ++i)
+        sequence.push_back(assign_rank(dna4{}, distribution(engine)));
+    return sequence;
+}
+
+} // namespace
+
+TEST(antidiagonal_alignment_algorithm, matches_scalar_algorithm)
+{
+    configuration vectorised_cfg = align_cfg::mode{global_alignment} |
+                                   align_cfg::scoring{nucleotide_scoring_scheme{match_score{4},
+                                                                                mismatch_score{-5}}} |
+                                   align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}} |
+                                   align_cfg::vectorise{};
+
+    configuration scalar_cfg = align_cfg::mode{global_alignment} |
+                               align_cfg::scoring{nucleotide_scoring_scheme{match_score{4},
+                                                                            mismatch_score{-5}}} |
+                               align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}};
+
+    for (auto const & [size1, size2] : std::vector<std::pair<size_t, size_t>>{{250, 300}, {33, 1}, {1, 33}, {64, 64}})
+    {
+        auto seq1 = generate_sequence(size1, 42);
+        auto seq2 = generate_sequence(size2, 43);
+
+        auto results = align_pairwise(std::tie(seq1, seq2), vectorised_cfg);
+        ASSERT_EQ(results.size(), 1u);
+
+        for (auto && res : align_pairwise(std::tie(seq1, seq2), scalar_cfg))
+            EXPECT_EQ(results[0].score(), res.score());
+    }
+}
+
+TEST(antidiagonal_alignment_algorithm, empty_sequence)
+{
+    configuration cfg = align_cfg::mode{global_alignment} |
+                        align_cfg::scoring{nucleotide_scoring_scheme{match_score{4}, mismatch_score{-5}}} |
+                        align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}} |
+                        align_cfg::vectorise{};
+
+    dna4_vector seq1{};
+    auto seq2 = "ACGT"_dna4;
+
+    auto results = align_pairwise(std::tie(seq1, seq2), cfg);
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_EQ(results[0].score(), -14);  // Gap open (-11) plus three gap extensions (-1 each).
+}
@@ -0,0 +1,131 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_banded.hpp>
+#include <seqan3/alphabet/nucleotide/all.hpp>
+
+using namespace seqan3;
+
+namespace
+{
+
+dna4_vector generate_sequence(size_t const length, size_t const seed)
+{
+    std::mt19937 engine(seed);
+    std::uniform_int_distribution<uint8_t> distribution{0, 3}; // dna4 ranks
+
+    dna4_vector sequence{};
+    sequence.reserve(length);
+    for (size_t i = 0; i < length; ++i)
+        sequence.push_back(assign_rank(dna4{}, distribution(engine)));
+
+    return sequence;
+}
+
+dna4_vector substitute(dna4_vector sequence, size_t const count, size_t const seed)
+{
+    std::mt19937 engine(seed);
+    std::uniform_int_distribution<size_t> position_distribution{0, sequence.size() - 1};
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        size_t const position = position_distribution(engine);
+        sequence[position] = assign_rank(dna4{}, (to_rank(sequence[position]) + 1) % 4);
+    }
+
+    return sequence;
+}
+
+int compute_score(dna4_vector const & first, dna4_vector const & second, static_band const & band)
+{
+    configuration cfg = align_cfg::edit | align_cfg::band{band} | align_cfg::result{with_score};
+
+    int score{};
+    for (auto && res : align_pairwise(std::tie(first, second), cfg))
+        score = res.score();
+    return score;
+}
+
+int compute_unbanded_score(dna4_vector const & first, dna4_vector const & second)
+{
+    configuration cfg = align_cfg::edit | align_cfg::result{with_score};
+
+    int score{};
+    for (auto && res : align_pairwise(std::tie(first, second), cfg))
+        score = res.score();
+    return score;
+}
+
+} // anonymous namespace
+
+TEST(edit_distance_banded, single_word)
+{
+    dna4_vector database = "ACGT"_dna4;
+    dna4_vector query = "AGT"_dna4;
+
+    EXPECT_EQ((compute_score(database, query, static_band{lower_bound{-1}, upper_bound{1}})), -1);
+}
+
+TEST(edit_distance_banded, identical_sequences)
+{
+    dna4_vector sequence = generate_sequence(200, 42);
+
+    EXPECT_EQ((compute_score(sequence, sequence, static_band{lower_bound{-1}, upper_bound{1}})), 0);
+}
+
+TEST(edit_distance_banded, covering_band_equals_unbanded)
+{
+    for (size_t seed = 0; seed < 10; ++seed)
+    {
+        dna4_vector database = generate_sequence(150, seed);
+        dna4_vector query = generate_sequence(150, seed + 100);
+
+        int64_t const bound = static_cast<int64_t>(database.size());
+        int const expected = compute_unbanded_score(database, query);
+        EXPECT_EQ((compute_score(database, query, static_band{lower_bound{-bound}, upper_bound{bound}})), expected);
+    }
+}
+
+TEST(edit_distance_banded, narrow_band_multiple_words)
+{
+    // The second sequence only contains substitutions, hence the optimal alignment stays within a narrow
+    // band around the main diagonal and the banded score must equal the unbanded score.
+    for (size_t seed = 0; seed < 10; ++seed)
+    {
+        dna4_vector database = generate_sequence(180, seed);
+        dna4_vector query = substitute(database, 5, seed + 100);
+
+        int const expected = compute_unbanded_score(database, query);
+        EXPECT_EQ((compute_score(database, query, static_band{lower_bound{-8}, upper_bound{8}})), expected);
+    }
+}
+
+TEST(edit_distance_banded, invalid_band)
+{
+    dna4_vector database = generate_sequence(100, 23);
+    dna4_vector query = generate_sequence(100, 24);
+
+    configuration origin_cfg = align_cfg::edit
+                             | align_cfg::band{static_band{lower_bound{2}, upper_bound{5}}}
+                             | align_cfg::result{with_score};
+    configuration sink_cfg = align_cfg::edit
+                           | align_cfg::band{static_band{lower_bound{-5}, upper_bound{-2}}}
+                           | align_cfg::result{with_score};
+
+    EXPECT_THROW((align_pairwise(std::tie(database, query), origin_cfg).begin()),
+                 invalid_alignment_configuration);
+    EXPECT_THROW((align_pairwise(std::tie(database, query), sink_cfg).begin()),
+                 invalid_alignment_configuration);
+}
@@ -0,0 +1,124 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <seqan3/alignment/pairwise/edit_distance_pattern.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+
+using namespace seqan3;
+using namespace seqan3::detail;
+
+struct semi_global_edit_distance_traits
+{
+    using word_type = uint64_t;
+    using is_semi_global_type = std::true_type;
+};
+
+TEST(edit_distance_pattern, stream_many_texts)
+{
+    std::vector<dna4> query = "ACGT"_dna4;
+    edit_distance_pattern pattern{query};
+
+    EXPECT_EQ(pattern.size(), 4u);
+
+    // the masks are built once, many texts are streamed through the same pattern
+    EXPECT_EQ(pattern.score("ACGT"_dna4), 0);
+    EXPECT_EQ(pattern.score("ACGG"_dna4), -1);
+    EXPECT_EQ(pattern.score("AGT"_dna4), -1);
+    EXPECT_EQ(pattern.score("ACGTACGT"_dna4), -4);
+    EXPECT_EQ(pattern.score("TGCA"_dna4), -4);
+}
+
+TEST(edit_distance_pattern, semi_global)
+{
+    std::vector<dna4> query = "ACGT"_dna4;
+    edit_distance_pattern<dna4, semi_global_edit_distance_traits> pattern{query};
+
+    // free end gaps in the text: the best occurrence of the query counts
+    EXPECT_EQ(pattern.score("TTTTACGTTTTT"_dna4), 0);
+    EXPECT_EQ(pattern.score("TTACGATT"_dna4), -1);
+    EXPECT_EQ(pattern.score("GGGG"_dna4), -3);
+}
+
+TEST(edit_distance_pattern, multiple_blocks)
+{
+    // a query longer than one machine word exercises the block-wise computation
+    std::vector<dna4> query{};
+    for (size_t i = 0; i < 70u; ++i)
+        query.push_back(i % 2 ? 'A'_dna4 : 'C'_dna4);
+
+    edit_distance_pattern pattern{query};
+
+    EXPECT_EQ(pattern.score(query), 0);
+
+    std::vector<dna4> text{query};
+    text[0] = 'G'_dna4;
+    text[35] = 'G'_dna4;
+    text[69] = 'G'_dna4;
+    EXPECT_EQ(pattern.score(text), -3);
+
+    text.push_back('T'_dna4);
+    EXPECT_EQ(pattern.score(text), -4);
+}
+
+TEST(edit_distance_pattern, empty_query)
+{
+    EXPECT_THROW((edit_distance_pattern<dna4>{""_dna4}), std::invalid_argument);
+}
+
+TEST(edit_distance_multi_pattern, word_parallel_batch)
+{
+    std::vector<std::vector<dna4>> queries{"ACGT"_dna4, "AAAA"_dna4, "TTTT"_dna4, "ACGA"_dna4};
+    edit_distance_multi_pattern patterns{queries};
+
+    EXPECT_EQ(patterns.size(), 4u);
+
+    std::vector<int> scores = patterns.score("ACGT"_dna4);
+    EXPECT_EQ(scores, (std::vector<int>{0, -3, -3, -1}));
+
+    scores = patterns.score("AACGTA"_dna4);
+    EXPECT_EQ(scores, (std::vector<int>{-2, -3, -5, -2}));
+}
+
+TEST(edit_distance_multi_pattern, matches_single_patterns)
+{
+    // 20 queries of length 7 occupy eight bits each, i.e. they span three machine words
+    std::vector<std::vector<dna4>> queries{};
+    for (size_t i = 0; i < 20u; ++i)
+    {
+        std::vector<dna4> query{};
+        for (size_t j = 0; j < 7u; ++j)
+            query.push_back(dna4{}.assign_rank((i * 7u + j * 3u) % 4u));
+        queries.push_back(std::move(query));
+    }
+
+    std::vector<dna4> const text = "ACGTTGCAACGGTACCGTAT"_dna4;
+
+    edit_distance_multi_pattern patterns{queries};
+    std::vector<int> const scores = patterns.score(text);
+
+    for (size_t i = 0; i < queries.size(); ++i)
+    {
+        edit_distance_pattern single{queries[i]};
+        EXPECT_EQ(scores[i], single.score(text)) << "pattern " << i;
+    }
+}
+
+TEST(edit_distance_multi_pattern, invalid_batches)
+{
+    std::vector<std::vector<dna4>> empty_batch{};
+    EXPECT_THROW((edit_distance_multi_pattern<dna4>{empty_batch}), std::invalid_argument);
+
+    std::vector<std::vector<dna4>> unequal{"ACGT"_dna4, "ACG"_dna4};
+    EXPECT_THROW((edit_distance_multi_pattern<dna4>{unequal}), std::invalid_argument);
+
+    std::vector<std::vector<dna4>> too_long{std::vector<dna4>(64u, 'A'_dna4)};
+    EXPECT_THROW((edit_distance_multi_pattern<dna4>{too_long}), std::invalid_argument);
+}
@@ -247,6 +247,70 @@ TYPED_TEST_P(edit_distance_unbanded, trace)
     EXPECT_EQ(std::string{gapped_query | view::to_char}, fixture.aligned_sequence2);
 }
 
+// With an error bound smaller than the query length the last active cell starts above the last row and has to
+// be moved by the Ukkonen trick before any score of the last row may be tracked as the best score.
+template <typename word_t>
+void semi_global_tight_max_errors_test()
+{
+    using traits_t = test_traits_type<word_t, std::true_type>;
+
+    auto align_cfg = align_cfg::edit | align_cfg::aligned_ends{free_ends_first} | align_cfg::max_error{1};
+
+    {   // The pattern occurs exactly; the end position of the occurrence is reported.
+        std::vector database = "TTTACGTTT"_dna4;
+        std::vector query = "ACGT"_dna4;
+        auto alignment = edit_distance<traits_t>(database, query, align_cfg);
+        EXPECT_EQ(alignment.score(), 0);
+        EXPECT_EQ(alignment.back_coordinate().first, 6u);
+        EXPECT_EQ(alignment.back_coordinate().second, 3u);
+    }
+
+    {   // The pattern occurs with one substitution.
+        std::vector database = "TTTACCTTT"_dna4;
+        std::vector query = "ACGT"_dna4;
+        auto alignment = edit_distance<traits_t>(database, query, align_cfg);
+        EXPECT_EQ(alignment.score(), -1);
+        EXPECT_EQ(alignment.back_coordinate().first, 6u);
+        EXPECT_EQ(alignment.back_coordinate().second, 3u);
+    }
+
+    {   // No end position within the error bound; the score stays below -max_error.
+        std::vector database = "GGGGGGGGG"_dna4;
+        std::vector query = "ACGT"_dna4;
+        auto alignment = edit_distance<traits_t>(database, query, align_cfg);
+        EXPECT_EQ(alignment.score(), -2);
+    }
+}
+
+TEST(edit_distance_unbanded_max_errors, semi_global_tight_small_patterns)
+{
+    semi_global_tight_max_errors_test<uint64_t>();
+}
+
+TEST(edit_distance_unbanded_max_errors, semi_global_tight_large_patterns)
+{
+    // A small word type makes the query span multiple machine words.
+    using traits_t = test_traits_type<uint8_t, std::true_type>;
+
+    auto align_cfg = align_cfg::edit | align_cfg::aligned_ends{free_ends_first} | align_cfg::max_error{2};
+
+    {   // The pattern occurs exactly; the end position of the occurrence is reported.
+        std::vector database = "TTTTACGTACGTACGTTTT"_dna4;
+        std::vector query = "ACGTACGTACG"_dna4;
+        auto alignment = edit_distance<traits_t>(database, query, align_cfg);
+        EXPECT_EQ(alignment.score(), 0);
+        EXPECT_EQ(alignment.back_coordinate().first, 14u);
+        EXPECT_EQ(alignment.back_coordinate().second, 10u);
+    }
+
+    {   // No end position within the error bound; the score stays below -max_error.
+        std::vector database = "TTTTTTTTTTTT"_dna4;
+        std::vector query = "ACGTACGTACG"_dna4;
+        auto alignment = edit_distance<traits_t>(database, query, align_cfg);
+        EXPECT_EQ(alignment.score(), -3);
+    }
+}
+
 REGISTER_TYPED_TEST_CASE_P(edit_distance_unbanded, score, score_matrix, trace_matrix, trace);
 
 // work around a bug that you can't specify more than 50 template arguments to ::testing::types
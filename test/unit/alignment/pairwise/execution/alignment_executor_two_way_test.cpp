@@ -7,7 +7,9 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <string>
+#include <vector>
 
 #include <range/v3/algorithm/for_each.hpp>
 #include <range/v3/view/single.hpp>
@@ -69,19 +71,39 @@ TEST(alignment_executor_two_way, bump)
 {
     detail::alignment_executor_two_way exec{collection, fn};
 
-    EXPECT_EQ(exec.bump().value(), 7u);
-    EXPECT_EQ(exec.bump().value(), 7u);
-    EXPECT_EQ(exec.bump().value(), 7u);
-    EXPECT_EQ(exec.bump().value(), 7u);
-    EXPECT_EQ(exec.bump().value(), 7u);
+    EXPECT_EQ(*exec.bump(), 7u);
+    EXPECT_EQ(*exec.bump(), 7u);
+    EXPECT_EQ(*exec.bump(), 7u);
+    EXPECT_EQ(*exec.bump(), 7u);
+    EXPECT_EQ(*exec.bump(), 7u);
     EXPECT_FALSE(static_cast<bool>(exec.bump()));
 }
 
+TEST(alignment_executor_two_way, references_into_recycled_arena)
+{
+    // With a chunk size covering the whole collection all results of the batch live in the arena at once.
+    detail::alignment_executor_two_way exec{collection, fn, detail::execution_handler_sequential{},
+                                            collection.size()};
+
+    std::vector<size_t *> seen{};
+    while (auto * res = exec.bump())
+    {
+        EXPECT_EQ(*res, 7u);
+        seen.push_back(res);
+    }
+
+    // every result of the batch occupies its own slot and earlier references stayed valid
+    EXPECT_EQ(seen.size(), collection.size());
+    for (size_t * res : seen)
+        EXPECT_EQ(*res, 7u);
+    EXPECT_EQ(std::unique(seen.begin(), seen.end()), seen.end());
+}
+
 TEST(alignment_executor_two_way, in_avail)
 {
     detail::alignment_executor_two_way exec{collection, fn};
     EXPECT_EQ(exec.in_avail(), 0u);
-    EXPECT_EQ(exec.bump().value(), 7u);
+    EXPECT_EQ(*exec.bump(), 7u);
     EXPECT_EQ(exec.in_avail(), 0u);
 }
 
@@ -89,35 +111,88 @@ TEST(alignment_executor_two_way, lvalue_single_view)
 {
     auto v = ranges::view::single(single);
     detail::alignment_executor_two_way exec{v, fn};
-    EXPECT_EQ(exec.bump().value(), 7u);
+    EXPECT_EQ(*exec.bump(), 7u);
     EXPECT_FALSE(static_cast<bool>(exec.bump()));
 }
 
 TEST(alignment_executor_two_way, rvalue_single_view)
 {
     detail::alignment_executor_two_way exec{ranges::view::single(single), fn};
-    EXPECT_EQ(exec.bump().value(), 7u);
+    EXPECT_EQ(*exec.bump(), 7u);
     EXPECT_FALSE(static_cast<bool>(exec.bump()));
 }
 
 TEST(alignment_executor_two_way, lvalue_collection)
 {
     detail::alignment_executor_two_way exec{collection, fn};
-    EXPECT_EQ(exec.bump().value(), 7u);
-    EXPECT_EQ(exec.bump().value(), 7u);
-    EXPECT_EQ(exec.bump().value(), 7u);
-    EXPECT_EQ(exec.bump().value(), 7u);
-    EXPECT_EQ(exec.bump().value(), 7u);
+    EXPECT_EQ(*exec.bump(), 7u);
+    EXPECT_EQ(*exec.bump(), 7u);
+    EXPECT_EQ(*exec.bump(), 7u);
+    EXPECT_EQ(*exec.bump(), 7u);
+    EXPECT_EQ(*exec.bump(), 7u);
     EXPECT_FALSE(static_cast<bool>(exec.bump()));
 }
 
 TEST(alignment_executor_two_way, rvalue_collection_view)
 {
     detail::alignment_executor_two_way exec{collection | view::persist, fn};
-    EXPECT_EQ(exec.bump().value(), 7u);
-    EXPECT_EQ(exec.bump().value(), 7u);
-    EXPECT_EQ(exec.bump().value(), 7u);
-    EXPECT_EQ(exec.bump().value(), 7u);
-    EXPECT_EQ(exec.bump().value(), 7u);
+    EXPECT_EQ(*exec.bump(), 7u);
+    EXPECT_EQ(*exec.bump(), 7u);
+    EXPECT_EQ(*exec.bump(), 7u);
+    EXPECT_EQ(*exec.bump(), 7u);
+    EXPECT_EQ(*exec.bump(), 7u);
     EXPECT_FALSE(static_cast<bool>(exec.bump()));
 }
+
+TEST(alignment_executor_two_way, explicit_chunk_size)
+{
+    // A configured chunk size must not change the results or their order.
+    for (size_t chunk_size : {1u, 2u, 100u})
+    {
+        detail::alignment_executor_two_way exec{collection, fn, detail::execution_handler_sequential{}, chunk_size};
+
+        size_t count = 0;
+        while (auto * res = exec.bump())
+        {
+            EXPECT_EQ(*res, 7u);
+            ++count;
+        }
+
+        EXPECT_EQ(count, collection.size());
+    }
+}
+
+TEST(alignment_executor_two_way, double_buffered_bump)
+{
+    using type = detail::alignment_executor_two_way<std::add_lvalue_reference_t<decltype(collection)>,
+                                                    decltype(fn),
+                                                    detail::execution_handler_sequential,
+                                                    detail::executor_buffering::double_buffered>;
+    type exec{collection, fn};
+
+    for (size_t i = 0; i < collection.size(); ++i)
+        EXPECT_EQ(*exec.bump(), 7u);
+
+    EXPECT_FALSE(static_cast<bool>(exec.bump()));
+}
+
+TEST(alignment_executor_two_way, double_buffered_multiple_chunks)
+{
+    // Use enough instances such that the results cannot be served from a single prefetched chunk.
+    std::vector<decltype(single)> large_collection{100, single};
+
+    using type = detail::alignment_executor_two_way<std::add_lvalue_reference_t<decltype(large_collection)>,
+                                                    decltype(fn),
+                                                    detail::execution_handler_sequential,
+                                                    detail::executor_buffering::double_buffered>;
+    type exec{large_collection, fn};
+
+    size_t count = 0;
+    while (auto * res = exec.bump())
+    {
+        EXPECT_EQ(*res, 7u);
+        ++count;
+    }
+
+    EXPECT_EQ(count, large_collection.size());
+}
@@ -0,0 +1,72 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/pairwise/execution/execution_handler_parallel.hpp>
+#include <seqan3/alphabet/nucleotide/all.hpp>
+
+using namespace seqan3;
+
+TEST(execution_handler_parallel, execute_and_wait)
+{
+    constexpr size_t job_count = 100;
+
+    std::vector<int> results(job_count, -1);
+
+    detail::execution_handler_parallel handler{4};
+
+    auto job = [] (std::string & first, std::string & second) -> int
+    {
+        return static_cast<int>(first.size() + second.size());
+    };
+
+    for (size_t i = 0; i < job_count; ++i)
+    {
+        std::string first(i, 'a');
+        std::string second(i, 'b');
+        int * slot = std::addressof(results[i]);
+        handler.execute(job, first, second, [slot] (int res) { *slot = res; });
+    }
+
+    handler.wait();
+
+    for (size_t i = 0; i < job_count; ++i)
+        EXPECT_EQ(results[i], static_cast<int>(2 * i));
+}
+
+TEST(execution_handler_parallel, align_pairwise)
+{
+    std::vector<std::pair<dna4_vector, dna4_vector>> sequences{};
+    for (unsigned i = 0; i < 200u; ++i)
+    {
+        sequences.emplace_back("ACGTGATGACGATACGT"_dna4, "AGTGATACTGATG"_dna4);
+        sequences.emplace_back("ACGT"_dna4, "AGTGATACT"_dna4);
+    }
+
+    configuration cfg = align_cfg::edit | align_cfg::result{with_score};
+    configuration parallel_cfg = cfg | align_cfg::parallel{4};
+
+    std::vector<int> expected_scores{};
+    for (auto && res : align_pairwise(sequences, cfg))
+        expected_scores.push_back(res.score());
+
+    size_t index = 0;
+    for (auto && res : align_pairwise(sequences, parallel_cfg))
+    {
+        ASSERT_LT(index, expected_scores.size());
+        EXPECT_EQ(res.score(), expected_scores[index]);
+        ++index;
+    }
+    EXPECT_EQ(index, expected_scores.size());
+}
@@ -0,0 +1,118 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/pairwise/execution/execution_handler_shared_pool.hpp>
+#include <seqan3/alphabet/nucleotide/all.hpp>
+#include <seqan3/core/parallel/thread_pool.hpp>
+
+using namespace seqan3;
+
+TEST(execution_handler_shared_pool, execute_and_wait)
+{
+    constexpr size_t job_count = 100;
+
+    std::vector<int> results(job_count, -1);
+
+    thread_pool pool{4};
+    detail::execution_handler_shared_pool handler{pool};
+
+    auto job = [] (std::string & first, std::string & second) -> int
+    {
+        return static_cast<int>(first.size() + second.size());
+    };
+
+    for (size_t i = 0; i < job_count; ++i)
+    {
+        std::string first(i, 'a');
+        std::string second(i, 'b');
+        int * slot = std::addressof(results[i]);
+        handler.execute(job, first, second, [slot] (int res) { *slot = res; });
+    }
+
+    handler.wait();
+
+    for (size_t i = 0; i < job_count; ++i)
+        EXPECT_EQ(results[i], static_cast<int>(2 * i));
+}
+
+TEST(execution_handler_shared_pool, two_handlers_one_pool)
+{
+    // Two handlers sharing one pool; each wait() only covers the jobs of its own handler.
+    constexpr size_t job_count = 100;
+
+    std::vector<int> first_results(job_count, -1);
+    std::vector<int> second_results(job_count, -1);
+
+    thread_pool pool{4};
+    detail::execution_handler_shared_pool first_handler{pool};
+    detail::execution_handler_shared_pool second_handler{pool};
+
+    auto job = [] (std::string & first, std::string & second) -> int
+    {
+        return static_cast<int>(first.size() + second.size());
+    };
+
+    for (size_t i = 0; i < job_count; ++i)
+    {
+        std::string sequence(i, 'a');
+        first_handler.execute(job, sequence, sequence,
+                              [slot = std::addressof(first_results[i])] (int res) { *slot = res; });
+        second_handler.execute(job, sequence, std::string{},
+                               [slot = std::addressof(second_results[i])] (int res) { *slot = res; });
+    }
+
+    first_handler.wait();
+    for (size_t i = 0; i < job_count; ++i)
+        EXPECT_EQ(first_results[i], static_cast<int>(2 * i));
+
+    second_handler.wait();
+    for (size_t i = 0; i < job_count; ++i)
+        EXPECT_EQ(second_results[i], static_cast<int>(i));
+}
+
+TEST(execution_handler_shared_pool, align_pairwise)
+{
+    std::vector<std::pair<dna4_vector, dna4_vector>> sequences{};
+    for (unsigned i = 0; i < 200u; ++i)
+    {
+        sequences.emplace_back("ACGTGATGACGATACGT"_dna4, "AGTGATACTGATG"_dna4);
+        sequences.emplace_back("ACGT"_dna4, "AGTGATACT"_dna4);
+    }
+
+    configuration cfg = align_cfg::edit | align_cfg::result{with_score};
+
+    std::vector<int> expected_scores{};
+    for (auto && res : align_pairwise(sequences, cfg))
+        expected_scores.push_back(res.score());
+
+    auto check_scores = [&] (auto const & pooled_cfg)
+    {
+        size_t index = 0;
+        for (auto && res : align_pairwise(sequences, pooled_cfg))
+        {
+            ASSERT_LT(index, expected_scores.size());
+            EXPECT_EQ(res.score(), expected_scores[index]);
+            ++index;
+        }
+        EXPECT_EQ(index, expected_scores.size());
+    };
+
+    // default constructed element: draws from the process-wide shared pool
+    check_scores(cfg | align_cfg::execution_context{});
+
+    // injected pool
+    thread_pool pool{4};
+    check_scores(cfg | align_cfg::execution_context{&pool});
+}
@@ -0,0 +1,146 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alphabet/nucleotide/all.hpp>
+
+using namespace seqan3;
+
+namespace
+{
+
+dna4_vector generate_sequence(size_t const length, size_t const seed)
+{
+    std::mt19937 engine(seed);
+    std::uniform_int_distribution<uint8_t> distribution{0, 3}; // dna4 ranks
+
+    dna4_vector sequence{};
+    sequence.reserve(length);
+    for (size_t i = 0; i < length; ++i)
+        sequence.push_back(assign_rank(dna4{}, distribution(engine)));
+
+    return sequence;
+}
+
+// Applies `count` random substitutions, insertions and deletions to a copy of the given sequence.
+dna4_vector mutate_sequence(dna4_vector sequence, size_t const count, size_t const seed)
+{
+    std::mt19937 engine(seed);
+    std::uniform_int_distribution<uint8_t> rank_distribution{0, 3};
+    std::uniform_int_distribution<uint8_t> operation_distribution{0, 2};
+
+    for (size_t i = 0; i < count && !sequence.empty(); ++i)
+    {
+        size_t const position = std::uniform_int_distribution<size_t>{0, sequence.size() - 1}(engine);
+        switch (operation_distribution(engine))
+        {
+            case 0: sequence[position] = assign_rank(dna4{}, rank_distribution(engine)); break;
+            case 1: sequence.erase(sequence.begin() + position); break;
+            default: sequence.insert(sequence.begin() + position, assign_rank(dna4{}, rank_distribution(engine)));
+        }
+    }
+    return sequence;
+}
+
+configuration base_config()
+{
+    return align_cfg::mode{global_alignment}
+         | align_cfg::scoring{nucleotide_scoring_scheme{match_score{4}, mismatch_score{-5}}}
+         | align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}};
+}
+
+template <typename config_t>
+int compute_score(dna4_vector const & first, dna4_vector const & second, config_t const & cfg)
+{
+    int score{};
+    for (auto && res : align_pairwise(std::tie(first, second), cfg))
+        score = res.score();
+    return score;
+}
+
+} // anonymous namespace
+
+TEST(global_affine_max_error, exact_within_budget)
+{
+    // An alignment of a sequence against a copy with k edits uses at most k errors, hence the score of the
+    // pruned computation must equal the unrestricted score whenever the budget covers the applied edits.
+    configuration unrestricted_cfg = base_config() | align_cfg::result{with_score};
+
+    for (size_t seed = 0; seed < 10; ++seed)
+    {
+        size_t const edit_count = seed % 4;
+        dna4_vector first = generate_sequence(150 + seed, seed);
+        dna4_vector second = mutate_sequence(first, edit_count, seed + 100);
+
+        configuration pruned_cfg = base_config()
+                                 | align_cfg::result{with_score}
+                                 | align_cfg::max_error{static_cast<uint32_t>(edit_count + 2)};
+
+        EXPECT_EQ(compute_score(first, second, pruned_cfg), compute_score(first, second, unrestricted_cfg));
+    }
+}
+
+TEST(global_affine_max_error, never_exceeds_unrestricted_score)
+{
+    // Outside of the budget the corridor reports the best alignment within it, which is a lower bound.
+    configuration unrestricted_cfg = base_config() | align_cfg::result{with_score};
+
+    for (size_t seed = 0; seed < 10; ++seed)
+    {
+        dna4_vector first = generate_sequence(100, seed);
+        dna4_vector second = generate_sequence(110, seed + 100);
+
+        configuration pruned_cfg = base_config() | align_cfg::result{with_score} | align_cfg::max_error{3u};
+
+        EXPECT_LE(compute_score(first, second, pruned_cfg), compute_score(first, second, unrestricted_cfg));
+    }
+}
+
+TEST(global_affine_max_error, zero_budget)
+{
+    // With a budget of zero only the main diagonal remains.
+    dna4_vector sequence = generate_sequence(80, 42);
+
+    configuration cfg = base_config() | align_cfg::result{with_score} | align_cfg::max_error{0u};
+
+    EXPECT_EQ(compute_score(sequence, sequence, cfg), 80 * 4);
+}
+
+TEST(global_affine_max_error, length_difference_exceeds_budget)
+{
+    // If the length difference alone exceeds the budget the corridor is widened to stay connected; the
+    // computation still terminates in the last cell and reports a valid global alignment score.
+    dna4_vector empty{};
+    dna4_vector sequence = "ACG"_dna4;
+
+    configuration cfg = base_config() | align_cfg::result{with_score} | align_cfg::max_error{1u};
+
+    EXPECT_EQ(compute_score(empty, sequence, cfg), -13); // One affine gap of length three: -10 - 3 * 1.
+    EXPECT_EQ(compute_score(sequence, empty, cfg), -13);
+    EXPECT_EQ(compute_score(empty, empty, cfg), 0);
+}
+
+TEST(global_affine_max_error, back_coordinate)
+{
+    dna4_vector first = generate_sequence(60, 7);
+    dna4_vector second = mutate_sequence(first, 2, 11);
+
+    configuration cfg = base_config() | align_cfg::result{with_back_coordinate} | align_cfg::max_error{4u};
+
+    for (auto && res : align_pairwise(std::tie(first, second), cfg))
+    {
+        EXPECT_EQ(res.back_coordinate().first, first.size());
+        EXPECT_EQ(res.back_coordinate().second, second.size());
+    }
+}
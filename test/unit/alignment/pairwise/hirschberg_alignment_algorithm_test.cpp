@@ -0,0 +1,149 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/pairwise/hirschberg_alignment_algorithm.hpp>
+#include <seqan3/alphabet/nucleotide/all.hpp>
+
+using namespace seqan3;
+
+namespace
+{
+
+dna4_vector generate_sequence(size_t const length, size_t const seed)
+{
+    std::mt19937 engine(seed);
+    std::uniform_int_distribution<uint8_t> distribution{0, 3}; // dna4 ranks
+
+    dna4_vector sequence{};
+    sequence.reserve(length);
+    for (size_t i = 0; i < length; ++i)
+        sequence.push_back(assign_rank(dna4{}, distribution(engine)));
+
+    return sequence;
+}
+
+configuration base_config()
+{
+    return align_cfg::mode{global_alignment}
+         | align_cfg::scoring{nucleotide_scoring_scheme{match_score{4}, mismatch_score{-5}}}
+         | align_cfg::gap{gap_scheme{gap_score{-1}}};
+}
+
+//!\brief Recomputes the score of a gapped alignment and checks that it projects back onto the input sequences.
+template <typename alignment_t>
+int evaluate_alignment(alignment_t const & alignment, dna4_vector const & first, dna4_vector const & second)
+{
+    auto const & [gapped_first, gapped_second] = alignment;
+    EXPECT_EQ(gapped_first.size(), gapped_second.size());
+
+    nucleotide_scoring_scheme scheme{match_score{4}, mismatch_score{-5}};
+
+    int score = 0;
+    dna4_vector first_ungapped{};
+    dna4_vector second_ungapped{};
+    for (size_t i = 0; i < gapped_first.size(); ++i)
+    {
+        bool const first_is_gap = gapped_first[i] == gap{};
+        bool const second_is_gap = gapped_second[i] == gap{};
+        EXPECT_FALSE(first_is_gap && second_is_gap);
+
+        if (!first_is_gap)
+            first_ungapped.push_back(gapped_first[i].template convert_to<dna4>());
+        if (!second_is_gap)
+            second_ungapped.push_back(gapped_second[i].template convert_to<dna4>());
+
+        if (first_is_gap || second_is_gap)
+            score += -1;
+        else
+            score += scheme.score(gapped_first[i].template convert_to<dna4>(),
+                                  gapped_second[i].template convert_to<dna4>());
+    }
+
+    EXPECT_EQ(first_ungapped, first);
+    EXPECT_EQ(second_ungapped, second);
+    return score;
+}
+
+} // anonymous namespace
+
+TEST(hirschberg_alignment_algorithm, score_matches_full_matrix)
+{
+    configuration cfg = base_config() | align_cfg::result{with_score};
+    configuration linear_cfg = cfg | align_cfg::linear_space{};
+
+    for (size_t seed = 0; seed < 10; ++seed)
+    {
+        dna4_vector first = generate_sequence(120 + seed, seed);
+        dna4_vector second = generate_sequence(100 + seed, seed + 100);
+
+        int expected{};
+        for (auto && res : align_pairwise(std::tie(first, second), cfg))
+            expected = res.score();
+
+        for (auto && res : align_pairwise(std::tie(first, second), linear_cfg))
+            EXPECT_EQ(res.score(), expected);
+    }
+}
+
+TEST(hirschberg_alignment_algorithm, alignment_is_optimal)
+{
+    configuration score_cfg = base_config() | align_cfg::result{with_score};
+    configuration alignment_cfg = base_config() | align_cfg::result{with_alignment} | align_cfg::linear_space{};
+
+    for (size_t seed = 0; seed < 10; ++seed)
+    {
+        dna4_vector first = generate_sequence(200, seed);
+        dna4_vector second = generate_sequence(190, seed + 100);
+
+        int expected{};
+        for (auto && res : align_pairwise(std::tie(first, second), score_cfg))
+            expected = res.score();
+
+        for (auto && res : align_pairwise(std::tie(first, second), alignment_cfg))
+        {
+            EXPECT_EQ(res.score(), expected);
+            EXPECT_EQ(evaluate_alignment(res.alignment(), first, second), expected);
+        }
+    }
+}
+
+TEST(hirschberg_alignment_algorithm, small_alignment)
+{
+    dna4_vector first = "ACGT"_dna4;
+    dna4_vector second = "AGT"_dna4;
+
+    configuration cfg = base_config() | align_cfg::result{with_alignment} | align_cfg::linear_space{};
+
+    for (auto && res : align_pairwise(std::tie(first, second), cfg))
+    {
+        EXPECT_EQ(res.score(), 11); // Three matches and one gap.
+        EXPECT_EQ(evaluate_alignment(res.alignment(), first, second), 11);
+    }
+}
+
+TEST(hirschberg_alignment_algorithm, affine_gaps_rejected)
+{
+    dna4_vector first = "ACGT"_dna4;
+    dna4_vector second = "AGT"_dna4;
+
+    configuration cfg = align_cfg::mode{global_alignment}
+                      | align_cfg::scoring{nucleotide_scoring_scheme{match_score{4}, mismatch_score{-5}}}
+                      | align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}}
+                      | align_cfg::result{with_score}
+                      | align_cfg::linear_space{};
+
+    EXPECT_THROW((align_pairwise(std::tie(first, second), cfg).begin()), invalid_alignment_configuration);
+}
@@ -14,8 +14,9 @@ struct check_score_mock
 {
 public:
 
-    template <typename score_t>
-    constexpr void check_score(seqan3::detail::alignment_optimum<score_t> const &,
+    template <typename score_t, typename coordinate_t>
+    constexpr void check_score(score_t const,
+                               coordinate_t const &,
                                seqan3::detail::alignment_optimum<score_t> const &) const noexcept
     {}
 };
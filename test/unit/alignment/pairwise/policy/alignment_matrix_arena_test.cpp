@@ -0,0 +1,92 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/pairwise/policy/alignment_matrix_arena.hpp>
+#include <seqan3/alphabet/nucleotide/all.hpp>
+
+using namespace seqan3;
+
+TEST(alignment_matrix_arena, acquire_and_release)
+{
+    detail::alignment_matrix_arena<std::vector<int>> arena{};
+
+    std::vector<int> buffer = arena.acquire(100);
+    EXPECT_EQ(buffer.size(), 100u);
+
+    int * const data = buffer.data();
+    arena.release(std::move(buffer));
+
+    // The released buffer is handed out again including its capacity.
+    std::vector<int> reused = arena.acquire(50);
+    EXPECT_EQ(reused.size(), 50u);
+    EXPECT_EQ(reused.data(), data);
+    EXPECT_GE(reused.capacity(), 100u);
+}
+
+TEST(alignment_matrix_arena, empty_pool)
+{
+    detail::alignment_matrix_arena<std::vector<int>> arena{};
+
+    std::vector<int> first = arena.acquire(10);
+    std::vector<int> second = arena.acquire(10);
+    EXPECT_NE(first.data(), second.data());
+}
+
+TEST(alignment_matrix_arena, per_thread_pools)
+{
+    detail::alignment_matrix_arena<std::vector<int>> arena{};
+
+    int * remote_data = nullptr;
+    std::thread releaser{[&] ()
+    {
+        std::vector<int> buffer = arena.acquire(100);
+        remote_data = buffer.data();
+        arena.release(std::move(buffer));
+    }};
+    releaser.join();
+
+    // A buffer released by another thread is not handed out; its pages would live on the wrong numa node.
+    std::vector<int> own = arena.acquire(100);
+    EXPECT_NE(own.data(), remote_data);
+}
+
+TEST(alignment_matrix_arena, align_pairwise_reuses_buffers)
+{
+    // Regression test: the policies share their matrix buffers through the arena over many invocations
+    // and over copies of the configured alignment function without affecting the results.
+    std::vector<std::pair<dna4_vector, dna4_vector>> sequences{};
+    for (unsigned i = 0; i < 50u; ++i)
+    {
+        sequences.emplace_back("ACGTGATGACGATACGT"_dna4, "AGTGATACTGATG"_dna4);
+        sequences.emplace_back("ACGT"_dna4, "AGTGATACT"_dna4);
+    }
+
+    configuration base_cfg = align_cfg::mode{global_alignment}
+                           | align_cfg::scoring{nucleotide_scoring_scheme{match_score{4}, mismatch_score{-5}}}
+                           | align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}};
+
+    std::vector<int> expected_scores{};
+    for (auto && res : align_pairwise(sequences, base_cfg | align_cfg::result{with_score}))
+        expected_scores.push_back(res.score());
+
+    size_t index = 0;
+    for (auto && res : align_pairwise(sequences, base_cfg | align_cfg::result{with_alignment}))
+    {
+        ASSERT_LT(index, expected_scores.size());
+        EXPECT_EQ(res.score(), expected_scores[index]);
+        ++index;
+    }
+    EXPECT_EQ(index, sequences.size());
+}
@@ -0,0 +1,67 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/pairwise/policy/scoring_scheme_policy.hpp>
+#include <seqan3/alphabet/nucleotide/all.hpp>
+
+using namespace seqan3;
+
+TEST(is_simple_scoring_scheme, simple_and_hamming)
+{
+    EXPECT_TRUE(detail::is_simple_scoring_scheme(nucleotide_scoring_scheme{}));
+    EXPECT_TRUE(detail::is_simple_scoring_scheme(nucleotide_scoring_scheme{match_score{4}, mismatch_score{-5}}));
+}
+
+TEST(is_simple_scoring_scheme, custom_matrix)
+{
+    nucleotide_scoring_scheme scheme{match_score{4}, mismatch_score{-5}};
+    scheme.score('T'_dna15, 'A'_dna15) = 2;
+    EXPECT_FALSE(detail::is_simple_scoring_scheme(scheme));
+
+    scheme.score('T'_dna15, 'A'_dna15) = -5;
+    EXPECT_TRUE(detail::is_simple_scoring_scheme(scheme));
+}
+
+TEST(scoring_scheme_policy, fast_path_matches_matrix_lookup)
+{
+    std::vector<std::pair<dna4_vector, dna4_vector>> sequences{};
+    sequences.emplace_back("ACGTGATGACGATACGT"_dna4, "AGTGATACTGATG"_dna4);
+    sequences.emplace_back("ACGT"_dna4, "AGTGATACT"_dna4);
+    sequences.emplace_back("TTTTTT"_dna4, "ACGTACGT"_dna4);
+
+    // The perturbed scheme falls back to the matrix lookup but scores dna4 sequences identically,
+    // because only entries involving 'N' are modified.
+    nucleotide_scoring_scheme simple_scheme{match_score{4}, mismatch_score{-5}};
+    nucleotide_scoring_scheme matrix_scheme{match_score{4}, mismatch_score{-5}};
+    matrix_scheme.score('N'_dna15, 'N'_dna15) = -1;
+    ASSERT_TRUE(detail::is_simple_scoring_scheme(simple_scheme));
+    ASSERT_FALSE(detail::is_simple_scoring_scheme(matrix_scheme));
+
+    configuration base_cfg = align_cfg::mode{global_alignment}
+                           | align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}}
+                           | align_cfg::result{with_score};
+
+    std::vector<int> matrix_scores{};
+    for (auto && res : align_pairwise(sequences, base_cfg | align_cfg::scoring{matrix_scheme}))
+        matrix_scores.push_back(res.score());
+
+    size_t index = 0;
+    for (auto && res : align_pairwise(sequences, base_cfg | align_cfg::scoring{simple_scheme}))
+    {
+        ASSERT_LT(index, matrix_scores.size());
+        EXPECT_EQ(res.score(), matrix_scores[index]);
+        ++index;
+    }
+    EXPECT_EQ(index, sequences.size());
+}
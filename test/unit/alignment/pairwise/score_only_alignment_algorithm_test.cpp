@@ -0,0 +1,131 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/pairwise/score_only_alignment_algorithm.hpp>
+#include <seqan3/alphabet/nucleotide/all.hpp>
+
+using namespace seqan3;
+
+namespace
+{
+
+dna4_vector generate_sequence(size_t const length, size_t const seed)
+{
+    std::mt19937 engine(seed);
+    std::uniform_int_distribution<uint8_t> distribution{0, 3}; // dna4 ranks
+
+    dna4_vector sequence{};
+    sequence.reserve(length);
+    for (size_t i = 0; i < length; ++i)
+        sequence.push_back(assign_rank(dna4{}, distribution(engine)));
+
+    return sequence;
+}
+
+configuration base_config()
+{
+    return align_cfg::mode{global_alignment}
+         | align_cfg::scoring{nucleotide_scoring_scheme{match_score{4}, mismatch_score{-5}}}
+         | align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}};
+}
+
+} // anonymous namespace
+
+TEST(score_only_alignment_algorithm, matches_policy_algorithm)
+{
+    // The score-only configuration dispatches to the stripped kernel; requesting the back coordinate uses the
+    // policy-based algorithm on the same matrix, hence both must report the same score.
+    configuration score_cfg = base_config() | align_cfg::result{with_score};
+    configuration coordinate_cfg = base_config() | align_cfg::result{with_back_coordinate};
+
+    for (size_t seed = 0; seed < 10; ++seed)
+    {
+        dna4_vector first = generate_sequence(120 + seed, seed);
+        dna4_vector second = generate_sequence(100 + seed, seed + 100);
+
+        int expected{};
+        for (auto && res : align_pairwise(std::tie(first, second), coordinate_cfg))
+            expected = res.score();
+
+        for (auto && res : align_pairwise(std::tie(first, second), score_cfg))
+            EXPECT_EQ(res.score(), expected);
+    }
+}
+
+TEST(score_only_alignment_algorithm, linear_gap_costs)
+{
+    configuration score_cfg = align_cfg::mode{global_alignment}
+                            | align_cfg::scoring{nucleotide_scoring_scheme{match_score{4}, mismatch_score{-5}}}
+                            | align_cfg::gap{gap_scheme{gap_score{-1}}}
+                            | align_cfg::result{with_score};
+    configuration coordinate_cfg = align_cfg::mode{global_alignment}
+                                 | align_cfg::scoring{nucleotide_scoring_scheme{match_score{4}, mismatch_score{-5}}}
+                                 | align_cfg::gap{gap_scheme{gap_score{-1}}}
+                                 | align_cfg::result{with_back_coordinate};
+
+    for (size_t seed = 0; seed < 5; ++seed)
+    {
+        dna4_vector first = generate_sequence(80, seed);
+        dna4_vector second = generate_sequence(90, seed + 100);
+
+        int expected{};
+        for (auto && res : align_pairwise(std::tie(first, second), coordinate_cfg))
+            expected = res.score();
+
+        for (auto && res : align_pairwise(std::tie(first, second), score_cfg))
+            EXPECT_EQ(res.score(), expected);
+    }
+}
+
+TEST(score_only_alignment_algorithm, small_alignment)
+{
+    dna4_vector first = "ACGT"_dna4;
+    dna4_vector second = "AGT"_dna4;
+
+    configuration cfg = base_config() | align_cfg::result{with_score};
+
+    for (auto && res : align_pairwise(std::tie(first, second), cfg))
+        EXPECT_EQ(res.score(), 1); // Three matches and one affine gap: 3 * 4 - 10 - 1.
+}
+
+TEST(score_only_alignment_algorithm, empty_sequences)
+{
+    dna4_vector empty{};
+    dna4_vector sequence = "ACG"_dna4;
+
+    configuration cfg = base_config() | align_cfg::result{with_score};
+
+    for (auto && res : align_pairwise(std::tie(empty, sequence), cfg))
+        EXPECT_EQ(res.score(), -13); // One affine gap of length three: -10 - 3 * 1.
+
+    for (auto && res : align_pairwise(std::tie(sequence, empty), cfg))
+        EXPECT_EQ(res.score(), -13);
+
+    for (auto && res : align_pairwise(std::tie(empty, empty), cfg))
+        EXPECT_EQ(res.score(), 0);
+}
+
+TEST(score_only_alignment_algorithm, direct_invocation)
+{
+    dna4_vector first = "ACGTACGT"_dna4;
+    dna4_vector second = "ACGTTACGT"_dna4;
+
+    auto cfg = base_config() | align_cfg::result{with_score};
+    detail::score_only_alignment_algorithm<decltype(cfg)> algorithm{cfg};
+
+    // One pair of sequences after another reuses the rolling vectors of the kernel.
+    EXPECT_EQ(algorithm(first, second).score(), 8 * 4 - 10 - 1);
+    EXPECT_EQ(algorithm(first, first).score(), 8 * 4);
+}
@@ -0,0 +1,111 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/all.hpp>
+
+using namespace seqan3;
+
+TEST(simd_alignment_algorithm, single_pair)
+{
+    auto seq1 = "ACGTGATG"_dna4;
+    auto seq2 = "AGTGATACT"_dna4;
+
+    configuration cfg = align_cfg::mode{global_alignment} |
+                        align_cfg::scoring{nucleotide_scoring_scheme{match_score{4}, mismatch_score{-5}}} |
+                        align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}} |
+                        align_cfg::vectorise{};
+
+    auto results = align_pairwise(std::tie(seq1, seq2), cfg);
+    ASSERT_EQ(results.size(), 1u);
+
+    // Compare with the scalar algorithm.
+    configuration scalar_cfg = align_cfg::mode{global_alignment} |
+                               align_cfg::scoring{nucleotide_scoring_scheme{match_score{4}, mismatch_score{-5}}} |
+                               align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}};
+
+    for (auto && res : align_pairwise(std::tie(seq1, seq2), scalar_cfg))
+        EXPECT_EQ(results[0].score(), res.score());
+}
+
+TEST(simd_alignment_algorithm, saturation_escalation)
+{
+    // Long pairs whose scores exceed the 8-bit range force the escalation to a wider score type,
+    // while the short pairs in the same batch stay in the fast 8-bit computation.
+    dna4_vector const chunk1 = "ACGTGATGAC"_dna4;
+    dna4_vector const chunk2 = "ACGTGTTGAC"_dna4;
+    dna4_vector long_seq1{};
+    dna4_vector long_seq2{};
+    for (unsigned i = 0; i < 30u; ++i)
+    {
+        long_seq1.insert(long_seq1.end(), chunk1.begin(), chunk1.end());
+        long_seq2.insert(long_seq2.end(), chunk2.begin(), chunk2.end());
+    }
+
+    std::vector<std::pair<dna4_vector, dna4_vector>> sequences{};
+    for (unsigned i = 0; i < 10u; ++i)
+    {
+        sequences.emplace_back(long_seq1, long_seq2);
+        sequences.emplace_back("ACGT"_dna4, "AGTGATACT"_dna4);
+        sequences.emplace_back(long_seq1, "AGTGATACT"_dna4);  // Saturates through the gap costs.
+    }
+
+    configuration cfg = align_cfg::mode{global_alignment} |
+                        align_cfg::scoring{nucleotide_scoring_scheme{match_score{4}, mismatch_score{-5}}} |
+                        align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}} |
+                        align_cfg::vectorise{};
+
+    configuration scalar_cfg = align_cfg::mode{global_alignment} |
+                               align_cfg::scoring{nucleotide_scoring_scheme{match_score{4}, mismatch_score{-5}}} |
+                               align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}};
+
+    auto results = align_pairwise(sequences, cfg);
+    ASSERT_EQ(results.size(), sequences.size());
+
+    size_t index = 0;
+    for (auto && res : align_pairwise(sequences, scalar_cfg))
+    {
+        EXPECT_EQ(results[index].score(), res.score());
+        ++index;
+    }
+}
+
+TEST(simd_alignment_algorithm, batch_of_pairs)
+{
+    std::vector<std::pair<dna4_vector, dna4_vector>> sequences{};
+    for (unsigned i = 0; i < 100u; ++i)  // More pairs than simd lanes to test multiple batches.
+    {
+        sequences.emplace_back("ACGTGATGACGATACGT"_dna4, "AGTGATACTGATG"_dna4);
+        sequences.emplace_back("ACGT"_dna4, "AGTGATACT"_dna4);
+    }
+
+    configuration cfg = align_cfg::mode{global_alignment} |
+                        align_cfg::scoring{nucleotide_scoring_scheme{match_score{4}, mismatch_score{-5}}} |
+                        align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}} |
+                        align_cfg::vectorise{};
+
+    configuration scalar_cfg = align_cfg::mode{global_alignment} |
+                               align_cfg::scoring{nucleotide_scoring_scheme{match_score{4}, mismatch_score{-5}}} |
+                               align_cfg::gap{gap_scheme{gap_score{-1}, gap_open_score{-10}}};
+
+    auto results = align_pairwise(sequences, cfg);
+    ASSERT_EQ(results.size(), sequences.size());
+
+    size_t index = 0;
+    for (auto && res : align_pairwise(sequences, scalar_cfg))
+    {
+        EXPECT_EQ(results[index].score(), res.score());
+        ++index;
+    }
+}
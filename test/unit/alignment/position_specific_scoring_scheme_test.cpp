@@ -0,0 +1,86 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/position_specific_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/scoring_scheme_concept.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+
+using namespace seqan3;
+
+TEST(position_specific_scoring_scheme, concept_check)
+{
+    // The first "letter" of a profile alignment is the unsigned profile position.
+    EXPECT_TRUE((scoring_scheme_concept<position_specific_scoring_scheme<dna4>, uint32_t, dna4>));
+    EXPECT_TRUE((scoring_scheme_concept<position_specific_scoring_scheme<aa27, int32_t>, uint32_t, aa27>));
+    EXPECT_FALSE((scoring_scheme_concept<position_specific_scoring_scheme<dna4>, dna4, dna4>));
+}
+
+TEST(position_specific_scoring_scheme, from_profile)
+{
+//! [usage]
+    // One score vector per profile position; the rank order of the alphabet determines the vector layout.
+    std::vector<std::array<int8_t, 4>> profile{{4, -5, -5, -5},   // consensus A
+                                               {-5, 4, 0, -5},    // consensus C (G tolerated)
+                                               {-5, -5, -5, 4}};  // consensus T
+
+    position_specific_scoring_scheme<dna4> scheme{profile};
+
+    EXPECT_EQ(scheme.size(), 3u);
+    EXPECT_EQ(scheme.score(0u, 'A'_dna4), 4);
+    EXPECT_EQ(scheme.score(1u, 'G'_dna4), 0);
+    EXPECT_EQ(scheme.score(2u, 'A'_dna4), -5);
+//! [usage]
+}
+
+TEST(position_specific_scoring_scheme, from_sequence)
+{
+    auto sequence = "ACGT"_dna4;
+    nucleotide_scoring_scheme base_scheme{match_score{4}, mismatch_score{-5}};
+
+    position_specific_scoring_scheme scheme{sequence, base_scheme};
+
+    EXPECT_EQ(scheme.size(), 4u);
+    for (uint32_t position = 0; position < scheme.size(); ++position)
+    {
+        for (dna4 const letter : {'A'_dna4, 'C'_dna4, 'G'_dna4, 'T'_dna4})
+            EXPECT_EQ(scheme.score(position, letter), base_scheme.score(sequence[position], letter));
+    }
+}
+
+TEST(position_specific_scoring_scheme, column_layout)
+{
+    // The score vectors are padded to the next power of two of the alphabet size.
+    EXPECT_EQ((position_specific_scoring_scheme<dna4>::column_stride), 4u);
+    EXPECT_EQ((position_specific_scoring_scheme<aa27>::column_stride), 32u);
+
+    std::vector<std::array<int8_t, 4>> profile{{1, 2, 3, 4}, {5, 6, 7, 8}};
+    position_specific_scoring_scheme<dna4> scheme{profile};
+
+    // Consecutive positions lie exactly one stride apart in one contiguous buffer.
+    EXPECT_EQ(scheme.profile_column_data(1) - scheme.profile_column_data(0),
+              static_cast<std::ptrdiff_t>(position_specific_scoring_scheme<dna4>::column_stride));
+    EXPECT_EQ(scheme.profile_column_data(0)[3], 4);
+    EXPECT_EQ(scheme.profile_column_data(1)[0], 5);
+}
+
+TEST(position_specific_scoring_scheme, comparison)
+{
+    std::vector<std::array<int8_t, 4>> profile{{1, 2, 3, 4}};
+    position_specific_scoring_scheme<dna4> scheme1{profile};
+    position_specific_scoring_scheme<dna4> scheme2{profile};
+    position_specific_scoring_scheme<dna4> scheme3{};
+
+    EXPECT_TRUE(scheme1 == scheme2);
+    EXPECT_TRUE(scheme1 != scheme3);
+}
@@ -382,3 +382,21 @@ TYPED_TEST(aminoacid, similarity_matrix)
     EXPECT_EQ(10,    scheme.score('D'_aa27, 'D'_aa27));
     EXPECT_EQ(-3,    scheme.score('N'_aa27, 'A'_aa27));
 }
+
+TEST(aminoacid_scoring_scheme, reduced_alphabet)
+{
+    aminoacid_scoring_scheme<int8_t, aa10murphy> scheme{aminoacid_similarity_matrix::BLOSUM62};
+    aminoacid_scoring_scheme full_scheme{aminoacid_similarity_matrix::BLOSUM62};
+
+    EXPECT_EQ(scheme.matrix_size, alphabet_size_v<aa10murphy>);
+
+    // reduced letters score what their representative letters score in the full matrix
+    EXPECT_EQ(scheme.score('A'_aa10murphy, 'A'_aa10murphy), full_scheme.score('A'_aa27, 'A'_aa27));
+    EXPECT_EQ(scheme.score('B'_aa10murphy, 'K'_aa10murphy), full_scheme.score('B'_aa27, 'K'_aa27));
+    EXPECT_EQ(scheme.score('I'_aa10murphy, 'F'_aa10murphy), full_scheme.score('I'_aa27, 'F'_aa27));
+
+    // letters of the full alphabet are folded into their class on-the-fly
+    EXPECT_EQ(scheme.score('L'_aa27, 'V'_aa27), full_scheme.score('I'_aa27, 'I'_aa27));
+    EXPECT_EQ(scheme.score('D'_aa27, 'E'_aa27), full_scheme.score('B'_aa27, 'B'_aa27));
+    EXPECT_EQ(scheme.score('W'_aa27, 'Y'_aa27), full_scheme.score('F'_aa27, 'F'_aa27));
+}
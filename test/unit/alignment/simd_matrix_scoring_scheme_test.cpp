@@ -0,0 +1,84 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/simd_matrix_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna15.hpp>
+#include <seqan3/core/simd/simd.hpp>
+
+using namespace seqan3;
+
+using simd_t = simd_type_t<int8_t>;
+
+TEST(simd_matrix_scoring_scheme, score_row_dna15)
+{
+    nucleotide_scoring_scheme scheme{match_score{4}, mismatch_score{-5}};
+    detail::simd_matrix_scoring_scheme<simd_t, dna15> simd_scheme{scheme};
+
+    constexpr size_t length = simd_traits<simd_t>::length;
+
+    // one row at a time: every lane must match the scalar matrix lookup
+    for (size_t rank1 = 0; rank1 < alphabet_size_v<dna15>; ++rank1)
+    {
+        simd_t ranks2{};
+        for (size_t lane = 0; lane < length; ++lane)
+            ranks2[lane] = static_cast<int8_t>((lane * 7 + rank1) % alphabet_size_v<dna15>);
+
+        simd_t const scores = simd_scheme.score_row(rank1, ranks2);
+
+        for (size_t lane = 0; lane < length; ++lane)
+        {
+            int8_t const expected = scheme.score(assign_rank(dna15{}, rank1),
+                                                 assign_rank(dna15{}, ranks2[lane]));
+            EXPECT_EQ(scores[lane], expected) << "rank1: " << rank1 << " lane: " << lane;
+        }
+    }
+}
+
+TEST(simd_matrix_scoring_scheme, score_both_varying)
+{
+    nucleotide_scoring_scheme scheme{match_score{2}, mismatch_score{-3}};
+    detail::simd_matrix_scoring_scheme<simd_t, dna15> simd_scheme{scheme};
+
+    constexpr size_t length = simd_traits<simd_t>::length;
+
+    simd_t ranks1{};
+    simd_t ranks2{};
+    for (size_t lane = 0; lane < length; ++lane)
+    {
+        ranks1[lane] = static_cast<int8_t>((lane * 3 + 1) % alphabet_size_v<dna15>);
+        ranks2[lane] = static_cast<int8_t>((lane * 5 + 2) % alphabet_size_v<dna15>);
+    }
+
+    simd_t const scores = simd_scheme.score(ranks1, ranks2);
+
+    for (size_t lane = 0; lane < length; ++lane)
+    {
+        int8_t const expected = scheme.score(assign_rank(dna15{}, ranks1[lane]),
+                                             assign_rank(dna15{}, ranks2[lane]));
+        EXPECT_EQ(scores[lane], expected) << "lane: " << lane;
+    }
+}
+
+TEST(simd_matrix_scoring_scheme, custom_matrix)
+{
+    // an edited matrix must be reflected, not just match/mismatch schemes
+    nucleotide_scoring_scheme scheme{match_score{1}, mismatch_score{-1}};
+    scheme.score('A'_dna15, 'N'_dna15) = 0;
+    scheme.score('N'_dna15, 'A'_dna15) = 0;
+
+    detail::simd_matrix_scoring_scheme<simd_t, dna15> simd_scheme{scheme};
+
+    simd_t const ranks2 = fill<simd_t>(to_rank('N'_dna15));
+    simd_t const scores = simd_scheme.score_row(to_rank('A'_dna15), ranks2);
+
+    for (size_t lane = 0; lane < simd_traits<simd_t>::length; ++lane)
+        EXPECT_EQ(scores[lane], 0);
+}
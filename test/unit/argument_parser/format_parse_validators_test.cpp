@@ -778,3 +778,56 @@ TEST(validator_test, chaining_validators)
         EXPECT_EQ(option_list_value[0], "/absolute/path/file.sa");
     }
 }
+
+//!\brief A validator that counts how often it was invoked (used to test deferred invocation).
+struct counting_validator
+{
+    using value_type = std::string;
+
+    void operator()(std::string const &) const
+    {
+        ++(*runs);
+    }
+
+    std::string get_help_page_message() const
+    {
+        return "";
+    }
+
+    unsigned * runs;
+};
+
+TEST(validator_test, deferred_invocation)
+{
+    // validators only run after the complete command line was parsed successfully,
+    // so a parsing error is reported instead of a validation failure
+    {
+        std::string option_value{};
+        unsigned validator_runs{0u};
+
+        const char * argv[] = {"./argument_parser_test", "-s", "value", "surplus_argument"};
+        argument_parser parser("test_parser", 4, argv);
+        parser.add_option(option_value, 's', "string-option", "desc",
+                          option_spec::DEFAULT, counting_validator{&validator_runs});
+
+        EXPECT_THROW(parser.parse(), too_many_arguments);
+        EXPECT_EQ(validator_runs, 0u);
+    }
+
+    // on a well-formed command line the validator runs exactly once
+    {
+        std::string option_value{};
+        unsigned validator_runs{0u};
+
+        const char * argv[] = {"./argument_parser_test", "-s", "value"};
+        argument_parser parser("test_parser", 3, argv);
+        parser.add_option(option_value, 's', "string-option", "desc",
+                          option_spec::DEFAULT, counting_validator{&validator_runs});
+
+        testing::internal::CaptureStderr();
+        EXPECT_NO_THROW(parser.parse());
+        EXPECT_TRUE((testing::internal::GetCapturedStderr()).empty());
+        EXPECT_EQ(option_value, "value");
+        EXPECT_EQ(validator_runs, 1u);
+    }
+}
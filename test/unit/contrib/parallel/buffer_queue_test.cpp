@@ -0,0 +1,122 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <atomic>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <seqan3/contrib/parallel/buffer_queue.hpp>
+
+using namespace seqan3;
+
+TEST(buffer_queue, single_threaded)
+{
+    contrib::buffer_queue<int> queue{2};
+    EXPECT_EQ(queue.capacity(), 2u);
+
+    int value = -1;
+    EXPECT_TRUE(queue.try_pop(value) == contrib::queue_op_status::empty);
+    EXPECT_TRUE(queue.try_push(1) == contrib::queue_op_status::success);
+    EXPECT_TRUE(queue.try_push(2) == contrib::queue_op_status::success);
+    EXPECT_TRUE(queue.try_push(3) == contrib::queue_op_status::full);
+    EXPECT_EQ(queue.size(), 2u);
+
+    EXPECT_TRUE(queue.try_pop(value) == contrib::queue_op_status::success);
+    EXPECT_EQ(value, 1);
+
+    // close(): pushes fail, pops drain the remaining elements first
+    queue.close();
+    EXPECT_TRUE(queue.is_closed());
+    EXPECT_TRUE(queue.try_push(4) == contrib::queue_op_status::closed);
+    EXPECT_TRUE(queue.wait_pop(value) == contrib::queue_op_status::success);
+    EXPECT_EQ(value, 2);
+    EXPECT_TRUE(queue.wait_pop(value) == contrib::queue_op_status::closed);
+}
+
+TEST(buffer_queue, bulk)
+{
+    contrib::buffer_queue<int> queue{4};
+
+    std::vector<int> input{1, 2, 3, 4};
+    EXPECT_TRUE(queue.wait_push(input.begin(), input.end()) == contrib::queue_op_status::success);
+
+    std::vector<int> output{};
+    EXPECT_EQ(queue.wait_pop(std::back_inserter(output), 10), 4u);
+    EXPECT_EQ(output, input);
+}
+
+TEST(buffer_queue, wait_push_blocks_when_full)
+{
+    contrib::buffer_queue<int> queue{1};
+    EXPECT_TRUE(queue.try_push(1) == contrib::queue_op_status::success);
+
+    // the pusher blocks until the consumer thread pops the first element
+    std::thread consumer{[&] ()
+    {
+        int value = -1;
+        EXPECT_TRUE(queue.wait_pop(value) == contrib::queue_op_status::success);
+        EXPECT_EQ(value, 1);
+        EXPECT_TRUE(queue.wait_pop(value) == contrib::queue_op_status::success);
+        EXPECT_EQ(value, 2);
+    }};
+
+    EXPECT_TRUE(queue.wait_push(2) == contrib::queue_op_status::success);
+    consumer.join();
+}
+
+TEST(buffer_queue, mpmc)
+{
+    // 4 producers and 4 consumers hammer a deliberately small queue; every value must arrive exactly once
+    constexpr size_t producer_count = 4;
+    constexpr size_t consumer_count = 4;
+    constexpr size_t value_count = 10000;
+
+    contrib::buffer_queue<size_t> queue{7};
+    std::atomic<size_t> sum{0};
+    std::atomic<size_t> popped{0};
+
+    std::vector<std::thread> producers{};
+    for (size_t p = 0; p < producer_count; ++p)
+    {
+        producers.emplace_back([&, p] ()
+        {
+            for (size_t value = p; value < value_count; value += producer_count)
+                EXPECT_TRUE(queue.wait_push(value) == contrib::queue_op_status::success);
+        });
+    }
+
+    std::vector<std::thread> consumers{};
+    for (size_t c = 0; c < consumer_count; ++c)
+    {
+        consumers.emplace_back([&] ()
+        {
+            std::array<size_t, 8> buffer{};
+            for (;;)
+            {
+                size_t const count = queue.wait_pop(buffer.begin(), buffer.size());
+                if (count == 0) // closed and drained
+                    return;
+
+                for (size_t i = 0; i < count; ++i)
+                    sum += buffer[i];
+                popped += count;
+            }
+        });
+    }
+
+    for (auto & producer : producers)
+        producer.join();
+    queue.close();
+    for (auto & consumer : consumers)
+        consumer.join();
+
+    EXPECT_EQ(popped, value_count);
+    EXPECT_EQ(sum, value_count * (value_count - 1) / 2);
+}
@@ -0,0 +1,136 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <map>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <seqan3/contrib/parallel/sharded_hash_map.hpp>
+
+using namespace seqan3;
+
+TEST(sharded_hash_map, basic_operations)
+{
+    contrib::sharded_hash_map<uint64_t, uint64_t> map{};
+
+    EXPECT_TRUE(map.empty());
+    EXPECT_TRUE(map.insert(5, 100));
+    EXPECT_FALSE(map.insert(5, 200)); // already present, value untouched
+    EXPECT_EQ(map.find(5), 100u);
+    EXPECT_FALSE(map.find(6).has_value());
+    EXPECT_TRUE(map.contains(5));
+
+    map.insert_or_assign(5, 200);
+    EXPECT_EQ(map.find(5), 200u);
+
+    EXPECT_EQ(map.increment(7), 1u);
+    EXPECT_EQ(map.increment(7), 2u);
+    EXPECT_EQ(map.increment(7, 10), 12u);
+
+    EXPECT_EQ(map.upsert(8, 3, [] (uint64_t & v) { v *= 2; }), 3u); // inserted
+    EXPECT_EQ(map.upsert(8, 3, [] (uint64_t & v) { v *= 2; }), 6u); // updated
+
+    EXPECT_EQ(map.size(), 3u);
+    EXPECT_TRUE(map.erase(5));
+    EXPECT_FALSE(map.erase(5));
+    EXPECT_EQ(map.size(), 2u);
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+}
+
+TEST(sharded_hash_map, agrees_with_std_map_through_rehashes)
+{
+    contrib::sharded_hash_map<uint64_t, uint64_t> map{0, 4}; // few shards → long probe chains
+    std::map<uint64_t, uint64_t> ref{};
+    std::mt19937_64 rng{42};
+
+    for (int step = 0; step < 50'000; ++step)
+    {
+        uint64_t const key = rng() % 2'000;
+        switch (rng() % 4)
+        {
+            case 0:
+                EXPECT_EQ(map.increment(key), ++ref[key]);
+                break;
+            case 1:
+                EXPECT_EQ(map.insert(key, 1), ref.emplace(key, 1).second);
+                break;
+            case 2:
+                EXPECT_EQ(map.erase(key), ref.erase(key) > 0);
+                break;
+            case 3:
+            {
+                auto const it = ref.find(key);
+                auto const found = map.find(key);
+                EXPECT_EQ(found.has_value(), it != ref.end());
+                if (found.has_value())
+                    EXPECT_EQ(*found, it->second);
+                break;
+            }
+        }
+    }
+
+    EXPECT_EQ(map.size(), ref.size());
+
+    std::map<uint64_t, uint64_t> collected{};
+    map.for_each([&] (uint64_t const key, uint64_t const & value) { collected[key] = value; });
+    EXPECT_EQ(collected, ref);
+}
+
+TEST(sharded_hash_map, concurrent_counting)
+{
+    contrib::sharded_hash_map<uint64_t, uint64_t> map{};
+    size_t const thread_count = 4, increments_per_thread = 100'000, keyspace = 5'000;
+
+    std::vector<std::thread> threads{};
+    for (size_t t = 0; t < thread_count; ++t)
+    {
+        threads.emplace_back([&, t] ()
+        {
+            std::mt19937_64 rng{t};
+            for (size_t i = 0; i < increments_per_thread; ++i)
+                map.increment(rng() % keyspace);
+        });
+    }
+    for (std::thread & thread : threads)
+        thread.join();
+
+    uint64_t total = 0;
+    map.for_each([&] (uint64_t, uint64_t const & count) { total += count; });
+    EXPECT_EQ(total, thread_count * increments_per_thread); // no increment was lost
+    EXPECT_LE(map.size(), keyspace);
+}
+
+TEST(sharded_hash_map, concurrent_deduplication)
+{
+    contrib::sharded_hash_map<uint64_t, uint64_t> map{1 << 16};
+    size_t const thread_count = 4, key_count = 20'000;
+
+    std::vector<size_t> claims(thread_count, 0);
+    std::vector<std::thread> threads{};
+    for (size_t t = 0; t < thread_count; ++t)
+    {
+        threads.emplace_back([&, t] ()
+        {
+            for (uint64_t key = 0; key < key_count; ++key)
+                if (map.insert(key, t))
+                    ++claims[t];
+        });
+    }
+    for (std::thread & thread : threads)
+        thread.join();
+
+    size_t total_claims = 0;
+    for (size_t const c : claims)
+        total_claims += c;
+    EXPECT_EQ(total_claims, key_count); // every key was claimed by exactly one thread
+    EXPECT_EQ(map.size(), key_count);
+}
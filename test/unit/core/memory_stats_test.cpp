@@ -0,0 +1,78 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#define SEQAN3_ENABLE_MEMORY_STATS 1
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include <seqan3/core/memory_stats.hpp>
+
+using namespace seqan3;
+
+TEST(memory_stats, enabled_flag)
+{
+    EXPECT_TRUE(memory_stats::enabled);
+}
+
+TEST(memory_stats, subsystem_names)
+{
+    EXPECT_EQ(memory_stats::name(memory_stats::subsystem::dp_matrix), "dp_matrix");
+    EXPECT_EQ(memory_stats::name(memory_stats::subsystem::trace_matrix), "trace_matrix");
+    EXPECT_EQ(memory_stats::name(memory_stats::subsystem::index), "index");
+    EXPECT_EQ(memory_stats::name(memory_stats::subsystem::io_record), "io_record");
+}
+
+TEST(memory_stats, record_and_snapshot)
+{
+    memory_stats::reset();
+
+    detail::record_memory_use(memory_stats::subsystem::dp_matrix, 100);
+    detail::record_memory_use(memory_stats::subsystem::dp_matrix, 200);
+    detail::record_memory_use(memory_stats::subsystem::index, 4096);
+
+    memory_stats::counters const dp = memory_stats::snapshot(memory_stats::subsystem::dp_matrix);
+    EXPECT_EQ(dp.bytes, 300u);
+    EXPECT_EQ(dp.count, 2u);
+
+    auto const all = memory_stats::snapshot();
+    EXPECT_EQ(all[static_cast<size_t>(memory_stats::subsystem::index)].bytes, 4096u);
+    EXPECT_EQ(all[static_cast<size_t>(memory_stats::subsystem::io_record)].count, 0u);
+}
+
+TEST(memory_stats, concurrent_recording)
+{
+    memory_stats::reset();
+
+    std::vector<std::thread> threads{};
+    for (size_t i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([] ()
+        {
+            for (size_t j = 0; j < 1000; ++j)
+                detail::record_memory_use(memory_stats::subsystem::trace_matrix, 8);
+        });
+    }
+    for (std::thread & thread : threads)
+        thread.join();
+
+    memory_stats::counters const trace = memory_stats::snapshot(memory_stats::subsystem::trace_matrix);
+    EXPECT_EQ(trace.count, 4000u);
+    EXPECT_EQ(trace.bytes, 32000u);
+}
+
+TEST(memory_stats, reset)
+{
+    detail::record_memory_use(memory_stats::subsystem::io_record, 42);
+    memory_stats::reset();
+
+    memory_stats::counters const io = memory_stats::snapshot(memory_stats::subsystem::io_record);
+    EXPECT_EQ(io.bytes, 0u);
+    EXPECT_EQ(io.count, 0u);
+}
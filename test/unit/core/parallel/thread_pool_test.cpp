@@ -0,0 +1,93 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <numeric>
+#include <vector>
+
+#include <seqan3/core/parallel/thread_pool.hpp>
+
+using namespace seqan3;
+
+TEST(thread_pool, thread_count)
+{
+    thread_pool pool{4};
+    EXPECT_EQ(pool.thread_count(), 4u);
+
+    thread_pool single{0}; // 0 is treated as 1
+    EXPECT_EQ(single.thread_count(), 1u);
+}
+
+TEST(thread_pool, submit)
+{
+    constexpr size_t task_count = 1000;
+
+    std::atomic<size_t> sum{0};
+    {
+        thread_pool pool{4};
+        for (size_t i = 1; i <= task_count; ++i)
+            pool.submit([&sum, i] () { sum += i; });
+    } // the destructor executes all submitted tasks before the workers terminate
+
+    EXPECT_EQ(sum.load(), task_count * (task_count + 1) / 2);
+}
+
+TEST(thread_pool, client_side_wait)
+{
+    // Clients wait for their own tasks through state captured in the submitted closures.
+    constexpr size_t task_count = 64;
+
+    thread_pool pool{4};
+    std::vector<int> results(task_count, 0);
+    std::mutex mutex{};
+    std::condition_variable tasks_done{};
+    size_t remaining{task_count};
+
+    for (size_t i = 0; i < task_count; ++i)
+    {
+        pool.submit([&, i] ()
+        {
+            results[i] = static_cast<int>(i) * 3;
+
+            std::unique_lock<std::mutex> lock{mutex};
+            if (--remaining == 0)
+                tasks_done.notify_all();
+        });
+    }
+
+    std::unique_lock<std::mutex> lock{mutex};
+    tasks_done.wait(lock, [&] { return remaining == 0; });
+
+    for (size_t i = 0; i < task_count; ++i)
+        EXPECT_EQ(results[i], static_cast<int>(i) * 3);
+}
+
+TEST(thread_pool, pinned)
+{
+    // The pinning is best-effort; the tasks must run correctly either way.
+    std::atomic<size_t> counter{0};
+    {
+        thread_pool pool{2, std::vector<unsigned>{0}};
+        for (size_t i = 0; i < 100; ++i)
+            pool.submit([&counter] () { ++counter; });
+    }
+    EXPECT_EQ(counter.load(), 100u);
+}
+
+TEST(thread_pool, shared)
+{
+    thread_pool & pool = thread_pool::shared();
+    EXPECT_GE(pool.thread_count(), 1u);
+    EXPECT_EQ(std::addressof(thread_pool::shared()), std::addressof(pool));
+
+    // Once the shared pool exists it cannot be reconfigured anymore.
+    EXPECT_THROW(thread_pool::configure_shared(2), std::logic_error);
+}
@@ -0,0 +1,98 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <seqan3/core/radix_sort.hpp>
+
+using namespace seqan3;
+
+template <typename value_t, typename generator_t>
+void expect_sorts_like_std_sort(size_t const size, generator_t generate, thread_pool * pool = nullptr)
+{
+    std::vector<value_t> values(size);
+    for (auto & value : values)
+        value = generate();
+
+    std::vector<value_t> expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    if (pool != nullptr)
+        detail::radix_sort(values, *pool);
+    else
+        detail::radix_sort(values);
+
+    EXPECT_EQ(values, expected);
+}
+
+TEST(radix_sort, unsigned_integers)
+{
+    std::mt19937_64 rng{42};
+
+    for (size_t size : {0u, 1u, 2u, 100u, 2'047u, 2'048u, 100'000u}) // crosses the std::sort fallback threshold
+    {
+        expect_sorts_like_std_sort<uint64_t>(size, [&] () { return rng(); });
+        expect_sorts_like_std_sort<uint64_t>(size, [&] () { return rng() & 0xFFFFu; }); // constant high bytes
+        expect_sorts_like_std_sort<uint64_t>(size, [&] () { return uint64_t{7u}; });    // all equal
+        expect_sorts_like_std_sort<uint32_t>(size, [&] () { return static_cast<uint32_t>(rng()); });
+        expect_sorts_like_std_sort<uint8_t>(size, [&] () { return static_cast<uint8_t>(rng()); });
+    }
+}
+
+TEST(radix_sort, pairs_sort_lexicographically)
+{
+    std::mt19937_64 rng{42};
+
+    for (size_t size : {0u, 100u, 100'000u})
+    {
+        // duplicate-heavy first components exercise the tie-break on the second component
+        expect_sorts_like_std_sort<std::pair<uint64_t, uint64_t>>(size, [&] ()
+        {
+            return std::pair<uint64_t, uint64_t>{rng() & 0xFu, rng() & 0xFFu};
+        });
+        expect_sorts_like_std_sort<std::pair<uint32_t, uint64_t>>(size, [&] ()
+        {
+            return std::pair<uint32_t, uint64_t>{static_cast<uint32_t>(rng()), rng()};
+        });
+    }
+}
+
+TEST(radix_sort, adversarial_orders)
+{
+    std::vector<uint64_t> descending(100'000);
+    for (size_t i = 0; i < descending.size(); ++i)
+        descending[i] = descending.size() - i;
+
+    std::vector<uint64_t> expected = descending;
+    std::sort(expected.begin(), expected.end());
+
+    detail::radix_sort(descending);
+    EXPECT_EQ(descending, expected);
+
+    detail::radix_sort(descending); // sorting sorted input is a no-op
+    EXPECT_EQ(descending, expected);
+}
+
+TEST(radix_sort, parallel)
+{
+    std::mt19937_64 rng{42};
+    thread_pool pool{4};
+
+    for (size_t size : {0u, 100u, 100'000u, 1'000'000u}) // small sizes take the sequential shortcut
+    {
+        expect_sorts_like_std_sort<uint64_t>(size, [&] () { return rng(); }, &pool);
+        expect_sorts_like_std_sort<std::pair<uint64_t, uint64_t>>(size, [&] ()
+        {
+            return std::pair<uint64_t, uint64_t>{rng() & 0xFu, rng() & 0xFFu};
+        }, &pool);
+    }
+}
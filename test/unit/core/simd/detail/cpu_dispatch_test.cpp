@@ -0,0 +1,38 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/core/simd/detail/cpu_dispatch.hpp>
+
+using namespace seqan3;
+
+TEST(cpu_dispatch, max_simd_width_at_runtime)
+{
+    size_t const width = detail::max_simd_width_at_runtime();
+    EXPECT_TRUE(width == 1u || width == 16u || width == 32u || width == 64u);
+    EXPECT_EQ(width, detail::max_simd_width_at_runtime()); // cached, stable
+}
+
+TEST(cpu_dispatch, selects_compile_and_runtime_minimum)
+{
+    size_t const selected = detail::cpu_dispatch([] (auto width) -> size_t
+    {
+        constexpr size_t w = decltype(width)::value; // usable as a constant expression
+        return w;
+    });
+
+    EXPECT_LE(selected, std::max<size_t>(1u, detail::default_simd_max_length<detail::builtin_simd>));
+    EXPECT_LE(selected, detail::max_simd_width_at_runtime());
+}
+
+TEST(cpu_dispatch, void_callable)
+{
+    bool invoked = false;
+    detail::cpu_dispatch([&] (auto) { invoked = true; });
+    EXPECT_TRUE(invoked);
+}
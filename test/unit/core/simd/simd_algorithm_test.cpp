@@ -27,6 +27,42 @@ TEST(simd_algorithm, fill)
     SIMD_EQ(result, expect);
 }
 
+TEST(simd_algorithm, saturated_add)
+{
+    using simd_type = simd_type_t<int16_t, 8>;
+
+    simd_type const result = saturated_add(iota<simd_type>(0), fill<simd_type>(3));
+
+    simd_type expect{};
+    for (size_t i = 0; i < simd_traits<simd_type>::length; ++i)
+        expect[i] = i + 3;
+
+    SIMD_EQ(result, expect);
+}
+
+TEST(simd_algorithm, saturated_add_overflow)
+{
+    using simd_type = simd_type_t<int8_t, 16>;
+
+    constexpr int8_t max = std::numeric_limits<int8_t>::max();
+    constexpr int8_t min = std::numeric_limits<int8_t>::lowest();
+
+    simd_type lhs{};
+    simd_type rhs{};
+    simd_type expect{};
+
+    // Positive overflow clamps to the maximum, negative overflow to the minimum; sums within the
+    // representable range are unaffected.
+    lhs[0] = max;  rhs[0] = 1;    expect[0] = max;
+    lhs[1] = min;  rhs[1] = -1;   expect[1] = min;
+    lhs[2] = 100;  rhs[2] = 100;  expect[2] = max;
+    lhs[3] = -100; rhs[3] = -100; expect[3] = min;
+    lhs[4] = max;  rhs[4] = min;  expect[4] = -1;
+    lhs[5] = 42;   rhs[5] = -17;  expect[5] = 25;
+
+    SIMD_EQ(saturated_add(lhs, rhs), expect);
+}
+
 TEST(simd_algorithm, iota)
 {
     using simd_type = simd_type_t<int16_t, 8>;
@@ -38,3 +74,129 @@ TEST(simd_algorithm, iota)
     constexpr simd_type result = iota<simd_type>(0);
     SIMD_EQ(result, expect);
 }
+
+TEST(simd_algorithm, extract_insert)
+{
+    using simd_type = simd_type_t<int16_t, 8>;
+
+    simd_type const vec = iota<simd_type>(10);
+    EXPECT_EQ(extract(vec, 0), 10);
+    EXPECT_EQ(extract(vec, 7), 17);
+
+    simd_type expect = vec;
+    expect[3] = 42;
+    SIMD_EQ(insert(vec, 3, 42), expect);
+    EXPECT_EQ(extract(vec, 3), 13); // the source is unchanged
+}
+
+TEST(simd_algorithm, load)
+{
+    using simd_type = simd_type_t<int16_t, 8>;
+
+    std::array<int16_t, 9> memory{0, 1, 2, 3, 4, 5, 6, 7, 8};
+
+    simd_type expect{};
+    for (size_t i = 0; i < simd_traits<simd_type>::length; ++i)
+        expect[i] = memory[i + 1];
+
+    SIMD_EQ(load<simd_type>(memory.data() + 1), expect); // unaligned load
+}
+
+TEST(simd_algorithm, load_partial)
+{
+    using simd_type = simd_type_t<int16_t, 8>;
+
+    std::array<int16_t, 3> memory{7, 8, 9}; // shorter than the vector
+
+    simd_type expect{};
+    expect[0] = 7;
+    expect[1] = 8;
+    expect[2] = 9;
+
+    SIMD_EQ(load_partial<simd_type>(memory.data(), memory.size()), expect);
+}
+
+TEST(simd_algorithm, gather)
+{
+    using simd_type = simd_type_t<int16_t, 8>;
+
+    std::array<int16_t, 16> table{};
+    for (size_t i = 0; i < table.size(); ++i)
+        table[i] = 100 + i;
+
+    simd_type const indices{3, 1, 4, 1, 5, 9, 2, 6};
+
+    simd_type expect{};
+    for (size_t i = 0; i < simd_traits<simd_type>::length; ++i)
+        expect[i] = table[indices[i]];
+
+    SIMD_EQ(gather<simd_type>(table.data(), indices), expect);
+}
+
+TEST(simd_algorithm, transpose)
+{
+    using simd_type = simd_type_t<int16_t, 8>;
+    constexpr size_t length = simd_traits<simd_type>::length;
+
+    std::array<simd_type, length> matrix{};
+    for (size_t i = 0; i < length; ++i)
+        for (size_t j = 0; j < length; ++j)
+            matrix[i][j] = i * length + j;
+
+    transpose(matrix);
+
+    for (size_t i = 0; i < length; ++i)
+        for (size_t j = 0; j < length; ++j)
+            EXPECT_EQ(matrix[i][j], static_cast<int16_t>(j * length + i));
+}
+
+TEST(simd_algorithm, min)
+{
+    using simd_type = simd_type_t<int16_t, 8>;
+
+    simd_type const lhs{3, -1, 4, 1, -5, 9, 2, 6};
+    simd_type const rhs{2, 7, 1, 8, 2, -8, 1, 8};
+
+    simd_type expect{};
+    for (size_t i = 0; i < simd_traits<simd_type>::length; ++i)
+        expect[i] = std::min(lhs[i], rhs[i]);
+
+    SIMD_EQ(min(lhs, rhs), expect);
+}
+
+TEST(simd_algorithm, saturated_sub)
+{
+    using simd_type = simd_type_t<int8_t, 16>;
+
+    constexpr int8_t max = std::numeric_limits<int8_t>::max();
+    constexpr int8_t min = std::numeric_limits<int8_t>::lowest();
+
+    simd_type lhs{};
+    simd_type rhs{};
+    simd_type expect{};
+
+    lhs[0] = min;  rhs[0] = 1;    expect[0] = min;  // negative overflow clamps to the minimum
+    lhs[1] = max;  rhs[1] = -1;   expect[1] = max;  // positive overflow clamps to the maximum
+    lhs[2] = -100; rhs[2] = 100;  expect[2] = min;
+    lhs[3] = 100;  rhs[3] = -100; expect[3] = max;
+    lhs[4] = 42;   rhs[4] = 17;   expect[4] = 25;   // within range, unaffected
+    lhs[5] = -42;  rhs[5] = -17;  expect[5] = -25;
+
+    SIMD_EQ(saturated_sub(lhs, rhs), expect);
+}
+
+TEST(simd_algorithm, horizontal_reductions)
+{
+    using simd_type = simd_type_t<int16_t, 8>;
+
+    simd_type const vec{3, -1, 4, 1, -5, 9, 2, 6};
+
+    EXPECT_EQ(hmax(vec), 9);
+    EXPECT_EQ(hmin(vec), -5);
+    EXPECT_EQ(hadd(vec), 19);
+
+    // a single-lane vector reduces to its only element
+    using simd1_type = simd_type_t<int64_t, 1>;
+    EXPECT_EQ(hmax(simd1_type{42}), 42);
+    EXPECT_EQ(hadd(simd1_type{42}), 42);
+}
@@ -0,0 +1,82 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#define SEQAN3_ENABLE_TRACING 1
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <thread>
+
+#include <seqan3/core/tracing.hpp>
+
+using namespace seqan3;
+
+TEST(tracing, enabled_flag)
+{
+    EXPECT_TRUE(tracing::enabled);
+}
+
+TEST(tracing, scope_records_event)
+{
+    tracing::clear();
+
+    {
+        SEQAN3_TRACE_SCOPE("tracing_test::scope");
+    }
+
+    std::ostringstream stream{};
+    tracing::write(stream);
+    std::string const json = stream.str();
+
+    EXPECT_EQ(json.rfind("{\"traceEvents\":[", 0), 0u);
+    EXPECT_NE(json.find("\"name\":\"tracing_test::scope\""), std::string::npos);
+    EXPECT_NE(json.find("\"ph\":\"X\""), std::string::npos);
+    EXPECT_EQ(json.back(), '}');
+}
+
+TEST(tracing, multiple_threads)
+{
+    tracing::clear();
+
+    std::vector<std::thread> threads{};
+    for (size_t i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([] ()
+        {
+            for (size_t j = 0; j < 10; ++j)
+            {
+                SEQAN3_TRACE_SCOPE("tracing_test::worker");
+            }
+        });
+    }
+    for (std::thread & thread : threads)
+        thread.join();
+
+    std::ostringstream stream{};
+    tracing::write(stream);
+    std::string const json = stream.str();
+
+    size_t count = 0;
+    for (size_t pos = json.find("\"name\""); pos != std::string::npos; pos = json.find("\"name\"", pos + 1))
+        ++count;
+
+    EXPECT_EQ(count, 40u); // buffers of terminated threads are flushed on thread exit
+}
+
+TEST(tracing, clear)
+{
+    {
+        SEQAN3_TRACE_SCOPE("tracing_test::discarded");
+    }
+
+    tracing::clear();
+
+    std::ostringstream stream{};
+    tracing::write(stream);
+    EXPECT_EQ(stream.str(), "{\"traceEvents\":[]}");
+}
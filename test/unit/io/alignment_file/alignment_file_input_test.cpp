@@ -277,6 +277,53 @@ TEST_F(alignment_file_input_f, record_reading)
     EXPECT_EQ(counter, 3u);
 }
 
+TEST_F(alignment_file_input_f, prefetch_reading)
+{
+    alignment_file_input fin{std::istringstream{input}, alignment_file_format_sam{}};
+    fin.prefetch(2);
+
+    size_t counter = 0;
+    for (auto & rec : fin)
+    {
+        EXPECT_TRUE((std::ranges::equal(get<field::SEQ>(rec), seq_comp[counter])));
+        EXPECT_TRUE((std::ranges::equal(get<field::ID>(rec), id_comp[counter])));
+        EXPECT_TRUE((std::ranges::equal(get<field::QUAL>(rec), qual_comp[counter])));
+
+        counter++;
+    }
+
+    EXPECT_EQ(counter, 3u);
+}
+
+TEST_F(alignment_file_input_f, try_next_record_polling)
+{
+    alignment_file_input fin{std::istringstream{input}, alignment_file_format_sam{}};
+    fin.prefetch(2);
+
+    using record_type = typename decltype(fin)::record_type;
+    record_type rec{};
+
+    size_t counter = 0;
+    while (true)
+    {
+        record_availability const status = fin.try_next_record(rec);
+
+        if (status == record_availability::at_end)
+            break;
+
+        if (status == record_availability::pending) // the background parser has not caught up; poll again
+            continue;
+
+        EXPECT_TRUE((std::ranges::equal(get<field::SEQ>(rec), seq_comp[counter])));
+        EXPECT_TRUE((std::ranges::equal(get<field::ID>(rec), id_comp[counter])));
+
+        counter++;
+    }
+
+    EXPECT_EQ(counter, 3u);
+    EXPECT_EQ(fin.try_next_record(rec), record_availability::at_end); // stays at the end
+}
+
 TEST_F(alignment_file_input_f, record_reading_custom_fields)
 {
     /* record based reading */
@@ -538,3 +585,18 @@ TEST_F(alignment_file_input_sam_format_f, construct_from_stream_and_read_alignme
 
     EXPECT_EQ(counter, 3u);
 }
+
+// ----------------------------------------------------------------------------
+// region queries
+// ----------------------------------------------------------------------------
+
+TEST_F(alignment_file_input_f, fetch_requires_bgzf)
+{
+    alignment_file_input fin{std::istringstream{input}, alignment_file_format_sam{}};
+
+    // uncompressed input cannot be seeked via BGZF virtual offsets
+    EXPECT_THROW(fin.fetch(0, 0, 10), file_open_error);
+
+    // the reference name is resolved via the header before the stream is checked
+    EXPECT_THROW(fin.fetch("unknown_ref", 0, 10), std::out_of_range);
+}
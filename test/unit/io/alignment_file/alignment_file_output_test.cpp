@@ -262,6 +262,27 @@ TEST(row, push_back_record_const_element)
     });
 }
 
+TEST(row, push_back_write_parallel)
+{
+    test::tmp_filename filename{"alignment_file_output_parallel.sam"};
+
+    {
+        alignment_file_output<> fout{filename.get_path()};
+        fout.write_parallel(2);
+
+        for (size_t i = 0; i < 3; ++i)
+        {
+            record<type_list<dna5_vector, std::string>, fields<field::SEQ, field::ID>> r{seqs[i], ids[i]};
+            fout.push_back(std::move(r));
+        }
+    } // destructor drains the buffers still being formatted
+
+    std::ifstream file_stream{filename.get_path()};
+    std::string const file_content{std::istreambuf_iterator<char>{file_stream}, std::istreambuf_iterator<char>{}};
+
+    EXPECT_EQ(file_content, output_comp); // buffers are written in submission order
+}
+
 TEST(row, push_back_tuple)
 {
     row_wise_impl([&] (auto & file, size_t i)
@@ -371,10 +392,10 @@ TEST(row, print_header_in_record)
 
     alignment_file_header header{ref_ids};
 
-    header.ref_id_info.push_back({ref_len[0], ""});
-    header.ref_id_info.push_back({ref_len[1], ""});
-    header.ref_dict[ref_ids[0]] = 0;
-    header.ref_dict[ref_ids[1]] = 1;
+    header.ref_id_info().push_back({ref_len[0], ""});
+    header.ref_id_info().push_back({ref_len[1], ""});
+    header.ref_dict()[ref_ids[0]] = 0;
+    header.ref_dict()[ref_ids[1]] = 1;
 
     // no file header present
     {
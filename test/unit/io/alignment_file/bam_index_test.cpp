@@ -0,0 +1,132 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include <seqan3/io/alignment_file/bam_index.hpp>
+#include <seqan3/test/tmp_filename.hpp>
+
+using namespace seqan3;
+
+// One reference in the BAI binning scheme (min_shift 14, depth 5, leaf bins start at 4681):
+// bin 4681 holds the records of the first 16kbp window, bin 4682 those of the second,
+// bin 585 holds long records spanning both windows.
+static bam_index::reference_index_t example_reference()
+{
+    bam_index::reference_index_t ref{};
+    ref.bins[585].chunks  = {{0x50, 0x200}, {0x250, 0x500}};
+    ref.bins[4681].chunks = {{0x100, 0x200}};
+    ref.bins[4682].chunks = {{0x300, 0x400}};
+    ref.linear_index = {0x100, 0x300};
+    return ref;
+}
+
+TEST(bam_index, query_min_offset)
+{
+    bam_index index{std::vector<bam_index::reference_index_t>{example_reference()}};
+
+    // a region in the first window starts at the smallest chunk offset >= the window's linear offset
+    EXPECT_EQ(index.query_min_offset(0, 0, 100), 0x100u);
+
+    // in the second window the linear index prunes all chunks ending before 0x300
+    EXPECT_EQ(index.query_min_offset(0, 20'000, 20'100), 0x300u);
+
+    // a region spanning both windows starts at the first window's offset
+    EXPECT_EQ(index.query_min_offset(0, 100, 20'100), 0x100u);
+
+    // bin 585 spans the whole first 128kbp, so its long records could reach into this region
+    EXPECT_EQ(index.query_min_offset(0, 40'000, 50'000), 0x300u);
+
+    // no bin covers the region -> no record can overlap it
+    EXPECT_EQ(index.query_min_offset(0, 200'000, 210'000), std::nullopt);
+
+    // invalid queries
+    EXPECT_EQ(index.query_min_offset(1, 0, 100), std::nullopt);  // reference not in the index
+    EXPECT_EQ(index.query_min_offset(0, 100, 100), std::nullopt); // empty region
+}
+
+TEST(bam_index, csi_parent_bin_offset)
+{
+    // CSI indexes have no linear index; the lower bound comes from the closest ancestor bin's loffset
+    bam_index::reference_index_t ref{};
+    ref.bins[585].linear_offset = 0x80;
+    ref.bins[585].chunks = {{0x50, 0x200}};
+
+    bam_index index{std::vector<bam_index::reference_index_t>{ref}};
+
+    EXPECT_EQ(index.query_min_offset(0, 0, 100), 0x80u); // max(chunk.begin, ancestor loffset)
+}
+
+TEST(bam_index, bai_roundtrip)
+{
+    bam_index index{std::vector<bam_index::reference_index_t>{example_reference()}};
+
+    test::tmp_filename filename{"bam_index_test.bai"};
+    index.save(filename.get_path());
+
+    bam_index loaded{};
+    loaded.load(filename.get_path());
+
+    ASSERT_EQ(loaded.size(), 1u);
+    EXPECT_EQ(loaded.min_shift(), 14);
+    EXPECT_EQ(loaded.depth(), 5);
+
+    ASSERT_EQ(loaded[0].bins.size(), 3u);
+    ASSERT_EQ(loaded[0].bins.at(585).chunks.size(), 2u);
+    EXPECT_EQ(loaded[0].bins.at(585).chunks[1].begin, 0x250u);
+    EXPECT_EQ(loaded[0].bins.at(585).chunks[1].end, 0x500u);
+    EXPECT_EQ(loaded[0].linear_index, (std::vector<uint64_t>{0x100, 0x300}));
+
+    EXPECT_EQ(loaded.query_min_offset(0, 20'000, 20'100), 0x300u);
+}
+
+#ifdef SEQAN3_HAS_ZLIB
+TEST(bam_index, csi_roundtrip)
+{
+    bam_index::reference_index_t ref{};
+    ref.bins[4681].linear_offset = 0x100;
+    ref.bins[4681].chunks = {{0x100, 0x200}};
+
+    bam_index index{std::vector<bam_index::reference_index_t>{ref}, 14, 5};
+
+    test::tmp_filename filename{"bam_index_test.csi"};
+    index.save(filename.get_path());
+
+    bam_index loaded{};
+    loaded.load(filename.get_path());
+
+    ASSERT_EQ(loaded.size(), 1u);
+    EXPECT_EQ(loaded.min_shift(), 14);
+    EXPECT_EQ(loaded.depth(), 5);
+    EXPECT_TRUE(loaded[0].linear_index.empty());
+    EXPECT_EQ(loaded[0].bins.at(4681).linear_offset, 0x100u);
+
+    EXPECT_EQ(loaded.query_min_offset(0, 0, 100), 0x100u);
+}
+#endif
+
+TEST(bam_index, load_errors)
+{
+    bam_index index{};
+
+    EXPECT_THROW(index.load("/dev/nonexistent/file.bai"), file_open_error);
+
+    test::tmp_filename filename{"bam_index_test.bai"};
+    {
+        std::ofstream of{filename.get_path(), std::ios::binary};
+        of << "this is not an index";
+    }
+    EXPECT_THROW(index.load(filename.get_path()), parse_error);
+
+    {
+        std::ofstream of{filename.get_path(), std::ios::binary};
+        of.write("BAI\1\2", 5); // truncated in the middle of n_ref
+    }
+    EXPECT_THROW(index.load(filename.get_path()), parse_error);
+}
@@ -0,0 +1,407 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <seqan3/io/alignment_file/cram_codec.hpp>
+
+using namespace seqan3;
+
+// ----------------------------------------------------------------------------
+// test-local encoders (the library only decodes)
+// ----------------------------------------------------------------------------
+
+//!\brief Appends the ITF8 representation of a value to a buffer.
+static void append_itf8(std::string & buffer, int32_t const value)
+{
+    uint32_t const v = static_cast<uint32_t>(value);
+
+    if (v < 0x80u)
+    {
+        buffer += static_cast<char>(v);
+    }
+    else if (v < 0x4000u)
+    {
+        buffer += static_cast<char>(0x80u | (v >> 8));
+        buffer += static_cast<char>(v);
+    }
+    else if (v < 0x200000u)
+    {
+        buffer += static_cast<char>(0xC0u | (v >> 16));
+        buffer += static_cast<char>(v >> 8);
+        buffer += static_cast<char>(v);
+    }
+    else if (v < 0x10000000u)
+    {
+        buffer += static_cast<char>(0xE0u | (v >> 24));
+        buffer += static_cast<char>(v >> 16);
+        buffer += static_cast<char>(v >> 8);
+        buffer += static_cast<char>(v);
+    }
+    else
+    {
+        buffer += static_cast<char>(0xF0u | (v >> 28));
+        buffer += static_cast<char>(v >> 20);
+        buffer += static_cast<char>(v >> 12);
+        buffer += static_cast<char>(v >> 4);
+        buffer += static_cast<char>(v & 0x0Fu);
+    }
+}
+
+//!\brief Appends the LTF8 representation of a value to a buffer (small values short, others as 9 bytes).
+static void append_ltf8(std::string & buffer, int64_t const value)
+{
+    uint64_t const v = static_cast<uint64_t>(value);
+
+    if (v < 0x80u)
+    {
+        buffer += static_cast<char>(v);
+        return;
+    }
+
+    buffer += static_cast<char>(0xFF);
+    for (int shift = 56; shift >= 0; shift -= 8)
+        buffer += static_cast<char>((v >> shift) & 0xFFu);
+}
+
+//!\brief Appends the little-endian representation of a uint32_t to a buffer.
+static void append_uint32(std::string & buffer, uint32_t const value)
+{
+    buffer.append(reinterpret_cast<char const *>(&value), sizeof(value));
+}
+
+using frequency_table = std::array<uint32_t, 256>;
+
+//!\brief Normalises a frequency table to the total of 4096 the rANS codec requires.
+static void normalise_frequencies(frequency_table & frequencies)
+{
+    uint32_t total = 0;
+    for (uint32_t const f : frequencies)
+        total += f;
+    if (total == 0)
+        return;
+
+    uint32_t assigned = 0;
+    int last = -1;
+    for (int s = 0; s < 256; ++s)
+    {
+        if (frequencies[s] == 0)
+            continue;
+        frequencies[s] = std::max<uint32_t>(1u, static_cast<uint64_t>(frequencies[s]) * 4096u / total);
+        assigned += frequencies[s];
+        last = s;
+    }
+    frequencies[last] += 4096u - assigned;
+}
+
+//!\brief Serialises one frequency table (run-length encoded symbols, ITF8 frequencies).
+static void append_frequency_table(std::string & buffer, frequency_table const & frequencies)
+{
+    int rle = 0;
+    for (int s = 0; s < 256; ++s)
+    {
+        if (frequencies[s] == 0)
+            continue;
+
+        if (rle > 0)
+        {
+            --rle;
+        }
+        else
+        {
+            buffer += static_cast<char>(s);
+            if (s > 0 && frequencies[s - 1] != 0) // a run of consecutive symbols is length encoded
+            {
+                for (rle = 0; s + rle + 1 < 256 && frequencies[s + rle + 1] != 0; ++rle);
+                buffer += static_cast<char>(rle);
+            }
+        }
+        append_itf8(buffer, frequencies[s]);
+    }
+    buffer += '\0';
+}
+
+//!\brief Compresses data with the rANS 4x8 codec, order 0.
+static std::string rans_compress_order_0(std::string const & input)
+{
+    constexpr uint32_t lower_bound = 1u << 23;
+
+    frequency_table frequencies{};
+    for (unsigned char const c : input)
+        ++frequencies[c];
+    normalise_frequencies(frequencies);
+
+    frequency_table cumulative{};
+    uint32_t running = 0;
+    for (int s = 0; s < 256; ++s)
+    {
+        cumulative[s] = running;
+        running += frequencies[s];
+    }
+
+    std::string table{};
+    append_frequency_table(table, frequencies);
+
+    // the encoder runs backwards over the input, emitting renormalisation bytes in reverse
+    std::array<uint32_t, 4> states{lower_bound, lower_bound, lower_bound, lower_bound};
+    std::string reversed{};
+    for (size_t i = input.size(); i-- > 0; )
+    {
+        uint32_t & x = states[i % 4];
+        unsigned char const s = input[i];
+        uint32_t const upper = ((lower_bound >> 12) << 8) * frequencies[s];
+        while (x >= upper)
+        {
+            reversed += static_cast<char>(x & 0xFFu);
+            x >>= 8;
+        }
+        x = ((x / frequencies[s]) << 12) + (x % frequencies[s]) + cumulative[s];
+    }
+
+    std::string body{};
+    for (uint32_t const state : states)
+        append_uint32(body, state);
+    for (size_t i = reversed.size(); i-- > 0; )
+        body += reversed[i];
+
+    std::string out{};
+    out += '\0'; // order 0
+    append_uint32(out, table.size() + body.size());
+    append_uint32(out, input.size());
+    return out + table + body;
+}
+
+//!\brief Compresses data with the rANS 4x8 codec, order 1 (context = the previous byte).
+static std::string rans_compress_order_1(std::string const & input)
+{
+    constexpr uint32_t lower_bound = 1u << 23;
+
+    size_t const n = input.size();
+    size_t const quarter = n / 4;
+    auto quarter_end = [&] (size_t const j) { return j < 3 ? (j + 1) * quarter : n; };
+
+    std::vector<frequency_table> frequencies(256);
+    std::vector<frequency_table> cumulative(256);
+
+    for (size_t j = 0; j < 4; ++j) // the first byte of each quarter has context 0
+    {
+        uint8_t context = 0;
+        for (size_t i = j * quarter; i < quarter_end(j); ++i)
+        {
+            ++frequencies[context][static_cast<uint8_t>(input[i])];
+            context = input[i];
+        }
+    }
+
+    for (int c = 0; c < 256; ++c)
+    {
+        normalise_frequencies(frequencies[c]);
+        uint32_t running = 0;
+        for (int s = 0; s < 256; ++s)
+        {
+            cumulative[c][s] = running;
+            running += frequencies[c][s];
+        }
+    }
+
+    auto context_used = [&] (int const c)
+    {
+        for (uint32_t const f : frequencies[c])
+            if (f != 0)
+                return true;
+        return false;
+    };
+
+    std::string table{};
+    {
+        int rle = 0;
+        for (int c = 0; c < 256; ++c)
+        {
+            if (!context_used(c))
+                continue;
+
+            if (rle > 0)
+            {
+                --rle;
+            }
+            else
+            {
+                table += static_cast<char>(c);
+                if (c > 0 && context_used(c - 1))
+                {
+                    for (rle = 0; c + rle + 1 < 256 && context_used(c + rle + 1); ++rle);
+                    table += static_cast<char>(rle);
+                }
+            }
+            append_frequency_table(table, frequencies[c]);
+        }
+        table += '\0';
+    }
+
+    std::array<uint32_t, 4> states{lower_bound, lower_bound, lower_bound, lower_bound};
+    std::string reversed{};
+
+    auto encode_symbol = [&] (size_t const j, uint8_t const context, uint8_t const s)
+    {
+        uint32_t & x = states[j];
+        uint32_t const upper = ((lower_bound >> 12) << 8) * frequencies[context][s];
+        while (x >= upper)
+        {
+            reversed += static_cast<char>(x & 0xFFu);
+            x >>= 8;
+        }
+        x = ((x / frequencies[context][s]) << 12) + (x % frequencies[context][s]) + cumulative[context][s];
+    };
+    auto context_at = [&] (size_t const j, size_t const i) -> uint8_t
+    {
+        return i == j * quarter ? 0 : static_cast<uint8_t>(input[i - 1]);
+    };
+
+    // encode in the exact reverse of the decoder's read order
+    for (size_t i = n; i-- > 4 * quarter; )
+        encode_symbol(3, context_at(3, i), input[i]);
+    for (size_t i = quarter; i-- > 0; )
+        for (size_t j = 4; j-- > 0; )
+            encode_symbol(j, context_at(j, j * quarter + i), input[j * quarter + i]);
+
+    std::string body{};
+    for (uint32_t const state : states)
+        append_uint32(body, state);
+    for (size_t i = reversed.size(); i-- > 0; )
+        body += reversed[i];
+
+    std::string out{};
+    out += '\1'; // order 1
+    append_uint32(out, table.size() + body.size());
+    append_uint32(out, n);
+    return out + table + body;
+}
+
+// ----------------------------------------------------------------------------
+// cram_data_cursor
+// ----------------------------------------------------------------------------
+
+TEST(cram_data_cursor, take)
+{
+    std::string const buffer{"foobar"};
+    detail::cram_data_cursor cursor{buffer};
+
+    EXPECT_EQ(cursor.size(), 6u);
+    EXPECT_EQ(cursor.take(3), "foo");
+    EXPECT_EQ(cursor.take_byte(), 'b');
+    EXPECT_EQ(cursor.remaining(), "ar");
+    EXPECT_FALSE(cursor.at_end());
+    EXPECT_EQ(cursor.take(2), "ar");
+    EXPECT_TRUE(cursor.at_end());
+    EXPECT_THROW(cursor.take(1), format_error);
+}
+
+TEST(cram_data_cursor, itf8)
+{
+    std::vector<int32_t> const values{0, 1, 127, 128, 5000, 16383, 16384, 1 << 20, 1 << 27, (1 << 28) + 5,
+                                      std::numeric_limits<int32_t>::max(), -1, -42};
+
+    std::string buffer{};
+    for (int32_t const value : values)
+        append_itf8(buffer, value);
+
+    detail::cram_data_cursor cursor{buffer};
+    for (int32_t const value : values)
+        EXPECT_EQ(cursor.take_itf8(), value);
+    EXPECT_TRUE(cursor.at_end());
+
+    EXPECT_THROW(cursor.take_itf8(), format_error); // exhausted
+
+    detail::cram_data_cursor truncated{std::string_view{"\xC0", 1}}; // announces 2 payload bytes, has none
+    EXPECT_THROW(truncated.take_itf8(), format_error);
+}
+
+TEST(cram_data_cursor, ltf8)
+{
+    std::vector<int64_t> const values{0, 127, 128, 4542278, 1234567890123ll, -1};
+
+    std::string buffer{};
+    for (int64_t const value : values)
+        append_ltf8(buffer, value);
+
+    detail::cram_data_cursor cursor{buffer};
+    for (int64_t const value : values)
+        EXPECT_EQ(cursor.take_ltf8(), value);
+    EXPECT_TRUE(cursor.at_end());
+}
+
+// ----------------------------------------------------------------------------
+// cram_bit_reader
+// ----------------------------------------------------------------------------
+
+TEST(cram_bit_reader, msb_first)
+{
+    std::string const buffer{static_cast<char>(0b1011'0001), static_cast<char>(0b0100'0000)};
+    detail::cram_bit_reader reader{buffer};
+
+    EXPECT_EQ(reader.read_bit(), true);
+    EXPECT_EQ(reader.read_bits(3), 0b011u);
+    EXPECT_EQ(reader.read_bits(5), 0b0'0010u); // crosses the byte boundary
+    EXPECT_EQ(reader.read_bit(), true);
+    EXPECT_EQ(reader.read_bits(6), 0u);
+    EXPECT_THROW(reader.read_bit(), format_error); // exhausted
+}
+
+// ----------------------------------------------------------------------------
+// rANS decompression
+// ----------------------------------------------------------------------------
+
+TEST(cram_rans, order_0_round_trip)
+{
+    std::mt19937 generator{42};
+
+    for (size_t const length : {4u, 7u, 100u, 10000u})
+    {
+        std::string input{};
+        for (size_t i = 0; i < length; ++i)
+            input += "ACGTN!~"[generator() % 7];
+
+        EXPECT_EQ(detail::cram_rans_decompress(rans_compress_order_0(input)), input);
+    }
+}
+
+TEST(cram_rans, order_0_single_symbol)
+{
+    std::string const input(500, 'Q');
+    EXPECT_EQ(detail::cram_rans_decompress(rans_compress_order_0(input)), input);
+}
+
+TEST(cram_rans, order_1_round_trip)
+{
+    std::mt19937 generator{1337};
+
+    for (size_t const length : {8u, 100u, 4003u, 40000u}) // also exercises the length % 4 != 0 remainder
+    {
+        std::string input{};
+        for (size_t i = 0; i < length; ++i)
+            input += "FFFFFFIIIII:#"[generator() % 13]; // quality-score-like data
+
+        EXPECT_EQ(detail::cram_rans_decompress(rans_compress_order_1(input)), input);
+    }
+}
+
+TEST(cram_rans, invalid_input)
+{
+    // unknown order byte
+    std::string unknown_order{};
+    unknown_order += '\2';
+    append_uint32(unknown_order, 0u);
+    append_uint32(unknown_order, 0u);
+    EXPECT_THROW(detail::cram_rans_decompress(unknown_order), format_error);
+
+    // truncated compressed data
+    std::string truncated = rans_compress_order_0("the quick brown fox jumps over the lazy dog");
+    truncated.resize(truncated.size() - 10);
+    EXPECT_THROW(detail::cram_rans_decompress(truncated), format_error);
+}
@@ -0,0 +1,387 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include <seqan3/alphabet/quality/all.hpp>
+#include <seqan3/io/alignment_file/input_format_concept.hpp>
+#include <seqan3/io/alignment_file/output_format_concept.hpp>
+#include <seqan3/io/alignment_file/format_bam.hpp>
+
+using namespace seqan3;
+
+// global variables for reuse
+alignment_file_input_options<dna5> input_options;
+alignment_file_output_options output_options;
+
+//!\brief Appends the little-endian binary representation of an int32_t to a string (for binary test input).
+static void append_int32(std::string & buffer, int32_t const value)
+{
+    buffer.append(reinterpret_cast<char const *>(&value), sizeof(value));
+}
+
+// ----------------------------------------------------------------------------
+// general
+// ----------------------------------------------------------------------------
+
+TEST(general, concepts)
+{
+    EXPECT_TRUE((AlignmentFileOutputFormat<alignment_file_format_bam>));
+    EXPECT_TRUE((AlignmentFileInputFormat<alignment_file_format_bam>));
+}
+
+// The BAM format is tested by writing the records of the SAM format test and reading them back in,
+// since the binary representation is not human readable.
+struct bam_roundtrip : public ::testing::Test
+{
+    bam_roundtrip()
+    {
+        ref_sequences = std::vector<dna5_vector>{ref_seq};
+        ref_ids = std::vector<std::string>{ref_id};
+        header = alignment_file_header{ref_ids};
+        header.ref_id_info().emplace_back(ref_seq.size(), "");
+        header.ref_dict()[header.ref_ids()[0]] = 0; // set up header which is otherwise done on file level
+    }
+
+    std::vector<dna5_vector> seqs
+    {
+        "ACGT"_dna5,
+        "AGGCTGNAG"_dna5,
+        "GGAGTATA"_dna5
+    };
+
+    std::vector<std::string> ids
+    {
+        "read1",
+        "read2",
+        "read3"
+    };
+
+    std::vector<std::vector<phred42>> quals
+    {
+        { "!##$"_phred42 },
+        { "!##$&'()*"_phred42 },
+        { "!!*+,-./"_phred42 },
+    };
+
+    std::vector<int32_t> offsets
+    {
+        1,
+        0,
+        1
+    };
+
+    dna5_vector ref_seq = "ACTGATCGAGAGGATCTAGAGGAGATCGTAGGAC"_dna5;
+
+    std::vector<gapped<dna5>> ref_seq_gapped1 = {'A'_dna5, 'C'_dna5, 'T'_dna5, gap{}};
+    std::vector<gapped<dna5>> ref_seq_gapped2 = {'C'_dna5, 'T'_dna5, 'G'_dna5, 'A'_dna5,
+                                                 'T'_dna5, 'C'_dna5, 'G'_dna5, 'A'_dna5, 'G'_dna5};
+    std::vector<gapped<dna5>> ref_seq_gapped3 = {'T'_dna5, 'G'_dna5, 'A'_dna5, gap{},
+                                                 'T'_dna5, gap{}, 'C'_dna5, 'G'_dna5,};
+
+    std::string ref_id = "ref";
+
+    std::vector<int32_t> ref_offsets
+    {
+        0,
+        1,
+        2
+    };
+
+    std::vector<std::pair<std::vector<gapped<dna5>>, std::vector<gapped<dna5>>>> alignments
+    {
+        {ref_seq_gapped1, std::vector<gapped<dna5>>{'C'_dna5, gap{}, 'G'_dna5, 'T'_dna5}},
+        {ref_seq_gapped2, std::vector<gapped<dna5>>{'A'_dna5, 'G'_dna5, 'G'_dna5, 'C'_dna5, 'T'_dna5,
+                                                    'G'_dna5, 'N'_dna5, gap{}, 'A'_dna5}},
+        {ref_seq_gapped3, std::vector<gapped<dna5>>{'G'_dna5, gap{}, 'A'_dna5, 'G'_dna5,
+                                                    'T'_dna5, 'A'_dna5, gap{}, 'T'_dna5}}
+    };
+
+    std::vector<uint16_t> flags
+    {
+        41u,
+        42u,
+        43u
+    };
+
+    std::vector<uint8_t> mapqs
+    {
+        61u,
+        62u,
+        63u
+    };
+
+    std::vector<std::tuple<std::optional<int32_t>, std::optional<int32_t>, int32_t>> mates
+    {
+        {0, 9, 300},
+        {0, 9, 300},
+        {0, 9, 300}
+    };
+
+    std::vector<sam_tag_dictionary> tag_dicts
+    {
+        sam_tag_dictionary{},
+        sam_tag_dictionary{},
+        sam_tag_dictionary{}
+    };
+
+    std::vector<dna5_vector> ref_sequences{};
+    std::vector<std::string> ref_ids{};
+    alignment_file_header<std::vector<std::string>> header{};
+
+    //!\brief Writes all records of the fixture and returns the (uncompressed) binary file content.
+    std::string written_file_content()
+    {
+        alignment_file_format_bam format;
+        std::ostringstream ostream;
+
+        for (size_t i = 0; i < 3; ++i)
+        {
+            format.write(ostream, output_options, header, seqs[i], quals[i], ids[i], offsets[i],
+                         std::string{}, std::optional<int32_t>{0}, ref_offsets[i], alignments[i], flags[i], mapqs[i],
+                         mates[i], tag_dicts[i], 0, 0);
+        }
+
+        ostream.flush();
+        return ostream.str();
+    }
+};
+
+// ----------------------------------------------------------------------------
+// reading and writing
+// ----------------------------------------------------------------------------
+
+TEST_F(bam_roundtrip, all_fields)
+{
+    tag_dicts[0].get<"AS"_tag>() = 2;
+    tag_dicts[0]["aa"_tag] = 'c';
+    tag_dicts[0]["ff"_tag] = 3.1f;
+    tag_dicts[0]["zz"_tag] = "str";
+    tag_dicts[1]["bc"_tag] = std::vector<int8_t>{-3};
+    tag_dicts[1]["bC"_tag] = std::vector<uint8_t>{3u, 200u};
+    tag_dicts[1]["bs"_tag] = std::vector<int16_t>{-3, 200, -300};
+    tag_dicts[1]["bS"_tag] = std::vector<uint16_t>{300u, 40u, 500u};
+    tag_dicts[1]["bi"_tag] = std::vector<int32_t>{-3, 200, -66000};
+    tag_dicts[1]["bI"_tag] = std::vector<uint32_t>{294967296u};
+    tag_dicts[1]["bf"_tag] = std::vector<float>{3.5f, 0.1f, 43.8f};
+
+    std::istringstream istream{written_file_content()};
+
+    alignment_file_format_bam format;
+
+    dna5_vector seq;
+    std::string id;
+    std::vector<phred42> qual;
+    int32_t offset;
+    std::optional<int32_t> ref_id_in;
+    std::optional<int32_t> ref_offset;
+    std::pair<std::vector<gapped<dna5>>, std::vector<gapped<dna5>>> alignment;
+    uint16_t flag;
+    uint8_t mapq;
+    std::tuple<std::optional<int32_t>, std::optional<int32_t>, int32_t> mate;
+    sam_tag_dictionary tag_dict;
+
+    for (size_t i = 0; i < 3; ++i)
+    {
+        ASSERT_NO_THROW(format.read(istream, input_options, ref_sequences, header, seq, qual, id, offset, std::ignore,
+                                    ref_id_in, ref_offset, alignment, flag, mapq, mate, tag_dict, std::ignore,
+                                    std::ignore));
+
+        EXPECT_EQ(seq, seqs[i]);
+        EXPECT_EQ(id, ids[i]);
+        EXPECT_EQ(qual, quals[i]);
+        EXPECT_EQ(offset, offsets[i]);
+        EXPECT_EQ(ref_id_in, 0);
+        EXPECT_EQ(*ref_offset, ref_offsets[i]);
+        EXPECT_EQ(get<0>(alignment), get<0>(alignments[i]));
+        EXPECT_EQ(get<1>(alignment), get<1>(alignments[i]));
+        EXPECT_EQ(flag, flags[i]);
+        EXPECT_EQ(mapq, mapqs[i]);
+        EXPECT_EQ(mate, mates[i]);
+        EXPECT_EQ(tag_dict, tag_dicts[i]);
+
+        seq.clear();
+        id.clear();
+        qual.clear();
+        offset = 0;
+        ref_id_in = 0;
+        ref_offset = 0;
+        alignment = std::pair<std::vector<gapped<dna5>>, std::vector<gapped<dna5>>>{};
+        flag = 0;
+        mapq = 0;
+        mate = std::tuple<std::optional<int32_t>, std::optional<int32_t>, int32_t>{};
+        tag_dict.clear();
+    }
+}
+
+TEST_F(bam_roundtrip, header)
+{
+    header.sorting = "coordinate";
+    header.program_infos.push_back({"prog1", "cool_program", "./prog1", "", "", "1.0"});
+    header.comments.push_back("This is a comment.");
+
+    std::istringstream istream{written_file_content()};
+
+    alignment_file_format_bam format;
+    alignment_file_header<> read_header{};
+
+    // read everything to make sure the record blocks are skipped correctly when all fields are ignored
+    for (size_t i = 0; i < 3; ++i)
+    {
+        ASSERT_NO_THROW(format.read(istream, input_options, std::ignore, read_header, std::ignore, std::ignore,
+                                    std::ignore, std::ignore, std::ignore, std::ignore, std::ignore, std::ignore,
+                                    std::ignore, std::ignore, std::ignore, std::ignore, std::ignore, std::ignore));
+    }
+
+    EXPECT_EQ(read_header.sorting, "coordinate");
+    EXPECT_EQ(read_header.program_infos[0].id, "prog1");
+    EXPECT_EQ(read_header.program_infos[0].version, "1.0");
+    EXPECT_EQ(read_header.comments[0], "This is a comment.");
+
+    ASSERT_EQ(read_header.ref_ids().size(), 1u);
+    EXPECT_EQ(read_header.ref_ids()[0], ref_id);
+    EXPECT_EQ(read_header.ref_id_info()[0], (std::tuple<uint32_t, std::string>{ref_seq.size(), ""}));
+    EXPECT_EQ(read_header.ref_dict()[ref_id], 0u);
+}
+
+TEST_F(bam_roundtrip, read_in_alignment_only_without_ref_information)
+{
+    std::istringstream istream{written_file_content()};
+
+    alignment_file_format_bam format;
+
+    using dummy_type = gap_decorator_anchor_set<decltype(ranges::view::repeat_n(dna5{}, size_t{}) |
+                                                         std::view::transform(detail::access_restrictor_fn{}))>;
+    std::pair<dummy_type, std::vector<gapped<dna5>>> alignment;
+    alignment_file_header<> read_header{};
+
+    for (size_t i = 0; i < 3; ++i)
+    {
+        ASSERT_NO_THROW(format.read(istream, input_options, std::ignore, read_header, std::ignore, std::ignore,
+                                    std::ignore, std::ignore, std::ignore, std::ignore, std::ignore, alignment,
+                                    std::ignore, std::ignore, std::ignore, std::ignore, std::ignore, std::ignore));
+
+        EXPECT_EQ(get<1>(alignment), get<1>(alignments[i]));
+
+        alignment = std::pair<dummy_type, std::vector<gapped<dna5>>>{}; // reset
+    }
+}
+
+TEST_F(bam_roundtrip, unmapped_record)
+{
+    alignment_file_format_bam format;
+
+    std::ostringstream ostream;
+    format.write(ostream, output_options, header, ""_dna5, std::vector<phred42>{}, std::string{}, 0, std::string{},
+                 std::optional<int32_t>{}, std::optional<int32_t>{},
+                 std::pair<std::vector<gapped<dna5>>, std::vector<gapped<dna5>>>{}, 0, 0,
+                 std::tuple<std::optional<int32_t>, std::optional<int32_t>, int32_t>{},
+                 sam_tag_dictionary{}, 0, 0);
+    ostream.flush();
+
+    std::istringstream istream{ostream.str()};
+
+    dna5_vector seq;
+    std::string id;
+    std::vector<phred42> qual;
+    std::optional<int32_t> ref_id_in;
+    std::optional<int32_t> ref_offset;
+    std::tuple<std::optional<int32_t>, std::optional<int32_t>, int32_t> mate;
+    sam_tag_dictionary tag_dict;
+
+    ASSERT_NO_THROW(format.read(istream, input_options, ref_sequences, header, seq, qual, id, std::ignore, std::ignore,
+                                ref_id_in, ref_offset, std::ignore, std::ignore, std::ignore, mate, tag_dict,
+                                std::ignore, std::ignore));
+
+    EXPECT_TRUE(seq.empty());
+    EXPECT_TRUE(id.empty());
+    EXPECT_TRUE(qual.empty());
+    EXPECT_TRUE(!ref_id_in.has_value());
+    EXPECT_TRUE(!ref_offset.has_value());
+    EXPECT_TRUE(!get<0>(mate).has_value());
+    EXPECT_TRUE(!get<1>(mate).has_value());
+    EXPECT_EQ(get<2>(mate), int32_t{});
+    EXPECT_TRUE(tag_dict.empty());
+}
+
+// ----------------------------------------------------------------------------
+// format errors
+// ----------------------------------------------------------------------------
+
+struct bam_format_error : public bam_roundtrip
+{};
+
+TEST_F(bam_format_error, wrong_magic_bytes)
+{
+    alignment_file_format_bam format;
+
+    std::istringstream istream{std::string{"BAI\1"}};
+
+    alignment_file_header<> read_header{};
+
+    EXPECT_THROW(format.read(istream, input_options, std::ignore, read_header, std::ignore, std::ignore, std::ignore,
+                             std::ignore, std::ignore, std::ignore, std::ignore, std::ignore, std::ignore, std::ignore,
+                             std::ignore, std::ignore, std::ignore, std::ignore),
+                 format_error);
+}
+
+TEST_F(bam_format_error, binary_reference_dictionary_mismatch)
+{
+    alignment_file_format_bam format;
+
+    // magic bytes, empty header text and a binary reference dictionary with an unknown reference name
+    std::string file_content{"BAM\1"};
+    append_int32(file_content, 0);                 // l_text
+    append_int32(file_content, 1);                 // n_ref
+    append_int32(file_content, 12);                // l_name
+    file_content += std::string{"unknown_ref"} + '\0';
+    append_int32(file_content, 34);                // l_ref
+
+    std::istringstream istream{file_content};
+
+    // the given reference information does not contain "unknown_ref"
+    EXPECT_THROW(format.read(istream, input_options, ref_sequences, header, std::ignore, std::ignore, std::ignore,
+                             std::ignore, std::ignore, std::ignore, std::ignore, std::ignore, std::ignore, std::ignore,
+                             std::ignore, std::ignore, std::ignore, std::ignore),
+                 format_error);
+}
+
+TEST_F(bam_format_error, truncated_record)
+{
+    std::string file_content = written_file_content();
+    file_content.resize(file_content.size() / 2); // cut off in the middle of a record
+
+    std::istringstream istream{file_content};
+
+    alignment_file_format_bam format;
+    alignment_file_header<> read_header{};
+
+    auto read_all_records = [&] ()
+    {
+        for (size_t i = 0; i < 3; ++i)
+            format.read(istream, input_options, std::ignore, read_header, std::ignore, std::ignore,
+                        std::ignore, std::ignore, std::ignore, std::ignore, std::ignore, std::ignore,
+                        std::ignore, std::ignore, std::ignore, std::ignore, std::ignore, std::ignore);
+    };
+
+    EXPECT_THROW(read_all_records(), format_error);
+}
+
+TEST_F(bam_format_error, ref_name_without_header)
+{
+    alignment_file_format_bam format;
+
+    std::ostringstream ostream;
+
+    // BAM records reference the binary dictionary by index, so a reference name cannot be resolved without a header
+    EXPECT_THROW(format.write(ostream, output_options, std::ignore, seqs[0], quals[0], ids[0], offsets[0],
+                              std::string{}, std::string{"ref"}, ref_offsets[0], alignments[0], flags[0], mapqs[0],
+                              mates[0], tag_dicts[0], 0, 0),
+                 format_error);
+}
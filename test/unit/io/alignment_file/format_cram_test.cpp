@@ -0,0 +1,750 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include <seqan3/alphabet/quality/all.hpp>
+#include <seqan3/io/alignment_file/input_format_concept.hpp>
+#include <seqan3/io/alignment_file/output_format_concept.hpp>
+#include <seqan3/io/alignment_file/format_cram.hpp>
+
+using namespace seqan3;
+
+// global variables for reuse
+alignment_file_input_options<dna5> input_options;
+
+// ----------------------------------------------------------------------------
+// test-local CRAM writer (the library only reads CRAM)
+// ----------------------------------------------------------------------------
+
+//!\brief Appends the ITF8 representation of a value to a buffer.
+static void append_itf8(std::string & buffer, int32_t const value)
+{
+    uint32_t const v = static_cast<uint32_t>(value);
+
+    if (v < 0x80u)
+    {
+        buffer += static_cast<char>(v);
+    }
+    else if (v < 0x4000u)
+    {
+        buffer += static_cast<char>(0x80u | (v >> 8));
+        buffer += static_cast<char>(v);
+    }
+    else if (v < 0x200000u)
+    {
+        buffer += static_cast<char>(0xC0u | (v >> 16));
+        buffer += static_cast<char>(v >> 8);
+        buffer += static_cast<char>(v);
+    }
+    else if (v < 0x10000000u)
+    {
+        buffer += static_cast<char>(0xE0u | (v >> 24));
+        buffer += static_cast<char>(v >> 16);
+        buffer += static_cast<char>(v >> 8);
+        buffer += static_cast<char>(v);
+    }
+    else
+    {
+        buffer += static_cast<char>(0xF0u | (v >> 28));
+        buffer += static_cast<char>(v >> 20);
+        buffer += static_cast<char>(v >> 12);
+        buffer += static_cast<char>(v >> 4);
+        buffer += static_cast<char>(v & 0x0Fu);
+    }
+}
+
+//!\brief Appends the little-endian binary representation of an arithmetic value to a buffer.
+template <typename number_t>
+static void append_le(std::string & buffer, number_t const value)
+{
+    buffer.append(reinterpret_cast<char const *>(&value), sizeof(value));
+}
+
+//!\brief Computes the CRC32 a CRAM reader expects for a block (0 without zlib, where it is not verified).
+static uint32_t block_crc(std::string const & bytes)
+{
+#ifdef SEQAN3_HAS_ZLIB
+    return crc32(crc32(0, nullptr, 0), reinterpret_cast<Bytef const *>(bytes.data()), bytes.size());
+#else
+    (void) bytes;
+    return 0u;
+#endif
+}
+
+//!\brief Serialises one (uncompressed) block.
+static std::string make_block(uint8_t const content_type, int32_t const content_id, std::string const & data)
+{
+    std::string block{};
+    block += '\0'; // compression method: raw
+    block += static_cast<char>(content_type);
+    append_itf8(block, content_id);
+    append_itf8(block, data.size()); // compressed size
+    append_itf8(block, data.size()); // raw size
+    block += data;
+    append_le(block, block_crc(block));
+    return block;
+}
+
+//!\brief Serialises one container (header + payload).
+static std::string make_container(int32_t const n_records, std::string const & payload)
+{
+    std::string container{};
+    append_le(container, static_cast<int32_t>(payload.size())); // length of all blocks
+    append_itf8(container, -2);                                 // reference sequence id
+    append_itf8(container, 0);                                  // alignment start
+    append_itf8(container, 0);                                  // alignment span
+    append_itf8(container, n_records);
+    container += '\0';                                          // record counter (LTF8)
+    container += '\0';                                          // number of read bases (LTF8)
+    append_itf8(container, 1);                                  // number of blocks (not used when reading)
+    append_itf8(container, 0);                                  // number of landmarks
+    append_le(container, uint32_t{0});                          // header CRC32 (not verified when reading)
+    return container + payload;
+}
+
+//!\name Encoding builders
+//!\{
+static std::string external_encoding(int32_t const content_id)
+{
+    std::string args{};
+    append_itf8(args, content_id);
+
+    std::string encoding{};
+    append_itf8(encoding, 1); // EXTERNAL
+    append_itf8(encoding, args.size());
+    return encoding + args;
+}
+
+static std::string huffman_constant_encoding(int32_t const symbol)
+{
+    std::string args{};
+    append_itf8(args, 1); // one symbol
+    append_itf8(args, symbol);
+    append_itf8(args, 1); // one code length
+    append_itf8(args, 0); // of zero bits
+
+    std::string encoding{};
+    append_itf8(encoding, 3); // HUFFMAN
+    append_itf8(encoding, args.size());
+    return encoding + args;
+}
+
+static std::string byte_array_stop_encoding(char const stop_byte, int32_t const content_id)
+{
+    std::string args{};
+    args += stop_byte;
+    append_itf8(args, content_id);
+
+    std::string encoding{};
+    append_itf8(encoding, 5); // BYTE_ARRAY_STOP
+    append_itf8(encoding, args.size());
+    return encoding + args;
+}
+
+static std::string byte_array_len_encoding(std::string const & length_encoding,
+                                           std::string const & value_encoding)
+{
+    std::string const args = length_encoding + value_encoding;
+
+    std::string encoding{};
+    append_itf8(encoding, 4); // BYTE_ARRAY_LEN
+    append_itf8(encoding, args.size());
+    return encoding + args;
+}
+//!\}
+
+//!\brief The external block id of each data series used by the test files.
+enum series_block_id : int32_t
+{
+    id_BF = 1, id_CF, id_RI, id_RL, id_AP, id_RN, id_MF, id_NS, id_NP, id_TS, id_NF, id_TL,
+    id_FN, id_FC, id_FP, id_BS, id_IN, id_SC, id_DL, id_BA, id_QS, id_MQ, id_NM
+};
+
+//!\brief One record of a test file in terms of the CRAM data series.
+struct test_record
+{
+    int32_t bam_flags{};
+    int32_t cram_flags{1};  // 0x1 = qualities stored, 0x2 = mate detached, 0x4 = mate downstream
+    int32_t ref_id{-1};     // RI
+    int32_t read_length{};  // RL
+    int32_t position{};     // AP (1-based, 0 = unset)
+    std::string name{};     // RN
+    int32_t tag_line{0};    // TL (line 1 of the test tag dictionary carries an NM:i tag)
+    int32_t nm_tag{};       // the NM:i value (only written for tag_line == 1)
+
+    //!\brief A read feature ('X' uses value as substitution code, 'D' as length, 'S'/'I' use bases).
+    struct feature_t
+    {
+        char code{};
+        int32_t position{}; // 1-based position in the read
+        std::string bases{};
+        int32_t value{};
+    };
+    std::vector<feature_t> features{};
+
+    std::string bases{};     // BA (the verbatim sequence of unmapped records)
+    std::string qualities{}; // QS (raw phred values)
+    int32_t mapq{};          // MQ (mapped records only)
+
+    int32_t mate_flags{}, mate_ref_id{}, mate_position{}, template_length{}; // MF/NS/NP/TS (detached mates)
+    int32_t mate_distance{}; // NF (downstream mates)
+};
+
+//!\brief Serialises the compression header block data (fixed series table, see series_block_id).
+static std::string make_compression_header()
+{
+    std::string data{};
+
+    { // preservation map: absolute positions and a tag dictionary with an empty line and an NM:i line
+        std::string entries{};
+        append_itf8(entries, 2); // number of entries
+        entries += "AP";
+        entries += '\0'; // positions are not delta encoded
+        entries += "TD";
+        std::string const dictionary = std::string{"\0NMi\0", 5};
+        append_itf8(entries, dictionary.size());
+        entries += dictionary;
+
+        append_itf8(data, entries.size());
+        data += entries;
+    }
+
+    { // data series encoding map
+        std::string entries{};
+        int32_t n_entries = 0;
+        auto add = [&] (char const * series, std::string const & encoding)
+        {
+            entries += series;
+            entries += encoding;
+            ++n_entries;
+        };
+
+        add("BF", external_encoding(id_BF));
+        add("CF", external_encoding(id_CF));
+        add("RI", external_encoding(id_RI));
+        add("RL", external_encoding(id_RL));
+        add("AP", external_encoding(id_AP));
+        add("RG", huffman_constant_encoding(-1)); // no read groups (also exercises 0-bit huffman codes)
+        add("RN", byte_array_stop_encoding('\t', id_RN));
+        add("MF", external_encoding(id_MF));
+        add("NS", external_encoding(id_NS));
+        add("NP", external_encoding(id_NP));
+        add("TS", external_encoding(id_TS));
+        add("NF", external_encoding(id_NF));
+        add("TL", external_encoding(id_TL));
+        add("FN", external_encoding(id_FN));
+        add("FC", external_encoding(id_FC));
+        add("FP", external_encoding(id_FP));
+        add("BS", external_encoding(id_BS));
+        add("IN", byte_array_stop_encoding('\t', id_IN));
+        add("SC", byte_array_stop_encoding('\t', id_SC));
+        add("DL", external_encoding(id_DL));
+        add("BA", external_encoding(id_BA));
+        add("QS", external_encoding(id_QS));
+        add("MQ", external_encoding(id_MQ));
+
+        std::string map{};
+        append_itf8(map, n_entries);
+        map += entries;
+
+        append_itf8(data, map.size());
+        data += map;
+    }
+
+    { // tag encoding map (one entry: NM of type 'i')
+        std::string map{};
+        append_itf8(map, 1);
+        append_itf8(map, ('N' << 16) | ('M' << 8) | 'i');
+        map += byte_array_len_encoding(huffman_constant_encoding(4), external_encoding(id_NM));
+
+        append_itf8(data, map.size());
+        data += map;
+    }
+
+    return data;
+}
+
+//!\brief Serialises one container holding the given records in a single slice.
+static std::string make_record_container(std::vector<test_record> const & records)
+{
+    std::map<int32_t, std::string> series{}; // external block id -> encoded values
+
+    for (test_record const & record : records)
+    {
+        append_itf8(series[id_BF], record.bam_flags);
+        append_itf8(series[id_CF], record.cram_flags);
+        append_itf8(series[id_RI], record.ref_id);
+        append_itf8(series[id_RL], record.read_length);
+        append_itf8(series[id_AP], record.position);
+        series[id_RN] += record.name + '\t';
+
+        if (record.cram_flags & 0x2) // detached mate
+        {
+            append_itf8(series[id_MF], record.mate_flags);
+            append_itf8(series[id_NS], record.mate_ref_id);
+            append_itf8(series[id_NP], record.mate_position);
+            append_itf8(series[id_TS], record.template_length);
+        }
+        else if (record.cram_flags & 0x4) // downstream mate
+        {
+            append_itf8(series[id_NF], record.mate_distance);
+        }
+
+        append_itf8(series[id_TL], record.tag_line);
+        if (record.tag_line == 1)
+            append_le(series[id_NM], record.nm_tag);
+
+        if (!(record.bam_flags & 0x4)) // mapped: differences to the reference
+        {
+            append_itf8(series[id_FN], record.features.size());
+            int32_t previous_position = 0;
+            for (auto const & feature : record.features)
+            {
+                series[id_FC] += feature.code;
+                append_itf8(series[id_FP], feature.position - previous_position);
+                previous_position = feature.position;
+
+                switch (feature.code)
+                {
+                    case 'X': series[id_BS] += static_cast<char>(feature.value); break;
+                    case 'S': series[id_SC] += feature.bases + '\t';             break;
+                    case 'I': series[id_IN] += feature.bases + '\t';             break;
+                    case 'D': append_itf8(series[id_DL], feature.value);         break;
+                }
+            }
+            append_itf8(series[id_MQ], record.mapq);
+        }
+        else // unmapped: verbatim sequence
+        {
+            series[id_BA] += record.bases;
+        }
+
+        if (record.cram_flags & 0x1)
+            series[id_QS] += record.qualities;
+    }
+
+    std::string slice_header{};
+    append_itf8(slice_header, -2);             // reference sequence id (multiple references)
+    append_itf8(slice_header, 1);              // alignment start
+    append_itf8(slice_header, 34);             // alignment span
+    append_itf8(slice_header, records.size()); // number of records
+    slice_header += '\0';                      // record counter (LTF8)
+    append_itf8(slice_header, 1 + series.size()); // number of blocks (core + external)
+    append_itf8(slice_header, series.size());  // number of content ids
+    for (auto const & [content_id, values] : series)
+        append_itf8(slice_header, content_id);
+    append_itf8(slice_header, -1);             // embedded reference content id (none)
+    slice_header.append(16, '\0');             // md5 checksum of the covered reference region
+
+    std::string payload = make_block(1, 0, make_compression_header());
+    payload += make_block(2, 0, slice_header);
+    payload += make_block(5, 0, std::string{}); // the (empty) core data block
+    for (auto const & [content_id, values] : series)
+        payload += make_block(4, content_id, values);
+
+    return make_container(records.size(), payload);
+}
+
+//!\brief Serialises a whole file: definition, SAM header, one container per record batch, EOF container.
+static std::string make_file(std::string const & header_text,
+                             std::vector<std::vector<test_record>> const & containers)
+{
+    std::string file{"CRAM"};
+    file += '\3'; // major version
+    file += '\0'; // minor version
+    file.append(20, '\0'); // file id
+
+    std::string header_block_data{};
+    append_le(header_block_data, static_cast<int32_t>(header_text.size()));
+    header_block_data += header_text;
+    file += make_container(0, make_block(0, 0, header_block_data));
+
+    for (std::vector<test_record> const & records : containers)
+        file += make_record_container(records);
+
+    file += make_container(0, std::string{}); // the EOF container holds no records
+
+    return file;
+}
+
+// ----------------------------------------------------------------------------
+// general
+// ----------------------------------------------------------------------------
+
+TEST(general, concepts)
+{
+    EXPECT_TRUE((AlignmentFileInputFormat<alignment_file_format_cram>));
+    EXPECT_FALSE((AlignmentFileOutputFormat<alignment_file_format_cram>)); // CRAM is read-only
+}
+
+// ----------------------------------------------------------------------------
+// reading
+// ----------------------------------------------------------------------------
+
+struct cram_reading : public ::testing::Test
+{
+    cram_reading()
+    {
+        ref_sequences = std::vector<dna5_vector>{ref_seq};
+        ref_ids = std::vector<std::string>{ref_id};
+        header = alignment_file_header{ref_ids};
+        header.ref_id_info().emplace_back(ref_seq.size(), "");
+        header.ref_dict()[header.ref_ids()[0]] = 0; // set up header which is otherwise done on file level
+    }
+
+    dna5_vector ref_seq = "ACTGATCGAGAGGATCTAGAGGAGATCGTAGGAC"_dna5;
+    std::string ref_id = "ref";
+    std::string header_text{"@HD\tVN:1.6\n@SQ\tSN:ref\tLN:34\n"};
+
+    std::vector<dna5_vector> ref_sequences{};
+    std::vector<std::string> ref_ids{};
+    alignment_file_header<std::vector<std::string>> header{};
+};
+
+TEST_F(cram_reading, all_fields)
+{
+    /* Three records against "ACTGATCGAGAGGATCTAGAGGAGATCGTAGGAC":
+     * - a match with one substitution (read base G over the C at reference position 1)
+     * - a soft-clipped read (clip "AG", then 7 matches from reference position 1)
+     * - an unmapped read with a verbatim sequence
+     */
+    test_record substituted{};
+    substituted.bam_flags   = 41;
+    substituted.ref_id      = 0;
+    substituted.read_length = 4;
+    substituted.position    = 1;
+    substituted.name        = "read1";
+    substituted.tag_line    = 1;
+    substituted.nm_tag      = 2;
+    substituted.features    = {{'X', 2, "", 1}}; // code 1 of reference base 'C' -> 'G' (default matrix)
+    substituted.qualities   = {0, 2, 2, 3};      // "!##$"
+    substituted.mapq        = 61;
+
+    test_record clipped{};
+    clipped.bam_flags   = 42;
+    clipped.ref_id      = 0;
+    clipped.read_length = 9;
+    clipped.position    = 2;
+    clipped.name        = "read2";
+    clipped.features    = {{'S', 1, "AG", 0}};
+    clipped.qualities   = {0, 2, 2, 3, 5, 6, 7, 8, 9}; // "!##$&'()*"
+    clipped.mapq        = 62;
+
+    test_record unmapped{};
+    unmapped.bam_flags   = 4;
+    unmapped.ref_id      = -1;
+    unmapped.read_length = 4;
+    unmapped.position    = 0;
+    unmapped.name        = "read3";
+    unmapped.bases       = "GGAG";
+    unmapped.qualities   = {0, 0, 9, 10}; // "!!*+"
+
+    std::istringstream istream{make_file(header_text, {{substituted, clipped, unmapped}})};
+
+    alignment_file_format_cram format;
+
+    dna5_vector seq;
+    std::string id;
+    std::vector<phred42> qual;
+    int32_t offset;
+    std::optional<int32_t> ref_id_in;
+    std::optional<int32_t> ref_offset;
+    std::pair<std::vector<gapped<dna5>>, std::vector<gapped<dna5>>> alignment;
+    uint16_t flag;
+    uint8_t mapq;
+    std::tuple<std::optional<int32_t>, std::optional<int32_t>, int32_t> mate;
+    sam_tag_dictionary tag_dict;
+
+    auto read_record = [&] ()
+    {
+        seq.clear();
+        id.clear();
+        qual.clear();
+        offset = 0;
+        ref_id_in.reset();
+        ref_offset.reset();
+        alignment = {};
+        flag = 0;
+        mapq = 0;
+        mate = {};
+        tag_dict.clear();
+
+        format.read(istream, input_options, ref_sequences, header, seq, qual, id, offset, std::ignore,
+                    ref_id_in, ref_offset, alignment, flag, mapq, mate, tag_dict, std::ignore, std::ignore);
+    };
+
+    ASSERT_NO_THROW(read_record());
+    EXPECT_EQ(seq, "AGTG"_dna5);
+    EXPECT_EQ(id, "read1");
+    EXPECT_EQ(qual, "!##$"_phred42);
+    EXPECT_EQ(offset, 0);
+    EXPECT_EQ(ref_id_in, 0);
+    EXPECT_EQ(*ref_offset, 0);
+    EXPECT_EQ(get<0>(alignment), (std::vector<gapped<dna5>>{'A'_dna5, 'C'_dna5, 'T'_dna5, 'G'_dna5}));
+    EXPECT_EQ(get<1>(alignment), (std::vector<gapped<dna5>>{'A'_dna5, 'G'_dna5, 'T'_dna5, 'G'_dna5}));
+    EXPECT_EQ(flag, 41u);
+    EXPECT_EQ(mapq, 61u);
+    EXPECT_FALSE(get<0>(mate).has_value());
+    EXPECT_FALSE(get<1>(mate).has_value());
+    EXPECT_EQ(get<2>(mate), 0);
+    EXPECT_EQ(tag_dict.get<"NM"_tag>(), 2);
+
+    ASSERT_NO_THROW(read_record());
+    EXPECT_EQ(seq, "AGCTGATCG"_dna5);
+    EXPECT_EQ(id, "read2");
+    EXPECT_EQ(qual, "!##$&'()*"_phred42);
+    EXPECT_EQ(offset, 2); // the soft clip
+    EXPECT_EQ(ref_id_in, 0);
+    EXPECT_EQ(*ref_offset, 1);
+    EXPECT_EQ(get<0>(alignment), (std::vector<gapped<dna5>>{'C'_dna5, 'T'_dna5, 'G'_dna5, 'A'_dna5,
+                                                            'T'_dna5, 'C'_dna5, 'G'_dna5}));
+    EXPECT_EQ(get<1>(alignment), (std::vector<gapped<dna5>>{'C'_dna5, 'T'_dna5, 'G'_dna5, 'A'_dna5,
+                                                            'T'_dna5, 'C'_dna5, 'G'_dna5}));
+    EXPECT_EQ(flag, 42u);
+    EXPECT_EQ(mapq, 62u);
+    EXPECT_TRUE(tag_dict.empty());
+
+    ASSERT_NO_THROW(read_record());
+    EXPECT_EQ(seq, "GGAG"_dna5);
+    EXPECT_EQ(id, "read3");
+    EXPECT_EQ(qual, "!!*+"_phred42);
+    EXPECT_FALSE(ref_id_in.has_value());
+    EXPECT_FALSE(ref_offset.has_value());
+    EXPECT_EQ(flag, 4u);
+    EXPECT_EQ(mapq, 255u); // unavailable
+
+    // the stream was read up to its end (the EOF container was skipped), as the file level relies on
+    EXPECT_EQ(istream.peek(), std::char_traits<char>::eof());
+}
+
+TEST_F(cram_reading, mates)
+{
+    // a pair within one slice (mate stored as the downstream distance) ...
+    test_record first{};
+    first.bam_flags   = 0x1 | 0x40;
+    first.cram_flags  = 0x1 | 0x4; // the mate is the next record
+    first.ref_id      = 0;
+    first.read_length = 4;
+    first.position    = 1;
+    first.name        = "pair1";
+    first.qualities   = {0, 0, 0, 0};
+    first.mapq        = 60;
+
+    test_record second{};
+    second.bam_flags   = 0x1 | 0x80;
+    second.ref_id      = 0;
+    second.read_length = 4;
+    second.position    = 11;
+    second.name        = "pair1";
+    second.qualities   = {0, 0, 0, 0};
+    second.mapq        = 60;
+
+    // ... and a record whose mate is stored explicitly (detached)
+    test_record detached{};
+    detached.bam_flags       = 0x1;
+    detached.cram_flags      = 0x1 | 0x2;
+    detached.ref_id          = 0;
+    detached.read_length     = 4;
+    detached.position        = 6;
+    detached.name            = "solo1";
+    detached.qualities       = {0, 0, 0, 0};
+    detached.mapq            = 33;
+    detached.mate_flags      = 0x1; // the mate is reverse complemented
+    detached.mate_ref_id     = 0;
+    detached.mate_position   = 25;
+    detached.template_length = -100;
+
+    std::istringstream istream{make_file(header_text, {{first, second, detached}})};
+
+    alignment_file_format_cram format;
+
+    uint16_t flag;
+    std::tuple<std::optional<int32_t>, std::optional<int32_t>, int32_t> mate;
+
+    auto read_record = [&] ()
+    {
+        flag = 0;
+        mate = {};
+        format.read(istream, input_options, ref_sequences, header, std::ignore, std::ignore, std::ignore,
+                    std::ignore, std::ignore, std::ignore, std::ignore, std::ignore, flag, std::ignore, mate,
+                    std::ignore, std::ignore, std::ignore);
+    };
+
+    ASSERT_NO_THROW(read_record());
+    EXPECT_EQ(flag, 0x1u | 0x40u);
+    EXPECT_EQ(get<0>(mate), 0);
+    EXPECT_EQ(get<1>(mate), 10);          // the second record's position
+    EXPECT_EQ(get<2>(mate), 14);          // from the leftmost start (0) to the rightmost end (14)
+
+    ASSERT_NO_THROW(read_record());
+    EXPECT_EQ(flag, 0x1u | 0x80u);
+    EXPECT_EQ(get<0>(mate), 0);
+    EXPECT_EQ(get<1>(mate), 0);           // the first record's position
+    EXPECT_EQ(get<2>(mate), -14);
+
+    ASSERT_NO_THROW(read_record());
+    EXPECT_EQ(flag, 0x1u | 0x20u);        // the mate-reversed flag comes from the MF series
+    EXPECT_EQ(get<0>(mate), 0);
+    EXPECT_EQ(get<1>(mate), 24);
+    EXPECT_EQ(get<2>(mate), -100);
+}
+
+TEST_F(cram_reading, multiple_containers)
+{
+    test_record plain{};
+    plain.bam_flags   = 0;
+    plain.ref_id      = 0;
+    plain.read_length = 4;
+    plain.position    = 1;
+    plain.qualities   = {0, 0, 0, 0};
+    plain.mapq        = 60;
+
+    test_record other = plain;
+    other.position = 5;
+    other.name     = "read2";
+    plain.name     = "read1";
+
+    std::istringstream istream{make_file(header_text, {{plain}, {other}})};
+
+    alignment_file_format_cram format;
+
+    std::string id;
+    std::optional<int32_t> ref_offset;
+
+    for (auto const & [expected_id, expected_offset] : {std::pair<std::string, int32_t>{"read1", 0},
+                                                        std::pair<std::string, int32_t>{"read2", 4}})
+    {
+        id.clear();
+        ref_offset.reset();
+
+        ASSERT_NO_THROW(format.read(istream, input_options, ref_sequences, header, std::ignore, std::ignore, id,
+                                    std::ignore, std::ignore, std::ignore, ref_offset, std::ignore, std::ignore,
+                                    std::ignore, std::ignore, std::ignore, std::ignore, std::ignore));
+        EXPECT_EQ(id, expected_id);
+        EXPECT_EQ(*ref_offset, expected_offset);
+    }
+
+    EXPECT_EQ(istream.peek(), std::char_traits<char>::eof());
+}
+
+TEST_F(cram_reading, header)
+{
+    std::string const text{"@HD\tVN:1.6\tSO:coordinate\n"
+                           "@SQ\tSN:ref\tLN:34\n"
+                           "@RG\tID:group1\tmore info\n"
+                           "@PG\tID:prog1\tPN:cool_program\tCL:./prog1\tVN:1.0\n"
+                           "@CO\tThis is a comment.\n"};
+
+    std::istringstream istream{make_file(text, {})};
+
+    alignment_file_format_cram format;
+    alignment_file_header<> read_header{};
+
+    ASSERT_NO_THROW(format.read(istream, input_options, std::ignore, read_header, std::ignore, std::ignore,
+                                std::ignore, std::ignore, std::ignore, std::ignore, std::ignore, std::ignore,
+                                std::ignore, std::ignore, std::ignore, std::ignore, std::ignore, std::ignore));
+
+    EXPECT_EQ(read_header.sorting, "coordinate");
+    ASSERT_EQ(read_header.ref_ids().size(), 1u);
+    EXPECT_EQ(read_header.ref_ids()[0], ref_id);
+    EXPECT_EQ(read_header.ref_id_info()[0], (std::tuple<int32_t, std::string>{34, ""}));
+    ASSERT_EQ(read_header.read_groups.size(), 1u);
+    EXPECT_EQ(read_header.read_groups[0].first, "group1");
+    EXPECT_EQ(read_header.program_infos[0].id, "prog1");
+    EXPECT_EQ(read_header.comments[0], "This is a comment.");
+}
+
+// ----------------------------------------------------------------------------
+// format errors
+// ----------------------------------------------------------------------------
+
+struct cram_format_error : public cram_reading
+{};
+
+TEST_F(cram_format_error, wrong_magic_bytes)
+{
+    alignment_file_format_cram format;
+
+    std::istringstream istream{std::string{"CRAN"}};
+
+    alignment_file_header<> read_header{};
+
+    EXPECT_THROW(format.read(istream, input_options, std::ignore, read_header, std::ignore, std::ignore,
+                             std::ignore, std::ignore, std::ignore, std::ignore, std::ignore, std::ignore,
+                             std::ignore, std::ignore, std::ignore, std::ignore, std::ignore, std::ignore),
+                 format_error);
+}
+
+TEST_F(cram_format_error, unsupported_version)
+{
+    alignment_file_format_cram format;
+
+    std::string file_content = make_file(header_text, {});
+    file_content[4] = '\2'; // only major version 3 is supported
+
+    std::istringstream istream{file_content};
+    alignment_file_header<> read_header{};
+
+    EXPECT_THROW(format.read(istream, input_options, std::ignore, read_header, std::ignore, std::ignore,
+                             std::ignore, std::ignore, std::ignore, std::ignore, std::ignore, std::ignore,
+                             std::ignore, std::ignore, std::ignore, std::ignore, std::ignore, std::ignore),
+                 format_error);
+}
+
+TEST_F(cram_format_error, truncated_file)
+{
+    test_record plain{};
+    plain.bam_flags   = 0;
+    plain.ref_id      = 0;
+    plain.read_length = 4;
+    plain.position    = 1;
+    plain.name        = "read1";
+    plain.qualities   = {0, 0, 0, 0};
+    plain.mapq        = 60;
+
+    std::string file_content = make_file(header_text, {{plain}});
+    file_content.resize(file_content.size() * 2 / 3); // cut off inside the record container
+
+    std::istringstream istream{file_content};
+
+    alignment_file_format_cram format;
+    alignment_file_header<> read_header{};
+
+    EXPECT_THROW(format.read(istream, input_options, std::ignore, read_header, std::ignore, std::ignore,
+                             std::ignore, std::ignore, std::ignore, std::ignore, std::ignore, std::ignore,
+                             std::ignore, std::ignore, std::ignore, std::ignore, std::ignore, std::ignore),
+                 format_error);
+}
+
+TEST_F(cram_format_error, unsupported_compression_method)
+{
+    alignment_file_format_cram format;
+
+    // a file whose SAM header block claims to be bzip2 compressed
+    std::string header_block_data{};
+    append_le(header_block_data, static_cast<int32_t>(header_text.size()));
+    header_block_data += header_text;
+    std::string block = make_block(0, 0, header_block_data);
+    block[0] = '\2'; // bzip2 (the checksum is not relevant, the method is rejected first)
+
+    std::string file_content{"CRAM"};
+    file_content += '\3';
+    file_content += '\0';
+    file_content.append(20, '\0');
+    file_content += make_container(0, block);
+
+    std::istringstream istream{file_content};
+    alignment_file_header<> read_header{};
+
+    EXPECT_THROW(format.read(istream, input_options, std::ignore, read_header, std::ignore, std::ignore,
+                             std::ignore, std::ignore, std::ignore, std::ignore, std::ignore, std::ignore,
+                             std::ignore, std::ignore, std::ignore, std::ignore, std::ignore, std::ignore),
+                 format_error);
+}
@@ -41,8 +41,8 @@ struct reading_sam : public ::testing::Test
         ref_sequences = std::vector<dna5_vector>{ref_seq};
         ref_ids = std::vector<std::string>{ref_id};
         header = alignment_file_header{ref_ids};
-        header.ref_id_info.emplace_back(ref_seq.size(), "");
-        header.ref_dict[header.ref_ids()[0]] = 0; // set up header which is otherwise done on file level
+        header.ref_id_info().emplace_back(ref_seq.size(), "");
+        header.ref_dict()[header.ref_ids()[0]] = 0; // set up header which is otherwise done on file level
     }
 
     std::vector<dna5_vector> seqs
@@ -183,8 +183,8 @@ R"(@HD	VN:1.0	SO:coordinate	SS:coordinate:queryname	GO:none
     std::string id1{"ref"};
     std::string id2{"ref2"};
 
-    EXPECT_EQ(header.ref_id_info[(header.ref_dict[id1])], (std::tuple<uint32_t, std::string>{249250621u, ""}));
-    EXPECT_EQ(header.ref_id_info[(header.ref_dict[id2])], (std::tuple<uint32_t, std::string>{243199373u, "AS:hs37d5"}));
+    EXPECT_EQ(header.ref_id_info()[(header.ref_dict()[id1])], (std::tuple<uint32_t, std::string>{249250621u, ""}));
+    EXPECT_EQ(header.ref_id_info()[(header.ref_dict()[id2])], (std::tuple<uint32_t, std::string>{243199373u, "AS:hs37d5"}));
 
     EXPECT_EQ(header.read_groups[0],
               (std::pair<std::string, std::string>{"U0a_A2_L1", "PL:illumina\tPU:1\tLB:1\tSM:NA12878"}));
@@ -194,6 +194,39 @@ R"(@HD	VN:1.0	SO:coordinate	SS:coordinate:queryname	GO:none
     EXPECT_EQ(header.comments[0], "Tralalalalalala this is a comment");
 }
 
+TEST_F(read_header, deferred_sq_lines)
+{
+    alignment_file_format_sam format;
+
+    // without given reference information the @SQ lines are only tokenised on first access
+    std::string header_str{"@HD\tVN:1.0\n"};
+    for (size_t i = 0; i < 100u; ++i)
+        header_str += "@SQ\tSN:contig_" + std::to_string(i) + "\tLN:" + std::to_string(100 + i) + "\n";
+
+    std::istringstream istream(header_str);
+
+    alignment_file_header header{};
+
+    ASSERT_NO_THROW(format.read(istream, input_options, std::ignore, header,  std::ignore, std::ignore, std::ignore,
+                                std::ignore, std::ignore, std::ignore, std::ignore, std::ignore, std::ignore,
+                                std::ignore, std::ignore, std::ignore, std::ignore, std::ignore));
+
+    EXPECT_EQ(header.ref_ids().size(), 100u);         // materialises all buffered lines
+    EXPECT_EQ(header.ref_dict().size(), 100u);
+    EXPECT_EQ(header.ref_id_info().size(), 100u);
+
+    for (size_t i : {0u, 1u, 50u, 99u})
+    {
+        EXPECT_EQ(header.ref_ids()[i], "contig_" + std::to_string(i));
+        auto it = header.ref_dict().find(header.ref_ids()[i]);
+        ASSERT_NE(it, header.ref_dict().end());
+        EXPECT_EQ(it->second, static_cast<int32_t>(i));
+        EXPECT_EQ(header.ref_id_info()[i], (std::tuple<int32_t, std::string>{100 + i, ""}));
+    }
+
+    EXPECT_EQ(header.ref_dict().count(std::string{"contig_100"}), 0u);
+}
+
 TEST_F(read_header, errors)
 {
     alignment_file_format_sam format;
@@ -346,6 +379,44 @@ TEST_F(reading_sam, read_in_all_data)
     }
 }
 
+TEST_F(reading_sam, read_in_tags_lazily)
+{
+    alignment_file_format_sam format;
+
+    alignment_file_input_options<dna5> lazy_options;
+    lazy_options.lazy_tags = true;
+
+    std::string file_in_str
+    {
+        "read1\t41\tref\t1\t61\t*\t=\t10\t300\tACGT\t!##$\taa:A:c\tAS:i:2\tff:f:3.1\tzz:Z:str\n"
+    };
+
+    std::string id;
+    sam_tag_dictionary tag_dict;
+
+    std::istringstream istream(file_in_str);
+
+    ASSERT_NO_THROW(format.read(istream, lazy_options, std::ignore, header, std::ignore, std::ignore, id,
+                                std::ignore, std::ignore, std::ignore, std::ignore, std::ignore, std::ignore,
+                                std::ignore, std::ignore, tag_dict, std::ignore, std::ignore));
+
+    EXPECT_EQ(id, ids[0]);
+    EXPECT_TRUE(tag_dict.empty()); // the tags were not parsed eagerly
+    EXPECT_EQ(tag_dict.raw_tags(), "aa:A:c\tAS:i:2\tff:f:3.1\tzz:Z:str");
+
+    EXPECT_EQ(tag_dict.get<"AS"_tag>(), 2); // parsed on first access
+
+    tag_dict.materialize();
+
+    sam_tag_dictionary expected_dict{};
+    expected_dict.get<"AS"_tag>() = 2;
+    expected_dict["aa"_tag] = 'c';
+    expected_dict["ff"_tag] = 3.1f;
+    expected_dict["zz"_tag] = "str";
+
+    EXPECT_EQ(tag_dict, expected_dict);
+}
+
 TEST_F(reading_sam, read_in_all_but_empty_data)
 {
     alignment_file_format_sam format;
@@ -690,8 +761,8 @@ TEST_F(writing_sam, default_options_all_members_specified)
     std::ostringstream ostream;
 
     alignment_file_header header{std::vector<std::string>{ref_id}};
-    header.ref_id_info.push_back({ref_seq.size(), ""});
-    header.ref_dict[ref_id] = 0;
+    header.ref_id_info().push_back({ref_seq.size(), ""});
+    header.ref_dict()[ref_id] = 0;
 
     tag_dicts[0].get<"NM"_tag>() = 7;
     tag_dicts[0].get<"AS"_tag>() = 2;
@@ -715,6 +786,34 @@ read3	43	ref	3	63	1S1M1D1M1I1M1I1D1M1S	ref	10	300	GGAGTATA	!!*+,-./
     EXPECT_EQ(ostream.str(), comp);
 }
 
+TEST_F(writing_sam, unmaterialized_raw_tags_are_written_back)
+{
+    alignment_file_format_sam format;
+
+    std::ostringstream ostream;
+
+    alignment_file_header header{std::vector<std::string>{ref_id}};
+    header.ref_id_info().push_back({ref_seq.size(), ""});
+    header.ref_dict()[ref_id] = 0;
+
+    tag_dicts[0].get<"NM"_tag>() = 7;                 // a parsed tag ...
+    tag_dicts[0].assign_raw_tags("xa:A:c\tzz:Z:str"); // ... and raw tags that were never accessed
+
+    std::string comp =
+R"(@HD	VN:1.6
+@SQ	SN:ref	LN:34
+read1	41	ref	1	61	1S1M1D1M1I	ref	10	300	ACGT	!##$	NM:i:7	xa:A:c	zz:Z:str
+)";
+
+    ASSERT_NO_THROW(format.write(ostream, output_options, header, seqs[0], quals[0], ids[0], offsets[0],
+                                 std::string{}, 0, ref_offsets[0], alignments[0], flags[0], mapqs[0], mates[0],
+                                 tag_dicts[0], 0, 0));
+
+    ostream.flush();
+
+    EXPECT_EQ(ostream.str(), comp);
+}
+
 TEST_F(writing_sam, with_header)
 {
     alignment_file_format_sam format;
@@ -724,8 +823,8 @@ TEST_F(writing_sam, with_header)
     alignment_file_header header{std::vector<std::string>{ref_id}};
     header.sorting = "unknown";
     header.grouping = "none";
-    header.ref_id_info.push_back({ref_seq.size(), "AN:other_name"});
-    header.ref_dict[ref_id] = 0;
+    header.ref_id_info().push_back({ref_seq.size(), "AN:other_name"});
+    header.ref_dict()[ref_id] = 0;
     header.program_infos.push_back({"prog1", "cool_program", "./prog1", "a", "b", "c"});
     header.read_groups.emplace_back("group1", "more info");
     header.comments.push_back("This is a comment.");
@@ -760,8 +859,8 @@ TEST_F(writing_sam, write_different_header)
     std::ostringstream ostream;
 
     alignment_file_header header{std::vector<std::string>{ref_id}};
-    header.ref_id_info.push_back({ref_seq.size(), ""});
-    header.ref_dict[ref_id] = 0;
+    header.ref_id_info().push_back({ref_seq.size(), ""});
+    header.ref_dict()[ref_id] = 0;
 
     auto write_header = [&] ()
     {
@@ -806,8 +905,8 @@ TEST_F(writing_sam, special_cases)
     alignment_file_format_sam format;
 
     alignment_file_header header{std::vector<std::string>{ref_id}};
-    header.ref_id_info.push_back({ref_seq.size(), ""});
-    header.ref_dict[ref_id] = 0;
+    header.ref_id_info().push_back({ref_seq.size(), ""});
+    header.ref_dict()[ref_id] = 0;
 
     std::ostringstream ostream;
 
@@ -843,8 +942,8 @@ TEST_F(writing_sam, format_errors)
     alignment_file_format_sam format;
 
     alignment_file_header header{std::vector<std::string>{ref_id}};
-    header.ref_id_info.push_back({ref_seq.size(), ""});
-    header.ref_dict[ref_id] = 0;
+    header.ref_id_info().push_back({ref_seq.size(), ""});
+    header.ref_dict()[ref_id] = 0;
 
     std::ostringstream ostream;
 
@@ -159,3 +159,74 @@ TEST(sam_tag_dictionary, get_function_temporary_const)
     EXPECT_TRUE((std::is_rvalue_reference_v<decltype(std::move(dict2).get<"CO"_tag>())>));
     EXPECT_TRUE((std::is_rvalue_reference_v<decltype(std::move(dict2).get<"CG"_tag>())>));
 }
+
+TEST(sam_tag_dictionary, lazy_parsing_get)
+{
+    sam_tag_dictionary dict{};
+
+    dict.assign_raw_tags("AS:i:3\tNM:i:7\tCO:Z:comment\tCG:B:i,3,4,5");
+
+    EXPECT_EQ(dict.size(), 0u); // nothing is parsed until a tag is accessed
+
+    EXPECT_EQ(dict.get<"NM"_tag>(), 7); // materializes only NM
+    EXPECT_EQ(dict.size(), 1u);
+    EXPECT_EQ(dict.raw_tags(), "AS:i:3\tCO:Z:comment\tCG:B:i,3,4,5");
+
+    EXPECT_EQ(dict.get<"AS"_tag>(), 3); // first field
+    EXPECT_EQ(dict.get<"CG"_tag>(), (std::vector<int32_t>{3, 4, 5})); // last field
+    EXPECT_EQ(dict.get<"CO"_tag>(), "comment");
+
+    EXPECT_TRUE(dict.raw_tags().empty());
+    EXPECT_EQ(dict.size(), 4u);
+}
+
+TEST(sam_tag_dictionary, lazy_parsing_absent_tag_default_initializes)
+{
+    sam_tag_dictionary dict{};
+
+    dict.assign_raw_tags("AS:i:3");
+
+    EXPECT_EQ(dict.get<"NM"_tag>(), 0); // not in the raw text -> default initialized as before
+    EXPECT_EQ(dict.raw_tags(), "AS:i:3");
+}
+
+TEST(sam_tag_dictionary, lazy_parsing_materialize)
+{
+    using variant_type = sam_tag_dictionary::variant_type;
+
+    sam_tag_dictionary dict{};
+
+    dict.get<"NM"_tag>() = 5;
+    dict.assign_raw_tags("NM:i:7\taa:A:c\tff:f:3.5\tbc:B:c,-3\tbS:B:S,3,4");
+
+    dict.materialize();
+
+    EXPECT_TRUE(dict.raw_tags().empty());
+    EXPECT_EQ(dict.size(), 5u);
+    EXPECT_EQ(dict.get<"NM"_tag>(), 5); // explicitly set values take precedence over raw text
+    EXPECT_EQ(dict["aa"_tag], variant_type{'c'});
+    EXPECT_EQ(dict["ff"_tag], variant_type{3.5f});
+    EXPECT_EQ(dict["bc"_tag], variant_type{(std::vector<int8_t>{-3})});
+    EXPECT_EQ(dict["bS"_tag], variant_type{(std::vector<uint16_t>{3u, 4u})});
+}
+
+TEST(sam_tag_dictionary, lazy_parsing_errors)
+{
+    {
+        sam_tag_dictionary dict{};
+        dict.assign_raw_tags("NM:i:3blub");
+        EXPECT_THROW(dict.get<"NM"_tag>(), format_error);
+    }
+
+    {
+        sam_tag_dictionary dict{};
+        dict.assign_raw_tags("NM:x:3"); // unknown type identifier
+        EXPECT_THROW(dict.get<"NM"_tag>(), format_error);
+    }
+
+    {
+        sam_tag_dictionary dict{};
+        dict.assign_raw_tags("NM"); // malformed field
+        EXPECT_THROW(dict.get<"NM"_tag>(), format_error);
+    }
+}
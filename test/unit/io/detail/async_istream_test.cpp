@@ -0,0 +1,97 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <sstream>
+#include <string>
+
+#include <seqan3/io/detail/async_istream.hpp>
+
+using namespace seqan3;
+
+//!\brief Generates pseudo random text.
+static std::string random_text(size_t const length)
+{
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<uint8_t> dis('A', 'Z');
+
+    std::string text(length, '\0');
+    for (char & c : text)
+        c = dis(gen);
+    return text;
+}
+
+TEST(async_istream, small_input)
+{
+    std::string const text{"The quick brown fox jumps over the lazy dog"};
+
+    std::istringstream source{text};
+    detail::async_istream<char> stream{source};
+
+    std::string const read_back{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+    EXPECT_EQ(read_back, text);
+}
+
+TEST(async_istream, multiple_buffer_swaps)
+{
+    // a buffer size much smaller than the input forces many ping-pong swaps
+    std::string const text = random_text(100'000);
+
+    std::istringstream source{text};
+    detail::async_istream<char> stream{source, 512};
+
+    std::string const read_back{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+    EXPECT_EQ(read_back, text);
+}
+
+TEST(async_istream, empty_input)
+{
+    std::istringstream source{};
+    detail::async_istream<char> stream{source};
+
+    EXPECT_EQ(stream.get(), std::char_traits<char>::eof());
+    EXPECT_TRUE(stream.eof());
+}
+
+TEST(async_istream, putback_across_buffers)
+{
+    std::string const text = random_text(4096);
+
+    std::istringstream source{text};
+    detail::async_istream<char> stream{source, 1024}; // swaps exactly at multiples of 1024
+
+    for (size_t i = 0; i < text.size(); ++i)
+    {
+        char c{};
+        ASSERT_TRUE(stream.get(c));
+        ASSERT_EQ(c, text[i]);
+
+        if (i > 0 && i % 1024 == 0) // we just crossed a buffer border
+        {
+            ASSERT_TRUE(stream.putback(text[i]));
+            ASSERT_TRUE(stream.get(c));
+            ASSERT_EQ(c, text[i]);
+        }
+    }
+
+    EXPECT_EQ(stream.get(), std::char_traits<char>::eof());
+}
+
+TEST(async_istream, destruction_without_draining)
+{
+    // destroying the stream while the background thread still holds data must not hang
+    std::string const text = random_text(100'000);
+
+    std::istringstream source{text};
+    detail::async_istream<char> stream{source, 512};
+
+    char c{};
+    ASSERT_TRUE(stream.get(c));
+    EXPECT_EQ(c, text[0]);
+}
@@ -0,0 +1,146 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+
+#include <seqan3/io/detail/fast_istreambuf_iterator.hpp>
+#include <seqan3/io/detail/fast_streambuf_skip.hpp>
+#include <seqan3/std/iterator>
+
+using namespace seqan3;
+
+//!\brief A stream buffer whose get area holds at most `chunk` characters, exercising the refill path.
+struct trickling_streambuf : std::streambuf
+{
+    std::string data{};
+    size_t position{0};
+    size_t chunk{0};
+    char window[16];
+
+    trickling_streambuf(std::string data_, size_t const chunk_) : data{std::move(data_)}, chunk{chunk_}
+    {}
+
+    int_type underflow() override
+    {
+        if (gptr() < egptr())
+            return traits_type::to_int_type(*gptr());
+        if (position >= data.size())
+            return traits_type::eof();
+
+        size_t const n = std::min(chunk, data.size() - position);
+        std::copy_n(data.begin() + position, n, &window[0]);
+        position += n;
+        setg(&window[0], &window[0], &window[0] + n);
+        return traits_type::to_int_type(*gptr());
+    }
+};
+
+TEST(fast_istreambuf_iterator, concept_check)
+{
+    using iterator_t = detail::fast_istreambuf_iterator<char>;
+    EXPECT_TRUE((std::InputIterator<iterator_t>));
+    EXPECT_TRUE((std::Sentinel<std::ranges::default_sentinel_t, iterator_t>));
+}
+
+TEST(fast_istreambuf_iterator, drain_stream)
+{
+    std::istringstream stream{"hello world"};
+
+    std::string out{};
+    for (detail::fast_istreambuf_iterator<char> it{*stream.rdbuf()}; it != std::ranges::default_sentinel; ++it)
+        out += *it;
+
+    EXPECT_EQ(out, "hello world");
+}
+
+TEST(fast_istreambuf_iterator, empty_stream)
+{
+    std::istringstream stream{};
+
+    detail::fast_istreambuf_iterator<char> it{*stream.rdbuf()};
+    EXPECT_TRUE(it == std::ranges::default_sentinel);
+    EXPECT_TRUE(std::ranges::default_sentinel == it);
+    EXPECT_FALSE(it != std::ranges::default_sentinel);
+}
+
+TEST(fast_istreambuf_iterator, refill_across_buffer_edges)
+{
+    std::string const expected{"abcdefghijklmnopqrstuvwxyz"};
+
+    for (size_t const chunk : {1u, 3u, 7u})
+    {
+        trickling_streambuf buffer{expected, chunk};
+
+        std::string out{};
+        for (detail::fast_istreambuf_iterator<char> it{buffer}; it != std::ranges::default_sentinel; it++)
+            out += *it;
+
+        EXPECT_EQ(out, expected);
+    }
+}
+
+TEST(fast_istreambuf_iterator, copies_share_stream_state)
+{
+    std::istringstream stream{"xyz"};
+
+    detail::fast_istreambuf_iterator<char> it{*stream.rdbuf()};
+    auto it2 = it; // single-pass semantics as with std::istreambuf_iterator
+
+    ++it;
+    EXPECT_EQ(*it2, 'y');
+
+    ++it2;
+    ++it2;
+    EXPECT_TRUE(it == std::ranges::default_sentinel);
+}
+
+TEST(fast_istreambuf_iterator, interoperates_with_fast_skip_until)
+{
+    trickling_streambuf buffer{"skipped_column\tnext_column", 4};
+
+    detail::fast_istreambuf_iterator<char> it{buffer};
+    detail::fast_skip_until(buffer, '\t');
+
+    EXPECT_EQ(*it, '\t'); // the iterator sees the stream position move
+    ++it;
+
+    std::string out{};
+    for (; it != std::ranges::default_sentinel; ++it)
+        out += *it;
+    EXPECT_EQ(out, "next_column");
+}
+
+TEST(fast_istreambuf_iterator, chunk_access)
+{
+    trickling_streambuf buffer{"abcdefghij", 4};
+
+    detail::fast_istreambuf_iterator<char> it{buffer};
+
+    auto chunk = it.chunk();
+    ASSERT_EQ(chunk.size(), 4u);
+    EXPECT_EQ(std::string(chunk.begin(), chunk.end()), "abcd");
+
+    // consuming part of the chunk moves the iterator accordingly
+    it.chunk_advance(2u);
+    EXPECT_EQ(*it, 'c');
+
+    // consuming the rest of the get area rebuffers eagerly
+    it.chunk_advance(2u);
+    chunk = it.chunk();
+    ASSERT_EQ(chunk.size(), 4u);
+    EXPECT_EQ(std::string(chunk.begin(), chunk.end()), "efgh");
+
+    // draining everything reaches the sentinel with an empty chunk
+    it.chunk_advance(4u);
+    it.chunk_advance(2u);
+    EXPECT_TRUE(it == std::ranges::default_sentinel);
+    EXPECT_EQ(it.chunk().size(), 0u);
+}
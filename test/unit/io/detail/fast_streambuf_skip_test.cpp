@@ -0,0 +1,74 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <seqan3/io/detail/fast_streambuf_skip.hpp>
+#include <seqan3/test/tmp_filename.hpp>
+
+using namespace seqan3;
+
+TEST(fast_skip_until, single_delimiter)
+{
+    std::istringstream stream{"skipped_column\tnext_column"};
+
+    detail::fast_skip_until(*stream.rdbuf(), '\t');
+
+    EXPECT_EQ(stream.get(), '\t'); // the delimiter itself is not consumed
+    std::string rest{};
+    stream >> rest;
+    EXPECT_EQ(rest, "next_column");
+}
+
+TEST(fast_skip_until, delimiter_at_current_position)
+{
+    std::istringstream stream{"\tfoo"};
+
+    detail::fast_skip_until(*stream.rdbuf(), '\t');
+
+    EXPECT_EQ(stream.get(), '\t');
+}
+
+TEST(fast_skip_until, multiple_delimiters)
+{
+    std::istringstream stream{"quality_column\r\nnext_record"};
+
+    detail::fast_skip_until(*stream.rdbuf(), '\t', '\r', '\n');
+
+    EXPECT_EQ(stream.get(), '\r'); // stops at whichever delimiter comes first
+}
+
+TEST(fast_skip_until, end_of_input_throws)
+{
+    std::istringstream stream{"no delimiter in here"};
+
+    EXPECT_THROW(detail::fast_skip_until(*stream.rdbuf(), '\t'), unexpected_end_of_input);
+}
+
+TEST(fast_skip_until, across_buffer_refills)
+{
+    // a file stream refills its get area in chunks; make the delimiter appear long after the first chunk
+    std::string const text = std::string(100'000, 'A') + "\tB";
+
+    test::tmp_filename filename{"fast_streambuf_skip_test.txt"};
+    {
+        std::ofstream of{filename.get_path()};
+        of << text;
+    }
+
+    std::ifstream stream{filename.get_path()};
+    ASSERT_TRUE(stream.good());
+
+    detail::fast_skip_until(*stream.rdbuf(), '\t');
+
+    EXPECT_EQ(stream.get(), '\t');
+    EXPECT_EQ(stream.get(), 'B');
+}
@@ -0,0 +1,103 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <string>
+
+#include <seqan3/io/detail/mmap_istream.hpp>
+#include <seqan3/test/tmp_filename.hpp>
+
+using namespace seqan3;
+
+#ifdef SEQAN3_HAS_MMAP
+
+TEST(mmap_istream, read_whole_file)
+{
+    std::string const text{"> seq1\nACGTACGTAC\n> seq2\nGGGGTTTTAA\n"};
+
+    test::tmp_filename filename{"mmap_istream_test.fasta"};
+    {
+        std::ofstream of{filename.get_path()};
+        of << text;
+    }
+
+    detail::mmap_istream<char> stream{filename.get_path()};
+    ASSERT_TRUE(stream.is_open());
+    EXPECT_TRUE(stream.good());
+
+    std::string const read_back{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+    EXPECT_EQ(read_back, text);
+    EXPECT_EQ(stream.get(), std::char_traits<char>::eof());
+}
+
+TEST(mmap_istream, empty_file)
+{
+    test::tmp_filename filename{"mmap_istream_test_empty"};
+    {
+        std::ofstream of{filename.get_path()};
+    }
+
+    detail::mmap_istream<char> stream{filename.get_path()};
+    ASSERT_TRUE(stream.is_open());
+    EXPECT_EQ(stream.get(), std::char_traits<char>::eof());
+}
+
+TEST(mmap_istream, putback)
+{
+    test::tmp_filename filename{"mmap_istream_test_putback"};
+    {
+        std::ofstream of{filename.get_path()};
+        of << "ACGT";
+    }
+
+    detail::mmap_istream<char> stream{filename.get_path()};
+
+    char c{};
+    ASSERT_TRUE(stream.get(c));
+    EXPECT_EQ(c, 'A');
+    ASSERT_TRUE(stream.putback('A')); // needed by make_secondary_istream's magic byte detection
+    ASSERT_TRUE(stream.get(c));
+    EXPECT_EQ(c, 'A');
+}
+
+TEST(mmap_istream, single_pass)
+{
+    // big enough that the get area window advances and consumed pages are dropped behind it
+    std::string text{};
+    for (size_t i = 0; i < 9'000'000; ++i)
+        text += "ACGTACGTAC"[i % 10];
+
+    test::tmp_filename filename{"mmap_istream_test_single_pass"};
+    {
+        std::ofstream of{filename.get_path()};
+        of << text;
+    }
+
+    detail::mmap_istream<char> stream{filename.get_path(), true};
+    ASSERT_TRUE(stream.is_open());
+
+    std::string const read_back{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+    EXPECT_EQ(read_back, text);
+    EXPECT_EQ(stream.get(), std::char_traits<char>::eof());
+
+    // evicted regions can still be seeked to and re-read (they are just fetched again)
+    stream.clear();
+    ASSERT_TRUE(stream.seekg(0));
+    EXPECT_EQ(stream.get(), 'A');
+    EXPECT_EQ(stream.get(), 'C');
+}
+
+TEST(mmap_istream, nonexistent_file)
+{
+    detail::mmap_istream<char> stream{"/nonexistent/path/mmap_istream_test"};
+    EXPECT_FALSE(stream.is_open());
+    EXPECT_TRUE(stream.fail());
+}
+
+#endif // SEQAN3_HAS_MMAP
@@ -0,0 +1,92 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <atomic>
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <seqan3/io/for_each_record_parallel.hpp>
+#include <seqan3/io/sequence_file/input.hpp>
+
+using namespace seqan3;
+
+std::string fasta_with_records(size_t const count)
+{
+    std::string input{};
+    for (size_t i = 0; i < count; ++i)
+        input += "> record" + std::to_string(i) + "\nACGT\n";
+    return input;
+}
+
+TEST(for_each_record_parallel, results_keep_record_order)
+{
+    sequence_file_input fin{std::istringstream{fasta_with_records(100)}, sequence_file_format_fasta{}};
+
+    // later records finish first on purpose; the collected ids must still be in file order
+    std::vector<std::string> ids = for_each_record_parallel(fin, [] (auto & record)
+    {
+        std::string id = get<field::ID>(record);
+        if (id.back() % 3 == 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        return id;
+    }, 4u);
+
+    ASSERT_EQ(ids.size(), 100u);
+    for (size_t i = 0; i < ids.size(); ++i)
+        EXPECT_EQ(ids[i], "record" + std::to_string(i));
+}
+
+TEST(for_each_record_parallel, streaming_consumer)
+{
+    sequence_file_input fin{std::istringstream{fasta_with_records(100)}, sequence_file_format_fasta{}};
+
+    std::vector<std::string> ids{};
+    for_each_record_parallel(fin,
+                             [] (auto & record) { return std::string{get<field::ID>(record)}; },
+                             [&] (std::string id) { ids.push_back(std::move(id)); }, // calling thread, in order
+                             4u);
+
+    ASSERT_EQ(ids.size(), 100u);
+    for (size_t i = 0; i < ids.size(); ++i)
+        EXPECT_EQ(ids[i], "record" + std::to_string(i));
+}
+
+TEST(for_each_record_parallel, void_function_completes_before_return)
+{
+    sequence_file_input fin{std::istringstream{fasta_with_records(100)}, sequence_file_format_fasta{}};
+
+    std::atomic<size_t> invocations{0};
+    for_each_record_parallel(fin, [&] (auto &) { ++invocations; }, 4u);
+    EXPECT_EQ(invocations.load(), 100u);
+}
+
+TEST(for_each_record_parallel, exception_is_rethrown_after_earlier_results)
+{
+    sequence_file_input fin{std::istringstream{fasta_with_records(100)}, sequence_file_format_fasta{}};
+
+    std::vector<std::string> ids{};
+    EXPECT_THROW(for_each_record_parallel(fin,
+                                          [] (auto & record) -> std::string
+                                          {
+                                              std::string id = get<field::ID>(record);
+                                              if (id == "record50")
+                                                  throw std::runtime_error{"bad record"};
+                                              return id;
+                                          },
+                                          [&] (std::string id) { ids.push_back(std::move(id)); },
+                                          4u),
+                 std::runtime_error);
+
+    ASSERT_EQ(ids.size(), 50u); // every record before the failing one was consumed, none after it
+    EXPECT_EQ(ids.front(), "record0");
+    EXPECT_EQ(ids.back(), "record49");
+}
@@ -94,6 +94,32 @@ TEST_F(record_, get_by_field)
     EXPECT_TRUE(std::ranges::equal(get<field::SEQ>(r), "ACGT"_dna4));
 }
 
+TEST_F(record_, get_by_field_rvalue)
+{
+    record_type r{"MY ID", "ACGT"_dna4};
+
+    std::string id = get<field::ID>(std::move(r));
+
+    EXPECT_EQ(id, "MY ID");
+    EXPECT_TRUE(get<field::ID>(r).empty()); // the buffer was stolen, not copied
+}
+
+TEST_F(record_, clear_retains_capacity)
+{
+    record_type r{std::string(100, 'x'), "ACGT"_dna4};
+
+    get<field::SEQ>(r).reserve(100);
+    size_t const id_capacity  = get<field::ID>(r).capacity();
+    size_t const seq_capacity = get<field::SEQ>(r).capacity();
+
+    r.clear();
+
+    EXPECT_TRUE(get<field::ID>(r).empty());
+    EXPECT_TRUE(get<field::SEQ>(r).empty());
+    EXPECT_EQ(get<field::ID>(r).capacity(),  id_capacity);
+    EXPECT_EQ(get<field::SEQ>(r).capacity(), seq_capacity);
+}
+
 // ----------------------------------------------------------------------------
 // detail/record.hpp
 // ----------------------------------------------------------------------------
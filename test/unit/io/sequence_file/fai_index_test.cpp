@@ -0,0 +1,113 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include <seqan3/io/sequence_file/fai_index.hpp>
+#include <seqan3/test/tmp_filename.hpp>
+
+using namespace seqan3;
+
+struct fai_index_f : public ::testing::Test
+{
+    std::string input
+    {
+        ">chr1 some description\n"
+        "ACGTACGTAC\n"
+        "GTACGTACGT\n"
+        "ACGT\n"
+        ">chr2\n"
+        "GGGGG\n"
+    };
+
+    test::tmp_filename filename{"fai_index_test.fasta"};
+
+    void SetUp() override
+    {
+        std::ofstream of{filename.get_path(), std::ios::binary};
+        of << input;
+    }
+};
+
+TEST_F(fai_index_f, build)
+{
+    fai_index index = fai_index::build(filename.get_path());
+
+    ASSERT_EQ(index.size(), 2u);
+
+    EXPECT_EQ(index[0].id,        "chr1");
+    EXPECT_EQ(index[0].length,    24u);
+    EXPECT_EQ(index[0].offset,    23u); // behind "\n" of the header line
+    EXPECT_EQ(index[0].linebases, 10u);
+    EXPECT_EQ(index[0].linewidth, 11u);
+
+    EXPECT_EQ(index[1].id,        "chr2");
+    EXPECT_EQ(index[1].length,    5u);
+    EXPECT_EQ(index[1].offset,    56u);
+    EXPECT_EQ(index[1].linebases, 5u);
+    EXPECT_EQ(index[1].linewidth, 6u);
+}
+
+TEST_F(fai_index_f, lookup)
+{
+    fai_index index = fai_index::build(filename.get_path());
+
+    EXPECT_TRUE(index.contains("chr1"));
+    EXPECT_TRUE(index.contains("chr2"));
+    EXPECT_FALSE(index.contains("chr3"));
+
+    EXPECT_EQ(index.at("chr2").length, 5u);
+    EXPECT_THROW(index.at("chr3"), std::out_of_range);
+}
+
+TEST_F(fai_index_f, save_and_load)
+{
+    test::tmp_filename fai_filename{"fai_index_test.fasta.fai"};
+
+    fai_index::build(filename.get_path()).save(fai_filename.get_path());
+
+    // the file must be samtools compatible
+    std::ifstream stream{fai_filename.get_path()};
+    std::string const content{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+    EXPECT_EQ(content, "chr1\t24\t23\t10\t11\nchr2\t5\t56\t5\t6\n");
+
+    fai_index loaded;
+    loaded.load(fai_filename.get_path());
+
+    ASSERT_EQ(loaded.size(), 2u);
+    EXPECT_EQ(loaded[0].id,     "chr1");
+    EXPECT_EQ(loaded[0].offset, 23u);
+    EXPECT_EQ(loaded[1].id,     "chr2");
+    EXPECT_EQ(loaded[1].length, 5u);
+}
+
+TEST_F(fai_index_f, load_errors)
+{
+    fai_index index;
+    EXPECT_THROW(index.load("/nonexistent/path.fai"), file_open_error);
+
+    test::tmp_filename fai_filename{"fai_index_test_malformed.fai"};
+    {
+        std::ofstream of{fai_filename.get_path()};
+        of << "chr1\tnot_a_number\n";
+    }
+    EXPECT_THROW(index.load(fai_filename.get_path()), parse_error);
+}
+
+TEST_F(fai_index_f, build_errors)
+{
+    EXPECT_THROW(fai_index::build("/nonexistent/path.fasta"), file_open_error);
+
+    test::tmp_filename not_fasta{"fai_index_test_not_fasta.txt"};
+    {
+        std::ofstream of{not_fasta.get_path()};
+        of << "this is not a fasta file\n";
+    }
+    EXPECT_THROW(fai_index::build(not_fasta.get_path()), parse_error);
+}
@@ -0,0 +1,133 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include <seqan3/alphabet/nucleotide/dna15.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/io/sequence_file/bulk_load.hpp>
+#include <seqan3/std/ranges>
+#include <seqan3/test/tmp_filename.hpp>
+
+using namespace seqan3;
+
+struct bulk_load : public ::testing::Test
+{
+    std::string input
+    {
+        "> TEST 1\n"
+        "ACGT\n"
+        ">Test2\n"
+        "AGGCTGN\nAGGCTGN\n"
+        "; Test3\n"
+        "GGAGTAT\r\n"
+        "AAT 12\n" // character counts and whitespace are ignored
+    };
+
+    std::vector<std::string> expected_ids
+    {
+        { "TEST 1" },
+        { "Test2" },
+        { "Test3" },
+    };
+
+    std::vector<dna5_vector> expected_seqs
+    {
+        { "ACGT"_dna5 },
+        { "AGGCTGNAGGCTGN"_dna5 },
+        { "GGAGTATAAT"_dna5 },
+    };
+
+    test::tmp_filename filename{"bulk_load.fasta"};
+
+    void create_file(std::string const & content)
+    {
+        std::ofstream filecreator{filename.get_path(), std::ios::out | std::ios::binary};
+        filecreator << content;
+    }
+};
+
+TEST_F(bulk_load, load)
+{
+    create_file(input);
+
+    concatenated_sequences<dna5_vector> sequences;
+    concatenated_sequences<std::string> ids;
+
+    EXPECT_NO_THROW(( sequence_file_bulk_load(filename.get_path(), sequences, ids) ));
+
+    ASSERT_EQ(sequences.size(), 3u);
+    ASSERT_EQ(ids.size(), 3u);
+
+    for (size_t i = 0; i < 3; ++i)
+    {
+        EXPECT_TRUE((std::ranges::equal(sequences[i], expected_seqs[i])));
+        EXPECT_TRUE((std::ranges::equal(ids[i], expected_ids[i])));
+    }
+}
+
+TEST_F(bulk_load, load_twice_discards)
+{
+    create_file(input);
+
+    concatenated_sequences<dna5_vector> sequences;
+    concatenated_sequences<std::string> ids;
+
+    sequence_file_bulk_load(filename.get_path(), sequences, ids);
+    sequence_file_bulk_load(filename.get_path(), sequences, ids);
+
+    EXPECT_EQ(sequences.size(), 3u);
+    EXPECT_EQ(ids.size(), 3u);
+}
+
+TEST_F(bulk_load, empty_file)
+{
+    create_file("");
+
+    concatenated_sequences<dna5_vector> sequences;
+    concatenated_sequences<std::string> ids;
+
+    EXPECT_NO_THROW(( sequence_file_bulk_load(filename.get_path(), sequences, ids) ));
+
+    EXPECT_EQ(sequences.size(), 0u);
+    EXPECT_EQ(ids.size(), 0u);
+}
+
+TEST_F(bulk_load, legal_alphabet)
+{
+    create_file("> id\nACGRT\n"); // R is legal for dna15 but not for dna5
+
+    concatenated_sequences<dna5_vector> sequences;
+    concatenated_sequences<std::string> ids;
+
+    EXPECT_THROW(( sequence_file_bulk_load(filename.get_path(), sequences, ids) ), parse_error);
+    EXPECT_NO_THROW(( sequence_file_bulk_load<dna15>(filename.get_path(), sequences, ids) ));
+
+    ASSERT_EQ(sequences.size(), 1u);
+    EXPECT_TRUE((std::ranges::equal(sequences[0], "ACGNT"_dna5))); // R converts to N in dna5
+}
+
+TEST_F(bulk_load, missing_header)
+{
+    create_file("ACGT\n");
+
+    concatenated_sequences<dna5_vector> sequences;
+    concatenated_sequences<std::string> ids;
+
+    EXPECT_THROW(( sequence_file_bulk_load(filename.get_path(), sequences, ids) ), parse_error);
+}
+
+TEST_F(bulk_load, file_open_error)
+{
+    concatenated_sequences<dna5_vector> sequences;
+    concatenated_sequences<std::string> ids;
+
+    EXPECT_THROW(( sequence_file_bulk_load("/nonexistent/path/bulk_load.fasta", sequences, ids) ),
+                 file_open_error);
+}
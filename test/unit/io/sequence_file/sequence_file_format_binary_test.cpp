@@ -0,0 +1,226 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include <seqan3/alphabet/quality/all.hpp>
+#include <seqan3/io/sequence_file/input_format_concept.hpp>
+#include <seqan3/io/sequence_file/output_format_concept.hpp>
+#include <seqan3/io/sequence_file/format_binary.hpp>
+
+using namespace seqan3;
+
+//!\brief Appends the little-endian uint32_t length prefix of a field to a buffer.
+static void append_length(std::string & buffer, uint32_t const value)
+{
+    buffer.append(reinterpret_cast<char const *>(&value), sizeof(value));
+}
+
+//!\brief Serialises one record by hand (the framing that read() and write() must agree on).
+static std::string make_record(std::string const & id,
+                               std::vector<uint8_t> const & seq_ranks,
+                               std::vector<uint8_t> const & qual_ranks)
+{
+    std::string record{};
+    append_length(record, id.size());
+    append_length(record, seq_ranks.size());
+    append_length(record, qual_ranks.size());
+    record += id;
+    for (uint8_t const rank : seq_ranks)
+        record += static_cast<char>(rank);
+    for (uint8_t const rank : qual_ranks)
+        record += static_cast<char>(rank);
+    return record;
+}
+
+// ----------------------------------------------------------------------------
+// general
+// ----------------------------------------------------------------------------
+
+TEST(general, concepts)
+{
+    EXPECT_TRUE((SequenceFileInputFormat<sequence_file_format_binary>));
+    EXPECT_TRUE((SequenceFileOutputFormat<sequence_file_format_binary>));
+}
+
+// ----------------------------------------------------------------------------
+// fixture
+// ----------------------------------------------------------------------------
+
+struct binary_format : public ::testing::Test
+{
+    std::vector<std::string> ids
+    {
+        { "ID1" },
+        { "ID2 with blanks" },
+        { "" }, // the ID is optional
+    };
+
+    std::vector<dna5_vector> seqs
+    {
+        { "ACGTTTTTTTTTTTTTTT"_dna5 },
+        { "ACGNTTA"_dna5 },
+        { "GGAGTATAATATATATATATATAT"_dna5 },
+    };
+
+    std::vector<std::vector<phred42>> quals
+    {
+        { "!##$%&'()*+,-./++-"_phred42 },
+        { "!!!!!!!"_phred42 },
+        { {} }, // qualities are optional
+    };
+
+    sequence_file_format_binary format;
+
+    sequence_file_input_options<dna5, false> options;
+
+    //!\brief The file content corresponding to the records above.
+    std::string file_content()
+    {
+        std::string content{};
+        for (size_t i = 0; i < 3; ++i)
+        {
+            std::vector<uint8_t> seq_ranks{}, qual_ranks{};
+            for (dna5 const l : seqs[i])
+                seq_ranks.push_back(to_rank(l));
+            for (phred42 const q : quals[i])
+                qual_ranks.push_back(to_rank(q));
+            content += make_record(ids[i], seq_ranks, qual_ranks);
+        }
+        return content;
+    }
+};
+
+// ----------------------------------------------------------------------------
+// reading
+// ----------------------------------------------------------------------------
+
+TEST_F(binary_format, read)
+{
+    std::istringstream istream{file_content()};
+
+    for (size_t i = 0; i < 3; ++i)
+    {
+        std::string id;
+        dna5_vector seq;
+        std::vector<phred42> qual;
+
+        EXPECT_NO_THROW(( format.read(istream, options, seq, id, qual) ));
+
+        EXPECT_EQ(id, ids[i]);
+        EXPECT_EQ(seq, seqs[i]);
+        EXPECT_EQ(qual, quals[i]);
+    }
+
+    EXPECT_EQ(istream.peek(), std::char_traits<char>::eof());
+}
+
+TEST_F(binary_format, read_fields_ignored)
+{
+    std::istringstream istream{file_content()};
+
+    for (size_t i = 0; i < 3; ++i)
+        EXPECT_NO_THROW(( format.read(istream, options, std::ignore, std::ignore, std::ignore) ));
+
+    EXPECT_EQ(istream.peek(), std::char_traits<char>::eof());
+}
+
+TEST_F(binary_format, read_truncated)
+{
+    std::string content = file_content();
+    content.resize(content.size() - 3); // cut into the last record's payload
+
+    std::istringstream istream{content};
+
+    std::string id;
+    dna5_vector seq;
+    std::vector<phred42> qual;
+
+    for (size_t i = 0; i < 2; ++i)
+        EXPECT_NO_THROW(( format.read(istream, options, seq, id, qual) ));
+
+    EXPECT_THROW(( format.read(istream, options, seq, id, qual) ), unexpected_end_of_input);
+}
+
+TEST_F(binary_format, read_invalid_rank)
+{
+    std::istringstream istream{make_record("ID", {0, 1, 42}, {})}; // dna5 has only 5 ranks
+
+    std::string id;
+    dna5_vector seq;
+
+    EXPECT_THROW(( format.read(istream, options, seq, id, std::ignore) ), parse_error);
+}
+
+TEST_F(binary_format, read_wrong_quality_length)
+{
+    std::istringstream istream{make_record("ID", {0, 1, 2}, {0})}; // neither 0 nor the sequence length
+
+    std::string id;
+    dna5_vector seq;
+    std::vector<phred42> qual;
+
+    EXPECT_THROW(( format.read(istream, options, seq, id, qual) ), parse_error);
+}
+
+// ----------------------------------------------------------------------------
+// writing
+// ----------------------------------------------------------------------------
+
+TEST_F(binary_format, write)
+{
+    std::ostringstream ostream;
+
+    for (size_t i = 0; i < 3; ++i)
+        EXPECT_NO_THROW(( format.write(ostream, sequence_file_output_options{}, seqs[i], ids[i], quals[i]) ));
+
+    ostream.flush();
+    EXPECT_EQ(ostream.str(), file_content());
+}
+
+TEST_F(binary_format, write_errors)
+{
+    std::ostringstream ostream;
+
+    // the sequence is the only mandatory field
+    EXPECT_THROW(( format.write(ostream, sequence_file_output_options{}, std::ignore, ids[0], quals[0]) ),
+                 std::logic_error);
+    EXPECT_THROW(( format.write(ostream, sequence_file_output_options{}, ""_dna5, ids[0], std::ignore) ),
+                 std::runtime_error);
+
+    // if qualities are given, they must match the sequence in length
+    EXPECT_THROW(( format.write(ostream, sequence_file_output_options{}, seqs[0], ids[0], quals[1]) ),
+                 std::runtime_error);
+}
+
+// ----------------------------------------------------------------------------
+// round trip
+// ----------------------------------------------------------------------------
+
+TEST_F(binary_format, round_trip)
+{
+    std::stringstream stream;
+
+    for (size_t i = 0; i < 3; ++i)
+        format.write(stream, sequence_file_output_options{}, seqs[i], ids[i], quals[i]);
+
+    sequence_file_format_binary reading_format;
+    for (size_t i = 0; i < 3; ++i)
+    {
+        std::string id;
+        dna5_vector seq;
+        std::vector<phred42> qual;
+
+        EXPECT_NO_THROW(( reading_format.read(stream, options, seq, id, qual) ));
+
+        EXPECT_EQ(id, ids[i]);
+        EXPECT_EQ(seq, seqs[i]);
+        EXPECT_EQ(qual, quals[i]);
+    }
+}
@@ -276,6 +276,25 @@ TEST_F(read, seq_qual)
     }
 }
 
+TEST_F(read, fail_quals_shorter_seq_in_seq_qual)
+{
+    input =
+    {
+        "@ID1\n"
+        "ACGTT\n"
+        "+\n"
+        "!#\n"
+    };
+
+    std::stringstream istream{input};
+
+    std::vector<qualified<dna5, phred42>> seq_qual;
+    sequence_file_input_options<dna5, true> options2;
+
+    EXPECT_THROW( (format.read(istream, options2, seq_qual, id, seq_qual)),
+                  unexpected_end_of_input );
+}
+
 TEST_F(read, fail_no_id)
 {
     input[0] = '#'; // invalid character for ID line
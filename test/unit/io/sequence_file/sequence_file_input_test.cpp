@@ -11,7 +11,10 @@
 
 #include <range/v3/view/zip.hpp>
 
+#include <seqan3/io/sequence_file/fai_index.hpp>
 #include <seqan3/io/sequence_file/input.hpp>
+#include <seqan3/range/container/concatenated_sequences.hpp>
+#include <seqan3/range/view/char_to.hpp>
 #include <seqan3/range/view/convert.hpp>
 #include <seqan3/range/view/to_char.hpp>
 #include <seqan3/std/iterator>
@@ -270,6 +273,55 @@ TEST_F(sequence_file_input_f, record_reading)
     EXPECT_EQ(counter, 3u);
 }
 
+TEST_F(sequence_file_input_f, record_reading_move_fields)
+{
+    /* steal the field buffers instead of copying them */
+    sequence_file_input fin{std::istringstream{input}, sequence_file_format_fasta{}};
+
+    std::vector<dna5_vector> seqs;
+    std::vector<std::string> ids;
+
+    for (auto it = fin.begin(); it != fin.end(); ++it)
+    {
+        seqs.push_back(std::move(get<field::SEQ>(*it)));
+        ids.push_back(std::move(get<field::ID>(*it)));
+
+        EXPECT_TRUE(get<field::SEQ>(*it).empty()); // the buffer was stolen, not copied
+    }
+
+    ASSERT_EQ(seqs.size(), 3u);
+    for (size_t i = 0; i < 3u; ++i)
+    {
+        EXPECT_TRUE((std::ranges::equal(seqs[i], seq_comp[i])));
+        EXPECT_TRUE((std::ranges::equal(ids[i],  id_comp[i])));
+    }
+}
+
+TEST_F(sequence_file_input_f, reserve_record_capacity)
+{
+    sequence_file_input fin{std::istringstream{input}, sequence_file_format_fasta{}};
+    fin.options.reserve_record_capacity = 128;
+
+    size_t counter = 0;
+    for (auto & rec : fin)
+    {
+        EXPECT_TRUE((std::ranges::equal(get<field::SEQ>(rec), seq_comp[counter])));
+        EXPECT_TRUE((std::ranges::equal(get<field::ID>(rec),  id_comp[counter])));
+
+        // the buffers are pre-reserved and keep their capacity across records;
+        // the first record is buffered before the option can be set, so it is exempt
+        if (counter > 0)
+        {
+            EXPECT_GE(get<field::SEQ>(rec).capacity(), 128u);
+            EXPECT_GE(get<field::ID>(rec).capacity(),  128u);
+        }
+
+        counter++;
+    }
+
+    EXPECT_EQ(counter, 3u);
+}
+
 TEST_F(sequence_file_input_f, record_reading_struct_bind)
 {
     /* record based reading */
@@ -288,6 +340,348 @@ TEST_F(sequence_file_input_f, record_reading_struct_bind)
     EXPECT_EQ(counter, 3u);
 }
 
+TEST_F(sequence_file_input_f, batch_reading)
+{
+    sequence_file_input fin{std::istringstream{input}, sequence_file_format_fasta{}};
+
+    concatenated_sequences<std::string> ids;
+    concatenated_sequences<dna5_vector> seqs;
+
+    EXPECT_EQ(fin.read_batch(ids, seqs, 100), 3u);
+    EXPECT_EQ(ids.size(),  3u);
+    EXPECT_EQ(seqs.size(), 3u);
+
+    for (size_t i = 0; i < 3; ++i)
+    {
+        EXPECT_TRUE((std::ranges::equal(ids[i],  id_comp[i])));
+        EXPECT_TRUE((std::ranges::equal(seqs[i], seq_comp[i])));
+    }
+
+    EXPECT_EQ(fin.begin(), fin.end());
+    EXPECT_EQ(fin.read_batch(ids, seqs, 100), 0u); // at end -> nothing more to read
+}
+
+TEST_F(sequence_file_input_f, batch_reading_partial)
+{
+    sequence_file_input fin{std::istringstream{input}, sequence_file_format_fasta{}};
+
+    concatenated_sequences<std::string> ids;
+    concatenated_sequences<dna5_vector> seqs;
+
+    EXPECT_EQ(fin.read_batch(ids, seqs, 2), 2u);
+    EXPECT_EQ(ids.size(), 2u);
+
+    // the iterator interface continues after the batch
+    auto it = fin.begin();
+    ASSERT_NE(it, fin.end());
+    EXPECT_TRUE((std::ranges::equal(get<field::ID>(*it), id_comp[2])));
+    EXPECT_TRUE((std::ranges::equal(get<field::SEQ>(*it), seq_comp[2])));
+    ++it;
+    EXPECT_EQ(it, fin.end());
+}
+
+TEST_F(sequence_file_input_f, batch_reading_mixed_with_iteration)
+{
+    sequence_file_input fin{std::istringstream{input}, sequence_file_format_fasta{}};
+
+    auto it = fin.begin(); // consume the first record via the iterator
+    EXPECT_TRUE((std::ranges::equal(get<field::ID>(*it), id_comp[0])));
+    ++it;
+
+    concatenated_sequences<std::string> ids;
+    concatenated_sequences<dna5_vector> seqs;
+
+    EXPECT_EQ(fin.read_batch(ids, seqs, 100), 2u);
+    EXPECT_TRUE((std::ranges::equal(ids[0],  id_comp[1])));
+    EXPECT_TRUE((std::ranges::equal(ids[1],  id_comp[2])));
+    EXPECT_TRUE((std::ranges::equal(seqs[0], seq_comp[1])));
+    EXPECT_TRUE((std::ranges::equal(seqs[1], seq_comp[2])));
+}
+
+TEST_F(sequence_file_input_f, record_reading_raw_traits)
+{
+    /* borrowed records: raw characters, no conversion, buffer reused between increments */
+    sequence_file_input<sequence_file_input_raw_traits,
+                        fields<field::SEQ, field::ID, field::QUAL>,
+                        type_list<sequence_file_format_fasta>,
+                        char> fin{std::istringstream{input}, sequence_file_format_fasta{}};
+
+    std::string const seq_comp_raw[3]
+    {
+        "ACGT",
+        "AGGCTGN",
+        "GGAGTATAATATATATATATATAT"
+    };
+
+    std::string const * buffer_address = &get<field::SEQ>(fin.front());
+
+    size_t counter = 0;
+    for (auto & rec : fin)
+    {
+        // the field is a plain std::string borrowed from the file's internal buffer
+        EXPECT_TRUE((std::is_same_v<decltype(get<field::SEQ>(rec)), std::string &>));
+        EXPECT_EQ(&get<field::SEQ>(rec), buffer_address);
+
+        EXPECT_EQ(get<field::SEQ>(rec), seq_comp_raw[counter]);
+        EXPECT_TRUE((std::ranges::equal(get<field::ID>(rec),  id_comp[counter])));
+
+        // conversion to a real alphabet happens lazily and on demand
+        EXPECT_TRUE((std::ranges::equal(get<field::SEQ>(rec) | view::char_to<dna5>, seq_comp[counter])));
+
+        counter++;
+    }
+
+    EXPECT_EQ(counter, 3u);
+}
+
+TEST_F(sequence_file_input_f, parallel_parsing_fasta)
+{
+    std::string many_records;
+    for (size_t i = 0; i < 100; ++i)
+        many_records += input; // 300 records across many chunks
+
+    sequence_file_input fin{std::istringstream{many_records}, sequence_file_format_fasta{}};
+    fin.parse_parallel(4, 10);
+
+    size_t counter = 0;
+    for (auto & rec : fin)
+    {
+        EXPECT_TRUE((std::ranges::equal(get<field::SEQ>(rec), seq_comp[counter % 3])));
+        EXPECT_TRUE((std::ranges::equal(get<field::ID>(rec),  id_comp[counter % 3])));
+
+        counter++;
+    }
+
+    EXPECT_EQ(counter, 300u);
+}
+
+TEST_F(sequence_file_input_f, parallel_parsing_fastq)
+{
+    std::string many_records;
+    for (size_t i = 0; i < 100; ++i)
+    {
+        many_records += "@ID" + std::to_string(i) + "\n"
+                        "ACGTTTA\n"
+                        "+\n"
+                        "!!!!!!!\n";
+    }
+
+    sequence_file_input fin{std::istringstream{many_records}, sequence_file_format_fastq{}};
+    fin.parse_parallel(4, 7);
+
+    size_t counter = 0;
+    for (auto & rec : fin)
+    {
+        EXPECT_TRUE((std::ranges::equal(get<field::ID>(rec), std::string{"ID" + std::to_string(counter)})));
+        EXPECT_TRUE((std::ranges::equal(get<field::SEQ>(rec), "ACGTTTA"_dna5)));
+
+        counter++;
+    }
+
+    EXPECT_EQ(counter, 100u);
+}
+
+TEST_F(sequence_file_input_f, parallel_parsing_error_in_order)
+{
+    std::string many_records;
+    for (size_t i = 0; i < 50; ++i)
+        many_records += ">REC" + std::to_string(i) + "\nACGT\n";
+    many_records += ">BROKEN\nAC!T\n"; // parse error in the last chunk
+
+    sequence_file_input fin{std::istringstream{many_records}, sequence_file_format_fasta{}};
+    fin.parse_parallel(4, 10);
+
+    size_t counter = 0;
+    EXPECT_THROW(
+    {
+        for (auto & rec : fin)
+        {
+            (void) rec;
+            counter++;
+        }
+    }, parse_error);
+
+    // the first record is read on construction, four complete chunks of ten records follow;
+    // the fifth chunk contains the broken record and fails as a whole
+    EXPECT_EQ(counter, 41u);
+}
+
+TEST_F(sequence_file_input_f, prefetch_reading)
+{
+    std::string many_records;
+    for (size_t i = 0; i < 100; ++i)
+        many_records += input; // 300 records, many more than the prefetch depth
+
+    sequence_file_input fin{std::istringstream{many_records}, sequence_file_format_fasta{}};
+    fin.prefetch(3);
+
+    size_t counter = 0;
+    for (auto & rec : fin)
+    {
+        EXPECT_TRUE((std::ranges::equal(get<field::SEQ>(rec), seq_comp[counter % 3])));
+        EXPECT_TRUE((std::ranges::equal(get<field::ID>(rec),  id_comp[counter % 3])));
+
+        counter++;
+    }
+
+    EXPECT_EQ(counter, 300u);
+}
+
+TEST_F(sequence_file_input_f, try_next_record_polling)
+{
+    std::string many_records;
+    for (size_t i = 0; i < 100; ++i)
+        many_records += input; // 300 records, many more than the prefetch depth
+
+    sequence_file_input fin{std::istringstream{many_records}, sequence_file_format_fasta{}};
+    fin.prefetch(3);
+
+    using record_type = typename decltype(fin)::record_type;
+    record_type rec{};
+
+    size_t counter = 0;
+    while (true)
+    {
+        record_availability const status = fin.try_next_record(rec);
+
+        if (status == record_availability::at_end)
+            break;
+
+        if (status == record_availability::pending) // the background parser has not caught up; poll again
+            continue;
+
+        EXPECT_TRUE((std::ranges::equal(get<field::SEQ>(rec), seq_comp[counter % 3])));
+        EXPECT_TRUE((std::ranges::equal(get<field::ID>(rec),  id_comp[counter % 3])));
+
+        counter++;
+    }
+
+    EXPECT_EQ(counter, 300u);
+    EXPECT_EQ(fin.try_next_record(rec), record_availability::at_end); // stays at the end
+}
+
+TEST_F(sequence_file_input_f, try_next_record_sequential)
+{
+    // without prefetch() the record is parsed synchronously and pending is never returned
+    sequence_file_input fin{std::istringstream{input}, sequence_file_format_fasta{}};
+
+    using record_type = typename decltype(fin)::record_type;
+    record_type rec{};
+
+    size_t counter = 0;
+    while (fin.try_next_record(rec) == record_availability::ready)
+    {
+        EXPECT_TRUE((std::ranges::equal(get<field::SEQ>(rec), seq_comp[counter])));
+        EXPECT_TRUE((std::ranges::equal(get<field::ID>(rec),  id_comp[counter])));
+
+        counter++;
+    }
+
+    EXPECT_EQ(counter, 3u);
+}
+
+TEST_F(sequence_file_input_f, prefetch_error_in_order)
+{
+    std::string many_records;
+    for (size_t i = 0; i < 50; ++i)
+        many_records += ">REC" + std::to_string(i) + "\nACGT\n";
+    many_records += ">BROKEN\nAC!T\n";
+
+    sequence_file_input fin{std::istringstream{many_records}, sequence_file_format_fasta{}};
+    fin.prefetch(3);
+
+    size_t counter = 0;
+    EXPECT_THROW(
+    {
+        for (auto & rec : fin)
+        {
+            (void) rec;
+            counter++;
+        }
+    }, parse_error);
+
+    // all records before the broken one are handed out, then the error surfaces
+    EXPECT_EQ(counter, 50u);
+}
+
+// the index truncates IDs at the first whitespace, hence a separate input without descriptions
+struct sequence_file_input_seek : public ::testing::Test
+{
+    std::string input
+    {
+        ">seq1\n"
+        "ACGT\n"
+        ">seq2\n"
+        "AGGCTGN\n"
+        ">seq3\n"
+        "GGAGTATAATATATATATATATAT\n"
+    };
+
+    dna5_vector seq_comp[3]
+    {
+        "ACGT"_dna5,
+        "AGGCTGN"_dna5,
+        "GGAGTATAATATATATATATATAT"_dna5
+    };
+
+    std::string id_comp[3]
+    {
+        "seq1",
+        "seq2",
+        "seq3"
+    };
+
+    test::tmp_filename filename{"sequence_file_input_seek.fasta"};
+
+    void SetUp() override
+    {
+        std::ofstream of{filename.get_path(), std::ios::binary};
+        of << input;
+    }
+};
+
+TEST_F(sequence_file_input_seek, seek_to)
+{
+    sequence_file_input fin{filename.get_path()};
+
+    // jump backwards and forwards; no .fai file exists, so the index is built on first use
+    for (size_t i : {2u, 0u, 1u})
+    {
+        fin.seek_to(id_comp[i]);
+        EXPECT_TRUE((std::ranges::equal(get<field::ID>(fin.front()), id_comp[i])));
+        EXPECT_TRUE((std::ranges::equal(get<field::SEQ>(fin.front()), seq_comp[i])));
+    }
+
+    EXPECT_THROW(fin.seek_to("nonexistent_id"), std::out_of_range);
+
+    // iteration continues with the records following the seeked one
+    fin.seek_to(id_comp[1]);
+    size_t counter = 1;
+    for (auto & rec : fin)
+    {
+        EXPECT_TRUE((std::ranges::equal(get<field::ID>(rec), id_comp[counter])));
+        ++counter;
+    }
+    EXPECT_EQ(counter, 3u);
+}
+
+TEST_F(sequence_file_input_seek, seek_to_with_loaded_index)
+{
+    sequence_file_input fin{filename.get_path()};
+    fin.load_index(fai_index::build(filename.get_path()));
+
+    fin.seek_to(id_comp[2]);
+    EXPECT_TRUE((std::ranges::equal(get<field::SEQ>(fin.front()), seq_comp[2])));
+}
+
+TEST_F(sequence_file_input_f, seek_to_without_filename)
+{
+    sequence_file_input fin{std::istringstream{input}, sequence_file_format_fasta{}};
+
+    // stream constructors have no associated path to load or build an index from
+    EXPECT_THROW(fin.seek_to("TEST 1"), file_open_error);
+}
+
 TEST_F(sequence_file_input_f, record_reading_custom_fields)
 {
     /* record based reading */
@@ -50,6 +50,62 @@ TEST(rows, assign_sequence_files)
     EXPECT_EQ(reinterpret_cast<std::ostringstream&>(fout.get_stream()).str(), output_comp);
 }
 
+TEST(rows, assign_sequence_files_passthrough)
+{
+    // idiosyncratic formatting (no blank after '>', inconsistent line widths) that re-formatting would normalise
+    std::string const input
+    {
+        ">TEST 1\n"
+        "ACGT\n"
+        "> Test2\n"
+        "AGGC\n"
+        "TGNA\n"
+        "> Test3\n"
+        "GGAGTATAATATATATATATATAT\n"
+    };
+
+    sequence_file_input fin{std::istringstream{input}, sequence_file_format_fasta{}};
+    sequence_file_output fout{std::ostringstream{}, sequence_file_format_fasta{}};
+
+    // same format and default options -> records are copied as raw bytes, the formatting is preserved
+    fout = fin;
+
+    fout.get_stream().flush();
+    EXPECT_EQ(reinterpret_cast<std::ostringstream&>(fout.get_stream()).str(), input);
+}
+
+TEST(rows, raw_record_filter)
+{
+    std::string const input
+    {
+        "> TEST1\n"
+        "ACGT\n"
+        "> Test2\n"
+        "AGGCTGNAGGCTGAGGCTGN\n"
+        "> Test3\n"
+        "GG\n"
+    };
+
+    std::string const output_comp
+    {
+        "> TEST1\n"
+        "ACGT\n"
+        "> Test2\n"
+        "AGGCTGNAGGCTGAGGCTGN\n"
+    };
+
+    sequence_file_input fin{std::istringstream{input}, sequence_file_format_fasta{}};
+    sequence_file_output fout{std::ostringstream{}, sequence_file_format_fasta{}};
+
+    // raw passthrough combined with record-based filtering
+    for (auto it = fin.begin(); it != fin.end(); ++it)
+        if (get<field::SEQ>(*it).size() >= 4)
+            fout.push_back_raw(fin.raw_record());
+
+    fout.get_stream().flush();
+    EXPECT_EQ(reinterpret_cast<std::ostringstream&>(fout.get_stream()).str(), output_comp);
+}
+
 TEST(integration, assign_sequence_file_pipes)
 {
     std::string const input
@@ -5,6 +5,7 @@
 // shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
 // -----------------------------------------------------------------------------------------------------
 
+#include <fstream>
 #include <sstream>
 
 #include <gtest/gtest.h>
@@ -99,6 +100,28 @@ TEST(general, construct_by_filename)
     }
 }
 
+TEST(general, stream_buffer_size)
+{
+    size_t const previous = stream_buffer_size;
+    stream_buffer_size = 64u; // smaller than the file, picked up by files opened from now on
+
+    test::tmp_filename filename{"sequence_file_output_buffer.fasta"};
+
+    {
+        sequence_file_output<> fout{filename.get_path()};
+        fout.options.fasta_letters_per_line = 0;
+
+        for (size_t i = 0; i < 3; ++i)
+            fout.emplace_back(seqs[i], ids[i]);
+    }
+
+    std::ifstream file{filename.get_path()};
+    std::string const file_content{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+    EXPECT_EQ(file_content, output_comp);
+
+    stream_buffer_size = previous;
+}
+
 TEST(general, construct_from_stream)
 {
     /* stream + format_tag */
@@ -0,0 +1,132 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include <seqan3/io/sequence_file/statistics.hpp>
+#include <seqan3/test/tmp_filename.hpp>
+
+using namespace seqan3;
+
+struct sequence_file_statistics_f : public ::testing::Test
+{
+    std::string fasta_input
+    {
+        "> TEST 1\n"
+        "ACGT\n"
+        ">Test2\n"
+        "AGGCTGN\nAGGCTGN\n"
+        "; Test3\n"
+        "GGAGTAT\r\n"
+        "AAT 12\n" // character counts and whitespace are ignored
+    };
+
+    std::string fastq_input
+    {
+        "@read1\n"
+        "ACGT\n"
+        "+\n"
+        "IIII\n"
+        "@read2\n"
+        "ACG\nTAA\n" // sequence and qualities may span lines
+        "+read2\n"
+        "III\nJJJ\n"
+    };
+
+    test::tmp_filename filename{"statistics.fastx"};
+
+    void create_file(std::string const & content)
+    {
+        std::ofstream filecreator{filename.get_path(), std::ios::out | std::ios::binary};
+        filecreator << content;
+    }
+};
+
+TEST_F(sequence_file_statistics_f, fasta)
+{
+    create_file(fasta_input);
+
+    sequence_file_statistics_result stats{};
+    EXPECT_NO_THROW(( stats = sequence_file_statistics(filename.get_path()) ));
+
+    EXPECT_EQ(stats.record_count, 3u);
+    EXPECT_EQ(stats.total_length, 28u);
+    EXPECT_EQ(stats.min_length, 4u);
+    EXPECT_EQ(stats.max_length, 14u);
+    EXPECT_DOUBLE_EQ(stats.mean_length(), 28.0 / 3.0);
+
+    ASSERT_EQ(stats.length_histogram.size(), 15u);
+    EXPECT_EQ(stats.length_histogram[4], 1u);
+    EXPECT_EQ(stats.length_histogram[10], 1u);
+    EXPECT_EQ(stats.length_histogram[14], 1u);
+
+    EXPECT_EQ(stats.base_composition['A'], 7u);
+    EXPECT_EQ(stats.base_composition['N'], 2u);
+    EXPECT_DOUBLE_EQ(stats.gc_content(), 13.0 / 28.0);
+
+    EXPECT_TRUE(stats.quality_sums.empty()); // no qualities in FastA
+}
+
+TEST_F(sequence_file_statistics_f, fastq)
+{
+    create_file(fastq_input);
+
+    auto const stats = sequence_file_statistics(filename.get_path());
+
+    EXPECT_EQ(stats.record_count, 2u);
+    EXPECT_EQ(stats.total_length, 10u);
+    EXPECT_EQ(stats.min_length, 4u);
+    EXPECT_EQ(stats.max_length, 6u);
+
+    ASSERT_EQ(stats.quality_sums.size(), 6u);
+    EXPECT_EQ(stats.quality_counts[0], 2u); // both reads cover position 0
+    EXPECT_EQ(stats.quality_counts[4], 1u); // only read2 is that long
+    EXPECT_EQ(stats.quality_sums[0], 2u * ('I' - 33));
+    EXPECT_DOUBLE_EQ(stats.mean_quality_at(5), static_cast<double>('J' - 33));
+    EXPECT_DOUBLE_EQ(stats.mean_quality(), (7.0 * ('I' - 33) + 3.0 * ('J' - 33)) / 10.0);
+}
+
+TEST_F(sequence_file_statistics_f, options_disable_accumulators)
+{
+    create_file(fastq_input);
+
+    auto const stats = sequence_file_statistics(filename.get_path(), {false, false, false});
+
+    EXPECT_EQ(stats.record_count, 2u); // counting and extremes always happen
+    EXPECT_EQ(stats.total_length, 10u);
+    EXPECT_TRUE(stats.length_histogram.empty());
+    EXPECT_TRUE(stats.quality_sums.empty());
+    EXPECT_EQ(stats.base_composition['A'], 0u);
+}
+
+TEST_F(sequence_file_statistics_f, empty_file)
+{
+    create_file("");
+
+    auto const stats = sequence_file_statistics(filename.get_path());
+
+    EXPECT_EQ(stats.record_count, 0u);
+    EXPECT_DOUBLE_EQ(stats.mean_length(), 0.0);
+    EXPECT_DOUBLE_EQ(stats.gc_content(), 0.0);
+    EXPECT_DOUBLE_EQ(stats.mean_quality(), 0.0);
+}
+
+TEST_F(sequence_file_statistics_f, format_errors)
+{
+    create_file("ACGT\n"); // missing header
+    EXPECT_THROW(sequence_file_statistics(filename.get_path()), parse_error);
+
+    create_file("@read\nACGT\n"); // missing + line
+    EXPECT_THROW(sequence_file_statistics(filename.get_path()), parse_error);
+
+    create_file("@read\nACGT\n+\nII\n"); // truncated qualities
+    EXPECT_THROW(sequence_file_statistics(filename.get_path()), parse_error);
+
+    EXPECT_THROW(sequence_file_statistics("/nonexistent/path/statistics.fastq"), file_open_error);
+}
@@ -0,0 +1,211 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <sstream>
+#include <string>
+
+#include <seqan3/contrib/stream/bgzf_istream.hpp>
+#include <seqan3/contrib/stream/bgzf_ostream.hpp>
+#include <seqan3/contrib/stream/gz_istream.hpp>
+#include <seqan3/io/stream/concept.hpp>
+
+using namespace seqan3;
+
+TEST(bgzf_stream, concept_check)
+{
+    EXPECT_TRUE((OStream<contrib::bgzf_ostream, char>));
+    EXPECT_TRUE((IStream<contrib::bgzf_istream, char>));
+}
+
+//!\brief Generates pseudo random text that spans multiple BGZF blocks.
+static std::string random_text(size_t const length)
+{
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<uint8_t> dis('A', 'Z');
+
+    std::string text(length, '\0');
+    for (char & c : text)
+        c = dis(gen);
+    return text;
+}
+
+TEST(bgzf_stream, roundtrip)
+{
+    std::string const uncompressed = random_text(1'000'000); // ~16 blocks
+
+    std::ostringstream compressed_stream{};
+    {
+        contrib::bgzf_ostream compressor{compressed_stream};
+        compressor << uncompressed;
+    } // destructor flushes the pipeline and writes the end-of-file marker
+
+    std::string const compressed = compressed_stream.str();
+    ASSERT_GT(compressed.size(), sizeof(contrib::BGZF_END_OF_FILE_MARKER));
+
+    // the file ends with the fixed empty block
+    EXPECT_EQ(compressed.compare(compressed.size() - sizeof(contrib::BGZF_END_OF_FILE_MARKER),
+                                 sizeof(contrib::BGZF_END_OF_FILE_MARKER),
+                                 reinterpret_cast<char const *>(&contrib::BGZF_END_OF_FILE_MARKER[0]),
+                                 sizeof(contrib::BGZF_END_OF_FILE_MARKER)),
+              0);
+
+    std::istringstream istream{compressed};
+    contrib::bgzf_istream decompressor{istream};
+    std::string const roundtripped{std::istreambuf_iterator<char>{decompressor},
+                                   std::istreambuf_iterator<char>{}};
+
+    EXPECT_EQ(roundtripped, uncompressed);
+}
+
+TEST(bgzf_stream, gzip_compatible)
+{
+    // BGZF output is a multi-member gzip file and must be readable by the plain gz stream
+    std::string const uncompressed = random_text(200'000);
+
+    std::ostringstream compressed_stream{};
+    {
+        contrib::bgzf_ostream compressor{compressed_stream};
+        compressor << uncompressed;
+    }
+
+    std::istringstream istream{compressed_stream.str()};
+    contrib::gz_istream decompressor{istream};
+    std::string const roundtripped{std::istreambuf_iterator<char>{decompressor},
+                                   std::istreambuf_iterator<char>{}};
+
+    EXPECT_EQ(roundtripped, uncompressed);
+}
+
+TEST(bgzf_stream, thread_count_variable)
+{
+    size_t const previous = contrib::bgzf_thread_count;
+    contrib::bgzf_thread_count = 2u; // picked up as the default by streams opened from now on
+
+    std::string const uncompressed = random_text(200'000);
+
+    std::ostringstream compressed_stream{};
+    {
+        contrib::bgzf_ostream compressor{compressed_stream};
+        compressor << uncompressed;
+    }
+
+    std::istringstream istream{compressed_stream.str()};
+    contrib::bgzf_istream decompressor{istream};
+    std::string const roundtripped{std::istreambuf_iterator<char>{decompressor},
+                                   std::istreambuf_iterator<char>{}};
+
+    EXPECT_EQ(roundtripped, uncompressed);
+
+    contrib::bgzf_thread_count = previous;
+}
+
+TEST(bgzf_stream, single_threaded)
+{
+    std::string const uncompressed = random_text(200'000);
+
+    std::ostringstream compressed_stream{};
+    {
+        contrib::bgzf_ostream compressor{compressed_stream, Z_DEFAULT_COMPRESSION, 1u};
+        compressor << uncompressed;
+    }
+
+    std::istringstream istream{compressed_stream.str()};
+    contrib::bgzf_istream decompressor{istream, 1u};
+    std::string const roundtripped{std::istreambuf_iterator<char>{decompressor},
+                                   std::istreambuf_iterator<char>{}};
+
+    EXPECT_EQ(roundtripped, uncompressed);
+}
+
+TEST(bgzf_stream, tell_and_seek_virtual)
+{
+    std::string const uncompressed = random_text(1'000'000); // ~16 blocks
+
+    std::ostringstream compressed_stream{};
+    {
+        contrib::bgzf_ostream compressor{compressed_stream};
+        compressor << uncompressed;
+    }
+
+    std::istringstream istream{compressed_stream.str()};
+    contrib::bgzf_istream decompressor{istream};
+
+    std::string prefix(100'000, '\0'); // ends in the middle of a block
+    decompressor.read(&prefix[0], prefix.size());
+    ASSERT_TRUE(decompressor.good());
+    EXPECT_EQ(prefix, uncompressed.substr(0, prefix.size()));
+
+    uint64_t const voffset = decompressor.tell_virtual();
+
+    std::string const rest{std::istreambuf_iterator<char>{decompressor}, std::istreambuf_iterator<char>{}};
+    EXPECT_EQ(rest, uncompressed.substr(prefix.size()));
+
+    decompressor.seek_virtual(voffset); // rewind to the remembered position
+    std::string const rest_again{std::istreambuf_iterator<char>{decompressor}, std::istreambuf_iterator<char>{}};
+    EXPECT_EQ(rest_again, rest);
+}
+
+TEST(bgzf_stream, seek_virtual_within_first_block)
+{
+    std::string const uncompressed = random_text(10'000);
+
+    std::ostringstream compressed_stream{};
+    {
+        contrib::bgzf_ostream compressor{compressed_stream};
+        compressor << uncompressed;
+    }
+
+    std::istringstream istream{compressed_stream.str()};
+    contrib::bgzf_istream decompressor{istream};
+
+    decompressor.seek_virtual((uint64_t{0} << 16) | 500u); // first block starts at compressed offset 0
+
+    std::string const rest{std::istreambuf_iterator<char>{decompressor}, std::istreambuf_iterator<char>{}};
+    EXPECT_EQ(rest, uncompressed.substr(500));
+}
+
+TEST(bgzf_stream, seek_virtual_invalid_offset)
+{
+    std::string const uncompressed = random_text(1'000); // a single block
+
+    std::ostringstream compressed_stream{};
+    {
+        contrib::bgzf_ostream compressor{compressed_stream};
+        compressor << uncompressed;
+    }
+
+    std::istringstream istream{compressed_stream.str()};
+    contrib::bgzf_istream decompressor{istream};
+
+    // the offset inside the block exceeds the block's decompressed size
+    EXPECT_THROW(decompressor.seek_virtual((uint64_t{0} << 16) | 5'000u), std::runtime_error);
+
+    // the compressed offset points to the end-of-file marker, where no data can follow
+    size_t const eof_marker_offset = compressed_stream.str().size() - sizeof(contrib::BGZF_END_OF_FILE_MARKER);
+    EXPECT_THROW(decompressor.seek_virtual((uint64_t{eof_marker_offset} << 16) | 1u), std::runtime_error);
+
+    // ... but with offset 0 inside the block it is a valid end position
+    decompressor.seek_virtual(uint64_t{eof_marker_offset} << 16);
+    EXPECT_EQ(decompressor.get(), std::char_traits<char>::eof());
+}
+
+TEST(bgzf_stream, rejects_plain_gzip)
+{
+    // plain gzip input has no BC subfield; the BGZF stream must not silently misread it
+    std::string const malformed{"\x1f\x8b\x08\x04" // gzip magic with FEXTRA, but bogus extra field
+                                "\x00\x00\x00\x00\x00\xff\x04\x00"
+                                "XY\x00\x00", 16};
+
+    std::istringstream istream{malformed};
+    contrib::bgzf_istream decompressor{istream};
+
+    EXPECT_THROW((std::string{std::istreambuf_iterator<char>{decompressor}, std::istreambuf_iterator<char>{}}),
+                 std::runtime_error);
+}
@@ -8,7 +8,9 @@
 #include <gtest/gtest.h>
 
 #include <iostream>
+#include <sstream>
 #include <string>
+#include <thread>
 
 #include <seqan3/alphabet/nucleotide/all.hpp>
 #include <seqan3/std/filesystem>
@@ -213,3 +215,50 @@ TEST(debug_stream, optional)
     o.flush();
     EXPECT_EQ(o.str(), "<VALUELESS_OPTIONAL>3");
 }
+
+TEST(debug_stream, buffered)
+{
+    std::ostringstream o;
+    debug_stream_type my_stream{o};
+    my_stream.setf(fmtflags2::buffered);
+
+    // output stays in the thread's buffer until it is flushed
+    my_stream << "AGGATAC"_dna5 << ' ' << 42;
+    EXPECT_EQ(o.str(), "");
+    my_stream.flush();
+    EXPECT_EQ(o.str(), "AGGATAC 42");
+
+    // std::endl publishes the buffer
+    my_stream << "foo" << std::endl;
+    EXPECT_EQ(o.str(), "AGGATAC 42foo\n");
+}
+
+TEST(debug_stream, buffered_threads)
+{
+    std::ostringstream o;
+    debug_stream_type my_stream{o};
+    my_stream.setf(fmtflags2::buffered);
+
+    // every thread formats into its own buffer, so lines of concurrent threads do not interleave
+    auto work = [&my_stream] (char const c)
+    {
+        for (size_t i = 0; i < 100u; ++i)
+            my_stream << std::string(40, c) << std::endl;
+    };
+
+    std::thread t1{work, 'a'};
+    std::thread t2{work, 'b'};
+    t1.join();
+    t2.join();
+    my_stream.flush();
+
+    std::istringstream in{o.str()};
+    std::string line;
+    size_t line_count = 0;
+    while (std::getline(in, line))
+    {
+        ++line_count;
+        EXPECT_TRUE(line == std::string(40, 'a') || line == std::string(40, 'b'));
+    }
+    EXPECT_EQ(line_count, 200u);
+}
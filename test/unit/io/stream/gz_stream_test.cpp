@@ -0,0 +1,122 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+
+#include <seqan3/contrib/stream/gz_istream.hpp>
+#include <seqan3/contrib/stream/gz_ostream.hpp>
+#include <seqan3/io/stream/concept.hpp>
+
+using namespace seqan3;
+
+TEST(gz_stream, concept_check)
+{
+    EXPECT_TRUE((OStream<contrib::gz_ostream, char>));
+    EXPECT_TRUE((IStream<contrib::gz_istream, char>));
+}
+
+//!\brief Compresses the given text into one gzip member.
+static std::string gzip_member(std::string const & text)
+{
+    std::ostringstream compressed{};
+    {
+        contrib::gz_ostream compressor{compressed};
+        if (!text.empty())
+            compressor.write(text.data(), text.size());
+        compressor.flush();
+    }
+    return compressed.str();
+}
+
+//!\brief A stream buffer that refuses to seek, like a pipe does.
+struct unseekable_streambuf : public std::streambuf
+{
+    std::string data{};
+    size_t position{0};
+
+    int_type underflow() override
+    {
+        if (position >= data.size())
+            return traits_type::eof();
+
+        size_t const end = std::min(data.size(), position + 512);
+        setg(&data[0] + position, &data[0] + position, &data[0] + end);
+        position = end;
+        return traits_type::to_int_type(*gptr());
+    }
+
+    // seekoff/seekpos deliberately not overridden; every seek on the stream fails
+};
+
+TEST(gz_stream, roundtrip)
+{
+    std::string const uncompressed(100'000, 'x');
+
+    std::istringstream istream{gzip_member(uncompressed)};
+    contrib::gz_istream decompressor{istream};
+    std::string const roundtripped{std::istreambuf_iterator<char>{decompressor},
+                                   std::istreambuf_iterator<char>{}};
+
+    EXPECT_EQ(roundtripped, uncompressed);
+}
+
+TEST(gz_stream, concatenated_members)
+{
+    // the standard output of parallel compressors: many independent members in one file
+    std::string compressed{};
+    std::string expected{};
+    for (size_t i = 0; i < 20; ++i)
+    {
+        std::string const member_text = "member" + std::to_string(i) + std::string(i * 131, static_cast<char>('A' + i % 26));
+        expected += member_text;
+        compressed += gzip_member(member_text);
+    }
+
+    std::istringstream istream{compressed};
+    contrib::gz_istream decompressor{istream};
+    std::string const roundtripped{std::istreambuf_iterator<char>{decompressor},
+                                   std::istreambuf_iterator<char>{}};
+
+    EXPECT_EQ(roundtripped, expected);
+}
+
+TEST(gz_stream, concatenated_members_with_empty_members)
+{
+    std::string const compressed = gzip_member("") + gzip_member("abc") + gzip_member("") +
+                                   gzip_member("def") + gzip_member("");
+
+    std::istringstream istream{compressed};
+    contrib::gz_istream decompressor{istream};
+    std::string const roundtripped{std::istreambuf_iterator<char>{decompressor},
+                                   std::istreambuf_iterator<char>{}};
+
+    EXPECT_EQ(roundtripped, "abcdef");
+}
+
+TEST(gz_stream, concatenated_members_from_pipe)
+{
+    // member boundaries must not require seeking back in the source
+    std::string expected{};
+    unseekable_streambuf buffer{};
+    for (size_t i = 0; i < 20; ++i)
+    {
+        std::string const member_text = "member" + std::to_string(i) + std::string(i * 131, static_cast<char>('A' + i % 26));
+        expected += member_text;
+        buffer.data += gzip_member(member_text);
+    }
+
+    std::istream istream{&buffer};
+    contrib::gz_istream decompressor{istream};
+    std::string const roundtripped{std::istreambuf_iterator<char>{decompressor},
+                                   std::istreambuf_iterator<char>{}};
+
+    EXPECT_EQ(roundtripped, expected);
+}
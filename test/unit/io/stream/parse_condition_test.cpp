@@ -11,6 +11,7 @@
 
 #include <seqan3/alphabet/all.hpp>
 #include <seqan3/io/stream/parse_condition.hpp>
+#include <seqan3/std/span>
 
 using namespace std::literals;
 using namespace seqan3;
@@ -493,3 +494,94 @@ TEST(parse_condition, parse_asserter)
                             " ((is_in_interval<'0', '9'> || is_in_interval<'A', 'Z'>) || is_in_interval<'a', 'z'>)"s);
     }
 }
+
+TEST(parse_condition, find_first_not_of)
+{
+    using namespace seqan3;
+
+    auto constexpr cond = is_in_alphabet<seqan3::dna5>;
+
+    auto find = [&cond] (std::string const & str)
+    {
+        return cond.find_first_not_of(str.data(), str.data() + str.size()) - str.data();
+    };
+
+    // empty buffer
+    EXPECT_EQ(find(""), 0);
+
+    // buffers shorter than one chunk
+    EXPECT_EQ(find("ACGTN"),  5);
+    EXPECT_EQ(find("AC!TN"),  2);
+    EXPECT_EQ(find("!CGTN"),  0);
+
+    // buffers spanning multiple chunks (chunk size is 16)
+    std::string const valid(100, 'A');
+    EXPECT_EQ(find(valid), 100);
+
+    for (size_t pos : {0u, 1u, 15u, 16u, 17u, 42u, 99u})
+    {
+        std::string str = valid;
+        str[pos] = '\n';
+        EXPECT_EQ(find(str), static_cast<std::ptrdiff_t>(pos));
+    }
+
+    // characters from the upper half of the range are classified correctly
+    std::string str = valid;
+    str[20] = static_cast<char>(0xC3);
+    EXPECT_EQ(find(str), 20);
+
+    // also works on combined and negated conditions
+    auto const ws = is_space || is_char<'-'>;
+    std::string const gaps{"  \t--\n -x"};
+    EXPECT_EQ(ws.find_first_not_of(gaps.data(), gaps.data() + gaps.size()) - gaps.data(), 8);
+}
+
+TEST(parse_condition, find_first_of)
+{
+    using namespace seqan3;
+
+    // single-character conditions reduce to std::memchr
+    auto constexpr newline = is_char<'\n'>;
+
+    auto find = [] (auto const & cond, std::string const & str)
+    {
+        return cond.find_first_of(str.data(), str.data() + str.size()) - str.data();
+    };
+
+    // empty buffer
+    EXPECT_EQ(find(newline, ""), 0);
+
+    // no match returns the end of the buffer
+    EXPECT_EQ(find(newline, "foo bar"), 7);
+
+    EXPECT_EQ(find(newline, "foo\nbar"), 3);
+    EXPECT_EQ(find(newline, "\nfoobar"), 0);
+
+    // conditions matching multiple characters go through the look-up tables
+    auto constexpr ws = is_space || is_char<'-'>;
+    EXPECT_EQ(find(ws, "foo\tbar"), 3);
+    EXPECT_EQ(find(ws, "foo-bar"), 3);
+    EXPECT_EQ(find(ws, "foobarx"), 7);
+
+    // buffers spanning multiple chunks (chunk size is 16)
+    std::string const long_str = std::string(50, 'A') + '\t' + std::string(50, 'A');
+    EXPECT_EQ(find(ws, long_str), 50);
+    EXPECT_EQ(find(newline, long_str + '\n'), 101);
+}
+
+TEST(parse_condition, validate)
+{
+    using namespace seqan3;
+
+    auto constexpr cond = is_in_alphabet<seqan3::dna5>;
+
+    // index based convenience interface over find_first_not_of
+    std::string const valid{"ACGTNACGTNACGTNACGTN"};
+    EXPECT_EQ(cond.validate(std::span<char const>{valid}), valid.size());
+
+    std::string invalid = valid;
+    invalid[7] = '!';
+    EXPECT_EQ(cond.validate(std::span<char const>{invalid}), 7u);
+
+    EXPECT_EQ(cond.validate(std::span<char const>{}), 0u);
+}
@@ -0,0 +1,85 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/core/platform.hpp>
+
+#ifdef SEQAN3_HAS_ZSTD // the Zstandard dependency is optional
+
+#include <random>
+#include <sstream>
+#include <string>
+
+#include <seqan3/contrib/stream/zstd_istream.hpp>
+#include <seqan3/contrib/stream/zstd_ostream.hpp>
+#include <seqan3/io/stream/concept.hpp>
+
+using namespace seqan3;
+
+TEST(zstd_stream, concept_check)
+{
+    EXPECT_TRUE((OStream<contrib::zstd_ostream, char>));
+    EXPECT_TRUE((IStream<contrib::zstd_istream, char>));
+}
+
+//!\brief Generates pseudo random text that spans multiple internal buffers.
+static std::string random_text(size_t const length)
+{
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<uint8_t> dis('A', 'Z');
+
+    std::string text(length, '\0');
+    for (char & c : text)
+        c = dis(gen);
+    return text;
+}
+
+TEST(zstd_stream, roundtrip)
+{
+    std::string const uncompressed = random_text(1'000'000);
+
+    std::ostringstream compressed_stream{};
+    {
+        contrib::zstd_ostream compressor{compressed_stream};
+        compressor << uncompressed;
+    } // destructor finalizes the frame
+
+    std::string const compressed = compressed_stream.str();
+    ASSERT_GT(compressed.size(), 4u);
+
+    // the output starts with the Zstandard magic bytes that make_secondary_istream detects
+    EXPECT_EQ(compressed.compare(0, 4, "\x28\xb5\x2f\xfd", 4), 0);
+
+    std::istringstream istream{compressed};
+    contrib::zstd_istream decompressor{istream};
+    std::string const roundtripped{std::istreambuf_iterator<char>{decompressor},
+                                   std::istreambuf_iterator<char>{}};
+
+    EXPECT_EQ(roundtripped, uncompressed);
+}
+
+TEST(zstd_stream, small_input_with_flush)
+{
+    std::string const uncompressed{"The quick brown fox jumps over the lazy dog"};
+
+    std::ostringstream compressed_stream{};
+    {
+        contrib::zstd_ostream compressor{compressed_stream};
+        compressor << uncompressed << std::flush; // flush mid-frame must not corrupt the stream
+        compressor << uncompressed;
+    }
+
+    std::istringstream istream{compressed_stream.str()};
+    contrib::zstd_istream decompressor{istream};
+    std::string const roundtripped{std::istreambuf_iterator<char>{decompressor},
+                                   std::istreambuf_iterator<char>{}};
+
+    EXPECT_EQ(roundtripped, uncompressed + uncompressed);
+}
+
+#endif // SEQAN3_HAS_ZSTD
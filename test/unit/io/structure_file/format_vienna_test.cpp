@@ -427,6 +427,18 @@ TEST_F(read_fail, wrong_char)
     EXPECT_THROW( format.read(istream, options, seq, id, bpp, structure, energy, ig, ig, ig, ig), parse_error );
 }
 
+TEST_F(read_fail, wrong_char_in_long_structure)
+{
+    // the invalid character sits behind the first validation block of the bulk structure parser
+    std::string long_structure(100, '.');
+    long_structure[70] = '!';
+
+    input = "> long\n" + std::string(100, 'G') + "\n" + long_structure + "\n";
+
+    std::stringstream istream{input};
+    EXPECT_THROW( format.read(istream, options, seq, id, bpp, structure, energy, ig, ig, ig, ig), parse_error );
+}
+
 // ----------------------------------------------------------------------------
 // writing
 // ----------------------------------------------------------------------------
@@ -324,6 +324,22 @@ TEST_F(structure_file_input_read, record_general)
     EXPECT_EQ(counter, num_records);
 }
 
+TEST_F(structure_file_input_read, record_prefetch)
+{
+    structure_file_in fin{std::istringstream{input}, structure_file_format_vienna{}};
+    fin.prefetch(2);
+
+    size_t counter = 0ul;
+    for (auto & rec : fin)
+    {
+        EXPECT_TRUE((std::ranges::equal(get<field::SEQ>(rec), seq_comp[counter])));
+        EXPECT_TRUE((std::ranges::equal(get<field::ID>(rec), id_comp[counter])));
+        EXPECT_TRUE((std::ranges::equal(get<field::STRUCTURE>(rec), structure_comp[counter])));
+        ++counter;
+    }
+    EXPECT_EQ(counter, num_records);
+}
+
 TEST_F(structure_file_input_read, record_struct_bind)
 {
     /* record based reading */
@@ -0,0 +1,109 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/container/bitcompressed_vector.hpp>
+#include <seqan3/range/container/bitcompressed_vector_mmap.hpp>
+#include <seqan3/test/tmp_filename.hpp>
+
+using namespace seqan3;
+
+#ifdef SEQAN3_HAS_MMAP
+
+TEST(bitcompressed_vector_mmap, store_and_open)
+{
+    // 2 bits per letter, letters never straddle a word boundary
+    bitcompressed_vector<dna4> cont{"ACGTACGTACGTACGTACGTACGTACGTACGTACG"_dna4};
+
+    test::tmp_filename filename{"bitcompressed_store_test"};
+    bitcompressed_vector_mmap<dna4>::store(cont, filename.get_path());
+
+    bitcompressed_vector_mmap<dna4> store{filename.get_path()};
+    ASSERT_EQ(store.size(), cont.size());
+    EXPECT_FALSE(store.empty());
+
+    for (size_t i = 0; i < store.size(); ++i)
+        EXPECT_EQ(store[i], static_cast<dna4>(cont[i]));
+
+    EXPECT_EQ(store.front(), 'A'_dna4);
+    EXPECT_EQ(store.back(), 'G'_dna4);
+
+    // iteration yields the same letters
+    size_t i = 0;
+    for (dna4 const letter : store)
+        EXPECT_EQ(letter, static_cast<dna4>(cont[i++]));
+
+    EXPECT_THROW(store.at(store.size()), std::out_of_range);
+}
+
+TEST(bitcompressed_vector_mmap, straddling_letters)
+{
+    // 5 bits per letter, letters straddle 64 bit word boundaries
+    bitcompressed_vector<aa27> cont{"FROMTHEDESKOFDOCTORPROTEINWXYZ"_aa27};
+
+    test::tmp_filename filename{"bitcompressed_store_aa_test"};
+    bitcompressed_vector_mmap<aa27>::store(cont, filename.get_path());
+
+    bitcompressed_vector_mmap<aa27> store{filename.get_path()};
+    ASSERT_EQ(store.size(), cont.size());
+    for (size_t i = 0; i < store.size(); ++i)
+        EXPECT_EQ(store[i], static_cast<aa27>(cont[i]));
+}
+
+TEST(bitcompressed_vector_mmap, unflushed_push_back)
+{
+    // letters still sitting in the push_back() buffer must end up in the store, too
+    bitcompressed_vector<dna4> cont{};
+    for (dna4 const letter : "GATTACA"_dna4)
+        cont.push_back(letter);
+
+    test::tmp_filename filename{"bitcompressed_store_tail_test"};
+    bitcompressed_vector_mmap<dna4>::store(cont, filename.get_path());
+
+    bitcompressed_vector_mmap<dna4> store{filename.get_path()};
+    ASSERT_EQ(store.size(), 7u);
+    EXPECT_TRUE(std::ranges::equal(store, "GATTACA"_dna4));
+}
+
+TEST(bitcompressed_vector_mmap, empty_container)
+{
+    bitcompressed_vector<dna4> cont{};
+
+    test::tmp_filename filename{"bitcompressed_store_empty_test"};
+    bitcompressed_vector_mmap<dna4>::store(cont, filename.get_path());
+
+    bitcompressed_vector_mmap<dna4> store{filename.get_path()};
+    EXPECT_EQ(store.size(), 0u);
+    EXPECT_TRUE(store.empty());
+    EXPECT_TRUE(store.begin() == store.end());
+}
+
+TEST(bitcompressed_vector_mmap, invalid_files)
+{
+    // missing file
+    EXPECT_THROW((bitcompressed_vector_mmap<dna4>{"/nonexistent/bitcompressed_store"}), file_open_error);
+
+    // not a store file
+    test::tmp_filename filename{"bitcompressed_store_invalid_test"};
+    {
+        std::ofstream stream{filename.get_path(), std::ios::binary};
+        stream << "this is not a bitcompressed store, but long enough to hold a header";
+    }
+    EXPECT_THROW((bitcompressed_vector_mmap<dna4>{filename.get_path()}), format_error);
+
+    // stored with a different alphabet width
+    test::tmp_filename filename2{"bitcompressed_store_width_test"};
+    bitcompressed_vector_mmap<dna4>::store(bitcompressed_vector<dna4>{"ACGT"_dna4}, filename2.get_path());
+    EXPECT_THROW((bitcompressed_vector_mmap<aa27>{filename2.get_path()}), format_error);
+}
+
+#endif // SEQAN3_HAS_MMAP
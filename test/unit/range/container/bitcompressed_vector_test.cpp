@@ -0,0 +1,81 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/container/bitcompressed_vector.hpp>
+
+using namespace seqan3;
+
+TEST(bitcompressed_vector_block_iterator, concept)
+{
+    EXPECT_TRUE(std::ForwardIterator<bitcompressed_vector<dna4>::block_iterator>);
+}
+
+TEST(bitcompressed_vector_block_iterator, empty)
+{
+    bitcompressed_vector<dna4> cont{};
+    EXPECT_TRUE(cont.block_begin() == cont.block_end());
+}
+
+TEST(bitcompressed_vector_block_iterator, full_scan)
+{
+    // 200 letters cross several block boundaries and end mid-word
+    std::mt19937 rng{42};
+    bitcompressed_vector<dna4> cont{};
+    for (size_t i = 0; i < 200; ++i)
+        cont.push_back(assign_rank(dna4{}, rng() % 4));
+
+    size_t i = 0;
+    for (auto it = cont.block_begin(); it != cont.block_end(); ++it, ++i)
+        EXPECT_EQ(*it, static_cast<dna4>(cont[i]));
+    EXPECT_EQ(i, cont.size());
+}
+
+TEST(bitcompressed_vector_block_iterator, straddling_letters)
+{
+    // 5 bits per letter: letters straddle word boundaries, the generic decode path is used
+    bitcompressed_vector<aa27> cont{"FROMTHEDESKOFDOCTORPROTEINWXYZ"_aa27};
+
+    size_t i = 0;
+    for (auto it = cont.block_begin(); it != cont.block_end(); ++it, ++i)
+        EXPECT_EQ(*it, static_cast<aa27>(cont[i]));
+    EXPECT_EQ(i, cont.size());
+}
+
+TEST(bitcompressed_vector_block_iterator, unflushed_tail)
+{
+    // letters still sitting in the push_back() buffer are decoded, too
+    bitcompressed_vector<dna4> cont{};
+    for (dna4 const letter : "GATTACA"_dna4)
+        cont.push_back(letter);
+
+    dna4_vector decoded{};
+    for (auto it = cont.block_begin(); it != cont.block_end(); ++it)
+        decoded.push_back(*it);
+    EXPECT_EQ(decoded, "GATTACA"_dna4);
+}
+
+TEST(bitcompressed_vector_block_iterator, multipass)
+{
+    bitcompressed_vector<dna4> cont{"ACGTACGTACGT"_dna4};
+
+    // copies advance independently (ForwardIterator semantics)
+    auto it = cont.block_begin();
+    auto it2 = it;
+    ++it2;
+    EXPECT_EQ(*it, 'A'_dna4);
+    EXPECT_EQ(*it2, 'C'_dna4);
+
+    auto it3 = it2++;
+    EXPECT_EQ(*it3, 'C'_dna4);
+    EXPECT_EQ(*it2, 'G'_dna4);
+}
@@ -0,0 +1,75 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <fstream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/container/concatenated_sequences.hpp>
+#include <seqan3/range/container/concatenated_sequences_mmap.hpp>
+#include <seqan3/test/tmp_filename.hpp>
+
+using namespace seqan3;
+
+#ifdef SEQAN3_HAS_MMAP
+
+TEST(concatenated_sequences_mmap, store_and_open)
+{
+    concatenated_sequences<std::vector<dna4>> cont{"ACGT"_dna4, ""_dna4, "GAGGA"_dna4};
+
+    test::tmp_filename filename{"concat_store_test"};
+    concatenated_sequences_mmap<dna4>::store(cont, filename.get_path());
+
+    concatenated_sequences_mmap<dna4> store{filename.get_path()};
+    ASSERT_EQ(store.size(), cont.size());
+    EXPECT_EQ(store.concat_size(), cont.concat_size());
+    EXPECT_FALSE(store.empty());
+
+    for (size_t i = 0; i < store.size(); ++i)
+        EXPECT_TRUE(std::ranges::equal(store[i], cont[i]));
+
+    EXPECT_TRUE(std::ranges::equal(store.concat(), cont.concat()));
+
+    // iteration yields the same sequences
+    size_t i = 0;
+    for (auto && sequence : store)
+        EXPECT_TRUE(std::ranges::equal(sequence, cont[i++]));
+
+    EXPECT_THROW(store.at(3), std::out_of_range);
+}
+
+TEST(concatenated_sequences_mmap, empty_container)
+{
+    concatenated_sequences<std::vector<dna4>> cont{};
+
+    test::tmp_filename filename{"concat_store_empty_test"};
+    concatenated_sequences_mmap<dna4>::store(cont, filename.get_path());
+
+    concatenated_sequences_mmap<dna4> store{filename.get_path()};
+    EXPECT_EQ(store.size(), 0u);
+    EXPECT_EQ(store.concat_size(), 0u);
+    EXPECT_TRUE(store.empty());
+    EXPECT_TRUE(store.begin() == store.end());
+}
+
+TEST(concatenated_sequences_mmap, invalid_files)
+{
+    // missing file
+    EXPECT_THROW((concatenated_sequences_mmap<dna4>{"/nonexistent/concat_store"}), file_open_error);
+
+    // not a store file
+    test::tmp_filename filename{"concat_store_invalid_test"};
+    {
+        std::ofstream stream{filename.get_path(), std::ios::binary};
+        stream << "this is not a sequence store, but long enough to hold a header";
+    }
+    EXPECT_THROW((concatenated_sequences_mmap<dna4>{filename.get_path()}), format_error);
+}
+
+#endif // SEQAN3_HAS_MMAP
@@ -75,6 +75,27 @@ TYPED_TEST(container_of_container, construction)
     EXPECT_TRUE(t7 == t8);
 }
 
+TEST(container_of_container_special, parallel_construction)
+{
+    std::vector<std::vector<dna4>> source{};
+    for (size_t i = 0; i < 100; ++i) // varying lengths, including empty sequences
+        source.push_back(std::vector<dna4>(i % 7, assign_rank(dna4{}, i % 4)));
+
+    concatenated_sequences<std::vector<dna4>> serial{source};
+    concatenated_sequences<std::vector<dna4>> parallel{source, 4u};
+    EXPECT_TRUE(serial == parallel);
+
+    // thread counts below 2 fall back to the sequential path
+    concatenated_sequences<std::vector<dna4>> fallback{source, 0u};
+    EXPECT_TRUE(serial == fallback);
+
+    // more threads than sequences
+    std::vector<std::vector<dna4>> small{"ACGT"_dna4, "GA"_dna4};
+    concatenated_sequences<std::vector<dna4>> t1{small};
+    concatenated_sequences<std::vector<dna4>> t2{small, 8u};
+    EXPECT_TRUE(t1 == t2);
+}
+
 TYPED_TEST(container_of_container, assign)
 {
     TypeParam t1{"ACGT"_dna4, "ACGT"_dna4, "GAGGA"_dna4};
@@ -240,6 +240,53 @@ TYPED_TEST(container, insert)
     EXPECT_EQ(t0, t1);
 }
 
+TYPED_TEST(container, insert_at_end_bulk)
+{
+    // 131 letters: the packed path of bitcompressed_vector<dna4> sees partial words at both ends
+    std::vector<dna4> source;
+    for (size_t i = 0; i < 131; ++i)
+        source.push_back(assign_rank(dna4{}, i % 4));
+
+    TypeParam t0{};
+    t0.insert(t0.cend(), source.begin(), source.end());
+    EXPECT_TRUE(std::ranges::equal(t0, source));
+
+    // appending again starts at a non word-aligned boundary
+    t0.insert(t0.cend(), source.begin(), source.end());
+
+    std::vector<dna4> expected = source;
+    expected.insert(expected.end(), source.begin(), source.end());
+    EXPECT_EQ(t0.size(), 262u);
+    EXPECT_TRUE(std::ranges::equal(t0, expected));
+
+    // assign goes through the same path
+    TypeParam t1;
+    t1.assign(source.begin(), source.end());
+    EXPECT_TRUE(std::ranges::equal(t1, source));
+}
+
+TYPED_TEST(container, equality_long)
+{
+    std::vector<dna4> source;
+    for (size_t i = 0; i < 131; ++i)
+        source.push_back(assign_rank(dna4{}, i % 4));
+
+    TypeParam t1{source.begin(), source.end()};
+    TypeParam t2{t1};
+    EXPECT_EQ(t1, t2);
+
+    t2.back() = 'T'_dna4; // differs only in the trailing partial word
+    EXPECT_NE(t1, t2);
+
+    t2 = t1;
+    t2[64] = 'T'_dna4;    // differs in a full word in the middle
+    EXPECT_NE(t1, t2);
+
+    t2 = t1;
+    t2.push_back('A'_dna4); // same prefix, different size
+    EXPECT_NE(t1, t2);
+}
+
 TYPED_TEST(container, erase)
 {
     TypeParam t1{'A'_dna4, 'C'_dna4, 'C'_dna4, 'G'_dna4, 'T'_dna4};
@@ -270,6 +317,43 @@ TYPED_TEST(container, push_pop)
     EXPECT_EQ(t0, (TypeParam{}));
 }
 
+TYPED_TEST(container, push_pop_interleaved)
+{
+    TypeParam t0{};
+    TypeParam const & ct0 = t0;
+    std::vector<dna4> ref;
+
+    // 200 letters cross several 64bit word boundaries of bitcompressed_vector<dna4>
+    for (size_t i = 0; i < 200; ++i)
+    {
+        t0.push_back(assign_rank(dna4{}, i % 4));
+        ref.push_back(assign_rank(dna4{}, i % 4));
+
+        // const access must see letters that are possibly not yet packed into the compressed storage
+        EXPECT_EQ(ct0[ct0.size() - 1], ref.back());
+
+        if (i % 7 == 0)
+        {
+            t0.pop_back();
+            ref.pop_back();
+        }
+
+        if (i % 13 == 0) // mutable access in between
+            EXPECT_EQ(t0.back(), ref.back());
+
+        EXPECT_EQ(t0.size(), ref.size());
+    }
+
+    EXPECT_TRUE(std::ranges::equal(t0, ref));
+
+    // equality between a push_back-built and a bulk-built instance
+    TypeParam t1{ref.begin(), ref.end()};
+    EXPECT_EQ(t0, t1);
+    t1.pop_back();
+    EXPECT_NE(t0, t1);
+    EXPECT_TRUE(t1 < t0);
+}
+
 TYPED_TEST(container, resize)
 {
     TypeParam t0{};
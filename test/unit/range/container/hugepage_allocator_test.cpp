@@ -0,0 +1,86 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/range/container/hugepage_allocator.hpp>
+
+#include <numeric>
+#include <vector>
+
+using namespace seqan3;
+
+TEST(hugepage_allocator, standard_construction)
+{
+    EXPECT_TRUE((std::is_default_constructible_v<hugepage_allocator<int, 16>>));
+    EXPECT_TRUE((std::is_trivially_default_constructible_v<hugepage_allocator<int, 16>>));
+    EXPECT_TRUE((std::is_copy_constructible_v<hugepage_allocator<int, 16>>));
+    EXPECT_TRUE((std::is_move_constructible_v<hugepage_allocator<int, 16>>));
+    EXPECT_TRUE((std::is_copy_assignable_v<hugepage_allocator<int, 16>>));
+    EXPECT_TRUE((std::is_move_assignable_v<hugepage_allocator<int, 16>>));
+}
+
+TEST(hugepage_allocator, conversion_constructor)
+{
+    hugepage_allocator<int, 16> int_alloc{};
+    [[maybe_unused]] hugepage_allocator<float, 16> float_alloc{int_alloc};
+}
+
+TEST(hugepage_allocator, small_allocation)
+{
+    // below the huge-page threshold the allocator behaves like aligned_allocator
+    constexpr size_t alignment = 64;
+    hugepage_allocator<int, alignment> alloc{};
+
+    size_t const size = 10;
+    int * p = alloc.allocate(size);
+    ASSERT_NE(p, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(p) & (alignment - 1), 0u);
+
+    std::iota(p, p + size, 0);
+    EXPECT_EQ(p[size - 1], static_cast<int>(size - 1));
+
+    alloc.deallocate(p, size);
+}
+
+TEST(hugepage_allocator, large_allocation)
+{
+    using alloc_t = hugepage_allocator<char>;
+    alloc_t alloc{};
+
+    // one byte above the threshold rounds up to two huge pages
+    size_t const size = alloc_t::huge_page_size + 1;
+    char * p = alloc.allocate(size);
+    ASSERT_NE(p, nullptr);
+
+#ifdef SEQAN3_HAS_MMAP_ALLOC
+    // the mapping starts on a huge-page boundary
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(p) & (alloc_t::huge_page_size - 1), 0u);
+#endif
+
+    // every byte of the allocation is usable
+    std::fill(p, p + size, 'x');
+    EXPECT_EQ(p[0], 'x');
+    EXPECT_EQ(p[size - 1], 'x');
+
+    alloc.deallocate(p, size);
+}
+
+TEST(hugepage_allocator, in_vector)
+{
+    using alloc_t = hugepage_allocator<uint64_t>;
+
+    // large enough to cross the huge-page threshold when grown
+    std::vector<uint64_t, alloc_t> vec{};
+    size_t const count = (2 * alloc_t::huge_page_size) / sizeof(uint64_t);
+    for (size_t i = 0; i < count; ++i)
+        vec.push_back(i);
+
+    EXPECT_EQ(vec.size(), count);
+    EXPECT_EQ(vec.front(), 0u);
+    EXPECT_EQ(vec.back(), count - 1);
+}
@@ -0,0 +1,118 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/container/interleaved_sequences.hpp>
+
+using namespace seqan3;
+
+using batch_type = interleaved_sequences<dna4, 8>;
+
+TEST(interleaved_sequences, static_members)
+{
+    EXPECT_EQ(batch_type::lane_count, 8u);
+    EXPECT_EQ(batch_type::alignment, 8u * sizeof(typename batch_type::rank_type));
+    EXPECT_EQ(batch_type::padding_rank, alphabet_size_v<dna4>);
+}
+
+TEST(interleaved_sequences, construction)
+{
+    batch_type t1;
+    batch_type t2{};
+    EXPECT_TRUE(t1.empty());
+    EXPECT_EQ(t1.size(), t2.size());
+
+    std::vector<std::vector<dna4>> reads{"ACGT"_dna4, "AC"_dna4, "ACGTA"_dna4};
+    batch_type t3{reads};
+    EXPECT_FALSE(t3.empty());
+    EXPECT_EQ(t3.sequence_count(), 3u);
+    EXPECT_EQ(t3.size(), 5u); // the longest sequence determines the position count
+}
+
+TEST(interleaved_sequences, lane_major_layout)
+{
+    std::vector<std::vector<dna4>> reads{"ACGT"_dna4, "AC"_dna4, "ACGTA"_dna4};
+    batch_type batch{reads};
+
+    // position i of every read lies adjacent in memory
+    for (size_t position = 0; position < batch.size(); ++position)
+    {
+        auto block = batch.position(position);
+        for (size_t lane = 0; lane < reads.size(); ++lane)
+        {
+            if (position < reads[lane].size())
+                EXPECT_EQ(block[lane], to_rank(reads[lane][position])) << "position " << position
+                                                                       << " lane " << lane;
+            else // ragged end: padded with a rank no letter can assume
+                EXPECT_EQ(block[lane], batch_type::padding_rank);
+        }
+
+        // unoccupied lanes are fully padded
+        for (size_t lane = reads.size(); lane < batch_type::lane_count; ++lane)
+            EXPECT_EQ(block[lane], batch_type::padding_rank);
+    }
+
+    // the raw storage is one contiguous run of position blocks
+    EXPECT_EQ(batch.data()[1 * batch_type::lane_count + 2], to_rank(reads[2][1]));
+}
+
+TEST(interleaved_sequences, sequence_sizes)
+{
+    std::vector<std::vector<dna4>> reads{"ACGT"_dna4, "AC"_dna4, "ACGTA"_dna4};
+    batch_type batch{reads};
+
+    EXPECT_EQ(batch.sequence_size(0), 4u);
+    EXPECT_EQ(batch.sequence_size(1), 2u);
+    EXPECT_EQ(batch.sequence_size(2), 5u);
+    EXPECT_EQ(batch.sequence_size(3), 0u);
+}
+
+TEST(interleaved_sequences, aligned_storage)
+{
+    std::vector<std::vector<dna4>> reads{"ACGTACGTACGT"_dna4};
+    batch_type batch{reads};
+
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(batch.data()) % batch_type::alignment, 0u);
+}
+
+TEST(interleaved_sequences, reload)
+{
+    std::vector<std::vector<dna4>> first{"ACGT"_dna4, "AC"_dna4};
+    std::vector<std::vector<dna4>> second{"TT"_dna4, "GGG"_dna4, "A"_dna4};
+
+    batch_type batch{first};
+    batch.load(second); // replaces the previous batch, reusing the storage
+
+    EXPECT_EQ(batch.sequence_count(), 3u);
+    EXPECT_EQ(batch.size(), 3u);
+    EXPECT_EQ(batch.position(0)[1], to_rank('G'_dna4));
+    EXPECT_EQ(batch.position(1)[2], batch_type::padding_rank);
+
+    batch.clear();
+    EXPECT_TRUE(batch.empty());
+    EXPECT_EQ(batch.size(), 0u);
+}
+
+TEST(interleaved_sequences, too_many_sequences)
+{
+    std::vector<std::vector<dna4>> reads(9u, "ACGT"_dna4);
+    EXPECT_THROW((batch_type{reads}), std::invalid_argument);
+}
+
+TEST(interleaved_sequences, wider_rank_type)
+{
+    // SIMD kernels with 16-bit lanes store each rank in the matching width
+    interleaved_sequences<dna4, 8, int16_t> batch{std::vector<std::vector<dna4>>{"ACGT"_dna4}};
+
+    EXPECT_EQ(batch.alignment, 16u);
+    EXPECT_EQ(batch.position(3)[0], to_rank('T'_dna4));
+}
@@ -0,0 +1,167 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/range/container/masked_vector.hpp>
+
+using namespace seqan3;
+
+using mvector = masked_vector<dna5>;
+using mvalue  = masked<dna5>;
+
+TEST(masked_vector, concepts)
+{
+    EXPECT_TRUE(reservable_container_concept<mvector>);
+    EXPECT_TRUE((std::is_same_v<value_type_t<mvector>, mvalue>));
+}
+
+TEST(masked_vector, construction)
+{
+    mvector t1;
+    mvector t2{};
+    EXPECT_EQ(t1, t2);
+
+    // initializer list
+    mvector t3{mvalue{'A'_dna5, mask::UNMASKED}, mvalue{'C'_dna5, mask::MASKED}, mvalue{'G'_dna5, mask::UNMASKED}};
+    mvector t4 = {mvalue{'A'_dna5, mask::UNMASKED}, mvalue{'C'_dna5, mask::MASKED}, mvalue{'G'_dna5, mask::UNMASKED}};
+    EXPECT_EQ(t3, t4);
+
+    // n * value
+    mvector t5{2, mvalue{'C'_dna5, mask::MASKED}};
+    EXPECT_EQ(t5.size(), 2u);
+    EXPECT_EQ(t5[1], (mvalue{'C'_dna5, mask::MASKED}));
+
+    // from another container
+    std::vector<mvalue> aos{mvalue{'A'_dna5, mask::UNMASKED}, mvalue{'C'_dna5, mask::MASKED},
+                            mvalue{'G'_dna5, mask::UNMASKED}};
+    mvector t6{aos};
+    EXPECT_EQ(t6, t3);
+
+    // from iterator pair
+    mvector t7{aos.begin() + 1, aos.end()};
+    EXPECT_EQ(t7.size(), 2u);
+    EXPECT_EQ(t7[0], aos[1]);
+}
+
+TEST(masked_vector, bit_planes)
+{
+    mvector t1{mvalue{'A'_dna5, mask::UNMASKED}, mvalue{'C'_dna5, mask::MASKED}, mvalue{'G'_dna5, mask::UNMASKED}};
+
+    // the base letters are stored without the mask bits in between
+    EXPECT_EQ(t1.bases().size(), 3u);
+    EXPECT_EQ(t1.bases()[0], 'A'_dna5);
+    EXPECT_EQ(t1.bases()[1], 'C'_dna5);
+
+    // the mask plane holds one bit per position
+    EXPECT_EQ(t1.mask_plane().size(), 3u);
+    EXPECT_EQ(t1.mask_plane()[0], 0u);
+    EXPECT_EQ(t1.mask_plane()[1], 1u);
+}
+
+TEST(masked_vector, proxy_reference)
+{
+    mvector t1{mvalue{'A'_dna5, mask::UNMASKED}, mvalue{'C'_dna5, mask::MASKED}};
+
+    // reads combine base letter and mask bit
+    mvalue v = t1[1];
+    EXPECT_EQ(v, (mvalue{'C'_dna5, mask::MASKED}));
+    EXPECT_EQ(t1[1].to_char(), 'c'); // masked letters print lower-case
+    EXPECT_EQ(t1[0].to_char(), 'A');
+
+    // writes are split up into the two planes
+    t1[0] = mvalue{'G'_dna5, mask::MASKED};
+    EXPECT_EQ(t1.bases()[0], 'G'_dna5);
+    EXPECT_EQ(t1.mask_plane()[0], 1u);
+
+    // char assignment sets the mask bit from the case of the character
+    t1[0].assign_char('t');
+    EXPECT_EQ(t1.bases()[0], 'T'_dna5);
+    EXPECT_EQ(t1.mask_plane()[0], 1u);
+    t1[0].assign_char('T');
+    EXPECT_EQ(t1.mask_plane()[0], 0u);
+
+    // iterators hand out the same proxy
+    *t1.begin() = mvalue{'A'_dna5, mask::UNMASKED};
+    EXPECT_EQ(t1[0], (mvalue{'A'_dna5, mask::UNMASKED}));
+}
+
+TEST(masked_vector, bulk_queries)
+{
+    // long enough to exercise whole 64bit words plus both partial edges
+    mvector t1(200, mvalue{'A'_dna5, mask::UNMASKED});
+    t1[70]  = mvalue{'C'_dna5, mask::MASKED};
+    t1[150] = mvalue{'G'_dna5, mask::MASKED};
+    t1[151] = mvalue{'G'_dna5, mask::MASKED};
+
+    EXPECT_FALSE(t1.any_masked(0, 70));
+    EXPECT_TRUE(t1.any_masked(0, 71));
+    EXPECT_TRUE(t1.any_masked(70, 71));
+    EXPECT_FALSE(t1.any_masked(71, 150));
+    EXPECT_TRUE(t1.any_masked(100, 200));
+    EXPECT_FALSE(t1.any_masked(42, 42)); // empty range
+
+    EXPECT_EQ(t1.masked_count(0, 200), 3u);
+    EXPECT_EQ(t1.masked_count(0, 70), 0u);
+    EXPECT_EQ(t1.masked_count(70, 152), 3u);
+    EXPECT_EQ(t1.masked_count(150, 151), 1u);
+}
+
+TEST(masked_vector, modifiers)
+{
+    mvector t1;
+
+    t1.push_back(mvalue{'A'_dna5, mask::UNMASKED});
+    t1.push_back('C'_dna5, mask::MASKED); // convenience overload with separate parts
+    EXPECT_EQ(t1.size(), 2u);
+    EXPECT_EQ(t1.back(), (mvalue{'C'_dna5, mask::MASKED}));
+
+    t1.insert(t1.cbegin() + 1, mvalue{'G'_dna5, mask::MASKED});
+    EXPECT_EQ(t1[1], (mvalue{'G'_dna5, mask::MASKED}));
+    EXPECT_EQ(t1.size(), 3u);
+
+    t1.erase(t1.cbegin());
+    EXPECT_EQ(t1.size(), 2u);
+    EXPECT_EQ(t1.front(), (mvalue{'G'_dna5, mask::MASKED}));
+
+    t1.resize(4, mvalue{'N'_dna5, mask::UNMASKED});
+    EXPECT_EQ(t1.size(), 4u);
+    EXPECT_EQ(t1.back(), (mvalue{'N'_dna5, mask::UNMASKED}));
+
+    t1.pop_back();
+    EXPECT_EQ(t1.size(), 3u);
+
+    t1.clear();
+    EXPECT_TRUE(t1.empty());
+    EXPECT_EQ(t1.bases().size(), 0u);
+    EXPECT_EQ(t1.mask_plane().size(), 0u);
+}
+
+TEST(masked_vector, comparison)
+{
+    mvector t1{mvalue{'A'_dna5, mask::UNMASKED}, mvalue{'C'_dna5, mask::UNMASKED}};
+    mvector t2{mvalue{'A'_dna5, mask::UNMASKED}, mvalue{'C'_dna5, mask::UNMASKED}};
+    mvector t3{mvalue{'A'_dna5, mask::UNMASKED}, mvalue{'C'_dna5, mask::MASKED}};
+    mvector t4{mvalue{'A'_dna5, mask::UNMASKED}, mvalue{'G'_dna5, mask::UNMASKED}};
+
+    EXPECT_EQ(t1, t2);
+    EXPECT_NE(t1, t3);
+
+    // same order as for std::vector<mvalue>: the base letter is the most significant component
+    EXPECT_LT(t1, t3);
+    EXPECT_LT(t3, t4);
+    EXPECT_LE(t1, t2);
+    EXPECT_GE(t4, t3);
+    EXPECT_GT(t4, t1);
+
+    // prefix compares smaller
+    mvector t5{mvalue{'A'_dna5, mask::UNMASKED}};
+    EXPECT_LT(t5, t1);
+}
@@ -0,0 +1,108 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <seqan3/range/container/mmap_vector.hpp>
+
+using namespace seqan3;
+
+#ifdef SEQAN3_HAS_MMAP
+
+TEST(mmap_vector, growth_without_moving)
+{
+    mmap_vector<uint64_t> v{};
+    EXPECT_TRUE(v.empty());
+    EXPECT_EQ(v.size(), 0u);
+    EXPECT_EQ(v.capacity(), 0u); // reserved lazily
+
+    v.push_back(42u);
+    uint64_t const * const stable = v.data();
+
+    for (uint64_t i = 1; i < 1'000'000; ++i)
+        v.push_back(i);
+
+    EXPECT_EQ(v.data(), stable); // growth never reallocates
+    EXPECT_EQ(v.size(), 1'000'000u);
+    EXPECT_EQ(v.front(), 42u);
+    EXPECT_EQ(v.back(), 999'999u);
+    EXPECT_EQ(v[999], 999u);
+    EXPECT_THROW(v.at(v.size()), std::out_of_range);
+
+    v.pop_back();
+    EXPECT_EQ(v.back(), 999'998u);
+
+    v.shrink_to_fit(); // returns pages behind the size, the data survives
+    EXPECT_EQ(v[123'456], 123'456u);
+    v.push_back(7u);
+    EXPECT_EQ(v.data(), stable);
+}
+
+TEST(mmap_vector, explicit_capacity_is_a_hard_limit)
+{
+    mmap_vector<uint32_t> v{1024};
+    EXPECT_GE(v.capacity(), 1024u); // rounded up to whole pages
+
+    for (size_t i = 0; i < v.capacity(); ++i)
+        v.push_back(i);
+
+    EXPECT_THROW(v.push_back(0u), std::length_error);
+}
+
+TEST(mmap_vector, resize_and_clear)
+{
+    mmap_vector<int> v{};
+    v.resize(1000, 3);
+    EXPECT_EQ(v.size(), 1000u);
+    EXPECT_EQ(v[999], 3);
+
+    v.resize(10);
+    v.resize(2000);
+    EXPECT_EQ(v[5], 3);     // shrinking keeps the prefix
+    EXPECT_EQ(v[1999], 0);  // new elements are value-initialised
+
+    v.clear();
+    EXPECT_TRUE(v.empty());
+}
+
+TEST(mmap_vector, copy_move_swap_compare)
+{
+    mmap_vector<uint64_t> v{};
+    std::mt19937_64 rng{42};
+    for (int i = 0; i < 10'000; ++i)
+        v.push_back(rng());
+
+    mmap_vector<uint64_t> copy{v};
+    EXPECT_EQ(copy, v);
+    EXPECT_NE(copy.data(), v.data());
+
+    std::sort(copy.begin(), copy.end());
+    EXPECT_TRUE(std::is_sorted(copy.begin(), copy.end()));
+    EXPECT_NE(copy, v);
+
+    mmap_vector<uint64_t> moved{std::move(copy)};
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(moved.size(), 10'000u);
+
+    copy = std::move(moved);
+    EXPECT_EQ(copy.size(), 10'000u);
+
+    mmap_vector<uint64_t> other{};
+    other.push_back(1u);
+    other.swap(copy);
+    EXPECT_EQ(other.size(), 10'000u);
+    EXPECT_EQ(copy.size(), 1u);
+
+    auto & ref = copy.emplace_back(uint64_t{99});
+    EXPECT_EQ(ref, 99u);
+    EXPECT_EQ(&ref, &copy.back());
+}
+
+#endif // SEQAN3_HAS_MMAP
@@ -0,0 +1,120 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/range/container/pool_allocator.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace seqan3;
+
+TEST(pool_allocator, standard_construction)
+{
+    EXPECT_TRUE((std::is_default_constructible_v<pool_allocator<int>>));
+    EXPECT_TRUE((std::is_trivially_default_constructible_v<pool_allocator<int>>));
+    EXPECT_TRUE((std::is_copy_constructible_v<pool_allocator<int>>));
+    EXPECT_TRUE((std::is_move_constructible_v<pool_allocator<int>>));
+    EXPECT_TRUE((std::is_copy_assignable_v<pool_allocator<int>>));
+    EXPECT_TRUE((std::is_move_assignable_v<pool_allocator<int>>));
+}
+
+TEST(pool_allocator, conversion_constructor)
+{
+    pool_allocator<int> int_alloc{};
+    [[maybe_unused]] pool_allocator<float> float_alloc{int_alloc};
+
+    // all pool allocators are interchangeable handles to the same pools
+    EXPECT_TRUE(int_alloc == float_alloc);
+    EXPECT_FALSE(int_alloc != float_alloc);
+}
+
+TEST(pool_allocator, block_reuse)
+{
+    pool_allocator<int> alloc{};
+
+    // freeing a pooled block and requesting the same size class again returns the very same block
+    int * p = alloc.allocate(10); // 40 bytes
+    ASSERT_NE(p, nullptr);
+    std::iota(p, p + 10, 0);
+    EXPECT_EQ(p[9], 9);
+    alloc.deallocate(p, 10);
+
+    int * q = alloc.allocate(12); // 48 bytes, same power-of-two size class
+    EXPECT_EQ(p, q);
+    alloc.deallocate(q, 12);
+
+    // a rebound allocator draws from the same pools
+    pool_allocator<char> char_alloc{alloc};
+    char * r = char_alloc.allocate(48);
+    EXPECT_EQ(static_cast<void *>(r), static_cast<void *>(p));
+    char_alloc.deallocate(r, 48);
+}
+
+TEST(pool_allocator, large_allocation)
+{
+    using alloc_t = pool_allocator<char>;
+    alloc_t alloc{};
+
+    // one byte above the pooled threshold goes to the global heap but works the same
+    size_t const size = alloc_t::max_pooled_size + 1;
+    char * p = alloc.allocate(size);
+    ASSERT_NE(p, nullptr);
+
+    std::fill(p, p + size, 'x');
+    EXPECT_EQ(p[0], 'x');
+    EXPECT_EQ(p[size - 1], 'x');
+
+    alloc.deallocate(p, size);
+}
+
+TEST(pool_allocator, cross_thread_deallocation)
+{
+    pool_allocator<int> alloc{};
+
+    // a block allocated here may be freed by another thread and continues its life there
+    int * p = alloc.allocate(32);
+    std::iota(p, p + 32, 0);
+
+    std::thread worker{[p] ()
+    {
+        pool_allocator<int> worker_alloc{};
+        worker_alloc.deallocate(p, 32);
+
+        int * q = worker_alloc.allocate(32); // comes off the worker's free list
+        EXPECT_EQ(q, p);
+        worker_alloc.deallocate(q, 32);
+    }};
+    worker.join();
+}
+
+TEST(pool_allocator, in_vector)
+{
+    // growth crosses several size classes and finally the pooled threshold
+    std::vector<uint64_t, pool_allocator<uint64_t>> vec{};
+    size_t const count = 10000;
+    for (size_t i = 0; i < count; ++i)
+        vec.push_back(i);
+
+    EXPECT_EQ(vec.size(), count);
+    EXPECT_EQ(vec.front(), 0u);
+    EXPECT_EQ(vec.back(), count - 1);
+}
+
+TEST(pool_allocator, in_string)
+{
+    std::basic_string<char, std::char_traits<char>, pool_allocator<char>> str{};
+    for (size_t i = 0; i < 1000; ++i)
+        str.push_back('a' + (i % 26));
+
+    EXPECT_EQ(str.size(), 1000u);
+    EXPECT_EQ(str.front(), 'a');
+}
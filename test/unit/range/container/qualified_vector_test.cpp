@@ -0,0 +1,161 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/alphabet/quality/phred42.hpp>
+#include <seqan3/range/container/qualified_vector.hpp>
+
+using namespace seqan3;
+
+using qvector = qualified_vector<dna5, phred42>;
+using qvalue  = qualified<dna5, phred42>;
+
+TEST(qualified_vector, concepts)
+{
+    EXPECT_TRUE(reservable_container_concept<qvector>);
+    EXPECT_TRUE((std::is_same_v<value_type_t<qvector>, qvalue>));
+}
+
+TEST(qualified_vector, construction)
+{
+    qvector t1;
+    qvector t2{};
+    EXPECT_EQ(t1, t2);
+
+    // initializer list
+    qvector t3{qvalue{'A'_dna5, phred42{1}}, qvalue{'C'_dna5, phred42{2}}, qvalue{'G'_dna5, phred42{3}}};
+    qvector t4 = {qvalue{'A'_dna5, phred42{1}}, qvalue{'C'_dna5, phred42{2}}, qvalue{'G'_dna5, phred42{3}}};
+    EXPECT_EQ(t3, t4);
+
+    // n * value
+    qvector t5{2, qvalue{'C'_dna5, phred42{2}}};
+    EXPECT_EQ(t5.size(), 2u);
+    EXPECT_EQ(t5[1], (qvalue{'C'_dna5, phred42{2}}));
+
+    // from another container
+    std::vector<qvalue> aos{qvalue{'A'_dna5, phred42{1}}, qvalue{'C'_dna5, phred42{2}}, qvalue{'G'_dna5, phred42{3}}};
+    qvector t6{aos};
+    EXPECT_EQ(t6, t3);
+
+    // from iterator pair
+    qvector t7{aos.begin() + 1, aos.end()};
+    EXPECT_EQ(t7.size(), 2u);
+    EXPECT_EQ(t7[0], aos[1]);
+}
+
+TEST(qualified_vector, structure_of_arrays)
+{
+    qvector t1{qvalue{'A'_dna5, phred42{1}}, qvalue{'C'_dna5, phred42{2}}, qvalue{'G'_dna5, phred42{3}}};
+
+    // the bases lie contiguously, without quality letters in between
+    auto bases = t1.sequence();
+    EXPECT_TRUE((std::is_same_v<decltype(bases), std::span<dna5>>));
+    EXPECT_EQ(bases.size(), 3u);
+    EXPECT_EQ(bases[0], 'A'_dna5);
+    EXPECT_EQ(bases[2], 'G'_dna5);
+    EXPECT_EQ(bases.data() + 1, std::addressof(bases[1]));
+
+    auto quals = t1.qualities();
+    EXPECT_EQ(quals.size(), 3u);
+    EXPECT_EQ(quals[1], phred42{2});
+
+    // writes through the spans are visible in the unified records
+    bases[0] = 'T'_dna5;
+    quals[0] = phred42{40};
+    EXPECT_EQ(t1[0], (qvalue{'T'_dna5, phred42{40}}));
+
+    // const access
+    qvector const & t2 = t1;
+    EXPECT_TRUE((std::is_same_v<decltype(t2.sequence()), std::span<dna5 const>>));
+    EXPECT_EQ(t2.sequence()[0], 'T'_dna5);
+}
+
+TEST(qualified_vector, proxy_reference)
+{
+    qvector t1{qvalue{'A'_dna5, phred42{1}}, qvalue{'C'_dna5, phred42{2}}};
+
+    // reads combine both letters
+    qvalue v = t1[1];
+    EXPECT_EQ(v, (qvalue{'C'_dna5, phred42{2}}));
+    EXPECT_EQ(t1[1].to_char(), 'C');
+    EXPECT_EQ(t1[1].to_phred(), 2);
+
+    // writes are split up into the two arrays
+    t1[0] = qvalue{'G'_dna5, phred42{33}};
+    EXPECT_EQ(t1.sequence()[0], 'G'_dna5);
+    EXPECT_EQ(t1.qualities()[0], phred42{33});
+
+    // partial writes through the quality interface only touch the quality array
+    t1[0].assign_phred(7);
+    EXPECT_EQ(t1.sequence()[0], 'G'_dna5);
+    EXPECT_EQ(t1.qualities()[0], phred42{7});
+
+    // ... and through the char interface only the sequence array
+    t1[0].assign_char('T');
+    EXPECT_EQ(t1.sequence()[0], 'T'_dna5);
+    EXPECT_EQ(t1.qualities()[0], phred42{7});
+
+    // iterators hand out the same proxy
+    *t1.begin() = qvalue{'A'_dna5, phred42{0}};
+    EXPECT_EQ(t1[0], (qvalue{'A'_dna5, phred42{0}}));
+}
+
+TEST(qualified_vector, modifiers)
+{
+    qvector t1;
+
+    t1.push_back(qvalue{'A'_dna5, phred42{1}});
+    t1.push_back('C'_dna5, phred42{2}); // convenience overload with separate letters
+    EXPECT_EQ(t1.size(), 2u);
+    EXPECT_EQ(t1.back(), (qvalue{'C'_dna5, phred42{2}}));
+
+    t1.insert(t1.cbegin() + 1, qvalue{'G'_dna5, phred42{3}});
+    EXPECT_EQ(t1[1], (qvalue{'G'_dna5, phred42{3}}));
+    EXPECT_EQ(t1.size(), 3u);
+
+    t1.erase(t1.cbegin());
+    EXPECT_EQ(t1.size(), 2u);
+    EXPECT_EQ(t1.front(), (qvalue{'G'_dna5, phred42{3}}));
+
+    t1.resize(4, qvalue{'N'_dna5, phred42{0}});
+    EXPECT_EQ(t1.size(), 4u);
+    EXPECT_EQ(t1.back(), (qvalue{'N'_dna5, phred42{0}}));
+
+    t1.pop_back();
+    EXPECT_EQ(t1.size(), 3u);
+
+    t1.clear();
+    EXPECT_TRUE(t1.empty());
+    EXPECT_EQ(t1.sequence().size(), 0u);
+    EXPECT_EQ(t1.qualities().size(), 0u);
+}
+
+TEST(qualified_vector, comparison)
+{
+    qvector t1{qvalue{'A'_dna5, phred42{1}}, qvalue{'C'_dna5, phred42{2}}};
+    qvector t2{qvalue{'A'_dna5, phred42{1}}, qvalue{'C'_dna5, phred42{2}}};
+    qvector t3{qvalue{'A'_dna5, phred42{1}}, qvalue{'C'_dna5, phred42{3}}};
+    qvector t4{qvalue{'A'_dna5, phred42{1}}, qvalue{'G'_dna5, phred42{0}}};
+
+    EXPECT_EQ(t1, t2);
+    EXPECT_NE(t1, t3);
+
+    // same order as for std::vector<qvalue>: the sequence letter is the most significant component
+    EXPECT_LT(t1, t3);
+    EXPECT_LT(t3, t4);
+    EXPECT_LE(t1, t2);
+    EXPECT_GE(t4, t3);
+    EXPECT_GT(t4, t1);
+
+    // prefix compares smaller
+    qvector t5{qvalue{'A'_dna5, phred42{1}}};
+    EXPECT_LT(t5, t1);
+}
@@ -0,0 +1,112 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/range/container/twobit_vector.hpp>
+
+using namespace seqan3;
+
+TEST(twobit_vector, push_back_and_access)
+{
+    twobit_vector<dna5> v{};
+    for (dna5 const l : "ACGNTNA"_dna5)
+        v.push_back(l);
+
+    ASSERT_EQ(v.size(), 7u);
+    EXPECT_EQ(v.exception_count(), 2u); // only the two Ns leave the 2-bit payload
+
+    std::vector<dna5> expected = "ACGNTNA"_dna5;
+    for (size_t i = 0; i < v.size(); ++i)
+        EXPECT_EQ(dna5{v[i]}, expected[i]);
+}
+
+TEST(twobit_vector, proxy_writes_update_the_dictionary)
+{
+    twobit_vector<dna5> v{"ACGNT"_dna5};
+    EXPECT_EQ(v.exception_count(), 1u);
+
+    v[3] = 'A'_dna5; // N -> A removes the exception
+    EXPECT_EQ(v.exception_count(), 0u);
+    EXPECT_EQ(dna5{v[3]}, 'A'_dna5);
+
+    v[0] = 'N'_dna5; // A -> N adds one
+    v[4] = 'N'_dna5;
+    EXPECT_EQ(v.exception_count(), 2u);
+    EXPECT_EQ(dna5{v[0]}, 'N'_dna5);
+    EXPECT_EQ(dna5{v.front()}, 'N'_dna5);
+    EXPECT_EQ(dna5{v.back()}, 'N'_dna5);
+}
+
+TEST(twobit_vector, rank_and_select)
+{
+    twobit_vector<dna5> v{"NACGNTACGN"_dna5};
+    EXPECT_EQ(v.exception_count(), 3u);
+
+    EXPECT_EQ(v.exception_rank(0), 0u);
+    EXPECT_EQ(v.exception_rank(1), 1u); // one N in [0, 1)
+    EXPECT_EQ(v.exception_rank(5), 2u);
+    EXPECT_EQ(v.exception_rank(v.size()), 3u);
+
+    EXPECT_EQ(v.exception_select(0), 0u);
+    EXPECT_EQ(v.exception_select(1), 4u);
+    EXPECT_EQ(v.exception_select(2), 9u);
+
+    EXPECT_EQ(v.bases().size(), v.size()); // 2-bit payload covers every position
+}
+
+TEST(twobit_vector, insert_and_erase_shift_exceptions)
+{
+    twobit_vector<dna5> v{"ACGNT"_dna5};
+
+    std::vector<dna5> const block = "NAN"_dna5;
+    v.insert(v.cbegin() + 2, block.begin(), block.end()); // ACNANGNT
+    ASSERT_EQ(v.size(), 8u);
+    EXPECT_EQ(v.exception_count(), 3u);
+
+    std::vector<dna5> expected = "ACNANGNT"_dna5;
+    for (size_t i = 0; i < v.size(); ++i)
+        EXPECT_EQ(dna5{v[i]}, expected[i]);
+
+    v.erase(v.cbegin() + 2, v.cbegin() + 5); // back to ACGNT
+    expected = "ACGNT"_dna5;
+    ASSERT_EQ(v.size(), 5u);
+    EXPECT_EQ(v.exception_count(), 1u);
+    EXPECT_EQ(v.exception_select(0), 3u);
+    for (size_t i = 0; i < v.size(); ++i)
+        EXPECT_EQ(dna5{v[i]}, expected[i]);
+
+    v.pop_back();
+    v.pop_back(); // removes the N, too
+    EXPECT_EQ(v.exception_count(), 0u);
+}
+
+TEST(twobit_vector, compare_assign_resize)
+{
+    twobit_vector<dna5> v{"ACGNT"_dna5};
+    twobit_vector<dna5> w{v};
+    EXPECT_EQ(v, w);
+
+    w[3] = 'G'_dna5;
+    EXPECT_NE(v, w);
+    EXPECT_LT(w, v); // 'G' sorts before 'N'
+
+    v.resize(8, 'N'_dna5);
+    EXPECT_EQ(v.size(), 8u);
+    EXPECT_EQ(v.exception_count(), 4u);
+    v.resize(3);
+    EXPECT_EQ(v.exception_count(), 0u);
+
+    v.assign(4, 'N'_dna5);
+    EXPECT_EQ(v.size(), 4u);
+    EXPECT_EQ(v.exception_count(), 4u);
+    EXPECT_THROW(v.at(4), std::out_of_range);
+
+    v.clear();
+    EXPECT_TRUE(v.empty());
+}
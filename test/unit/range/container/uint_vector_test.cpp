@@ -0,0 +1,160 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/container/concatenated_sequences.hpp>
+#include <seqan3/range/container/concept.hpp>
+#include <seqan3/range/container/uint_vector.hpp>
+
+using namespace seqan3;
+
+TEST(uint_vector, concepts)
+{
+    EXPECT_TRUE(reservable_container_concept<uint_vector<40>>);
+    EXPECT_TRUE(std::ranges::RandomAccessRange<uint_vector<40>>);
+}
+
+TEST(uint_vector, construction_and_assign)
+{
+    uint_vector<10> v{5, 17, 1000, 0, 1023};
+    EXPECT_EQ(v.size(), 5u);
+    EXPECT_EQ(v[0], 5u);
+    EXPECT_EQ(v[2], 1000u);
+    EXPECT_EQ(v[4], 1023u);
+    EXPECT_EQ(v.front(), 5u);
+    EXPECT_EQ(v.back(), 1023u);
+    EXPECT_THROW(v.at(5), std::out_of_range);
+
+    // count + value
+    uint_vector<10> v2(4, 42u);
+    EXPECT_EQ(v2.size(), 4u);
+    EXPECT_EQ(v2[3], 42u);
+
+    // from a range
+    std::vector<uint64_t> source{1, 2, 3};
+    uint_vector<10> v3{source};
+    EXPECT_TRUE(std::ranges::equal(v3, source));
+
+    // assign
+    v2.assign({7u, 8u});
+    EXPECT_EQ(v2.size(), 2u);
+    EXPECT_EQ(v2[1], 8u);
+}
+
+TEST(uint_vector, reference_proxy)
+{
+    uint_vector<10> v(3, 0u);
+
+    v[1] = 700u;
+    EXPECT_EQ(v[1], 700u);
+
+    v[1] += 100u;
+    EXPECT_EQ(v[1], 800u);
+
+    v[1] -= 300u;
+    EXPECT_EQ(v[1], 500u);
+
+    ++v[0];
+    EXPECT_EQ(v[0], 1u);
+
+    // assignment between proxies assigns the value
+    v[2] = v[1];
+    EXPECT_EQ(v[2], 500u);
+
+    // proxies bind to auto && (required by concatenated_sequences)
+    std::for_each(v.begin(), v.end(), [] (auto && d) { d += 2; });
+    EXPECT_EQ(v[0], 3u);
+    EXPECT_EQ(v[1], 502u);
+    EXPECT_EQ(v[2], 502u);
+}
+
+TEST(uint_vector, modifiers)
+{
+    uint_vector<10> v{};
+    EXPECT_TRUE(v.empty());
+
+    for (uint64_t i = 0; i < 10; ++i)
+        v.push_back(i);
+    EXPECT_EQ(v.size(), 10u);
+    EXPECT_EQ(v.back(), 9u);
+
+    v.pop_back();
+    EXPECT_EQ(v.size(), 9u);
+
+    auto it = v.insert(v.begin() + 2, 1000u);
+    EXPECT_EQ(*it, 1000u);
+    EXPECT_EQ(v[2], 1000u);
+    EXPECT_EQ(v[3], 2u);
+
+    std::vector<uint64_t> extra{20, 21};
+    v.insert(v.begin(), extra.begin(), extra.end());
+    EXPECT_EQ(v[0], 20u);
+    EXPECT_EQ(v[1], 21u);
+    EXPECT_EQ(v[2], 0u);
+
+    v.erase(v.begin(), v.begin() + 2);
+    EXPECT_EQ(v[0], 0u);
+
+    v.erase(v.begin() + 2);
+    EXPECT_EQ(v[2], 2u);
+
+    v.resize(3);
+    EXPECT_EQ(v.size(), 3u);
+    v.resize(5, 7u);
+    EXPECT_EQ(v.size(), 5u);
+    EXPECT_EQ(v[4], 7u);
+
+    v.clear();
+    EXPECT_TRUE(v.empty());
+}
+
+TEST(uint_vector, comparison)
+{
+    uint_vector<10> v1{1, 2, 3};
+    uint_vector<10> v2{1, 2, 3};
+    uint_vector<10> v3{1, 2, 4};
+
+    EXPECT_TRUE(v1 == v2);
+    EXPECT_TRUE(v1 != v3);
+    EXPECT_TRUE(v1 < v3);
+    EXPECT_TRUE(v3 > v1);
+    EXPECT_TRUE(v1 <= v2);
+    EXPECT_TRUE(v3 >= v1);
+}
+
+TEST(uint_vector, as_delimiter_policy)
+{
+    using compressed_t = concatenated_sequences<std::vector<dna4>, uint_vector<40>>;
+    using default_t = concatenated_sequences<std::vector<dna4>>;
+
+    std::vector<std::vector<dna4>> source{"ACGT"_dna4, ""_dna4, "GATTACA"_dna4, "AC"_dna4};
+
+    compressed_t compressed{source.begin(), source.end()};
+    default_t defaulted{source.begin(), source.end()};
+
+    ASSERT_EQ(compressed.size(), defaulted.size());
+    for (size_t i = 0; i < compressed.size(); ++i)
+        EXPECT_TRUE(std::ranges::equal(compressed[i], defaulted[i]));
+
+    // modifiers exercise the delimiter updates (insert/erase shift all following offsets)
+    compressed.insert(compressed.begin() + 1, "TTT"_dna4);
+    defaulted.insert(defaulted.begin() + 1, "TTT"_dna4);
+    compressed.erase(compressed.begin() + 3);
+    defaulted.erase(defaulted.begin() + 3);
+    compressed.push_back("GG"_dna4);
+    defaulted.push_back("GG"_dna4);
+
+    ASSERT_EQ(compressed.size(), defaulted.size());
+    for (size_t i = 0; i < compressed.size(); ++i)
+        EXPECT_TRUE(std::ranges::equal(compressed[i], defaulted[i]));
+
+    EXPECT_TRUE(std::ranges::equal(compressed.concat(), defaulted.concat()));
+}
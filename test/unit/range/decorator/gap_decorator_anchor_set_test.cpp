@@ -220,6 +220,37 @@ TEST(gap_decorator_anchor_set, comparison)
     EXPECT_NE(dec, decNE);
 }
 
+TEST(gap_decorator_anchor_set, insert_gaps)
+{
+    std::vector<dna4> const v{"ACTG"_dna4};
+
+    // bulk insertion into a gap-free decorator equals the corresponding insert_gap calls
+    gap_decorator_anchor_set dec{v};
+    std::vector<std::pair<size_t, size_t>> const gap_runs{{0, 1}, {3, 2}, {7, 1}}; // -AC--TG-
+    insert_gaps(dec, gap_runs);
+
+    gap_decorator_anchor_set dec2{v};
+    insert_gap(dec2, std::next(dec2.begin(), 2), 2);
+    insert_gap(dec2, dec2.end());
+    insert_gap(dec2, dec2.begin());
+
+    EXPECT_EQ(dec.size(), 8u);
+    EXPECT_EQ(dec, dec2);
+
+    // adjacent runs are merged into one maximal gap
+    gap_decorator_anchor_set dec3{v};
+    insert_gaps(dec3, std::vector<std::pair<size_t, size_t>>{{1, 1}, {2, 2}}); // A---CTG
+    gap_decorator_anchor_set dec4{v};
+    insert_gap(dec4, std::next(dec4.begin(), 1), 3);
+    EXPECT_EQ(dec3, dec4);
+
+    // bulk insertion into a decorator that already contains gaps
+    insert_gaps(dec3, std::vector<std::pair<size_t, size_t>>{{0, 1}}); // -A---CTG
+    EXPECT_EQ(dec3.size(), 8u);
+    EXPECT_EQ(dec3[0], gap{});
+    EXPECT_EQ(dec3[1], 'A'_dna4);
+}
+
 TEST(gap_decorator_anchor_set, begin_and_end)
 {
     std::vector<dna4> v{"ACTG"_dna4};
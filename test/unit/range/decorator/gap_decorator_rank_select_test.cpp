@@ -0,0 +1,256 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <seqan3/alignment/aligned_sequence/aligned_sequence_concept.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/decorator/gap_decorator_rank_select.hpp>
+#include <seqan3/std/ranges>
+#include <seqan3/test/pretty_printing.hpp>
+
+#include "../../alignment/aligned_sequence_test_template.hpp"
+
+using namespace seqan3;
+
+using decorator_t = gap_decorator_rank_select<std::vector<dna4> const &>;
+
+const std::vector<dna4> dummy_obj{}; // dummy lvalue for type declaration of views
+using decorator_t2 = gap_decorator_rank_select<
+                         decltype(std::ranges::subrange<decltype(dummy_obj.begin()),
+                                                 decltype(dummy_obj.begin())>{dummy_obj.begin(), dummy_obj.end()})>;
+
+using test_types = ::testing::Types<decorator_t, decorator_t2>;
+
+// ---------------------------------------------------------------------------------------------------------------------
+// test templates
+// ---------------------------------------------------------------------------------------------------------------------
+
+template <typename inner_type_>
+class aligned_sequence<gap_decorator_rank_select<inner_type_>> : public ::testing::Test
+{
+public:
+    // Initialiser function is needed for the typed test because the gapped_decorator
+    // will be initialised differently than the naive vector<gapped<dna>>.
+    void initialise_typed_test_container(decorator_t & container, dna4_vector const & target)
+    {
+        container = target;
+    }
+
+    // Initialiser function is needed for the typed test because the gapped_decorator
+    // will be initialised differently than the naive vector<gapped<dna>>.
+    void initialise_typed_test_container(decorator_t2 & container, dna4_vector const & target)
+    {
+        container = std::ranges::subrange<decltype(target.begin()), decltype(target.end())>{target.begin(), target.end()};
+    }
+};
+
+INSTANTIATE_TYPED_TEST_CASE_P(gap_decorator_rank_select, aligned_sequence, test_types);
+
+// ---------------------------------------------------------------------------------------------------------------------
+// typed test
+// ---------------------------------------------------------------------------------------------------------------------
+
+template <typename t>
+class gap_decorator_rank_select_f : public ::testing::Test {};
+
+TYPED_TEST_CASE(gap_decorator_rank_select_f, test_types);
+
+// concept checks
+TYPED_TEST(gap_decorator_rank_select_f, concept_checks)
+{
+    EXPECT_TRUE((std::ranges::RandomAccessRange<TypeParam>));
+    EXPECT_TRUE((std::ranges::RandomAccessRange<TypeParam const>));
+
+    EXPECT_FALSE((std::ranges::enable_view<TypeParam>));
+    EXPECT_FALSE((std::ranges::enable_view<TypeParam &>));
+    EXPECT_FALSE((ranges::enable_view<TypeParam>));
+    EXPECT_FALSE((ranges::enable_view<TypeParam &>));
+
+    EXPECT_FALSE((std::ranges::View<TypeParam>));
+}
+
+TYPED_TEST(gap_decorator_rank_select_f, construction_general)
+{
+    // default
+    {
+        [[maybe_unused]] TypeParam dec{};
+    }
+
+    // copy
+    {
+        [[maybe_unused]] TypeParam dec{};
+        [[maybe_unused]] TypeParam dec2(dec);
+    }
+
+    // move
+    {
+        [[maybe_unused]] TypeParam dec{};
+        [[maybe_unused]] TypeParam dec2(std::move(dec));
+    }
+
+    // copy assignment
+    {
+        [[maybe_unused]] TypeParam dec{};
+        [[maybe_unused]] TypeParam dec2;
+        dec2 = dec;
+    }
+
+    // move assignment
+    {
+        [[maybe_unused]] TypeParam dec{};
+        [[maybe_unused]] TypeParam dec2;
+        dec2 = std::move(dec);
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// general test with automatic type deduction
+// ---------------------------------------------------------------------------------------------------------------------
+
+TEST(gap_decorator_rank_select, construction_from_ungapped_sequence)
+{
+    std::vector<dna4> v{"ACTG"_dna4};
+    std::vector<dna4> const v_const{"ACTG"_dna4};
+
+    // non-const version
+    gap_decorator_rank_select dec{v};
+    EXPECT_EQ('A'_dna4, dec[0]);
+    EXPECT_EQ('C'_dna4, dec[1]);
+
+    // const version
+    gap_decorator_rank_select const dec2(v_const);
+    EXPECT_EQ('A'_dna4, dec2[0]);
+    EXPECT_EQ('C'_dna4, dec2[1]);
+}
+
+TEST(gap_decorator_rank_select, bulk_construction_from_gap_pattern)
+{
+    std::vector<dna4> const v{"ACTG"_dna4};
+
+    // pattern for -AC--TG-
+    std::vector<bool> const pattern{true, false, false, true, true, false, false, true};
+
+    gap_decorator_rank_select dec{v, pattern};
+    EXPECT_EQ(dec.size(), 8u);
+    EXPECT_EQ(dec[0], gap{});
+    EXPECT_EQ(dec[1], 'A'_dna4);
+    EXPECT_EQ(dec[2], 'C'_dna4);
+    EXPECT_EQ(dec[3], gap{});
+    EXPECT_EQ(dec[4], gap{});
+    EXPECT_EQ(dec[5], 'T'_dna4);
+    EXPECT_EQ(dec[6], 'G'_dna4);
+    EXPECT_EQ(dec[7], gap{});
+
+    // bulk construction is equivalent to the corresponding insert_gap calls
+    gap_decorator_rank_select dec2{v};
+    insert_gap(dec2, std::next(dec2.begin(), 2), 2);
+    insert_gap(dec2, dec2.end());
+    insert_gap(dec2, dec2.begin());
+    EXPECT_EQ(dec, dec2);
+}
+
+TEST(gap_decorator_rank_select, insert_gaps)
+{
+    std::vector<dna4> const v{"ACTG"_dna4};
+
+    // bulk insertion into a gap-free decorator equals the corresponding insert_gap calls
+    gap_decorator_rank_select dec{v};
+    std::vector<std::pair<size_t, size_t>> const gap_runs{{0, 1}, {3, 2}, {7, 1}}; // -AC--TG-
+    insert_gaps(dec, gap_runs);
+
+    gap_decorator_rank_select dec2{v};
+    insert_gap(dec2, std::next(dec2.begin(), 2), 2);
+    insert_gap(dec2, dec2.end());
+    insert_gap(dec2, dec2.begin());
+
+    EXPECT_EQ(dec.size(), 8u);
+    EXPECT_EQ(dec, dec2);
+
+    // bulk insertion into a decorator that already contains gaps
+    insert_gaps(dec, std::vector<std::pair<size_t, size_t>>{{8, 1}}); // -AC--TG--
+    EXPECT_EQ(dec.size(), 9u);
+    EXPECT_EQ(dec[8], gap{});
+}
+
+TEST(gap_decorator_rank_select, random_access)
+{
+    std::vector<dna4> const v{"ACTGACTG"_dna4};
+    gap_decorator_rank_select dec{v};
+
+    std::vector<gapped<dna4>> expected{v.size()};
+    std::copy(v.begin(), v.end(), expected.begin());
+    insert_gap(dec, std::next(dec.begin(), 5), 4);
+    insert_gap(dec, std::next(dec.begin(), 2));
+    insert_gap(dec, dec.end(), 3);
+    insert_gap(dec, dec.begin(), 5);
+    insert_gap(expected, std::next(expected.begin(), 5), 4);
+    insert_gap(expected, std::next(expected.begin(), 2));
+    insert_gap(expected, expected.end(), 3);
+    insert_gap(expected, expected.begin(), 5);
+
+    EXPECT_EQ(dec.size(), expected.size());
+
+    for (size_t i = 0; i < dec.size(); ++i)
+        EXPECT_EQ(dec[i], expected[i]);
+
+    // the iterator is random access, e.g. jumping is constant and operator[] is provided
+    auto it = dec.begin();
+    EXPECT_EQ(it[5], expected[5]);
+    it += 7;
+    EXPECT_EQ(*it, expected[7]);
+    EXPECT_EQ(*(it - 2), expected[5]);
+    EXPECT_EQ(dec.end() - dec.begin(), static_cast<decltype(dec.end() - dec.begin())>(dec.size()));
+}
+
+TEST(gap_decorator_rank_select, erase_gap)
+{
+    std::vector<dna4> const v{"ACTG"_dna4};
+    gap_decorator_rank_select dec{v};
+
+    insert_gap(dec, std::next(dec.begin(), 1), 3); // A---CTG
+    auto it = erase_gap(dec, std::next(dec.begin(), 1), std::next(dec.begin(), 3)); // A-CTG
+
+    EXPECT_EQ(dec.size(), 5u);
+    EXPECT_EQ(*it, gap{});
+    EXPECT_EQ(dec[2], 'C'_dna4);
+
+    erase_gap(dec, std::next(dec.begin(), 1)); // ACTG
+    EXPECT_EQ(dec.size(), 4u);
+    EXPECT_EQ(dec[1], 'C'_dna4);
+
+    // erasing a non-gap position throws
+    EXPECT_THROW(erase_gap(dec, dec.begin()), gap_erase_failure);
+}
+
+TEST(gap_decorator_rank_select, comparison)
+{
+    std::vector<dna4> const v{"ACTG"_dna4};
+
+    gap_decorator_rank_select dec{v};
+    gap_decorator_rank_select dec2{v};
+
+    EXPECT_EQ(dec, dec2);
+    EXPECT_LE(dec, dec2);
+    EXPECT_GE(dec, dec2);
+
+    insert_gap(dec, dec.end(), 2);
+
+    EXPECT_NE(dec, dec2);
+    EXPECT_LT(dec2, dec); // dec2 is prefix of dec
+    EXPECT_LE(dec2, dec); // dec2 is prefix of dec
+    EXPECT_GT(dec, dec2); // dec2 is prefix of dec
+    EXPECT_GE(dec, dec2); // dec2 is prefix of dec
+
+    insert_gap(dec2, dec2.end(), 2);
+    insert_gap(dec2, dec2.begin(), 1);
+
+    EXPECT_NE(dec, dec2); // ACTG-- vs -ACTG--
+    EXPECT_LT(dec2, dec);
+    EXPECT_GT(dec, dec2);
+}
@@ -0,0 +1,106 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/all.hpp>
+#include <seqan3/range/concept.hpp>
+#include <seqan3/range/detail/elementwise_transform.hpp>
+#include <seqan3/range/view/char_to.hpp>
+#include <seqan3/range/view/complement.hpp>
+#include <seqan3/range/view/to_char.hpp>
+#include <seqan3/std/ranges>
+
+using namespace seqan3;
+
+TEST(elementwise_transform, basic)
+{
+    std::vector<int> vec{1, 2, 3, 4, 5};
+
+    auto adaptor = detail::elementwise_transform([] (int const i) { return i + 10; });
+    auto v = adaptor(vec);
+
+    EXPECT_TRUE((detail::is_elementwise_transform_view_v<decltype(v)>));
+    EXPECT_EQ(v.size(), vec.size());
+
+    std::vector<int> out{std::ranges::begin(v), std::ranges::end(v)};
+    EXPECT_EQ(out, (std::vector<int>{11, 12, 13, 14, 15}));
+}
+
+TEST(elementwise_transform, concepts)
+{
+    std::vector<int> vec{1, 2, 3};
+    auto v = detail::elementwise_transform([] (int const i) { return i + 1; })(vec);
+
+    EXPECT_TRUE(std::ranges::InputRange<decltype(v)>);
+    EXPECT_TRUE(std::ranges::ForwardRange<decltype(v)>);
+    EXPECT_TRUE(std::ranges::BidirectionalRange<decltype(v)>);
+    EXPECT_TRUE(std::ranges::RandomAccessRange<decltype(v)>);
+    EXPECT_FALSE(std::ranges::ContiguousRange<decltype(v)>);
+    EXPECT_TRUE(std::ranges::View<decltype(v)>);
+    EXPECT_TRUE(std::ranges::SizedRange<decltype(v)>);
+    EXPECT_TRUE(std::ranges::CommonRange<decltype(v)>);
+    EXPECT_TRUE(const_iterable_concept<decltype(v)>);
+    EXPECT_TRUE((std::Same<reference_t<decltype(v)>, int>));
+}
+
+TEST(elementwise_transform, fusion)
+{
+    std::vector<int> vec{1, 2, 3, 4, 5};
+
+    auto v1 = detail::elementwise_transform([] (int const i) { return i + 10; })(vec);
+    auto v2 = detail::elementwise_transform([] (int const i) { return i * 3; })(v1);
+    auto v3 = detail::elementwise_transform([] (int const i) { return -i; })(v2);
+
+    // stacking produced a single fused node each time, not a tower
+    EXPECT_TRUE((detail::is_elementwise_transform_view_v<decltype(v3)>));
+    EXPECT_TRUE((std::Same<decltype(v1.underlying_range()), decltype(v3.underlying_range())>));
+
+    std::vector<int> out{std::ranges::begin(v3), std::ranges::end(v3)};
+    EXPECT_EQ(out, (std::vector<int>{-33, -36, -39, -42, -45}));
+
+    // const iteration of the fused view
+    auto const & v3c = v3;
+    EXPECT_EQ(*std::ranges::begin(v3c), -33);
+}
+
+TEST(elementwise_transform, fusion_through_views)
+{
+    std::string const s{"ACGNTA"};
+
+    // two adjacent elementwise views collapse into one fused transformation node
+    auto v = s | view::char_to<dna5> | view::complement;
+    EXPECT_TRUE((detail::is_elementwise_transform_view_v<std::remove_const_t<decltype(v)>>));
+
+    dna5_vector out = v;
+    EXPECT_EQ(out, "TGCNAT"_dna5);
+
+    // three in a row still yield a single node over the original string
+    auto v2 = s | view::char_to<dna5> | view::complement | view::to_char;
+    EXPECT_TRUE((detail::is_elementwise_transform_view_v<std::remove_const_t<decltype(v2)>>));
+    EXPECT_TRUE((std::Same<decltype(v.underlying_range()), decltype(v2.underlying_range())>));
+
+    std::string out2{std::ranges::begin(v2), std::ranges::end(v2)};
+    EXPECT_EQ(out2, "TGCNAT");
+}
+
+TEST(elementwise_transform, deep)
+{
+    std::vector<dna5_vector> vec{"ACGTA"_dna5, "TGCAT"_dna5};
+
+    // fusion also applies to the innermost ranges of deep views
+    auto v = vec | view::complement | view::to_char;
+
+    auto inner = v[0];
+    EXPECT_TRUE((detail::is_elementwise_transform_view_v<decltype(inner)>));
+
+    std::string out0{std::ranges::begin(inner), std::ranges::end(inner)};
+    EXPECT_EQ(out0, "TGCAT");
+}
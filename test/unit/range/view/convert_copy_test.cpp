@@ -0,0 +1,165 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <deque>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/alphabet/nucleotide/dna15.hpp>
+#include <seqan3/alphabet/quality/phred42.hpp>
+#include <seqan3/range/view/char_to.hpp>
+#include <seqan3/range/view/convert.hpp>
+#include <seqan3/range/view/convert_copy.hpp>
+#include <seqan3/range/view/rank_to.hpp>
+#include <seqan3/range/view/to_char.hpp>
+#include <seqan3/range/view/to_rank.hpp>
+#include <seqan3/std/ranges>
+
+using namespace seqan3;
+
+TEST(convert_copy, char_to)
+{
+    // long enough to exercise whole chunks plus a tail; contains invalid and lower-case characters
+    std::string vec{"ACTTTGATANnacgtACGTACGTACGTACGTxy!?uUACTTTGATA"};
+
+    std::vector<dna5> v(vec.size());
+    convert_copy(vec, v);
+    EXPECT_TRUE(std::ranges::equal(v, vec | view::char_to<dna5>));
+
+    std::vector<dna4> v2(vec.size());
+    convert_copy(vec, v2);
+    EXPECT_TRUE(std::ranges::equal(v2, vec | view::char_to<dna4>));
+}
+
+TEST(convert_copy, all_characters)
+{
+    // the chunked kernel must agree with assign_char for every possible input character
+    std::string vec(256, '\0');
+    for (size_t i = 0; i < vec.size(); ++i)
+        vec[i] = static_cast<char>(i);
+
+    std::vector<dna5> v(vec.size());
+    convert_copy(vec, v);
+    EXPECT_TRUE(std::ranges::equal(v, vec | view::char_to<dna5>));
+}
+
+TEST(convert_copy, to_char)
+{
+    dna5_vector vec{"ACTTTGATANNACGTACGTACGTACGTACGTGATA"_dna5};
+
+    std::string s(vec.size(), '\0');
+    convert_copy(vec, s);
+    EXPECT_EQ(s, std::string{"ACTTTGATANNACGTACGTACGTACGTACGTGATA"});
+}
+
+TEST(convert_copy, to_rank_and_rank_to)
+{
+    dna4_vector vec{"ACTTTGATAACGTACGTACGTACGTACGTGATA"_dna4};
+
+    std::vector<uint8_t> ranks(vec.size());
+    convert_copy(vec, ranks);
+    EXPECT_TRUE(std::ranges::equal(ranks, vec | view::to_rank));
+
+    dna4_vector back(ranks.size());
+    convert_copy(ranks, back);
+    EXPECT_EQ(back, vec);
+}
+
+TEST(convert_copy, large_alphabet)
+{
+    // aa27 has more deviating table entries than the chunked kernel handles -> table fallback
+    std::string vec{"FRIEDRICHSHAINQWERTZUIOPASDFGHJKLYXCVBNMfriedrichshain*!"};
+
+    std::vector<aa27> v(vec.size());
+    convert_copy(vec, v);
+    EXPECT_TRUE(std::ranges::equal(v, vec | view::char_to<aa27>));
+}
+
+TEST(convert_copy, non_contiguous)
+{
+    // deque is not contiguous, so the element-wise fallback is used
+    std::string vec{"ACTTTGATAN"};
+    std::deque<char> source{vec.begin(), vec.end()};
+
+    std::vector<dna5> v(source.size());
+    convert_copy(source, v);
+    EXPECT_TRUE(std::ranges::equal(v, vec | view::char_to<dna5>));
+}
+
+TEST(convert_copy, empty)
+{
+    std::string vec{};
+    std::vector<dna4> v{};
+    convert_copy(vec, v);
+    EXPECT_TRUE(v.empty());
+}
+
+TEST(convert_copy, alphabet_to_alphabet)
+{
+    using namespace seqan3::view;
+
+    // dna5 -> dna4: 'N' converts to 'A', like the converting constructor does
+    dna5_vector source = "ACGTNNACGTN"_dna5;
+
+    dna4_vector target(source.size());
+    convert_copy(source, target);
+    EXPECT_TRUE(std::ranges::equal(target, source | convert<dna4>));
+    EXPECT_EQ(target, "ACGTAAACGTA"_dna4);
+
+    // dna15 -> dna5: every value must match the per-element conversion
+    dna15_vector wide(alphabet_size_v<dna15>);
+    for (size_t rank = 0; rank < alphabet_size_v<dna15>; ++rank)
+        wide[rank] = assign_rank(dna15{}, rank);
+
+    dna5_vector narrow(wide.size());
+    convert_copy(wide, narrow);
+    EXPECT_TRUE(std::ranges::equal(narrow, wide | convert<dna5>));
+}
+
+TEST(convert_copy, alphabet_to_alphabet_non_contiguous)
+{
+    dna5_vector vec = "ACGTNNACGTN"_dna5;
+    std::deque<dna5> source{vec.begin(), vec.end()};
+
+    dna4_vector target(source.size());
+    convert_copy(source, target);
+    EXPECT_TRUE(std::ranges::equal(target, vec | view::convert<dna4>));
+}
+
+TEST(convert_copy, rank_conversion_table)
+{
+    // the table is a constant expression and matches the converting constructor
+    constexpr auto table = detail::rank_conversion_table<dna5, dna4>;
+    static_assert(table.size() == alphabet_size_v<dna5>);
+
+    for (size_t rank = 0; rank < alphabet_size_v<dna5>; ++rank)
+        EXPECT_EQ(table[rank], to_rank(static_cast<dna4>(assign_rank(dna5{}, rank))));
+}
+
+TEST(convert_copy, quality_decode)
+{
+    // the phred char-to-rank table is a saturating affine map and takes the vectorised decode path;
+    // every possible character must decode exactly like the per-element view
+    std::string source(256, '\0');
+    for (size_t i = 0; i < source.size(); ++i)
+        source[i] = static_cast<char>(i);
+
+    std::vector<phred42> target(source.size());
+    convert_copy(source, target);
+    EXPECT_TRUE(std::ranges::equal(target, source | view::char_to<phred42>));
+
+    // spot check the offset arithmetic incl. clamping of out-of-range characters
+    EXPECT_EQ(target['!'].to_phred(), 0);
+    EXPECT_EQ(target['I'].to_phred(), 40);
+    EXPECT_EQ(target[' '].to_phred(), 0);
+    EXPECT_EQ(target['~'].to_phred(), 41);
+}
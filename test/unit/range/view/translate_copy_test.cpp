@@ -0,0 +1,79 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/all.hpp>
+#include <seqan3/range/view/char_to.hpp>
+#include <seqan3/range/view/translate_copy.hpp>
+
+using namespace seqan3;
+
+template <typename T>
+class translate_copy_ : public ::testing::Test
+{};
+
+// dna4/rna4 take the flat-table fast path, the others the translate_triplet fallback
+using nucleotide_types = ::testing::Types<dna4, dna5, dna15, rna4, rna5, rna15>;
+
+TYPED_TEST_CASE(translate_copy_, nucleotide_types);
+
+TYPED_TEST(translate_copy_, six_frame)
+{
+    std::string const in{"ACGTACGTACGTA"};
+    std::vector<TypeParam> vec = in | view::char_to<TypeParam>;
+
+    std::vector<aa27_vector> cmp{{"TYVR"_aa27}, {"RTYV"_aa27}, {"VRT"_aa27},
+                                 {"YVRT"_aa27}, {"TYVR"_aa27}, {"RTY"_aa27}};
+
+    // same values and frame order as view::translate
+    EXPECT_EQ(translate_copy(vec), cmp);
+    EXPECT_EQ(translate_copy(vec, translation_frames::SIX_FRAME), cmp);
+}
+
+TYPED_TEST(translate_copy_, frame_selection)
+{
+    std::string const in{"ACGTACGTACGTA"};
+    std::vector<TypeParam> vec = in | view::char_to<TypeParam>;
+
+    std::vector<aa27_vector> cmp_single{{"TYVR"_aa27}};
+    std::vector<aa27_vector> cmp_rev{{"YVRT"_aa27}, {"TYVR"_aa27}, {"RTY"_aa27}};
+    std::vector<aa27_vector> cmp_mixed{{"RTYV"_aa27}, {"RTY"_aa27}};
+
+    EXPECT_EQ(translate_copy(vec, translation_frames::FWD_FRAME_0), cmp_single);
+    EXPECT_EQ(translate_copy(vec, translation_frames::REV), cmp_rev);
+    EXPECT_EQ(translate_copy(vec, translation_frames::FWD_FRAME_1 | translation_frames::REV_FRAME_2), cmp_mixed);
+}
+
+TYPED_TEST(translate_copy_, short_input)
+{
+    std::vector<TypeParam> empty{};
+    std::vector<aa27_vector> res = translate_copy(empty);
+    ASSERT_EQ(res.size(), 6u);
+    for (auto const & frame : res)
+        EXPECT_TRUE(frame.empty());
+
+    std::vector<TypeParam> two = std::string{"AC"} | view::char_to<TypeParam>;
+    res = translate_copy(two);
+    ASSERT_EQ(res.size(), 6u);
+    for (auto const & frame : res)
+        EXPECT_TRUE(frame.empty());
+
+    std::vector<TypeParam> four = std::string{"ACGT"} | view::char_to<TypeParam>;
+    res = translate_copy(four);
+    ASSERT_EQ(res.size(), 6u);
+    EXPECT_EQ(res[0], "T"_aa27);  // ACG
+    EXPECT_EQ(res[1], "R"_aa27);  // CGT
+    EXPECT_TRUE(res[2].empty());
+    EXPECT_EQ(res[3], "T"_aa27);  // ACG on the reverse complement (ACGT)
+    EXPECT_EQ(res[4], "R"_aa27);  // CGT on the reverse complement
+    EXPECT_TRUE(res[5].empty());
+}
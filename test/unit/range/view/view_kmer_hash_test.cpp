@@ -8,6 +8,7 @@
 #include <type_traits>
 
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
 #include <seqan3/range/container/bitcompressed_vector.hpp>
 #include <seqan3/range/view/kmer_hash.hpp>
 
@@ -70,3 +71,51 @@ TEST(kmer_hash, const_view)
         EXPECT_EQ(expected, hashes);
     }
 }
+
+TEST(kmer_hash, rolling_consistency)
+{
+    // repeated windows must produce identical hashes
+    std::vector<dna4> text{"ACGTACGTACGT"_dna4};
+    std::vector<size_t> hashes = text | view::kmer_hash(4);
+    ASSERT_EQ(hashes.size(), 9u);
+    EXPECT_EQ(hashes[0], hashes[4]);
+    EXPECT_EQ(hashes[0], hashes[8]);
+    EXPECT_NE(hashes[0], hashes[1]);
+}
+
+TEST(kmer_hash, canonical)
+{
+    {
+        // forward hashes are {6,27,44,50,9}, reverse complement hashes are {27,6,49,28,39}
+        std::vector<dna4> text{"ACGTAGC"_dna4};
+        std::vector<size_t> hashes = text | view::kmer_hash(3, true);
+        std::vector<size_t> expected{6,6,44,28,9};
+        EXPECT_EQ(expected, hashes);
+    }
+    {
+        // odd alphabet size takes the division based rolling update
+        std::vector<dna5> text{"ACGTN"_dna5};
+        std::vector<size_t> hashes = text | view::kmer_hash(3, true);
+        std::vector<size_t> expected{7,7,73};
+        EXPECT_EQ(expected, hashes);
+    }
+    {
+        // a k-mer and its reverse complement hash to the same value
+        std::vector<dna4> fwd{"ACGTAGC"_dna4};
+        std::vector<dna4> rc{"GCTACGT"_dna4};
+        std::vector<size_t> fwd_hashes = fwd | view::kmer_hash(7, true);
+        std::vector<size_t> rc_hashes  = rc  | view::kmer_hash(7, true);
+        EXPECT_EQ(fwd_hashes, rc_hashes);
+    }
+}
+
+TEST(kmer_hash, invalid_arguments)
+{
+    std::vector<dna4> text{"ACGTAGC"_dna4};
+
+    EXPECT_THROW((text | view::kmer_hash(0)), std::invalid_argument);
+    // 33 * 2 bit > 64 bit, not exactly representable for the canonical computation
+    EXPECT_THROW((text | view::kmer_hash(33, true)), std::invalid_argument);
+    // but fine without the canonical option
+    EXPECT_NO_THROW((text | view::kmer_hash(33)));
+}
@@ -0,0 +1,103 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <seqan3/range/concept.hpp>
+#include <seqan3/range/view/materialise.hpp>
+#include <seqan3/range/view/single_pass_input.hpp>
+#include <seqan3/std/concepts>
+#include <seqan3/std/ranges>
+
+using namespace seqan3;
+
+TEST(view_materialise, basic)
+{
+    std::string vec{"foobar"};
+
+    // pipe notation
+    auto v = vec | view::materialise;
+    EXPECT_EQ("foobar", std::string{v});
+
+    // function notation
+    std::string v2 = view::materialise(vec);
+    EXPECT_EQ("foobar", v2);
+
+    // temporaries can be bound directly (elements are copied anyway)
+    auto v3 = std::string{"foobar"} | view::materialise;
+    EXPECT_EQ("foobar", std::string{v3});
+
+    // random access and size on the materialised copy
+    EXPECT_EQ(v.size(), 6u);
+    EXPECT_EQ(v[3], 'b');
+    EXPECT_EQ(*v.data(), 'f');
+}
+
+TEST(view_materialise, single_pass_input)
+{
+    std::istringstream stream{"foobar"};
+    auto sp = view::single_pass_input(stream);
+
+    // the input is single-pass, the materialised copy can be traversed repeatedly
+    auto v = sp | view::materialise;
+    EXPECT_EQ(v.size(), 6u);
+    EXPECT_EQ("foobar", std::string{v});
+    EXPECT_EQ("foobar", std::string{v}); // second pass
+}
+
+TEST(view_materialise, eager)
+{
+    std::string vec{"foo"};
+    auto v = vec | view::materialise;
+
+    // the copy was taken on construction; later changes to the source are not reflected
+    vec[0] = 'z';
+    EXPECT_EQ("foo", std::string{v});
+
+    // the copy itself is writable
+    v[0] = 'b';
+    EXPECT_EQ("boo", std::string{v});
+    EXPECT_EQ("zoo", vec);
+}
+
+TEST(view_materialise, buffer_reuse)
+{
+    std::string vec{"foobarbax"};
+    char const * data = nullptr;
+
+    {
+        auto v = vec | view::materialise;
+        data = v.data();
+    } // v destroyed, its buffer returns to the pool
+
+    // the next materialisation on this thread reuses the recycled buffer
+    auto v2 = vec | view::materialise;
+    EXPECT_EQ(v2.data(), data);
+    EXPECT_EQ("foobarbax", std::string{v2});
+}
+
+TEST(view_materialise, concepts)
+{
+    std::istringstream stream{"foobar"};
+    auto sp = view::single_pass_input(stream);
+    auto v1 = sp | view::materialise;
+
+    EXPECT_TRUE(std::ranges::InputRange<decltype(v1)>);
+    EXPECT_TRUE(std::ranges::ForwardRange<decltype(v1)>);
+    EXPECT_TRUE(std::ranges::BidirectionalRange<decltype(v1)>);
+    EXPECT_TRUE(std::ranges::RandomAccessRange<decltype(v1)>);
+    EXPECT_TRUE(std::ranges::ContiguousRange<decltype(v1)>);
+    EXPECT_TRUE(std::ranges::View<decltype(v1)>);
+    EXPECT_TRUE(std::ranges::SizedRange<decltype(v1)>);
+    EXPECT_TRUE(std::ranges::CommonRange<decltype(v1)>);
+    EXPECT_TRUE(const_iterable_concept<decltype(v1)>);
+    EXPECT_TRUE((std::ranges::OutputRange<decltype(v1), char>));
+    EXPECT_TRUE((std::Same<reference_t<decltype(v1)>, char &>));
+}
@@ -0,0 +1,84 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <numeric>
+#include <type_traits>
+#include <utility>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/view/kmer_hash.hpp>
+#include <seqan3/range/view/minimiser.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace seqan3;
+
+using pos_value_t = std::pair<size_t, size_t>;
+
+TEST(minimiser, view)
+{
+    {
+        std::vector<size_t> hashes{6, 27, 44, 50, 9};
+        std::vector<pos_value_t> minimisers = hashes | view::minimiser(3);
+        std::vector<pos_value_t> expected{{0, 6}, {1, 27}, {4, 9}};
+        EXPECT_EQ(expected, minimisers);
+    }
+    {
+        // on ties the leftmost minimum is reported
+        std::vector<size_t> hashes{5, 3, 3, 7};
+        std::vector<pos_value_t> minimisers = hashes | view::minimiser(2);
+        std::vector<pos_value_t> expected{{1, 3}, {1, 3}, {2, 3}};
+        EXPECT_EQ(expected, minimisers);
+    }
+    {
+        // window of size 1 reports every value
+        std::vector<size_t> hashes{4, 2, 9};
+        std::vector<pos_value_t> minimisers = hashes | view::minimiser(1);
+        std::vector<pos_value_t> expected{{0, 4}, {1, 2}, {2, 9}};
+        EXPECT_EQ(expected, minimisers);
+    }
+    {
+        // fewer values than the window size yields an empty range
+        std::vector<size_t> hashes{4, 2};
+        std::vector<pos_value_t> minimisers = hashes | view::minimiser(3);
+        std::vector<pos_value_t> expected{};
+        EXPECT_EQ(expected, minimisers);
+    }
+}
+
+TEST(minimiser, const_view)
+{
+    std::vector<size_t> const hashes{6, 27, 44, 50, 9};
+    std::vector<pos_value_t> minimisers = hashes | view::minimiser(3);
+    std::vector<pos_value_t> expected{{0, 6}, {1, 27}, {4, 9}};
+    EXPECT_EQ(expected, minimisers);
+}
+
+TEST(minimiser, combined_with_kmer_hash)
+{
+    std::vector<dna4> text{"ACGTAGC"_dna4};
+    std::vector<pos_value_t> minimisers = text | view::kmer_hash(3) | view::minimiser(3);
+    std::vector<pos_value_t> expected{{0, 6}, {1, 27}, {4, 9}};
+    EXPECT_EQ(expected, minimisers);
+}
+
+TEST(minimiser, monotonically_increasing)
+{
+    // fills the monotonic deque completely in every window
+    std::vector<size_t> hashes(20);
+    std::iota(hashes.begin(), hashes.end(), 0u);
+    std::vector<pos_value_t> minimisers = hashes | view::minimiser(5);
+    ASSERT_EQ(minimisers.size(), 16u);
+    for (size_t i = 0; i < minimisers.size(); ++i)
+        EXPECT_EQ(minimisers[i], (pos_value_t{i, i}));
+}
+
+TEST(minimiser, invalid_arguments)
+{
+    std::vector<size_t> hashes{6, 27, 44};
+    EXPECT_THROW((hashes | view::minimiser(0)), std::invalid_argument);
+}
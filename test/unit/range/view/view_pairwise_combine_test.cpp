@@ -9,6 +9,7 @@
 
 #include <forward_list>
 #include <list>
+#include <set>
 #include <utility>
 #include <vector>
 
@@ -498,3 +499,41 @@ TEST(pairwise_combine_fn_test, const_source)
     EXPECT_EQ(*++it, (std::tuple{'b', 'd'}));
     EXPECT_EQ(*++it, (std::tuple{'c', 'd'}));
 }
+
+TEST(pairwise_combine_fn_test, tiles)
+{
+    std::vector<char> orig{'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k'};
+    auto v = orig | seqan3::view::pairwise_combine;
+
+    for (size_t tile_extent : {1u, 2u, 3u, 4u, 11u, 20u})
+    {
+        std::set<std::pair<size_t, size_t>> seen{};
+        size_t total = 0;
+
+        for (size_t tile_index = 0; tile_index < v.tile_count(tile_extent); ++tile_index)
+        {
+            auto tile = v.tile(tile_index, tile_extent);
+            size_t count = 0;
+
+            tile.for_each([&] (size_t const first, size_t const second)
+            {
+                EXPECT_LT(first, second);
+                EXPECT_LT(second, orig.size());
+                EXPECT_TRUE(seen.emplace(first, second).second); // every pair occurs exactly once
+                ++count;
+            });
+
+            EXPECT_EQ(count, tile.size());
+            total += count;
+        }
+
+        EXPECT_EQ(total, v.size()); // all combinations covered
+    }
+}
+
+TEST(pairwise_combine_fn_test, tiles_empty_range)
+{
+    std::vector<char> orig{};
+    auto v = orig | seqan3::view::pairwise_combine;
+    EXPECT_EQ(v.tile_count(4u), 0u);
+}
@@ -0,0 +1,113 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <deque>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/range/view/complement.hpp>
+#include <seqan3/range/view/reverse_complement.hpp>
+#include <seqan3/std/ranges>
+
+using namespace seqan3;
+
+TEST(view_reverse_complement, basic)
+{
+    dna5_vector foo{"ACGTA"_dna5};
+    dna5_vector cmp{"TACGT"_dna5};
+
+    // pipe notation
+    dna5_vector v = foo | view::reverse_complement;
+    EXPECT_EQ(cmp, v);
+
+    // function notation
+    dna5_vector v2(view::reverse_complement(foo));
+    EXPECT_EQ(cmp, v2);
+
+    // identical to the unfused composition
+    EXPECT_TRUE(std::ranges::equal(foo | view::reverse_complement,
+                                   foo | view::complement | std::view::reverse));
+}
+
+TEST(view_reverse_complement, deep_view)
+{
+    std::vector<dna5_vector> foo{"ACGTA"_dna5, "TGCAT"_dna5};
+
+    std::vector<dna5_vector> v = foo | view::reverse_complement;
+
+    ASSERT_EQ(size(v), 2u);
+    EXPECT_TRUE(std::ranges::equal(v[0], "TACGT"_dna5));
+    EXPECT_TRUE(std::ranges::equal(v[1], "ATGCA"_dna5));
+}
+
+TEST(reverse_complement_copy, contiguous)
+{
+    // long enough to exercise whole chunks plus a tail
+    dna5_vector vec{"ACGTANNACGTACGTACGTACGTACGTACGTACGTAN"_dna5};
+
+    dna5_vector v(vec.size());
+    reverse_complement_copy(vec, v);
+    EXPECT_TRUE(std::ranges::equal(v, vec | view::reverse_complement));
+
+    dna4_vector vec2{"ACGTAACGTACGTACGTACGTACGTACGTACGTA"_dna4};
+    dna4_vector v2(vec2.size());
+    reverse_complement_copy(vec2, v2);
+    EXPECT_TRUE(std::ranges::equal(v2, vec2 | view::reverse_complement));
+}
+
+TEST(reverse_complement_copy, non_contiguous)
+{
+    dna5_vector vec{"ACGTANGATA"_dna5};
+    std::deque<dna5> source{vec.begin(), vec.end()};
+
+    dna5_vector v(source.size());
+    reverse_complement_copy(source, v);
+    EXPECT_TRUE(std::ranges::equal(v, vec | view::reverse_complement));
+}
+
+TEST(reverse_complement_copy, empty)
+{
+    dna5_vector vec{};
+    dna5_vector v{};
+    reverse_complement_copy(vec, v);
+    EXPECT_TRUE(v.empty());
+}
+
+TEST(complement_inplace, contiguous)
+{
+    // long enough to exercise whole chunks plus a tail
+    dna5_vector vec{"ACGTANNACGTACGTACGTACGTACGTACGTACGTAN"_dna5};
+    dna5_vector cmp = vec | view::complement;
+
+    complement_inplace(vec);
+    EXPECT_EQ(vec, cmp);
+
+    dna4_vector vec2{"ACGTAACGTACGTACGTACGTACGTACGTACGTA"_dna4};
+    dna4_vector cmp2 = vec2 | view::complement;
+
+    complement_inplace(vec2);
+    EXPECT_EQ(vec2, cmp2);
+}
+
+TEST(complement_inplace, non_contiguous)
+{
+    dna5_vector vec{"ACGTANGATA"_dna5};
+    std::deque<dna5> d{vec.begin(), vec.end()};
+
+    complement_inplace(d);
+    EXPECT_TRUE(std::ranges::equal(d, vec | view::complement));
+}
+
+TEST(complement_inplace, empty)
+{
+    dna5_vector vec{};
+    complement_inplace(vec);
+    EXPECT_TRUE(vec.empty());
+}
@@ -7,8 +7,9 @@
 
 #include <gtest/gtest.h>
 
-#include <vector>
+#include <string>
 #include <type_traits>
+#include <vector>
 
 #include <range/v3/view/slice.hpp>
 
@@ -355,3 +356,30 @@ TYPED_TEST(single_pass_input, fn_pipeable)
     ++it;
     EXPECT_TRUE(view.end() == it);
 }
+
+TEST(single_pass_input_chunk, contiguous_underlying_range)
+{
+    std::string data{"1234567890"};
+    auto view = data | view::single_pass_input;
+
+    // the chunk covers the not-yet-consumed part of the underlying range
+    auto chunk = view.chunk();
+    ASSERT_EQ(chunk.size(), data.size());
+    EXPECT_EQ(std::string(chunk.begin(), chunk.end()), data);
+
+    // element-wise consumption shrinks the chunk
+    auto it = view.begin();
+    ++it;
+    ++it;
+    chunk = view.chunk();
+    ASSERT_EQ(chunk.size(), 8u);
+    EXPECT_EQ(chunk[0], '3');
+
+    // chunk-wise consumption moves the view's iterator
+    view.chunk_advance(3u);
+    EXPECT_EQ(*view.begin(), '6');
+
+    view.chunk_advance(5u);
+    EXPECT_EQ(view.chunk().size(), 0u);
+    EXPECT_TRUE(view.begin() == view.end());
+}
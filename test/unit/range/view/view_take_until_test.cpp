@@ -12,6 +12,7 @@
 #include <range/v3/algorithm/copy.hpp>
 #include <range/v3/view/unique.hpp>
 
+#include <seqan3/io/stream/parse_condition.hpp>
 #include <seqan3/range/view/take_until.hpp>
 #include <seqan3/range/view/single_pass_input.hpp>
 #include <seqan3/range/view/to_char.hpp>
@@ -127,3 +128,40 @@ TEST(view_take_until_or_throw, concepts)
 {
     do_concepts(view::take_until_or_throw([] (char c) { return c == '\n'; }), true);
 }
+
+// ============================================================================
+//  bulk scan on contiguous ranges
+// ============================================================================
+
+TEST(view_take_until, parse_condition_eager)
+{
+    std::string vec{"foo\nbar"};
+
+    // single-character conditions reduce to std::memchr
+    auto v = vec | view::take_until(is_char<'\n'>);
+    EXPECT_EQ("foo", std::string(v));
+    EXPECT_TRUE(std::ranges::SizedRange<decltype(v)>); // the delimiter was located eagerly
+    EXPECT_TRUE(std::ranges::CommonRange<decltype(v)>);
+
+    // conditions matching multiple characters go through the look-up tables
+    std::string vec2{"foo bar"};
+    EXPECT_EQ("foo", std::string(vec2 | view::take_until(is_space)));
+
+    // no delimiter -> whole range
+    std::string vec3{"foo"};
+    EXPECT_EQ("foo", std::string(vec3 | view::take_until(is_char<'\n'>)));
+
+    // non-contiguous ranges keep the lazy view, also with parse conditions
+    auto v4 = vec | view::single_pass_input | view::take_until(is_char<'\n'>);
+    EXPECT_EQ("foo", std::string(v4));
+    EXPECT_FALSE(std::ranges::SizedRange<decltype(v4)>);
+}
+
+TEST(view_take_until_or_throw, parse_condition_eager)
+{
+    std::string vec{"foo\nbar"};
+    EXPECT_EQ("foo", std::string(vec | view::take_until_or_throw(is_char<'\n'>)));
+
+    std::string vec2{"foo"};
+    EXPECT_THROW(vec2 | view::take_until_or_throw(is_char<'\n'>), unexpected_end_of_input);
+}
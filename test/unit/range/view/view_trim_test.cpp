@@ -84,3 +84,51 @@ TEST(view_trim, concepts)
     EXPECT_TRUE((std::ranges::OutputRange<decltype(v1), dna5q>));
     EXPECT_TRUE(!std::ranges::SizedRange<decltype(v1)>);
 }
+
+TEST(trim_eager, standalone)
+{
+    // long enough to exercise whole chunks plus a tail
+    std::vector<phred42> vec{};
+    for (size_t i = 0; i < 50; ++i)
+        vec.push_back(phred42{40});
+    vec.push_back(phred42{10});
+    vec.push_back(phred42{40});
+
+    // trim by phred_value
+    auto v1 = trim_eager(vec, 20u);
+    EXPECT_TRUE(std::ranges::equal(v1, vec | view::trim(20u)));
+    EXPECT_EQ(v1.size(), 50u);
+
+    // trim by quality character
+    auto v2 = trim_eager(vec, phred42{40});
+    EXPECT_TRUE(std::ranges::equal(v2, vec | view::trim(phred42{40})));
+
+    // the resulting subrange stays sized, random-access and contiguous
+    EXPECT_TRUE(std::ranges::SizedRange<decltype(v1)>);
+    EXPECT_TRUE(std::ranges::RandomAccessRange<decltype(v1)>);
+    EXPECT_TRUE(std::ranges::ContiguousRange<decltype(v1)>);
+}
+
+TEST(trim_eager, thresholds)
+{
+    std::vector<phred63> vec{phred63{40}, phred63{40}, phred63{30}, phred63{20}, phred63{10}};
+
+    EXPECT_EQ(trim_eager(vec, 0u).size(), vec.size());  // nothing trimmed
+    EXPECT_EQ(trim_eager(vec, 62u).size(), 0u);         // everything trimmed
+    EXPECT_EQ(trim_eager(vec, 25u).size(), 3u);
+
+    std::vector<phred63> empty{};
+    EXPECT_EQ(trim_eager(empty, 20u).size(), 0u);
+}
+
+TEST(trim_eager, qualified)
+{
+    // the rank of dna5q interleaves the nucleotide, so the byte kernel must not apply; the element-wise
+    // fallback has to produce the same prefix as the view
+    std::vector<dna5q> vec{{'A'_dna5, phred42{40}}, {'G'_dna5, phred42{40}}, {'G'_dna5, phred42{30}},
+                           {'A'_dna5, phred42{20}}, {'T'_dna5, phred42{10}}};
+
+    auto v1 = trim_eager(vec, 20u);
+    EXPECT_TRUE(std::ranges::equal(v1, vec | view::trim(20u)));
+    EXPECT_EQ(v1.size(), 4u);
+}
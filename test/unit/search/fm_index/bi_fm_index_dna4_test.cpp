@@ -5,19 +5,106 @@
 // shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
 // -----------------------------------------------------------------------------------------------------
 
+#include <fstream>
+#include <random>
+#include <sstream>
+
 #include "fm_index_test_template.hpp"
 #include "fm_index_collection_test_template.hpp"
 
 INSTANTIATE_TYPED_TEST_CASE_P(dna4, fm_index_test, bi_fm_index<std::vector<dna4>>);
 INSTANTIATE_TYPED_TEST_CASE_P(dna4_collection, fm_index_collection_test, bi_fm_index<std::vector<std::vector<dna4>>>);
 
+using bi_epr_index_t = bi_fm_index<std::vector<dna4>, bi_fm_index_epr_traits>;
+INSTANTIATE_TYPED_TEST_CASE_P(dna4_epr, fm_index_test, bi_epr_index_t);
+
+using bi_epr_collection_index_t = bi_fm_index<std::vector<std::vector<dna4>>, bi_fm_index_epr_traits>;
+INSTANTIATE_TYPED_TEST_CASE_P(dna4_collection_epr, fm_index_collection_test, bi_epr_collection_index_t);
+
 TEST(fm_index_test, additional_concepts)
 {
     EXPECT_TRUE(BiFmIndexTraits<bi_fm_index_default_traits>);
+    EXPECT_TRUE(BiFmIndexTraits<bi_fm_index_epr_traits>);
     EXPECT_TRUE(BiFmIndex<bi_fm_index<std::string>>);
+    EXPECT_TRUE(BiFmIndex<bi_epr_index_t>);
 }
 
 TEST(fm_index_collection_test, additional_concepts)
 {
     EXPECT_TRUE(BiFmIndex<bi_fm_index<std::vector<std::string>>>);
 }
+
+//!\brief Generates a pseudo random dna4 text of the given length.
+static std::vector<dna4> random_dna4_text(size_t const length, size_t const seed = 0)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<uint8_t> dis(0, 3);
+
+    std::vector<dna4> text(length);
+    for (dna4 & c : text)
+        c.assign_rank(dis(gen));
+    return text;
+}
+
+//!\brief Returns the content of the given file.
+static std::string file_bytes(std::filesystem::path const & path)
+{
+    std::ifstream stream{path, std::ios::binary};
+    std::stringstream buffer;
+    buffer << stream.rdbuf();
+    return buffer.str();
+}
+
+TEST(fm_index_test, parallel_construction)
+{
+    std::vector<dna4> const text = random_dna4_text(2000);
+
+    bi_fm_index<std::vector<dna4>> sequential{text};
+    bi_fm_index<std::vector<dna4>> parallel{text, 4};
+
+    // The concurrent construction of both underlying indices must produce bit-identical indices.
+    EXPECT_EQ(sequential.size(), parallel.size());
+
+    test::tmp_filename sequential_filename{"bi_fm_index"}, parallel_filename{"bi_fm_index"};
+    ASSERT_TRUE(sequential.store(sequential_filename.get_path()));
+    ASSERT_TRUE(parallel.store(parallel_filename.get_path()));
+
+    for (char const * suffix : {".fwd", ".rev"})
+    {
+        std::filesystem::path sequential_path{sequential_filename.get_path()}, parallel_path{parallel_filename.get_path()};
+        sequential_path += suffix;
+        parallel_path += suffix;
+        EXPECT_EQ(file_bytes(sequential_path), file_bytes(parallel_path));
+    }
+}
+
+TEST(fm_index_test, shared_memory)
+{
+    if constexpr (!detail::shared_memory_segment::supported)
+        return;
+
+    std::string const name{"/seqan3_bi_fm_index_shm_test"};
+    bi_fm_index<std::vector<dna4>>::unlink_shm(name); // clean up leftovers of an aborted run
+
+    std::vector<dna4> const text = random_dna4_text(1000);
+    bi_fm_index<std::vector<dna4>> index{text};
+    ASSERT_TRUE(index.store_shm(name));
+
+    bi_fm_index<std::vector<dna4>> attached{};
+    ASSERT_TRUE(attached.load_shm(name));
+    EXPECT_EQ(attached.size(), index.size());
+
+    test::tmp_filename index_filename{"bi_fm_index"}, attached_filename{"bi_fm_index"};
+    ASSERT_TRUE(index.store(index_filename.get_path()));
+    ASSERT_TRUE(attached.store(attached_filename.get_path()));
+
+    for (char const * suffix : {".fwd", ".rev"})
+    {
+        std::filesystem::path index_path{index_filename.get_path()}, attached_path{attached_filename.get_path()};
+        index_path += suffix;
+        attached_path += suffix;
+        EXPECT_EQ(file_bytes(index_path), file_bytes(attached_path));
+    }
+
+    EXPECT_TRUE(bi_fm_index<std::vector<dna4>>::unlink_shm(name));
+}
@@ -101,6 +101,23 @@ TYPED_TEST_P(fm_index_collection_test, serialization)
     EXPECT_EQ(fm1.size(), 10u);
 }
 
+TYPED_TEST_P(fm_index_collection_test, container_serialization)
+{
+    typedef value_type_t<typename TypeParam::text_type> inner_text_type;
+    typename TypeParam::text_type text{inner_text_type(4), inner_text_type(4)};
+    TypeParam fm0{text};
+
+    test::tmp_filename filename{"fm_index_container"};
+    auto const & path = filename.get_path();
+
+    EXPECT_TRUE(fm0.store_container(path));
+
+    TypeParam fm1{};
+    EXPECT_TRUE(fm1.load_container(path));
+
+    EXPECT_EQ(fm1.size(), 10u);
+}
+
 TYPED_TEST_P(fm_index_collection_test, concept_check)
 {
     EXPECT_TRUE(FmIndex<TypeParam>);
@@ -122,4 +139,5 @@ TYPED_TEST_P(fm_index_collection_test, empty_text)
     }
 }
 
-REGISTER_TYPED_TEST_CASE_P(fm_index_collection_test, ctr, swap, size, serialization, concept_check, empty_text);
+REGISTER_TYPED_TEST_CASE_P(fm_index_collection_test, ctr, swap, size, serialization, container_serialization,
+                           concept_check, empty_text);
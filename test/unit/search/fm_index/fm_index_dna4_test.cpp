@@ -5,12 +5,27 @@
 // shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
 // -----------------------------------------------------------------------------------------------------
 
+#include <algorithm>
+#include <fstream>
+#include <numeric>
+#include <random>
+#include <sstream>
+
+#include <seqan3/range/container/bitcompressed_vector.hpp>
+#include <seqan3/range/container/concatenated_sequences.hpp>
+
 #include "fm_index_test_template.hpp"
 #include "fm_index_collection_test_template.hpp"
 
 INSTANTIATE_TYPED_TEST_CASE_P(dna4, fm_index_test, fm_index<std::vector<dna4>>);
 INSTANTIATE_TYPED_TEST_CASE_P(dna4_collection, fm_index_collection_test, fm_index<std::vector<std::vector<dna4>>>);
 
+using epr_index_t = fm_index<std::vector<dna4>, fm_index_epr_traits>;
+INSTANTIATE_TYPED_TEST_CASE_P(dna4_epr, fm_index_test, epr_index_t);
+
+using epr_collection_index_t = fm_index<std::vector<std::vector<dna4>>, fm_index_epr_traits>;
+INSTANTIATE_TYPED_TEST_CASE_P(dna4_collection_epr, fm_index_collection_test, epr_collection_index_t);
+
 TEST(fm_index_test, additional_concepts)
 {
     EXPECT_TRUE(FmIndexTraits<fm_index_default_traits>);
@@ -21,3 +36,217 @@ TEST(fm_index_collection_test, additional_concepts)
 {
     EXPECT_TRUE(FmIndex<fm_index<std::vector<std::string>>>);
 }
+
+//!\brief Generates a pseudo random dna4 text of the given length.
+static std::vector<dna4> random_dna4_text(size_t const length, size_t const seed = 0)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<uint8_t> dis(0, 3);
+
+    std::vector<dna4> text(length);
+    for (dna4 & c : text)
+        c.assign_rank(dis(gen));
+    return text;
+}
+
+//!\brief Serializes the index to a temporary file and returns the file content.
+template <typename index_t>
+static std::string stored_bytes(index_t const & index)
+{
+    test::tmp_filename filename{"fm_index"};
+    EXPECT_TRUE(index.store(filename.get_path()));
+
+    std::ifstream stream{filename.get_path(), std::ios::binary};
+    std::stringstream buffer;
+    buffer << stream.rdbuf();
+    return buffer.str();
+}
+
+TEST(fm_index_test, parallel_suffix_array)
+{
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<uint8_t> dis(1, 4); // ranks as prepared by the construction, 0 is the sentinel
+
+    sdsl::int_vector<8> text(1000);
+    for (size_t i = 0; i < text.size() - 1; ++i)
+        text[i] = dis(gen);
+    text[text.size() - 1] = 0; // zero-terminated as required
+
+    sdsl::int_vector<> sa = detail::parallel_suffix_array(text, 4);
+
+    std::vector<size_t> expected(text.size());
+    std::iota(expected.begin(), expected.end(), 0u);
+    std::sort(expected.begin(), expected.end(), [&] (size_t const lhs, size_t const rhs)
+    {
+        return std::lexicographical_compare(text.begin() + lhs, text.end(), text.begin() + rhs, text.end());
+    });
+
+    ASSERT_EQ(sa.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i)
+        EXPECT_EQ(sa[i], expected[i]);
+}
+
+TEST(fm_index_test, load_mmap)
+{
+    std::vector<dna4> text = random_dna4_text(1000);
+    fm_index<std::vector<dna4>> index{text};
+
+    test::tmp_filename filename{"fm_index"};
+    ASSERT_TRUE(index.store(filename.get_path()));
+
+    fm_index<std::vector<dna4>> mapped{};
+    ASSERT_TRUE(mapped.load_mmap(filename.get_path()));
+
+    EXPECT_EQ(mapped.size(), index.size());
+    EXPECT_EQ(stored_bytes(mapped), stored_bytes(index));
+
+    // A missing file is reported just like with load().
+    fm_index<std::vector<dna4>> missing{};
+    EXPECT_FALSE(missing.load_mmap(filename.get_path() / ".does_not_exist"));
+}
+
+TEST(fm_index_test, shared_memory)
+{
+    if constexpr (!detail::shared_memory_segment::supported)
+        return;
+
+    std::string const name{"/seqan3_fm_index_shm_test"};
+    fm_index<std::vector<dna4>>::unlink_shm(name); // clean up leftovers of an aborted run
+
+    std::vector<dna4> text = random_dna4_text(1000);
+    fm_index<std::vector<dna4>> index{text};
+    ASSERT_TRUE(index.store_shm(name));
+
+    fm_index<std::vector<dna4>> attached{};
+    ASSERT_TRUE(attached.load_shm(name));
+
+    EXPECT_EQ(attached.size(), index.size());
+    EXPECT_EQ(stored_bytes(attached), stored_bytes(index));
+
+    EXPECT_TRUE(fm_index<std::vector<dna4>>::unlink_shm(name));
+
+    // After unlinking, the segment cannot be attached anymore.
+    fm_index<std::vector<dna4>> missing{};
+    EXPECT_FALSE(missing.load_shm(name));
+}
+
+TEST(fm_index_collection_test, concatenated_sequences_construction)
+{
+    // The construction over concatenated_sequences reads the contiguous concat() storage directly and must
+    // produce an index that is bit-identical to the one built over a nested container.
+    std::vector<std::vector<dna4>> const nested{random_dna4_text(100, 0), {}, random_dna4_text(50, 1),
+                                                random_dna4_text(200, 2)};
+    concatenated_sequences<std::vector<dna4>> const concatenated{nested};
+
+    fm_index<std::vector<std::vector<dna4>>> const nested_index{nested};
+    fm_index<concatenated_sequences<std::vector<dna4>>> const concatenated_index{concatenated};
+
+    EXPECT_EQ(concatenated_index.size(), nested_index.size());
+    EXPECT_EQ(stored_bytes(concatenated_index), stored_bytes(nested_index));
+}
+
+TEST(fm_index_test, packed_construction)
+{
+    // The construction over a bitcompressed_vector reads the 2-bit packed ranks directly (with more than one
+    // thread even through the suffix array construction) and must produce an index that is bit-identical to
+    // the one built over a byte-per-symbol container.
+    std::vector<dna4> const text = random_dna4_text(2000, 5);
+    bitcompressed_vector<dna4> const packed_text{text.begin(), text.end()};
+
+    fm_index<std::vector<dna4>> const byte_index{text};
+    fm_index<bitcompressed_vector<dna4>> const packed_index{packed_text};
+    fm_index<bitcompressed_vector<dna4>> const packed_parallel_index{packed_text, 4};
+
+    EXPECT_EQ(packed_index.size(), byte_index.size());
+    EXPECT_EQ(stored_bytes(packed_index), stored_bytes(byte_index));
+    EXPECT_EQ(stored_bytes(packed_parallel_index), stored_bytes(byte_index));
+
+    // searching through the packed index works as usual
+    auto cur = packed_index.begin();
+    ASSERT_TRUE(cur.extend_right(std::vector<dna4>{text.begin(), text.begin() + 10}));
+    auto positions = cur.locate();
+    EXPECT_TRUE(std::find(positions.begin(), positions.end(), 0u) != positions.end());
+}
+
+TEST(fm_index_test, parallel_construction)
+{
+    std::vector<dna4> text = random_dna4_text(2000);
+
+    fm_index<std::vector<dna4>> sequential{text};
+    fm_index<std::vector<dna4>> parallel{text, 4};
+
+    // The parallel construction path must produce a bit-identical index.
+    EXPECT_EQ(sequential.size(), parallel.size());
+    EXPECT_EQ(stored_bytes(sequential), stored_bytes(parallel));
+}
+
+TEST(fm_index_collection_test, parallel_construction)
+{
+    std::vector<std::vector<dna4>> text{random_dna4_text(1000, 1), random_dna4_text(500, 2), random_dna4_text(1, 3)};
+
+    fm_index<std::vector<std::vector<dna4>>> sequential{text};
+    fm_index<std::vector<std::vector<dna4>>> parallel{text, 4};
+
+    EXPECT_EQ(sequential.size(), parallel.size());
+    EXPECT_EQ(stored_bytes(sequential), stored_bytes(parallel));
+}
+
+TEST(fm_index_test, sampling_traits)
+{
+    EXPECT_TRUE(FmIndexTraits<fm_index_sampling_traits<>>);
+    EXPECT_TRUE(FmIndexTraits<fm_index_fast_locate_traits>);
+    EXPECT_TRUE(FmIndexTraits<fm_index_small_memory_traits>);
+
+    std::vector<dna4> const text = random_dna4_text(1000);
+
+    fm_index<std::vector<dna4>> const index{text};
+    fm_index<std::vector<dna4>, fm_index_fast_locate_traits> const dense_index{text};
+    fm_index<std::vector<dna4>, fm_index_small_memory_traits> const sparse_index{text};
+
+    auto positions = [] (auto const & index, auto const & query)
+    {
+        auto cur = index.begin();
+        EXPECT_TRUE(cur.extend_right(query));
+        auto pos = cur.locate();
+        std::sort(pos.begin(), pos.end());
+        return pos;
+    };
+
+    // the sampling density only affects memory and locate latency, not the result
+    for (auto const & query : {"A"_dna4, "CG"_dna4})
+    {
+        auto const expected = positions(index, query);
+        EXPECT_EQ(positions(dense_index, query), expected);
+        EXPECT_EQ(positions(sparse_index, query), expected);
+    }
+}
+
+template <typename index_t>
+static void test_batch_locate()
+{
+    std::vector<dna4> const text = random_dna4_text(2000, 4);
+    index_t const index{text};
+
+    // short queries yield large suffix array intervals, i.e. many interleaved LF walks
+    for (auto const & query : {"A"_dna4, "ACG"_dna4, "TTT"_dna4})
+    {
+        auto cur = index.begin();
+        if (!cur.extend_right(query))
+            continue;
+
+        std::vector<size_t> expected{};
+        for (size_t pos : cur.lazy_locate()) // resolves every position individually
+            expected.push_back(pos);
+        std::vector<size_t> actual = cur.locate();
+
+        std::sort(expected.begin(), expected.end());
+        std::sort(actual.begin(), actual.end());
+        EXPECT_EQ(actual, expected);
+    }
+}
+
+TEST(fm_index_test, batch_locate)
+{
+    test_batch_locate<fm_index<std::vector<dna4>>>();
+    test_batch_locate<epr_index_t>();
+}
@@ -0,0 +1,217 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/search/algorithm/detail/search_scheme_algorithm.hpp>
+#include <seqan3/search/algorithm/detail/search_trivial.hpp>
+#include <seqan3/search/fm_index/all.hpp>
+
+using namespace seqan3;
+
+//!\brief Generates a pseudo random dna4 text of the given length.
+static std::vector<dna4> random_text(size_t const length, size_t const seed = 0)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<uint8_t> dis(0, 3);
+
+    std::vector<dna4> text(length);
+    for (dna4 & c : text)
+        c.assign_rank(dis(gen));
+    return text;
+}
+
+//!\brief Decodes the i-th k-mer from its base four representation.
+static std::vector<dna4> decode_kmer(size_t code, uint8_t const kmer_size)
+{
+    std::vector<dna4> kmer(kmer_size);
+    for (uint8_t i = kmer_size; i > 0; --i, code /= 4)
+        kmer[i - 1].assign_rank(code % 4);
+    return kmer;
+}
+
+TEST(fm_index_kmer_table, matches_root_extension)
+{
+    std::vector<dna4> const text = random_text(1000);
+    fm_index<std::vector<dna4>> const index{text};
+    fm_index_kmer_table const table{index, 3u};
+
+    EXPECT_EQ(table.kmer_size(), 3u);
+    EXPECT_GT(table.size(), 0u);
+
+    for (size_t code = 0; code < 64u; ++code)
+    {
+        std::vector<dna4> const kmer = decode_kmer(code, 3u);
+
+        auto expected = index.begin();
+        bool const occurs = expected.extend_right(kmer);
+        auto const actual = table.cursor(kmer);
+
+        ASSERT_EQ(actual.has_value(), occurs);
+        if (occurs)
+        {
+            EXPECT_EQ(*actual, expected);
+            EXPECT_EQ(actual->count(), expected.count());
+            EXPECT_EQ(actual->locate(), expected.locate());
+        }
+    }
+}
+
+TEST(fm_index_kmer_table, cycle_back_from_table_cursor)
+{
+    std::vector<dna4> const text = random_text(1000, 1);
+    fm_index<std::vector<dna4>> const index{text};
+    fm_index_kmer_table const table{index, 2u};
+
+    for (size_t code = 0; code < 16u; ++code)
+    {
+        std::vector<dna4> const kmer = decode_kmer(code, 2u);
+
+        auto expected = index.begin();
+        if (!expected.extend_right(kmer))
+            continue;
+        auto actual = *table.cursor(kmer);
+
+        // The stored cursors carry their parent interval, so cycling through the siblings works as usual.
+        bool expected_cycle = expected.cycle_back();
+        bool actual_cycle = actual.cycle_back();
+        while (expected_cycle && actual_cycle)
+        {
+            EXPECT_EQ(actual, expected);
+            expected_cycle = expected.cycle_back();
+            actual_cycle = actual.cycle_back();
+        }
+        EXPECT_EQ(actual_cycle, expected_cycle);
+    }
+}
+
+TEST(fm_index_kmer_table, bidirectional_cursor)
+{
+    std::vector<dna4> const text = random_text(1000, 2);
+    bi_fm_index<std::vector<dna4>> const index{text};
+    fm_index_kmer_table const table{index, 3u};
+
+    for (size_t code = 0; code < 64u; ++code)
+    {
+        std::vector<dna4> const kmer = decode_kmer(code, 3u);
+
+        auto expected = index.begin();
+        bool const occurs = expected.extend_right(kmer);
+        auto const actual = table.cursor(kmer);
+
+        ASSERT_EQ(actual.has_value(), occurs);
+        if (occurs)
+        {
+            EXPECT_EQ(actual->count(), expected.count());
+
+            // The bidirectional cursor must also be extendable to the left afterwards.
+            auto expected_left = expected;
+            auto actual_left = *actual;
+            EXPECT_EQ(actual_left.extend_left('A'_dna4), expected_left.extend_left('A'_dna4));
+        }
+    }
+}
+
+TEST(fm_index_kmer_table, search_trivial)
+{
+    std::vector<dna4> const text = random_text(2000, 3);
+    fm_index<std::vector<dna4>> const index{text};
+    fm_index_kmer_table const table{index, 4u};
+
+    std::mt19937 gen(4);
+    std::uniform_int_distribution<size_t> dis(0, text.size() - 20);
+
+    for (size_t i = 0; i < 100u; ++i)
+    {
+        size_t const pos = dis(gen);
+        std::vector<dna4> query(text.begin() + pos, text.begin() + pos + 15);
+        if (i % 3 == 0) // Also test queries that do not necessarily occur.
+            query = random_text(15, i);
+
+        for (uint8_t errors : {0u, 1u})
+        {
+            detail::search_param const param{errors, errors, 0, 0};
+
+            std::vector<size_t> expected{}, actual{};
+            detail::search_trivial<false>(index, query, param,
+                                          [&] (auto const & cur) { for (auto pos : cur.locate()) expected.push_back(pos); });
+            detail::search_trivial<false>(index, table, query, param,
+                                          [&] (auto const & cur) { for (auto pos : cur.locate()) actual.push_back(pos); });
+
+            std::sort(expected.begin(), expected.end());
+            std::sort(actual.begin(), actual.end());
+            EXPECT_EQ(actual, expected);
+        }
+    }
+}
+
+TEST(fm_index_kmer_table, search_scheme)
+{
+    std::vector<dna4> const text = random_text(2000, 5);
+    bi_fm_index<std::vector<dna4>> const index{text};
+    fm_index_kmer_table const table{index, 3u};
+
+    std::mt19937 gen(6);
+    std::uniform_int_distribution<size_t> dis(0, text.size() - 40);
+
+    for (size_t i = 0; i < 50u; ++i)
+    {
+        size_t const pos = dis(gen);
+        std::vector<dna4> query(text.begin() + pos, text.begin() + pos + 30);
+        if (i % 3 == 0)
+            query = random_text(30, i);
+
+        for (uint8_t errors : {0u, 1u, 2u})
+        {
+            detail::search_param const param{errors, errors, 0, 0};
+
+            auto run = [&] (auto && search_fn)
+            {
+                std::vector<size_t> hits{};
+                search_fn([&] (auto const & cur) { for (auto pos : cur.locate()) hits.push_back(pos); });
+                std::sort(hits.begin(), hits.end());
+                hits.erase(std::unique(hits.begin(), hits.end()), hits.end());
+                return hits;
+            };
+
+            auto search_with_scheme = [&] (auto && delegate)
+            {
+                if (errors == 0)
+                    detail::search_ss<false>(index, query, param, detail::optimum_search_scheme<0, 0>, delegate);
+                else if (errors == 1)
+                    detail::search_ss<false>(index, query, param, detail::optimum_search_scheme<0, 1>, delegate);
+                else
+                    detail::search_ss<false>(index, query, param, detail::optimum_search_scheme<0, 2>, delegate);
+            };
+
+            auto search_with_table = [&] (auto && delegate)
+            {
+                if (errors == 0)
+                    detail::search_ss<false>(index, table, query, param, detail::optimum_search_scheme<0, 0>, delegate);
+                else if (errors == 1)
+                    detail::search_ss<false>(index, table, query, param, detail::optimum_search_scheme<0, 1>, delegate);
+                else
+                    detail::search_ss<false>(index, table, query, param, detail::optimum_search_scheme<0, 2>, delegate);
+            };
+
+            EXPECT_EQ(run(search_with_table), run(search_with_scheme));
+        }
+    }
+}
+
+TEST(fm_index_kmer_table, invalid_kmer_size)
+{
+    std::vector<dna4> const text = random_text(100);
+    fm_index<std::vector<dna4>> const index{text};
+
+    EXPECT_THROW((fm_index_kmer_table{index, 0u}), std::invalid_argument);
+}
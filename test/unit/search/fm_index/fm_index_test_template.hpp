@@ -5,6 +5,7 @@
 // shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
 // -----------------------------------------------------------------------------------------------------
 
+#include <fstream>
 #include <type_traits>
 
 #include <seqan3/core/metafunction/template_inspection.hpp>
@@ -99,6 +100,28 @@ TYPED_TEST_P(fm_index_test, serialization)
     EXPECT_EQ(fm1.size(), 9u);
 }
 
+TYPED_TEST_P(fm_index_test, container_serialization)
+{
+    typename TypeParam::text_type text(8);
+    TypeParam fm0{text};
+
+    test::tmp_filename filename{"fm_index_container"};
+    auto const & path = filename.get_path();
+
+    EXPECT_TRUE(fm0.store_container(path));
+
+    TypeParam fm1{};
+    EXPECT_TRUE(fm1.load_container(path));
+
+    EXPECT_EQ(fm1.size(), 9u);
+
+    {   // A file that is not an index container is rejected by the header validation.
+        std::ofstream garbage{path, std::ios::binary};
+        garbage << "certainly not an index";
+    }
+    EXPECT_FALSE(fm1.load_container(path));
+}
+
 TYPED_TEST_P(fm_index_test, concept_check)
 {
     EXPECT_TRUE(FmIndex<TypeParam>);
@@ -114,4 +137,5 @@ TYPED_TEST_P(fm_index_test, empty_text)
     EXPECT_THROW(TypeParam index{text}, std::invalid_argument);
 }
 
-REGISTER_TYPED_TEST_CASE_P(fm_index_test, ctr, swap, size, serialization, concept_check, empty_text);
+REGISTER_TYPED_TEST_CASE_P(fm_index_test, ctr, swap, size, serialization, container_serialization, concept_check,
+                           empty_text);
@@ -0,0 +1,95 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/search/algorithm/all.hpp>
+#include <seqan3/search/fm_index/all.hpp>
+
+using namespace seqan3;
+using namespace seqan3::search_cfg;
+
+//!\brief Generates a pseudo random dna4 text of the given length.
+static std::vector<dna4> random_text(size_t const length, size_t const seed = 0)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<uint8_t> dis(0, 3);
+
+    std::vector<dna4> text(length);
+    for (dna4 & c : text)
+        c.assign_rank(dis(gen));
+    return text;
+}
+
+//!\brief Searches the monolithic index and returns the sorted unique hit positions.
+template <typename index_t, typename query_t, typename configuration_t>
+static std::vector<uint64_t> reference_hits(index_t const & index, query_t const & query,
+                                            configuration_t const & cfg)
+{
+    std::vector<uint64_t> hits{};
+    for (uint64_t const pos : search(index, query, cfg))
+        hits.push_back(pos);
+    std::sort(hits.begin(), hits.end());
+    hits.erase(std::unique(hits.begin(), hits.end()), hits.end());
+    return hits;
+}
+
+TEST(partitioned_fm_index, matches_monolithic_index)
+{
+    std::vector<dna4> const text = random_text(1000);
+    fm_index<std::vector<dna4>> const monolithic{text};
+
+    // small partitions, so that several partition boundaries are crossed by query occurrences
+    partitioned_fm_index<std::vector<dna4>> const partitioned{text, 20u, 100u};
+    EXPECT_EQ(partitioned.size(), text.size());
+    EXPECT_GT(partitioned.partition_count(), 5u);
+
+    configuration const exact_cfg = max_error{total{0}};
+    configuration const error_cfg = max_error{total{1}};
+
+    std::mt19937 gen(1);
+    std::uniform_int_distribution<size_t> dis(0, text.size() - 15);
+
+    for (size_t i = 0; i < 100u; ++i)
+    {
+        // sampled queries of length 15: with 1 error still within the overlap of 20
+        size_t const pos = dis(gen);
+        std::vector<dna4> query(text.begin() + pos, text.begin() + pos + 15);
+        if (i % 3 == 0) // also test queries that do not necessarily occur
+            query = random_text(15, i);
+
+        EXPECT_EQ(partitioned.search(query), reference_hits(monolithic, query, exact_cfg));
+        EXPECT_EQ(partitioned.search(query, error_cfg), reference_hits(monolithic, query, error_cfg));
+    }
+}
+
+TEST(partitioned_fm_index, single_partition)
+{
+    std::vector<dna4> const text = random_text(500, 1);
+    fm_index<std::vector<dna4>> const monolithic{text};
+    partitioned_fm_index<std::vector<dna4>> const partitioned{text, 20u}; // default partition size
+
+    EXPECT_EQ(partitioned.partition_count(), 1u);
+
+    configuration const cfg = max_error{total{0}};
+    std::vector<dna4> const query(text.begin(), text.begin() + 10);
+    EXPECT_EQ(partitioned.search(query), reference_hits(monolithic, query, cfg));
+}
+
+TEST(partitioned_fm_index, invalid_arguments)
+{
+    std::vector<dna4> const text = random_text(100, 2);
+    std::vector<dna4> const empty_text{};
+
+    EXPECT_THROW((partitioned_fm_index<std::vector<dna4>>{empty_text, 10u}), std::invalid_argument);
+    EXPECT_THROW((partitioned_fm_index<std::vector<dna4>>{text, 10u, 10u}), std::invalid_argument);
+}
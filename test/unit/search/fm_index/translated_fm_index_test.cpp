@@ -0,0 +1,164 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <seqan3/alphabet/aminoacid/translation.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/search/algorithm/all.hpp>
+#include <seqan3/search/fm_index/translated_fm_index.hpp>
+
+using namespace seqan3;
+using namespace seqan3::search_cfg;
+
+//!\brief Generates a pseudo random dna5 text of the given length.
+static std::vector<dna5> random_text(size_t const length, size_t const seed = 0)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<uint8_t> dis(0, 4);
+
+    std::vector<dna5> text(length);
+    for (dna5 & c : text)
+        c.assign_rank(dis(gen));
+    return text;
+}
+
+//!\brief Finds all exact occurrences of a protein query in a translated frame by scanning.
+static std::vector<size_t> naive_frame_hits(std::vector<aa27> const & frame, std::vector<aa27> const & query)
+{
+    std::vector<size_t> hits{};
+    if (frame.size() >= query.size())
+        for (size_t pos = 0; pos + query.size() <= frame.size(); ++pos)
+            if (std::equal(query.begin(), query.end(), frame.begin() + pos))
+                hits.push_back(pos);
+    return hits;
+}
+
+TEST(translated_fm_index, matches_naive_frame_scan)
+{
+    std::vector<std::vector<dna5>> const text{random_text(300, 0), random_text(100, 1), random_text(7, 2)};
+    translated_fm_index index{text};
+
+    EXPECT_EQ(index.size(), 3u);
+    ASSERT_EQ(index.frame_text().size(), 18u);
+
+    // the frame translations themselves are checked against view::translate_single
+    std::vector<std::vector<aa27>> frames{};
+    for (std::vector<dna5> const & sequence : text)
+        for (translation_frames const frame : index.frames)
+        {
+            auto translated = view::translate_single(sequence, frame);
+            frames.emplace_back(translated.begin(), translated.end());
+        }
+
+    for (size_t i = 0; i < frames.size(); ++i)
+        EXPECT_TRUE((std::ranges::equal(index.frame_text()[i], frames[i]))) << "frame " << i;
+
+    // every sampled query's hits must match a naive scan of all frames
+    std::mt19937 gen(3);
+    for (size_t iteration = 0; iteration < 50; ++iteration)
+    {
+        size_t const frame_id = gen() % frames.size();
+        if (frames[frame_id].size() < 5)
+            continue;
+
+        size_t const begin = gen() % (frames[frame_id].size() - 4);
+        std::vector<aa27> const query(frames[frame_id].begin() + begin, frames[frame_id].begin() + begin + 5);
+
+        std::vector<translated_fm_index<>::hit_type> expected{};
+        for (size_t i = 0; i < frames.size(); ++i)
+        {
+            for (size_t const aa_position : naive_frame_hits(frames[i], query))
+            {
+                size_t const reference_id = i / 6;
+                size_t const frame_index  = i % 6;
+                size_t const offset       = frame_index % 3;
+                size_t const position =
+                    (frame_index < 3) ? offset + 3 * aa_position
+                                      : text[reference_id].size() - offset - 3 * (aa_position + query.size());
+                expected.push_back({reference_id, index.frames[frame_index], aa_position, position});
+            }
+        }
+        std::sort(expected.begin(), expected.end());
+
+        EXPECT_EQ(index.search(query), expected);
+    }
+}
+
+TEST(translated_fm_index, coordinates_translate_back)
+{
+    std::vector<std::vector<dna5>> const text{random_text(200, 4)};
+    translated_fm_index index{text};
+
+    std::mt19937 gen(5);
+    for (size_t iteration = 0; iteration < 20; ++iteration)
+    {
+        size_t const frame_id = gen() % 6;
+        auto const & frame = index.frame_text()[frame_id];
+        if (frame.size() < 4)
+            continue;
+
+        size_t const begin = gen() % (frame.size() - 3);
+        std::vector<aa27> const query(frame.begin() + begin, frame.begin() + begin + 4);
+
+        for (auto const & hit : index.search(query))
+        {
+            // re-translating the codons at the mapped position must reproduce the query
+            std::vector<dna5> const & sequence = text[hit.reference_id];
+            bool const forward = hit.frame == translation_frames::FWD_FRAME_0 ||
+                                 hit.frame == translation_frames::FWD_FRAME_1 ||
+                                 hit.frame == translation_frames::FWD_FRAME_2;
+
+            for (size_t i = 0; i < query.size(); ++i)
+            {
+                size_t const codon = forward ? hit.position + 3 * i
+                                             : hit.position + 3 * (query.size() - 1 - i);
+                aa27 const translated =
+                    forward ? translate_triplet(sequence[codon], sequence[codon + 1], sequence[codon + 2])
+                            : translate_triplet(complement(sequence[codon + 2]),
+                                                complement(sequence[codon + 1]),
+                                                complement(sequence[codon]));
+                EXPECT_EQ(translated, query[i]);
+            }
+        }
+    }
+}
+
+TEST(translated_fm_index, with_errors)
+{
+    std::vector<std::vector<dna5>> const text{random_text(150, 6)};
+    translated_fm_index index{text};
+
+    auto const & frame = index.frame_text()[0]; // FWD_FRAME_0
+    ASSERT_GE(frame.size(), 10u);
+
+    std::vector<aa27> query(frame.begin() + 2, frame.begin() + 10);
+    query[3] = query[3] == 'A'_aa27 ? 'C'_aa27 : 'A'_aa27; // one substitution
+
+    auto const exact_hits = index.search(query);
+    auto const error_hits = index.search(query, max_error{total{1}, substitution{1}});
+
+    // the mutated query is found again with one substitution allowed
+    bool found = false;
+    for (auto const & hit : error_hits)
+        found |= hit.frame == translation_frames::FWD_FRAME_0 && hit.aa_position == 2;
+    EXPECT_TRUE(found);
+    EXPECT_GE(error_hits.size(), exact_hits.size());
+}
+
+TEST(translated_fm_index, invalid_input)
+{
+    std::vector<std::vector<dna5>> const empty{};
+    EXPECT_THROW((translated_fm_index{empty}), std::invalid_argument);
+
+    std::vector<std::vector<dna5>> const too_short{random_text(2, 7)}; // no frame holds a codon
+    EXPECT_THROW((translated_fm_index{too_short}), std::invalid_argument);
+}
@@ -0,0 +1,155 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <sdsl/int_vector.hpp>
+
+#include <seqan3/search/fm_index/detail/wt_epr.hpp>
+
+using namespace seqan3;
+
+//!\brief Builds a wt_epr over the given symbols through a ram file, like the csa_wt assembly does.
+static sdsl::wt_epr<3> make_wt_epr(std::vector<uint8_t> const & symbols)
+{
+    sdsl::int_vector<8> text(symbols.size());
+    for (size_t i = 0; i < symbols.size(); ++i)
+        text[i] = symbols[i];
+
+    std::string const file = "@wt_epr_test";
+    sdsl::store_to_file(text, file);
+    sdsl::int_vector_buffer<8> buffer(file);
+    sdsl::wt_epr<3> wt(buffer, buffer.size());
+    sdsl::ram_fs::remove(file);
+    return wt;
+}
+
+//!\brief Generates pseudo random symbols below the given alphabet size.
+static std::vector<uint8_t> random_symbols(size_t const length, uint8_t const sigma, size_t const seed = 0)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<uint8_t> dis(0, sigma - 1);
+
+    std::vector<uint8_t> symbols(length);
+    for (uint8_t & symbol : symbols)
+        symbol = dis(gen);
+    return symbols;
+}
+
+TEST(wt_epr, access_and_rank)
+{
+    // Length crosses several blocks and is not a multiple of the block size.
+    std::vector<uint8_t> const symbols = random_symbols(1000, 6);
+    sdsl::wt_epr<3> const wt = make_wt_epr(symbols);
+
+    EXPECT_EQ(wt.size(), symbols.size());
+    EXPECT_EQ(wt.sigma, 6u);
+
+    std::array<size_t, 8> counts{};
+    for (size_t i = 0; i < symbols.size(); ++i)
+    {
+        EXPECT_EQ(wt[i], symbols[i]);
+        for (uint8_t c = 0; c < 8; ++c)
+            EXPECT_EQ(wt.rank(i, c), counts[c]);
+        ++counts[symbols[i]];
+    }
+    for (uint8_t c = 0; c < 8; ++c)
+        EXPECT_EQ(wt.rank(symbols.size(), c), counts[c]);
+}
+
+TEST(wt_epr, block_boundary)
+{
+    // A multiple of the block size, so that rank at size() hits the counters one past the last block.
+    std::vector<uint8_t> const symbols = random_symbols(128, 4, 1);
+    sdsl::wt_epr<3> const wt = make_wt_epr(symbols);
+
+    std::array<size_t, 8> counts{};
+    for (uint8_t const symbol : symbols)
+        ++counts[symbol];
+    for (uint8_t c = 0; c < 8; ++c)
+    {
+        EXPECT_EQ(wt.rank(symbols.size(), c), counts[c]);
+        EXPECT_EQ(wt.rank(64, c), wt.all_ranks(64)[c]);
+    }
+}
+
+TEST(wt_epr, all_ranks)
+{
+    std::vector<uint8_t> const symbols = random_symbols(500, 7, 2);
+    sdsl::wt_epr<3> const wt = make_wt_epr(symbols);
+
+    for (size_t i = 0; i <= symbols.size(); i += 7)
+    {
+        std::array<sdsl::wt_epr<3>::size_type, 8> const ranks = wt.all_ranks(i);
+        for (uint8_t c = 0; c < 8; ++c)
+            EXPECT_EQ(ranks[c], wt.rank(i, c));
+    }
+}
+
+TEST(wt_epr, inverse_select_and_select)
+{
+    std::vector<uint8_t> const symbols = random_symbols(300, 5, 3);
+    sdsl::wt_epr<3> const wt = make_wt_epr(symbols);
+
+    for (size_t i = 0; i < symbols.size(); ++i)
+    {
+        auto const [rank, symbol] = wt.inverse_select(i);
+        EXPECT_EQ(symbol, symbols[i]);
+        EXPECT_EQ(rank, wt.rank(i, symbols[i]));
+        EXPECT_EQ(wt.select(rank + 1, symbol), i); // select is the inverse of rank
+    }
+}
+
+TEST(wt_epr, lex_count)
+{
+    std::vector<uint8_t> const symbols = random_symbols(200, 6, 4);
+    sdsl::wt_epr<3> const wt = make_wt_epr(symbols);
+
+    size_t const i = 17, j = 181;
+    for (uint8_t c = 0; c < 8; ++c)
+    {
+        size_t smaller{}, greater{};
+        for (size_t k = i; k < j; ++k)
+        {
+            smaller += symbols[k] < c;
+            greater += symbols[k] > c;
+        }
+
+        auto const [rank, lex_smaller, lex_greater] = wt.lex_count(i, j, c);
+        EXPECT_EQ(rank, wt.rank(i, c));
+        EXPECT_EQ(lex_smaller, smaller);
+        EXPECT_EQ(lex_greater, greater);
+    }
+}
+
+TEST(wt_epr, serialization)
+{
+    std::vector<uint8_t> const symbols = random_symbols(400, 6, 5);
+    sdsl::wt_epr<3> const wt = make_wt_epr(symbols);
+
+    std::stringstream stream{};
+    wt.serialize(stream);
+
+    sdsl::wt_epr<3> loaded{};
+    loaded.load(stream);
+
+    EXPECT_EQ(loaded.size(), wt.size());
+    EXPECT_EQ(loaded.sigma, wt.sigma);
+    for (size_t i = 0; i <= symbols.size(); ++i)
+        for (uint8_t c = 0; c < 8; ++c)
+            EXPECT_EQ(loaded.rank(i, c), wt.rank(i, c));
+}
+
+TEST(wt_epr, unrepresentable_symbol)
+{
+    EXPECT_THROW(make_wt_epr({0, 1, 8}), std::invalid_argument);
+}
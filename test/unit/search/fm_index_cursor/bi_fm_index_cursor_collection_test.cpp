@@ -9,3 +9,6 @@
 
 INSTANTIATE_TYPED_TEST_CASE_P(dna4, bi_fm_index_cursor_collection_test,
                               bi_fm_index_cursor<bi_fm_index<std::vector<std::vector<dna4>>>>);
+
+INSTANTIATE_TYPED_TEST_CASE_P(dna4_epr, bi_fm_index_cursor_collection_test,
+                              bi_fm_index_cursor<bi_fm_index<std::vector<std::vector<dna4>>, bi_fm_index_epr_traits>>);
@@ -8,3 +8,6 @@
 #include "bi_fm_index_cursor_test_template.hpp"
 
 INSTANTIATE_TYPED_TEST_CASE_P(dna4, bi_fm_index_cursor_test, bi_fm_index_cursor<bi_fm_index<std::vector<dna4>>>);
+
+INSTANTIATE_TYPED_TEST_CASE_P(dna4_epr, bi_fm_index_cursor_test,
+                              bi_fm_index_cursor<bi_fm_index<std::vector<dna4>, bi_fm_index_epr_traits>>);
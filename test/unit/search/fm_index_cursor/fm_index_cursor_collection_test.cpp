@@ -18,3 +18,6 @@ INSTANTIATE_TYPED_TEST_CASE_P(bi_default_traits, fm_index_cursor_collection_test
 
 using it_t4 = bi_fm_index_cursor<bi_fm_index<std::vector<std::vector<dna4>>, bi_fm_index_byte_alphabet_traits>>;
 INSTANTIATE_TYPED_TEST_CASE_P(bi_byte_alphabet_traits, fm_index_cursor_collection_test, it_t4);
+
+using it_t5 = fm_index_cursor<fm_index<std::vector<std::vector<dna4>>, fm_index_epr_traits>>;
+INSTANTIATE_TYPED_TEST_CASE_P(epr_traits, fm_index_cursor_collection_test, it_t5);
@@ -0,0 +1,167 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <map>
+#include <random>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/io/sequence_file/input.hpp>
+#include <seqan3/range/view/kmer_hash.hpp>
+#include <seqan3/search/kmer_count/kmer_counter.hpp>
+#include <seqan3/test/tmp_filename.hpp>
+
+using namespace seqan3;
+
+namespace
+{
+
+dna4_vector generate_sequence(size_t const length, size_t const seed)
+{
+    std::mt19937 engine(seed);
+    std::uniform_int_distribution<uint8_t> distribution{0, 3}; // dna4 ranks
+
+    dna4_vector sequence{};
+    sequence.reserve(length);
+    for (size_t i = 0; i < length; ++i)
+        sequence.push_back(assign_rank(dna4{}, distribution(engine)));
+
+    return sequence;
+}
+
+// Reference counts via the kmer_hash view; the engine produces the same encodings.
+std::map<uint64_t, uint64_t> reference_counts(std::vector<dna4_vector> const & sequences, uint8_t const kmer_size)
+{
+    std::map<uint64_t, uint64_t> counts{};
+    for (dna4_vector const & sequence : sequences)
+        if (sequence.size() >= kmer_size)
+            for (uint64_t const hash : sequence | view::kmer_hash(kmer_size))
+                ++counts[hash];
+    return counts;
+}
+
+} // anonymous namespace
+
+TEST(kmer_count_table, increment_and_count)
+{
+    kmer_count_table table{};
+    EXPECT_EQ(table.count(42u), 0u);
+
+    table.increment(42u);
+    table.increment(42u, 3u);
+    table.increment(7u);
+
+    EXPECT_EQ(table.count(42u), 4u);
+    EXPECT_EQ(table.count(7u), 1u);
+    EXPECT_EQ(table.count(1u), 0u);
+    EXPECT_EQ(table.unique_kmer_count(), 2u);
+    EXPECT_EQ(table.total_kmer_count(), 5u);
+}
+
+TEST(kmer_count_table, merge)
+{
+    kmer_count_table first{};
+    kmer_count_table second{};
+    first.increment(1u);
+    first.increment(2u, 5u);
+    second.increment(2u, 3u);
+    second.increment(7u);
+
+    first.merge(second);
+
+    EXPECT_EQ(first.count(1u), 1u);
+    EXPECT_EQ(first.count(2u), 8u);
+    EXPECT_EQ(first.count(7u), 1u);
+    EXPECT_EQ(first.unique_kmer_count(), 3u);
+}
+
+TEST(kmer_count_table, for_each)
+{
+    kmer_count_table table{};
+    for (uint64_t kmer = 0; kmer < 1000; ++kmer)
+        table.increment(kmer, kmer + 1);
+
+    uint64_t total = 0;
+    size_t entries = 0;
+    table.for_each([&] (uint64_t const kmer, uint64_t const count)
+    {
+        EXPECT_EQ(count, kmer + 1);
+        total += count;
+        ++entries;
+    });
+    EXPECT_EQ(entries, 1000u);
+    EXPECT_EQ(total, table.total_kmer_count());
+}
+
+TEST(kmer_counter, matches_kmer_hash_view)
+{
+    uint8_t const kmer_size = 5;
+    std::vector<dna4_vector> sequences{};
+    for (size_t seed = 0; seed < 50; ++seed)
+        sequences.push_back(generate_sequence(3 + seed * 7, seed)); // includes sequences shorter than k
+
+    std::map<uint64_t, uint64_t> expected = reference_counts(sequences, kmer_size);
+
+    kmer_counter counter{kmer_size, 1};
+    kmer_count_table table = counter.count(sequences);
+
+    EXPECT_EQ(table.unique_kmer_count(), expected.size());
+    for (auto const & [hash, count] : expected)
+        EXPECT_EQ(table.count(hash), count);
+}
+
+TEST(kmer_counter, parallel_equals_sequential)
+{
+    uint8_t const kmer_size = 7;
+    std::vector<dna4_vector> sequences{};
+    for (size_t seed = 0; seed < 100; ++seed)
+        sequences.push_back(generate_sequence(50 + seed, seed));
+
+    kmer_count_table sequential = kmer_counter{kmer_size, 1}.count(sequences);
+    kmer_count_table parallel = kmer_counter{kmer_size, 4, 8}.count(sequences);
+
+    EXPECT_EQ(parallel.unique_kmer_count(), sequential.unique_kmer_count());
+    EXPECT_EQ(parallel.total_kmer_count(), sequential.total_kmer_count());
+    sequential.for_each([&] (uint64_t const kmer, uint64_t const count)
+    {
+        EXPECT_EQ(parallel.count(kmer), count);
+    });
+}
+
+TEST(kmer_counter, file_input)
+{
+    test::tmp_filename filename{"kmer_counter.fasta"};
+    {
+        std::ofstream file{filename.get_path()};
+        file << ">read1\nACGTACGT\n>read2\nACGTT\n>read3\nAC\n";
+    }
+
+    sequence_file_input fin{filename.get_path()};
+    kmer_count_table table = kmer_counter{4, 2}.count(fin);
+
+    // ACGTACGT: ACGT, CGTA, GTAC, TACG, ACGT; ACGTT: ACGT, CGTT; AC contributes nothing.
+    EXPECT_EQ(table.total_kmer_count(), 7u);
+    EXPECT_EQ(table.unique_kmer_count(), 5u);
+
+    // The file reads into dna5 sequences, so the table keys are base 5 encodings.
+    dna5_vector acgt = "ACGT"_dna5;
+    uint64_t const acgt_hash = *std::ranges::begin(acgt | view::kmer_hash(4));
+    EXPECT_EQ(table.count(acgt_hash), 3u);
+}
+
+TEST(kmer_counter, invalid_arguments)
+{
+    EXPECT_THROW(kmer_counter{0}, std::invalid_argument);
+
+    std::vector<dna4_vector> sequences{generate_sequence(100, 0)};
+    kmer_counter counter{64, 1}; // 4^64 does not fit into 64 bits
+    EXPECT_THROW(counter.count(sequences), std::invalid_argument);
+}
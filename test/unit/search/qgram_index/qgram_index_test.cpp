@@ -0,0 +1,162 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2019, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2019, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/container/concatenated_sequences.hpp>
+#include <seqan3/search/qgram_index/all.hpp>
+
+using namespace seqan3;
+
+//!\brief Generates a pseudo random dna4 text of the given length.
+static std::vector<dna4> random_text(size_t const length, size_t const seed = 0)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<uint8_t> dis(0, 3);
+
+    std::vector<dna4> text(length);
+    for (dna4 & c : text)
+        c.assign_rank(dis(gen));
+    return text;
+}
+
+//!\brief Computes the base four code of the q-gram starting at the given position.
+template <typename text_t>
+static size_t qgram_code(text_t const & text, size_t const pos, uint8_t const qgram_size)
+{
+    size_t code = 0;
+    for (uint8_t i = 0; i < qgram_size; ++i)
+        code = code * 4 + to_rank(text[pos + i]);
+    return code;
+}
+
+//!\brief Collects all begin positions of the given q-gram with a naive scan.
+template <typename text_t, typename qgram_t>
+static std::vector<uint64_t> naive_positions(text_t const & text, qgram_t const & qgram)
+{
+    std::vector<uint64_t> positions{};
+    for (size_t pos = 0; pos + qgram.size() <= text.size(); ++pos)
+        if (std::equal(qgram.begin(), qgram.end(), text.begin() + pos))
+            positions.push_back(pos);
+    return positions;
+}
+
+TEST(qgram_index, lookup_matches_naive_scan)
+{
+    std::vector<dna4> const text = random_text(1000);
+    qgram_index const index{text, 3u};
+
+    EXPECT_EQ(index.qgram_size(), 3u);
+    EXPECT_EQ(index.window_size(), 1u);
+    EXPECT_EQ(index.size(), text.size() - 2u); // every q-gram is indexed
+
+    for (size_t code = 0; code < 64u; ++code)
+    {
+        std::vector<dna4> qgram(3);
+        for (size_t i = 3, c = code; i > 0; --i, c /= 4)
+            qgram[i - 1].assign_rank(c % 4);
+
+        std::vector<uint64_t> const expected = naive_positions(text, qgram);
+        std::vector<uint64_t> const actual(index.lookup(qgram).begin(), index.lookup(qgram).end());
+        EXPECT_EQ(actual, expected); // also checks that the positions are reported in ascending order
+    }
+}
+
+TEST(qgram_index, lookup_uses_qgram_prefix)
+{
+    std::vector<dna4> const text = random_text(500, 1);
+    qgram_index const index{text, 4u};
+
+    // only the first qgram_size() characters of a longer seed select the bucket
+    std::vector<dna4> const seed(text.begin(), text.begin() + 10);
+    std::vector<dna4> const qgram(text.begin(), text.begin() + 4);
+    EXPECT_TRUE(std::equal(index.lookup(seed).begin(), index.lookup(seed).end(),
+                           index.lookup(qgram).begin(), index.lookup(qgram).end()));
+}
+
+TEST(qgram_index, collection)
+{
+    concatenated_sequences<std::vector<dna4>> text{};
+    text.push_back(random_text(300, 2));
+    text.push_back(random_text(2, 3)); // too short for any q-gram
+    text.push_back(random_text(200, 4));
+
+    qgram_index const index{text, 3u};
+    EXPECT_EQ(index.size(), (300u - 2u) + (200u - 2u));
+
+    for (size_t code = 0; code < 64u; ++code)
+    {
+        std::vector<dna4> qgram(3);
+        for (size_t i = 3, c = code; i > 0; --i, c /= 4)
+            qgram[i - 1].assign_rank(c % 4);
+
+        std::vector<std::pair<uint64_t, uint64_t>> expected{};
+        for (uint64_t text_id = 0; text_id < text.size(); ++text_id)
+            for (uint64_t pos : naive_positions(text[text_id], qgram))
+                expected.emplace_back(text_id, pos);
+
+        std::vector<std::pair<uint64_t, uint64_t>> const actual(index.lookup(qgram).begin(),
+                                                                index.lookup(qgram).end());
+        EXPECT_EQ(actual, expected);
+    }
+}
+
+TEST(qgram_index, minimizer_subsampling)
+{
+    std::vector<dna4> const text = random_text(1000, 5);
+    uint8_t constexpr q = 3u;
+    uint32_t constexpr w = 5u;
+    qgram_index const index{text, q, w};
+
+    EXPECT_EQ(index.window_size(), w);
+    EXPECT_LT(index.size(), text.size() - q + 1u); // strictly fewer positions than the full index
+
+    // collect the sampled positions of all buckets
+    std::vector<uint64_t> sampled{};
+    for (size_t code = 0; code < 64u; ++code)
+    {
+        std::vector<dna4> qgram(3);
+        for (size_t i = 3, c = code; i > 0; --i, c /= 4)
+            qgram[i - 1].assign_rank(c % 4);
+
+        for (uint64_t pos : index.lookup(qgram))
+        {
+            EXPECT_EQ(qgram_code(text, pos, q), code); // the position belongs to its bucket
+            sampled.push_back(pos);
+        }
+    }
+    std::sort(sampled.begin(), sampled.end());
+    EXPECT_EQ(sampled.size(), index.size()); // every sampled position is stored exactly once
+
+    // every window of w consecutive q-grams contains its minimizer: the leftmost q-gram of smallest code
+    size_t const qgram_count = text.size() - q + 1;
+    for (size_t window_begin = 0; window_begin + w <= qgram_count; ++window_begin)
+    {
+        uint64_t minimizer_pos = window_begin;
+        for (size_t pos = window_begin + 1; pos < window_begin + w; ++pos)
+            if (qgram_code(text, pos, q) < qgram_code(text, minimizer_pos, q))
+                minimizer_pos = pos;
+
+        EXPECT_TRUE(std::binary_search(sampled.begin(), sampled.end(), minimizer_pos));
+    }
+}
+
+TEST(qgram_index, invalid_arguments)
+{
+    std::vector<dna4> const text = random_text(100);
+    std::vector<dna4> const empty_text{};
+
+    EXPECT_THROW((qgram_index{text, 0u}), std::invalid_argument);
+    EXPECT_THROW((qgram_index{text, 3u, 0u}), std::invalid_argument);
+    EXPECT_THROW((qgram_index{empty_text, 3u}), std::invalid_argument);
+    EXPECT_THROW((qgram_index<std::vector<dna4>>{}.construct(text, 33u)), std::invalid_argument);
+}
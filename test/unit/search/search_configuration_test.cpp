@@ -20,7 +20,11 @@ class search_configuration_test : public ::testing::Test
 using test_types = ::testing::Types<search_cfg::max_error_rate<>,
                                     search_cfg::max_error<>,
                                     search_cfg::mode<detail::search_mode_best>,
-                                    search_cfg::output<detail::search_output_text_position>>;
+                                    search_cfg::output<detail::search_output_text_position>,
+                                    search_cfg::parallel,
+                                    search_cfg::in_text_verification,
+                                    search_cfg::on_hit<void(*)(size_t)>,
+                                    search_cfg::both_strands>;
 
 TYPED_TEST_CASE(search_configuration_test, test_types);
 
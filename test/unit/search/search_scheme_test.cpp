@@ -68,6 +68,12 @@ TEST(search_scheme_test, error_distribution_coverage_optimum_search_schemes)
 
     error_distributions<3, 3, true>(expected, actual);
     EXPECT_EQ(actual, expected);
+
+    error_distributions<0, 4, true>(expected, actual);
+    EXPECT_EQ(actual, expected);
+
+    error_distributions<0, 5, true>(expected, actual);
+    EXPECT_EQ(actual, expected);
 }
 
 TEST(search_scheme_test, error_distribution_coverage_computed_search_schemes)
@@ -137,4 +143,8 @@ TEST(search_scheme_test, error_distribution_disjoint_optimum_search_schemes)
     EXPECT_TRUE(ret);
     ret = check_disjoint_search_scheme<0, 3, false>();
     EXPECT_TRUE(ret);
+    ret = check_disjoint_search_scheme<0, 4, false>();
+    EXPECT_TRUE(ret);
+    ret = check_disjoint_search_scheme<0, 5, false>();
+    EXPECT_TRUE(ret);
 }
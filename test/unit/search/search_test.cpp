@@ -34,7 +34,9 @@ public:
     T index{text};
 };
 
-using fm_index_types        = ::testing::Types<fm_index<std::vector<dna4>>, bi_fm_index<std::vector<dna4>>>;
+using fm_index_types        = ::testing::Types<fm_index<std::vector<dna4>>,
+                                               bi_fm_index<std::vector<dna4>>,
+                                               bi_fm_index<std::vector<dna4>, bi_fm_index_epr_traits>>;
 using fm_index_string_types = ::testing::Types<fm_index<std::string>, bi_fm_index<std::string>>;
 
 TYPED_TEST_CASE(search_test, fm_index_types);
@@ -109,6 +111,103 @@ TYPED_TEST(search_test, multiple_queries)
     EXPECT_EQ(uniquify(search(this->index, queries, cfg)), (hits_result_t{{}, {0}, {0, 4}})); // 0, 1 and 2 hits
 }
 
+TYPED_TEST(search_test, multiple_queries_parallel)
+{
+    using hits_result_t = std::vector<std::vector<typename TypeParam::size_type>>;
+    std::vector<std::vector<dna4>> const queries{{"GG"_dna4, "ACGTACGTACGT"_dna4, "ACGTA"_dna4}};
+
+    // the hits are reported per query in the order of the input range, regardless of the number of threads
+    for (uint32_t thread_count : {0u, 1u, 2u, 8u})
+    {
+        configuration const cfg = max_error{total{1}, substitution{1}} | parallel{thread_count};
+        EXPECT_EQ(uniquify(search(this->index, queries, cfg)),
+                  uniquify(search(this->index, queries, max_error{total{1}, substitution{1}})));
+    }
+}
+
+TYPED_TEST(search_test, many_hits_deduplication)
+{
+    using hits_result_t = std::vector<typename TypeParam::size_type>;
+
+    // enough hits to leave the linear scan fast path of the streaming deduplication
+    std::vector<dna4> repetitive_text;
+    for (size_t i = 0; i < 50; ++i)
+        for (dna4 const c : "ACGT"_dna4)
+            repetitive_text.push_back(c);
+    TypeParam index{repetitive_text};
+
+    hits_result_t expected;
+    for (size_t i = 0; i < 50; ++i)
+        expected.push_back(4 * i);
+
+    EXPECT_EQ(search(index, "ACGT"_dna4), expected);
+    EXPECT_EQ(search(index, "ACGT"_dna4, max_error{total{1}, substitution{1}}), expected);
+    // with indels every hit is additionally found by multiple alignments and must still be reported once
+    EXPECT_EQ(search(index, "ACGT"_dna4, max_error{total{1}, substitution{1}, insertion{1}, deletion{1}}),
+              (uniquify(search(index, "ACGT"_dna4, max_error{total{1}, substitution{1}, insertion{1}, deletion{1}}))));
+}
+
+TYPED_TEST(search_test, in_text_verification)
+{
+    using hits_result_t = std::vector<typename TypeParam::size_type>;
+
+    // the cutover must not change the hits, regardless of how early it triggers
+    for (uint32_t threshold : {1u, 5u, 100u})
+    {
+        for (uint8_t errors : {0u, 1u, 2u})
+        {
+            configuration const cfg = max_error{total{errors}, substitution{errors},
+                                                insertion{errors}, deletion{errors}};
+            configuration const cfg_itv = cfg | in_text_verification{threshold};
+
+            for (auto const & query : {"ACGT"_dna4, "ACGGT"_dna4, "CGTC"_dna4, "TTTT"_dna4})
+                EXPECT_EQ(uniquify(search(this->index, query, cfg_itv)), uniquify(search(this->index, query, cfg)));
+        }
+    }
+
+    {
+        // substitution-only searches must not be affected (the cutover is disabled internally)
+        configuration const cfg = max_error{total{1}, substitution{1}};
+        configuration const cfg_itv = cfg | in_text_verification{100};
+        EXPECT_EQ(uniquify(search(this->index, "ACGT"_dna4, cfg_itv)),
+                  (hits_result_t{0, 1, 4, 5, 8, 9}));
+    }
+
+    {
+        // best mode reports exactly one of the best hits
+        configuration const cfg = max_error{total{1}, substitution{1}, insertion{1}, deletion{1}} |
+                                  mode{best} | in_text_verification{100};
+        hits_result_t result = search(this->index, "ACGT"_dna4, cfg);
+        ASSERT_EQ(result.size(), 1u);
+    }
+}
+
+TYPED_TEST(search_test, output_count)
+{
+    using count_result_t = std::vector<typename TypeParam::size_type>;
+
+    {
+        // counting exact hits reports the sizes of the suffix array intervals
+        configuration const cfg = max_error{total{0}} | output{search_cfg::count};
+        EXPECT_EQ(search(this->index, "ACGT"_dna4, cfg), 3u);
+        EXPECT_EQ(search(this->index, "ACGG"_dna4, cfg), 0u);
+    }
+
+    {
+        // in the best mode at most one hit is counted
+        configuration const cfg = max_error{total{1}} | mode{best} | output{search_cfg::count};
+        EXPECT_EQ(search(this->index, "ACGT"_dna4, cfg), 1u);
+        EXPECT_EQ(search(this->index, "AAAA"_dna4, cfg), 0u);
+    }
+
+    {
+        // multiple queries yield one count per query
+        configuration const cfg = max_error{total{0}} | output{search_cfg::count};
+        std::vector<std::vector<dna4>> const queries{{"GG"_dna4, "ACGTACGTACGT"_dna4, "ACGTA"_dna4}};
+        EXPECT_EQ(search(this->index, queries, cfg), (count_result_t{0, 1, 2}));
+    }
+}
+
 TYPED_TEST(search_test, invalid_error_configuration)
 {
     configuration const cfg = max_error{total{0}, substitution{1}};
@@ -320,6 +419,12 @@ TYPED_TEST(search_test, search_strategy_strata)
         EXPECT_EQ(search(this->index, "AAAA"_dna4, cfg), (hits_result_t{})); // no hit
     }
 
+    {
+        // the best hits have 1 error, i.e. the lowest non-empty stratum is not the exact one
+        configuration const cfg = max_error{total{1}} | mode{strata{0}};
+        EXPECT_EQ(uniquify(search(this->index, "ACGG"_dna4, cfg)), (hits_result_t{0, 4, 8}));
+    }
+
     // {
     //     // best hit ACGT with 1 error, i.e. 1+1
     //     configuration const cfg = max_total_error{1} | strategy_strata{1};
@@ -373,7 +478,132 @@ TYPED_TEST(search_string_test, multiple_queries_raw)
 // TYPED_TEST(search_test, return_iterator_index)
 // {
 // }
-//
-// TYPED_TEST(search_test, on_hit)
-// {
-// }
+
+TYPED_TEST(search_test, both_strands)
+{
+    using hits_result_t = std::vector<typename TypeParam::size_type>;
+
+    {
+        // hits of the query and of its reverse complement are reported together
+        configuration const cfg = both_strands{};
+        EXPECT_EQ(search(this->index, "AC"_dna4, cfg), (hits_result_t{0, 2, 4, 6, 8, 10})); // GT at 2, 6, 10
+    }
+
+    {
+        // a palindromic query finds every occurrence on both strands but reports it only once
+        configuration const cfg = both_strands{};
+        EXPECT_EQ(search(this->index, "ACGT"_dna4, cfg), (hits_result_t{0, 4, 8}));
+    }
+
+    {
+        // the counts of both strands are summed
+        configuration const cfg = both_strands{} | output{search_cfg::count};
+        EXPECT_EQ(search(this->index, "AC"_dna4, cfg), 6u);
+    }
+
+    {
+        // approximate search covers both strands as well: AAC at 3, 7 and GTT (= its reverse complement) at 2, 6
+        configuration const cfg = max_error{total{1}, substitution{1}} | both_strands{};
+        EXPECT_EQ(uniquify(search(this->index, "AAC"_dna4, cfg)), (hits_result_t{2, 3, 6, 7}));
+    }
+
+    {
+        // streaming hits into a delegate reports both strands as well
+        hits_result_t streamed{};
+        configuration const cfg = both_strands{} |
+                                  on_hit{[&] (auto const text_pos) { streamed.push_back(text_pos); }};
+        search(this->index, "AC"_dna4, cfg);
+        EXPECT_EQ(uniquify(streamed), (hits_result_t{0, 2, 4, 6, 8, 10}));
+    }
+}
+
+TYPED_TEST(search_test, on_hit_delegate)
+{
+    using hits_result_t = std::vector<typename TypeParam::size_type>;
+
+    {
+        // every hit is streamed into the delegate during the traversal; search returns void
+        hits_result_t streamed{};
+        configuration const cfg = max_error{total{1}, substitution{1}} |
+                                  on_hit{[&] (auto const text_pos) { streamed.push_back(text_pos); }};
+        EXPECT_TRUE((std::is_void_v<decltype(search(this->index, "ACGT"_dna4, cfg))>));
+        search(this->index, "ACGT"_dna4, cfg);
+        // the streamed hits are not deduplicated, hence the comparison after uniquify
+        EXPECT_EQ(uniquify(streamed), uniquify(search(this->index, "ACGT"_dna4, max_error{total{1}, substitution{1}})));
+    }
+
+    {
+        // a delegate returning true terminates the search of the query at the first hit
+        hits_result_t streamed{};
+        configuration const cfg = on_hit{[&] (auto const text_pos) { streamed.push_back(text_pos); return true; }};
+        search(this->index, "ACGT"_dna4, cfg);
+        EXPECT_EQ(streamed.size(), 1u);
+    }
+
+    {
+        // cursors are streamed without locating any text position
+        hits_result_t streamed{};
+        configuration const cfg = output{index_cursor} |
+                                  on_hit{[&] (auto const & cur)
+                                         {
+                                             for (auto const text_pos : cur.locate())
+                                                 streamed.push_back(text_pos);
+                                         }};
+        search(this->index, "ACGT"_dna4, cfg);
+        EXPECT_EQ(uniquify(streamed), (hits_result_t{0, 4, 8}));
+    }
+}
+
+TYPED_TEST(search_test, on_hit_delegate_modes)
+{
+    using hits_result_t = std::vector<typename TypeParam::size_type>;
+
+    {
+        // best mode streams exactly one hit
+        hits_result_t streamed{};
+        configuration const cfg = max_error{total{1}} | mode{best} |
+                                  on_hit{[&] (auto const text_pos) { streamed.push_back(text_pos); }};
+        search(this->index, "ACGT"_dna4, cfg);
+        hits_result_t const possible_hits{0, 4, 8}; // 1, 5, 9 are not best hits
+        ASSERT_EQ(streamed.size(), 1u);
+        EXPECT_TRUE(std::find(possible_hits.begin(), possible_hits.end(), streamed[0]) != possible_hits.end());
+    }
+
+    {
+        // all_best mode streams only hits of the best stratum
+        hits_result_t streamed{};
+        configuration const cfg = max_error{total{1}} | mode{all_best} |
+                                  on_hit{[&] (auto const text_pos) { streamed.push_back(text_pos); }};
+        search(this->index, "ACGT"_dna4, cfg);
+        EXPECT_EQ(uniquify(streamed), (hits_result_t{0, 4, 8}));
+    }
+
+    {
+        // strata mode streams the hits of the selected strata
+        hits_result_t streamed{};
+        configuration const cfg = max_error{total{1}} | mode{strata{1}} |
+                                  on_hit{[&] (auto const text_pos) { streamed.push_back(text_pos); }};
+        search(this->index, "ACGT"_dna4, cfg);
+        EXPECT_EQ(uniquify(streamed), (hits_result_t{0, 1, 4, 5, 8, 9}));
+    }
+
+    {
+        // no hit: the delegate is never invoked
+        hits_result_t streamed{};
+        configuration const cfg = on_hit{[&] (auto const text_pos) { streamed.push_back(text_pos); }};
+        search(this->index, "ACGG"_dna4, cfg);
+        EXPECT_EQ(streamed, (hits_result_t{}));
+    }
+}
+
+TYPED_TEST(search_test, on_hit_delegate_multiple_queries)
+{
+    using hits_result_t = std::vector<typename TypeParam::size_type>;
+    std::vector<std::vector<dna4>> const queries{{"GG"_dna4, "ACGTACGTACGT"_dna4, "ACGTA"_dna4}};
+
+    // the queries are searched sequentially and share the same delegate
+    hits_result_t streamed{};
+    configuration const cfg = on_hit{[&] (auto const text_pos) { streamed.push_back(text_pos); }};
+    search(this->index, queries, cfg);
+    EXPECT_EQ(uniquify(streamed), (hits_result_t{0, 4}));
+}